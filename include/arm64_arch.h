@@ -0,0 +1,2413 @@
+/*
+   Copyright (C) 2004 - 2018 Université de Versailles Saint-Quentin-en-Yvelines (UVSQ)
+
+   This file is part of MAQAO.
+
+  MAQAO is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public License
+   as published by the Free Software Foundation; either version 3
+   of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+/**
+* \file arm64_arch.h
+* \brief This file contains the static declaration of architecture specific structures
+* \warning This file has been automatically generated by MINJAG from file arm64_6bf96bbfcca0afd1af78d50ba75869a8.bdf and should not be modified
+* */
+#ifndef ARM64_ARCH_H_
+#define ARM64_ARCH_H_
+
+#include "libmasm.h"
+/*Instruction names indexes*/
+#define I_ABS 0	/**<Code for the ABS opcode*/
+#define I_ADC 1	/**<Code for the ADC opcode*/
+#define I_ADCS 2	/**<Code for the ADCS opcode*/
+#define I_ADD 3	/**<Code for the ADD opcode*/
+#define I_ADDHN 4	/**<Code for the ADDHN opcode*/
+#define I_ADDHN2 5	/**<Code for the ADDHN2 opcode*/
+#define I_ADDP 6	/**<Code for the ADDP opcode*/
+#define I_ADDS 7	/**<Code for the ADDS opcode*/
+#define I_ADDV 8	/**<Code for the ADDV opcode*/
+#define I_ADR 9	/**<Code for the ADR opcode*/
+#define I_ADRP 10	/**<Code for the ADRP opcode*/
+#define I_AESD 11	/**<Code for the AESD opcode*/
+#define I_AESE 12	/**<Code for the AESE opcode*/
+#define I_AESIMC 13	/**<Code for the AESIMC opcode*/
+#define I_AESMC 14	/**<Code for the AESMC opcode*/
+#define I_AND 15	/**<Code for the AND opcode*/
+#define I_ANDS 16	/**<Code for the ANDS opcode*/
+#define I_ASR 17	/**<Code for the ASR opcode*/
+#define I_B 18	/**<Code for the B opcode*/
+#define I_BFM 19	/**<Code for the BFM opcode*/
+#define I_BIC 20	/**<Code for the BIC opcode*/
+#define I_BICS 21	/**<Code for the BICS opcode*/
+#define I_BIF 22	/**<Code for the BIF opcode*/
+#define I_BIT 23	/**<Code for the BIT opcode*/
+#define I_BL 24	/**<Code for the BL opcode*/
+#define I_BLR 25	/**<Code for the BLR opcode*/
+#define I_BR 26	/**<Code for the BR opcode*/
+#define I_BRK 27	/**<Code for the BRK opcode*/
+#define I_BSL 28	/**<Code for the BSL opcode*/
+#define I_CBNZ 29	/**<Code for the CBNZ opcode*/
+#define I_CBZ 30	/**<Code for the CBZ opcode*/
+#define I_CCMN 31	/**<Code for the CCMN opcode*/
+#define I_CCMP 32	/**<Code for the CCMP opcode*/
+#define I_CLREX 33	/**<Code for the CLREX opcode*/
+#define I_CLS 34	/**<Code for the CLS opcode*/
+#define I_CLZ 35	/**<Code for the CLZ opcode*/
+#define I_CMEQ 36	/**<Code for the CMEQ opcode*/
+#define I_CMGE 37	/**<Code for the CMGE opcode*/
+#define I_CMGT 38	/**<Code for the CMGT opcode*/
+#define I_CMHI 39	/**<Code for the CMHI opcode*/
+#define I_CMHS 40	/**<Code for the CMHS opcode*/
+#define I_CMLE 41	/**<Code for the CMLE opcode*/
+#define I_CMLT 42	/**<Code for the CMLT opcode*/
+#define I_CMN 43	/**<Code for the CMN opcode*/
+#define I_CMP 44	/**<Code for the CMP opcode*/
+#define I_CMTST 45	/**<Code for the CMTST opcode*/
+#define I_CNT 46	/**<Code for the CNT opcode*/
+#define I_CRC32B 47	/**<Code for the CRC32B opcode*/
+#define I_CRC32CB 48	/**<Code for the CRC32CB opcode*/
+#define I_CRC32CH 49	/**<Code for the CRC32CH opcode*/
+#define I_CRC32CW 50	/**<Code for the CRC32CW opcode*/
+#define I_CRC32CX 51	/**<Code for the CRC32CX opcode*/
+#define I_CRC32H 52	/**<Code for the CRC32H opcode*/
+#define I_CRC32W 53	/**<Code for the CRC32W opcode*/
+#define I_CRC32X 54	/**<Code for the CRC32X opcode*/
+#define I_CSEL 55	/**<Code for the CSEL opcode*/
+#define I_CSINC 56	/**<Code for the CSINC opcode*/
+#define I_CSINV 57	/**<Code for the CSINV opcode*/
+#define I_CSNEG 58	/**<Code for the CSNEG opcode*/
+#define I_DCPS1 59	/**<Code for the DCPS1 opcode*/
+#define I_DCPS2 60	/**<Code for the DCPS2 opcode*/
+#define I_DCPS3 61	/**<Code for the DCPS3 opcode*/
+#define I_DMB 62	/**<Code for the DMB opcode*/
+#define I_DRPS 63	/**<Code for the DRPS opcode*/
+#define I_DSB 64	/**<Code for the DSB opcode*/
+#define I_DUP 65	/**<Code for the DUP opcode*/
+#define I_EON 66	/**<Code for the EON opcode*/
+#define I_EOR 67	/**<Code for the EOR opcode*/
+#define I_ERET 68	/**<Code for the ERET opcode*/
+#define I_EXT 69	/**<Code for the EXT opcode*/
+#define I_EXTR 70	/**<Code for the EXTR opcode*/
+#define I_FABD 71	/**<Code for the FABD opcode*/
+#define I_FABS 72	/**<Code for the FABS opcode*/
+#define I_FACGE 73	/**<Code for the FACGE opcode*/
+#define I_FACGT 74	/**<Code for the FACGT opcode*/
+#define I_FADD 75	/**<Code for the FADD opcode*/
+#define I_FADDP 76	/**<Code for the FADDP opcode*/
+#define I_FCCMP 77	/**<Code for the FCCMP opcode*/
+#define I_FCCMPE 78	/**<Code for the FCCMPE opcode*/
+#define I_FCMEQ 79	/**<Code for the FCMEQ opcode*/
+#define I_FCMGE 80	/**<Code for the FCMGE opcode*/
+#define I_FCMGT 81	/**<Code for the FCMGT opcode*/
+#define I_FCMLE 82	/**<Code for the FCMLE opcode*/
+#define I_FCMLT 83	/**<Code for the FCMLT opcode*/
+#define I_FCMP 84	/**<Code for the FCMP opcode*/
+#define I_FCMPE 85	/**<Code for the FCMPE opcode*/
+#define I_FCSEL 86	/**<Code for the FCSEL opcode*/
+#define I_FCVT 87	/**<Code for the FCVT opcode*/
+#define I_FCVTAS 88	/**<Code for the FCVTAS opcode*/
+#define I_FCVTAU 89	/**<Code for the FCVTAU opcode*/
+#define I_FCVTL 90	/**<Code for the FCVTL opcode*/
+#define I_FCVTL2 91	/**<Code for the FCVTL2 opcode*/
+#define I_FCVTMS 92	/**<Code for the FCVTMS opcode*/
+#define I_FCVTMU 93	/**<Code for the FCVTMU opcode*/
+#define I_FCVTN 94	/**<Code for the FCVTN opcode*/
+#define I_FCVTN2 95	/**<Code for the FCVTN2 opcode*/
+#define I_FCVTNS 96	/**<Code for the FCVTNS opcode*/
+#define I_FCVTNU 97	/**<Code for the FCVTNU opcode*/
+#define I_FCVTPS 98	/**<Code for the FCVTPS opcode*/
+#define I_FCVTPU 99	/**<Code for the FCVTPU opcode*/
+#define I_FCVTXN 100	/**<Code for the FCVTXN opcode*/
+#define I_FCVTXN2 101	/**<Code for the FCVTXN2 opcode*/
+#define I_FCVTZS 102	/**<Code for the FCVTZS opcode*/
+#define I_FCVTZU 103	/**<Code for the FCVTZU opcode*/
+#define I_FDIV 104	/**<Code for the FDIV opcode*/
+#define I_FMADD 105	/**<Code for the FMADD opcode*/
+#define I_FMAX 106	/**<Code for the FMAX opcode*/
+#define I_FMAXNM 107	/**<Code for the FMAXNM opcode*/
+#define I_FMAXNMP 108	/**<Code for the FMAXNMP opcode*/
+#define I_FMAXNMV 109	/**<Code for the FMAXNMV opcode*/
+#define I_FMAXP 110	/**<Code for the FMAXP opcode*/
+#define I_FMAXV 111	/**<Code for the FMAXV opcode*/
+#define I_FMIN 112	/**<Code for the FMIN opcode*/
+#define I_FMINNM 113	/**<Code for the FMINNM opcode*/
+#define I_FMINNMP 114	/**<Code for the FMINNMP opcode*/
+#define I_FMINNMV 115	/**<Code for the FMINNMV opcode*/
+#define I_FMINP 116	/**<Code for the FMINP opcode*/
+#define I_FMINV 117	/**<Code for the FMINV opcode*/
+#define I_FMLA 118	/**<Code for the FMLA opcode*/
+#define I_FMLS 119	/**<Code for the FMLS opcode*/
+#define I_FMOV 120	/**<Code for the FMOV opcode*/
+#define I_FMSUB 121	/**<Code for the FMSUB opcode*/
+#define I_FMUL 122	/**<Code for the FMUL opcode*/
+#define I_FMULX 123	/**<Code for the FMULX opcode*/
+#define I_FNEG 124	/**<Code for the FNEG opcode*/
+#define I_FNMADD 125	/**<Code for the FNMADD opcode*/
+#define I_FNMSUB 126	/**<Code for the FNMSUB opcode*/
+#define I_FNMUL 127	/**<Code for the FNMUL opcode*/
+#define I_FRECPE 128	/**<Code for the FRECPE opcode*/
+#define I_FRECPS 129	/**<Code for the FRECPS opcode*/
+#define I_FRECPX 130	/**<Code for the FRECPX opcode*/
+#define I_FRINTA 131	/**<Code for the FRINTA opcode*/
+#define I_FRINTI 132	/**<Code for the FRINTI opcode*/
+#define I_FRINTM 133	/**<Code for the FRINTM opcode*/
+#define I_FRINTN 134	/**<Code for the FRINTN opcode*/
+#define I_FRINTP 135	/**<Code for the FRINTP opcode*/
+#define I_FRINTX 136	/**<Code for the FRINTX opcode*/
+#define I_FRINTZ 137	/**<Code for the FRINTZ opcode*/
+#define I_FRSQRTE 138	/**<Code for the FRSQRTE opcode*/
+#define I_FRSQRTS 139	/**<Code for the FRSQRTS opcode*/
+#define I_FSQRT 140	/**<Code for the FSQRT opcode*/
+#define I_FSUB 141	/**<Code for the FSUB opcode*/
+#define I_HINT 142	/**<Code for the HINT opcode*/
+#define I_HLT 143	/**<Code for the HLT opcode*/
+#define I_HVC 144	/**<Code for the HVC opcode*/
+#define I_ISB 145	/**<Code for the ISB opcode*/
+#define I_LD1 146	/**<Code for the LD1 opcode*/
+#define I_LD1R 147	/**<Code for the LD1R opcode*/
+#define I_LD2 148	/**<Code for the LD2 opcode*/
+#define I_LD2R 149	/**<Code for the LD2R opcode*/
+#define I_LD3 150	/**<Code for the LD3 opcode*/
+#define I_LD3R 151	/**<Code for the LD3R opcode*/
+#define I_LD4 152	/**<Code for the LD4 opcode*/
+#define I_LD4R 153	/**<Code for the LD4R opcode*/
+#define I_LDAR 154	/**<Code for the LDAR opcode*/
+#define I_LDARB 155	/**<Code for the LDARB opcode*/
+#define I_LDARH 156	/**<Code for the LDARH opcode*/
+#define I_LDAXP 157	/**<Code for the LDAXP opcode*/
+#define I_LDAXR 158	/**<Code for the LDAXR opcode*/
+#define I_LDAXRB 159	/**<Code for the LDAXRB opcode*/
+#define I_LDAXRH 160	/**<Code for the LDAXRH opcode*/
+#define I_LDNP 161	/**<Code for the LDNP opcode*/
+#define I_LDP 162	/**<Code for the LDP opcode*/
+#define I_LDPSW 163	/**<Code for the LDPSW opcode*/
+#define I_LDR 164	/**<Code for the LDR opcode*/
+#define I_LDRB 165	/**<Code for the LDRB opcode*/
+#define I_LDRH 166	/**<Code for the LDRH opcode*/
+#define I_LDRSB 167	/**<Code for the LDRSB opcode*/
+#define I_LDRSH 168	/**<Code for the LDRSH opcode*/
+#define I_LDRSW 169	/**<Code for the LDRSW opcode*/
+#define I_LDTR 170	/**<Code for the LDTR opcode*/
+#define I_LDTRB 171	/**<Code for the LDTRB opcode*/
+#define I_LDTRH 172	/**<Code for the LDTRH opcode*/
+#define I_LDTRSB 173	/**<Code for the LDTRSB opcode*/
+#define I_LDTRSH 174	/**<Code for the LDTRSH opcode*/
+#define I_LDTRSW 175	/**<Code for the LDTRSW opcode*/
+#define I_LDUR 176	/**<Code for the LDUR opcode*/
+#define I_LDURB 177	/**<Code for the LDURB opcode*/
+#define I_LDURH 178	/**<Code for the LDURH opcode*/
+#define I_LDURSB 179	/**<Code for the LDURSB opcode*/
+#define I_LDURSH 180	/**<Code for the LDURSH opcode*/
+#define I_LDURSW 181	/**<Code for the LDURSW opcode*/
+#define I_LDXP 182	/**<Code for the LDXP opcode*/
+#define I_LDXR 183	/**<Code for the LDXR opcode*/
+#define I_LDXRB 184	/**<Code for the LDXRB opcode*/
+#define I_LDXRH 185	/**<Code for the LDXRH opcode*/
+#define I_LSL 186	/**<Code for the LSL opcode*/
+#define I_LSR 187	/**<Code for the LSR opcode*/
+#define I_MADD 188	/**<Code for the MADD opcode*/
+#define I_MLA 189	/**<Code for the MLA opcode*/
+#define I_MLS 190	/**<Code for the MLS opcode*/
+#define I_MOV 191	/**<Code for the MOV opcode*/
+#define I_MOVI 192	/**<Code for the MOVI opcode*/
+#define I_MOVK 193	/**<Code for the MOVK opcode*/
+#define I_MOVN 194	/**<Code for the MOVN opcode*/
+#define I_MOVZ 195	/**<Code for the MOVZ opcode*/
+#define I_MRS 196	/**<Code for the MRS opcode*/
+#define I_MSR 197	/**<Code for the MSR opcode*/
+#define I_MSUB 198	/**<Code for the MSUB opcode*/
+#define I_MUL 199	/**<Code for the MUL opcode*/
+#define I_MVN 200	/**<Code for the MVN opcode*/
+#define I_MVNI 201	/**<Code for the MVNI opcode*/
+#define I_NEG 202	/**<Code for the NEG opcode*/
+#define I_ORN 203	/**<Code for the ORN opcode*/
+#define I_ORR 204	/**<Code for the ORR opcode*/
+#define I_PMUL 205	/**<Code for the PMUL opcode*/
+#define I_PMULL 206	/**<Code for the PMULL opcode*/
+#define I_PMULL2 207	/**<Code for the PMULL2 opcode*/
+#define I_PRFM 208	/**<Code for the PRFM opcode*/
+#define I_PRFUM 209	/**<Code for the PRFUM opcode*/
+#define I_RADDHN 210	/**<Code for the RADDHN opcode*/
+#define I_RADDHN2 211	/**<Code for the RADDHN2 opcode*/
+#define I_RBIT 212	/**<Code for the RBIT opcode*/
+#define I_RET 213	/**<Code for the RET opcode*/
+#define I_REV 214	/**<Code for the REV opcode*/
+#define I_REV16 215	/**<Code for the REV16 opcode*/
+#define I_REV32 216	/**<Code for the REV32 opcode*/
+#define I_REV64 217	/**<Code for the REV64 opcode*/
+#define I_ROR 218	/**<Code for the ROR opcode*/
+#define I_RSHRN 219	/**<Code for the RSHRN opcode*/
+#define I_RSHRN2 220	/**<Code for the RSHRN2 opcode*/
+#define I_RUSBHN 221	/**<Code for the RUSBHN opcode*/
+#define I_RUSBHN2 222	/**<Code for the RUSBHN2 opcode*/
+#define I_SABA 223	/**<Code for the SABA opcode*/
+#define I_SABAL 224	/**<Code for the SABAL opcode*/
+#define I_SABAL2 225	/**<Code for the SABAL2 opcode*/
+#define I_SABD 226	/**<Code for the SABD opcode*/
+#define I_SABDL 227	/**<Code for the SABDL opcode*/
+#define I_SABDL2 228	/**<Code for the SABDL2 opcode*/
+#define I_SADALP 229	/**<Code for the SADALP opcode*/
+#define I_SADDL 230	/**<Code for the SADDL opcode*/
+#define I_SADDL2 231	/**<Code for the SADDL2 opcode*/
+#define I_SADDLP 232	/**<Code for the SADDLP opcode*/
+#define I_SADDLV 233	/**<Code for the SADDLV opcode*/
+#define I_SADDW 234	/**<Code for the SADDW opcode*/
+#define I_SADDW2 235	/**<Code for the SADDW2 opcode*/
+#define I_SBC 236	/**<Code for the SBC opcode*/
+#define I_SBCS 237	/**<Code for the SBCS opcode*/
+#define I_SBFM 238	/**<Code for the SBFM opcode*/
+#define I_SCVTF 239	/**<Code for the SCVTF opcode*/
+#define I_SDIV 240	/**<Code for the SDIV opcode*/
+#define I_SHA1C 241	/**<Code for the SHA1C opcode*/
+#define I_SHA1H 242	/**<Code for the SHA1H opcode*/
+#define I_SHA1M 243	/**<Code for the SHA1M opcode*/
+#define I_SHA1P 244	/**<Code for the SHA1P opcode*/
+#define I_SHA1SU0 245	/**<Code for the SHA1SU0 opcode*/
+#define I_SHA1SU1 246	/**<Code for the SHA1SU1 opcode*/
+#define I_SHA256H 247	/**<Code for the SHA256H opcode*/
+#define I_SHA256H2 248	/**<Code for the SHA256H2 opcode*/
+#define I_SHA256SU0 249	/**<Code for the SHA256SU0 opcode*/
+#define I_SHA256SU1 250	/**<Code for the SHA256SU1 opcode*/
+#define I_SHADD 251	/**<Code for the SHADD opcode*/
+#define I_SHL 252	/**<Code for the SHL opcode*/
+#define I_SHLL 253	/**<Code for the SHLL opcode*/
+#define I_SHLL2 254	/**<Code for the SHLL2 opcode*/
+#define I_SHRN 255	/**<Code for the SHRN opcode*/
+#define I_SHRN2 256	/**<Code for the SHRN2 opcode*/
+#define I_SHSUB 257	/**<Code for the SHSUB opcode*/
+#define I_SLI 258	/**<Code for the SLI opcode*/
+#define I_SMADDL 259	/**<Code for the SMADDL opcode*/
+#define I_SMAX 260	/**<Code for the SMAX opcode*/
+#define I_SMAXP 261	/**<Code for the SMAXP opcode*/
+#define I_SMAXV 262	/**<Code for the SMAXV opcode*/
+#define I_SMC 263	/**<Code for the SMC opcode*/
+#define I_SMIN 264	/**<Code for the SMIN opcode*/
+#define I_SMINP 265	/**<Code for the SMINP opcode*/
+#define I_SMINV 266	/**<Code for the SMINV opcode*/
+#define I_SMLAL 267	/**<Code for the SMLAL opcode*/
+#define I_SMLAL2 268	/**<Code for the SMLAL2 opcode*/
+#define I_SMLSL 269	/**<Code for the SMLSL opcode*/
+#define I_SMLSL2 270	/**<Code for the SMLSL2 opcode*/
+#define I_SMOV 271	/**<Code for the SMOV opcode*/
+#define I_SMSUBL 272	/**<Code for the SMSUBL opcode*/
+#define I_SMULH 273	/**<Code for the SMULH opcode*/
+#define I_SMULL 274	/**<Code for the SMULL opcode*/
+#define I_SMULL2 275	/**<Code for the SMULL2 opcode*/
+#define I_SQABS 276	/**<Code for the SQABS opcode*/
+#define I_SQADD 277	/**<Code for the SQADD opcode*/
+#define I_SQDMLAL 278	/**<Code for the SQDMLAL opcode*/
+#define I_SQDMLAL2 279	/**<Code for the SQDMLAL2 opcode*/
+#define I_SQDMLSL 280	/**<Code for the SQDMLSL opcode*/
+#define I_SQDMLSL2 281	/**<Code for the SQDMLSL2 opcode*/
+#define I_SQDMULH 282	/**<Code for the SQDMULH opcode*/
+#define I_SQDMULL 283	/**<Code for the SQDMULL opcode*/
+#define I_SQDMULL2 284	/**<Code for the SQDMULL2 opcode*/
+#define I_SQNEG 285	/**<Code for the SQNEG opcode*/
+#define I_SQRDMULH 286	/**<Code for the SQRDMULH opcode*/
+#define I_SQRSHL 287	/**<Code for the SQRSHL opcode*/
+#define I_SQRSHRN 288	/**<Code for the SQRSHRN opcode*/
+#define I_SQRSHRN2 289	/**<Code for the SQRSHRN2 opcode*/
+#define I_SQRSHRUN 290	/**<Code for the SQRSHRUN opcode*/
+#define I_SQRSHRUN2 291	/**<Code for the SQRSHRUN2 opcode*/
+#define I_SQSHL 292	/**<Code for the SQSHL opcode*/
+#define I_SQSHLU 293	/**<Code for the SQSHLU opcode*/
+#define I_SQSHRN 294	/**<Code for the SQSHRN opcode*/
+#define I_SQSHRN2 295	/**<Code for the SQSHRN2 opcode*/
+#define I_SQSHRUN 296	/**<Code for the SQSHRUN opcode*/
+#define I_SQSHRUN2 297	/**<Code for the SQSHRUN2 opcode*/
+#define I_SQSUB 298	/**<Code for the SQSUB opcode*/
+#define I_SQXTN 299	/**<Code for the SQXTN opcode*/
+#define I_SQXTN2 300	/**<Code for the SQXTN2 opcode*/
+#define I_SQXTUN 301	/**<Code for the SQXTUN opcode*/
+#define I_SQXTUN2 302	/**<Code for the SQXTUN2 opcode*/
+#define I_SRHADD 303	/**<Code for the SRHADD opcode*/
+#define I_SRI 304	/**<Code for the SRI opcode*/
+#define I_SRSHL 305	/**<Code for the SRSHL opcode*/
+#define I_SRSHR 306	/**<Code for the SRSHR opcode*/
+#define I_SRSRA 307	/**<Code for the SRSRA opcode*/
+#define I_SSHL 308	/**<Code for the SSHL opcode*/
+#define I_SSHLL 309	/**<Code for the SSHLL opcode*/
+#define I_SSHLL2 310	/**<Code for the SSHLL2 opcode*/
+#define I_SSHR 311	/**<Code for the SSHR opcode*/
+#define I_SSRA 312	/**<Code for the SSRA opcode*/
+#define I_SSUBL 313	/**<Code for the SSUBL opcode*/
+#define I_SSUBL2 314	/**<Code for the SSUBL2 opcode*/
+#define I_SSUBW 315	/**<Code for the SSUBW opcode*/
+#define I_SSUBW2 316	/**<Code for the SSUBW2 opcode*/
+#define I_ST1 317	/**<Code for the ST1 opcode*/
+#define I_ST2 318	/**<Code for the ST2 opcode*/
+#define I_ST3 319	/**<Code for the ST3 opcode*/
+#define I_ST4 320	/**<Code for the ST4 opcode*/
+#define I_STLR 321	/**<Code for the STLR opcode*/
+#define I_STLRB 322	/**<Code for the STLRB opcode*/
+#define I_STLRH 323	/**<Code for the STLRH opcode*/
+#define I_STLXP 324	/**<Code for the STLXP opcode*/
+#define I_STLXR 325	/**<Code for the STLXR opcode*/
+#define I_STLXRB 326	/**<Code for the STLXRB opcode*/
+#define I_STLXRH 327	/**<Code for the STLXRH opcode*/
+#define I_STNP 328	/**<Code for the STNP opcode*/
+#define I_STP 329	/**<Code for the STP opcode*/
+#define I_STR 330	/**<Code for the STR opcode*/
+#define I_STRB 331	/**<Code for the STRB opcode*/
+#define I_STRH 332	/**<Code for the STRH opcode*/
+#define I_STTR 333	/**<Code for the STTR opcode*/
+#define I_STTRB 334	/**<Code for the STTRB opcode*/
+#define I_STTRH 335	/**<Code for the STTRH opcode*/
+#define I_STUR 336	/**<Code for the STUR opcode*/
+#define I_STURB 337	/**<Code for the STURB opcode*/
+#define I_STURH 338	/**<Code for the STURH opcode*/
+#define I_STXP 339	/**<Code for the STXP opcode*/
+#define I_STXR 340	/**<Code for the STXR opcode*/
+#define I_STXRB 341	/**<Code for the STXRB opcode*/
+#define I_STXRH 342	/**<Code for the STXRH opcode*/
+#define I_SUB 343	/**<Code for the SUB opcode*/
+#define I_SUBHN 344	/**<Code for the SUBHN opcode*/
+#define I_SUBHN2 345	/**<Code for the SUBHN2 opcode*/
+#define I_SUBS 346	/**<Code for the SUBS opcode*/
+#define I_SUQADD 347	/**<Code for the SUQADD opcode*/
+#define I_SVC 348	/**<Code for the SVC opcode*/
+#define I_SYS 349	/**<Code for the SYS opcode*/
+#define I_SYSL 350	/**<Code for the SYSL opcode*/
+#define I_TBL 351	/**<Code for the TBL opcode*/
+#define I_TBLX 352	/**<Code for the TBLX opcode*/
+#define I_TBNZ 353	/**<Code for the TBNZ opcode*/
+#define I_TBZ 354	/**<Code for the TBZ opcode*/
+#define I_TRN1 355	/**<Code for the TRN1 opcode*/
+#define I_TRN2 356	/**<Code for the TRN2 opcode*/
+#define I_UABA 357	/**<Code for the UABA opcode*/
+#define I_UABAL 358	/**<Code for the UABAL opcode*/
+#define I_UABAL2 359	/**<Code for the UABAL2 opcode*/
+#define I_UABD 360	/**<Code for the UABD opcode*/
+#define I_UABDL 361	/**<Code for the UABDL opcode*/
+#define I_UABDL2 362	/**<Code for the UABDL2 opcode*/
+#define I_UADALP 363	/**<Code for the UADALP opcode*/
+#define I_UADDL 364	/**<Code for the UADDL opcode*/
+#define I_UADDL2 365	/**<Code for the UADDL2 opcode*/
+#define I_UADDLP 366	/**<Code for the UADDLP opcode*/
+#define I_UADDLV 367	/**<Code for the UADDLV opcode*/
+#define I_UADDW 368	/**<Code for the UADDW opcode*/
+#define I_UADDW2 369	/**<Code for the UADDW2 opcode*/
+#define I_UBFM 370	/**<Code for the UBFM opcode*/
+#define I_UCVTF 371	/**<Code for the UCVTF opcode*/
+#define I_UDIV 372	/**<Code for the UDIV opcode*/
+#define I_UHADD 373	/**<Code for the UHADD opcode*/
+#define I_UHSUB 374	/**<Code for the UHSUB opcode*/
+#define I_UMADDL 375	/**<Code for the UMADDL opcode*/
+#define I_UMAX 376	/**<Code for the UMAX opcode*/
+#define I_UMAXP 377	/**<Code for the UMAXP opcode*/
+#define I_UMAXV 378	/**<Code for the UMAXV opcode*/
+#define I_UMIN 379	/**<Code for the UMIN opcode*/
+#define I_UMINP 380	/**<Code for the UMINP opcode*/
+#define I_UMINV 381	/**<Code for the UMINV opcode*/
+#define I_UMLAL 382	/**<Code for the UMLAL opcode*/
+#define I_UMLAL2 383	/**<Code for the UMLAL2 opcode*/
+#define I_UMLSL 384	/**<Code for the UMLSL opcode*/
+#define I_UMLSL2 385	/**<Code for the UMLSL2 opcode*/
+#define I_UMOV 386	/**<Code for the UMOV opcode*/
+#define I_UMSUBL 387	/**<Code for the UMSUBL opcode*/
+#define I_UMULH 388	/**<Code for the UMULH opcode*/
+#define I_UMULL 389	/**<Code for the UMULL opcode*/
+#define I_UMULL2 390	/**<Code for the UMULL2 opcode*/
+#define I_UQADD 391	/**<Code for the UQADD opcode*/
+#define I_UQRSHL 392	/**<Code for the UQRSHL opcode*/
+#define I_UQRSHRN 393	/**<Code for the UQRSHRN opcode*/
+#define I_UQRSHRN2 394	/**<Code for the UQRSHRN2 opcode*/
+#define I_UQSHL 395	/**<Code for the UQSHL opcode*/
+#define I_UQSHRN 396	/**<Code for the UQSHRN opcode*/
+#define I_UQSHRN2 397	/**<Code for the UQSHRN2 opcode*/
+#define I_UQSUB 398	/**<Code for the UQSUB opcode*/
+#define I_UQXTN 399	/**<Code for the UQXTN opcode*/
+#define I_UQXTN2 400	/**<Code for the UQXTN2 opcode*/
+#define I_URECPE 401	/**<Code for the URECPE opcode*/
+#define I_URHADD 402	/**<Code for the URHADD opcode*/
+#define I_URSHL 403	/**<Code for the URSHL opcode*/
+#define I_URSHR 404	/**<Code for the URSHR opcode*/
+#define I_URSQRTE 405	/**<Code for the URSQRTE opcode*/
+#define I_URSRA 406	/**<Code for the URSRA opcode*/
+#define I_USHL 407	/**<Code for the USHL opcode*/
+#define I_USHLL 408	/**<Code for the USHLL opcode*/
+#define I_USHLL2 409	/**<Code for the USHLL2 opcode*/
+#define I_USHR 410	/**<Code for the USHR opcode*/
+#define I_USQADD 411	/**<Code for the USQADD opcode*/
+#define I_USRA 412	/**<Code for the USRA opcode*/
+#define I_USUBL 413	/**<Code for the USUBL opcode*/
+#define I_USUBL2 414	/**<Code for the USUBL2 opcode*/
+#define I_USUBW 415	/**<Code for the USUBW opcode*/
+#define I_USUBW2 416	/**<Code for the USUBW2 opcode*/
+#define I_UZP1 417	/**<Code for the UZP1 opcode*/
+#define I_UZP2 418	/**<Code for the UZP2 opcode*/
+#define I_XTN 419	/**<Code for the XTN opcode*/
+#define I_XTN2 420	/**<Code for the XTN2 opcode*/
+#define I_ZIP1 421	/**<Code for the ZIP1 opcode*/
+#define I_ZIP2 422	/**<Code for the ZIP2 opcode*/
+//@const_start
+/*Instruction sets indexes*/
+#define ISET_ARM64 1	/**<Code for the ARM64 instruction set*/
+//@const_stop
+/*Register names indexes*/
+#define STDLONG 0	/**<Code for the STDLONG register type*/
+/*Indexes for type STDLONG*/
+#define R_W0 0	/**<Code for the W0 register*/
+#define R_W1 1	/**<Code for the W1 register*/
+#define R_W2 2	/**<Code for the W2 register*/
+#define R_W3 3	/**<Code for the W3 register*/
+#define R_W4 4	/**<Code for the W4 register*/
+#define R_W5 5	/**<Code for the W5 register*/
+#define R_W6 6	/**<Code for the W6 register*/
+#define R_W7 7	/**<Code for the W7 register*/
+#define R_W8 8	/**<Code for the W8 register*/
+#define R_W9 9	/**<Code for the W9 register*/
+#define R_W10 10	/**<Code for the W10 register*/
+#define R_W11 11	/**<Code for the W11 register*/
+#define R_W12 12	/**<Code for the W12 register*/
+#define R_W13 13	/**<Code for the W13 register*/
+#define R_W14 14	/**<Code for the W14 register*/
+#define R_W15 15	/**<Code for the W15 register*/
+#define R_W16 16	/**<Code for the W16 register*/
+#define R_W17 17	/**<Code for the W17 register*/
+#define R_W18 18	/**<Code for the W18 register*/
+#define R_W19 19	/**<Code for the W19 register*/
+#define R_W20 20	/**<Code for the W20 register*/
+#define R_W21 21	/**<Code for the W21 register*/
+#define R_W22 22	/**<Code for the W22 register*/
+#define R_W23 23	/**<Code for the W23 register*/
+#define R_W24 24	/**<Code for the W24 register*/
+#define R_W25 25	/**<Code for the W25 register*/
+#define R_W26 26	/**<Code for the W26 register*/
+#define R_W27 27	/**<Code for the W27 register*/
+#define R_W28 28	/**<Code for the W28 register*/
+#define R_W29 29	/**<Code for the W29 register*/
+#define R_W30 30	/**<Code for the W30 register*/
+#define R_WZR 31	/**<Code for the WZR register*/
+#define STDQUAD 1	/**<Code for the STDQUAD register type*/
+/*Indexes for type STDQUAD*/
+#define R_X0 0	/**<Code for the X0 register*/
+#define R_X1 1	/**<Code for the X1 register*/
+#define R_X2 2	/**<Code for the X2 register*/
+#define R_X3 3	/**<Code for the X3 register*/
+#define R_X4 4	/**<Code for the X4 register*/
+#define R_X5 5	/**<Code for the X5 register*/
+#define R_X6 6	/**<Code for the X6 register*/
+#define R_X7 7	/**<Code for the X7 register*/
+#define R_X8 8	/**<Code for the X8 register*/
+#define R_X9 9	/**<Code for the X9 register*/
+#define R_X10 10	/**<Code for the X10 register*/
+#define R_X11 11	/**<Code for the X11 register*/
+#define R_X12 12	/**<Code for the X12 register*/
+#define R_X13 13	/**<Code for the X13 register*/
+#define R_X14 14	/**<Code for the X14 register*/
+#define R_X15 15	/**<Code for the X15 register*/
+#define R_X16 16	/**<Code for the X16 register*/
+#define R_X17 17	/**<Code for the X17 register*/
+#define R_X18 18	/**<Code for the X18 register*/
+#define R_X19 19	/**<Code for the X19 register*/
+#define R_X20 20	/**<Code for the X20 register*/
+#define R_X21 21	/**<Code for the X21 register*/
+#define R_X22 22	/**<Code for the X22 register*/
+#define R_X23 23	/**<Code for the X23 register*/
+#define R_X24 24	/**<Code for the X24 register*/
+#define R_X25 25	/**<Code for the X25 register*/
+#define R_X26 26	/**<Code for the X26 register*/
+#define R_X27 27	/**<Code for the X27 register*/
+#define R_X28 28	/**<Code for the X28 register*/
+#define R_X29 29	/**<Code for the X29 register*/
+#define R_X30 30	/**<Code for the X30 register*/
+#define R_XZR 31	/**<Code for the XZR register*/
+#define BYTE 2	/**<Code for the BYTE register type*/
+/*Indexes for type BYTE*/
+#define R_B0 0	/**<Code for the B0 register*/
+#define R_B1 1	/**<Code for the B1 register*/
+#define R_B2 2	/**<Code for the B2 register*/
+#define R_B3 3	/**<Code for the B3 register*/
+#define R_B4 4	/**<Code for the B4 register*/
+#define R_B5 5	/**<Code for the B5 register*/
+#define R_B6 6	/**<Code for the B6 register*/
+#define R_B7 7	/**<Code for the B7 register*/
+#define R_B8 8	/**<Code for the B8 register*/
+#define R_B9 9	/**<Code for the B9 register*/
+#define R_B10 10	/**<Code for the B10 register*/
+#define R_B11 11	/**<Code for the B11 register*/
+#define R_B12 12	/**<Code for the B12 register*/
+#define R_B13 13	/**<Code for the B13 register*/
+#define R_B14 14	/**<Code for the B14 register*/
+#define R_B15 15	/**<Code for the B15 register*/
+#define R_B16 16	/**<Code for the B16 register*/
+#define R_B17 17	/**<Code for the B17 register*/
+#define R_B18 18	/**<Code for the B18 register*/
+#define R_B19 19	/**<Code for the B19 register*/
+#define R_B20 20	/**<Code for the B20 register*/
+#define R_B21 21	/**<Code for the B21 register*/
+#define R_B22 22	/**<Code for the B22 register*/
+#define R_B23 23	/**<Code for the B23 register*/
+#define R_B24 24	/**<Code for the B24 register*/
+#define R_B25 25	/**<Code for the B25 register*/
+#define R_B26 26	/**<Code for the B26 register*/
+#define R_B27 27	/**<Code for the B27 register*/
+#define R_B28 28	/**<Code for the B28 register*/
+#define R_B29 29	/**<Code for the B29 register*/
+#define R_B30 30	/**<Code for the B30 register*/
+#define R_B31 31	/**<Code for the B31 register*/
+#define HALF 3	/**<Code for the HALF register type*/
+/*Indexes for type HALF*/
+#define R_H0 0	/**<Code for the H0 register*/
+#define R_H1 1	/**<Code for the H1 register*/
+#define R_H2 2	/**<Code for the H2 register*/
+#define R_H3 3	/**<Code for the H3 register*/
+#define R_H4 4	/**<Code for the H4 register*/
+#define R_H5 5	/**<Code for the H5 register*/
+#define R_H6 6	/**<Code for the H6 register*/
+#define R_H7 7	/**<Code for the H7 register*/
+#define R_H8 8	/**<Code for the H8 register*/
+#define R_H9 9	/**<Code for the H9 register*/
+#define R_H10 10	/**<Code for the H10 register*/
+#define R_H11 11	/**<Code for the H11 register*/
+#define R_H12 12	/**<Code for the H12 register*/
+#define R_H13 13	/**<Code for the H13 register*/
+#define R_H14 14	/**<Code for the H14 register*/
+#define R_H15 15	/**<Code for the H15 register*/
+#define R_H16 16	/**<Code for the H16 register*/
+#define R_H17 17	/**<Code for the H17 register*/
+#define R_H18 18	/**<Code for the H18 register*/
+#define R_H19 19	/**<Code for the H19 register*/
+#define R_H20 20	/**<Code for the H20 register*/
+#define R_H21 21	/**<Code for the H21 register*/
+#define R_H22 22	/**<Code for the H22 register*/
+#define R_H23 23	/**<Code for the H23 register*/
+#define R_H24 24	/**<Code for the H24 register*/
+#define R_H25 25	/**<Code for the H25 register*/
+#define R_H26 26	/**<Code for the H26 register*/
+#define R_H27 27	/**<Code for the H27 register*/
+#define R_H28 28	/**<Code for the H28 register*/
+#define R_H29 29	/**<Code for the H29 register*/
+#define R_H30 30	/**<Code for the H30 register*/
+#define R_H31 31	/**<Code for the H31 register*/
+#define WORD 4	/**<Code for the WORD register type*/
+/*Indexes for type WORD*/
+#define R_S0 0	/**<Code for the S0 register*/
+#define R_S1 1	/**<Code for the S1 register*/
+#define R_S2 2	/**<Code for the S2 register*/
+#define R_S3 3	/**<Code for the S3 register*/
+#define R_S4 4	/**<Code for the S4 register*/
+#define R_S5 5	/**<Code for the S5 register*/
+#define R_S6 6	/**<Code for the S6 register*/
+#define R_S7 7	/**<Code for the S7 register*/
+#define R_S8 8	/**<Code for the S8 register*/
+#define R_S9 9	/**<Code for the S9 register*/
+#define R_S10 10	/**<Code for the S10 register*/
+#define R_S11 11	/**<Code for the S11 register*/
+#define R_S12 12	/**<Code for the S12 register*/
+#define R_S13 13	/**<Code for the S13 register*/
+#define R_S14 14	/**<Code for the S14 register*/
+#define R_S15 15	/**<Code for the S15 register*/
+#define R_S16 16	/**<Code for the S16 register*/
+#define R_S17 17	/**<Code for the S17 register*/
+#define R_S18 18	/**<Code for the S18 register*/
+#define R_S19 19	/**<Code for the S19 register*/
+#define R_S20 20	/**<Code for the S20 register*/
+#define R_S21 21	/**<Code for the S21 register*/
+#define R_S22 22	/**<Code for the S22 register*/
+#define R_S23 23	/**<Code for the S23 register*/
+#define R_S24 24	/**<Code for the S24 register*/
+#define R_S25 25	/**<Code for the S25 register*/
+#define R_S26 26	/**<Code for the S26 register*/
+#define R_S27 27	/**<Code for the S27 register*/
+#define R_S28 28	/**<Code for the S28 register*/
+#define R_S29 29	/**<Code for the S29 register*/
+#define R_S30 30	/**<Code for the S30 register*/
+#define R_S31 31	/**<Code for the S31 register*/
+#define DWORD 5	/**<Code for the DWORD register type*/
+/*Indexes for type DWORD*/
+#define R_D0 0	/**<Code for the D0 register*/
+#define R_D1 1	/**<Code for the D1 register*/
+#define R_D2 2	/**<Code for the D2 register*/
+#define R_D3 3	/**<Code for the D3 register*/
+#define R_D4 4	/**<Code for the D4 register*/
+#define R_D5 5	/**<Code for the D5 register*/
+#define R_D6 6	/**<Code for the D6 register*/
+#define R_D7 7	/**<Code for the D7 register*/
+#define R_D8 8	/**<Code for the D8 register*/
+#define R_D9 9	/**<Code for the D9 register*/
+#define R_D10 10	/**<Code for the D10 register*/
+#define R_D11 11	/**<Code for the D11 register*/
+#define R_D12 12	/**<Code for the D12 register*/
+#define R_D13 13	/**<Code for the D13 register*/
+#define R_D14 14	/**<Code for the D14 register*/
+#define R_D15 15	/**<Code for the D15 register*/
+#define R_D16 16	/**<Code for the D16 register*/
+#define R_D17 17	/**<Code for the D17 register*/
+#define R_D18 18	/**<Code for the D18 register*/
+#define R_D19 19	/**<Code for the D19 register*/
+#define R_D20 20	/**<Code for the D20 register*/
+#define R_D21 21	/**<Code for the D21 register*/
+#define R_D22 22	/**<Code for the D22 register*/
+#define R_D23 23	/**<Code for the D23 register*/
+#define R_D24 24	/**<Code for the D24 register*/
+#define R_D25 25	/**<Code for the D25 register*/
+#define R_D26 26	/**<Code for the D26 register*/
+#define R_D27 27	/**<Code for the D27 register*/
+#define R_D28 28	/**<Code for the D28 register*/
+#define R_D29 29	/**<Code for the D29 register*/
+#define R_D30 30	/**<Code for the D30 register*/
+#define R_D31 31	/**<Code for the D31 register*/
+#define QWORD 6	/**<Code for the QWORD register type*/
+/*Indexes for type QWORD*/
+#define R_Q0 0	/**<Code for the Q0 register*/
+#define R_Q1 1	/**<Code for the Q1 register*/
+#define R_Q2 2	/**<Code for the Q2 register*/
+#define R_Q3 3	/**<Code for the Q3 register*/
+#define R_Q4 4	/**<Code for the Q4 register*/
+#define R_Q5 5	/**<Code for the Q5 register*/
+#define R_Q6 6	/**<Code for the Q6 register*/
+#define R_Q7 7	/**<Code for the Q7 register*/
+#define R_Q8 8	/**<Code for the Q8 register*/
+#define R_Q9 9	/**<Code for the Q9 register*/
+#define R_Q10 10	/**<Code for the Q10 register*/
+#define R_Q11 11	/**<Code for the Q11 register*/
+#define R_Q12 12	/**<Code for the Q12 register*/
+#define R_Q13 13	/**<Code for the Q13 register*/
+#define R_Q14 14	/**<Code for the Q14 register*/
+#define R_Q15 15	/**<Code for the Q15 register*/
+#define R_Q16 16	/**<Code for the Q16 register*/
+#define R_Q17 17	/**<Code for the Q17 register*/
+#define R_Q18 18	/**<Code for the Q18 register*/
+#define R_Q19 19	/**<Code for the Q19 register*/
+#define R_Q20 20	/**<Code for the Q20 register*/
+#define R_Q21 21	/**<Code for the Q21 register*/
+#define R_Q22 22	/**<Code for the Q22 register*/
+#define R_Q23 23	/**<Code for the Q23 register*/
+#define R_Q24 24	/**<Code for the Q24 register*/
+#define R_Q25 25	/**<Code for the Q25 register*/
+#define R_Q26 26	/**<Code for the Q26 register*/
+#define R_Q27 27	/**<Code for the Q27 register*/
+#define R_Q28 28	/**<Code for the Q28 register*/
+#define R_Q29 29	/**<Code for the Q29 register*/
+#define R_Q30 30	/**<Code for the Q30 register*/
+#define R_Q31 31	/**<Code for the Q31 register*/
+#define VECT 7	/**<Code for the VECT register type*/
+/*Indexes for type VECT*/
+#define R_V0 0	/**<Code for the V0 register*/
+#define R_V1 1	/**<Code for the V1 register*/
+#define R_V2 2	/**<Code for the V2 register*/
+#define R_V3 3	/**<Code for the V3 register*/
+#define R_V4 4	/**<Code for the V4 register*/
+#define R_V5 5	/**<Code for the V5 register*/
+#define R_V6 6	/**<Code for the V6 register*/
+#define R_V7 7	/**<Code for the V7 register*/
+#define R_V8 8	/**<Code for the V8 register*/
+#define R_V9 9	/**<Code for the V9 register*/
+#define R_V10 10	/**<Code for the V10 register*/
+#define R_V11 11	/**<Code for the V11 register*/
+#define R_V12 12	/**<Code for the V12 register*/
+#define R_V13 13	/**<Code for the V13 register*/
+#define R_V14 14	/**<Code for the V14 register*/
+#define R_V15 15	/**<Code for the V15 register*/
+#define R_V16 16	/**<Code for the V16 register*/
+#define R_V17 17	/**<Code for the V17 register*/
+#define R_V18 18	/**<Code for the V18 register*/
+#define R_V19 19	/**<Code for the V19 register*/
+#define R_V20 20	/**<Code for the V20 register*/
+#define R_V21 21	/**<Code for the V21 register*/
+#define R_V22 22	/**<Code for the V22 register*/
+#define R_V23 23	/**<Code for the V23 register*/
+#define R_V24 24	/**<Code for the V24 register*/
+#define R_V25 25	/**<Code for the V25 register*/
+#define R_V26 26	/**<Code for the V26 register*/
+#define R_V27 27	/**<Code for the V27 register*/
+#define R_V28 28	/**<Code for the V28 register*/
+#define R_V29 29	/**<Code for the V29 register*/
+#define R_V30 30	/**<Code for the V30 register*/
+#define R_V31 31	/**<Code for the V31 register*/
+#define SPECIAL 8	/**<Code for the SPECIAL register type*/
+/*Indexes for type SPECIAL*/
+#define R_FPSCR 0	/**<Code for the FPSCR register*/
+#define R_APSR 1	/**<Code for the APSR register*/
+#define R_APSR_NZCV 2	/**<Code for the APSR_NZCV register*/
+#define R_APSR_NZCVQ 3	/**<Code for the APSR_NZCVQ register*/
+#define R_APSR_G 4	/**<Code for the APSR_G register*/
+#define R_APSR_NZCVQG 5	/**<Code for the APSR_NZCVQG register*/
+//@const_start
+/*Register families*/
+#define GENREG 0	/**<Code for the GENREG register family*/
+#define SSEREG 1	/**<Code for the SSEREG register family*/
+#define SPCREG 2	/**<Code for the SPCREG register family*/
+//@const_stop
+/*Instruction variant identifiers*/
+#define arm64_VARIANTID_ABS_ARM64_FM_ABS_A_NA_S_SCALAR_T_SINT_T_INT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 1	/**<Variant identifier for ABS_ARM64_FM_ABS_A_NA_S_SCALAR_T_SINT_T_INT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_ABS_ARM64_FM_ABS_A_NA_S_SIMD_T_SINT_T_INT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 2	/**<Variant identifier for ABS_ARM64_FM_ABS_A_NA_S_SIMD_T_SINT_T_INT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_ABS_ARM64_FM_ABS_A_NA_S_SIMD_T_SINT_T_INT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 3	/**<Variant identifier for ABS_ARM64_FM_ABS_A_NA_S_SIMD_T_SINT_T_INT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_ADCS_ARM64_FM_ADD_A_SETFLAGS_S_SCALAR_T_SINT_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ 4	/**<Variant identifier for ADCS_ARM64_FM_ADD_A_SETFLAGS_S_SCALAR_T_SINT_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_ADCS_ARM64_FM_ADD_A_SETFLAGS_S_SCALAR_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ 5	/**<Variant identifier for ADCS_ARM64_FM_ADD_A_SETFLAGS_S_SCALAR_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_ADC_ARM64_FM_ADD_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ 6	/**<Variant identifier for ADC_ARM64_FM_ADD_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_ADC_ARM64_FM_ADD_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ 7	/**<Variant identifier for ADC_ARM64_FM_ADD_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_ADDHN2_ARM64_FM_ADD_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 8	/**<Variant identifier for ADDHN2_ARM64_FM_ADD_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_ADDHN_ARM64_FM_ADD_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 9	/**<Variant identifier for ADDHN_ARM64_FM_ADD_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_ADDP_ARM64_FM_ADD_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 10	/**<Variant identifier for ADDP_ARM64_FM_ADD_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_ADDP_ARM64_FM_ADD_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 11	/**<Variant identifier for ADDP_ARM64_FM_ADD_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_ADDP_ARM64_FM_ADD_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 12	/**<Variant identifier for ADDP_ARM64_FM_ADD_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_ADDS_ARM64_FM_ADD_A_SETFLAGS_S_SCALAR_T_SINT_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_12b_READ 13	/**<Variant identifier for ADDS_ARM64_FM_ADD_A_SETFLAGS_S_SCALAR_T_SINT_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_12b_READ*/
+#define arm64_VARIANTID_ADDS_ARM64_FM_ADD_A_SETFLAGS_S_SCALAR_T_SINT_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ 14	/**<Variant identifier for ADDS_ARM64_FM_ADD_A_SETFLAGS_S_SCALAR_T_SINT_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_ADDS_ARM64_FM_ADD_A_SETFLAGS_S_SCALAR_T_SINT_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ 15	/**<Variant identifier for ADDS_ARM64_FM_ADD_A_SETFLAGS_S_SCALAR_T_SINT_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_ADDS_ARM64_FM_ADD_A_SETFLAGS_S_SCALAR_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_12b_READ 16	/**<Variant identifier for ADDS_ARM64_FM_ADD_A_SETFLAGS_S_SCALAR_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_12b_READ*/
+#define arm64_VARIANTID_ADDS_ARM64_FM_ADD_A_SETFLAGS_S_SCALAR_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ 17	/**<Variant identifier for ADDS_ARM64_FM_ADD_A_SETFLAGS_S_SCALAR_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_ADDS_ARM64_FM_ADD_A_SETFLAGS_S_SCALAR_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ 18	/**<Variant identifier for ADDS_ARM64_FM_ADD_A_SETFLAGS_S_SCALAR_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_ADDS_ARM64_FM_ADD_A_SETFLAGS_S_SCALAR_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ 19	/**<Variant identifier for ADDS_ARM64_FM_ADD_A_SETFLAGS_S_SCALAR_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_ADDV_ARM64_FM_ADD_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 20	/**<Variant identifier for ADDV_ARM64_FM_ADD_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_ADDV_ARM64_FM_ADD_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 21	/**<Variant identifier for ADDV_ARM64_FM_ADD_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_ADDV_ARM64_FM_ADD_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 22	/**<Variant identifier for ADDV_ARM64_FM_ADD_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_ADD_ARM64_FM_ADD_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_12b_READ 23	/**<Variant identifier for ADD_ARM64_FM_ADD_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_12b_READ*/
+#define arm64_VARIANTID_ADD_ARM64_FM_ADD_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ 24	/**<Variant identifier for ADD_ARM64_FM_ADD_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_ADD_ARM64_FM_ADD_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ 25	/**<Variant identifier for ADD_ARM64_FM_ADD_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_ADD_ARM64_FM_ADD_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_12b_READ 26	/**<Variant identifier for ADD_ARM64_FM_ADD_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_12b_READ*/
+#define arm64_VARIANTID_ADD_ARM64_FM_ADD_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ 27	/**<Variant identifier for ADD_ARM64_FM_ADD_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_ADD_ARM64_FM_ADD_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ 28	/**<Variant identifier for ADD_ARM64_FM_ADD_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_ADD_ARM64_FM_ADD_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ 29	/**<Variant identifier for ADD_ARM64_FM_ADD_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_ADD_ARM64_FM_ADD_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 30	/**<Variant identifier for ADD_ARM64_FM_ADD_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_ADD_ARM64_FM_ADD_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 31	/**<Variant identifier for ADD_ARM64_FM_ADD_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_ADD_ARM64_FM_ADD_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 32	/**<Variant identifier for ADD_ARM64_FM_ADD_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_ADRP_ARM64_FM_ADD_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_POINTER_DATASZ_21b_READ 33	/**<Variant identifier for ADRP_ARM64_FM_ADD_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_POINTER_DATASZ_21b_READ*/
+#define arm64_VARIANTID_ADR_ARM64_FM_ADD_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_POINTER_DATASZ_21b_READ 34	/**<Variant identifier for ADR_ARM64_FM_ADD_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_POINTER_DATASZ_21b_READ*/
+#define arm64_VARIANTID_AESD_ARM64_FM_CRYPTO_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 35	/**<Variant identifier for AESD_ARM64_FM_CRYPTO_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_AESE_ARM64_FM_CRYPTO_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 36	/**<Variant identifier for AESE_ARM64_FM_CRYPTO_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_AESIMC_ARM64_FM_CRYPTO_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 37	/**<Variant identifier for AESIMC_ARM64_FM_CRYPTO_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_AESMC_ARM64_FM_CRYPTO_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 38	/**<Variant identifier for AESMC_ARM64_FM_CRYPTO_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_ANDS_ARM64_FM_AND_A_SETFLAGS_S_SCALAR_T_BIT_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_12b_READ 39	/**<Variant identifier for ANDS_ARM64_FM_AND_A_SETFLAGS_S_SCALAR_T_BIT_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_12b_READ*/
+#define arm64_VARIANTID_ANDS_ARM64_FM_AND_A_SETFLAGS_S_SCALAR_T_BIT_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ 40	/**<Variant identifier for ANDS_ARM64_FM_AND_A_SETFLAGS_S_SCALAR_T_BIT_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_ANDS_ARM64_FM_AND_A_SETFLAGS_S_SCALAR_T_BIT_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_13b_READ 41	/**<Variant identifier for ANDS_ARM64_FM_AND_A_SETFLAGS_S_SCALAR_T_BIT_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_13b_READ*/
+#define arm64_VARIANTID_ANDS_ARM64_FM_AND_A_SETFLAGS_S_SCALAR_T_BIT_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ 42	/**<Variant identifier for ANDS_ARM64_FM_AND_A_SETFLAGS_S_SCALAR_T_BIT_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_AND_ARM64_FM_AND_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_12b_READ 43	/**<Variant identifier for AND_ARM64_FM_AND_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_12b_READ*/
+#define arm64_VARIANTID_AND_ARM64_FM_AND_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ 44	/**<Variant identifier for AND_ARM64_FM_AND_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_AND_ARM64_FM_AND_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_13b_READ 45	/**<Variant identifier for AND_ARM64_FM_AND_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_13b_READ*/
+#define arm64_VARIANTID_AND_ARM64_FM_AND_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ 46	/**<Variant identifier for AND_ARM64_FM_AND_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_AND_ARM64_FM_AND_A_NA_S_SIMD_T_BIT_T_BIT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 47	/**<Variant identifier for AND_ARM64_FM_AND_A_NA_S_SIMD_T_BIT_T_BIT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_ASR_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ 48	/**<Variant identifier for ASR_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_ASR_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ 49	/**<Variant identifier for ASR_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_BFM_ARM64_FM_SET_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ_OPRN_IMMEDIATE_DATASZ_5b_READ 50	/**<Variant identifier for BFM_ARM64_FM_SET_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ_OPRN_IMMEDIATE_DATASZ_5b_READ*/
+#define arm64_VARIANTID_BFM_ARM64_FM_SET_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ_OPRN_IMMEDIATE_DATASZ_6b_READ 51	/**<Variant identifier for BFM_ARM64_FM_SET_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ_OPRN_IMMEDIATE_DATASZ_6b_READ*/
+#define arm64_VARIANTID_BICS_ARM64_FM_CLR_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ 52	/**<Variant identifier for BICS_ARM64_FM_CLR_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_BICS_ARM64_FM_CLR_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ 53	/**<Variant identifier for BICS_ARM64_FM_CLR_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_BIC_ARM64_FM_CLR_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ 54	/**<Variant identifier for BIC_ARM64_FM_CLR_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_BIC_ARM64_FM_CLR_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ 55	/**<Variant identifier for BIC_ARM64_FM_CLR_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_BIC_ARM64_FM_CLR_A_NA_S_SIMD_T_BIT_T_BIT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_IMMEDIATE_DATASZ_8b_READ 56	/**<Variant identifier for BIC_ARM64_FM_CLR_A_NA_S_SIMD_T_BIT_T_BIT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_IMMEDIATE_DATASZ_8b_READ*/
+#define arm64_VARIANTID_BIC_ARM64_FM_CLR_A_NA_S_SIMD_T_BIT_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_IMMEDIATE_DATASZ_8b_READ 57	/**<Variant identifier for BIC_ARM64_FM_CLR_A_NA_S_SIMD_T_BIT_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_IMMEDIATE_DATASZ_8b_READ*/
+#define arm64_VARIANTID_BIC_ARM64_FM_CLR_A_NA_S_SIMD_T_BIT_T_BIT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 58	/**<Variant identifier for BIC_ARM64_FM_CLR_A_NA_S_SIMD_T_BIT_T_BIT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_BIF_ARM64_FM_MOV_A_NA_S_SIMD_T_BIT_T_BIT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 59	/**<Variant identifier for BIF_ARM64_FM_MOV_A_NA_S_SIMD_T_BIT_T_BIT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_BIT_ARM64_FM_MOV_A_NA_S_SIMD_T_BIT_T_BIT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 60	/**<Variant identifier for BIT_ARM64_FM_MOV_A_NA_S_SIMD_T_BIT_T_BIT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_BLR_ARM64_FM_CALL_A_CALL_S_SCALAR_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_UNDEF_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ 61	/**<Variant identifier for BLR_ARM64_FM_CALL_A_CALL_S_SCALAR_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_UNDEF_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_BL_ARM64_FM_CALL_A_CALL_S_SCALAR_T_SINT_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF_OPRN_POINTER_DATASZ_28b_READ 62	/**<Variant identifier for BL_ARM64_FM_CALL_A_CALL_S_SCALAR_T_SINT_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF_OPRN_POINTER_DATASZ_28b_READ*/
+#define arm64_VARIANTID_BRK_ARM64_FM_SYNC_A_NA_S_SCALAR_T_INT_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF_OPRN_IMMEDIATE_DATASZ_16b_READ 63	/**<Variant identifier for BRK_ARM64_FM_SYNC_A_NA_S_SCALAR_T_INT_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF_OPRN_IMMEDIATE_DATASZ_16b_READ*/
+#define arm64_VARIANTID_BR_ARM64_FM_JUMP_A_NA_S_SCALAR_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_UNDEF_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ 64	/**<Variant identifier for BR_ARM64_FM_JUMP_A_NA_S_SCALAR_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_UNDEF_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_BSL_ARM64_FM_MOV_A_NA_S_SIMD_T_BIT_T_BIT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 65	/**<Variant identifier for BSL_ARM64_FM_MOV_A_NA_S_SIMD_T_BIT_T_BIT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_B_ARM64_FM_JUMP_A_JUMP_S_SCALAR_T_SINT_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF_OPRN_POINTER_DATASZ_21b_READ 66	/**<Variant identifier for B_ARM64_FM_JUMP_A_JUMP_S_SCALAR_T_SINT_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF_OPRN_POINTER_DATASZ_21b_READ*/
+#define arm64_VARIANTID_B_ARM64_FM_JUMP_A_JUMP_S_SCALAR_T_SINT_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF_OPRN_POINTER_DATASZ_28b_READ 67	/**<Variant identifier for B_ARM64_FM_JUMP_A_JUMP_S_SCALAR_T_SINT_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF_OPRN_POINTER_DATASZ_28b_READ*/
+#define arm64_VARIANTID_CBNZ_ARM64_FM_CJUMP_A_NA_S_SCALAR_T_INT_T_UNDEF_DATASZ_32b_DATASZ_UNDEF_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_POINTER_DATASZ_21b_READ 68	/**<Variant identifier for CBNZ_ARM64_FM_CJUMP_A_NA_S_SCALAR_T_INT_T_UNDEF_DATASZ_32b_DATASZ_UNDEF_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_POINTER_DATASZ_21b_READ*/
+#define arm64_VARIANTID_CBNZ_ARM64_FM_CJUMP_A_NA_S_SCALAR_T_INT_T_UNDEF_DATASZ_64b_DATASZ_UNDEF_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_POINTER_DATASZ_21b_READ 69	/**<Variant identifier for CBNZ_ARM64_FM_CJUMP_A_NA_S_SCALAR_T_INT_T_UNDEF_DATASZ_64b_DATASZ_UNDEF_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_POINTER_DATASZ_21b_READ*/
+#define arm64_VARIANTID_CBZ_ARM64_FM_CJUMP_A_NA_S_SCALAR_T_INT_T_UNDEF_DATASZ_32b_DATASZ_UNDEF_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_POINTER_DATASZ_21b_READ 70	/**<Variant identifier for CBZ_ARM64_FM_CJUMP_A_NA_S_SCALAR_T_INT_T_UNDEF_DATASZ_32b_DATASZ_UNDEF_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_POINTER_DATASZ_21b_READ*/
+#define arm64_VARIANTID_CBZ_ARM64_FM_CJUMP_A_NA_S_SCALAR_T_INT_T_UNDEF_DATASZ_64b_DATASZ_UNDEF_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_POINTER_DATASZ_21b_READ 71	/**<Variant identifier for CBZ_ARM64_FM_CJUMP_A_NA_S_SCALAR_T_INT_T_UNDEF_DATASZ_64b_DATASZ_UNDEF_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_POINTER_DATASZ_21b_READ*/
+#define arm64_VARIANTID_CCMN_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_SINT_T_UNDEF_DATASZ_32b_DATASZ_UNDEF_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ_OPRN_IMMEDIATE_DATASZ_4b_READ 72	/**<Variant identifier for CCMN_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_SINT_T_UNDEF_DATASZ_32b_DATASZ_UNDEF_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ_OPRN_IMMEDIATE_DATASZ_4b_READ*/
+#define arm64_VARIANTID_CCMN_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_SINT_T_UNDEF_DATASZ_32b_DATASZ_UNDEF_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ 73	/**<Variant identifier for CCMN_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_SINT_T_UNDEF_DATASZ_32b_DATASZ_UNDEF_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ*/
+#define arm64_VARIANTID_CCMN_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_UNDEF_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ_OPRN_IMMEDIATE_DATASZ_4b_READ 74	/**<Variant identifier for CCMN_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_UNDEF_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ_OPRN_IMMEDIATE_DATASZ_4b_READ*/
+#define arm64_VARIANTID_CCMN_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_UNDEF_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ 75	/**<Variant identifier for CCMN_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_UNDEF_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ*/
+#define arm64_VARIANTID_CCMP_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_SINT_T_UNDEF_DATASZ_32b_DATASZ_UNDEF_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ_OPRN_IMMEDIATE_DATASZ_4b_READ 76	/**<Variant identifier for CCMP_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_SINT_T_UNDEF_DATASZ_32b_DATASZ_UNDEF_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ_OPRN_IMMEDIATE_DATASZ_4b_READ*/
+#define arm64_VARIANTID_CCMP_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_SINT_T_UNDEF_DATASZ_32b_DATASZ_UNDEF_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ 77	/**<Variant identifier for CCMP_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_SINT_T_UNDEF_DATASZ_32b_DATASZ_UNDEF_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ*/
+#define arm64_VARIANTID_CCMP_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_UNDEF_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ_OPRN_IMMEDIATE_DATASZ_4b_READ 78	/**<Variant identifier for CCMP_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_UNDEF_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ_OPRN_IMMEDIATE_DATASZ_4b_READ*/
+#define arm64_VARIANTID_CCMP_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_UNDEF_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ 79	/**<Variant identifier for CCMP_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_UNDEF_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ*/
+#define arm64_VARIANTID_CLREX_ARM64_FM_SYNC_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF_OPRN_IMMEDIATE_DATASZ_4b_READ 80	/**<Variant identifier for CLREX_ARM64_FM_SYNC_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF_OPRN_IMMEDIATE_DATASZ_4b_READ*/
+#define arm64_VARIANTID_CLS_ARM64_FM_CNT_A_NA_S_SCALAR_T_INT_T_INT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ 81	/**<Variant identifier for CLS_ARM64_FM_CNT_A_NA_S_SCALAR_T_INT_T_INT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_CLS_ARM64_FM_CNT_A_NA_S_SCALAR_T_INT_T_INT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ 82	/**<Variant identifier for CLS_ARM64_FM_CNT_A_NA_S_SCALAR_T_INT_T_INT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_CLS_ARM64_FM_CNT_A_NA_S_SIMD_T_INT_T_INT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 83	/**<Variant identifier for CLS_ARM64_FM_CNT_A_NA_S_SIMD_T_INT_T_INT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_CLZ_ARM64_FM_CNT_A_NA_S_SCALAR_T_INT_T_INT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ 84	/**<Variant identifier for CLZ_ARM64_FM_CNT_A_NA_S_SCALAR_T_INT_T_INT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_CLZ_ARM64_FM_CNT_A_NA_S_SCALAR_T_INT_T_INT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ 85	/**<Variant identifier for CLZ_ARM64_FM_CNT_A_NA_S_SCALAR_T_INT_T_INT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_CLZ_ARM64_FM_CNT_A_NA_S_SIMD_T_INT_T_INT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 86	/**<Variant identifier for CLZ_ARM64_FM_CNT_A_NA_S_SIMD_T_INT_T_INT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_CMEQ_ARM64_FM_CMP_A_NA_S_SCALAR_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ 87	/**<Variant identifier for CMEQ_ARM64_FM_CMP_A_NA_S_SCALAR_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ*/
+#define arm64_VARIANTID_CMEQ_ARM64_FM_CMP_A_NA_S_SCALAR_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 88	/**<Variant identifier for CMEQ_ARM64_FM_CMP_A_NA_S_SCALAR_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_CMEQ_ARM64_FM_CMP_A_NA_S_SIMD_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ 89	/**<Variant identifier for CMEQ_ARM64_FM_CMP_A_NA_S_SIMD_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ*/
+#define arm64_VARIANTID_CMEQ_ARM64_FM_CMP_A_NA_S_SIMD_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 90	/**<Variant identifier for CMEQ_ARM64_FM_CMP_A_NA_S_SIMD_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_CMEQ_ARM64_FM_CMP_A_NA_S_SIMD_T_SINT_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ 91	/**<Variant identifier for CMEQ_ARM64_FM_CMP_A_NA_S_SIMD_T_SINT_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ*/
+#define arm64_VARIANTID_CMEQ_ARM64_FM_CMP_A_NA_S_SIMD_T_SINT_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 92	/**<Variant identifier for CMEQ_ARM64_FM_CMP_A_NA_S_SIMD_T_SINT_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_CMGE_ARM64_FM_CMP_A_NA_S_SCALAR_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ 93	/**<Variant identifier for CMGE_ARM64_FM_CMP_A_NA_S_SCALAR_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ*/
+#define arm64_VARIANTID_CMGE_ARM64_FM_CMP_A_NA_S_SCALAR_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 94	/**<Variant identifier for CMGE_ARM64_FM_CMP_A_NA_S_SCALAR_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_CMGE_ARM64_FM_CMP_A_NA_S_SIMD_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ 95	/**<Variant identifier for CMGE_ARM64_FM_CMP_A_NA_S_SIMD_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ*/
+#define arm64_VARIANTID_CMGE_ARM64_FM_CMP_A_NA_S_SIMD_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 96	/**<Variant identifier for CMGE_ARM64_FM_CMP_A_NA_S_SIMD_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_CMGE_ARM64_FM_CMP_A_NA_S_SIMD_T_SINT_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ 97	/**<Variant identifier for CMGE_ARM64_FM_CMP_A_NA_S_SIMD_T_SINT_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ*/
+#define arm64_VARIANTID_CMGE_ARM64_FM_CMP_A_NA_S_SIMD_T_SINT_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 98	/**<Variant identifier for CMGE_ARM64_FM_CMP_A_NA_S_SIMD_T_SINT_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_CMGT_ARM64_FM_CMP_A_NA_S_SCALAR_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ 99	/**<Variant identifier for CMGT_ARM64_FM_CMP_A_NA_S_SCALAR_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ*/
+#define arm64_VARIANTID_CMGT_ARM64_FM_CMP_A_NA_S_SCALAR_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 100	/**<Variant identifier for CMGT_ARM64_FM_CMP_A_NA_S_SCALAR_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_CMGT_ARM64_FM_CMP_A_NA_S_SIMD_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ 101	/**<Variant identifier for CMGT_ARM64_FM_CMP_A_NA_S_SIMD_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ*/
+#define arm64_VARIANTID_CMGT_ARM64_FM_CMP_A_NA_S_SIMD_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 102	/**<Variant identifier for CMGT_ARM64_FM_CMP_A_NA_S_SIMD_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_CMGT_ARM64_FM_CMP_A_NA_S_SIMD_T_SINT_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ 103	/**<Variant identifier for CMGT_ARM64_FM_CMP_A_NA_S_SIMD_T_SINT_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ*/
+#define arm64_VARIANTID_CMGT_ARM64_FM_CMP_A_NA_S_SIMD_T_SINT_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 104	/**<Variant identifier for CMGT_ARM64_FM_CMP_A_NA_S_SIMD_T_SINT_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_CMHI_ARM64_FM_CMP_A_NA_S_SCALAR_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 105	/**<Variant identifier for CMHI_ARM64_FM_CMP_A_NA_S_SCALAR_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_CMHI_ARM64_FM_CMP_A_NA_S_SIMD_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 106	/**<Variant identifier for CMHI_ARM64_FM_CMP_A_NA_S_SIMD_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_CMHI_ARM64_FM_CMP_A_NA_S_SIMD_T_SINT_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 107	/**<Variant identifier for CMHI_ARM64_FM_CMP_A_NA_S_SIMD_T_SINT_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_CMHS_ARM64_FM_CMP_A_NA_S_SCALAR_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 108	/**<Variant identifier for CMHS_ARM64_FM_CMP_A_NA_S_SCALAR_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_CMHS_ARM64_FM_CMP_A_NA_S_SIMD_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 109	/**<Variant identifier for CMHS_ARM64_FM_CMP_A_NA_S_SIMD_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_CMHS_ARM64_FM_CMP_A_NA_S_SIMD_T_SINT_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 110	/**<Variant identifier for CMHS_ARM64_FM_CMP_A_NA_S_SIMD_T_SINT_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_CMLE_ARM64_FM_CMP_A_NA_S_SCALAR_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ 111	/**<Variant identifier for CMLE_ARM64_FM_CMP_A_NA_S_SCALAR_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ*/
+#define arm64_VARIANTID_CMLE_ARM64_FM_CMP_A_NA_S_SIMD_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ 112	/**<Variant identifier for CMLE_ARM64_FM_CMP_A_NA_S_SIMD_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ*/
+#define arm64_VARIANTID_CMLE_ARM64_FM_CMP_A_NA_S_SIMD_T_SINT_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ 113	/**<Variant identifier for CMLE_ARM64_FM_CMP_A_NA_S_SIMD_T_SINT_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ*/
+#define arm64_VARIANTID_CMLT_ARM64_FM_CMP_A_NA_S_SCALAR_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ 114	/**<Variant identifier for CMLT_ARM64_FM_CMP_A_NA_S_SCALAR_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ*/
+#define arm64_VARIANTID_CMLT_ARM64_FM_CMP_A_NA_S_SIMD_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ 115	/**<Variant identifier for CMLT_ARM64_FM_CMP_A_NA_S_SIMD_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ*/
+#define arm64_VARIANTID_CMLT_ARM64_FM_CMP_A_NA_S_SIMD_T_SINT_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ 116	/**<Variant identifier for CMLT_ARM64_FM_CMP_A_NA_S_SIMD_T_SINT_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ*/
+#define arm64_VARIANTID_CMN_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_SINT_T_UNDEF_DATASZ_32b_DATASZ_UNDEF_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_12b_READ 117	/**<Variant identifier for CMN_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_SINT_T_UNDEF_DATASZ_32b_DATASZ_UNDEF_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_12b_READ*/
+#define arm64_VARIANTID_CMN_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_SINT_T_UNDEF_DATASZ_32b_DATASZ_UNDEF_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ 118	/**<Variant identifier for CMN_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_SINT_T_UNDEF_DATASZ_32b_DATASZ_UNDEF_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_CMN_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_SINT_T_UNDEF_DATASZ_32b_DATASZ_UNDEF_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ 119	/**<Variant identifier for CMN_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_SINT_T_UNDEF_DATASZ_32b_DATASZ_UNDEF_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_CMN_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_UNDEF_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_12b_READ 120	/**<Variant identifier for CMN_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_UNDEF_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_12b_READ*/
+#define arm64_VARIANTID_CMN_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_UNDEF_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ 121	/**<Variant identifier for CMN_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_UNDEF_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_CMN_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_UNDEF_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ 122	/**<Variant identifier for CMN_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_UNDEF_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_CMN_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_UNDEF_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ 123	/**<Variant identifier for CMN_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_UNDEF_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_CMP_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_SINT_T_UNDEF_DATASZ_32b_DATASZ_UNDEF_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_12b_READ 124	/**<Variant identifier for CMP_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_SINT_T_UNDEF_DATASZ_32b_DATASZ_UNDEF_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_12b_READ*/
+#define arm64_VARIANTID_CMP_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_SINT_T_UNDEF_DATASZ_32b_DATASZ_UNDEF_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ 125	/**<Variant identifier for CMP_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_SINT_T_UNDEF_DATASZ_32b_DATASZ_UNDEF_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_CMP_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_SINT_T_UNDEF_DATASZ_32b_DATASZ_UNDEF_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ 126	/**<Variant identifier for CMP_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_SINT_T_UNDEF_DATASZ_32b_DATASZ_UNDEF_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_CMP_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_UNDEF_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_12b_READ 127	/**<Variant identifier for CMP_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_UNDEF_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_12b_READ*/
+#define arm64_VARIANTID_CMP_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_UNDEF_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ 128	/**<Variant identifier for CMP_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_UNDEF_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_CMP_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_UNDEF_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ 129	/**<Variant identifier for CMP_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_UNDEF_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_CMP_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_UNDEF_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ 130	/**<Variant identifier for CMP_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_UNDEF_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_CMTST_ARM64_FM_CMP_A_NA_S_SCALAR_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 131	/**<Variant identifier for CMTST_ARM64_FM_CMP_A_NA_S_SCALAR_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_CMTST_ARM64_FM_CMP_A_NA_S_SIMD_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 132	/**<Variant identifier for CMTST_ARM64_FM_CMP_A_NA_S_SIMD_T_SINT_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_CMTST_ARM64_FM_CMP_A_NA_S_SIMD_T_SINT_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 133	/**<Variant identifier for CMTST_ARM64_FM_CMP_A_NA_S_SIMD_T_SINT_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_CNT_ARM64_FM_CNT_A_NA_S_SIMD_T_SINT_T_INT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 134	/**<Variant identifier for CNT_ARM64_FM_CNT_A_NA_S_SIMD_T_SINT_T_INT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_CRC32B_ARM64_FM_HASH_A_NA_S_SCALAR_T_INT_T_INT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ 135	/**<Variant identifier for CRC32B_ARM64_FM_HASH_A_NA_S_SCALAR_T_INT_T_INT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_CRC32CB_ARM64_FM_HASH_A_NA_S_SCALAR_T_INT_T_INT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ 136	/**<Variant identifier for CRC32CB_ARM64_FM_HASH_A_NA_S_SCALAR_T_INT_T_INT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_CRC32CH_ARM64_FM_HASH_A_NA_S_SCALAR_T_INT_T_INT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ 137	/**<Variant identifier for CRC32CH_ARM64_FM_HASH_A_NA_S_SCALAR_T_INT_T_INT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_CRC32CW_ARM64_FM_HASH_A_NA_S_SCALAR_T_INT_T_INT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ 138	/**<Variant identifier for CRC32CW_ARM64_FM_HASH_A_NA_S_SCALAR_T_INT_T_INT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_CRC32CX_ARM64_FM_HASH_A_NA_S_SCALAR_T_INT_T_INT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ 139	/**<Variant identifier for CRC32CX_ARM64_FM_HASH_A_NA_S_SCALAR_T_INT_T_INT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_CRC32H_ARM64_FM_HASH_A_NA_S_SCALAR_T_INT_T_INT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ 140	/**<Variant identifier for CRC32H_ARM64_FM_HASH_A_NA_S_SCALAR_T_INT_T_INT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_CRC32W_ARM64_FM_HASH_A_NA_S_SCALAR_T_INT_T_INT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ 141	/**<Variant identifier for CRC32W_ARM64_FM_HASH_A_NA_S_SCALAR_T_INT_T_INT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_CRC32X_ARM64_FM_HASH_A_NA_S_SCALAR_T_INT_T_INT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ 142	/**<Variant identifier for CRC32X_ARM64_FM_HASH_A_NA_S_SCALAR_T_INT_T_INT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_CSEL_ARM64_FM_CMOV_A_NA_S_SCALAR_T_INT_T_INT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ 143	/**<Variant identifier for CSEL_ARM64_FM_CMOV_A_NA_S_SCALAR_T_INT_T_INT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_CSEL_ARM64_FM_CMOV_A_NA_S_SCALAR_T_INT_T_INT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ 144	/**<Variant identifier for CSEL_ARM64_FM_CMOV_A_NA_S_SCALAR_T_INT_T_INT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_CSINC_ARM64_FM_CMOV_A_NA_S_SCALAR_T_INT_T_INT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ 145	/**<Variant identifier for CSINC_ARM64_FM_CMOV_A_NA_S_SCALAR_T_INT_T_INT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_CSINC_ARM64_FM_CMOV_A_NA_S_SCALAR_T_INT_T_INT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ 146	/**<Variant identifier for CSINC_ARM64_FM_CMOV_A_NA_S_SCALAR_T_INT_T_INT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_CSINV_ARM64_FM_CMOV_A_NA_S_SCALAR_T_INT_T_INT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ 147	/**<Variant identifier for CSINV_ARM64_FM_CMOV_A_NA_S_SCALAR_T_INT_T_INT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_CSINV_ARM64_FM_CMOV_A_NA_S_SCALAR_T_INT_T_INT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ 148	/**<Variant identifier for CSINV_ARM64_FM_CMOV_A_NA_S_SCALAR_T_INT_T_INT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_CSNEG_ARM64_FM_CMOV_A_NA_S_SCALAR_T_INT_T_INT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ 149	/**<Variant identifier for CSNEG_ARM64_FM_CMOV_A_NA_S_SCALAR_T_INT_T_INT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_CSNEG_ARM64_FM_CMOV_A_NA_S_SCALAR_T_INT_T_INT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ 150	/**<Variant identifier for CSNEG_ARM64_FM_CMOV_A_NA_S_SCALAR_T_INT_T_INT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_DCPS1_ARM64_FM_HW_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF_OPRN_IMMEDIATE_DATASZ_16b_READ 151	/**<Variant identifier for DCPS1_ARM64_FM_HW_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF_OPRN_IMMEDIATE_DATASZ_16b_READ*/
+#define arm64_VARIANTID_DCPS2_ARM64_FM_HW_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF_OPRN_IMMEDIATE_DATASZ_16b_READ 152	/**<Variant identifier for DCPS2_ARM64_FM_HW_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF_OPRN_IMMEDIATE_DATASZ_16b_READ*/
+#define arm64_VARIANTID_DCPS3_ARM64_FM_HW_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF_OPRN_IMMEDIATE_DATASZ_16b_READ 153	/**<Variant identifier for DCPS3_ARM64_FM_HW_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF_OPRN_IMMEDIATE_DATASZ_16b_READ*/
+#define arm64_VARIANTID_DMB_ARM64_FM_SYNC_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF_OPRN_IMMEDIATE_DATASZ_4b_READ 154	/**<Variant identifier for DMB_ARM64_FM_SYNC_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF_OPRN_IMMEDIATE_DATASZ_4b_READ*/
+#define arm64_VARIANTID_DRPS_ARM64_FM_HW_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF 155	/**<Variant identifier for DRPS_ARM64_FM_HW_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF*/
+#define arm64_VARIANTID_DSB_ARM64_FM_SYNC_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF_OPRN_IMMEDIATE_DATASZ_4b_READ 156	/**<Variant identifier for DSB_ARM64_FM_SYNC_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF_OPRN_IMMEDIATE_DATASZ_4b_READ*/
+#define arm64_VARIANTID_DUP_ARM64_FM_MOV_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 157	/**<Variant identifier for DUP_ARM64_FM_MOV_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_DUP_ARM64_FM_MOV_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ 158	/**<Variant identifier for DUP_ARM64_FM_MOV_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_DUP_ARM64_FM_MOV_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 159	/**<Variant identifier for DUP_ARM64_FM_MOV_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_DUP_ARM64_FM_MOV_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ 160	/**<Variant identifier for DUP_ARM64_FM_MOV_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_DUP_ARM64_FM_MOV_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ 161	/**<Variant identifier for DUP_ARM64_FM_MOV_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_DUP_ARM64_FM_MOV_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 162	/**<Variant identifier for DUP_ARM64_FM_MOV_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_DUP_ARM64_FM_MOV_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 163	/**<Variant identifier for DUP_ARM64_FM_MOV_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_DUP_ARM64_FM_MOV_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ 164	/**<Variant identifier for DUP_ARM64_FM_MOV_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_EON_ARM64_FM_XOR_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ 165	/**<Variant identifier for EON_ARM64_FM_XOR_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_EON_ARM64_FM_XOR_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ 166	/**<Variant identifier for EON_ARM64_FM_XOR_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_EOR_ARM64_FM_XOR_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_12b_READ 167	/**<Variant identifier for EOR_ARM64_FM_XOR_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_12b_READ*/
+#define arm64_VARIANTID_EOR_ARM64_FM_XOR_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ 168	/**<Variant identifier for EOR_ARM64_FM_XOR_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_EOR_ARM64_FM_XOR_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_13b_READ 169	/**<Variant identifier for EOR_ARM64_FM_XOR_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_13b_READ*/
+#define arm64_VARIANTID_EOR_ARM64_FM_XOR_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ 170	/**<Variant identifier for EOR_ARM64_FM_XOR_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_EOR_ARM64_FM_XOR_A_NA_S_SIMD_T_BIT_T_BIT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 171	/**<Variant identifier for EOR_ARM64_FM_XOR_A_NA_S_SIMD_T_BIT_T_BIT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_ERET_ARM64_FM_HW_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF 172	/**<Variant identifier for ERET_ARM64_FM_HW_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF*/
+#define arm64_VARIANTID_EXTR_ARM64_FM_MOV_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ 173	/**<Variant identifier for EXTR_ARM64_FM_MOV_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ*/
+#define arm64_VARIANTID_EXTR_ARM64_FM_MOV_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ 174	/**<Variant identifier for EXTR_ARM64_FM_MOV_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ*/
+#define arm64_VARIANTID_EXT_ARM64_FM_MOV_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ 175	/**<Variant identifier for EXT_ARM64_FM_MOV_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ*/
+#define arm64_VARIANTID_EXT_ARM64_FM_MOV_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ 176	/**<Variant identifier for EXT_ARM64_FM_MOV_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ*/
+#define arm64_VARIANTID_FABD_ARM64_FM_ABS_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 177	/**<Variant identifier for FABD_ARM64_FM_ABS_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FABD_ARM64_FM_ABS_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 178	/**<Variant identifier for FABD_ARM64_FM_ABS_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FABD_ARM64_FM_ABS_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 179	/**<Variant identifier for FABD_ARM64_FM_ABS_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FABD_ARM64_FM_ABS_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 180	/**<Variant identifier for FABD_ARM64_FM_ABS_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FABS_ARM64_FM_ABS_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 181	/**<Variant identifier for FABS_ARM64_FM_ABS_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FABS_ARM64_FM_ABS_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 182	/**<Variant identifier for FABS_ARM64_FM_ABS_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FABS_ARM64_FM_ABS_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 183	/**<Variant identifier for FABS_ARM64_FM_ABS_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FABS_ARM64_FM_ABS_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 184	/**<Variant identifier for FABS_ARM64_FM_ABS_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FACGE_ARM64_FM_CMP_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 185	/**<Variant identifier for FACGE_ARM64_FM_CMP_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FACGE_ARM64_FM_CMP_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 186	/**<Variant identifier for FACGE_ARM64_FM_CMP_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FACGE_ARM64_FM_CMP_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 187	/**<Variant identifier for FACGE_ARM64_FM_CMP_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FACGE_ARM64_FM_CMP_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 188	/**<Variant identifier for FACGE_ARM64_FM_CMP_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FACGT_ARM64_FM_CMP_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 189	/**<Variant identifier for FACGT_ARM64_FM_CMP_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FACGT_ARM64_FM_CMP_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 190	/**<Variant identifier for FACGT_ARM64_FM_CMP_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FACGT_ARM64_FM_CMP_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 191	/**<Variant identifier for FACGT_ARM64_FM_CMP_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FACGT_ARM64_FM_CMP_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 192	/**<Variant identifier for FACGT_ARM64_FM_CMP_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FADDP_ARM64_FM_ADD_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 193	/**<Variant identifier for FADDP_ARM64_FM_ADD_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FADDP_ARM64_FM_ADD_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 194	/**<Variant identifier for FADDP_ARM64_FM_ADD_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FADDP_ARM64_FM_ADD_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 195	/**<Variant identifier for FADDP_ARM64_FM_ADD_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FADDP_ARM64_FM_ADD_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 196	/**<Variant identifier for FADDP_ARM64_FM_ADD_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FADD_ARM64_FM_ADD_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 197	/**<Variant identifier for FADD_ARM64_FM_ADD_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FADD_ARM64_FM_ADD_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 198	/**<Variant identifier for FADD_ARM64_FM_ADD_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FADD_ARM64_FM_ADD_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 199	/**<Variant identifier for FADD_ARM64_FM_ADD_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FADD_ARM64_FM_ADD_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 200	/**<Variant identifier for FADD_ARM64_FM_ADD_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FCCMPE_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ 201	/**<Variant identifier for FCCMPE_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ*/
+#define arm64_VARIANTID_FCCMPE_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ 202	/**<Variant identifier for FCCMPE_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ*/
+#define arm64_VARIANTID_FCCMP_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ 203	/**<Variant identifier for FCCMP_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ*/
+#define arm64_VARIANTID_FCCMP_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ 204	/**<Variant identifier for FCCMP_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ*/
+#define arm64_VARIANTID_FCMEQ_ARM64_FM_CMP_A_NA_S_SCALAR_T_FP_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ 205	/**<Variant identifier for FCMEQ_ARM64_FM_CMP_A_NA_S_SCALAR_T_FP_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ*/
+#define arm64_VARIANTID_FCMEQ_ARM64_FM_CMP_A_NA_S_SCALAR_T_FP_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 206	/**<Variant identifier for FCMEQ_ARM64_FM_CMP_A_NA_S_SCALAR_T_FP_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FCMEQ_ARM64_FM_CMP_A_NA_S_SCALAR_T_FP_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ 207	/**<Variant identifier for FCMEQ_ARM64_FM_CMP_A_NA_S_SCALAR_T_FP_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ*/
+#define arm64_VARIANTID_FCMEQ_ARM64_FM_CMP_A_NA_S_SCALAR_T_FP_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 208	/**<Variant identifier for FCMEQ_ARM64_FM_CMP_A_NA_S_SCALAR_T_FP_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FCMEQ_ARM64_FM_CMP_A_NA_S_SIMD_T_FP_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ 209	/**<Variant identifier for FCMEQ_ARM64_FM_CMP_A_NA_S_SIMD_T_FP_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ*/
+#define arm64_VARIANTID_FCMEQ_ARM64_FM_CMP_A_NA_S_SIMD_T_FP_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 210	/**<Variant identifier for FCMEQ_ARM64_FM_CMP_A_NA_S_SIMD_T_FP_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FCMEQ_ARM64_FM_CMP_A_NA_S_SIMD_T_FP_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ 211	/**<Variant identifier for FCMEQ_ARM64_FM_CMP_A_NA_S_SIMD_T_FP_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ*/
+#define arm64_VARIANTID_FCMEQ_ARM64_FM_CMP_A_NA_S_SIMD_T_FP_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 212	/**<Variant identifier for FCMEQ_ARM64_FM_CMP_A_NA_S_SIMD_T_FP_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FCMGE_ARM64_FM_CMP_A_NA_S_SCALAR_T_FP_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ 213	/**<Variant identifier for FCMGE_ARM64_FM_CMP_A_NA_S_SCALAR_T_FP_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ*/
+#define arm64_VARIANTID_FCMGE_ARM64_FM_CMP_A_NA_S_SCALAR_T_FP_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 214	/**<Variant identifier for FCMGE_ARM64_FM_CMP_A_NA_S_SCALAR_T_FP_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FCMGE_ARM64_FM_CMP_A_NA_S_SCALAR_T_FP_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ 215	/**<Variant identifier for FCMGE_ARM64_FM_CMP_A_NA_S_SCALAR_T_FP_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ*/
+#define arm64_VARIANTID_FCMGE_ARM64_FM_CMP_A_NA_S_SCALAR_T_FP_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 216	/**<Variant identifier for FCMGE_ARM64_FM_CMP_A_NA_S_SCALAR_T_FP_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FCMGE_ARM64_FM_CMP_A_NA_S_SIMD_T_FP_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ 217	/**<Variant identifier for FCMGE_ARM64_FM_CMP_A_NA_S_SIMD_T_FP_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ*/
+#define arm64_VARIANTID_FCMGE_ARM64_FM_CMP_A_NA_S_SIMD_T_FP_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 218	/**<Variant identifier for FCMGE_ARM64_FM_CMP_A_NA_S_SIMD_T_FP_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FCMGE_ARM64_FM_CMP_A_NA_S_SIMD_T_FP_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ 219	/**<Variant identifier for FCMGE_ARM64_FM_CMP_A_NA_S_SIMD_T_FP_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ*/
+#define arm64_VARIANTID_FCMGE_ARM64_FM_CMP_A_NA_S_SIMD_T_FP_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 220	/**<Variant identifier for FCMGE_ARM64_FM_CMP_A_NA_S_SIMD_T_FP_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FCMGT_ARM64_FM_CMP_A_NA_S_SCALAR_T_FP_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ 221	/**<Variant identifier for FCMGT_ARM64_FM_CMP_A_NA_S_SCALAR_T_FP_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ*/
+#define arm64_VARIANTID_FCMGT_ARM64_FM_CMP_A_NA_S_SCALAR_T_FP_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 222	/**<Variant identifier for FCMGT_ARM64_FM_CMP_A_NA_S_SCALAR_T_FP_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FCMGT_ARM64_FM_CMP_A_NA_S_SCALAR_T_FP_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ 223	/**<Variant identifier for FCMGT_ARM64_FM_CMP_A_NA_S_SCALAR_T_FP_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ*/
+#define arm64_VARIANTID_FCMGT_ARM64_FM_CMP_A_NA_S_SCALAR_T_FP_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 224	/**<Variant identifier for FCMGT_ARM64_FM_CMP_A_NA_S_SCALAR_T_FP_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FCMGT_ARM64_FM_CMP_A_NA_S_SIMD_T_FP_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ 225	/**<Variant identifier for FCMGT_ARM64_FM_CMP_A_NA_S_SIMD_T_FP_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ*/
+#define arm64_VARIANTID_FCMGT_ARM64_FM_CMP_A_NA_S_SIMD_T_FP_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 226	/**<Variant identifier for FCMGT_ARM64_FM_CMP_A_NA_S_SIMD_T_FP_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FCMGT_ARM64_FM_CMP_A_NA_S_SIMD_T_FP_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ 227	/**<Variant identifier for FCMGT_ARM64_FM_CMP_A_NA_S_SIMD_T_FP_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ*/
+#define arm64_VARIANTID_FCMGT_ARM64_FM_CMP_A_NA_S_SIMD_T_FP_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 228	/**<Variant identifier for FCMGT_ARM64_FM_CMP_A_NA_S_SIMD_T_FP_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FCMLE_ARM64_FM_CMP_A_NA_S_SCALAR_T_FP_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ 229	/**<Variant identifier for FCMLE_ARM64_FM_CMP_A_NA_S_SCALAR_T_FP_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ*/
+#define arm64_VARIANTID_FCMLE_ARM64_FM_CMP_A_NA_S_SCALAR_T_FP_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ 230	/**<Variant identifier for FCMLE_ARM64_FM_CMP_A_NA_S_SCALAR_T_FP_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ*/
+#define arm64_VARIANTID_FCMLE_ARM64_FM_CMP_A_NA_S_SIMD_T_FP_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ 231	/**<Variant identifier for FCMLE_ARM64_FM_CMP_A_NA_S_SIMD_T_FP_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ*/
+#define arm64_VARIANTID_FCMLE_ARM64_FM_CMP_A_NA_S_SIMD_T_FP_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ 232	/**<Variant identifier for FCMLE_ARM64_FM_CMP_A_NA_S_SIMD_T_FP_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ*/
+#define arm64_VARIANTID_FCMLT_ARM64_FM_CMP_A_NA_S_SCALAR_T_FP_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ 233	/**<Variant identifier for FCMLT_ARM64_FM_CMP_A_NA_S_SCALAR_T_FP_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ*/
+#define arm64_VARIANTID_FCMLT_ARM64_FM_CMP_A_NA_S_SCALAR_T_FP_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ 234	/**<Variant identifier for FCMLT_ARM64_FM_CMP_A_NA_S_SCALAR_T_FP_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ*/
+#define arm64_VARIANTID_FCMLT_ARM64_FM_CMP_A_NA_S_SIMD_T_FP_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ 235	/**<Variant identifier for FCMLT_ARM64_FM_CMP_A_NA_S_SIMD_T_FP_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ*/
+#define arm64_VARIANTID_FCMLT_ARM64_FM_CMP_A_NA_S_SIMD_T_FP_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ 236	/**<Variant identifier for FCMLT_ARM64_FM_CMP_A_NA_S_SIMD_T_FP_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ*/
+#define arm64_VARIANTID_FCMPE_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_IMMEDIATE_DATASZ_UNDEF_READ 237	/**<Variant identifier for FCMPE_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_IMMEDIATE_DATASZ_UNDEF_READ*/
+#define arm64_VARIANTID_FCMPE_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 238	/**<Variant identifier for FCMPE_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FCMPE_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_IMMEDIATE_DATASZ_UNDEF_READ 239	/**<Variant identifier for FCMPE_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_IMMEDIATE_DATASZ_UNDEF_READ*/
+#define arm64_VARIANTID_FCMPE_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 240	/**<Variant identifier for FCMPE_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FCMP_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_IMMEDIATE_DATASZ_UNDEF_READ 241	/**<Variant identifier for FCMP_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_IMMEDIATE_DATASZ_UNDEF_READ*/
+#define arm64_VARIANTID_FCMP_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 242	/**<Variant identifier for FCMP_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FCMP_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_IMMEDIATE_DATASZ_UNDEF_READ 243	/**<Variant identifier for FCMP_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_IMMEDIATE_DATASZ_UNDEF_READ*/
+#define arm64_VARIANTID_FCMP_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 244	/**<Variant identifier for FCMP_ARM64_FM_CMP_A_SETFLAGS_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FCSEL_ARM64_FM_CMOV_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 245	/**<Variant identifier for FCSEL_ARM64_FM_CMOV_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FCSEL_ARM64_FM_CMOV_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 246	/**<Variant identifier for FCSEL_ARM64_FM_CMOV_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FCVTAS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 247	/**<Variant identifier for FCVTAS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FCVTAS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 248	/**<Variant identifier for FCVTAS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FCVTAS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 249	/**<Variant identifier for FCVTAS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FCVTAS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 250	/**<Variant identifier for FCVTAS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FCVTAS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 251	/**<Variant identifier for FCVTAS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FCVTAS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 252	/**<Variant identifier for FCVTAS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FCVTAS_ARM64_FM_CVT_A_NA_S_SIMD_T_FP_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 253	/**<Variant identifier for FCVTAS_ARM64_FM_CVT_A_NA_S_SIMD_T_FP_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FCVTAS_ARM64_FM_CVT_A_NA_S_SIMD_T_FP_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 254	/**<Variant identifier for FCVTAS_ARM64_FM_CVT_A_NA_S_SIMD_T_FP_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FCVTAU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 255	/**<Variant identifier for FCVTAU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FCVTAU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 256	/**<Variant identifier for FCVTAU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FCVTAU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 257	/**<Variant identifier for FCVTAU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FCVTAU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 258	/**<Variant identifier for FCVTAU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FCVTAU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 259	/**<Variant identifier for FCVTAU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FCVTAU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 260	/**<Variant identifier for FCVTAU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FCVTAU_ARM64_FM_CVT_A_NA_S_SIMD_T_FP_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 261	/**<Variant identifier for FCVTAU_ARM64_FM_CVT_A_NA_S_SIMD_T_FP_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FCVTAU_ARM64_FM_CVT_A_NA_S_SIMD_T_FP_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 262	/**<Variant identifier for FCVTAU_ARM64_FM_CVT_A_NA_S_SIMD_T_FP_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FCVTL2_ARM64_FM_CVT_A_NA_S_SIMD_T_FP_T_FP_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 263	/**<Variant identifier for FCVTL2_ARM64_FM_CVT_A_NA_S_SIMD_T_FP_T_FP_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FCVTL_ARM64_FM_CVT_A_NA_S_SIMD_T_FP_T_FP_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 264	/**<Variant identifier for FCVTL_ARM64_FM_CVT_A_NA_S_SIMD_T_FP_T_FP_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FCVTMS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 265	/**<Variant identifier for FCVTMS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FCVTMS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 266	/**<Variant identifier for FCVTMS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FCVTMS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 267	/**<Variant identifier for FCVTMS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FCVTMS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 268	/**<Variant identifier for FCVTMS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FCVTMS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 269	/**<Variant identifier for FCVTMS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FCVTMS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 270	/**<Variant identifier for FCVTMS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FCVTMS_ARM64_FM_CVT_A_NA_S_SIMD_T_FP_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 271	/**<Variant identifier for FCVTMS_ARM64_FM_CVT_A_NA_S_SIMD_T_FP_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FCVTMS_ARM64_FM_CVT_A_NA_S_SIMD_T_FP_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 272	/**<Variant identifier for FCVTMS_ARM64_FM_CVT_A_NA_S_SIMD_T_FP_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FCVTMU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 273	/**<Variant identifier for FCVTMU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FCVTMU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 274	/**<Variant identifier for FCVTMU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FCVTMU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 275	/**<Variant identifier for FCVTMU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FCVTMU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 276	/**<Variant identifier for FCVTMU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FCVTMU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 277	/**<Variant identifier for FCVTMU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FCVTMU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 278	/**<Variant identifier for FCVTMU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FCVTMU_ARM64_FM_CVT_A_NA_S_SIMD_T_FP_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 279	/**<Variant identifier for FCVTMU_ARM64_FM_CVT_A_NA_S_SIMD_T_FP_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FCVTMU_ARM64_FM_CVT_A_NA_S_SIMD_T_FP_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 280	/**<Variant identifier for FCVTMU_ARM64_FM_CVT_A_NA_S_SIMD_T_FP_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FCVTN2_ARM64_FM_CVT_A_NA_S_SIMD_T_FP_T_FP_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 281	/**<Variant identifier for FCVTN2_ARM64_FM_CVT_A_NA_S_SIMD_T_FP_T_FP_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FCVTNS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 282	/**<Variant identifier for FCVTNS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FCVTNS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 283	/**<Variant identifier for FCVTNS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FCVTNS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 284	/**<Variant identifier for FCVTNS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FCVTNS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 285	/**<Variant identifier for FCVTNS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FCVTNS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 286	/**<Variant identifier for FCVTNS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FCVTNS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 287	/**<Variant identifier for FCVTNS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FCVTNS_ARM64_FM_CVT_A_NA_S_SIMD_T_FP_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 288	/**<Variant identifier for FCVTNS_ARM64_FM_CVT_A_NA_S_SIMD_T_FP_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FCVTNS_ARM64_FM_CVT_A_NA_S_SIMD_T_FP_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 289	/**<Variant identifier for FCVTNS_ARM64_FM_CVT_A_NA_S_SIMD_T_FP_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FCVTNU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 290	/**<Variant identifier for FCVTNU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FCVTNU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 291	/**<Variant identifier for FCVTNU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FCVTNU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 292	/**<Variant identifier for FCVTNU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FCVTNU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 293	/**<Variant identifier for FCVTNU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FCVTNU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 294	/**<Variant identifier for FCVTNU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FCVTNU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 295	/**<Variant identifier for FCVTNU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FCVTNU_ARM64_FM_CVT_A_NA_S_SIMD_T_FP_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 296	/**<Variant identifier for FCVTNU_ARM64_FM_CVT_A_NA_S_SIMD_T_FP_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FCVTNU_ARM64_FM_CVT_A_NA_S_SIMD_T_FP_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 297	/**<Variant identifier for FCVTNU_ARM64_FM_CVT_A_NA_S_SIMD_T_FP_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FCVTN_ARM64_FM_CVT_A_NA_S_SIMD_T_FP_T_FP_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 298	/**<Variant identifier for FCVTN_ARM64_FM_CVT_A_NA_S_SIMD_T_FP_T_FP_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FCVTPS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 299	/**<Variant identifier for FCVTPS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FCVTPS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 300	/**<Variant identifier for FCVTPS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FCVTPS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 301	/**<Variant identifier for FCVTPS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FCVTPS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 302	/**<Variant identifier for FCVTPS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FCVTPS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 303	/**<Variant identifier for FCVTPS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FCVTPS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 304	/**<Variant identifier for FCVTPS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FCVTPS_ARM64_FM_CVT_A_NA_S_SIMD_T_FP_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 305	/**<Variant identifier for FCVTPS_ARM64_FM_CVT_A_NA_S_SIMD_T_FP_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FCVTPS_ARM64_FM_CVT_A_NA_S_SIMD_T_FP_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 306	/**<Variant identifier for FCVTPS_ARM64_FM_CVT_A_NA_S_SIMD_T_FP_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FCVTPU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 307	/**<Variant identifier for FCVTPU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FCVTPU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 308	/**<Variant identifier for FCVTPU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FCVTPU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 309	/**<Variant identifier for FCVTPU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FCVTPU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 310	/**<Variant identifier for FCVTPU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FCVTPU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 311	/**<Variant identifier for FCVTPU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FCVTPU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 312	/**<Variant identifier for FCVTPU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FCVTPU_ARM64_FM_CVT_A_NA_S_SIMD_T_FP_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 313	/**<Variant identifier for FCVTPU_ARM64_FM_CVT_A_NA_S_SIMD_T_FP_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FCVTPU_ARM64_FM_CVT_A_NA_S_SIMD_T_FP_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 314	/**<Variant identifier for FCVTPU_ARM64_FM_CVT_A_NA_S_SIMD_T_FP_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FCVTXN2_ARM64_FM_CVT_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 315	/**<Variant identifier for FCVTXN2_ARM64_FM_CVT_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FCVTXN_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 316	/**<Variant identifier for FCVTXN_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FCVTXN_ARM64_FM_CVT_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 317	/**<Variant identifier for FCVTXN_ARM64_FM_CVT_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FCVTZS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SFXP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ 318	/**<Variant identifier for FCVTZS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SFXP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ*/
+#define arm64_VARIANTID_FCVTZS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SFXP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ 319	/**<Variant identifier for FCVTZS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SFXP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ*/
+#define arm64_VARIANTID_FCVTZS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SFXP_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ 320	/**<Variant identifier for FCVTZS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SFXP_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ*/
+#define arm64_VARIANTID_FCVTZS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SFXP_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ 321	/**<Variant identifier for FCVTZS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SFXP_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ*/
+#define arm64_VARIANTID_FCVTZS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SFXP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ 322	/**<Variant identifier for FCVTZS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SFXP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ*/
+#define arm64_VARIANTID_FCVTZS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SFXP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ 323	/**<Variant identifier for FCVTZS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SFXP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ*/
+#define arm64_VARIANTID_FCVTZS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 324	/**<Variant identifier for FCVTZS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FCVTZS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 325	/**<Variant identifier for FCVTZS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FCVTZS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 326	/**<Variant identifier for FCVTZS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FCVTZS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 327	/**<Variant identifier for FCVTZS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FCVTZS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 328	/**<Variant identifier for FCVTZS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FCVTZS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 329	/**<Variant identifier for FCVTZS_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FCVTZS_ARM64_FM_CVT_A_NA_S_SIMD_T_FP_T_SFXP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ 330	/**<Variant identifier for FCVTZS_ARM64_FM_CVT_A_NA_S_SIMD_T_FP_T_SFXP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ*/
+#define arm64_VARIANTID_FCVTZS_ARM64_FM_CVT_A_NA_S_SIMD_T_FP_T_SFXP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ 331	/**<Variant identifier for FCVTZS_ARM64_FM_CVT_A_NA_S_SIMD_T_FP_T_SFXP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ*/
+#define arm64_VARIANTID_FCVTZS_ARM64_FM_CVT_A_NA_S_SIMD_T_FP_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 332	/**<Variant identifier for FCVTZS_ARM64_FM_CVT_A_NA_S_SIMD_T_FP_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FCVTZS_ARM64_FM_CVT_A_NA_S_SIMD_T_FP_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 333	/**<Variant identifier for FCVTZS_ARM64_FM_CVT_A_NA_S_SIMD_T_FP_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FCVTZU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UFXP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ 334	/**<Variant identifier for FCVTZU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UFXP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ*/
+#define arm64_VARIANTID_FCVTZU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UFXP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ 335	/**<Variant identifier for FCVTZU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UFXP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ*/
+#define arm64_VARIANTID_FCVTZU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UFXP_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ 336	/**<Variant identifier for FCVTZU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UFXP_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ*/
+#define arm64_VARIANTID_FCVTZU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UFXP_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ 337	/**<Variant identifier for FCVTZU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UFXP_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ*/
+#define arm64_VARIANTID_FCVTZU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UFXP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ 338	/**<Variant identifier for FCVTZU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UFXP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ*/
+#define arm64_VARIANTID_FCVTZU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UFXP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ 339	/**<Variant identifier for FCVTZU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UFXP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ*/
+#define arm64_VARIANTID_FCVTZU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 340	/**<Variant identifier for FCVTZU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FCVTZU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 341	/**<Variant identifier for FCVTZU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FCVTZU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 342	/**<Variant identifier for FCVTZU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FCVTZU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 343	/**<Variant identifier for FCVTZU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FCVTZU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 344	/**<Variant identifier for FCVTZU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FCVTZU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 345	/**<Variant identifier for FCVTZU_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FCVTZU_ARM64_FM_CVT_A_NA_S_SIMD_T_FP_T_UFXP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ 346	/**<Variant identifier for FCVTZU_ARM64_FM_CVT_A_NA_S_SIMD_T_FP_T_UFXP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ*/
+#define arm64_VARIANTID_FCVTZU_ARM64_FM_CVT_A_NA_S_SIMD_T_FP_T_UFXP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ 347	/**<Variant identifier for FCVTZU_ARM64_FM_CVT_A_NA_S_SIMD_T_FP_T_UFXP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ*/
+#define arm64_VARIANTID_FCVTZU_ARM64_FM_CVT_A_NA_S_SIMD_T_FP_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 348	/**<Variant identifier for FCVTZU_ARM64_FM_CVT_A_NA_S_SIMD_T_FP_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FCVTZU_ARM64_FM_CVT_A_NA_S_SIMD_T_FP_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 349	/**<Variant identifier for FCVTZU_ARM64_FM_CVT_A_NA_S_SIMD_T_FP_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FCVT_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ 350	/**<Variant identifier for FCVT_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ*/
+#define arm64_VARIANTID_FCVT_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_16b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ 351	/**<Variant identifier for FCVT_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_16b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ*/
+#define arm64_VARIANTID_FCVT_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 352	/**<Variant identifier for FCVT_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FCVT_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 353	/**<Variant identifier for FCVT_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FCVT_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 354	/**<Variant identifier for FCVT_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FCVT_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 355	/**<Variant identifier for FCVT_ARM64_FM_CVT_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FDIV_ARM64_FM_DIV_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 356	/**<Variant identifier for FDIV_ARM64_FM_DIV_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FDIV_ARM64_FM_DIV_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 357	/**<Variant identifier for FDIV_ARM64_FM_DIV_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FDIV_ARM64_FM_DIV_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 358	/**<Variant identifier for FDIV_ARM64_FM_DIV_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FDIV_ARM64_FM_DIV_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 359	/**<Variant identifier for FDIV_ARM64_FM_DIV_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FMADD_ARM64_FM_FMA_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 360	/**<Variant identifier for FMADD_ARM64_FM_FMA_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FMADD_ARM64_FM_FMA_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 361	/**<Variant identifier for FMADD_ARM64_FM_FMA_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FMAXNMP_ARM64_FM_MAX_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 362	/**<Variant identifier for FMAXNMP_ARM64_FM_MAX_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FMAXNMP_ARM64_FM_MAX_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 363	/**<Variant identifier for FMAXNMP_ARM64_FM_MAX_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FMAXNMP_ARM64_FM_MAX_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 364	/**<Variant identifier for FMAXNMP_ARM64_FM_MAX_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FMAXNMP_ARM64_FM_MAX_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 365	/**<Variant identifier for FMAXNMP_ARM64_FM_MAX_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FMAXNMV_ARM64_FM_MAX_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 366	/**<Variant identifier for FMAXNMV_ARM64_FM_MAX_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FMAXNM_ARM64_FM_MAX_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 367	/**<Variant identifier for FMAXNM_ARM64_FM_MAX_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FMAXNM_ARM64_FM_MAX_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 368	/**<Variant identifier for FMAXNM_ARM64_FM_MAX_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FMAXNM_ARM64_FM_MAX_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 369	/**<Variant identifier for FMAXNM_ARM64_FM_MAX_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FMAXNM_ARM64_FM_MAX_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 370	/**<Variant identifier for FMAXNM_ARM64_FM_MAX_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FMAXP_ARM64_FM_MAX_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 371	/**<Variant identifier for FMAXP_ARM64_FM_MAX_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FMAXP_ARM64_FM_MAX_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 372	/**<Variant identifier for FMAXP_ARM64_FM_MAX_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FMAXP_ARM64_FM_MAX_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 373	/**<Variant identifier for FMAXP_ARM64_FM_MAX_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FMAXP_ARM64_FM_MAX_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 374	/**<Variant identifier for FMAXP_ARM64_FM_MAX_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FMAXV_ARM64_FM_MAX_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 375	/**<Variant identifier for FMAXV_ARM64_FM_MAX_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FMAX_ARM64_FM_MAX_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 376	/**<Variant identifier for FMAX_ARM64_FM_MAX_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FMAX_ARM64_FM_MAX_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 377	/**<Variant identifier for FMAX_ARM64_FM_MAX_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FMAX_ARM64_FM_MAX_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 378	/**<Variant identifier for FMAX_ARM64_FM_MAX_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FMAX_ARM64_FM_MAX_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 379	/**<Variant identifier for FMAX_ARM64_FM_MAX_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FMINNMP_ARM64_FM_MIN_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 380	/**<Variant identifier for FMINNMP_ARM64_FM_MIN_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FMINNMP_ARM64_FM_MIN_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 381	/**<Variant identifier for FMINNMP_ARM64_FM_MIN_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FMINNMP_ARM64_FM_MIN_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 382	/**<Variant identifier for FMINNMP_ARM64_FM_MIN_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FMINNMP_ARM64_FM_MIN_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 383	/**<Variant identifier for FMINNMP_ARM64_FM_MIN_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FMINNMV_ARM64_FM_MIN_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 384	/**<Variant identifier for FMINNMV_ARM64_FM_MIN_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FMINNM_ARM64_FM_MIN_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 385	/**<Variant identifier for FMINNM_ARM64_FM_MIN_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FMINNM_ARM64_FM_MIN_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 386	/**<Variant identifier for FMINNM_ARM64_FM_MIN_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FMINNM_ARM64_FM_MIN_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 387	/**<Variant identifier for FMINNM_ARM64_FM_MIN_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FMINNM_ARM64_FM_MIN_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 388	/**<Variant identifier for FMINNM_ARM64_FM_MIN_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FMINP_ARM64_FM_MIN_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 389	/**<Variant identifier for FMINP_ARM64_FM_MIN_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FMINP_ARM64_FM_MIN_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 390	/**<Variant identifier for FMINP_ARM64_FM_MIN_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FMINP_ARM64_FM_MIN_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 391	/**<Variant identifier for FMINP_ARM64_FM_MIN_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FMINP_ARM64_FM_MIN_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 392	/**<Variant identifier for FMINP_ARM64_FM_MIN_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FMINV_ARM64_FM_MIN_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 393	/**<Variant identifier for FMINV_ARM64_FM_MIN_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FMIN_ARM64_FM_MIN_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 394	/**<Variant identifier for FMIN_ARM64_FM_MIN_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FMIN_ARM64_FM_MIN_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 395	/**<Variant identifier for FMIN_ARM64_FM_MIN_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FMIN_ARM64_FM_MIN_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 396	/**<Variant identifier for FMIN_ARM64_FM_MIN_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FMIN_ARM64_FM_MIN_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 397	/**<Variant identifier for FMIN_ARM64_FM_MIN_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FMLA_ARM64_FM_FMA_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 398	/**<Variant identifier for FMLA_ARM64_FM_FMA_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FMLA_ARM64_FM_FMA_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 399	/**<Variant identifier for FMLA_ARM64_FM_FMA_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FMLA_ARM64_FM_FMA_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 400	/**<Variant identifier for FMLA_ARM64_FM_FMA_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FMLA_ARM64_FM_FMA_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 401	/**<Variant identifier for FMLA_ARM64_FM_FMA_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FMLA_ARM64_FM_FMA_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 402	/**<Variant identifier for FMLA_ARM64_FM_FMA_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FMLA_ARM64_FM_FMA_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 403	/**<Variant identifier for FMLA_ARM64_FM_FMA_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FMLS_ARM64_FM_FMS_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 404	/**<Variant identifier for FMLS_ARM64_FM_FMS_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FMLS_ARM64_FM_FMS_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 405	/**<Variant identifier for FMLS_ARM64_FM_FMS_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FMLS_ARM64_FM_FMS_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 406	/**<Variant identifier for FMLS_ARM64_FM_FMS_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FMLS_ARM64_FM_FMS_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 407	/**<Variant identifier for FMLS_ARM64_FM_FMS_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FMLS_ARM64_FM_FMS_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 408	/**<Variant identifier for FMLS_ARM64_FM_FMS_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FMLS_ARM64_FM_FMS_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 409	/**<Variant identifier for FMLS_ARM64_FM_FMS_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FMOV_ARM64_FM_MOV_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_IMMEDIATE_DATASZ_8b_READ 410	/**<Variant identifier for FMOV_ARM64_FM_MOV_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_IMMEDIATE_DATASZ_8b_READ*/
+#define arm64_VARIANTID_FMOV_ARM64_FM_MOV_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 411	/**<Variant identifier for FMOV_ARM64_FM_MOV_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FMOV_ARM64_FM_MOV_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_READ 412	/**<Variant identifier for FMOV_ARM64_FM_MOV_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FMOV_ARM64_FM_MOV_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 413	/**<Variant identifier for FMOV_ARM64_FM_MOV_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FMOV_ARM64_FM_MOV_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 414	/**<Variant identifier for FMOV_ARM64_FM_MOV_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FMOV_ARM64_FM_MOV_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 415	/**<Variant identifier for FMOV_ARM64_FM_MOV_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FMOV_ARM64_FM_MOV_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_READ 416	/**<Variant identifier for FMOV_ARM64_FM_MOV_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FMOV_ARM64_FM_MOV_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_IMMEDIATE_DATASZ_8b_READ 417	/**<Variant identifier for FMOV_ARM64_FM_MOV_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_IMMEDIATE_DATASZ_8b_READ*/
+#define arm64_VARIANTID_FMOV_ARM64_FM_MOV_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_READ 418	/**<Variant identifier for FMOV_ARM64_FM_MOV_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FMOV_ARM64_FM_MOV_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 419	/**<Variant identifier for FMOV_ARM64_FM_MOV_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FMOV_ARM64_FM_MOV_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_IMMEDIATE_DATASZ_8b_READ 420	/**<Variant identifier for FMOV_ARM64_FM_MOV_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_IMMEDIATE_DATASZ_8b_READ*/
+#define arm64_VARIANTID_FMOV_ARM64_FM_MOV_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_IMMEDIATE_DATASZ_8b_READ 421	/**<Variant identifier for FMOV_ARM64_FM_MOV_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_IMMEDIATE_DATASZ_8b_READ*/
+#define arm64_VARIANTID_FMSUB_ARM64_FM_FMS_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 422	/**<Variant identifier for FMSUB_ARM64_FM_FMS_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FMSUB_ARM64_FM_FMS_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 423	/**<Variant identifier for FMSUB_ARM64_FM_FMS_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FMULX_ARM64_FM_MUL_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 424	/**<Variant identifier for FMULX_ARM64_FM_MUL_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FMULX_ARM64_FM_MUL_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 425	/**<Variant identifier for FMULX_ARM64_FM_MUL_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FMULX_ARM64_FM_MUL_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 426	/**<Variant identifier for FMULX_ARM64_FM_MUL_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FMULX_ARM64_FM_MUL_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 427	/**<Variant identifier for FMULX_ARM64_FM_MUL_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FMULX_ARM64_FM_MUL_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 428	/**<Variant identifier for FMULX_ARM64_FM_MUL_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FMULX_ARM64_FM_MUL_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 429	/**<Variant identifier for FMULX_ARM64_FM_MUL_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FMULX_ARM64_FM_MUL_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 430	/**<Variant identifier for FMULX_ARM64_FM_MUL_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FMULX_ARM64_FM_MUL_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 431	/**<Variant identifier for FMULX_ARM64_FM_MUL_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FMUL_ARM64_FM_MUL_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 432	/**<Variant identifier for FMUL_ARM64_FM_MUL_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FMUL_ARM64_FM_MUL_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 433	/**<Variant identifier for FMUL_ARM64_FM_MUL_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FMUL_ARM64_FM_MUL_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 434	/**<Variant identifier for FMUL_ARM64_FM_MUL_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FMUL_ARM64_FM_MUL_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 435	/**<Variant identifier for FMUL_ARM64_FM_MUL_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FMUL_ARM64_FM_MUL_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 436	/**<Variant identifier for FMUL_ARM64_FM_MUL_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FMUL_ARM64_FM_MUL_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 437	/**<Variant identifier for FMUL_ARM64_FM_MUL_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FMUL_ARM64_FM_MUL_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 438	/**<Variant identifier for FMUL_ARM64_FM_MUL_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FMUL_ARM64_FM_MUL_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 439	/**<Variant identifier for FMUL_ARM64_FM_MUL_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FNEG_ARM64_FM_NEG_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 440	/**<Variant identifier for FNEG_ARM64_FM_NEG_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FNEG_ARM64_FM_NEG_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 441	/**<Variant identifier for FNEG_ARM64_FM_NEG_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FNEG_ARM64_FM_NEG_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 442	/**<Variant identifier for FNEG_ARM64_FM_NEG_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FNEG_ARM64_FM_NEG_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 443	/**<Variant identifier for FNEG_ARM64_FM_NEG_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FNMADD_ARM64_FM_FMA_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 444	/**<Variant identifier for FNMADD_ARM64_FM_FMA_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FNMADD_ARM64_FM_FMA_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 445	/**<Variant identifier for FNMADD_ARM64_FM_FMA_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FNMSUB_ARM64_FM_FMS_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 446	/**<Variant identifier for FNMSUB_ARM64_FM_FMS_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FNMSUB_ARM64_FM_FMS_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 447	/**<Variant identifier for FNMSUB_ARM64_FM_FMS_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FNMUL_ARM64_FM_NEG_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 448	/**<Variant identifier for FNMUL_ARM64_FM_NEG_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FNMUL_ARM64_FM_NEG_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 449	/**<Variant identifier for FNMUL_ARM64_FM_NEG_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FRECPE_ARM64_FM_RCP_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 450	/**<Variant identifier for FRECPE_ARM64_FM_RCP_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FRECPE_ARM64_FM_RCP_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 451	/**<Variant identifier for FRECPE_ARM64_FM_RCP_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FRECPE_ARM64_FM_RCP_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 452	/**<Variant identifier for FRECPE_ARM64_FM_RCP_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FRECPE_ARM64_FM_RCP_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 453	/**<Variant identifier for FRECPE_ARM64_FM_RCP_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FRECPS_ARM64_FM_RCP_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 454	/**<Variant identifier for FRECPS_ARM64_FM_RCP_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FRECPS_ARM64_FM_RCP_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 455	/**<Variant identifier for FRECPS_ARM64_FM_RCP_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FRECPS_ARM64_FM_RCP_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 456	/**<Variant identifier for FRECPS_ARM64_FM_RCP_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FRECPS_ARM64_FM_RCP_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 457	/**<Variant identifier for FRECPS_ARM64_FM_RCP_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FRECPX_ARM64_FM_RCP_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 458	/**<Variant identifier for FRECPX_ARM64_FM_RCP_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FRECPX_ARM64_FM_RCP_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 459	/**<Variant identifier for FRECPX_ARM64_FM_RCP_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FRINTA_ARM64_FM_RND_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 460	/**<Variant identifier for FRINTA_ARM64_FM_RND_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FRINTA_ARM64_FM_RND_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 461	/**<Variant identifier for FRINTA_ARM64_FM_RND_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FRINTA_ARM64_FM_RND_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 462	/**<Variant identifier for FRINTA_ARM64_FM_RND_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FRINTA_ARM64_FM_RND_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 463	/**<Variant identifier for FRINTA_ARM64_FM_RND_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FRINTI_ARM64_FM_RND_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 464	/**<Variant identifier for FRINTI_ARM64_FM_RND_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FRINTI_ARM64_FM_RND_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 465	/**<Variant identifier for FRINTI_ARM64_FM_RND_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FRINTI_ARM64_FM_RND_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 466	/**<Variant identifier for FRINTI_ARM64_FM_RND_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FRINTI_ARM64_FM_RND_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 467	/**<Variant identifier for FRINTI_ARM64_FM_RND_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FRINTM_ARM64_FM_RND_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 468	/**<Variant identifier for FRINTM_ARM64_FM_RND_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FRINTM_ARM64_FM_RND_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 469	/**<Variant identifier for FRINTM_ARM64_FM_RND_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FRINTM_ARM64_FM_RND_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 470	/**<Variant identifier for FRINTM_ARM64_FM_RND_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FRINTM_ARM64_FM_RND_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 471	/**<Variant identifier for FRINTM_ARM64_FM_RND_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FRINTN_ARM64_FM_RND_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 472	/**<Variant identifier for FRINTN_ARM64_FM_RND_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FRINTN_ARM64_FM_RND_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 473	/**<Variant identifier for FRINTN_ARM64_FM_RND_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FRINTN_ARM64_FM_RND_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 474	/**<Variant identifier for FRINTN_ARM64_FM_RND_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FRINTN_ARM64_FM_RND_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 475	/**<Variant identifier for FRINTN_ARM64_FM_RND_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FRINTP_ARM64_FM_RND_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 476	/**<Variant identifier for FRINTP_ARM64_FM_RND_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FRINTP_ARM64_FM_RND_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 477	/**<Variant identifier for FRINTP_ARM64_FM_RND_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FRINTP_ARM64_FM_RND_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 478	/**<Variant identifier for FRINTP_ARM64_FM_RND_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FRINTP_ARM64_FM_RND_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 479	/**<Variant identifier for FRINTP_ARM64_FM_RND_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FRINTX_ARM64_FM_RND_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 480	/**<Variant identifier for FRINTX_ARM64_FM_RND_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FRINTX_ARM64_FM_RND_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 481	/**<Variant identifier for FRINTX_ARM64_FM_RND_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FRINTX_ARM64_FM_RND_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 482	/**<Variant identifier for FRINTX_ARM64_FM_RND_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FRINTX_ARM64_FM_RND_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 483	/**<Variant identifier for FRINTX_ARM64_FM_RND_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FRINTZ_ARM64_FM_RND_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 484	/**<Variant identifier for FRINTZ_ARM64_FM_RND_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FRINTZ_ARM64_FM_RND_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 485	/**<Variant identifier for FRINTZ_ARM64_FM_RND_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FRINTZ_ARM64_FM_RND_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 486	/**<Variant identifier for FRINTZ_ARM64_FM_RND_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FRINTZ_ARM64_FM_RND_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 487	/**<Variant identifier for FRINTZ_ARM64_FM_RND_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FRSQRTE_ARM64_FM_SQRT_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 488	/**<Variant identifier for FRSQRTE_ARM64_FM_SQRT_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FRSQRTE_ARM64_FM_SQRT_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 489	/**<Variant identifier for FRSQRTE_ARM64_FM_SQRT_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FRSQRTE_ARM64_FM_SQRT_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 490	/**<Variant identifier for FRSQRTE_ARM64_FM_SQRT_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FRSQRTE_ARM64_FM_SQRT_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 491	/**<Variant identifier for FRSQRTE_ARM64_FM_SQRT_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FRSQRTS_ARM64_FM_SQRT_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 492	/**<Variant identifier for FRSQRTS_ARM64_FM_SQRT_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FRSQRTS_ARM64_FM_SQRT_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 493	/**<Variant identifier for FRSQRTS_ARM64_FM_SQRT_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FRSQRTS_ARM64_FM_SQRT_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 494	/**<Variant identifier for FRSQRTS_ARM64_FM_SQRT_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FRSQRTS_ARM64_FM_SQRT_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 495	/**<Variant identifier for FRSQRTS_ARM64_FM_SQRT_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FSQRT_ARM64_FM_SQRT_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 496	/**<Variant identifier for FSQRT_ARM64_FM_SQRT_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FSQRT_ARM64_FM_SQRT_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 497	/**<Variant identifier for FSQRT_ARM64_FM_SQRT_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_FSQRT_ARM64_FM_SQRT_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 498	/**<Variant identifier for FSQRT_ARM64_FM_SQRT_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FSQRT_ARM64_FM_SQRT_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 499	/**<Variant identifier for FSQRT_ARM64_FM_SQRT_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FSUB_ARM64_FM_SUB_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 500	/**<Variant identifier for FSUB_ARM64_FM_SUB_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FSUB_ARM64_FM_SUB_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 501	/**<Variant identifier for FSUB_ARM64_FM_SUB_A_NA_S_SCALAR_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_FSUB_ARM64_FM_SUB_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 502	/**<Variant identifier for FSUB_ARM64_FM_SUB_A_NA_S_SIMD_T_FP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_FSUB_ARM64_FM_SUB_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 503	/**<Variant identifier for FSUB_ARM64_FM_SUB_A_NA_S_SIMD_T_FP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_HINT_ARM64_FM_SYNC_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF_OPRN_IMMEDIATE_DATASZ_7b_READ 504	/**<Variant identifier for HINT_ARM64_FM_SYNC_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF_OPRN_IMMEDIATE_DATASZ_7b_READ*/
+#define arm64_VARIANTID_HLT_ARM64_FM_OS_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF_OPRN_IMMEDIATE_DATASZ_16b_READ 505	/**<Variant identifier for HLT_ARM64_FM_OS_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF_OPRN_IMMEDIATE_DATASZ_16b_READ*/
+#define arm64_VARIANTID_HVC_ARM64_FM_HW_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF_OPRN_IMMEDIATE_DATASZ_16b_READ 506	/**<Variant identifier for HVC_ARM64_FM_HW_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF_OPRN_IMMEDIATE_DATASZ_16b_READ*/
+#define arm64_VARIANTID_ISB_ARM64_FM_SYNC_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF 507	/**<Variant identifier for ISB_ARM64_FM_SYNC_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF*/
+#define arm64_VARIANTID_ISB_ARM64_FM_SYNC_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF_OPRN_IMMEDIATE_DATASZ_4b_READ 508	/**<Variant identifier for ISB_ARM64_FM_SYNC_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF_OPRN_IMMEDIATE_DATASZ_4b_READ*/
+#define arm64_VARIANTID_LD1R_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_ONE_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 509	/**<Variant identifier for LD1R_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_ONE_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD1R_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_ONE_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 510	/**<Variant identifier for LD1R_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_ONE_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD1R_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_ONE_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 511	/**<Variant identifier for LD1R_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_ONE_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD1R_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_ONE_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 512	/**<Variant identifier for LD1R_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_ONE_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD1R_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_ONE_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ 513	/**<Variant identifier for LD1R_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_ONE_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD1R_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_ONE_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ 514	/**<Variant identifier for LD1R_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_ONE_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD1_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_ONE_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ 515	/**<Variant identifier for LD1_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_ONE_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD1_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_ONE_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ 516	/**<Variant identifier for LD1_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_ONE_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD1_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_ONE_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 517	/**<Variant identifier for LD1_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_ONE_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD1_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_ONE_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ 518	/**<Variant identifier for LD1_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_ONE_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD1_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_ONE_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ 519	/**<Variant identifier for LD1_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_ONE_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD1_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_ONE_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 520	/**<Variant identifier for LD1_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_ONE_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD1_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_ONE_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ 521	/**<Variant identifier for LD1_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_ONE_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD1_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_ONE_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ 522	/**<Variant identifier for LD1_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_ONE_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD1_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_ONE_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 523	/**<Variant identifier for LD1_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_ONE_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD1_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_ONE_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ 524	/**<Variant identifier for LD1_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_ONE_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD1_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_ONE_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ 525	/**<Variant identifier for LD1_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_ONE_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD1_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_ONE_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 526	/**<Variant identifier for LD1_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_ONE_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD1_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_FOUR_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ 527	/**<Variant identifier for LD1_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_FOUR_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD1_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_FOUR_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ 528	/**<Variant identifier for LD1_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_FOUR_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD1_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_FOUR_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 529	/**<Variant identifier for LD1_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_FOUR_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD1_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_ONE_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ 530	/**<Variant identifier for LD1_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_ONE_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD1_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_ONE_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ 531	/**<Variant identifier for LD1_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_ONE_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD1_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_ONE_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 532	/**<Variant identifier for LD1_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_ONE_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD1_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_THREE_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ 533	/**<Variant identifier for LD1_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_THREE_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD1_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_THREE_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ 534	/**<Variant identifier for LD1_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_THREE_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD1_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_THREE_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 535	/**<Variant identifier for LD1_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_THREE_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD1_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_TWO_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ 536	/**<Variant identifier for LD1_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_TWO_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD1_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_TWO_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ 537	/**<Variant identifier for LD1_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_TWO_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD1_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_TWO_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 538	/**<Variant identifier for LD1_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_TWO_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD2R_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_TWO_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 539	/**<Variant identifier for LD2R_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_TWO_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD2R_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_TWO_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 540	/**<Variant identifier for LD2R_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_TWO_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD2R_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_TWO_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 541	/**<Variant identifier for LD2R_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_TWO_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD2R_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_TWO_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 542	/**<Variant identifier for LD2R_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_TWO_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD2R_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_TWO_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ 543	/**<Variant identifier for LD2R_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_TWO_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD2R_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_TWO_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ 544	/**<Variant identifier for LD2R_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_TWO_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD2_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_TWO_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ 545	/**<Variant identifier for LD2_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_TWO_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD2_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_TWO_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ 546	/**<Variant identifier for LD2_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_TWO_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD2_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_TWO_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 547	/**<Variant identifier for LD2_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_TWO_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD2_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_TWO_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ 548	/**<Variant identifier for LD2_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_TWO_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD2_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_TWO_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ 549	/**<Variant identifier for LD2_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_TWO_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD2_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_TWO_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 550	/**<Variant identifier for LD2_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_TWO_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD2_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_TWO_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ 551	/**<Variant identifier for LD2_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_TWO_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD2_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_TWO_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ 552	/**<Variant identifier for LD2_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_TWO_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD2_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_TWO_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 553	/**<Variant identifier for LD2_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_TWO_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD2_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_TWO_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ 554	/**<Variant identifier for LD2_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_TWO_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD2_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_TWO_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ 555	/**<Variant identifier for LD2_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_TWO_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD2_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_TWO_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 556	/**<Variant identifier for LD2_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_TWO_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD2_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_TWO_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ 557	/**<Variant identifier for LD2_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_TWO_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD2_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_TWO_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ 558	/**<Variant identifier for LD2_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_TWO_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD2_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_TWO_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 559	/**<Variant identifier for LD2_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_TWO_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD2_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_TWO_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ 560	/**<Variant identifier for LD2_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_TWO_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD2_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_TWO_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ 561	/**<Variant identifier for LD2_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_TWO_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD2_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_TWO_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 562	/**<Variant identifier for LD2_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_TWO_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD2_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_TWO_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ 563	/**<Variant identifier for LD2_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_TWO_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD2_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_TWO_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ 564	/**<Variant identifier for LD2_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_TWO_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD2_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_TWO_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 565	/**<Variant identifier for LD2_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_TWO_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD2_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_TWO_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ 566	/**<Variant identifier for LD2_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_TWO_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD2_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_TWO_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ 567	/**<Variant identifier for LD2_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_TWO_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD2_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_TWO_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 568	/**<Variant identifier for LD2_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_TWO_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD3R_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_THREE_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 569	/**<Variant identifier for LD3R_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_THREE_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD3R_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_THREE_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 570	/**<Variant identifier for LD3R_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_THREE_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD3R_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_THREE_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 571	/**<Variant identifier for LD3R_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_THREE_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD3R_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_THREE_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 572	/**<Variant identifier for LD3R_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_THREE_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD3R_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_THREE_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ 573	/**<Variant identifier for LD3R_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_THREE_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD3R_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_THREE_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ 574	/**<Variant identifier for LD3R_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_THREE_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD3_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_THREE_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ 575	/**<Variant identifier for LD3_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_THREE_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD3_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_THREE_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ 576	/**<Variant identifier for LD3_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_THREE_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD3_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_THREE_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 577	/**<Variant identifier for LD3_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_THREE_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD3_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_THREE_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ 578	/**<Variant identifier for LD3_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_THREE_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD3_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_THREE_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ 579	/**<Variant identifier for LD3_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_THREE_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD3_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_THREE_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 580	/**<Variant identifier for LD3_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_THREE_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD3_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_THREE_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ 581	/**<Variant identifier for LD3_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_THREE_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD3_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_THREE_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ 582	/**<Variant identifier for LD3_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_THREE_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD3_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_THREE_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 583	/**<Variant identifier for LD3_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_THREE_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD3_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_THREE_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ 584	/**<Variant identifier for LD3_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_THREE_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD3_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_THREE_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ 585	/**<Variant identifier for LD3_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_THREE_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD3_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_THREE_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 586	/**<Variant identifier for LD3_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_THREE_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD3_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_THREE_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ 587	/**<Variant identifier for LD3_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_THREE_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD3_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_THREE_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ 588	/**<Variant identifier for LD3_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_THREE_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD3_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_THREE_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 589	/**<Variant identifier for LD3_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_THREE_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD3_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_THREE_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ 590	/**<Variant identifier for LD3_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_THREE_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD3_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_THREE_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ 591	/**<Variant identifier for LD3_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_THREE_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD3_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_THREE_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 592	/**<Variant identifier for LD3_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_THREE_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD3_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_THREE_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ 593	/**<Variant identifier for LD3_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_THREE_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD3_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_THREE_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ 594	/**<Variant identifier for LD3_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_THREE_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD3_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_THREE_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 595	/**<Variant identifier for LD3_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_THREE_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD3_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_THREE_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ 596	/**<Variant identifier for LD3_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_THREE_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD3_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_THREE_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ 597	/**<Variant identifier for LD3_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_THREE_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD3_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_THREE_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 598	/**<Variant identifier for LD3_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_THREE_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD4R_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_FOUR_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 599	/**<Variant identifier for LD4R_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_FOUR_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD4R_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_FOUR_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 600	/**<Variant identifier for LD4R_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_FOUR_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD4R_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_FOUR_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 601	/**<Variant identifier for LD4R_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_FOUR_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD4R_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_FOUR_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 602	/**<Variant identifier for LD4R_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_FOUR_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD4R_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_FOUR_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ 603	/**<Variant identifier for LD4R_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_FOUR_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD4R_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_FOUR_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ 604	/**<Variant identifier for LD4R_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_FOUR_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD4_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_FOUR_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ 605	/**<Variant identifier for LD4_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_FOUR_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD4_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_FOUR_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ 606	/**<Variant identifier for LD4_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_FOUR_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD4_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_FOUR_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 607	/**<Variant identifier for LD4_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_FOUR_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD4_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_FOUR_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ 608	/**<Variant identifier for LD4_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_FOUR_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD4_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_FOUR_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ 609	/**<Variant identifier for LD4_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_FOUR_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD4_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_FOUR_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 610	/**<Variant identifier for LD4_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_FOUR_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD4_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_FOUR_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ 611	/**<Variant identifier for LD4_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_FOUR_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD4_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_FOUR_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ 612	/**<Variant identifier for LD4_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_FOUR_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD4_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_FOUR_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 613	/**<Variant identifier for LD4_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_FOUR_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD4_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_FOUR_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ 614	/**<Variant identifier for LD4_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_FOUR_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD4_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_FOUR_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ 615	/**<Variant identifier for LD4_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_FOUR_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD4_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_FOUR_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 616	/**<Variant identifier for LD4_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_FOUR_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD4_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_FOUR_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ 617	/**<Variant identifier for LD4_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_FOUR_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD4_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_FOUR_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ 618	/**<Variant identifier for LD4_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_FOUR_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD4_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_FOUR_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 619	/**<Variant identifier for LD4_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_FOUR_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD4_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_FOUR_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ 620	/**<Variant identifier for LD4_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_FOUR_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD4_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_FOUR_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ 621	/**<Variant identifier for LD4_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_FOUR_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD4_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_FOUR_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 622	/**<Variant identifier for LD4_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_FOUR_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD4_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_FOUR_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ 623	/**<Variant identifier for LD4_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_FOUR_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD4_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_FOUR_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ 624	/**<Variant identifier for LD4_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_FOUR_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD4_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_FOUR_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 625	/**<Variant identifier for LD4_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_FOUR_INDEXED_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD4_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_FOUR_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ 626	/**<Variant identifier for LD4_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_FOUR_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD4_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_FOUR_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ 627	/**<Variant identifier for LD4_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_FOUR_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LD4_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_FOUR_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 628	/**<Variant identifier for LD4_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_FOUR_VECTOR_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDARB_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ 629	/**<Variant identifier for LDARB_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDARH_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ 630	/**<Variant identifier for LDARH_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDAR_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ 631	/**<Variant identifier for LDAR_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDAR_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ 632	/**<Variant identifier for LDAR_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDAXP_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ 633	/**<Variant identifier for LDAXP_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDAXP_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ 634	/**<Variant identifier for LDAXP_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDAXRB_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ 635	/**<Variant identifier for LDAXRB_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDAXRH_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ 636	/**<Variant identifier for LDAXRH_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDAXR_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ 637	/**<Variant identifier for LDAXR_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDAXR_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ 638	/**<Variant identifier for LDAXR_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDNP_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ 639	/**<Variant identifier for LDNP_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDNP_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ 640	/**<Variant identifier for LDNP_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDNP_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_128b_DATASZ_128b_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ 641	/**<Variant identifier for LDNP_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_128b_DATASZ_128b_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDNP_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ 642	/**<Variant identifier for LDNP_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDNP_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ 643	/**<Variant identifier for LDNP_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDPSW_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ 644	/**<Variant identifier for LDPSW_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDPSW_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_READ 645	/**<Variant identifier for LDPSW_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDPSW_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 646	/**<Variant identifier for LDPSW_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDP_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ 647	/**<Variant identifier for LDP_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDP_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_READ 648	/**<Variant identifier for LDP_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDP_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 649	/**<Variant identifier for LDP_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDP_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ 650	/**<Variant identifier for LDP_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDP_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_READ 651	/**<Variant identifier for LDP_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDP_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 652	/**<Variant identifier for LDP_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDP_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_128b_DATASZ_128b_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ 653	/**<Variant identifier for LDP_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_128b_DATASZ_128b_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDP_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_128b_DATASZ_128b_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_READ 654	/**<Variant identifier for LDP_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_128b_DATASZ_128b_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDP_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_128b_DATASZ_128b_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 655	/**<Variant identifier for LDP_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_128b_DATASZ_128b_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDP_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ 656	/**<Variant identifier for LDP_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDP_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_READ 657	/**<Variant identifier for LDP_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDP_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 658	/**<Variant identifier for LDP_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDP_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ 659	/**<Variant identifier for LDP_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDP_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_READ 660	/**<Variant identifier for LDP_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDP_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 661	/**<Variant identifier for LDP_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDRB_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_INDEX_DATASZ_32b_READ 662	/**<Variant identifier for LDRB_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDRB_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_READ 663	/**<Variant identifier for LDRB_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDRB_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 664	/**<Variant identifier for LDRB_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDRB_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_SWORD_REGISTER_INDEX_DATASZ_32b_READ 665	/**<Variant identifier for LDRB_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_SWORD_REGISTER_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDRB_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ 666	/**<Variant identifier for LDRB_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDRH_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_INDEX_DATASZ_32b_READ 667	/**<Variant identifier for LDRH_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDRH_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_READ 668	/**<Variant identifier for LDRH_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDRH_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 669	/**<Variant identifier for LDRH_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDRH_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_SWORD_REGISTER_INDEX_DATASZ_32b_READ 670	/**<Variant identifier for LDRH_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_SWORD_REGISTER_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDRH_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ 671	/**<Variant identifier for LDRH_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDRSB_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_INDEX_DATASZ_32b_READ 672	/**<Variant identifier for LDRSB_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDRSB_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_READ 673	/**<Variant identifier for LDRSB_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDRSB_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 674	/**<Variant identifier for LDRSB_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDRSB_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_SWORD_REGISTER_INDEX_DATASZ_32b_READ 675	/**<Variant identifier for LDRSB_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_SWORD_REGISTER_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDRSB_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ 676	/**<Variant identifier for LDRSB_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDRSB_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_INDEX_DATASZ_32b_READ 677	/**<Variant identifier for LDRSB_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDRSB_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_READ 678	/**<Variant identifier for LDRSB_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDRSB_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 679	/**<Variant identifier for LDRSB_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDRSB_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_SWORD_REGISTER_INDEX_DATASZ_32b_READ 680	/**<Variant identifier for LDRSB_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_SWORD_REGISTER_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDRSB_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ 681	/**<Variant identifier for LDRSB_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDRSH_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_INDEX_DATASZ_32b_READ 682	/**<Variant identifier for LDRSH_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDRSH_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_READ 683	/**<Variant identifier for LDRSH_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDRSH_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 684	/**<Variant identifier for LDRSH_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDRSH_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_SWORD_REGISTER_INDEX_DATASZ_32b_READ 685	/**<Variant identifier for LDRSH_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_SWORD_REGISTER_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDRSH_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ 686	/**<Variant identifier for LDRSH_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDRSH_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_INDEX_DATASZ_32b_READ 687	/**<Variant identifier for LDRSH_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDRSH_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_READ 688	/**<Variant identifier for LDRSH_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDRSH_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 689	/**<Variant identifier for LDRSH_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDRSH_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_SWORD_REGISTER_INDEX_DATASZ_32b_READ 690	/**<Variant identifier for LDRSH_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_SWORD_REGISTER_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDRSH_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ 691	/**<Variant identifier for LDRSH_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDRSW_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_INDEX_DATASZ_32b_READ 692	/**<Variant identifier for LDRSW_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDRSW_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_READ 693	/**<Variant identifier for LDRSW_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDRSW_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 694	/**<Variant identifier for LDRSW_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDRSW_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_SWORD_REGISTER_INDEX_DATASZ_32b_READ 695	/**<Variant identifier for LDRSW_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_SWORD_REGISTER_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDRSW_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ 696	/**<Variant identifier for LDRSW_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDRSW_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_POINTER_DATASZ_21b_READ 697	/**<Variant identifier for LDRSW_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_POINTER_DATASZ_21b_READ*/
+#define arm64_VARIANTID_LDR_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_INDEX_DATASZ_32b_READ 698	/**<Variant identifier for LDR_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDR_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_READ 699	/**<Variant identifier for LDR_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDR_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 700	/**<Variant identifier for LDR_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDR_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_SWORD_REGISTER_INDEX_DATASZ_32b_READ 701	/**<Variant identifier for LDR_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_SWORD_REGISTER_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDR_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ 702	/**<Variant identifier for LDR_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDR_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_POINTER_DATASZ_21b_READ 703	/**<Variant identifier for LDR_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_POINTER_DATASZ_21b_READ*/
+#define arm64_VARIANTID_LDR_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_INDEX_DATASZ_32b_READ 704	/**<Variant identifier for LDR_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDR_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_READ 705	/**<Variant identifier for LDR_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDR_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 706	/**<Variant identifier for LDR_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDR_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_SWORD_REGISTER_INDEX_DATASZ_32b_READ 707	/**<Variant identifier for LDR_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_SWORD_REGISTER_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDR_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ 708	/**<Variant identifier for LDR_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDR_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_POINTER_DATASZ_21b_READ 709	/**<Variant identifier for LDR_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_POINTER_DATASZ_21b_READ*/
+#define arm64_VARIANTID_LDR_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_128b_DATASZ_128b_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_INDEX_DATASZ_32b_READ 710	/**<Variant identifier for LDR_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_128b_DATASZ_128b_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDR_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_128b_DATASZ_128b_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_READ 711	/**<Variant identifier for LDR_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_128b_DATASZ_128b_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDR_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_128b_DATASZ_128b_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 712	/**<Variant identifier for LDR_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_128b_DATASZ_128b_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDR_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_128b_DATASZ_128b_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_WRITE_OPRN_MEMORY_SWORD_REGISTER_INDEX_DATASZ_32b_READ 713	/**<Variant identifier for LDR_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_128b_DATASZ_128b_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_WRITE_OPRN_MEMORY_SWORD_REGISTER_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDR_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_128b_DATASZ_128b_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ 714	/**<Variant identifier for LDR_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_128b_DATASZ_128b_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDR_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_128b_DATASZ_128b_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_WRITE_OPRN_POINTER_DATASZ_21b_READ 715	/**<Variant identifier for LDR_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_128b_DATASZ_128b_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_WRITE_OPRN_POINTER_DATASZ_21b_READ*/
+#define arm64_VARIANTID_LDR_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_INDEX_DATASZ_32b_READ 716	/**<Variant identifier for LDR_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDR_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_READ 717	/**<Variant identifier for LDR_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDR_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 718	/**<Variant identifier for LDR_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDR_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_MEMORY_SWORD_REGISTER_INDEX_DATASZ_32b_READ 719	/**<Variant identifier for LDR_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_MEMORY_SWORD_REGISTER_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDR_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ 720	/**<Variant identifier for LDR_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDR_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_INDEX_DATASZ_32b_READ 721	/**<Variant identifier for LDR_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDR_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_READ 722	/**<Variant identifier for LDR_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDR_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 723	/**<Variant identifier for LDR_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDR_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_MEMORY_SWORD_REGISTER_INDEX_DATASZ_32b_READ 724	/**<Variant identifier for LDR_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_MEMORY_SWORD_REGISTER_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDR_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ 725	/**<Variant identifier for LDR_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDR_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_POINTER_DATASZ_21b_READ 726	/**<Variant identifier for LDR_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_POINTER_DATASZ_21b_READ*/
+#define arm64_VARIANTID_LDR_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_INDEX_DATASZ_32b_READ 727	/**<Variant identifier for LDR_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_MEMORY_DWORD_REGISTER_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDR_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_READ 728	/**<Variant identifier for LDR_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDR_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 729	/**<Variant identifier for LDR_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDR_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_MEMORY_SWORD_REGISTER_INDEX_DATASZ_32b_READ 730	/**<Variant identifier for LDR_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_MEMORY_SWORD_REGISTER_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDR_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ 731	/**<Variant identifier for LDR_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDR_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_POINTER_DATASZ_21b_READ 732	/**<Variant identifier for LDR_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_POINTER_DATASZ_21b_READ*/
+#define arm64_VARIANTID_LDR_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_WRITE_OPRN_MEMORY_DWORD_REGISTER_INDEX_DATASZ_32b_READ 733	/**<Variant identifier for LDR_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_WRITE_OPRN_MEMORY_DWORD_REGISTER_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDR_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_READ 734	/**<Variant identifier for LDR_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDR_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ 735	/**<Variant identifier for LDR_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDR_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_WRITE_OPRN_MEMORY_SWORD_REGISTER_INDEX_DATASZ_32b_READ 736	/**<Variant identifier for LDR_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_WRITE_OPRN_MEMORY_SWORD_REGISTER_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDR_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ 737	/**<Variant identifier for LDR_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_WRITE_OPRN_MEMORY_UNSIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDTRB_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ 738	/**<Variant identifier for LDTRB_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDTRH_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ 739	/**<Variant identifier for LDTRH_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDTRSB_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ 740	/**<Variant identifier for LDTRSB_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDTRSB_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ 741	/**<Variant identifier for LDTRSB_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDTRSH_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ 742	/**<Variant identifier for LDTRSH_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDTRSH_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ 743	/**<Variant identifier for LDTRSH_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDTRSW_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ 744	/**<Variant identifier for LDTRSW_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDTR_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ 745	/**<Variant identifier for LDTR_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDTR_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ 746	/**<Variant identifier for LDTR_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDURB_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ 747	/**<Variant identifier for LDURB_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDURH_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ 748	/**<Variant identifier for LDURH_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDURSB_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ 749	/**<Variant identifier for LDURSB_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDURSB_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ 750	/**<Variant identifier for LDURSB_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDURSH_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ 751	/**<Variant identifier for LDURSH_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDURSH_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ 752	/**<Variant identifier for LDURSH_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDURSW_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ 753	/**<Variant identifier for LDURSW_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDUR_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ 754	/**<Variant identifier for LDUR_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDUR_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ 755	/**<Variant identifier for LDUR_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDUR_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_128b_DATASZ_128b_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ 756	/**<Variant identifier for LDUR_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_128b_DATASZ_128b_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDUR_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ 757	/**<Variant identifier for LDUR_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDUR_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ 758	/**<Variant identifier for LDUR_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDUR_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ 759	/**<Variant identifier for LDUR_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDUR_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ 760	/**<Variant identifier for LDUR_ARM64_FM_LOAD_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_WRITE_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDXP_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ 761	/**<Variant identifier for LDXP_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDXP_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ 762	/**<Variant identifier for LDXP_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDXRB_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ 763	/**<Variant identifier for LDXRB_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDXRH_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ 764	/**<Variant identifier for LDXRH_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDXR_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ 765	/**<Variant identifier for LDXR_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LDXR_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ 766	/**<Variant identifier for LDXR_ARM64_FM_LOAD_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_MEMORY_DATASZ_32b_READ*/
+#define arm64_VARIANTID_LSL_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ 767	/**<Variant identifier for LSL_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_LSL_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ 768	/**<Variant identifier for LSL_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_LSR_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ 769	/**<Variant identifier for LSR_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_LSR_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ 770	/**<Variant identifier for LSR_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_MADD_ARM64_FM_FMA_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ 771	/**<Variant identifier for MADD_ARM64_FM_FMA_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_MADD_ARM64_FM_FMA_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ 772	/**<Variant identifier for MADD_ARM64_FM_FMA_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_MLA_ARM64_FM_ADD_A_NA_S_SIMD_T_INT_T_INT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 773	/**<Variant identifier for MLA_ARM64_FM_ADD_A_NA_S_SIMD_T_INT_T_INT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_MLA_ARM64_FM_ADD_A_NA_S_SIMD_T_INT_T_INT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 774	/**<Variant identifier for MLA_ARM64_FM_ADD_A_NA_S_SIMD_T_INT_T_INT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_MLA_ARM64_FM_ADD_A_NA_S_SIMD_T_INT_T_INT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 775	/**<Variant identifier for MLA_ARM64_FM_ADD_A_NA_S_SIMD_T_INT_T_INT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_MLS_ARM64_FM_SUB_A_NA_S_SIMD_T_INT_T_INT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 776	/**<Variant identifier for MLS_ARM64_FM_SUB_A_NA_S_SIMD_T_INT_T_INT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_MLS_ARM64_FM_SUB_A_NA_S_SIMD_T_INT_T_INT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 777	/**<Variant identifier for MLS_ARM64_FM_SUB_A_NA_S_SIMD_T_INT_T_INT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_MLS_ARM64_FM_SUB_A_NA_S_SIMD_T_INT_T_INT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 778	/**<Variant identifier for MLS_ARM64_FM_SUB_A_NA_S_SIMD_T_INT_T_INT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_MOVI_ARM64_FM_MOV_A_NA_S_SCALAR_T_INT_T_INT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_IMMEDIATE_DATASZ_64b_READ 779	/**<Variant identifier for MOVI_ARM64_FM_MOV_A_NA_S_SCALAR_T_INT_T_INT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_IMMEDIATE_DATASZ_64b_READ*/
+#define arm64_VARIANTID_MOVI_ARM64_FM_MOV_A_NA_S_SIMD_T_INT_T_INT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_IMMEDIATE_DATASZ_8b_READ 780	/**<Variant identifier for MOVI_ARM64_FM_MOV_A_NA_S_SIMD_T_INT_T_INT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_IMMEDIATE_DATASZ_8b_READ*/
+#define arm64_VARIANTID_MOVI_ARM64_FM_MOV_A_NA_S_SIMD_T_INT_T_INT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_IMMEDIATE_DATASZ_8b_READ 781	/**<Variant identifier for MOVI_ARM64_FM_MOV_A_NA_S_SIMD_T_INT_T_INT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_IMMEDIATE_DATASZ_8b_READ*/
+#define arm64_VARIANTID_MOVI_ARM64_FM_MOV_A_NA_S_SIMD_T_INT_T_INT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_IMMEDIATE_DATASZ_64b_READ 782	/**<Variant identifier for MOVI_ARM64_FM_MOV_A_NA_S_SIMD_T_INT_T_INT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_IMMEDIATE_DATASZ_64b_READ*/
+#define arm64_VARIANTID_MOVI_ARM64_FM_MOV_A_NA_S_SIMD_T_INT_T_INT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_IMMEDIATE_DATASZ_8b_READ 783	/**<Variant identifier for MOVI_ARM64_FM_MOV_A_NA_S_SIMD_T_INT_T_INT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_IMMEDIATE_DATASZ_8b_READ*/
+#define arm64_VARIANTID_MOVK_ARM64_FM_MOV_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_IMMEDIATE_DATASZ_16b_READ 784	/**<Variant identifier for MOVK_ARM64_FM_MOV_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_IMMEDIATE_DATASZ_16b_READ*/
+#define arm64_VARIANTID_MOVK_ARM64_FM_MOV_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_IMMEDIATE_DATASZ_16b_READ 785	/**<Variant identifier for MOVK_ARM64_FM_MOV_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_IMMEDIATE_DATASZ_16b_READ*/
+#define arm64_VARIANTID_MOVN_ARM64_FM_MOV_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_IMMEDIATE_DATASZ_16b_READ 786	/**<Variant identifier for MOVN_ARM64_FM_MOV_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_IMMEDIATE_DATASZ_16b_READ*/
+#define arm64_VARIANTID_MOVN_ARM64_FM_MOV_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_IMMEDIATE_DATASZ_16b_READ 787	/**<Variant identifier for MOVN_ARM64_FM_MOV_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_IMMEDIATE_DATASZ_16b_READ*/
+#define arm64_VARIANTID_MOVZ_ARM64_FM_MOV_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_IMMEDIATE_DATASZ_16b_READ 788	/**<Variant identifier for MOVZ_ARM64_FM_MOV_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_IMMEDIATE_DATASZ_16b_READ*/
+#define arm64_VARIANTID_MOVZ_ARM64_FM_MOV_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_IMMEDIATE_DATASZ_16b_READ 789	/**<Variant identifier for MOVZ_ARM64_FM_MOV_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_IMMEDIATE_DATASZ_16b_READ*/
+#define arm64_VARIANTID_MOV_ARM64_FM_MOV_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 790	/**<Variant identifier for MOV_ARM64_FM_MOV_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_MOV_ARM64_FM_MOV_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 791	/**<Variant identifier for MOV_ARM64_FM_MOV_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_MOV_ARM64_FM_MOV_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 792	/**<Variant identifier for MOV_ARM64_FM_MOV_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_MOV_ARM64_FM_MOV_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_WRITE_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 793	/**<Variant identifier for MOV_ARM64_FM_MOV_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_WRITE_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_MOV_ARM64_FM_MOV_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 794	/**<Variant identifier for MOV_ARM64_FM_MOV_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_MOV_ARM64_FM_MOV_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 795	/**<Variant identifier for MOV_ARM64_FM_MOV_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_MOV_ARM64_FM_MOV_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 796	/**<Variant identifier for MOV_ARM64_FM_MOV_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_MOV_ARM64_FM_MOV_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_READ 797	/**<Variant identifier for MOV_ARM64_FM_MOV_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_MOV_ARM64_FM_MOV_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 798	/**<Variant identifier for MOV_ARM64_FM_MOV_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_MOV_ARM64_FM_MOV_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_READ 799	/**<Variant identifier for MOV_ARM64_FM_MOV_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_MOV_ARM64_FM_MOV_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_READ 800	/**<Variant identifier for MOV_ARM64_FM_MOV_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_MOV_ARM64_FM_MOV_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 801	/**<Variant identifier for MOV_ARM64_FM_MOV_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_MOV_ARM64_FM_MOV_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 802	/**<Variant identifier for MOV_ARM64_FM_MOV_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_MOV_ARM64_FM_MOV_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_READ 803	/**<Variant identifier for MOV_ARM64_FM_MOV_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_MRS_ARM64_FM_MOV_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_SYSTEM_DATASZ_DWORD_READ 804	/**<Variant identifier for MRS_ARM64_FM_MOV_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_SYSTEM_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_MSR_ARM64_FM_MOV_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SYSTEM_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ 805	/**<Variant identifier for MSR_ARM64_FM_MOV_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SYSTEM_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_MSR_ARM64_FM_MOV_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF_OPRN_REGISTER_SYSTEM_DATASZ_DWORD_WRITE_OPRN_IMMEDIATE_DATASZ_4b_READ 806	/**<Variant identifier for MSR_ARM64_FM_MOV_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF_OPRN_REGISTER_SYSTEM_DATASZ_DWORD_WRITE_OPRN_IMMEDIATE_DATASZ_4b_READ*/
+#define arm64_VARIANTID_MSUB_ARM64_FM_FMS_A_NA_S_SCALAR_T_INT_T_INT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ 807	/**<Variant identifier for MSUB_ARM64_FM_FMS_A_NA_S_SCALAR_T_INT_T_INT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_MSUB_ARM64_FM_FMS_A_NA_S_SCALAR_T_INT_T_INT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ 808	/**<Variant identifier for MSUB_ARM64_FM_FMS_A_NA_S_SCALAR_T_INT_T_INT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_MUL_ARM64_FM_MUL_A_NA_S_SIMD_T_INT_T_INT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 809	/**<Variant identifier for MUL_ARM64_FM_MUL_A_NA_S_SIMD_T_INT_T_INT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_MUL_ARM64_FM_MUL_A_NA_S_SIMD_T_INT_T_INT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 810	/**<Variant identifier for MUL_ARM64_FM_MUL_A_NA_S_SIMD_T_INT_T_INT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_MUL_ARM64_FM_MUL_A_NA_S_SIMD_T_INT_T_INT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 811	/**<Variant identifier for MUL_ARM64_FM_MUL_A_NA_S_SIMD_T_INT_T_INT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_MUL_ARM64_FM_MUL_A_NA_S_SIMD_T_INT_T_INT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 812	/**<Variant identifier for MUL_ARM64_FM_MUL_A_NA_S_SIMD_T_INT_T_INT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_MUL_ARM64_FM_MUL_A_NA_S_SIMD_T_INT_T_INT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 813	/**<Variant identifier for MUL_ARM64_FM_MUL_A_NA_S_SIMD_T_INT_T_INT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_MVNI_ARM64_FM_MOV_A_NA_S_SIMD_T_INT_T_INT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_IMMEDIATE_DATASZ_8b_READ 814	/**<Variant identifier for MVNI_ARM64_FM_MOV_A_NA_S_SIMD_T_INT_T_INT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_IMMEDIATE_DATASZ_8b_READ*/
+#define arm64_VARIANTID_MVNI_ARM64_FM_MOV_A_NA_S_SIMD_T_INT_T_INT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_IMMEDIATE_DATASZ_8b_READ 815	/**<Variant identifier for MVNI_ARM64_FM_MOV_A_NA_S_SIMD_T_INT_T_INT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_IMMEDIATE_DATASZ_8b_READ*/
+#define arm64_VARIANTID_MVNI_ARM64_FM_MOV_A_NA_S_SIMD_T_INT_T_INT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_IMMEDIATE_DATASZ_8b_READ 816	/**<Variant identifier for MVNI_ARM64_FM_MOV_A_NA_S_SIMD_T_INT_T_INT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_IMMEDIATE_DATASZ_8b_READ*/
+#define arm64_VARIANTID_MVN_ARM64_FM_NOT_A_NA_S_SIMD_T_BIT_T_BIT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 817	/**<Variant identifier for MVN_ARM64_FM_NOT_A_NA_S_SIMD_T_BIT_T_BIT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_NEG_ARM64_FM_NEG_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 818	/**<Variant identifier for NEG_ARM64_FM_NEG_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_NEG_ARM64_FM_NEG_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 819	/**<Variant identifier for NEG_ARM64_FM_NEG_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_NEG_ARM64_FM_NEG_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 820	/**<Variant identifier for NEG_ARM64_FM_NEG_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_ORN_ARM64_FM_OR_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ 821	/**<Variant identifier for ORN_ARM64_FM_OR_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_ORN_ARM64_FM_OR_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ 822	/**<Variant identifier for ORN_ARM64_FM_OR_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_ORN_ARM64_FM_OR_A_NA_S_SIMD_T_BIT_T_BIT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 823	/**<Variant identifier for ORN_ARM64_FM_OR_A_NA_S_SIMD_T_BIT_T_BIT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_ORR_ARM64_FM_OR_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_12b_READ 824	/**<Variant identifier for ORR_ARM64_FM_OR_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_12b_READ*/
+#define arm64_VARIANTID_ORR_ARM64_FM_OR_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ 825	/**<Variant identifier for ORR_ARM64_FM_OR_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_ORR_ARM64_FM_OR_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_13b_READ 826	/**<Variant identifier for ORR_ARM64_FM_OR_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_13b_READ*/
+#define arm64_VARIANTID_ORR_ARM64_FM_OR_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ 827	/**<Variant identifier for ORR_ARM64_FM_OR_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_ORR_ARM64_FM_OR_A_NA_S_SIMD_T_BIT_T_BIT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_IMMEDIATE_DATASZ_8b_READ 828	/**<Variant identifier for ORR_ARM64_FM_OR_A_NA_S_SIMD_T_BIT_T_BIT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_IMMEDIATE_DATASZ_8b_READ*/
+#define arm64_VARIANTID_ORR_ARM64_FM_OR_A_NA_S_SIMD_T_BIT_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_IMMEDIATE_DATASZ_8b_READ 829	/**<Variant identifier for ORR_ARM64_FM_OR_A_NA_S_SIMD_T_BIT_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_IMMEDIATE_DATASZ_8b_READ*/
+#define arm64_VARIANTID_ORR_ARM64_FM_OR_A_NA_S_SIMD_T_BIT_T_BIT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 830	/**<Variant identifier for ORR_ARM64_FM_OR_A_NA_S_SIMD_T_BIT_T_BIT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_PMULL2_ARM64_FM_MUL_A_NA_S_SIMD_T_INT_T_INT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 831	/**<Variant identifier for PMULL2_ARM64_FM_MUL_A_NA_S_SIMD_T_INT_T_INT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_PMULL2_ARM64_FM_MUL_A_NA_S_SIMD_T_INT_T_INT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 832	/**<Variant identifier for PMULL2_ARM64_FM_MUL_A_NA_S_SIMD_T_INT_T_INT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_PMULL_ARM64_FM_MUL_A_NA_S_SIMD_T_INT_T_INT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 833	/**<Variant identifier for PMULL_ARM64_FM_MUL_A_NA_S_SIMD_T_INT_T_INT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_PMULL_ARM64_FM_MUL_A_NA_S_SIMD_T_INT_T_INT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 834	/**<Variant identifier for PMULL_ARM64_FM_MUL_A_NA_S_SIMD_T_INT_T_INT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_PMUL_ARM64_FM_MUL_A_NA_S_SIMD_T_INT_T_INT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 835	/**<Variant identifier for PMUL_ARM64_FM_MUL_A_NA_S_SIMD_T_INT_T_INT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_PRFM_ARM64_FM_PREFETCH_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF_OPRN_IMMEDIATE_DATASZ_5b_READ_OPRN_MEMORY_DWORD_REGISTER_INDEX_DATASZ_32b_READ 836	/**<Variant identifier for PRFM_ARM64_FM_PREFETCH_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF_OPRN_IMMEDIATE_DATASZ_5b_READ_OPRN_MEMORY_DWORD_REGISTER_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_PRFM_ARM64_FM_PREFETCH_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF_OPRN_IMMEDIATE_DATASZ_5b_READ_OPRN_MEMORY_SWORD_REGISTER_INDEX_DATASZ_32b_READ 837	/**<Variant identifier for PRFM_ARM64_FM_PREFETCH_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF_OPRN_IMMEDIATE_DATASZ_5b_READ_OPRN_MEMORY_SWORD_REGISTER_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_PRFM_ARM64_FM_PREFETCH_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF_OPRN_IMMEDIATE_DATASZ_5b_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ 838	/**<Variant identifier for PRFM_ARM64_FM_PREFETCH_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF_OPRN_IMMEDIATE_DATASZ_5b_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_PRFM_ARM64_FM_PREFETCH_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF_OPRN_IMMEDIATE_DATASZ_5b_READ_OPRN_POINTER_DATASZ_21b_READ 839	/**<Variant identifier for PRFM_ARM64_FM_PREFETCH_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF_OPRN_IMMEDIATE_DATASZ_5b_READ_OPRN_POINTER_DATASZ_21b_READ*/
+#define arm64_VARIANTID_PRFUM_ARM64_FM_PREFETCH_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF_OPRN_IMMEDIATE_DATASZ_5b_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ 840	/**<Variant identifier for PRFUM_ARM64_FM_PREFETCH_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF_OPRN_IMMEDIATE_DATASZ_5b_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_READ*/
+#define arm64_VARIANTID_RADDHN2_ARM64_FM_RND_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 841	/**<Variant identifier for RADDHN2_ARM64_FM_RND_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_RADDHN2_ARM64_FM_RND_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 842	/**<Variant identifier for RADDHN2_ARM64_FM_RND_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_RADDHN2_ARM64_FM_RND_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 843	/**<Variant identifier for RADDHN2_ARM64_FM_RND_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_RADDHN_ARM64_FM_RND_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 844	/**<Variant identifier for RADDHN_ARM64_FM_RND_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_RADDHN_ARM64_FM_RND_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 845	/**<Variant identifier for RADDHN_ARM64_FM_RND_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_RADDHN_ARM64_FM_RND_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 846	/**<Variant identifier for RADDHN_ARM64_FM_RND_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_RBIT_ARM64_FM_UNDEF_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ 847	/**<Variant identifier for RBIT_ARM64_FM_UNDEF_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_RBIT_ARM64_FM_UNDEF_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ 848	/**<Variant identifier for RBIT_ARM64_FM_UNDEF_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_RBIT_ARM64_FM_UNDEF_A_NA_S_SIMD_T_BIT_T_BIT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 849	/**<Variant identifier for RBIT_ARM64_FM_UNDEF_A_NA_S_SIMD_T_BIT_T_BIT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_RET_ARM64_FM_RET_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_UNDEF_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ 850	/**<Variant identifier for RET_ARM64_FM_RET_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_UNDEF_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_RET_ARM64_FM_RET_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF 851	/**<Variant identifier for RET_ARM64_FM_RET_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF*/
+#define arm64_VARIANTID_REV16_ARM64_FM_BSWAP_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ 852	/**<Variant identifier for REV16_ARM64_FM_BSWAP_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_REV16_ARM64_FM_BSWAP_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ 853	/**<Variant identifier for REV16_ARM64_FM_BSWAP_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_REV16_ARM64_FM_BSWAP_A_NA_S_SIMD_T_BIT_T_BIT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 854	/**<Variant identifier for REV16_ARM64_FM_BSWAP_A_NA_S_SIMD_T_BIT_T_BIT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_REV32_ARM64_FM_BSWAP_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ 855	/**<Variant identifier for REV32_ARM64_FM_BSWAP_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_REV32_ARM64_FM_BSWAP_A_NA_S_SIMD_T_BIT_T_BIT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 856	/**<Variant identifier for REV32_ARM64_FM_BSWAP_A_NA_S_SIMD_T_BIT_T_BIT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_REV32_ARM64_FM_BSWAP_A_NA_S_SIMD_T_BIT_T_BIT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 857	/**<Variant identifier for REV32_ARM64_FM_BSWAP_A_NA_S_SIMD_T_BIT_T_BIT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_REV64_ARM64_FM_BSWAP_A_NA_S_SIMD_T_BIT_T_BIT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 858	/**<Variant identifier for REV64_ARM64_FM_BSWAP_A_NA_S_SIMD_T_BIT_T_BIT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_REV_ARM64_FM_BSWAP_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ 859	/**<Variant identifier for REV_ARM64_FM_BSWAP_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_REV_ARM64_FM_BSWAP_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ 860	/**<Variant identifier for REV_ARM64_FM_BSWAP_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_ROR_ARM64_FM_ROT_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ 861	/**<Variant identifier for ROR_ARM64_FM_ROT_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_ROR_ARM64_FM_ROT_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ 862	/**<Variant identifier for ROR_ARM64_FM_ROT_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_RSHRN2_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ 863	/**<Variant identifier for RSHRN2_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ*/
+#define arm64_VARIANTID_RSHRN2_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ 864	/**<Variant identifier for RSHRN2_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ*/
+#define arm64_VARIANTID_RSHRN2_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ 865	/**<Variant identifier for RSHRN2_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ*/
+#define arm64_VARIANTID_RSHRN_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ 866	/**<Variant identifier for RSHRN_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ*/
+#define arm64_VARIANTID_RSHRN_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ 867	/**<Variant identifier for RSHRN_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ*/
+#define arm64_VARIANTID_RSHRN_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ 868	/**<Variant identifier for RSHRN_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ*/
+#define arm64_VARIANTID_RUSBHN2_ARM64_FM_SUB_A_NA_S_SIMD_T_INT_T_INT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 869	/**<Variant identifier for RUSBHN2_ARM64_FM_SUB_A_NA_S_SIMD_T_INT_T_INT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_RUSBHN2_ARM64_FM_SUB_A_NA_S_SIMD_T_INT_T_INT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 870	/**<Variant identifier for RUSBHN2_ARM64_FM_SUB_A_NA_S_SIMD_T_INT_T_INT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_RUSBHN2_ARM64_FM_SUB_A_NA_S_SIMD_T_INT_T_INT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 871	/**<Variant identifier for RUSBHN2_ARM64_FM_SUB_A_NA_S_SIMD_T_INT_T_INT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_RUSBHN_ARM64_FM_SUB_A_NA_S_SIMD_T_INT_T_INT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 872	/**<Variant identifier for RUSBHN_ARM64_FM_SUB_A_NA_S_SIMD_T_INT_T_INT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_RUSBHN_ARM64_FM_SUB_A_NA_S_SIMD_T_INT_T_INT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 873	/**<Variant identifier for RUSBHN_ARM64_FM_SUB_A_NA_S_SIMD_T_INT_T_INT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_RUSBHN_ARM64_FM_SUB_A_NA_S_SIMD_T_INT_T_INT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 874	/**<Variant identifier for RUSBHN_ARM64_FM_SUB_A_NA_S_SIMD_T_INT_T_INT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SABAL2_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 875	/**<Variant identifier for SABAL2_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SABAL2_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 876	/**<Variant identifier for SABAL2_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SABAL2_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 877	/**<Variant identifier for SABAL2_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SABAL_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 878	/**<Variant identifier for SABAL_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SABAL_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 879	/**<Variant identifier for SABAL_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SABAL_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 880	/**<Variant identifier for SABAL_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SABA_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 881	/**<Variant identifier for SABA_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SABDL2_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 882	/**<Variant identifier for SABDL2_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SABDL2_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 883	/**<Variant identifier for SABDL2_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SABDL2_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 884	/**<Variant identifier for SABDL2_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SABDL_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 885	/**<Variant identifier for SABDL_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SABDL_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 886	/**<Variant identifier for SABDL_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SABDL_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 887	/**<Variant identifier for SABDL_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SABD_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 888	/**<Variant identifier for SABD_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SADALP_ARM64_FM_ADD_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 889	/**<Variant identifier for SADALP_ARM64_FM_ADD_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SADDL2_ARM64_FM_ADD_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 890	/**<Variant identifier for SADDL2_ARM64_FM_ADD_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SADDL2_ARM64_FM_ADD_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 891	/**<Variant identifier for SADDL2_ARM64_FM_ADD_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SADDL2_ARM64_FM_ADD_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 892	/**<Variant identifier for SADDL2_ARM64_FM_ADD_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SADDLP_ARM64_FM_ADD_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 893	/**<Variant identifier for SADDLP_ARM64_FM_ADD_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SADDLV_ARM64_FM_ADD_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 894	/**<Variant identifier for SADDLV_ARM64_FM_ADD_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SADDLV_ARM64_FM_ADD_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 895	/**<Variant identifier for SADDLV_ARM64_FM_ADD_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SADDLV_ARM64_FM_ADD_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 896	/**<Variant identifier for SADDLV_ARM64_FM_ADD_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SADDL_ARM64_FM_ADD_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 897	/**<Variant identifier for SADDL_ARM64_FM_ADD_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SADDL_ARM64_FM_ADD_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 898	/**<Variant identifier for SADDL_ARM64_FM_ADD_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SADDL_ARM64_FM_ADD_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 899	/**<Variant identifier for SADDL_ARM64_FM_ADD_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SADDW2_ARM64_FM_ADD_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 900	/**<Variant identifier for SADDW2_ARM64_FM_ADD_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SADDW2_ARM64_FM_ADD_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 901	/**<Variant identifier for SADDW2_ARM64_FM_ADD_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SADDW2_ARM64_FM_ADD_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 902	/**<Variant identifier for SADDW2_ARM64_FM_ADD_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SADDW_ARM64_FM_ADD_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 903	/**<Variant identifier for SADDW_ARM64_FM_ADD_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SADDW_ARM64_FM_ADD_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 904	/**<Variant identifier for SADDW_ARM64_FM_ADD_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SADDW_ARM64_FM_ADD_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 905	/**<Variant identifier for SADDW_ARM64_FM_ADD_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SBCS_ARM64_FM_SUB_A_SETFLAGS_S_SCALAR_T_INT_T_INT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ 906	/**<Variant identifier for SBCS_ARM64_FM_SUB_A_SETFLAGS_S_SCALAR_T_INT_T_INT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_SBCS_ARM64_FM_SUB_A_SETFLAGS_S_SCALAR_T_INT_T_INT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ 907	/**<Variant identifier for SBCS_ARM64_FM_SUB_A_SETFLAGS_S_SCALAR_T_INT_T_INT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_SBC_ARM64_FM_SUB_A_NA_S_SCALAR_T_INT_T_INT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ 908	/**<Variant identifier for SBC_ARM64_FM_SUB_A_NA_S_SCALAR_T_INT_T_INT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_SBC_ARM64_FM_SUB_A_NA_S_SCALAR_T_INT_T_INT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ 909	/**<Variant identifier for SBC_ARM64_FM_SUB_A_NA_S_SCALAR_T_INT_T_INT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_SBFM_ARM64_FM_MOV_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_UNDEF_DATASZ_UNDEF_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ_OPRN_IMMEDIATE_DATASZ_6b_READ 910	/**<Variant identifier for SBFM_ARM64_FM_MOV_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_UNDEF_DATASZ_UNDEF_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ_OPRN_IMMEDIATE_DATASZ_6b_READ*/
+#define arm64_VARIANTID_SBFM_ARM64_FM_MOV_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_UNDEF_DATASZ_UNDEF_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ_OPRN_IMMEDIATE_DATASZ_6b_READ 911	/**<Variant identifier for SBFM_ARM64_FM_MOV_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_UNDEF_DATASZ_UNDEF_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ_OPRN_IMMEDIATE_DATASZ_6b_READ*/
+#define arm64_VARIANTID_SCVTF_ARM64_FM_CVT_A_NA_S_SCALAR_T_SFXP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ 912	/**<Variant identifier for SCVTF_ARM64_FM_CVT_A_NA_S_SCALAR_T_SFXP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ*/
+#define arm64_VARIANTID_SCVTF_ARM64_FM_CVT_A_NA_S_SCALAR_T_SFXP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ 913	/**<Variant identifier for SCVTF_ARM64_FM_CVT_A_NA_S_SCALAR_T_SFXP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ*/
+#define arm64_VARIANTID_SCVTF_ARM64_FM_CVT_A_NA_S_SCALAR_T_SFXP_T_FP_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ 914	/**<Variant identifier for SCVTF_ARM64_FM_CVT_A_NA_S_SCALAR_T_SFXP_T_FP_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ*/
+#define arm64_VARIANTID_SCVTF_ARM64_FM_CVT_A_NA_S_SCALAR_T_SFXP_T_FP_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ 915	/**<Variant identifier for SCVTF_ARM64_FM_CVT_A_NA_S_SCALAR_T_SFXP_T_FP_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ*/
+#define arm64_VARIANTID_SCVTF_ARM64_FM_CVT_A_NA_S_SCALAR_T_SFXP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ 916	/**<Variant identifier for SCVTF_ARM64_FM_CVT_A_NA_S_SCALAR_T_SFXP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ*/
+#define arm64_VARIANTID_SCVTF_ARM64_FM_CVT_A_NA_S_SCALAR_T_SFXP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ 917	/**<Variant identifier for SCVTF_ARM64_FM_CVT_A_NA_S_SCALAR_T_SFXP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ*/
+#define arm64_VARIANTID_SCVTF_ARM64_FM_CVT_A_NA_S_SCALAR_T_SINT_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 918	/**<Variant identifier for SCVTF_ARM64_FM_CVT_A_NA_S_SCALAR_T_SINT_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_SCVTF_ARM64_FM_CVT_A_NA_S_SCALAR_T_SINT_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_READ 919	/**<Variant identifier for SCVTF_ARM64_FM_CVT_A_NA_S_SCALAR_T_SINT_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_SCVTF_ARM64_FM_CVT_A_NA_S_SCALAR_T_SINT_T_FP_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_READ 920	/**<Variant identifier for SCVTF_ARM64_FM_CVT_A_NA_S_SCALAR_T_SINT_T_FP_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_SCVTF_ARM64_FM_CVT_A_NA_S_SCALAR_T_SINT_T_FP_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_READ 921	/**<Variant identifier for SCVTF_ARM64_FM_CVT_A_NA_S_SCALAR_T_SINT_T_FP_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_SCVTF_ARM64_FM_CVT_A_NA_S_SCALAR_T_SINT_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_READ 922	/**<Variant identifier for SCVTF_ARM64_FM_CVT_A_NA_S_SCALAR_T_SINT_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_SCVTF_ARM64_FM_CVT_A_NA_S_SCALAR_T_SINT_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 923	/**<Variant identifier for SCVTF_ARM64_FM_CVT_A_NA_S_SCALAR_T_SINT_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_SCVTF_ARM64_FM_CVT_A_NA_S_SIMD_T_SFXP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ 924	/**<Variant identifier for SCVTF_ARM64_FM_CVT_A_NA_S_SIMD_T_SFXP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ*/
+#define arm64_VARIANTID_SCVTF_ARM64_FM_CVT_A_NA_S_SIMD_T_SFXP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ 925	/**<Variant identifier for SCVTF_ARM64_FM_CVT_A_NA_S_SIMD_T_SFXP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ*/
+#define arm64_VARIANTID_SCVTF_ARM64_FM_CVT_A_NA_S_SIMD_T_SINT_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 926	/**<Variant identifier for SCVTF_ARM64_FM_CVT_A_NA_S_SIMD_T_SINT_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SCVTF_ARM64_FM_CVT_A_NA_S_SIMD_T_SINT_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 927	/**<Variant identifier for SCVTF_ARM64_FM_CVT_A_NA_S_SIMD_T_SINT_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SDIV_ARM64_FM_DIV_A_NA_S_SCALAR_T_INT_T_INT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ 928	/**<Variant identifier for SDIV_ARM64_FM_DIV_A_NA_S_SCALAR_T_INT_T_INT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_SDIV_ARM64_FM_DIV_A_NA_S_SCALAR_T_INT_T_INT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ 929	/**<Variant identifier for SDIV_ARM64_FM_DIV_A_NA_S_SCALAR_T_INT_T_INT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_SHA1C_ARM64_FM_CRYPTO_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 930	/**<Variant identifier for SHA1C_ARM64_FM_CRYPTO_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SHA1H_ARM64_FM_CRYPTO_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 931	/**<Variant identifier for SHA1H_ARM64_FM_CRYPTO_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_SHA1M_ARM64_FM_CRYPTO_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 932	/**<Variant identifier for SHA1M_ARM64_FM_CRYPTO_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SHA1P_ARM64_FM_CRYPTO_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 933	/**<Variant identifier for SHA1P_ARM64_FM_CRYPTO_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SHA1SU0_ARM64_FM_CRYPTO_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 934	/**<Variant identifier for SHA1SU0_ARM64_FM_CRYPTO_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SHA1SU1_ARM64_FM_CRYPTO_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 935	/**<Variant identifier for SHA1SU1_ARM64_FM_CRYPTO_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SHA256H2_ARM64_FM_CRYPTO_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 936	/**<Variant identifier for SHA256H2_ARM64_FM_CRYPTO_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SHA256H_ARM64_FM_CRYPTO_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 937	/**<Variant identifier for SHA256H_ARM64_FM_CRYPTO_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SHA256SU0_ARM64_FM_CRYPTO_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 938	/**<Variant identifier for SHA256SU0_ARM64_FM_CRYPTO_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SHA256SU1_ARM64_FM_CRYPTO_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 939	/**<Variant identifier for SHA256SU1_ARM64_FM_CRYPTO_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SHADD_ARM64_FM_ADD_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 940	/**<Variant identifier for SHADD_ARM64_FM_ADD_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SHLL2_ARM64_FM_SHIFT_A_NA_S_SIMD_T_INT_T_INT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ 941	/**<Variant identifier for SHLL2_ARM64_FM_SHIFT_A_NA_S_SIMD_T_INT_T_INT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ*/
+#define arm64_VARIANTID_SHLL2_ARM64_FM_SHIFT_A_NA_S_SIMD_T_INT_T_INT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ 942	/**<Variant identifier for SHLL2_ARM64_FM_SHIFT_A_NA_S_SIMD_T_INT_T_INT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ*/
+#define arm64_VARIANTID_SHLL2_ARM64_FM_SHIFT_A_NA_S_SIMD_T_INT_T_INT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ 943	/**<Variant identifier for SHLL2_ARM64_FM_SHIFT_A_NA_S_SIMD_T_INT_T_INT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ*/
+#define arm64_VARIANTID_SHLL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_INT_T_INT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ 944	/**<Variant identifier for SHLL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_INT_T_INT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ*/
+#define arm64_VARIANTID_SHLL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_INT_T_INT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ 945	/**<Variant identifier for SHLL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_INT_T_INT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ*/
+#define arm64_VARIANTID_SHLL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_INT_T_INT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ 946	/**<Variant identifier for SHLL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_INT_T_INT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_UNDEF_READ*/
+#define arm64_VARIANTID_SHL_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_INT_T_INT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ 947	/**<Variant identifier for SHL_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_INT_T_INT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ*/
+#define arm64_VARIANTID_SHL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_INT_T_INT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ 948	/**<Variant identifier for SHL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_INT_T_INT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ*/
+#define arm64_VARIANTID_SHL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_INT_T_INT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ 949	/**<Variant identifier for SHL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_INT_T_INT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ*/
+#define arm64_VARIANTID_SHL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_INT_T_INT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ 950	/**<Variant identifier for SHL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_INT_T_INT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ*/
+#define arm64_VARIANTID_SHL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_INT_T_INT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ 951	/**<Variant identifier for SHL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_INT_T_INT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ*/
+#define arm64_VARIANTID_SHRN2_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ 952	/**<Variant identifier for SHRN2_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ*/
+#define arm64_VARIANTID_SHRN2_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ 953	/**<Variant identifier for SHRN2_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ*/
+#define arm64_VARIANTID_SHRN2_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ 954	/**<Variant identifier for SHRN2_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ*/
+#define arm64_VARIANTID_SHRN_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ 955	/**<Variant identifier for SHRN_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ*/
+#define arm64_VARIANTID_SHRN_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ 956	/**<Variant identifier for SHRN_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ*/
+#define arm64_VARIANTID_SHRN_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ 957	/**<Variant identifier for SHRN_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ*/
+#define arm64_VARIANTID_SHSUB_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 958	/**<Variant identifier for SHSUB_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SLI_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_INT_T_INT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ 959	/**<Variant identifier for SLI_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_INT_T_INT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ*/
+#define arm64_VARIANTID_SLI_ARM64_FM_SHIFT_A_NA_S_SIMD_T_INT_T_INT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ 960	/**<Variant identifier for SLI_ARM64_FM_SHIFT_A_NA_S_SIMD_T_INT_T_INT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ*/
+#define arm64_VARIANTID_SLI_ARM64_FM_SHIFT_A_NA_S_SIMD_T_INT_T_INT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ 961	/**<Variant identifier for SLI_ARM64_FM_SHIFT_A_NA_S_SIMD_T_INT_T_INT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ*/
+#define arm64_VARIANTID_SLI_ARM64_FM_SHIFT_A_NA_S_SIMD_T_INT_T_INT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ 962	/**<Variant identifier for SLI_ARM64_FM_SHIFT_A_NA_S_SIMD_T_INT_T_INT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ*/
+#define arm64_VARIANTID_SLI_ARM64_FM_SHIFT_A_NA_S_SIMD_T_INT_T_INT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ 963	/**<Variant identifier for SLI_ARM64_FM_SHIFT_A_NA_S_SIMD_T_INT_T_INT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ*/
+#define arm64_VARIANTID_SMADDL_ARM64_FM_FMA_A_NA_S_SCALAR_T_INT_T_INT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ 964	/**<Variant identifier for SMADDL_ARM64_FM_FMA_A_NA_S_SCALAR_T_INT_T_INT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_SMAXP_ARM64_FM_MAX_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 965	/**<Variant identifier for SMAXP_ARM64_FM_MAX_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SMAXV_ARM64_FM_MAX_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 966	/**<Variant identifier for SMAXV_ARM64_FM_MAX_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SMAXV_ARM64_FM_MAX_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 967	/**<Variant identifier for SMAXV_ARM64_FM_MAX_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SMAXV_ARM64_FM_MAX_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 968	/**<Variant identifier for SMAXV_ARM64_FM_MAX_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SMAX_ARM64_FM_MAX_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 969	/**<Variant identifier for SMAX_ARM64_FM_MAX_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SMC_ARM64_FM_OS_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF_OPRN_IMMEDIATE_DATASZ_16b_READ 970	/**<Variant identifier for SMC_ARM64_FM_OS_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF_OPRN_IMMEDIATE_DATASZ_16b_READ*/
+#define arm64_VARIANTID_SMINP_ARM64_FM_MIN_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 971	/**<Variant identifier for SMINP_ARM64_FM_MIN_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SMINV_ARM64_FM_MIN_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 972	/**<Variant identifier for SMINV_ARM64_FM_MIN_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SMINV_ARM64_FM_MIN_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 973	/**<Variant identifier for SMINV_ARM64_FM_MIN_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SMINV_ARM64_FM_MIN_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 974	/**<Variant identifier for SMINV_ARM64_FM_MIN_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SMIN_ARM64_FM_MIN_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 975	/**<Variant identifier for SMIN_ARM64_FM_MIN_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SMLAL2_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 976	/**<Variant identifier for SMLAL2_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SMLAL2_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 977	/**<Variant identifier for SMLAL2_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SMLAL2_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 978	/**<Variant identifier for SMLAL2_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SMLAL2_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 979	/**<Variant identifier for SMLAL2_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SMLAL2_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 980	/**<Variant identifier for SMLAL2_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SMLAL_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 981	/**<Variant identifier for SMLAL_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SMLAL_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 982	/**<Variant identifier for SMLAL_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SMLAL_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 983	/**<Variant identifier for SMLAL_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SMLAL_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 984	/**<Variant identifier for SMLAL_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SMLAL_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 985	/**<Variant identifier for SMLAL_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SMLSL2_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 986	/**<Variant identifier for SMLSL2_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SMLSL2_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 987	/**<Variant identifier for SMLSL2_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SMLSL2_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 988	/**<Variant identifier for SMLSL2_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SMLSL2_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 989	/**<Variant identifier for SMLSL2_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SMLSL2_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 990	/**<Variant identifier for SMLSL2_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SMLSL_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 991	/**<Variant identifier for SMLSL_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SMLSL_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 992	/**<Variant identifier for SMLSL_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SMLSL_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 993	/**<Variant identifier for SMLSL_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SMLSL_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 994	/**<Variant identifier for SMLSL_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SMLSL_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 995	/**<Variant identifier for SMLSL_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SMOV_ARM64_FM_MOV_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 996	/**<Variant identifier for SMOV_ARM64_FM_MOV_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SMOV_ARM64_FM_MOV_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_16b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 997	/**<Variant identifier for SMOV_ARM64_FM_MOV_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_16b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SMOV_ARM64_FM_MOV_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 998	/**<Variant identifier for SMOV_ARM64_FM_MOV_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SMOV_ARM64_FM_MOV_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_8b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 999	/**<Variant identifier for SMOV_ARM64_FM_MOV_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_8b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SMOV_ARM64_FM_MOV_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_8b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 1000	/**<Variant identifier for SMOV_ARM64_FM_MOV_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_8b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SMSUBL_ARM64_FM_FMS_A_NA_S_SCALAR_T_INT_T_INT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ 1001	/**<Variant identifier for SMSUBL_ARM64_FM_FMS_A_NA_S_SCALAR_T_INT_T_INT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_SMULH_ARM64_FM_MUL_A_NA_S_SCALAR_T_INT_T_INT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ 1002	/**<Variant identifier for SMULH_ARM64_FM_MUL_A_NA_S_SCALAR_T_INT_T_INT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_SMULL2_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 1003	/**<Variant identifier for SMULL2_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SMULL2_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1004	/**<Variant identifier for SMULL2_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SMULL2_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 1005	/**<Variant identifier for SMULL2_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SMULL2_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1006	/**<Variant identifier for SMULL2_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SMULL2_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1007	/**<Variant identifier for SMULL2_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SMULL_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 1008	/**<Variant identifier for SMULL_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SMULL_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1009	/**<Variant identifier for SMULL_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SMULL_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 1010	/**<Variant identifier for SMULL_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SMULL_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1011	/**<Variant identifier for SMULL_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SMULL_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1012	/**<Variant identifier for SMULL_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SQABS_ARM64_FM_ABS_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ 1013	/**<Variant identifier for SQABS_ARM64_FM_ABS_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ*/
+#define arm64_VARIANTID_SQABS_ARM64_FM_ABS_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 1014	/**<Variant identifier for SQABS_ARM64_FM_ABS_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_SQABS_ARM64_FM_ABS_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 1015	/**<Variant identifier for SQABS_ARM64_FM_ABS_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_SQABS_ARM64_FM_ABS_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_WRITE_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_READ 1016	/**<Variant identifier for SQABS_ARM64_FM_ABS_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_WRITE_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_READ*/
+#define arm64_VARIANTID_SQABS_ARM64_FM_ABS_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1017	/**<Variant identifier for SQABS_ARM64_FM_ABS_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SQABS_ARM64_FM_ABS_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1018	/**<Variant identifier for SQABS_ARM64_FM_ABS_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SQADD_ARM64_FM_ADD_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ 1019	/**<Variant identifier for SQADD_ARM64_FM_ADD_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ*/
+#define arm64_VARIANTID_SQADD_ARM64_FM_ADD_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 1020	/**<Variant identifier for SQADD_ARM64_FM_ADD_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_SQADD_ARM64_FM_ADD_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 1021	/**<Variant identifier for SQADD_ARM64_FM_ADD_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_SQADD_ARM64_FM_ADD_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_WRITE_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_READ_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_READ 1022	/**<Variant identifier for SQADD_ARM64_FM_ADD_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_WRITE_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_READ_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_READ*/
+#define arm64_VARIANTID_SQADD_ARM64_FM_ADD_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1023	/**<Variant identifier for SQADD_ARM64_FM_ADD_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SQADD_ARM64_FM_ADD_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1024	/**<Variant identifier for SQADD_ARM64_FM_ADD_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SQDMLAL2_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 1025	/**<Variant identifier for SQDMLAL2_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SQDMLAL2_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1026	/**<Variant identifier for SQDMLAL2_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SQDMLAL2_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 1027	/**<Variant identifier for SQDMLAL2_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SQDMLAL2_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1028	/**<Variant identifier for SQDMLAL2_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SQDMLAL_ARM64_FM_MUL_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 1029	/**<Variant identifier for SQDMLAL_ARM64_FM_MUL_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SQDMLAL_ARM64_FM_MUL_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ 1030	/**<Variant identifier for SQDMLAL_ARM64_FM_MUL_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ*/
+#define arm64_VARIANTID_SQDMLAL_ARM64_FM_MUL_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 1031	/**<Variant identifier for SQDMLAL_ARM64_FM_MUL_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SQDMLAL_ARM64_FM_MUL_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 1032	/**<Variant identifier for SQDMLAL_ARM64_FM_MUL_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_SQDMLAL_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 1033	/**<Variant identifier for SQDMLAL_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SQDMLAL_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1034	/**<Variant identifier for SQDMLAL_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SQDMLAL_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 1035	/**<Variant identifier for SQDMLAL_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SQDMLAL_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1036	/**<Variant identifier for SQDMLAL_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SQDMLSL2_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 1037	/**<Variant identifier for SQDMLSL2_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SQDMLSL2_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1038	/**<Variant identifier for SQDMLSL2_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SQDMLSL2_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 1039	/**<Variant identifier for SQDMLSL2_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SQDMLSL2_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1040	/**<Variant identifier for SQDMLSL2_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SQDMLSL_ARM64_FM_MUL_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 1041	/**<Variant identifier for SQDMLSL_ARM64_FM_MUL_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SQDMLSL_ARM64_FM_MUL_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ 1042	/**<Variant identifier for SQDMLSL_ARM64_FM_MUL_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ*/
+#define arm64_VARIANTID_SQDMLSL_ARM64_FM_MUL_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 1043	/**<Variant identifier for SQDMLSL_ARM64_FM_MUL_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SQDMLSL_ARM64_FM_MUL_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 1044	/**<Variant identifier for SQDMLSL_ARM64_FM_MUL_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_SQDMLSL_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 1045	/**<Variant identifier for SQDMLSL_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SQDMLSL_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1046	/**<Variant identifier for SQDMLSL_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SQDMLSL_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 1047	/**<Variant identifier for SQDMLSL_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SQDMLSL_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1048	/**<Variant identifier for SQDMLSL_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SQDMULH_ARM64_FM_MUL_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 1049	/**<Variant identifier for SQDMULH_ARM64_FM_MUL_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SQDMULH_ARM64_FM_MUL_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ 1050	/**<Variant identifier for SQDMULH_ARM64_FM_MUL_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ*/
+#define arm64_VARIANTID_SQDMULH_ARM64_FM_MUL_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 1051	/**<Variant identifier for SQDMULH_ARM64_FM_MUL_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SQDMULH_ARM64_FM_MUL_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 1052	/**<Variant identifier for SQDMULH_ARM64_FM_MUL_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_SQDMULH_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 1053	/**<Variant identifier for SQDMULH_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SQDMULH_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1054	/**<Variant identifier for SQDMULH_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SQDMULH_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 1055	/**<Variant identifier for SQDMULH_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SQDMULH_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1056	/**<Variant identifier for SQDMULH_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SQDMULL2_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1057	/**<Variant identifier for SQDMULL2_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SQDMULL2_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 1058	/**<Variant identifier for SQDMULL2_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SQDMULL2_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1059	/**<Variant identifier for SQDMULL2_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SQDMULL2_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 1060	/**<Variant identifier for SQDMULL2_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SQDMULL_ARM64_FM_MUL_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ 1061	/**<Variant identifier for SQDMULL_ARM64_FM_MUL_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ*/
+#define arm64_VARIANTID_SQDMULL_ARM64_FM_MUL_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 1062	/**<Variant identifier for SQDMULL_ARM64_FM_MUL_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SQDMULL_ARM64_FM_MUL_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 1063	/**<Variant identifier for SQDMULL_ARM64_FM_MUL_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_SQDMULL_ARM64_FM_MUL_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 1064	/**<Variant identifier for SQDMULL_ARM64_FM_MUL_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SQDMULL_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1065	/**<Variant identifier for SQDMULL_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SQDMULL_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 1066	/**<Variant identifier for SQDMULL_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SQDMULL_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1067	/**<Variant identifier for SQDMULL_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SQDMULL_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 1068	/**<Variant identifier for SQDMULL_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SQNEG_ARM64_FM_NEG_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ 1069	/**<Variant identifier for SQNEG_ARM64_FM_NEG_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ*/
+#define arm64_VARIANTID_SQNEG_ARM64_FM_NEG_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 1070	/**<Variant identifier for SQNEG_ARM64_FM_NEG_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_SQNEG_ARM64_FM_NEG_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 1071	/**<Variant identifier for SQNEG_ARM64_FM_NEG_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_SQNEG_ARM64_FM_NEG_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_WRITE_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_READ 1072	/**<Variant identifier for SQNEG_ARM64_FM_NEG_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_WRITE_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_READ*/
+#define arm64_VARIANTID_SQNEG_ARM64_FM_NEG_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1073	/**<Variant identifier for SQNEG_ARM64_FM_NEG_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SQNEG_ARM64_FM_NEG_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1074	/**<Variant identifier for SQNEG_ARM64_FM_NEG_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SQRDMULH_ARM64_FM_MUL_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 1075	/**<Variant identifier for SQRDMULH_ARM64_FM_MUL_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SQRDMULH_ARM64_FM_MUL_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ 1076	/**<Variant identifier for SQRDMULH_ARM64_FM_MUL_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ*/
+#define arm64_VARIANTID_SQRDMULH_ARM64_FM_MUL_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 1077	/**<Variant identifier for SQRDMULH_ARM64_FM_MUL_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SQRDMULH_ARM64_FM_MUL_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 1078	/**<Variant identifier for SQRDMULH_ARM64_FM_MUL_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_SQRDMULH_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 1079	/**<Variant identifier for SQRDMULH_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SQRDMULH_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1080	/**<Variant identifier for SQRDMULH_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SQRDMULH_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 1081	/**<Variant identifier for SQRDMULH_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SQRDMULH_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1082	/**<Variant identifier for SQRDMULH_ARM64_FM_MUL_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SQRSHL_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ 1083	/**<Variant identifier for SQRSHL_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ*/
+#define arm64_VARIANTID_SQRSHL_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 1084	/**<Variant identifier for SQRSHL_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_SQRSHL_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 1085	/**<Variant identifier for SQRSHL_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_SQRSHL_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_WRITE_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_READ_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_READ 1086	/**<Variant identifier for SQRSHL_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_WRITE_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_READ_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_READ*/
+#define arm64_VARIANTID_SQRSHL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1087	/**<Variant identifier for SQRSHL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SQRSHL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1088	/**<Variant identifier for SQRSHL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SQRSHRN2_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ 1089	/**<Variant identifier for SQRSHRN2_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ*/
+#define arm64_VARIANTID_SQRSHRN2_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ 1090	/**<Variant identifier for SQRSHRN2_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ*/
+#define arm64_VARIANTID_SQRSHRN2_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ 1091	/**<Variant identifier for SQRSHRN2_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ*/
+#define arm64_VARIANTID_SQRSHRN_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ 1092	/**<Variant identifier for SQRSHRN_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ*/
+#define arm64_VARIANTID_SQRSHRN_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ 1093	/**<Variant identifier for SQRSHRN_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ*/
+#define arm64_VARIANTID_SQRSHRN_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ 1094	/**<Variant identifier for SQRSHRN_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ*/
+#define arm64_VARIANTID_SQRSHRN_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ 1095	/**<Variant identifier for SQRSHRN_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ*/
+#define arm64_VARIANTID_SQRSHRN_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ 1096	/**<Variant identifier for SQRSHRN_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ*/
+#define arm64_VARIANTID_SQRSHRN_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ 1097	/**<Variant identifier for SQRSHRN_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ*/
+#define arm64_VARIANTID_SQRSHRUN2_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_UINT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ 1098	/**<Variant identifier for SQRSHRUN2_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_UINT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ*/
+#define arm64_VARIANTID_SQRSHRUN2_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_UINT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ 1099	/**<Variant identifier for SQRSHRUN2_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_UINT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ*/
+#define arm64_VARIANTID_SQRSHRUN2_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_UINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ 1100	/**<Variant identifier for SQRSHRUN2_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_UINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ*/
+#define arm64_VARIANTID_SQRSHRUN_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_UINT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ 1101	/**<Variant identifier for SQRSHRUN_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_UINT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ*/
+#define arm64_VARIANTID_SQRSHRUN_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_UINT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ 1102	/**<Variant identifier for SQRSHRUN_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_UINT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ*/
+#define arm64_VARIANTID_SQRSHRUN_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_UINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ 1103	/**<Variant identifier for SQRSHRUN_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_UINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ*/
+#define arm64_VARIANTID_SQRSHRUN_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_UINT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ 1104	/**<Variant identifier for SQRSHRUN_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_UINT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ*/
+#define arm64_VARIANTID_SQRSHRUN_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_UINT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ 1105	/**<Variant identifier for SQRSHRUN_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_UINT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ*/
+#define arm64_VARIANTID_SQRSHRUN_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_UINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ 1106	/**<Variant identifier for SQRSHRUN_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_UINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ*/
+#define arm64_VARIANTID_SQSHLU_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_UINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ 1107	/**<Variant identifier for SQSHLU_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_UINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ*/
+#define arm64_VARIANTID_SQSHLU_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ 1108	/**<Variant identifier for SQSHLU_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ*/
+#define arm64_VARIANTID_SQSHLU_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ 1109	/**<Variant identifier for SQSHLU_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ*/
+#define arm64_VARIANTID_SQSHLU_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_UINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_WRITE_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_READ_OPRN_IMMEDIATE_DATASZ_3b_READ 1110	/**<Variant identifier for SQSHLU_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_UINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_WRITE_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_READ_OPRN_IMMEDIATE_DATASZ_3b_READ*/
+#define arm64_VARIANTID_SQSHLU_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_UINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ 1111	/**<Variant identifier for SQSHLU_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_UINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ*/
+#define arm64_VARIANTID_SQSHLU_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ 1112	/**<Variant identifier for SQSHLU_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ*/
+#define arm64_VARIANTID_SQSHLU_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ 1113	/**<Variant identifier for SQSHLU_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ*/
+#define arm64_VARIANTID_SQSHLU_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_UINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ 1114	/**<Variant identifier for SQSHLU_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_UINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ*/
+#define arm64_VARIANTID_SQSHL_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ 1115	/**<Variant identifier for SQSHL_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ*/
+#define arm64_VARIANTID_SQSHL_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ 1116	/**<Variant identifier for SQSHL_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ*/
+#define arm64_VARIANTID_SQSHL_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ 1117	/**<Variant identifier for SQSHL_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ*/
+#define arm64_VARIANTID_SQSHL_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 1118	/**<Variant identifier for SQSHL_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_SQSHL_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ 1119	/**<Variant identifier for SQSHL_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ*/
+#define arm64_VARIANTID_SQSHL_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 1120	/**<Variant identifier for SQSHL_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_SQSHL_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_WRITE_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_READ_OPRN_IMMEDIATE_DATASZ_3b_READ 1121	/**<Variant identifier for SQSHL_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_WRITE_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_READ_OPRN_IMMEDIATE_DATASZ_3b_READ*/
+#define arm64_VARIANTID_SQSHL_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_WRITE_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_READ_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_READ 1122	/**<Variant identifier for SQSHL_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_WRITE_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_READ_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_READ*/
+#define arm64_VARIANTID_SQSHL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ 1123	/**<Variant identifier for SQSHL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ*/
+#define arm64_VARIANTID_SQSHL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ 1124	/**<Variant identifier for SQSHL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ*/
+#define arm64_VARIANTID_SQSHL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ 1125	/**<Variant identifier for SQSHL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ*/
+#define arm64_VARIANTID_SQSHL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1126	/**<Variant identifier for SQSHL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SQSHL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ 1127	/**<Variant identifier for SQSHL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ*/
+#define arm64_VARIANTID_SQSHL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1128	/**<Variant identifier for SQSHL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SQSHRN2_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ 1129	/**<Variant identifier for SQSHRN2_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ*/
+#define arm64_VARIANTID_SQSHRN2_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ 1130	/**<Variant identifier for SQSHRN2_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ*/
+#define arm64_VARIANTID_SQSHRN2_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ 1131	/**<Variant identifier for SQSHRN2_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ*/
+#define arm64_VARIANTID_SQSHRN_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ 1132	/**<Variant identifier for SQSHRN_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ*/
+#define arm64_VARIANTID_SQSHRN_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ 1133	/**<Variant identifier for SQSHRN_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ*/
+#define arm64_VARIANTID_SQSHRN_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ 1134	/**<Variant identifier for SQSHRN_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ*/
+#define arm64_VARIANTID_SQSHRN_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ 1135	/**<Variant identifier for SQSHRN_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ*/
+#define arm64_VARIANTID_SQSHRN_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ 1136	/**<Variant identifier for SQSHRN_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ*/
+#define arm64_VARIANTID_SQSHRN_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ 1137	/**<Variant identifier for SQSHRN_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ*/
+#define arm64_VARIANTID_SQSHRUN2_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_UINT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ 1138	/**<Variant identifier for SQSHRUN2_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_UINT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ*/
+#define arm64_VARIANTID_SQSHRUN2_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_UINT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ 1139	/**<Variant identifier for SQSHRUN2_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_UINT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ*/
+#define arm64_VARIANTID_SQSHRUN2_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_UINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ 1140	/**<Variant identifier for SQSHRUN2_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_UINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ*/
+#define arm64_VARIANTID_SQSHRUN_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_UINT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ 1141	/**<Variant identifier for SQSHRUN_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_UINT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ*/
+#define arm64_VARIANTID_SQSHRUN_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_UINT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ 1142	/**<Variant identifier for SQSHRUN_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_UINT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ*/
+#define arm64_VARIANTID_SQSHRUN_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_UINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ 1143	/**<Variant identifier for SQSHRUN_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_UINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ*/
+#define arm64_VARIANTID_SQSHRUN_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_UINT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ 1144	/**<Variant identifier for SQSHRUN_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_UINT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ*/
+#define arm64_VARIANTID_SQSHRUN_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_UINT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ 1145	/**<Variant identifier for SQSHRUN_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_UINT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ*/
+#define arm64_VARIANTID_SQSHRUN_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_UINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ 1146	/**<Variant identifier for SQSHRUN_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_UINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ*/
+#define arm64_VARIANTID_SQSUB_ARM64_FM_SUB_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ 1147	/**<Variant identifier for SQSUB_ARM64_FM_SUB_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ*/
+#define arm64_VARIANTID_SQSUB_ARM64_FM_SUB_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 1148	/**<Variant identifier for SQSUB_ARM64_FM_SUB_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_SQSUB_ARM64_FM_SUB_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 1149	/**<Variant identifier for SQSUB_ARM64_FM_SUB_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_SQSUB_ARM64_FM_SUB_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_WRITE_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_READ_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_READ 1150	/**<Variant identifier for SQSUB_ARM64_FM_SUB_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_WRITE_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_READ_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_READ*/
+#define arm64_VARIANTID_SQSUB_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1151	/**<Variant identifier for SQSUB_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SQSUB_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1152	/**<Variant identifier for SQSUB_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SQXTN2_ARM64_FM_MOV_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1153	/**<Variant identifier for SQXTN2_ARM64_FM_MOV_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SQXTN2_ARM64_FM_MOV_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1154	/**<Variant identifier for SQXTN2_ARM64_FM_MOV_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SQXTN2_ARM64_FM_MOV_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1155	/**<Variant identifier for SQXTN2_ARM64_FM_MOV_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SQXTN_ARM64_FM_MOV_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ 1156	/**<Variant identifier for SQXTN_ARM64_FM_MOV_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ*/
+#define arm64_VARIANTID_SQXTN_ARM64_FM_MOV_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 1157	/**<Variant identifier for SQXTN_ARM64_FM_MOV_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_SQXTN_ARM64_FM_MOV_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 1158	/**<Variant identifier for SQXTN_ARM64_FM_MOV_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_SQXTN_ARM64_FM_MOV_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1159	/**<Variant identifier for SQXTN_ARM64_FM_MOV_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SQXTN_ARM64_FM_MOV_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1160	/**<Variant identifier for SQXTN_ARM64_FM_MOV_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SQXTN_ARM64_FM_MOV_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1161	/**<Variant identifier for SQXTN_ARM64_FM_MOV_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SQXTUN2_ARM64_FM_MOV_A_NA_S_SIMD_T_SINT_T_UINT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1162	/**<Variant identifier for SQXTUN2_ARM64_FM_MOV_A_NA_S_SIMD_T_SINT_T_UINT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SQXTUN2_ARM64_FM_MOV_A_NA_S_SIMD_T_SINT_T_UINT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1163	/**<Variant identifier for SQXTUN2_ARM64_FM_MOV_A_NA_S_SIMD_T_SINT_T_UINT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SQXTUN2_ARM64_FM_MOV_A_NA_S_SIMD_T_SINT_T_UINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1164	/**<Variant identifier for SQXTUN2_ARM64_FM_MOV_A_NA_S_SIMD_T_SINT_T_UINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SQXTUN_ARM64_FM_MOV_A_NA_S_SCALAR_T_SINT_T_UINT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ 1165	/**<Variant identifier for SQXTUN_ARM64_FM_MOV_A_NA_S_SCALAR_T_SINT_T_UINT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ*/
+#define arm64_VARIANTID_SQXTUN_ARM64_FM_MOV_A_NA_S_SCALAR_T_SINT_T_UINT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 1166	/**<Variant identifier for SQXTUN_ARM64_FM_MOV_A_NA_S_SCALAR_T_SINT_T_UINT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_SQXTUN_ARM64_FM_MOV_A_NA_S_SCALAR_T_SINT_T_UINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 1167	/**<Variant identifier for SQXTUN_ARM64_FM_MOV_A_NA_S_SCALAR_T_SINT_T_UINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_SQXTUN_ARM64_FM_MOV_A_NA_S_SIMD_T_SINT_T_UINT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1168	/**<Variant identifier for SQXTUN_ARM64_FM_MOV_A_NA_S_SIMD_T_SINT_T_UINT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SQXTUN_ARM64_FM_MOV_A_NA_S_SIMD_T_SINT_T_UINT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1169	/**<Variant identifier for SQXTUN_ARM64_FM_MOV_A_NA_S_SIMD_T_SINT_T_UINT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SQXTUN_ARM64_FM_MOV_A_NA_S_SIMD_T_SINT_T_UINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1170	/**<Variant identifier for SQXTUN_ARM64_FM_MOV_A_NA_S_SIMD_T_SINT_T_UINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SRHADD_ARM64_FM_ADD_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1171	/**<Variant identifier for SRHADD_ARM64_FM_ADD_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SRI_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ 1172	/**<Variant identifier for SRI_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ*/
+#define arm64_VARIANTID_SRI_ARM64_FM_SHIFT_A_NA_S_SIMD_T_BIT_T_BIT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ 1173	/**<Variant identifier for SRI_ARM64_FM_SHIFT_A_NA_S_SIMD_T_BIT_T_BIT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ*/
+#define arm64_VARIANTID_SRI_ARM64_FM_SHIFT_A_NA_S_SIMD_T_BIT_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ 1174	/**<Variant identifier for SRI_ARM64_FM_SHIFT_A_NA_S_SIMD_T_BIT_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ*/
+#define arm64_VARIANTID_SRI_ARM64_FM_SHIFT_A_NA_S_SIMD_T_BIT_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ 1175	/**<Variant identifier for SRI_ARM64_FM_SHIFT_A_NA_S_SIMD_T_BIT_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ*/
+#define arm64_VARIANTID_SRI_ARM64_FM_SHIFT_A_NA_S_SIMD_T_BIT_T_BIT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ 1176	/**<Variant identifier for SRI_ARM64_FM_SHIFT_A_NA_S_SIMD_T_BIT_T_BIT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ*/
+#define arm64_VARIANTID_SRSHL_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 1177	/**<Variant identifier for SRSHL_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_SRSHL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1178	/**<Variant identifier for SRSHL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SRSHL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1179	/**<Variant identifier for SRSHL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SRSHR_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ 1180	/**<Variant identifier for SRSHR_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ*/
+#define arm64_VARIANTID_SRSHR_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ 1181	/**<Variant identifier for SRSHR_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ*/
+#define arm64_VARIANTID_SRSHR_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ 1182	/**<Variant identifier for SRSHR_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ*/
+#define arm64_VARIANTID_SRSHR_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ 1183	/**<Variant identifier for SRSHR_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ*/
+#define arm64_VARIANTID_SRSHR_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ 1184	/**<Variant identifier for SRSHR_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ*/
+#define arm64_VARIANTID_SRSRA_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ 1185	/**<Variant identifier for SRSRA_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ*/
+#define arm64_VARIANTID_SRSRA_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ 1186	/**<Variant identifier for SRSRA_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ*/
+#define arm64_VARIANTID_SRSRA_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ 1187	/**<Variant identifier for SRSRA_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ*/
+#define arm64_VARIANTID_SRSRA_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ 1188	/**<Variant identifier for SRSRA_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ*/
+#define arm64_VARIANTID_SRSRA_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ 1189	/**<Variant identifier for SRSRA_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ*/
+#define arm64_VARIANTID_SSHLL2_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ 1190	/**<Variant identifier for SSHLL2_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ*/
+#define arm64_VARIANTID_SSHLL2_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ 1191	/**<Variant identifier for SSHLL2_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ*/
+#define arm64_VARIANTID_SSHLL2_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ 1192	/**<Variant identifier for SSHLL2_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ*/
+#define arm64_VARIANTID_SSHLL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ 1193	/**<Variant identifier for SSHLL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ*/
+#define arm64_VARIANTID_SSHLL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ 1194	/**<Variant identifier for SSHLL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ*/
+#define arm64_VARIANTID_SSHLL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ 1195	/**<Variant identifier for SSHLL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ*/
+#define arm64_VARIANTID_SSHL_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 1196	/**<Variant identifier for SSHL_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_SSHL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1197	/**<Variant identifier for SSHL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SSHL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1198	/**<Variant identifier for SSHL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SSHR_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ 1199	/**<Variant identifier for SSHR_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ*/
+#define arm64_VARIANTID_SSHR_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ 1200	/**<Variant identifier for SSHR_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ*/
+#define arm64_VARIANTID_SSHR_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ 1201	/**<Variant identifier for SSHR_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ*/
+#define arm64_VARIANTID_SSHR_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ 1202	/**<Variant identifier for SSHR_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ*/
+#define arm64_VARIANTID_SSHR_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ 1203	/**<Variant identifier for SSHR_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ*/
+#define arm64_VARIANTID_SSRA_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ 1204	/**<Variant identifier for SSRA_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ*/
+#define arm64_VARIANTID_SSRA_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ 1205	/**<Variant identifier for SSRA_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ*/
+#define arm64_VARIANTID_SSRA_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ 1206	/**<Variant identifier for SSRA_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ*/
+#define arm64_VARIANTID_SSRA_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ 1207	/**<Variant identifier for SSRA_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ*/
+#define arm64_VARIANTID_SSRA_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ 1208	/**<Variant identifier for SSRA_ARM64_FM_SHIFT_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ*/
+#define arm64_VARIANTID_SSUBL2_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1209	/**<Variant identifier for SSUBL2_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SSUBL2_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1210	/**<Variant identifier for SSUBL2_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SSUBL2_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1211	/**<Variant identifier for SSUBL2_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SSUBL_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1212	/**<Variant identifier for SSUBL_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SSUBL_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1213	/**<Variant identifier for SSUBL_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SSUBL_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1214	/**<Variant identifier for SSUBL_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SSUBW2_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1215	/**<Variant identifier for SSUBW2_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SSUBW2_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1216	/**<Variant identifier for SSUBW2_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SSUBW2_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1217	/**<Variant identifier for SSUBW2_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SSUBW_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1218	/**<Variant identifier for SSUBW_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SSUBW_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1219	/**<Variant identifier for SSUBW_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SSUBW_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1220	/**<Variant identifier for SSUBW_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_ST1_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_ONE_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE 1221	/**<Variant identifier for ST1_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_ONE_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST1_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_ONE_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_WRITE 1222	/**<Variant identifier for ST1_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_ONE_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST1_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_ONE_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE 1223	/**<Variant identifier for ST1_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_ONE_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST1_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_ONE_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE 1224	/**<Variant identifier for ST1_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_ONE_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST1_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_ONE_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_WRITE 1225	/**<Variant identifier for ST1_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_ONE_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST1_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_ONE_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE 1226	/**<Variant identifier for ST1_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_ONE_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST1_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_ONE_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE 1227	/**<Variant identifier for ST1_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_ONE_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST1_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_ONE_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_WRITE 1228	/**<Variant identifier for ST1_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_ONE_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST1_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_ONE_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE 1229	/**<Variant identifier for ST1_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_ONE_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST1_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_ONE_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE 1230	/**<Variant identifier for ST1_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_ONE_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST1_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_ONE_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_WRITE 1231	/**<Variant identifier for ST1_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_ONE_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST1_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_ONE_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE 1232	/**<Variant identifier for ST1_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_ONE_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST1_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_FOUR_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE 1233	/**<Variant identifier for ST1_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_FOUR_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST1_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_FOUR_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_WRITE 1234	/**<Variant identifier for ST1_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_FOUR_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST1_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_FOUR_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE 1235	/**<Variant identifier for ST1_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_FOUR_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST1_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_ONE_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE 1236	/**<Variant identifier for ST1_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_ONE_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST1_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_ONE_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_WRITE 1237	/**<Variant identifier for ST1_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_ONE_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST1_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_ONE_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE 1238	/**<Variant identifier for ST1_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_ONE_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST1_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_THREE_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE 1239	/**<Variant identifier for ST1_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_THREE_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST1_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_THREE_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_WRITE 1240	/**<Variant identifier for ST1_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_THREE_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST1_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_THREE_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE 1241	/**<Variant identifier for ST1_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_THREE_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST1_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_TWO_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE 1242	/**<Variant identifier for ST1_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_TWO_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST1_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_TWO_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_WRITE 1243	/**<Variant identifier for ST1_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_TWO_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST1_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_TWO_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE 1244	/**<Variant identifier for ST1_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_TWO_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST2_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_TWO_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE 1245	/**<Variant identifier for ST2_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_TWO_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST2_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_TWO_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_WRITE 1246	/**<Variant identifier for ST2_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_TWO_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST2_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_TWO_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE 1247	/**<Variant identifier for ST2_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_TWO_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST2_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_TWO_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE 1248	/**<Variant identifier for ST2_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_TWO_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST2_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_TWO_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_WRITE 1249	/**<Variant identifier for ST2_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_TWO_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST2_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_TWO_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE 1250	/**<Variant identifier for ST2_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_TWO_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST2_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_TWO_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE 1251	/**<Variant identifier for ST2_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_TWO_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST2_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_TWO_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_WRITE 1252	/**<Variant identifier for ST2_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_TWO_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST2_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_TWO_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE 1253	/**<Variant identifier for ST2_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_TWO_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST2_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_TWO_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE 1254	/**<Variant identifier for ST2_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_TWO_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST2_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_TWO_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_WRITE 1255	/**<Variant identifier for ST2_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_TWO_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST2_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_TWO_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE 1256	/**<Variant identifier for ST2_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_TWO_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST2_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_TWO_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE 1257	/**<Variant identifier for ST2_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_TWO_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST2_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_TWO_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_WRITE 1258	/**<Variant identifier for ST2_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_TWO_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST2_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_TWO_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE 1259	/**<Variant identifier for ST2_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_TWO_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST2_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_TWO_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE 1260	/**<Variant identifier for ST2_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_TWO_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST2_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_TWO_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_WRITE 1261	/**<Variant identifier for ST2_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_TWO_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST2_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_TWO_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE 1262	/**<Variant identifier for ST2_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_TWO_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST3_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_THREE_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE 1263	/**<Variant identifier for ST3_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_THREE_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST3_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_THREE_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_WRITE 1264	/**<Variant identifier for ST3_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_THREE_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST3_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_THREE_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE 1265	/**<Variant identifier for ST3_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_THREE_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST3_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_THREE_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE 1266	/**<Variant identifier for ST3_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_THREE_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST3_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_THREE_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_WRITE 1267	/**<Variant identifier for ST3_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_THREE_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST3_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_THREE_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE 1268	/**<Variant identifier for ST3_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_THREE_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST3_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_THREE_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE 1269	/**<Variant identifier for ST3_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_THREE_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST3_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_THREE_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_WRITE 1270	/**<Variant identifier for ST3_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_THREE_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST3_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_THREE_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE 1271	/**<Variant identifier for ST3_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_THREE_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST3_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_THREE_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE 1272	/**<Variant identifier for ST3_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_THREE_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST3_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_THREE_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_WRITE 1273	/**<Variant identifier for ST3_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_THREE_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST3_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_THREE_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE 1274	/**<Variant identifier for ST3_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_THREE_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST3_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_THREE_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE 1275	/**<Variant identifier for ST3_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_THREE_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST3_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_THREE_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_WRITE 1276	/**<Variant identifier for ST3_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_THREE_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST3_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_THREE_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE 1277	/**<Variant identifier for ST3_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_THREE_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST3_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_THREE_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE 1278	/**<Variant identifier for ST3_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_THREE_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST3_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_THREE_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_WRITE 1279	/**<Variant identifier for ST3_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_THREE_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST3_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_THREE_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE 1280	/**<Variant identifier for ST3_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_THREE_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST4_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_FOUR_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE 1281	/**<Variant identifier for ST4_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_FOUR_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST4_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_FOUR_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_WRITE 1282	/**<Variant identifier for ST4_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_FOUR_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST4_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_FOUR_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE 1283	/**<Variant identifier for ST4_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_LIST_FOUR_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST4_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_FOUR_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE 1284	/**<Variant identifier for ST4_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_FOUR_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST4_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_FOUR_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_WRITE 1285	/**<Variant identifier for ST4_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_FOUR_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST4_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_FOUR_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE 1286	/**<Variant identifier for ST4_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_LIST_FOUR_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST4_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_FOUR_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE 1287	/**<Variant identifier for ST4_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_FOUR_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST4_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_FOUR_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_WRITE 1288	/**<Variant identifier for ST4_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_FOUR_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST4_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_FOUR_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE 1289	/**<Variant identifier for ST4_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_FOUR_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST4_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_FOUR_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE 1290	/**<Variant identifier for ST4_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_FOUR_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST4_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_FOUR_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_WRITE 1291	/**<Variant identifier for ST4_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_FOUR_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST4_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_FOUR_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE 1292	/**<Variant identifier for ST4_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_LIST_FOUR_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST4_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_FOUR_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE 1293	/**<Variant identifier for ST4_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_FOUR_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST4_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_FOUR_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_WRITE 1294	/**<Variant identifier for ST4_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_FOUR_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST4_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_FOUR_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE 1295	/**<Variant identifier for ST4_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_LIST_FOUR_INDEXED_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST4_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_FOUR_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE 1296	/**<Variant identifier for ST4_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_FOUR_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST4_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_FOUR_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_WRITE 1297	/**<Variant identifier for ST4_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_FOUR_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_DWORD_REGISTER_POST_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_ST4_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_FOUR_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE 1298	/**<Variant identifier for ST4_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_LIST_FOUR_VECTOR_DATASZ_QWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STLRB_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE 1299	/**<Variant identifier for STLRB_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STLRH_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE 1300	/**<Variant identifier for STLRH_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STLR_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE 1301	/**<Variant identifier for STLR_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STLR_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE 1302	/**<Variant identifier for STLR_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STLXP_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE 1303	/**<Variant identifier for STLXP_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STLXP_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE 1304	/**<Variant identifier for STLXP_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STLXRB_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE 1305	/**<Variant identifier for STLXRB_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STLXRH_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE 1306	/**<Variant identifier for STLXRH_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STLXR_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE 1307	/**<Variant identifier for STLXR_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STLXR_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE 1308	/**<Variant identifier for STLXR_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STNP_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_WRITE 1309	/**<Variant identifier for STNP_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STNP_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_WRITE 1310	/**<Variant identifier for STNP_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STNP_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_128b_DATASZ_128b_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_WRITE 1311	/**<Variant identifier for STNP_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_128b_DATASZ_128b_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STNP_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_WRITE 1312	/**<Variant identifier for STNP_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STNP_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_WRITE 1313	/**<Variant identifier for STNP_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STP_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_WRITE 1314	/**<Variant identifier for STP_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STP_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_WRITE 1315	/**<Variant identifier for STP_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STP_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE 1316	/**<Variant identifier for STP_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STP_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_WRITE 1317	/**<Variant identifier for STP_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STP_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_WRITE 1318	/**<Variant identifier for STP_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STP_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE 1319	/**<Variant identifier for STP_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STP_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_128b_DATASZ_128b_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_WRITE 1320	/**<Variant identifier for STP_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_128b_DATASZ_128b_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STP_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_128b_DATASZ_128b_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_WRITE 1321	/**<Variant identifier for STP_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_128b_DATASZ_128b_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STP_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_128b_DATASZ_128b_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE 1322	/**<Variant identifier for STP_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_128b_DATASZ_128b_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STP_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_WRITE 1323	/**<Variant identifier for STP_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STP_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_WRITE 1324	/**<Variant identifier for STP_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STP_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE 1325	/**<Variant identifier for STP_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STP_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_WRITE 1326	/**<Variant identifier for STP_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STP_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_WRITE 1327	/**<Variant identifier for STP_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STP_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE 1328	/**<Variant identifier for STP_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STRB_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_DWORD_REGISTER_INDEX_DATASZ_32b_WRITE 1329	/**<Variant identifier for STRB_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_DWORD_REGISTER_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STRB_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_WRITE 1330	/**<Variant identifier for STRB_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STRB_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE 1331	/**<Variant identifier for STRB_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STRB_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_SWORD_REGISTER_INDEX_DATASZ_32b_WRITE 1332	/**<Variant identifier for STRB_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_SWORD_REGISTER_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STRB_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_INDEX_DATASZ_32b_WRITE 1333	/**<Variant identifier for STRB_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STRH_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_DWORD_REGISTER_INDEX_DATASZ_32b_WRITE 1334	/**<Variant identifier for STRH_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_DWORD_REGISTER_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STRH_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_WRITE 1335	/**<Variant identifier for STRH_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STRH_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE 1336	/**<Variant identifier for STRH_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STRH_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_SWORD_REGISTER_INDEX_DATASZ_32b_WRITE 1337	/**<Variant identifier for STRH_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_SWORD_REGISTER_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STRH_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_INDEX_DATASZ_32b_WRITE 1338	/**<Variant identifier for STRH_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STR_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_DWORD_REGISTER_INDEX_DATASZ_32b_WRITE 1339	/**<Variant identifier for STR_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_DWORD_REGISTER_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STR_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_WRITE 1340	/**<Variant identifier for STR_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STR_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE 1341	/**<Variant identifier for STR_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STR_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_SWORD_REGISTER_INDEX_DATASZ_32b_WRITE 1342	/**<Variant identifier for STR_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_SWORD_REGISTER_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STR_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_INDEX_DATASZ_32b_WRITE 1343	/**<Variant identifier for STR_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STR_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_MEMORY_DWORD_REGISTER_INDEX_DATASZ_32b_WRITE 1344	/**<Variant identifier for STR_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_MEMORY_DWORD_REGISTER_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STR_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_WRITE 1345	/**<Variant identifier for STR_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STR_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE 1346	/**<Variant identifier for STR_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STR_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_MEMORY_SWORD_REGISTER_INDEX_DATASZ_32b_WRITE 1347	/**<Variant identifier for STR_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_MEMORY_SWORD_REGISTER_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STR_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_INDEX_DATASZ_32b_WRITE 1348	/**<Variant identifier for STR_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STR_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_128b_DATASZ_128b_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_READ_OPRN_MEMORY_DWORD_REGISTER_INDEX_DATASZ_32b_WRITE 1349	/**<Variant identifier for STR_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_128b_DATASZ_128b_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_READ_OPRN_MEMORY_DWORD_REGISTER_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STR_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_128b_DATASZ_128b_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_WRITE 1350	/**<Variant identifier for STR_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_128b_DATASZ_128b_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STR_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_128b_DATASZ_128b_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE 1351	/**<Variant identifier for STR_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_128b_DATASZ_128b_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STR_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_128b_DATASZ_128b_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_READ_OPRN_MEMORY_SWORD_REGISTER_INDEX_DATASZ_32b_WRITE 1352	/**<Variant identifier for STR_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_128b_DATASZ_128b_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_READ_OPRN_MEMORY_SWORD_REGISTER_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STR_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_128b_DATASZ_128b_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_INDEX_DATASZ_32b_WRITE 1353	/**<Variant identifier for STR_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_128b_DATASZ_128b_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STR_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_OPRN_MEMORY_DWORD_REGISTER_INDEX_DATASZ_32b_WRITE 1354	/**<Variant identifier for STR_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_OPRN_MEMORY_DWORD_REGISTER_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STR_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_WRITE 1355	/**<Variant identifier for STR_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STR_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE 1356	/**<Variant identifier for STR_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STR_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_OPRN_MEMORY_SWORD_REGISTER_INDEX_DATASZ_32b_WRITE 1357	/**<Variant identifier for STR_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_OPRN_MEMORY_SWORD_REGISTER_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STR_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_INDEX_DATASZ_32b_WRITE 1358	/**<Variant identifier for STR_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STR_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_MEMORY_DWORD_REGISTER_INDEX_DATASZ_32b_WRITE 1359	/**<Variant identifier for STR_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_MEMORY_DWORD_REGISTER_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STR_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_WRITE 1360	/**<Variant identifier for STR_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STR_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE 1361	/**<Variant identifier for STR_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STR_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_MEMORY_SWORD_REGISTER_INDEX_DATASZ_32b_WRITE 1362	/**<Variant identifier for STR_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_MEMORY_SWORD_REGISTER_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STR_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_INDEX_DATASZ_32b_WRITE 1363	/**<Variant identifier for STR_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STR_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_MEMORY_DWORD_REGISTER_INDEX_DATASZ_32b_WRITE 1364	/**<Variant identifier for STR_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_MEMORY_DWORD_REGISTER_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STR_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_WRITE 1365	/**<Variant identifier for STR_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STR_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE 1366	/**<Variant identifier for STR_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STR_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_MEMORY_SWORD_REGISTER_INDEX_DATASZ_32b_WRITE 1367	/**<Variant identifier for STR_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_MEMORY_SWORD_REGISTER_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STR_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_INDEX_DATASZ_32b_WRITE 1368	/**<Variant identifier for STR_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STR_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_READ_OPRN_MEMORY_DWORD_REGISTER_INDEX_DATASZ_32b_WRITE 1369	/**<Variant identifier for STR_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_READ_OPRN_MEMORY_DWORD_REGISTER_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STR_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_WRITE 1370	/**<Variant identifier for STR_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_WRITEBACK_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STR_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE 1371	/**<Variant identifier for STR_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_POST_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STR_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_READ_OPRN_MEMORY_SWORD_REGISTER_INDEX_DATASZ_32b_WRITE 1372	/**<Variant identifier for STR_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_READ_OPRN_MEMORY_SWORD_REGISTER_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STR_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_INDEX_DATASZ_32b_WRITE 1373	/**<Variant identifier for STR_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_READ_OPRN_MEMORY_UNSIGNED_IMMEDIATE_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STTRB_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_WRITE 1374	/**<Variant identifier for STTRB_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STTRH_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_WRITE 1375	/**<Variant identifier for STTRH_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STTR_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_WRITE 1376	/**<Variant identifier for STTR_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STTR_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_WRITE 1377	/**<Variant identifier for STTR_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STURB_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_WRITE 1378	/**<Variant identifier for STURB_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STURH_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_WRITE 1379	/**<Variant identifier for STURH_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STUR_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_WRITE 1380	/**<Variant identifier for STUR_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STUR_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_WRITE 1381	/**<Variant identifier for STUR_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STUR_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_128b_DATASZ_128b_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_WRITE 1382	/**<Variant identifier for STUR_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_128b_DATASZ_128b_OPRN_REGISTER_SIMD_SCALAR_QWORD_DATASZ_QWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STUR_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_WRITE 1383	/**<Variant identifier for STUR_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STUR_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_WRITE 1384	/**<Variant identifier for STUR_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STUR_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_WRITE 1385	/**<Variant identifier for STUR_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STUR_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_WRITE 1386	/**<Variant identifier for STUR_ARM64_FM_STORE_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_READ_OPRN_MEMORY_SIGNED_IMMEDIATE_INDEX_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STXP_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE 1387	/**<Variant identifier for STXP_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STXP_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE 1388	/**<Variant identifier for STXP_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STXRB_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE 1389	/**<Variant identifier for STXRB_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STXRH_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE 1390	/**<Variant identifier for STXRH_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STXR_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE 1391	/**<Variant identifier for STXR_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_STXR_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE 1392	/**<Variant identifier for STXR_ARM64_FM_STORE_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_MEMORY_DATASZ_32b_WRITE*/
+#define arm64_VARIANTID_SUBHN2_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1393	/**<Variant identifier for SUBHN2_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SUBHN2_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1394	/**<Variant identifier for SUBHN2_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SUBHN2_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1395	/**<Variant identifier for SUBHN2_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SUBHN_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1396	/**<Variant identifier for SUBHN_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SUBHN_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1397	/**<Variant identifier for SUBHN_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SUBHN_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1398	/**<Variant identifier for SUBHN_ARM64_FM_SUB_A_NA_S_SIMD_T_SINT_T_SINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SUBS_ARM64_FM_SUB_A_SETFLAGS_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_12b_READ 1399	/**<Variant identifier for SUBS_ARM64_FM_SUB_A_SETFLAGS_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_12b_READ*/
+#define arm64_VARIANTID_SUBS_ARM64_FM_SUB_A_SETFLAGS_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ 1400	/**<Variant identifier for SUBS_ARM64_FM_SUB_A_SETFLAGS_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_SUBS_ARM64_FM_SUB_A_SETFLAGS_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ 1401	/**<Variant identifier for SUBS_ARM64_FM_SUB_A_SETFLAGS_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_SUBS_ARM64_FM_SUB_A_SETFLAGS_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_12b_READ 1402	/**<Variant identifier for SUBS_ARM64_FM_SUB_A_SETFLAGS_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_12b_READ*/
+#define arm64_VARIANTID_SUBS_ARM64_FM_SUB_A_SETFLAGS_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ 1403	/**<Variant identifier for SUBS_ARM64_FM_SUB_A_SETFLAGS_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_SUBS_ARM64_FM_SUB_A_SETFLAGS_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ 1404	/**<Variant identifier for SUBS_ARM64_FM_SUB_A_SETFLAGS_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_SUBS_ARM64_FM_SUB_A_SETFLAGS_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ 1405	/**<Variant identifier for SUBS_ARM64_FM_SUB_A_SETFLAGS_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_SUB_ARM64_FM_SUB_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_12b_READ 1406	/**<Variant identifier for SUB_ARM64_FM_SUB_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_12b_READ*/
+#define arm64_VARIANTID_SUB_ARM64_FM_SUB_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ 1407	/**<Variant identifier for SUB_ARM64_FM_SUB_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_SUB_ARM64_FM_SUB_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ 1408	/**<Variant identifier for SUB_ARM64_FM_SUB_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_SUB_ARM64_FM_SUB_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_12b_READ 1409	/**<Variant identifier for SUB_ARM64_FM_SUB_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_12b_READ*/
+#define arm64_VARIANTID_SUB_ARM64_FM_SUB_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ 1410	/**<Variant identifier for SUB_ARM64_FM_SUB_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_SUB_ARM64_FM_SUB_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ 1411	/**<Variant identifier for SUB_ARM64_FM_SUB_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_SUB_ARM64_FM_SUB_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ 1412	/**<Variant identifier for SUB_ARM64_FM_SUB_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_SUB_ARM64_FM_SUB_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 1413	/**<Variant identifier for SUB_ARM64_FM_SUB_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_SUB_ARM64_FM_SUB_A_NA_S_SIMD_T_INT_T_INT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1414	/**<Variant identifier for SUB_ARM64_FM_SUB_A_NA_S_SIMD_T_INT_T_INT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SUB_ARM64_FM_SUB_A_NA_S_SIMD_T_INT_T_INT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1415	/**<Variant identifier for SUB_ARM64_FM_SUB_A_NA_S_SIMD_T_INT_T_INT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SUQADD_ARM64_FM_ADD_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ 1416	/**<Variant identifier for SUQADD_ARM64_FM_ADD_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ*/
+#define arm64_VARIANTID_SUQADD_ARM64_FM_ADD_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 1417	/**<Variant identifier for SUQADD_ARM64_FM_ADD_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_SUQADD_ARM64_FM_ADD_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 1418	/**<Variant identifier for SUQADD_ARM64_FM_ADD_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_SUQADD_ARM64_FM_ADD_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_READ_WRITE_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_READ 1419	/**<Variant identifier for SUQADD_ARM64_FM_ADD_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_READ_WRITE_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_READ*/
+#define arm64_VARIANTID_SUQADD_ARM64_FM_ADD_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1420	/**<Variant identifier for SUQADD_ARM64_FM_ADD_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SUQADD_ARM64_FM_ADD_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1421	/**<Variant identifier for SUQADD_ARM64_FM_ADD_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_SVC_ARM64_FM_OS_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF_OPRN_IMMEDIATE_DATASZ_16b_READ 1422	/**<Variant identifier for SVC_ARM64_FM_OS_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF_OPRN_IMMEDIATE_DATASZ_16b_READ*/
+#define arm64_VARIANTID_SYSL_ARM64_FM_HW_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_IMMEDIATE_DATASZ_3b_READ_OPRN_IMMEDIATE_SYSTEM_DATASZ_4b_READ_OPRN_IMMEDIATE_SYSTEM_DATASZ_4b_READ_OPRN_IMMEDIATE_DATASZ_3b_READ 1423	/**<Variant identifier for SYSL_ARM64_FM_HW_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_IMMEDIATE_DATASZ_3b_READ_OPRN_IMMEDIATE_SYSTEM_DATASZ_4b_READ_OPRN_IMMEDIATE_SYSTEM_DATASZ_4b_READ_OPRN_IMMEDIATE_DATASZ_3b_READ*/
+#define arm64_VARIANTID_SYS_ARM64_FM_HW_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF_OPRN_IMMEDIATE_DATASZ_3b_READ_OPRN_IMMEDIATE_SYSTEM_DATASZ_4b_READ_OPRN_IMMEDIATE_SYSTEM_DATASZ_4b_READ_OPRN_IMMEDIATE_DATASZ_3b_READ 1424	/**<Variant identifier for SYS_ARM64_FM_HW_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF_OPRN_IMMEDIATE_DATASZ_3b_READ_OPRN_IMMEDIATE_SYSTEM_DATASZ_4b_READ_OPRN_IMMEDIATE_SYSTEM_DATASZ_4b_READ_OPRN_IMMEDIATE_DATASZ_3b_READ*/
+#define arm64_VARIANTID_SYS_ARM64_FM_HW_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF_OPRN_IMMEDIATE_DATASZ_3b_READ_OPRN_IMMEDIATE_SYSTEM_DATASZ_4b_READ_OPRN_IMMEDIATE_SYSTEM_DATASZ_4b_READ_OPRN_IMMEDIATE_DATASZ_3b_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ 1425	/**<Variant identifier for SYS_ARM64_FM_HW_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_UNDEF_DATASZ_UNDEF_OPRN_IMMEDIATE_DATASZ_3b_READ_OPRN_IMMEDIATE_SYSTEM_DATASZ_4b_READ_OPRN_IMMEDIATE_SYSTEM_DATASZ_4b_READ_OPRN_IMMEDIATE_DATASZ_3b_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_TBLX_ARM64_FM_MOV_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_LIST_FOUR_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1426	/**<Variant identifier for TBLX_ARM64_FM_MOV_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_LIST_FOUR_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_TBLX_ARM64_FM_MOV_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_LIST_ONE_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1427	/**<Variant identifier for TBLX_ARM64_FM_MOV_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_LIST_ONE_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_TBLX_ARM64_FM_MOV_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_LIST_THREE_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1428	/**<Variant identifier for TBLX_ARM64_FM_MOV_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_LIST_THREE_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_TBLX_ARM64_FM_MOV_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_LIST_TWO_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1429	/**<Variant identifier for TBLX_ARM64_FM_MOV_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_LIST_TWO_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_TBL_ARM64_FM_MOV_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_LIST_FOUR_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1430	/**<Variant identifier for TBL_ARM64_FM_MOV_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_LIST_FOUR_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_TBL_ARM64_FM_MOV_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_LIST_ONE_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1431	/**<Variant identifier for TBL_ARM64_FM_MOV_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_LIST_ONE_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_TBL_ARM64_FM_MOV_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_LIST_THREE_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1432	/**<Variant identifier for TBL_ARM64_FM_MOV_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_LIST_THREE_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_TBL_ARM64_FM_MOV_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_LIST_TWO_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1433	/**<Variant identifier for TBL_ARM64_FM_MOV_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_LIST_TWO_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_TBNZ_ARM64_FM_CJUMP_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_UNDEF_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ_OPRN_POINTER_DATASZ_14b_READ 1434	/**<Variant identifier for TBNZ_ARM64_FM_CJUMP_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_UNDEF_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ_OPRN_POINTER_DATASZ_14b_READ*/
+#define arm64_VARIANTID_TBNZ_ARM64_FM_CJUMP_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_UNDEF_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ_OPRN_POINTER_DATASZ_14b_READ 1435	/**<Variant identifier for TBNZ_ARM64_FM_CJUMP_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_UNDEF_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ_OPRN_POINTER_DATASZ_14b_READ*/
+#define arm64_VARIANTID_TBZ_ARM64_FM_CJUMP_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_UNDEF_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ_OPRN_POINTER_DATASZ_14b_READ 1436	/**<Variant identifier for TBZ_ARM64_FM_CJUMP_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_UNDEF_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ_OPRN_POINTER_DATASZ_14b_READ*/
+#define arm64_VARIANTID_TBZ_ARM64_FM_CJUMP_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_UNDEF_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ_OPRN_POINTER_DATASZ_14b_READ 1437	/**<Variant identifier for TBZ_ARM64_FM_CJUMP_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_UNDEF_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ_OPRN_POINTER_DATASZ_14b_READ*/
+#define arm64_VARIANTID_TRN1_ARM64_FM_MOV_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1438	/**<Variant identifier for TRN1_ARM64_FM_MOV_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_TRN1_ARM64_FM_MOV_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1439	/**<Variant identifier for TRN1_ARM64_FM_MOV_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_TRN2_ARM64_FM_MOV_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1440	/**<Variant identifier for TRN2_ARM64_FM_MOV_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_TRN2_ARM64_FM_MOV_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1441	/**<Variant identifier for TRN2_ARM64_FM_MOV_A_NA_S_SCALAR_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UABAL2_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1442	/**<Variant identifier for UABAL2_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UABAL2_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1443	/**<Variant identifier for UABAL2_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UABAL2_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1444	/**<Variant identifier for UABAL2_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UABAL_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1445	/**<Variant identifier for UABAL_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UABAL_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1446	/**<Variant identifier for UABAL_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UABAL_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1447	/**<Variant identifier for UABAL_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UABA_ARM64_FM_SUB_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1448	/**<Variant identifier for UABA_ARM64_FM_SUB_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UABDL2_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1449	/**<Variant identifier for UABDL2_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UABDL2_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1450	/**<Variant identifier for UABDL2_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UABDL2_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1451	/**<Variant identifier for UABDL2_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UABDL_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1452	/**<Variant identifier for UABDL_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UABDL_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1453	/**<Variant identifier for UABDL_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UABDL_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1454	/**<Variant identifier for UABDL_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UABD_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1455	/**<Variant identifier for UABD_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UADALP_ARM64_FM_ADD_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1456	/**<Variant identifier for UADALP_ARM64_FM_ADD_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UADDL2_ARM64_FM_ADD_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1457	/**<Variant identifier for UADDL2_ARM64_FM_ADD_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UADDL2_ARM64_FM_ADD_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1458	/**<Variant identifier for UADDL2_ARM64_FM_ADD_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UADDL2_ARM64_FM_ADD_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1459	/**<Variant identifier for UADDL2_ARM64_FM_ADD_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UADDLP_ARM64_FM_ADD_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1460	/**<Variant identifier for UADDLP_ARM64_FM_ADD_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UADDLV_ARM64_FM_ADD_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1461	/**<Variant identifier for UADDLV_ARM64_FM_ADD_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UADDLV_ARM64_FM_ADD_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1462	/**<Variant identifier for UADDLV_ARM64_FM_ADD_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UADDLV_ARM64_FM_ADD_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1463	/**<Variant identifier for UADDLV_ARM64_FM_ADD_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UADDL_ARM64_FM_ADD_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1464	/**<Variant identifier for UADDL_ARM64_FM_ADD_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UADDL_ARM64_FM_ADD_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1465	/**<Variant identifier for UADDL_ARM64_FM_ADD_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UADDL_ARM64_FM_ADD_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1466	/**<Variant identifier for UADDL_ARM64_FM_ADD_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UADDW2_ARM64_FM_ADD_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1467	/**<Variant identifier for UADDW2_ARM64_FM_ADD_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UADDW2_ARM64_FM_ADD_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1468	/**<Variant identifier for UADDW2_ARM64_FM_ADD_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UADDW2_ARM64_FM_ADD_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1469	/**<Variant identifier for UADDW2_ARM64_FM_ADD_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UADDW_ARM64_FM_ADD_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1470	/**<Variant identifier for UADDW_ARM64_FM_ADD_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UADDW_ARM64_FM_ADD_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1471	/**<Variant identifier for UADDW_ARM64_FM_ADD_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UADDW_ARM64_FM_ADD_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1472	/**<Variant identifier for UADDW_ARM64_FM_ADD_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UBFM_ARM64_FM_MOV_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ_OPRN_IMMEDIATE_DATASZ_5b_READ 1473	/**<Variant identifier for UBFM_ARM64_FM_MOV_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ_OPRN_IMMEDIATE_DATASZ_5b_READ*/
+#define arm64_VARIANTID_UBFM_ARM64_FM_MOV_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ_OPRN_IMMEDIATE_DATASZ_6b_READ 1474	/**<Variant identifier for UBFM_ARM64_FM_MOV_A_NA_S_SCALAR_T_BIT_T_BIT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ_OPRN_IMMEDIATE_DATASZ_6b_READ*/
+#define arm64_VARIANTID_UCVTF_ARM64_FM_CVT_A_NA_S_SCALAR_T_UFXP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ 1475	/**<Variant identifier for UCVTF_ARM64_FM_CVT_A_NA_S_SCALAR_T_UFXP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ*/
+#define arm64_VARIANTID_UCVTF_ARM64_FM_CVT_A_NA_S_SCALAR_T_UFXP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ 1476	/**<Variant identifier for UCVTF_ARM64_FM_CVT_A_NA_S_SCALAR_T_UFXP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ*/
+#define arm64_VARIANTID_UCVTF_ARM64_FM_CVT_A_NA_S_SCALAR_T_UFXP_T_FP_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ 1477	/**<Variant identifier for UCVTF_ARM64_FM_CVT_A_NA_S_SCALAR_T_UFXP_T_FP_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ*/
+#define arm64_VARIANTID_UCVTF_ARM64_FM_CVT_A_NA_S_SCALAR_T_UFXP_T_FP_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ 1478	/**<Variant identifier for UCVTF_ARM64_FM_CVT_A_NA_S_SCALAR_T_UFXP_T_FP_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ*/
+#define arm64_VARIANTID_UCVTF_ARM64_FM_CVT_A_NA_S_SCALAR_T_UFXP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ 1479	/**<Variant identifier for UCVTF_ARM64_FM_CVT_A_NA_S_SCALAR_T_UFXP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ*/
+#define arm64_VARIANTID_UCVTF_ARM64_FM_CVT_A_NA_S_SCALAR_T_UFXP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ 1480	/**<Variant identifier for UCVTF_ARM64_FM_CVT_A_NA_S_SCALAR_T_UFXP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ*/
+#define arm64_VARIANTID_UCVTF_ARM64_FM_CVT_A_NA_S_SCALAR_T_UINT_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 1481	/**<Variant identifier for UCVTF_ARM64_FM_CVT_A_NA_S_SCALAR_T_UINT_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_UCVTF_ARM64_FM_CVT_A_NA_S_SCALAR_T_UINT_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_READ 1482	/**<Variant identifier for UCVTF_ARM64_FM_CVT_A_NA_S_SCALAR_T_UINT_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_UCVTF_ARM64_FM_CVT_A_NA_S_SCALAR_T_UINT_T_FP_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_READ 1483	/**<Variant identifier for UCVTF_ARM64_FM_CVT_A_NA_S_SCALAR_T_UINT_T_FP_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_UCVTF_ARM64_FM_CVT_A_NA_S_SCALAR_T_UINT_T_FP_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_READ 1484	/**<Variant identifier for UCVTF_ARM64_FM_CVT_A_NA_S_SCALAR_T_UINT_T_FP_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_UCVTF_ARM64_FM_CVT_A_NA_S_SCALAR_T_UINT_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_READ 1485	/**<Variant identifier for UCVTF_ARM64_FM_CVT_A_NA_S_SCALAR_T_UINT_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_STACK_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_UCVTF_ARM64_FM_CVT_A_NA_S_SCALAR_T_UINT_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 1486	/**<Variant identifier for UCVTF_ARM64_FM_CVT_A_NA_S_SCALAR_T_UINT_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_UCVTF_ARM64_FM_CVT_A_NA_S_SIMD_T_UFXP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ 1487	/**<Variant identifier for UCVTF_ARM64_FM_CVT_A_NA_S_SIMD_T_UFXP_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ*/
+#define arm64_VARIANTID_UCVTF_ARM64_FM_CVT_A_NA_S_SIMD_T_UFXP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ 1488	/**<Variant identifier for UCVTF_ARM64_FM_CVT_A_NA_S_SIMD_T_UFXP_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ*/
+#define arm64_VARIANTID_UCVTF_ARM64_FM_CVT_A_NA_S_SIMD_T_UINT_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1489	/**<Variant identifier for UCVTF_ARM64_FM_CVT_A_NA_S_SIMD_T_UINT_T_FP_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UCVTF_ARM64_FM_CVT_A_NA_S_SIMD_T_UINT_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1490	/**<Variant identifier for UCVTF_ARM64_FM_CVT_A_NA_S_SIMD_T_UINT_T_FP_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UDIV_ARM64_FM_DIV_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ 1491	/**<Variant identifier for UDIV_ARM64_FM_DIV_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_UDIV_ARM64_FM_DIV_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ 1492	/**<Variant identifier for UDIV_ARM64_FM_DIV_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_UHADD_ARM64_FM_ADD_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1493	/**<Variant identifier for UHADD_ARM64_FM_ADD_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UHSUB_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1494	/**<Variant identifier for UHSUB_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UMADDL_ARM64_FM_FMA_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ 1495	/**<Variant identifier for UMADDL_ARM64_FM_FMA_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_UMAXP_ARM64_FM_MAX_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1496	/**<Variant identifier for UMAXP_ARM64_FM_MAX_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UMAXV_ARM64_FM_MAX_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1497	/**<Variant identifier for UMAXV_ARM64_FM_MAX_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UMAXV_ARM64_FM_MAX_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1498	/**<Variant identifier for UMAXV_ARM64_FM_MAX_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UMAXV_ARM64_FM_MAX_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1499	/**<Variant identifier for UMAXV_ARM64_FM_MAX_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UMAX_ARM64_FM_MAX_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1500	/**<Variant identifier for UMAX_ARM64_FM_MAX_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UMINP_ARM64_FM_MIN_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1501	/**<Variant identifier for UMINP_ARM64_FM_MIN_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UMINV_ARM64_FM_MIN_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1502	/**<Variant identifier for UMINV_ARM64_FM_MIN_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UMINV_ARM64_FM_MIN_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1503	/**<Variant identifier for UMINV_ARM64_FM_MIN_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UMINV_ARM64_FM_MIN_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1504	/**<Variant identifier for UMINV_ARM64_FM_MIN_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UMIN_ARM64_FM_MIN_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1505	/**<Variant identifier for UMIN_ARM64_FM_MIN_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UMLAL2_ARM64_FM_ADD_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 1506	/**<Variant identifier for UMLAL2_ARM64_FM_ADD_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UMLAL2_ARM64_FM_ADD_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1507	/**<Variant identifier for UMLAL2_ARM64_FM_ADD_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UMLAL2_ARM64_FM_ADD_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 1508	/**<Variant identifier for UMLAL2_ARM64_FM_ADD_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UMLAL2_ARM64_FM_ADD_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1509	/**<Variant identifier for UMLAL2_ARM64_FM_ADD_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UMLAL2_ARM64_FM_ADD_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1510	/**<Variant identifier for UMLAL2_ARM64_FM_ADD_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UMLAL_ARM64_FM_ADD_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 1511	/**<Variant identifier for UMLAL_ARM64_FM_ADD_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UMLAL_ARM64_FM_ADD_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1512	/**<Variant identifier for UMLAL_ARM64_FM_ADD_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UMLAL_ARM64_FM_ADD_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 1513	/**<Variant identifier for UMLAL_ARM64_FM_ADD_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UMLAL_ARM64_FM_ADD_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1514	/**<Variant identifier for UMLAL_ARM64_FM_ADD_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UMLAL_ARM64_FM_ADD_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1515	/**<Variant identifier for UMLAL_ARM64_FM_ADD_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UMLSL2_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 1516	/**<Variant identifier for UMLSL2_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UMLSL2_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1517	/**<Variant identifier for UMLSL2_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UMLSL2_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 1518	/**<Variant identifier for UMLSL2_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UMLSL2_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1519	/**<Variant identifier for UMLSL2_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UMLSL2_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1520	/**<Variant identifier for UMLSL2_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UMLSL_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 1521	/**<Variant identifier for UMLSL_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UMLSL_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1522	/**<Variant identifier for UMLSL_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UMLSL_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 1523	/**<Variant identifier for UMLSL_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UMLSL_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1524	/**<Variant identifier for UMLSL_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UMLSL_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1525	/**<Variant identifier for UMLSL_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UMOV_ARM64_FM_MOV_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 1526	/**<Variant identifier for UMOV_ARM64_FM_MOV_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UMOV_ARM64_FM_MOV_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_8b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 1527	/**<Variant identifier for UMOV_ARM64_FM_MOV_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_8b_DATASZ_32b_OPRN_REGISTER_SWORD_OR_STACK_DATASZ_SWORD_WRITE_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UMSUBL_ARM64_FM_FMS_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ 1528	/**<Variant identifier for UMSUBL_ARM64_FM_FMS_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_SWORD_OR_ZERO_DATASZ_SWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_UMULH_ARM64_FM_MUL_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ 1529	/**<Variant identifier for UMULH_ARM64_FM_MUL_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_WRITE_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ_OPRN_REGISTER_DWORD_OR_ZERO_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_UMULL2_ARM64_FM_MUL_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 1530	/**<Variant identifier for UMULL2_ARM64_FM_MUL_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UMULL2_ARM64_FM_MUL_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1531	/**<Variant identifier for UMULL2_ARM64_FM_MUL_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UMULL2_ARM64_FM_MUL_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 1532	/**<Variant identifier for UMULL2_ARM64_FM_MUL_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UMULL2_ARM64_FM_MUL_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1533	/**<Variant identifier for UMULL2_ARM64_FM_MUL_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UMULL2_ARM64_FM_MUL_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1534	/**<Variant identifier for UMULL2_ARM64_FM_MUL_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UMULL_ARM64_FM_MUL_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 1535	/**<Variant identifier for UMULL_ARM64_FM_MUL_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UMULL_ARM64_FM_MUL_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1536	/**<Variant identifier for UMULL_ARM64_FM_MUL_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UMULL_ARM64_FM_MUL_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ 1537	/**<Variant identifier for UMULL_ARM64_FM_MUL_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_INDEXED_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UMULL_ARM64_FM_MUL_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1538	/**<Variant identifier for UMULL_ARM64_FM_MUL_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UMULL_ARM64_FM_MUL_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1539	/**<Variant identifier for UMULL_ARM64_FM_MUL_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UQADD_ARM64_FM_ADD_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ 1540	/**<Variant identifier for UQADD_ARM64_FM_ADD_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ*/
+#define arm64_VARIANTID_UQADD_ARM64_FM_ADD_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 1541	/**<Variant identifier for UQADD_ARM64_FM_ADD_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_UQADD_ARM64_FM_ADD_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 1542	/**<Variant identifier for UQADD_ARM64_FM_ADD_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_UQADD_ARM64_FM_ADD_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_WRITE_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_READ_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_READ 1543	/**<Variant identifier for UQADD_ARM64_FM_ADD_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_WRITE_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_READ_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_READ*/
+#define arm64_VARIANTID_UQADD_ARM64_FM_ADD_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1544	/**<Variant identifier for UQADD_ARM64_FM_ADD_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UQADD_ARM64_FM_ADD_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1545	/**<Variant identifier for UQADD_ARM64_FM_ADD_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UQRSHL_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ 1546	/**<Variant identifier for UQRSHL_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ*/
+#define arm64_VARIANTID_UQRSHL_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 1547	/**<Variant identifier for UQRSHL_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_UQRSHL_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 1548	/**<Variant identifier for UQRSHL_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_UQRSHL_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_WRITE_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_READ_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_READ 1549	/**<Variant identifier for UQRSHL_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_WRITE_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_READ_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_READ*/
+#define arm64_VARIANTID_UQRSHL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1550	/**<Variant identifier for UQRSHL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UQRSHL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1551	/**<Variant identifier for UQRSHL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UQRSHRN2_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ 1552	/**<Variant identifier for UQRSHRN2_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ*/
+#define arm64_VARIANTID_UQRSHRN2_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ 1553	/**<Variant identifier for UQRSHRN2_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ*/
+#define arm64_VARIANTID_UQRSHRN2_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ 1554	/**<Variant identifier for UQRSHRN2_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ*/
+#define arm64_VARIANTID_UQRSHRN_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ 1555	/**<Variant identifier for UQRSHRN_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ*/
+#define arm64_VARIANTID_UQRSHRN_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ 1556	/**<Variant identifier for UQRSHRN_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ*/
+#define arm64_VARIANTID_UQRSHRN_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ 1557	/**<Variant identifier for UQRSHRN_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ*/
+#define arm64_VARIANTID_UQRSHRN_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ 1558	/**<Variant identifier for UQRSHRN_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ*/
+#define arm64_VARIANTID_UQRSHRN_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ 1559	/**<Variant identifier for UQRSHRN_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ*/
+#define arm64_VARIANTID_UQRSHRN_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ 1560	/**<Variant identifier for UQRSHRN_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ*/
+#define arm64_VARIANTID_UQSHL_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ 1561	/**<Variant identifier for UQSHL_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ*/
+#define arm64_VARIANTID_UQSHL_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ 1562	/**<Variant identifier for UQSHL_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ*/
+#define arm64_VARIANTID_UQSHL_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ 1563	/**<Variant identifier for UQSHL_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ*/
+#define arm64_VARIANTID_UQSHL_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 1564	/**<Variant identifier for UQSHL_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_UQSHL_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ 1565	/**<Variant identifier for UQSHL_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ*/
+#define arm64_VARIANTID_UQSHL_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 1566	/**<Variant identifier for UQSHL_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_UQSHL_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_WRITE_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_READ_OPRN_IMMEDIATE_DATASZ_3b_READ 1567	/**<Variant identifier for UQSHL_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_WRITE_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_READ_OPRN_IMMEDIATE_DATASZ_3b_READ*/
+#define arm64_VARIANTID_UQSHL_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_WRITE_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_READ_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_READ 1568	/**<Variant identifier for UQSHL_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_WRITE_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_READ_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_READ*/
+#define arm64_VARIANTID_UQSHL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ 1569	/**<Variant identifier for UQSHL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ*/
+#define arm64_VARIANTID_UQSHL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ 1570	/**<Variant identifier for UQSHL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ*/
+#define arm64_VARIANTID_UQSHL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ 1571	/**<Variant identifier for UQSHL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ*/
+#define arm64_VARIANTID_UQSHL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1572	/**<Variant identifier for UQSHL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UQSHL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ 1573	/**<Variant identifier for UQSHL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ*/
+#define arm64_VARIANTID_UQSHL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1574	/**<Variant identifier for UQSHL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UQSHRN2_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ 1575	/**<Variant identifier for UQSHRN2_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ*/
+#define arm64_VARIANTID_UQSHRN2_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ 1576	/**<Variant identifier for UQSHRN2_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ*/
+#define arm64_VARIANTID_UQSHRN2_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ 1577	/**<Variant identifier for UQSHRN2_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ*/
+#define arm64_VARIANTID_UQSHRN_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ 1578	/**<Variant identifier for UQSHRN_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ*/
+#define arm64_VARIANTID_UQSHRN_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ 1579	/**<Variant identifier for UQSHRN_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ*/
+#define arm64_VARIANTID_UQSHRN_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ 1580	/**<Variant identifier for UQSHRN_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ*/
+#define arm64_VARIANTID_UQSHRN_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ 1581	/**<Variant identifier for UQSHRN_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ*/
+#define arm64_VARIANTID_UQSHRN_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ 1582	/**<Variant identifier for UQSHRN_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ*/
+#define arm64_VARIANTID_UQSHRN_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ 1583	/**<Variant identifier for UQSHRN_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ*/
+#define arm64_VARIANTID_UQSUB_ARM64_FM_SUB_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ 1584	/**<Variant identifier for UQSUB_ARM64_FM_SUB_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ*/
+#define arm64_VARIANTID_UQSUB_ARM64_FM_SUB_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 1585	/**<Variant identifier for UQSUB_ARM64_FM_SUB_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_UQSUB_ARM64_FM_SUB_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 1586	/**<Variant identifier for UQSUB_ARM64_FM_SUB_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_UQSUB_ARM64_FM_SUB_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_WRITE_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_READ_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_READ 1587	/**<Variant identifier for UQSUB_ARM64_FM_SUB_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_WRITE_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_READ_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_READ*/
+#define arm64_VARIANTID_UQSUB_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1588	/**<Variant identifier for UQSUB_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UQSUB_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1589	/**<Variant identifier for UQSUB_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UQXTN2_ARM64_FM_MOV_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1590	/**<Variant identifier for UQXTN2_ARM64_FM_MOV_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UQXTN2_ARM64_FM_MOV_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1591	/**<Variant identifier for UQXTN2_ARM64_FM_MOV_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UQXTN2_ARM64_FM_MOV_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1592	/**<Variant identifier for UQXTN2_ARM64_FM_MOV_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UQXTN_ARM64_FM_MOV_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ 1593	/**<Variant identifier for UQXTN_ARM64_FM_MOV_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ*/
+#define arm64_VARIANTID_UQXTN_ARM64_FM_MOV_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 1594	/**<Variant identifier for UQXTN_ARM64_FM_MOV_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_UQXTN_ARM64_FM_MOV_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 1595	/**<Variant identifier for UQXTN_ARM64_FM_MOV_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_UQXTN_ARM64_FM_MOV_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1596	/**<Variant identifier for UQXTN_ARM64_FM_MOV_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UQXTN_ARM64_FM_MOV_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1597	/**<Variant identifier for UQXTN_ARM64_FM_MOV_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UQXTN_ARM64_FM_MOV_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1598	/**<Variant identifier for UQXTN_ARM64_FM_MOV_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_URECPE_ARM64_FM_RCP_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1599	/**<Variant identifier for URECPE_ARM64_FM_RCP_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_URHADD_ARM64_FM_ADD_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1600	/**<Variant identifier for URHADD_ARM64_FM_ADD_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_URSHL_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 1601	/**<Variant identifier for URSHL_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_URSHL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1602	/**<Variant identifier for URSHL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_URSHL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1603	/**<Variant identifier for URSHL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_URSHR_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ 1604	/**<Variant identifier for URSHR_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ*/
+#define arm64_VARIANTID_URSHR_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ 1605	/**<Variant identifier for URSHR_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ*/
+#define arm64_VARIANTID_URSHR_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ 1606	/**<Variant identifier for URSHR_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ*/
+#define arm64_VARIANTID_URSHR_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ 1607	/**<Variant identifier for URSHR_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ*/
+#define arm64_VARIANTID_URSHR_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ 1608	/**<Variant identifier for URSHR_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ*/
+#define arm64_VARIANTID_URSQRTE_ARM64_FM_RCP_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1609	/**<Variant identifier for URSQRTE_ARM64_FM_RCP_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_URSRA_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ 1610	/**<Variant identifier for URSRA_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ*/
+#define arm64_VARIANTID_URSRA_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ 1611	/**<Variant identifier for URSRA_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ*/
+#define arm64_VARIANTID_URSRA_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ 1612	/**<Variant identifier for URSRA_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ*/
+#define arm64_VARIANTID_URSRA_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ 1613	/**<Variant identifier for URSRA_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ*/
+#define arm64_VARIANTID_URSRA_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ 1614	/**<Variant identifier for URSRA_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ*/
+#define arm64_VARIANTID_USHLL2_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ 1615	/**<Variant identifier for USHLL2_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ*/
+#define arm64_VARIANTID_USHLL2_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ 1616	/**<Variant identifier for USHLL2_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ*/
+#define arm64_VARIANTID_USHLL2_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ 1617	/**<Variant identifier for USHLL2_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ*/
+#define arm64_VARIANTID_USHLL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ 1618	/**<Variant identifier for USHLL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ*/
+#define arm64_VARIANTID_USHLL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ 1619	/**<Variant identifier for USHLL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ*/
+#define arm64_VARIANTID_USHLL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ 1620	/**<Variant identifier for USHLL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ*/
+#define arm64_VARIANTID_USHL_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 1621	/**<Variant identifier for USHL_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_USHL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1622	/**<Variant identifier for USHL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_USHL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1623	/**<Variant identifier for USHL_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_USHR_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ 1624	/**<Variant identifier for USHR_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ*/
+#define arm64_VARIANTID_USHR_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ 1625	/**<Variant identifier for USHR_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ*/
+#define arm64_VARIANTID_USHR_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ 1626	/**<Variant identifier for USHR_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ*/
+#define arm64_VARIANTID_USHR_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ 1627	/**<Variant identifier for USHR_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ*/
+#define arm64_VARIANTID_USHR_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ 1628	/**<Variant identifier for USHR_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ*/
+#define arm64_VARIANTID_USQADD_ARM64_FM_ADD_A_NA_S_SCALAR_T_SINT_T_UINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ 1629	/**<Variant identifier for USQADD_ARM64_FM_ADD_A_NA_S_SCALAR_T_SINT_T_UINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ_WRITE_OPRN_REGISTER_SIMD_SCALAR_HWORD_DATASZ_HWORD_READ*/
+#define arm64_VARIANTID_USQADD_ARM64_FM_ADD_A_NA_S_SCALAR_T_SINT_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ 1630	/**<Variant identifier for USQADD_ARM64_FM_ADD_A_NA_S_SCALAR_T_SINT_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ_WRITE_OPRN_REGISTER_SIMD_SCALAR_SWORD_DATASZ_SWORD_READ*/
+#define arm64_VARIANTID_USQADD_ARM64_FM_ADD_A_NA_S_SCALAR_T_SINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ 1631	/**<Variant identifier for USQADD_ARM64_FM_ADD_A_NA_S_SCALAR_T_SINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ*/
+#define arm64_VARIANTID_USQADD_ARM64_FM_ADD_A_NA_S_SCALAR_T_SINT_T_UINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_READ_WRITE_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_READ 1632	/**<Variant identifier for USQADD_ARM64_FM_ADD_A_NA_S_SCALAR_T_SINT_T_UINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_READ_WRITE_OPRN_REGISTER_SIMD_SCALAR_BYTE_DATASZ_BYTE_READ*/
+#define arm64_VARIANTID_USQADD_ARM64_FM_ADD_A_NA_S_SIMD_T_SINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1633	/**<Variant identifier for USQADD_ARM64_FM_ADD_A_NA_S_SIMD_T_SINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_USQADD_ARM64_FM_ADD_A_NA_S_SIMD_T_SINT_T_UINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1634	/**<Variant identifier for USQADD_ARM64_FM_ADD_A_NA_S_SIMD_T_SINT_T_UINT_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_USRA_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ 1635	/**<Variant identifier for USRA_ARM64_FM_SHIFT_A_NA_S_SCALAR_T_UINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_WRITE_OPRN_REGISTER_SIMD_SCALAR_DWORD_DATASZ_DWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ*/
+#define arm64_VARIANTID_USRA_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ 1636	/**<Variant identifier for USRA_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_4b_READ*/
+#define arm64_VARIANTID_USRA_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ 1637	/**<Variant identifier for USRA_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_5b_READ*/
+#define arm64_VARIANTID_USRA_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ 1638	/**<Variant identifier for USRA_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_6b_READ*/
+#define arm64_VARIANTID_USRA_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ 1639	/**<Variant identifier for USRA_ARM64_FM_SHIFT_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_8b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_IMMEDIATE_DATASZ_3b_READ*/
+#define arm64_VARIANTID_USUBL2_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1640	/**<Variant identifier for USUBL2_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_USUBL2_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1641	/**<Variant identifier for USUBL2_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_USUBL2_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1642	/**<Variant identifier for USUBL2_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_USUBL_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1643	/**<Variant identifier for USUBL_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_USUBL_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1644	/**<Variant identifier for USUBL_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_USUBL_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1645	/**<Variant identifier for USUBL_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_8b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_USUBW2_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1646	/**<Variant identifier for USUBW2_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_USUBW2_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1647	/**<Variant identifier for USUBW2_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_USUBW2_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1648	/**<Variant identifier for USUBW2_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_USUBW_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1649	/**<Variant identifier for USUBW_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_16b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_USUBW_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1650	/**<Variant identifier for USUBW_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_32b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_USUBW_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1651	/**<Variant identifier for USUBW_ARM64_FM_SUB_A_NA_S_SIMD_T_UINT_T_UINT_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UZP1_ARM64_FM_CRYPTO_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1652	/**<Variant identifier for UZP1_ARM64_FM_CRYPTO_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UZP1_ARM64_FM_CRYPTO_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1653	/**<Variant identifier for UZP1_ARM64_FM_CRYPTO_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UZP2_ARM64_FM_CRYPTO_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1654	/**<Variant identifier for UZP2_ARM64_FM_CRYPTO_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_UZP2_ARM64_FM_CRYPTO_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1655	/**<Variant identifier for UZP2_ARM64_FM_CRYPTO_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_XTN2_ARM64_FM_MOV_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1656	/**<Variant identifier for XTN2_ARM64_FM_MOV_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_XTN2_ARM64_FM_MOV_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1657	/**<Variant identifier for XTN2_ARM64_FM_MOV_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_XTN2_ARM64_FM_MOV_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1658	/**<Variant identifier for XTN2_ARM64_FM_MOV_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_XTN_ARM64_FM_MOV_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1659	/**<Variant identifier for XTN_ARM64_FM_MOV_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_16b_DATASZ_8b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_XTN_ARM64_FM_MOV_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1660	/**<Variant identifier for XTN_ARM64_FM_MOV_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_32b_DATASZ_16b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_XTN_ARM64_FM_MOV_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1661	/**<Variant identifier for XTN_ARM64_FM_MOV_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_32b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_ZIP1_ARM64_FM_CRYPTO_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1662	/**<Variant identifier for ZIP1_ARM64_FM_CRYPTO_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_ZIP1_ARM64_FM_CRYPTO_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1663	/**<Variant identifier for ZIP1_ARM64_FM_CRYPTO_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_ZIP2_ARM64_FM_CRYPTO_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1664	/**<Variant identifier for ZIP2_ARM64_FM_CRYPTO_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_64b_DATASZ_64b_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+#define arm64_VARIANTID_ZIP2_ARM64_FM_CRYPTO_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ 1665	/**<Variant identifier for ZIP2_ARM64_FM_CRYPTO_A_NA_S_SIMD_T_UNDEF_T_UNDEF_DATASZ_VAR_DATASZ_VAR_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_WRITE_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ_OPRN_REGISTER_SIMD_VECTOR_DATASZ_QWORD_READ*/
+extern arch_t arm64_arch;	/**<Structure describing the arm64 architecture*/
+#endif /*ARM64_ARCH_H_*/
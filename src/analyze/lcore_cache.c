@@ -0,0 +1,1084 @@
+/*
+   Copyright (C) 2004 - 2018 Université de Versailles Saint-Quentin-en-Yvelines (UVSQ)
+
+   This file is part of MAQAO.
+
+  MAQAO is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public License
+   as published by the Free Software Foundation; either version 3
+   of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+
+#include "libmcore.h"
+#include "version.h"
+
+/**
+ * \file
+ * \brief Saves and reloads the results of the flow, loop and connected
+ * components analyses of an asmfile.
+ *
+ * A cache file is named after the hash of the contents of the binary file and
+ * holds a header followed by flat arrays of fixed-size records. Pointers are
+ * replaced by indexes: instructions are numbered in the order of the asmfile
+ * instructions queue, functions, blocks and loops in the order of the queues
+ * they belong to. Variable length lists (blocks of a function, entries of a
+ * loop, ...) are ranges in a single array of indexes. The file is mapped in
+ * memory when it is loaded and structures are rebuilt directly from it.
+ *
+ * The header stores the hashes of the binary file, of the MAQAO version and of
+ * the settings changing the results of the analyses, as well as a fingerprint
+ * of the instructions. A cache file is only used if all of them match.
+ * */
+
+#define CACHE_MAGIC     "MAQAOLC"   /**<Identifies a cache file (8 bytes with the ending '\0')*/
+#define CACHE_FORMAT    1           /**<Version of the format of cache files*/
+#define CACHE_EXT       ".mlc"      /**<Extension of cache files*/
+#define CACHE_NONE      UINT32_MAX  /**<Index representing a NULL pointer or a NULL container*/
+#define CACHE_FLAGS     (CFG_ANALYZE | LOO_ANALYZE | COM_ANALYZE | EXT_ANALYZE) /**<Saved analyze flags*/
+
+#define CACHE_FCT_PLT   0x01        /**<The function belongs to the list of plt functions*/
+
+/**
+ * Rounds up a size to a multiple of 8 bytes (all sections start on 8 bytes boundaries)
+ */
+#define CACHE_ALIGN(X)  (((X) + 7) & ~((size_t) 7))
+
+/**
+ * \struct cache_range_s
+ * A range of elements in one of the arrays of a cache file
+ */
+typedef struct cache_range_s {
+   uint32_t start; /**<Index of the first element*/
+   uint32_t nb;    /**<Number of elements, or CACHE_NONE if the container is NULL*/
+} cache_range_t;
+
+/**
+ * \struct cache_hdr_s
+ * Header of a cache file
+ */
+typedef struct cache_hdr_s {
+   char magic[8];          /**<CACHE_MAGIC*/
+   uint32_t format;        /**<CACHE_FORMAT*/
+   uint32_t hdr_size;      /**<Size of this structure*/
+   uint64_t version_hash;  /**<Hash of the MAQAO version and build information*/
+   uint64_t content_hash;  /**<Hash of the contents of the binary file*/
+   uint64_t content_size;  /**<Size of the binary file*/
+   uint64_t settings_hash; /**<Hash of the settings used by the analyses*/
+   uint64_t insns_hash;    /**<Hash of the addresses of the instructions*/
+   uint32_t analyze_flag;  /**<Analyses whose results are saved*/
+   uint32_t nb_insns;      /**<Number of instructions*/
+   uint32_t nb_fcts;       /**<Number of functions*/
+   uint32_t nb_blocks;     /**<Number of blocks*/
+   uint32_t nb_edges;      /**<Number of CFG and CG edges*/
+   uint32_t nb_loops;      /**<Number of loops*/
+   uint32_t nb_ccs;        /**<Number of connected components*/
+   uint32_t nb_refs;       /**<Number of indexes in the references array*/
+   uint32_t strings_size;  /**<Size in bytes of the strings table*/
+   int32_t maxid_fct;      /**<Value of asmfile maxid_fct*/
+   int32_t maxid_block;    /**<Value of asmfile maxid_block*/
+   int32_t maxid_loop;     /**<Value of asmfile maxid_loop*/
+   uint32_t n_blocks;      /**<Value of asmfile n_blocks*/
+   uint32_t n_loops;       /**<Value of asmfile n_loops*/
+} cache_hdr_t;
+
+/**
+ * \struct cache_fct_s
+ * Function record
+ */
+typedef struct cache_fct_s {
+   uint64_t dbg_addr;            /**<Debug address*/
+   uint32_t global_id;           /**<Global identifier*/
+   uint32_t id;                  /**<Local identifier*/
+   uint32_t name;                /**<Offset of the name of the function label in the strings table*/
+   uint32_t demname;             /**<Offset of the demangled name in the strings table or CACHE_NONE*/
+   uint32_t first_insn;          /**<Index of the first instruction*/
+   uint32_t original;            /**<Index of the original function for extracted functions, else CACHE_NONE*/
+   uint32_t flags;               /**<Mask of CACHE_FCT_* flags*/
+   uint32_t reserved;            /**<Unused*/
+   cache_range_t blocks;         /**<Blocks (references)*/
+   cache_range_t padding_blocks; /**<Padding blocks (references)*/
+   cache_range_t entries;        /**<Entry blocks (references)*/
+   cache_range_t loops;          /**<Loops (references)*/
+   cache_range_t components;     /**<Connected components (in the components array)*/
+   cache_range_t cg_out;         /**<Outgoing CG edges (in the edges array)*/
+   cache_range_t cg_in;          /**<Incoming CG edges (references)*/
+} cache_fct_t;
+
+/**
+ * \struct cache_block_s
+ * Block record
+ */
+typedef struct cache_block_s {
+   uint32_t global_id;  /**<Global identifier*/
+   uint32_t id;         /**<Local identifier*/
+   uint32_t fct;        /**<Index of the function*/
+   uint32_t first_insn; /**<Index of the first instruction or CACHE_NONE for virtual blocks*/
+   uint32_t last_insn;  /**<Index of the last instruction or CACHE_NONE for virtual blocks*/
+   uint32_t loop;       /**<Index of the loop or CACHE_NONE*/
+   int32_t is_loop_exit;/**<Value of is_loop_exit*/
+   int32_t is_padding;  /**<Value of is_padding*/
+   cache_range_t out;   /**<Outgoing CFG edges (in the edges array)*/
+   cache_range_t in;    /**<Incoming CFG edges (references)*/
+} cache_block_t;
+
+/**
+ * \struct cache_edge_s
+ * Edge record (CFG or CG)
+ */
+typedef struct cache_edge_s {
+   uint32_t from; /**<Index of the source block or function*/
+   uint32_t to;   /**<Index of the destination block or function*/
+   uint32_t data; /**<Index of the instruction associated to the edge or CACHE_NONE*/
+} cache_edge_t;
+
+/**
+ * \struct cache_loop_s
+ * Loop record
+ */
+typedef struct cache_loop_s {
+   uint32_t global_id;     /**<Global identifier*/
+   uint32_t id;            /**<Local identifier*/
+   uint32_t fct;           /**<Index of the function*/
+   uint32_t reserved;      /**<Unused*/
+   cache_range_t children; /**<Children in the loops hierarchy (references)*/
+   cache_range_t entries;  /**<Entry blocks (references)*/
+   cache_range_t exits;    /**<Exit blocks (references)*/
+   cache_range_t blocks;   /**<Blocks (references)*/
+} cache_loop_t;
+
+/**
+ * \struct cache_file_s
+ * Sections of a cache file
+ */
+typedef struct cache_file_s {
+   cache_hdr_t* hdr;         /**<Header*/
+   uint32_t* annotates;      /**<Annotations of instructions*/
+   uint32_t* insn_blocks;    /**<Index of the block of each instruction or CACHE_NONE*/
+   cache_fct_t* fcts;        /**<Functions*/
+   cache_block_t* blocks;    /**<Blocks*/
+   cache_edge_t* edges;      /**<Edges*/
+   cache_loop_t* loops;      /**<Loops*/
+   cache_range_t* ccs;       /**<Connected components (ranges of references to blocks)*/
+   uint32_t* refs;           /**<References*/
+   char* strings;            /**<Strings table*/
+} cache_file_t;
+
+/**
+ * \struct cache_ctxt_s
+ * Data used while building a cache file from an asmfile
+ */
+typedef struct cache_ctxt_s {
+   hashmap_t* insns;     /**<Index + 1 of each instruction*/
+   hashmap_t* fcts;      /**<Index + 1 of each function*/
+   hashmap_t* blocks;    /**<Index + 1 of each block*/
+   hashmap_t* loops;     /**<Index + 1 of each loop*/
+   hashmap_t* edges;     /**<Index + 1 of each edge*/
+   uint32_t* refs;       /**<References*/
+   uint32_t nb_refs;     /**<Number of references*/
+   uint32_t max_refs;    /**<Size of the refs array*/
+   char* strings;        /**<Strings table*/
+   uint32_t strings_size;/**<Size of the strings table*/
+   uint32_t max_strings; /**<Size of the strings array*/
+   int error;            /**<Set when a pointer can not be converted into an index*/
+} cache_ctxt_t;
+
+///////////////////////////////////////////////////////////////////////////////
+//                             Cache identification                          //
+///////////////////////////////////////////////////////////////////////////////
+/**
+ * Fills the fields of a header identifying the binary file, the MAQAO
+ * version and the analysis settings
+ * \param asmfile an asmfile
+ * \param hdr the header to fill
+ * \return EXIT_SUCCESS or an error code if the binary file can not be read
+ */
+static int _cache_hdr_init(asmfile_t* asmfile, cache_hdr_t* hdr)
+{
+   const char* version = MAQAO_VERSION "::" MAQAO_BUILD;
+   uint64_t h;
+
+   memset(hdr, 0, sizeof(*hdr));
+   memcpy(hdr->magic, CACHE_MAGIC, sizeof(hdr->magic));
+   hdr->format = CACHE_FORMAT;
+   hdr->hdr_size = sizeof(*hdr);
+   hdr->version_hash = add_data_hash(FILE_HASH_INIT, version, strlen(version));
+   hdr->content_hash = file_content_hash(asmfile_get_name(asmfile),
+         &hdr->content_size);
+   if (hdr->content_hash == 0)
+      return ERR_COMMON_UNABLE_TO_READ_FILE;
+
+   // Settings used by the flow analysis and the functions extraction
+   project_t* project = asmfile_get_project(asmfile);
+   char settings[4];
+   settings[0] = arch_get_code(asmfile_get_arch(asmfile));
+   settings[1] = (project != NULL) ? project_get_cc_mode(project) : CCMODE_OFF;
+   settings[2] = (asmfile_get_parameter(asmfile, PARAM_MODULE_LCORE,
+         PARAM_LCORE_FLOW_ANALYZE_ALL_SCNS) != NULL);
+   settings[3] = (asmfile->debug != NULL && asmfile->debug->format != DBG_NONE);
+   h = add_data_hash(FILE_HASH_INIT, settings, sizeof(settings));
+   char** exit_fcts = (project != NULL) ? project_get_exit_fcts(project) : NULL;
+   if (exit_fcts != NULL) {
+      int i;
+      for (i = 0; exit_fcts[i] != NULL; i++)
+         h = add_data_hash(h, exit_fcts[i], strlen(exit_fcts[i]) + 1);
+   }
+   hdr->settings_hash = h;
+
+   // Fingerprint of the disassembled instructions
+   h = FILE_HASH_INIT;
+   FOREACH_INQUEUE(asmfile_get_insns(asmfile), it) {
+      maddr_t addr = INSN_GET_ADDR(GET_DATA_T(insn_t*, it));
+      h = add_data_hash(h, &addr, sizeof(addr));
+   }
+   hdr->insns_hash = h;
+   hdr->nb_insns = queue_length(asmfile_get_insns(asmfile));
+
+   return EXIT_SUCCESS;
+}
+
+/**
+ * Builds the path of the cache file of a binary file
+ * \param dir directory containing cache files
+ * \param hdr header initialized by _cache_hdr_init
+ * \return a string to free with lc_free
+ */
+static char* _cache_get_path(char* dir, cache_hdr_t* hdr)
+{
+   size_t len = strlen(dir) + 1 + 16 + strlen(CACHE_EXT) + 1;
+   char* path = lc_malloc(len);
+   snprintf(path, len, "%s/%016"PRIx64"%s", dir, hdr->content_hash, CACHE_EXT);
+   return path;
+}
+
+/**
+ * Computes the position of each section of a cache file
+ * \param base address of the header
+ * \param file structure to fill
+ * \return total size of the cache file
+ */
+static size_t _cache_file_map(void* base, cache_file_t* file)
+{
+   cache_hdr_t* hdr = base;
+   size_t offset = CACHE_ALIGN(sizeof(cache_hdr_t));
+
+#define CACHE_SECTION(F, N) \
+   file->F = (void*) ((char*) base + offset); \
+   offset += CACHE_ALIGN((size_t) (N) * sizeof(*file->F));
+
+   file->hdr = hdr;
+   CACHE_SECTION(annotates, hdr->nb_insns)
+   CACHE_SECTION(insn_blocks, hdr->nb_insns)
+   CACHE_SECTION(fcts, hdr->nb_fcts)
+   CACHE_SECTION(blocks, hdr->nb_blocks)
+   CACHE_SECTION(edges, hdr->nb_edges)
+   CACHE_SECTION(loops, hdr->nb_loops)
+   CACHE_SECTION(ccs, hdr->nb_ccs)
+   CACHE_SECTION(refs, hdr->nb_refs)
+   CACHE_SECTION(strings, hdr->strings_size)
+#undef CACHE_SECTION
+
+   return offset;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+//                                Saving                                     //
+///////////////////////////////////////////////////////////////////////////////
+/**
+ * Returns the index of an object
+ * \param ctxt saving context
+ * \param m hashmap containing the indexes of objects
+ * \param p an object
+ * \return index of p or CACHE_NONE if p is NULL. If p has no index,
+ * ctxt->error is set
+ */
+static uint32_t _index_of(cache_ctxt_t* ctxt, hashmap_t* m, void* p)
+{
+   if (p == NULL)
+      return CACHE_NONE;
+   void* idx = hashmap_lookup(m, p);
+   if (idx == NULL) {
+      ctxt->error = ERR_ANALYZE_CACHE_UNSUPPORTED;
+      return CACHE_NONE;
+   }
+   return (uint32_t) ((size_t) idx - 1);
+}
+
+/**
+ * Appends a reference
+ * \param ctxt saving context
+ * \param ref reference to append
+ */
+static void _ref_add(cache_ctxt_t* ctxt, uint32_t ref)
+{
+   if (ctxt->nb_refs == ctxt->max_refs) {
+      ctxt->max_refs = (ctxt->max_refs == 0) ? 1024 : ctxt->max_refs * 2;
+      ctxt->refs = lc_realloc(ctxt->refs, ctxt->max_refs * sizeof(uint32_t));
+   }
+   ctxt->refs[ctxt->nb_refs++] = ref;
+}
+
+/**
+ * Appends the indexes of the elements of a queue to the references
+ * \param ctxt saving context
+ * \param q a queue (can be NULL)
+ * \param m hashmap containing the indexes of the queue elements
+ * \return range of the references
+ */
+static cache_range_t _refs_from_queue(cache_ctxt_t* ctxt, queue_t* q,
+      hashmap_t* m)
+{
+   cache_range_t r = { ctxt->nb_refs, CACHE_NONE };
+   if (q == NULL)
+      return r;
+   r.nb = 0;
+   FOREACH_INQUEUE(q, it) {
+      _ref_add(ctxt, _index_of(ctxt, m, GET_DATA_T(void*, it)));
+      r.nb++;
+   }
+   return r;
+}
+
+/**
+ * Appends the indexes of the elements of a list to the references
+ * \param ctxt saving context
+ * \param l a list
+ * \param m hashmap containing the indexes of the list elements
+ * \return range of the references
+ */
+static cache_range_t _refs_from_list(cache_ctxt_t* ctxt, list_t* l,
+      hashmap_t* m)
+{
+   cache_range_t r = { ctxt->nb_refs, 0 };
+   FOREACH_INLIST(l, it) {
+      _ref_add(ctxt, _index_of(ctxt, m, GET_DATA_T(void*, it)));
+      r.nb++;
+   }
+   return r;
+}
+
+/**
+ * Adds a string to the strings table
+ * \param ctxt saving context
+ * \param s a string
+ * \return offset of the string or CACHE_NONE if s is NULL
+ */
+static uint32_t _string_add(cache_ctxt_t* ctxt, const char* s)
+{
+   if (s == NULL)
+      return CACHE_NONE;
+   uint32_t len = strlen(s) + 1;
+   uint32_t offset = ctxt->strings_size;
+
+   if (ctxt->strings_size + len > ctxt->max_strings) {
+      while (ctxt->strings_size + len > ctxt->max_strings)
+         ctxt->max_strings = (ctxt->max_strings == 0) ? 4096 : ctxt->max_strings * 2;
+      ctxt->strings = lc_realloc(ctxt->strings, ctxt->max_strings);
+   }
+   memcpy(ctxt->strings + offset, s, len);
+   ctxt->strings_size += len;
+   return offset;
+}
+
+/**
+ * Writes a section of a cache file, padded to 8 bytes
+ * \param stream output stream
+ * \param data section content
+ * \param size section size in bytes
+ * \return TRUE if the section was written
+ */
+static int _cache_write(FILE* stream, const void* data, size_t size)
+{
+   static const char padding[8] = { 0 };
+   if (size > 0 && fwrite(data, 1, size, stream) != size)
+      return FALSE;
+   size_t pad = CACHE_ALIGN(size) - size;
+   return (pad == 0 || fwrite(padding, 1, pad, stream) == pad);
+}
+
+/*
+ * Saves the results of the flow, loop and connected components analyses of an
+ * asmfile in a cache file named after the hash of the binary file
+ * \param asmfile an asmfile whose flow has been analyzed
+ * \param dir directory containing cache files (created if needed)
+ * \return EXIT_SUCCESS or an error code
+ */
+int lcore_cache_save(asmfile_t* asmfile, char* dir)
+{
+   if (asmfile == NULL)
+      return ERR_LIBASM_MISSING_ASMFILE;
+   if (dir == NULL)
+      return ERR_COMMON_FILE_NAME_MISSING;
+   if ((asmfile->analyze_flag & CFG_ANALYZE) == 0)
+      return ERR_ANALYZE_CACHE_UNSUPPORTED;
+
+   cache_hdr_t hdr;
+   int res = _cache_hdr_init(asmfile, &hdr);
+   if (res != EXIT_SUCCESS)
+      return res;
+
+   cache_ctxt_t ctxt;
+   memset(&ctxt, 0, sizeof(ctxt));
+   ctxt.insns = hashmap_new(hdr.nb_insns);
+   ctxt.fcts = hashmap_new(0);
+   ctxt.blocks = hashmap_new(asmfile->n_blocks);
+   ctxt.loops = hashmap_new(0);
+   ctxt.edges = hashmap_new(0);
+
+   // Numbers all objects --------------------------------------------------
+   uint32_t i = 0;
+   FOREACH_INQUEUE(asmfile_get_insns(asmfile), it_in)
+      hashmap_insert(ctxt.insns, GET_DATA_T(void*, it_in), (void*) (size_t) ++i);
+
+   queue_t* fcts = queue_new();
+   FOREACH_INQUEUE(asmfile->functions, it_f)
+      queue_add_tail(fcts, GET_DATA_T(fct_t*, it_f));
+   FOREACH_INLIST(asmfile->plt_fct, it_p)
+      queue_add_tail(fcts, GET_DATA_T(fct_t*, it_p));
+
+   uint32_t nb_fcts = 0, nb_blocks = 0, nb_loops = 0, nb_edges = 0, nb_ccs = 0;
+   FOREACH_INQUEUE(fcts, it_f1) {
+      fct_t* f = GET_DATA_T(fct_t*, it_f1);
+      hashmap_insert(ctxt.fcts, f, (void*) (size_t) ++nb_fcts);
+      nb_edges += list_length(f->cg_node->out);
+      if (f->components != NULL)
+         nb_ccs += queue_length(f->components);
+      // Analyses run later fill these fields: they must still be empty
+      if (queue_length(f->exits) > 0 || queue_length(f->ranges) > 0
+            || f->paths != NULL || f->ssa != NULL)
+         ctxt.error = ERR_ANALYZE_CACHE_UNSUPPORTED;
+      FOREACH_INQUEUE(f->blocks, it_b) {
+         block_t* b = GET_DATA_T(block_t*, it_b);
+         if (hashmap_lookup(ctxt.blocks, b) != NULL || b->function != f)
+            ctxt.error = ERR_ANALYZE_CACHE_UNSUPPORTED;
+         hashmap_insert(ctxt.blocks, b, (void*) (size_t) ++nb_blocks);
+         nb_edges += list_length(b->cfg_node->out);
+      }
+      FOREACH_INQUEUE(f->loops, it_l)
+         hashmap_insert(ctxt.loops, GET_DATA_T(loop_t*, it_l),
+               (void*) (size_t) ++nb_loops);
+   }
+
+   cache_fct_t* cfcts = lc_malloc0(nb_fcts * sizeof(*cfcts));
+   cache_block_t* cblocks = lc_malloc0(nb_blocks * sizeof(*cblocks));
+   cache_loop_t* cloops = lc_malloc0(nb_loops * sizeof(*cloops));
+   cache_edge_t* cedges = lc_malloc0(nb_edges * sizeof(*cedges));
+   cache_range_t* cccs = lc_malloc0(nb_ccs * sizeof(*cccs));
+   uint32_t* annotates = lc_malloc0(hdr.nb_insns * sizeof(uint32_t));
+   uint32_t* insn_blocks = lc_malloc0(hdr.nb_insns * sizeof(uint32_t));
+
+   // Edges are numbered in the order of the outgoing lists, so that each
+   // outgoing list is a range of the edges array ----------------------------
+   uint32_t e = 0, cc = 0;
+   i = 0;
+   FOREACH_INQUEUE(fcts, it_f2) {
+      fct_t* f = GET_DATA_T(fct_t*, it_f2);
+      FOREACH_INQUEUE(f->blocks, it_b) {
+         block_t* b = GET_DATA_T(block_t*, it_b);
+         cache_block_t* cb = &cblocks[i++];
+         cb->out.start = e;
+         FOREACH_INLIST(b->cfg_node->out, it_e) {
+            graph_edge_t* ed = GET_DATA_T(graph_edge_t*, it_e);
+            hashmap_insert(ctxt.edges, ed, (void*) (size_t) (e + 1));
+            cedges[e].from = _index_of(&ctxt, ctxt.blocks, ed->from->data);
+            cedges[e].to = _index_of(&ctxt, ctxt.blocks, ed->to->data);
+            cedges[e].data = _index_of(&ctxt, ctxt.insns, ed->data);
+            e++;
+         }
+         cb->out.nb = e - cb->out.start;
+      }
+   }
+   i = 0;
+   FOREACH_INQUEUE(fcts, it_f3) {
+      fct_t* f = GET_DATA_T(fct_t*, it_f3);
+      cache_fct_t* cf = &cfcts[i++];
+      cf->cg_out.start = e;
+      FOREACH_INLIST(f->cg_node->out, it_e) {
+         graph_edge_t* ed = GET_DATA_T(graph_edge_t*, it_e);
+         hashmap_insert(ctxt.edges, ed, (void*) (size_t) (e + 1));
+         cedges[e].from = _index_of(&ctxt, ctxt.fcts, ed->from->data);
+         cedges[e].to = _index_of(&ctxt, ctxt.fcts, ed->to->data);
+         cedges[e].data = _index_of(&ctxt, ctxt.insns, ed->data);
+         e++;
+      }
+      cf->cg_out.nb = e - cf->cg_out.start;
+   }
+
+   // Records --------------------------------------------------------------
+   uint32_t ib = 0, il = 0;
+   i = 0;
+   FOREACH_INQUEUE(fcts, it_f4) {
+      fct_t* f = GET_DATA_T(fct_t*, it_f4);
+      cache_fct_t* cf = &cfcts[i];
+      label_t* lbl = f->namelbl;
+
+      cf->dbg_addr = f->dbg_addr;
+      cf->global_id = f->global_id;
+      cf->id = f->id;
+      cf->name = _string_add(&ctxt, label_get_name(lbl));
+      cf->demname = _string_add(&ctxt, f->demname);
+      cf->first_insn = _index_of(&ctxt, ctxt.insns, f->first_insn);
+      cf->original = _index_of(&ctxt, ctxt.fcts, f->original_function);
+      cf->flags = (i >= (uint32_t) queue_length(asmfile->functions)) ? CACHE_FCT_PLT : 0;
+      // Labels of functions found by the flow analysis are those of their
+      // first instruction. Labels of extracted functions are created again
+      if (lbl == NULL || cf->first_insn == CACHE_NONE
+            || (f->original_function == NULL && lbl != insn_get_fctlbl(f->first_insn)))
+         ctxt.error = ERR_ANALYZE_CACHE_UNSUPPORTED;
+
+      cf->blocks = _refs_from_queue(&ctxt, f->blocks, ctxt.blocks);
+      cf->padding_blocks = _refs_from_queue(&ctxt, f->padding_blocks, ctxt.blocks);
+      cf->entries = _refs_from_queue(&ctxt, f->entries, ctxt.blocks);
+      cf->loops = _refs_from_queue(&ctxt, f->loops, ctxt.loops);
+      cf->cg_in = _refs_from_list(&ctxt, f->cg_node->in, ctxt.edges);
+      cf->components.start = cc;
+      cf->components.nb = CACHE_NONE;
+      if (f->components != NULL) {
+         FOREACH_INQUEUE(f->components, it_cc) {
+            cccs[cc++] = _refs_from_queue(&ctxt, GET_DATA_T(queue_t*, it_cc),
+                  ctxt.blocks);
+         }
+         cf->components.nb = cc - cf->components.start;
+      }
+
+      FOREACH_INQUEUE(f->blocks, it_b) {
+         block_t* b = GET_DATA_T(block_t*, it_b);
+         cache_block_t* cb = &cblocks[ib++];
+         cb->global_id = b->global_id;
+         cb->id = b->id;
+         cb->fct = i;
+         cb->first_insn = (b->begin_sequence != NULL) ?
+               _index_of(&ctxt, ctxt.insns, b->begin_sequence->data) : CACHE_NONE;
+         cb->last_insn = (b->end_sequence != NULL) ?
+               _index_of(&ctxt, ctxt.insns, b->end_sequence->data) : CACHE_NONE;
+         cb->loop = _index_of(&ctxt, ctxt.loops, b->loop);
+         cb->is_loop_exit = b->is_loop_exit;
+         cb->is_padding = b->is_padding;
+         cb->in = _refs_from_list(&ctxt, b->cfg_node->in, ctxt.edges);
+      }
+
+      FOREACH_INQUEUE(f->loops, it_l) {
+         loop_t* l = GET_DATA_T(loop_t*, it_l);
+         cache_loop_t* cl = &cloops[il++];
+         cl->global_id = l->global_id;
+         cl->id = l->id;
+         cl->fct = i;
+         cl->children.start = ctxt.nb_refs;
+         cl->children.nb = 0;
+         tree_t* child;
+         for (child = l->hierarchy_node->children; child != NULL; child = child->next) {
+            _ref_add(&ctxt, _index_of(&ctxt, ctxt.loops, child->data));
+            cl->children.nb++;
+         }
+         cl->entries = _refs_from_list(&ctxt, l->entries, ctxt.blocks);
+         cl->exits = _refs_from_list(&ctxt, l->exits, ctxt.blocks);
+         cl->blocks = _refs_from_queue(&ctxt, l->blocks, ctxt.blocks);
+      }
+      i++;
+   }
+
+   i = 0;
+   FOREACH_INQUEUE(asmfile_get_insns(asmfile), it_in1) {
+      insn_t* in = GET_DATA_T(insn_t*, it_in1);
+      annotates[i] = in->annotate;
+      insn_blocks[i] = _index_of(&ctxt, ctxt.blocks, in->block);
+      i++;
+   }
+
+   hdr.analyze_flag = asmfile->analyze_flag & CACHE_FLAGS;
+   hdr.nb_fcts = nb_fcts;
+   hdr.nb_blocks = nb_blocks;
+   hdr.nb_edges = nb_edges;
+   hdr.nb_loops = nb_loops;
+   hdr.nb_ccs = nb_ccs;
+   hdr.nb_refs = ctxt.nb_refs;
+   hdr.strings_size = ctxt.strings_size;
+   hdr.maxid_fct = asmfile->maxid_fct;
+   hdr.maxid_block = asmfile->maxid_block;
+   hdr.maxid_loop = asmfile->maxid_loop;
+   hdr.n_blocks = asmfile->n_blocks;
+   hdr.n_loops = asmfile->n_loops;
+
+   // Writing --------------------------------------------------------------
+   // The file is written under a temporary name then renamed, so that
+   // concurrent analyses of the same file never read a partial cache file
+   res = ctxt.error;
+   if (res == EXIT_SUCCESS) {
+      char* path = _cache_get_path(dir, &hdr);
+      size_t tmplen = strlen(path) + 32;
+      char* tmppath = lc_malloc(tmplen);
+      snprintf(tmppath, tmplen, "%s.%d.tmp", path, (int) getpid());
+
+      // createDir only creates the components followed by a '/' in the path
+      if (dirExist(dir) == FALSE)
+         createDir(path, 0755);
+      FILE* stream = fopen(tmppath, "wb");
+      if (stream == NULL)
+         res = ERR_COMMON_UNABLE_TO_OPEN_FILE;
+      else {
+         int ok = _cache_write(stream, &hdr, sizeof(hdr))
+               && _cache_write(stream, annotates, hdr.nb_insns * sizeof(uint32_t))
+               && _cache_write(stream, insn_blocks, hdr.nb_insns * sizeof(uint32_t))
+               && _cache_write(stream, cfcts, nb_fcts * sizeof(*cfcts))
+               && _cache_write(stream, cblocks, nb_blocks * sizeof(*cblocks))
+               && _cache_write(stream, cedges, nb_edges * sizeof(*cedges))
+               && _cache_write(stream, cloops, nb_loops * sizeof(*cloops))
+               && _cache_write(stream, cccs, nb_ccs * sizeof(*cccs))
+               && _cache_write(stream, ctxt.refs, ctxt.nb_refs * sizeof(uint32_t))
+               && _cache_write(stream, ctxt.strings, ctxt.strings_size);
+         if (fclose(stream) != 0)
+            ok = FALSE;
+         if (!ok || rename(tmppath, path) != 0) {
+            remove(tmppath);
+            res = ERR_COMMON_UNABLE_TO_OPEN_FILE;
+         }
+      }
+      DBGMSG("Analysis results of %s saved in %s\n", asmfile_get_name(asmfile), path);
+      lc_free(tmppath);
+      lc_free(path);
+   }
+
+   queue_free(fcts, NULL);
+   hashmap_free(ctxt.insns, NULL, NULL);
+   hashmap_free(ctxt.fcts, NULL, NULL);
+   hashmap_free(ctxt.blocks, NULL, NULL);
+   hashmap_free(ctxt.loops, NULL, NULL);
+   hashmap_free(ctxt.edges, NULL, NULL);
+   lc_free(ctxt.refs);
+   lc_free(ctxt.strings);
+   lc_free(cfcts);
+   lc_free(cblocks);
+   lc_free(cloops);
+   lc_free(cedges);
+   lc_free(cccs);
+   lc_free(annotates);
+   lc_free(insn_blocks);
+
+   return res;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+//                                Loading                                    //
+///////////////////////////////////////////////////////////////////////////////
+/**
+ * Checks that a range is included in an array
+ * \param r a range
+ * \param size number of elements in the array
+ * \param allow_null TRUE if the range can represent a NULL container
+ * \return TRUE if the range is valid
+ */
+static int _range_ok(cache_range_t r, uint32_t size, int allow_null)
+{
+   if (r.nb == CACHE_NONE)
+      return allow_null;
+   return (r.start <= size && r.nb <= size - r.start);
+}
+
+/**
+ * Checks that a range of references is valid
+ * \param file a cache file
+ * \param r a range of references
+ * \param max upper bound for the references
+ * \param allow_null TRUE if the range can represent a NULL container
+ * \return TRUE if the range and the references are valid
+ */
+static int _refs_ok(cache_file_t* file, cache_range_t r, uint32_t max,
+      int allow_null)
+{
+   if (!_range_ok(r, file->hdr->nb_refs, allow_null))
+      return FALSE;
+   if (r.nb == CACHE_NONE)
+      return TRUE;
+   uint32_t i;
+   for (i = r.start; i < r.start + r.nb; i++)
+      if (file->refs[i] >= max)
+         return FALSE;
+   return TRUE;
+}
+
+/**
+ * Checks that an index is valid
+ * \param idx an index
+ * \param max upper bound
+ * \return TRUE if idx is CACHE_NONE or lower than max
+ */
+static int _idx_ok(uint32_t idx, uint32_t max)
+{
+   return (idx == CACHE_NONE || idx < max);
+}
+
+/**
+ * Checks that all indexes of a cache file are in bounds and that the labels of
+ * functions match the instructions, before any structure is built
+ * \param file a cache file
+ * \param insns array of instructions of the asmfile
+ * \return TRUE if the file can be loaded
+ */
+static int _cache_file_check(cache_file_t* file, insn_t** insns)
+{
+   cache_hdr_t* hdr = file->hdr;
+   uint32_t i, j;
+
+   if (hdr->strings_size > 0 && file->strings[hdr->strings_size - 1] != '\0')
+      return FALSE;
+   for (i = 0; i < hdr->nb_insns; i++)
+      if (!_idx_ok(file->insn_blocks[i], hdr->nb_blocks))
+         return FALSE;
+
+   for (i = 0; i < hdr->nb_fcts; i++) {
+      cache_fct_t* cf = &file->fcts[i];
+      if (cf->name >= hdr->strings_size || cf->first_insn >= hdr->nb_insns
+            || !_idx_ok(cf->demname, hdr->strings_size)
+            || !_idx_ok(cf->original, hdr->nb_fcts)
+            || !_refs_ok(file, cf->blocks, hdr->nb_blocks, FALSE)
+            || !_refs_ok(file, cf->padding_blocks, hdr->nb_blocks, TRUE)
+            || !_refs_ok(file, cf->entries, hdr->nb_blocks, FALSE)
+            || !_refs_ok(file, cf->loops, hdr->nb_loops, FALSE)
+            || !_refs_ok(file, cf->cg_in, hdr->nb_edges, FALSE)
+            || !_range_ok(cf->components, hdr->nb_ccs, TRUE)
+            || !_range_ok(cf->cg_out, hdr->nb_edges, FALSE))
+         return FALSE;
+      if (cf->original == CACHE_NONE) {
+         label_t* lbl = insn_get_fctlbl(insns[cf->first_insn]);
+         if (lbl == NULL || label_get_name(lbl) == NULL
+               || strcmp(label_get_name(lbl), file->strings + cf->name) != 0)
+            return FALSE;
+      }
+      if (cf->components.nb != CACHE_NONE) {
+         for (j = cf->components.start; j < cf->components.start + cf->components.nb; j++)
+            if (!_refs_ok(file, file->ccs[j], hdr->nb_blocks, FALSE))
+               return FALSE;
+      }
+      for (j = cf->cg_out.start; j < cf->cg_out.start + cf->cg_out.nb; j++)
+         if (file->edges[j].from != i || file->edges[j].to >= hdr->nb_fcts
+               || !_idx_ok(file->edges[j].data, hdr->nb_insns))
+            return FALSE;
+   }
+
+   for (i = 0; i < hdr->nb_blocks; i++) {
+      cache_block_t* cb = &file->blocks[i];
+      if (cb->fct >= hdr->nb_fcts
+            || !_idx_ok(cb->first_insn, hdr->nb_insns)
+            || !_idx_ok(cb->last_insn, hdr->nb_insns)
+            || !_idx_ok(cb->loop, hdr->nb_loops)
+            || !_range_ok(cb->out, hdr->nb_edges, FALSE)
+            || !_refs_ok(file, cb->in, hdr->nb_edges, FALSE))
+         return FALSE;
+      for (j = cb->out.start; j < cb->out.start + cb->out.nb; j++)
+         if (file->edges[j].from != i || file->edges[j].to >= hdr->nb_blocks
+               || !_idx_ok(file->edges[j].data, hdr->nb_insns))
+            return FALSE;
+   }
+
+   for (i = 0; i < hdr->nb_loops; i++) {
+      cache_loop_t* cl = &file->loops[i];
+      if (cl->fct >= hdr->nb_fcts
+            || !_refs_ok(file, cl->children, hdr->nb_loops, FALSE)
+            || !_refs_ok(file, cl->entries, hdr->nb_blocks, FALSE)
+            || !_refs_ok(file, cl->exits, hdr->nb_blocks, FALSE)
+            || !_refs_ok(file, cl->blocks, hdr->nb_blocks, FALSE))
+         return FALSE;
+   }
+   return TRUE;
+}
+
+/**
+ * Builds a list from a range of references
+ * \param file a cache file
+ * \param r a range of references
+ * \param objs array of objects referenced
+ * \return a list keeping the order of the references
+ */
+static list_t* _list_from_refs(cache_file_t* file, cache_range_t r, void** objs)
+{
+   list_t* l = NULL;
+   uint32_t i;
+   for (i = r.nb; i > 0; i--)
+      l = list_add_before(l, objs[file->refs[r.start + i - 1]]);
+   return l;
+}
+
+/**
+ * Builds a queue from a range of references
+ * \param file a cache file
+ * \param r a range of references
+ * \param objs array of objects referenced
+ * \return a queue keeping the order of the references, or NULL for a NULL container
+ */
+static queue_t* _queue_from_refs(cache_file_t* file, cache_range_t r, void** objs)
+{
+   if (r.nb == CACHE_NONE)
+      return NULL;
+   queue_t* q = queue_new();
+   uint32_t i;
+   for (i = 0; i < r.nb; i++)
+      queue_add_tail(q, objs[file->refs[r.start + i]]);
+   return q;
+}
+
+/**
+ * Builds the edges of a graph node from a cache file
+ * \param file a cache file
+ * \param out range of outgoing edges
+ * \param in range of references to incoming edges
+ * \param node the graph node
+ * \param edges array of all edges
+ */
+static void _node_edges_from_cache(cache_file_t* file, cache_range_t out,
+      cache_range_t in, graph_node_t* node, graph_edge_t** edges)
+{
+   uint32_t i;
+   for (i = out.nb; i > 0; i--)
+      node->out = list_add_before(node->out, edges[out.start + i - 1]);
+   node->in = _list_from_refs(file, in, (void**) edges);
+}
+
+/**
+ * Rebuilds functions, blocks, loops and graphs of an asmfile from a cache file
+ * \param asmfile an asmfile
+ * \param file a valid cache file
+ * \param insns array of instructions of the asmfile
+ */
+static void _cache_file_restore(asmfile_t* asmfile, cache_file_t* file,
+      insn_t** insns)
+{
+   cache_hdr_t* hdr = file->hdr;
+   fct_t** fcts = lc_malloc0(hdr->nb_fcts * sizeof(*fcts));
+   block_t** blocks = lc_malloc0(hdr->nb_blocks * sizeof(*blocks));
+   loop_t** loops = lc_malloc0(hdr->nb_loops * sizeof(*loops));
+   graph_edge_t** edges = lc_malloc0(hdr->nb_edges * sizeof(*edges));
+   list_t* plt_fcts = NULL;
+   uint32_t i, j;
+
+   // Objects are allocated first as records reference each other
+   for (i = 0; i < hdr->nb_fcts; i++) {
+      fcts[i] = lc_malloc0(sizeof(fct_t));
+      fcts[i]->cg_node = graph_node_new(fcts[i]);
+   }
+   for (i = 0; i < hdr->nb_blocks; i++) {
+      blocks[i] = lc_malloc0(sizeof(block_t));
+      blocks[i]->cfg_node = graph_node_new(blocks[i]);
+      blocks[i]->domination_node = tree_new(blocks[i]);
+   }
+   for (i = 0; i < hdr->nb_loops; i++) {
+      loops[i] = lc_malloc0(sizeof(loop_t));
+      loops[i]->hierarchy_node = tree_new(loops[i]);
+   }
+   for (i = 0; i < hdr->nb_edges; i++)
+      edges[i] = lc_malloc0(sizeof(graph_edge_t));
+
+   // Instructions
+   for (i = 0; i < hdr->nb_insns; i++) {
+      insns[i]->annotate = file->annotates[i];
+      if (file->insn_blocks[i] != CACHE_NONE)
+         insns[i]->block = blocks[file->insn_blocks[i]];
+   }
+
+   // Blocks and CFG
+   for (i = 0; i < hdr->nb_blocks; i++) {
+      cache_block_t* cb = &file->blocks[i];
+      block_t* b = blocks[i];
+      b->id = cb->id;
+      b->global_id = cb->global_id;
+      b->function = fcts[cb->fct];
+      b->begin_sequence = (cb->first_insn != CACHE_NONE) ?
+            insns[cb->first_insn]->sequence : NULL;
+      b->end_sequence = (cb->last_insn != CACHE_NONE) ?
+            insns[cb->last_insn]->sequence : NULL;
+      b->loop = (cb->loop != CACHE_NONE) ? loops[cb->loop] : NULL;
+      b->is_loop_exit = cb->is_loop_exit;
+      b->is_padding = cb->is_padding;
+      for (j = cb->out.start; j < cb->out.start + cb->out.nb; j++) {
+         cache_edge_t* ce = &file->edges[j];
+         edges[j]->from = b->cfg_node;
+         edges[j]->to = blocks[ce->to]->cfg_node;
+         edges[j]->data = (ce->data != CACHE_NONE) ? insns[ce->data] : NULL;
+      }
+      _node_edges_from_cache(file, cb->out, cb->in, b->cfg_node, edges);
+   }
+
+   // Loops and loops hierarchy
+   for (i = 0; i < hdr->nb_loops; i++) {
+      cache_loop_t* cl = &file->loops[i];
+      loop_t* l = loops[i];
+      l->id = cl->id;
+      l->global_id = cl->global_id;
+      l->function = fcts[cl->fct];
+      l->entries = _list_from_refs(file, cl->entries, (void**) blocks);
+      l->exits = _list_from_refs(file, cl->exits, (void**) blocks);
+      l->blocks = _queue_from_refs(file, cl->blocks, (void**) blocks);
+      // tree_insert adds children at the head
+      for (j = cl->children.nb; j > 0; j--)
+         tree_insert(l->hierarchy_node,
+               loops[file->refs[cl->children.start + j - 1]]->hierarchy_node);
+   }
+
+   // Functions and CG
+   for (i = 0; i < hdr->nb_fcts; i++) {
+      cache_fct_t* cf = &file->fcts[i];
+      fct_t* f = fcts[i];
+      insn_t* first = insns[cf->first_insn];
+
+      f->id = cf->id;
+      f->global_id = cf->global_id;
+      f->asmfile = asmfile;
+      f->first_insn = first;
+      f->dbg_addr = cf->dbg_addr;
+      f->blocks = _queue_from_refs(file, cf->blocks, (void**) blocks);
+      f->padding_blocks = _queue_from_refs(file, cf->padding_blocks, (void**) blocks);
+      f->entries = _queue_from_refs(file, cf->entries, (void**) blocks);
+      f->loops = _queue_from_refs(file, cf->loops, (void**) loops);
+      f->exits = queue_new();
+      f->ranges = queue_new();
+      f->is_grouping_analyzed = FALSE;
+      if (cf->components.nb != CACHE_NONE) {
+         f->components = queue_new();
+         for (j = cf->components.start; j < cf->components.start + cf->components.nb; j++)
+            queue_add_tail(f->components,
+                  _queue_from_refs(file, file->ccs[j], (void**) blocks));
+      }
+      for (j = cf->cg_out.start; j < cf->cg_out.start + cf->cg_out.nb; j++) {
+         cache_edge_t* ce = &file->edges[j];
+         edges[j]->from = f->cg_node;
+         edges[j]->to = fcts[ce->to]->cg_node;
+         edges[j]->data = (ce->data != CACHE_NONE) ? insns[ce->data] : NULL;
+      }
+      _node_edges_from_cache(file, cf->cg_out, cf->cg_in, f->cg_node, edges);
+
+      if (cf->original == CACHE_NONE) {
+         f->namelbl = insn_get_fctlbl(first);
+         hashtable_insert(asmfile->ht_functions, label_get_name(f->namelbl), f);
+      } else {
+         f->original_function = fcts[cf->original];
+         f->namelbl = label_new(file->strings + cf->name, INSN_GET_ADDR(first),
+               TARGET_INSN, first);
+         asmfile_add_label(asmfile, f->namelbl);
+      }
+      if (cf->flags & CACHE_FCT_PLT)
+         plt_fcts = list_add_before(plt_fcts, f);
+      else
+         queue_add_tail(asmfile->functions, f);
+   }
+   // The list of plt functions was built in reverse order
+   FOREACH_INLIST(plt_fcts, it_p)
+      asmfile->plt_fct = list_add_before(asmfile->plt_fct, GET_DATA_T(fct_t*, it_p));
+   list_free(plt_fcts, NULL);
+
+   // Debug data are loaded once functions are complete. The saved demangled
+   // name is the one set after loading them
+   for (i = 0; i < hdr->nb_fcts; i++) {
+      cache_fct_t* cf = &file->fcts[i];
+      fct_t* f = fcts[i];
+      char* demname = (cf->demname != CACHE_NONE) ?
+            lc_strdup(file->strings + cf->demname) : NULL;
+      if (cf->original == CACHE_NONE)
+         f->demname = demname;
+      if (asmfile->load_fct_dbg != NULL)
+         asmfile->load_fct_dbg(f);
+      if (cf->original != CACHE_NONE) {
+         if (f->demname != NULL)
+            lc_free(f->demname);
+         f->demname = demname;
+      }
+   }
+
+   asmfile->maxid_fct = hdr->maxid_fct;
+   asmfile->maxid_block = hdr->maxid_block;
+   asmfile->maxid_loop = hdr->maxid_loop;
+   asmfile->n_blocks = hdr->n_blocks;
+   asmfile->n_loops = hdr->n_loops;
+   asmfile->analyze_flag |= hdr->analyze_flag;
+
+   lc_free(fcts);
+   lc_free(blocks);
+   lc_free(loops);
+   lc_free(edges);
+}
+
+/*
+ * Loads the results of the flow, loop and connected components analyses of
+ * an asmfile from its cache file, instead of running the analyses
+ * \param asmfile a disassembled asmfile whose flow has not been analyzed yet
+ * \param dir directory containing cache files
+ * \return EXIT_SUCCESS if the results were loaded, else an error code. In this
+ * case, the asmfile is not modified
+ */
+int lcore_cache_load(asmfile_t* asmfile, char* dir)
+{
+   if (asmfile == NULL)
+      return ERR_LIBASM_MISSING_ASMFILE;
+   if (dir == NULL)
+      return ERR_COMMON_FILE_NAME_MISSING;
+   if ((asmfile->analyze_flag & DIS_ANALYZE) == 0
+         || (asmfile->analyze_flag & CFG_ANALYZE) != 0
+         || queue_length(asmfile->functions) > 0 || asmfile->plt_fct != NULL)
+      return ERR_ANALYZE_CACHE_UNSUPPORTED;
+
+   cache_hdr_t expected;
+   int res = _cache_hdr_init(asmfile, &expected);
+   if (res != EXIT_SUCCESS)
+      return res;
+
+   char* path = _cache_get_path(dir, &expected);
+   int fd = open(path, O_RDONLY);
+   lc_free(path);
+   if (fd < 0)
+      return ERR_COMMON_FILE_NOT_FOUND;
+   struct stat st;
+   if (fstat(fd, &st) != 0 || (size_t) st.st_size < sizeof(cache_hdr_t)) {
+      close(fd);
+      return ERR_COMMON_FILE_INVALID;
+   }
+   void* map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+   close(fd);
+   if (map == MAP_FAILED)
+      return ERR_COMMON_UNABLE_TO_READ_FILE;
+
+   cache_hdr_t* hdr = map;
+   cache_file_t file;
+   if (memcmp(hdr->magic, expected.magic, sizeof(hdr->magic)) != 0
+         || hdr->format != expected.format || hdr->hdr_size != expected.hdr_size)
+      res = ERR_COMMON_FILE_INVALID;
+   else if (hdr->version_hash != expected.version_hash
+         || hdr->content_hash != expected.content_hash
+         || hdr->content_size != expected.content_size
+         || hdr->settings_hash != expected.settings_hash
+         || hdr->insns_hash != expected.insns_hash
+         || hdr->nb_insns != expected.nb_insns)
+      res = ERR_ANALYZE_CACHE_NOT_MATCHING;
+   else if (_cache_file_map(map, &file) != (size_t) st.st_size)
+      res = ERR_COMMON_FILE_INVALID;
+
+   if (res == EXIT_SUCCESS) {
+      insn_t** insns = lc_malloc(hdr->nb_insns * sizeof(*insns) + 1);
+      uint32_t i = 0;
+      FOREACH_INQUEUE(asmfile_get_insns(asmfile), it_in)
+         insns[i++] = GET_DATA_T(insn_t*, it_in);
+
+      if (_cache_file_check(&file, insns)) {
+         _cache_file_restore(asmfile, &file, insns);
+         DBGMSG("Analysis results of %s loaded from cache\n", asmfile_get_name(asmfile));
+      }
+      else
+         res = ERR_COMMON_FILE_INVALID;
+      lc_free(insns);
+   }
+   munmap(map, st.st_size);
+
+   return res;
+}
@@ -57,6 +57,10 @@ static list_t *lcore_dfs_mark(block_t *root, int *cinfo, block_t *defaulthead,
       graph_edge_t* ed = GET_DATA_T(graph_edge_t*, liter);
       block_t *b = (block_t*) (ed->to->data);
 
+      // Blocks of other functions are not indexed in cinfo
+      if (block_get_fct(b) != block_get_fct(root))
+         continue;
+
       // Case where the default head has predecessors and is in the initlist : look to the addresses of the first instruction
       // of each block and place the one with the smallest address in the inithead list
       if ((cinfo[b->id] == 0)
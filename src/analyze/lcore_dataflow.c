@@ -122,10 +122,21 @@ struct adfa_cntxt_s {
    graph_node_t* graph; /**< CFG entry point */
    adfa_driver_t* driver; /**< Input driver*/
 
-   char* _traversed; /**< For internal use. Array of flag (one per block id) */
-   queue_t* _to_compute; /**< For internal use. Queue of block_t */
+   char* _traversed; /**< For internal use. Array of block states (one per block id, ADFA_BLOCK_*) */
+   queue_t* _to_compute; /**< For internal use. Stack of blocks whose predecessors are computed */
+   int* _pending; /**< For internal use. Number of predecessors to compute before each block (one per block id) */
+   block_t** _rpo; /**< For internal use. Blocks reachable from the entry, in reverse postorder */
+   int _nb_rpo; /**< For internal use. Number of blocks in _rpo */
+   int _next_rpo; /**< For internal use. Index in _rpo of the first block which may not be scheduled */
 };
 
+/**
+ * States of blocks during the analysis (values of adfa_cntxt_t._traversed)
+ */
+#define ADFA_BLOCK_TODO     0   /**<The block has not been scheduled*/
+#define ADFA_BLOCK_DONE     1   /**<The block has been computed*/
+#define ADFA_BLOCK_QUEUED   2   /**<The block is in _to_compute*/
+
 /*
  * Prints an adfa_val_t structure
  * \param val an adfa_val_t structure to print
@@ -725,74 +736,78 @@ static int __DFA_edge_isbackedge(graph_edge_t* edge)
 }
 
 /**
- * Checks if block corresponding to node can be computed or not
- * Add it in the context if it is possible
- * \param node a CFG node
- * \param context current context
+ * Checks if an edge must be computed before its destination: loop back edges,
+ * self loops and edges from other functions are ignored
+ * \param edge a CFG edge
+ * \param f current function
+ * \return TRUE if the source of edge must be computed before its destination
  */
-static void __DFA_BFS_is_computable(graph_node_t* node, void* context)
+static int __DFA_edge_isordering(graph_edge_t* edge, fct_t* f)
 {
-   adfa_cntxt_t* cntxt = (adfa_cntxt_t*) context;
-   block_t* b = node->data;
+   block_t* from = (block_t*) edge->from->data;
+   block_t* to = (block_t*) edge->to->data;
 
-   if (cntxt->_traversed[b->id] == 0) {
-      FOREACH_INLIST(node->in, it) {
-         graph_edge_t* ed = GET_DATA_T(graph_edge_t*, it);
-         block_t* pred = ed->from->data;
-
-         if (__DFA_edge_isbackedge(ed) == FALSE && pred != b
-               && cntxt->_traversed[pred->id] == 0) {
-            return;
-         }
-      }
-      if (queue_lookup(cntxt->_to_compute, &direct_equal, b) == NULL)
-         queue_add_head(cntxt->_to_compute, b);
-   }
+   return (from != to && block_get_fct(from) == f && block_get_fct(to) == f
+         && __DFA_edge_isbackedge(edge) == FALSE);
 }
 
-static int _check_traversed_blocks(adfa_cntxt_t* cntxt)
+/**
+ * Adds a block in the reverse postorder of the context (used by graph_node_DFS_iterative)
+ * \param node a CFG node
+ * \param context current context
+ */
+static void __DFA_DFS_postorder(graph_node_t* node, void* context)
 {
-   FOREACH_INQUEUE(cntxt->f->blocks, it_b) {
-      block_t* b = GET_DATA_T(block_t*, it_b);
-      if (!block_is_padding(b) && cntxt->_traversed[b->id] == 0)
-         return (FALSE);
-   }
+   adfa_cntxt_t* cntxt = (adfa_cntxt_t*) context;
+   block_t* b = node->data;
 
-   return (TRUE);
+   if (block_get_fct(b) == cntxt->f)
+      cntxt->_rpo[--cntxt->_next_rpo] = b;
 }
 
-static void _backup_strat(adfa_cntxt_t* cntxt)
+/**
+ * Initializes the scheduling of blocks: orders blocks reachable from the entry
+ * in reverse postorder and counts for each block the predecessors to compute first
+ * \param cntxt current context
+ */
+static void __DFA_init_schedule(adfa_cntxt_t* cntxt)
 {
-   // Iterate over analyzed blocks to add one not analyzed successor
-   // in the "todo" list
-   // This should "unlock" the traverse algorithm and allow to analyze
-   // all blocks.
-   FOREACH_INQUEUE(cntxt->f->blocks, it_b)
-   {
-      int stop = FALSE;
-      block_t* b = GET_DATA_T(block_t*, it_b);
-
-      if (!block_is_padding(b) && cntxt->_traversed[b->id] == 1) {
-         FOREACH_INLIST(b->cfg_node->out, it_next)
-         {
-            graph_edge_t* ed = GET_DATA_T(graph_edge_t*, it_next);
-            block_t* next = (block_t*) (ed->to->data);
-            if (cntxt->_traversed[next->id] == 0) {
-               DBGMSG("Randomly add block %d\n", next->global_id);
-               queue_add_head(cntxt->_to_compute, next);
-               stop = TRUE;
-               break;
-            }
-         }
+   int nb_blocks = queue_length(cntxt->f->blocks);
+   int i;
+
+   cntxt->_traversed = lc_malloc0(nb_blocks * sizeof(char));
+   cntxt->_pending = lc_malloc0(nb_blocks * sizeof(int));
+   cntxt->_rpo = lc_malloc(nb_blocks * sizeof(block_t*));
+
+   // Postorder is filled from the end of the array, then moved to its beginning
+   cntxt->_next_rpo = nb_blocks;
+   graph_node_DFS_iterative(cntxt->graph, NULL, &__DFA_DFS_postorder, NULL, cntxt);
+   cntxt->_nb_rpo = nb_blocks - cntxt->_next_rpo;
+   memmove(cntxt->_rpo, cntxt->_rpo + cntxt->_next_rpo,
+         cntxt->_nb_rpo * sizeof(block_t*));
+   cntxt->_next_rpo = 0;
+
+   for (i = 0; i < cntxt->_nb_rpo; i++) {
+      block_t* b = cntxt->_rpo[i];
+      FOREACH_INLIST(b->cfg_node->in, it) {
+         if (__DFA_edge_isordering(GET_DATA_T(graph_edge_t*, it), cntxt->f))
+            cntxt->_pending[b->id]++;
       }
-      if (stop)
-         break;
    }
+
+   block_t* entry = cntxt->graph->data;
+   cntxt->_traversed[entry->id] = ADFA_BLOCK_QUEUED;
+   queue_add_head(cntxt->_to_compute, entry);
 }
 
 /**
  * Looks for a block to compute. A block can be computed if its predecessors
- * have been computed (after "removing" loop back edges)
+ * have been computed (after "removing" loop back edges). Each block has a counter
+ * of predecessors to compute, so blocks are scheduled in constant time when their
+ * last predecessor is computed.
+ * If no block can be computed, for instance when an edge enters a loop from an inner
+ * loop, the first block in reverse postorder not computed yet is scheduled: all its
+ * predecessors in reverse postorder are computed, so it has at least a computed one.
  * \param cntxt current context
  * \return a basic block to compute or NULL
  */
@@ -800,20 +815,32 @@ static block_t* __DFA_find_computable_block(adfa_cntxt_t* cntxt)
 {
    block_t* bb = NULL;
 
-   if (queue_length(cntxt->_to_compute) == 0)
-      graph_node_BFS(cntxt->graph, &__DFA_BFS_is_computable, NULL, cntxt);
-
-   // Backup strat: if the list is empty but all blocks have not
-   // been analyzed, try analyzed blocks successors.
-   if (queue_length(cntxt->_to_compute) == 0
-         && _check_traversed_blocks(cntxt) == FALSE) {
-      _backup_strat(cntxt);
-   }
+   if (queue_length(cntxt->_to_compute) == 0) {
+      while (cntxt->_next_rpo < cntxt->_nb_rpo
+            && cntxt->_traversed[cntxt->_rpo[cntxt->_next_rpo]->id] != ADFA_BLOCK_TODO)
+         cntxt->_next_rpo++;
+      if (cntxt->_next_rpo == cntxt->_nb_rpo)
+         return (NULL);
 
-   if (queue_length(cntxt->_to_compute) != 0) {
+      bb = cntxt->_rpo[cntxt->_next_rpo];
+      DBGMSG("Randomly add block %d\n", bb->global_id);
+   } else {
       bb = (block_t*) queue_peek_head(cntxt->_to_compute);
       queue_remove_head(cntxt->_to_compute);
    }
+
+   // Blocks are computed one at a time: successors can be scheduled now
+   cntxt->_traversed[bb->id] = ADFA_BLOCK_DONE;
+   FOREACH_INLIST(bb->cfg_node->out, it) {
+      graph_edge_t* ed = GET_DATA_T(graph_edge_t*, it);
+      block_t* next = ed->to->data;
+
+      if (__DFA_edge_isordering(ed, cntxt->f) && --cntxt->_pending[next->id] == 0
+            && cntxt->_traversed[next->id] == ADFA_BLOCK_TODO) {
+         cntxt->_traversed[next->id] = ADFA_BLOCK_QUEUED;
+         queue_add_head(cntxt->_to_compute, next);
+      }
+   }
    return (bb);
 }
 
@@ -835,13 +862,12 @@ adfa_cntxt_t* ADFA_analyze_function(fct_t* f, adfa_driver_t* driver)
    cntxt->Avals = queue_new();
    cntxt->Rvals = hashtable_new(&ssa_var_hash, &ssa_var_equal);
    cntxt->_to_compute = queue_new();
-   queue_add_head(cntxt->_to_compute, FCT_ENTRY(f));
    cntxt->arch = f->asmfile->arch;
    cntxt->ssa = lcore_compute_ssa(f);
    cntxt->graph = FCT_ENTRY(f)->cfg_node;
-   cntxt->_traversed = lc_malloc0(queue_length(f->blocks) * sizeof(char));
    cntxt->f = f;
    cntxt->driver = driver;
+   __DFA_init_schedule(cntxt);
 
    // Initialize the adfa_val corresponding to the RIP register
    ssa_var_t* ssa_rip = lc_malloc(sizeof(ssa_var_t));
@@ -861,7 +887,6 @@ adfa_cntxt_t* ADFA_analyze_function(fct_t* f, adfa_driver_t* driver)
       driver->user_struct = driver->init(f, cntxt);
 
    while ((b = __DFA_find_computable_block(cntxt)) != NULL) {
-      cntxt->_traversed[b->id] = 1;
       ssa_block_t* ssab = cntxt->ssa[b->id];
 
       FOREACH_INQUEUE(ssab->first_insn, it_in) {
@@ -897,6 +922,8 @@ void ADFA_free(adfa_cntxt_t* cntxt)
    if (cntxt == NULL)
       return;
    lc_free(cntxt->_traversed);
+   lc_free(cntxt->_pending);
+   lc_free(cntxt->_rpo);
    queue_free(cntxt->_to_compute, NULL);
    queue_free(cntxt->Avals, &adfa_free_val);
    hashtable_free(cntxt->Rvals, NULL, NULL);
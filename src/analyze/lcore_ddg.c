@@ -38,21 +38,27 @@ typedef struct {
 typedef struct {
    graph_t *ddg;
    array_t *edges;
-   arch_t *arch; /* architecture */
-
-   /* rd/wrreg2insn allows fast access to instructions reading/writing a given register
-    * from its "family" and "name" (ex: XMM7 and YMM7 target the same register) */
-   hashtable_t *rdreg2insn; /* (read    register, array of instructions) pairs */
-   hashtable_t *wrreg2insn; /* (written register, array of instructions) pairs */
-
-   /* insn_rank links each instruction to its rank (first instruction has rank 1),
-    * allowing to know if an instruction is executed before another one */
-   hashtable_t *insn_rank; /* (instruction, rank [long int]) pairs */
 
    /* insn2node allow fast access to DDG nodes */
-   hashtable_t *insn2node; /* (instruction, node [graph_node_t *]) pairs */
+   hashmap_t *insn2node; /* (instruction, node [graph_node_t *]) pairs */
 } ddg_context_t;
 
+/* Registers read and written by a sequence of instructions. Instructions are identified by
+ * their rank in the sequence (first instruction has rank 0) and registers by a dense identifier
+ * (CF ddg_reg_id), allowing to use arrays instead of hashtables */
+typedef struct {
+   arch_t *arch; /* architecture */
+   int nb_regs; /* number of register identifiers (greatest identifier + 1) */
+   int nb_rd; /* number of register reads */
+   int nb_wr; /* number of register writes */
+   int *rd; /* identifiers of read registers, grouped by instruction */
+   int *wr; /* identifiers of written registers, grouped by instruction */
+   int *rd_start; /* rd_start[i] to rd_start[i+1]-1: indexes in rd of registers read by instruction i */
+   int *wr_start; /* idem rd_start for wr */
+   int *readers; /* ranks of instructions reading registers, grouped by register */
+   int *readers_start; /* readers_start[r] to readers_start[r+1]-1: indexes in readers for register r */
+} ddg_regs_t;
+
 /**************************************************************************************/
 /*                 FUNCTIONS RELATED TO lcore_loop[path]_getddg[_ext]                 */
 /**************************************************************************************/
@@ -89,86 +95,130 @@ static int breaks_dependency(insn_t *insn)
    return FALSE;
 }
 
-static void insert_reg2insn(hashtable_t *ht, void *reg_key, insn_t *insn)
+/**
+ * Returns the dense identifier of a register (first identifiers are for registers with no family)
+ * Registers with the same family and name share the same identifier (ex: XMM7 and YMM7 target
+ * the same register)
+ * \param reg a register
+ * \param arch architecture
+ * \return identifier
+ */
+static inline int ddg_reg_id(reg_t *reg, arch_t *arch)
 {
-   array_t *insns = hashtable_lookup(ht, reg_key);
-
-   if (!insns) {
-      insns = array_new();
-      hashtable_insert(ht, reg_key, insns);
-   }
-
-   array_add(insns, insn);
+   /* Same numbering as __regID (lcore_live_registers.c), shifted to make room for SIGNED_ERROR */
+   return (reg_get_family(reg, arch) + 1) * arch->nb_names_registers
+         + (unsigned char) reg_get_name(reg);
 }
 
 /**
- * Inserts a new (register, instruction) pair in rdreg2insn and/or wrreg2insn hashtables
- * \param ctxt DDG context
+ * Saves in a ddg_regs_t structure a register accessed by an instruction
+ * \param regs register accesses
  * \param oprnd operand (memory or register)
  * \param reg register extracted from oprnd
- * \param insn instruction reading/writing reg
+ * \param breaks_dep TRUE if the instruction breaks dependencies (CF breaks_dependency)
  */
-static void update_hashtables(ddg_context_t ctxt, oprnd_t *oprnd, reg_t *reg,
-      insn_t *insn)
+static void add_reg_access(ddg_regs_t *regs, oprnd_t *oprnd, reg_t *reg,
+      int breaks_dep)
 {
    if (!reg)
       return;
 
-   /* A register key is the concatenation of its family and name (CF <arch>_arch.h) */
-   void *reg_key = (void *) ((long) (reg_get_family(reg, ctxt.arch) * 256
-         + reg_get_name(reg)));
+   const int id = ddg_reg_id(reg, regs->arch);
+   if (id >= regs->nb_regs)
+      regs->nb_regs = id + 1;
 
    /* In a (register to register) dependency-breaking instruction */
-   if (breaks_dependency(insn)) {
+   if (breaks_dep) {
       /* Ignore register reads */
       if (oprnd_is_dst(oprnd))
-         insert_reg2insn(ctxt.wrreg2insn, reg_key, insn);
+         regs->wr[regs->nb_wr++] = id;
 
       return;
    }
 
    /* If read (register in a memory operand or source register) */
    if (oprnd_is_mem(oprnd) || oprnd_is_src(oprnd))
-      insert_reg2insn(ctxt.rdreg2insn, reg_key, insn);
+      regs->rd[regs->nb_rd++] = id;
 
    /* If written (destination register) */
    if (!oprnd_is_mem(oprnd) && oprnd_is_dst(oprnd))
-      insert_reg2insn(ctxt.wrreg2insn, reg_key, insn);
+      regs->wr[regs->nb_wr++] = id;
 }
 
 /*
- * Fills rdreg2insn, wrreg2insn and insn_rank hashtables from all path instructions
+ * Collects registers read and written by a sequence of instructions.
+ * Also builds, for each register, the ordered list of instructions reading it
  */
-static void fill_DDG_data(ddg_context_t *ctxt, array_t *insns)
+static void get_reg_accesses(ddg_regs_t *regs, array_t *insns)
 {
-   ctxt->rdreg2insn = hashtable_new(direct_hash, direct_equal);
-   ctxt->wrreg2insn = hashtable_new(direct_hash, direct_equal);
-   ctxt->insn_rank = hashtable_new(direct_hash, direct_equal);
+   const int nb_insns = array_length(insns);
+   int max_accesses = 0, i;
 
-   long rank = 1;
-
-   /* For each instruction */
-   FOREACH_INARRAY(insns, insns_iter)
-   {
-      insn_t *insn = ARRAY_GET_DATA(insn, insns_iter);
+   FOREACH_INARRAY(insns, insns_iter1) {
+      insn_t *insn = ARRAY_GET_DATA(insn, insns_iter1);
+      max_accesses += 2 * insn_get_nb_oprnds(insn);
+   }
 
-      /* Save instruction rank */
-      hashtable_insert(ctxt->insn_rank, insn, (void *) rank++);
+   regs->arch = insn_get_arch(array_get_first_elt(insns));
+   regs->nb_regs = 0;
+   regs->nb_rd = 0;
+   regs->nb_wr = 0;
+   regs->rd = lc_malloc((max_accesses + 1) * sizeof regs->rd[0]);
+   regs->wr = lc_malloc((max_accesses + 1) * sizeof regs->wr[0]);
+   regs->rd_start = lc_malloc((nb_insns + 1) * sizeof regs->rd_start[0]);
+   regs->wr_start = lc_malloc((nb_insns + 1) * sizeof regs->wr_start[0]);
+
+   /* For each instruction (rank is its position in insns) */
+   for (i = 0; i < nb_insns; i++) {
+      insn_t *insn = insns->mem[i];
+      const int breaks_dep = breaks_dependency(insn);
+      regs->rd_start[i] = regs->nb_rd;
+      regs->wr_start[i] = regs->nb_wr;
 
       /* For each operand */
-      int i;
+      int j;
       oprnd_t **oprnds = insn_get_oprnds(insn);
-      for (i = 0; i < insn_get_nb_oprnds(insn); i++) {
-         oprnd_t *oprnd = oprnds[i];
+      for (j = 0; j < insn_get_nb_oprnds(insn); j++) {
+         oprnd_t *oprnd = oprnds[j];
 
          if (oprnd_is_reg(oprnd))
-            update_hashtables(*ctxt, oprnd, oprnd_get_reg(oprnd), insn);
+            add_reg_access(regs, oprnd, oprnd_get_reg(oprnd), breaks_dep);
          else if (oprnd_is_mem(oprnd)) {
-            update_hashtables(*ctxt, oprnd, oprnd_get_base(oprnd), insn);
-            update_hashtables(*ctxt, oprnd, oprnd_get_index(oprnd), insn);
+            add_reg_access(regs, oprnd, oprnd_get_base(oprnd), breaks_dep);
+            add_reg_access(regs, oprnd, oprnd_get_index(oprnd), breaks_dep);
          }
       } /* for each operand */
    } /* for each instruction */
+   regs->rd_start[nb_insns] = regs->nb_rd;
+   regs->wr_start[nb_insns] = regs->nb_wr;
+
+   /* Readers of each register, by increasing rank (counting sort of reads) */
+   regs->readers_start = lc_malloc0((regs->nb_regs + 1) * sizeof regs->readers_start[0]);
+   regs->readers = lc_malloc((regs->nb_rd + 1) * sizeof regs->readers[0]);
+   for (i = 0; i < regs->nb_rd; i++)
+      regs->readers_start[regs->rd[i] + 1]++;
+   for (i = 0; i < regs->nb_regs; i++)
+      regs->readers_start[i + 1] += regs->readers_start[i];
+
+   int *next = lc_malloc((regs->nb_regs + 1) * sizeof next[0]);
+   memcpy(next, regs->readers_start, (regs->nb_regs + 1) * sizeof next[0]);
+   for (i = 0; i < nb_insns; i++) {
+      int k;
+      for (k = regs->rd_start[i]; k < regs->rd_start[i + 1]; k++)
+         regs->readers[next[regs->rd[k]]++] = i;
+   }
+   lc_free(next);
+}
+
+/* Frees arrays allocated by get_reg_accesses */
+static void free_reg_accesses(ddg_regs_t *regs)
+{
+   lc_free(regs->rd);
+   lc_free(regs->wr);
+   lc_free(regs->rd_start);
+   lc_free(regs->wr_start);
+   lc_free(regs->readers_start);
+   lc_free(regs->readers);
 }
 
 /**
@@ -199,7 +249,7 @@ static void connect_nodes(graph_t *ddg, graph_node_t *src, graph_node_t *dst, ch
 static graph_node_t *insert_node(ddg_context_t ctxt, insn_t *insn)
 {
    graph_node_t *node = graph_add_new_node(ctxt.ddg, insn);
-   hashtable_insert(ctxt.insn2node, insn, node);
+   hashmap_insert(ctxt.insn2node, insn, node);
 
    graph_connected_component_t *cc = hashtable_lookup (graph_get_node2cc (ctxt.ddg), node);
    hashtable_t *entry_nodes = graph_connected_component_get_entry_nodes (cc);
@@ -221,8 +271,8 @@ static graph_node_t *insert_node(ddg_context_t ctxt, insn_t *insn)
 static void insert_in_DDG(ddg_context_t ctxt, insn_t *src, insn_t *dst,
       char *kind, int distance)
 {
-   graph_node_t *src_node = hashtable_lookup(ctxt.insn2node, src);
-   graph_node_t *dst_node = hashtable_lookup(ctxt.insn2node, dst);
+   graph_node_t *src_node = hashmap_lookup(ctxt.insn2node, src);
+   graph_node_t *dst_node = hashmap_lookup(ctxt.insn2node, dst);
 
    if (src != dst) {
       if (!src_node) src_node = insert_node (ctxt, src);
@@ -261,87 +311,22 @@ static void insert_in_DDG_or_edges(ddg_context_t ctxt, insn_t *src, insn_t *dst,
       insert_in_DDG(ctxt, src, dst, kind, distance);
 }
 
-/* Inserts RAW (Read After Write) or WAW (Write After Write) dependencies in the DDG */
-static void insert_RAW_or_WAW(ddg_context_t ctxt, insn_t *dst_insn,
-      void *reg_key, char *kind)
-{
-   const long dst_insn_rank = (long) hashtable_lookup(ctxt.insn_rank, dst_insn);
-   array_t *src_insns = hashtable_lookup(ctxt.wrreg2insn, reg_key);
-
-   if (!src_insns)
-      return;
-
-   /* Looking for the nearest instruction in the same loop iteration */
-   /* For each instruction writing <reg_key>, from the last to the first executed */
-   FOREACH_INARRAY_REVERSE(src_insns, src_insns_iter) {
-      insn_t *src_insn = ARRAY_GET_DATA(src_insn, src_insns_iter);
-
-      /* skips previous iteration */
-      long src_insn_rank = (long) hashtable_lookup(ctxt.insn_rank, src_insn);
-      if (src_insn_rank >= dst_insn_rank)
-         continue;
-
-      insert_in_DDG_or_edges(ctxt, src_insn, dst_insn, kind, 0);
-
-      return;
-   }
-
-   /* Nearest instruction in the previous loop iteration */
-   insn_t *src_insn = array_get_last_elt(src_insns);
-   insert_in_DDG_or_edges(ctxt, src_insn, dst_insn, kind, 1);
-}
-
-/* Inserts RAW (Read After Write) dependencies in the DDG
- * The nearest instruction writing a register matching reg_key cuts the dependency chain.
+/* Inserts a RAW (Read After Write) or WAW (Write After Write) dependency in the DDG
+ * The nearest instruction writing the register cuts the dependency chain.
  * This instruction is searched in the same loop iteration and then in the previous one */
-static void insert_RAW(ddg_context_t ctxt, insn_t *dst_insn, void *reg_key)
-{
-   insert_RAW_or_WAW(ctxt, dst_insn, reg_key, "RAW");
-}
-
-/* Inserts WAR (Write After Read) dependencies in the DDG
- * Contrary to other dependencies, all matching instructions are retained */
-static void insert_WAR(ddg_context_t ctxt, insn_t *dst_insn, void *reg_key)
+static void insert_RAW_or_WAW(ddg_context_t ctxt, insn_t **insns,
+      const int *last_wr, const int *last_wr_prev, int reg, int dst, char *kind)
 {
-   const long dst_insn_rank = (long) hashtable_lookup(ctxt.insn_rank, dst_insn);
-   array_t *src_insns = hashtable_lookup(ctxt.rdreg2insn, reg_key);
-
-   if (!src_insns)
-      return;
-
-   /* Looking for all matching instructions */
-   FOREACH_INARRAY_REVERSE(src_insns, src_insns_iter)
-   {
-      insn_t *src_insn = ARRAY_GET_DATA(src_insn, src_insns_iter);
-      long src_insn_rank = (long) hashtable_lookup(ctxt.insn_rank, src_insn);
-
-      if (src_insn_rank >= dst_insn_rank) /* previous iteration */
-         insert_in_DDG_or_edges(ctxt, src_insn, dst_insn, "WAR", 1);
-      else
-         /* current iteration */
-         insert_in_DDG_or_edges(ctxt, src_insn, dst_insn, "WAR", 0);
-   }
-}
-
-/* Insert WAW (Write After Write) dependencies in the DDG
- * The nearest instruction writing a register matching reg_key cuts the dependency chain.
- * This instruction is searched in the same loop iteration and then in the previous one */
-static void insert_WAW(ddg_context_t ctxt, insn_t *dst_insn, void *reg_key)
-{
-   insert_RAW_or_WAW(ctxt, dst_insn, reg_key, "WAW");
-}
-
-/**
- * Used by build_DDG
- * @param data
- */
-static void free_insns(void *data)
-{
-   array_free(data, NULL);
+   if (last_wr[reg] >= 0)
+      insert_in_DDG_or_edges(ctxt, insns[last_wr[reg]], insns[dst], kind, 0);
+   else if (last_wr_prev[reg] >= 0)
+      insert_in_DDG_or_edges(ctxt, insns[last_wr_prev[reg]], insns[dst], kind, 1);
 }
 
 /**
  * Builds DDG for a sequence of instructions (as a graph or a list of edges)
+ * Instructions are scanned once in order, with a table indexed by register identifiers
+ * giving the last instruction writing each register.
  * \param insns dynamic array of instructions
  * \param ddg   NULL or empty DDG
  * \param edges NULL or set of edges (as dynamic array) to insert in a future ddg
@@ -349,57 +334,63 @@ static void free_insns(void *data)
  */
 static void build_DDG(array_t *insns, graph_t *ddg, array_t *edges, int only_RAW)
 {
+   const int nb_insns = array_length(insns);
+   insn_t **insn = (insn_t **) insns->mem;
    ddg_context_t ctxt;
+   ddg_regs_t regs;
+   int i, k, reg;
+
    ctxt.ddg = ddg;
    ctxt.edges = edges;
-   ctxt.arch = insn_get_arch (array_get_first_elt (insns));
-   ctxt.insn2node = NULL;
+   ctxt.insn2node = (edges == NULL) ? hashmap_new(nb_insns) : NULL;
 
-   /* Allocate/fill related hashtables */
-   fill_DDG_data(&ctxt, insns);
-   if (!edges) {
-      ctxt.insn2node = hashtable_new(direct_hash, direct_equal);
-   } else {
-      ctxt.insn2node = NULL;
-   } /* get rid of compiler warnings */
+   get_reg_accesses(&regs, insns);
 
-   /* For each (read register, instruction) pair */
-   FOREACH_INHASHTABLE(ctxt.rdreg2insn, rdreg2insn_iter) {
-      void *reg_key = GET_KEY(reg_key, rdreg2insn_iter);
-      array_t *insns = GET_DATA_T(array_t*, rdreg2insn_iter);
-
-      FOREACH_INARRAY(insns, insns_rdreg_iter)
-      {
-         insn_t *insn = ARRAY_GET_DATA(insn, insns_rdreg_iter);
-
-         insert_RAW(ctxt, insn, reg_key);
-      }
+   /* Last instruction writing each register (-1 if none): before the current
+    * instruction and in the whole sequence (that is in the previous iteration) */
+   int *last_wr = lc_malloc((regs.nb_regs + 1) * sizeof last_wr[0]);
+   int *last_wr_prev = lc_malloc((regs.nb_regs + 1) * sizeof last_wr_prev[0]);
+   for (reg = 0; reg < regs.nb_regs; reg++) {
+      last_wr[reg] = -1;
+      last_wr_prev[reg] = -1;
    }
+   for (i = 0; i < nb_insns; i++)
+      for (k = regs.wr_start[i]; k < regs.wr_start[i + 1]; k++)
+         last_wr_prev[regs.wr[k]] = i;
 
-   if (only_RAW == FALSE) {
-      /* For each (written register, instruction) pair */
-      FOREACH_INHASHTABLE(ctxt.wrreg2insn, wrreg2insn_iter)
-      {
-         void *reg_key = GET_KEY(reg_key, wrreg2insn_iter);
-         array_t *insns = GET_DATA_T(array_t*, wrreg2insn_iter);
-
-         FOREACH_INARRAY(insns, insns_wrreg_iter)
-         {
-            insn_t *insn = ARRAY_GET_DATA(insn, insns_wrreg_iter);
-
-            insert_WAR(ctxt, insn, reg_key);
-            insert_WAW(ctxt, insn, reg_key);
+   /* For each instruction */
+   for (i = 0; i < nb_insns; i++) {
+      /* For each read register */
+      for (k = regs.rd_start[i]; k < regs.rd_start[i + 1]; k++)
+         insert_RAW_or_WAW(ctxt, insn, last_wr, last_wr_prev, regs.rd[k], i, "RAW");
+
+      if (only_RAW == FALSE) {
+         /* For each written register */
+         for (k = regs.wr_start[i]; k < regs.wr_start[i + 1]; k++) {
+            int r;
+            reg = regs.wr[k];
+
+            /* WAR: contrary to other dependencies, all instructions reading the register are retained */
+            for (r = regs.readers_start[reg + 1] - 1; r >= regs.readers_start[reg]; r--) {
+               const int src = regs.readers[r];
+               insert_in_DDG_or_edges(ctxt, insn[src], insn[i], "WAR", (src >= i) ? 1 : 0);
+            }
+
+            insert_RAW_or_WAW(ctxt, insn, last_wr, last_wr_prev, reg, i, "WAW");
          }
       }
+
+      for (k = regs.wr_start[i]; k < regs.wr_start[i + 1]; k++)
+         last_wr[regs.wr[k]] = i;
    }
 
-   /* Finalize/free data structures */
-   hashtable_free(ctxt.rdreg2insn, free_insns, NULL);
-   hashtable_free(ctxt.wrreg2insn, free_insns, NULL);
-   hashtable_free(ctxt.insn_rank, NULL, NULL);
+   /* Free data structures */
+   lc_free(last_wr);
+   lc_free(last_wr_prev);
+   free_reg_accesses(&regs);
 
    if (!edges) {
-      hashtable_free(ctxt.insn2node, NULL, NULL);
+      hashmap_free(ctxt.insn2node, NULL, NULL);
    }
 }
 
@@ -494,87 +485,95 @@ static queue_t *get_obj_paths(void *obj, int *already_computed,
    return paths;
 }
 
-/* CF lcore_fctpath_getddg and build_DDG */
-static queue_t *objpath_getddg(void *obj, int only_RAW,
-                               queue_t* (*get_paths)(void *),
-                               void (*compute_paths)(void *),
-                               void (*free_paths)(void *),
-                               arch_t *arch)
+/*
+ * Returns DDG edges for each function/loop path (array with, for each path, an array of ddg_edge_t)
+ * Paths are computed and freed if not already available.
+ */
+static array_t *get_obj_paths_edges(void *obj, int only_RAW,
+                                    queue_t* (*get_paths)(void *),
+                                    void (*compute_paths)(void *),
+                                    void (*free_paths)(void *))
 {
    int paths_already_computed;
    queue_t *paths = get_obj_paths(obj, &paths_already_computed, get_paths, compute_paths);
-   queue_t *ddg_allpaths = queue_new();
+   array_t *paths_edges = array_new_with_custom_size(queue_length(paths));
 
-   /* For each path */
+   /* Get DDG edges for each path */
    FOREACH_INQUEUE(paths, paths_iter) {
       array_t *path = GET_DATA_T(array_t*, paths_iter);
-      graph_t *ddg = get_path_DDG(path, only_RAW);
-      lcore_set_ddg_latency (ddg, get_default_latency (arch));
-      queue_add_tail(ddg_allpaths, ddg);
+      array_t *insns = get_path_insns (path);
+      array_t *edges = array_new();
+      build_DDG(insns, NULL, edges, only_RAW);
+      array_free (insns, NULL);
+      array_add(paths_edges, edges);
    }
 
    /* Free paths if was computed on purpose */
    if (paths_already_computed == FALSE)
       free_paths(obj);
 
-   return ddg_allpaths;
+   return paths_edges;
 }
 
-/* CF lcore_fct_getddg and build_DDG */
-static graph_t *obj_getddg(void *obj, int only_RAW,
-                           queue_t* (*get_paths)(void *),
-                           void (*compute_paths)(void *),
-                           void (*free_paths)(void *),
-                           arch_t *arch)
+/* Frees an array returned by get_obj_paths_edges */
+static void free_paths_edges(array_t *paths_edges)
 {
-   graph_t *obj_ddg = graph_new();
-   int paths_already_computed;
-   queue_t *paths = get_obj_paths(obj, &paths_already_computed, get_paths, compute_paths);
-
-   /* If only one path, directly build+get DDG */
-   if (queue_length(paths) == 1) {
-      array_t *path = list_getdata(queue_iterator(paths)); /* first path */
-      array_t *insns = get_path_insns (path);
-      build_DDG(insns, obj_ddg, NULL, only_RAW);
-      array_free (insns, NULL);
+   FOREACH_INARRAY(paths_edges, paths_edges_iter) {
+      array_free(ARRAY_GET_DATA(NULL, paths_edges_iter), lc_free);
    }
+   array_free(paths_edges, NULL);
+}
 
-   /* Get DDG edges for each path and, from them, build a global DDG */
-   else {
-      array_t *ddg_edges = array_new();
+/* Inserts in a DDG edges returned by build_DDG */
+static void insert_edges_in_DDG(ddg_context_t ctxt, array_t *edges)
+{
+   FOREACH_INARRAY(edges, ddg_edges_iter) {
+      ddg_edge_t *ddg_edge = ARRAY_GET_DATA(ddg_edge, ddg_edges_iter);
+      insert_in_DDG(ctxt, ddg_edge->src, ddg_edge->dst, ddg_edge->kind,
+            ddg_edge->distance);
+   }
+}
 
-      /* Get DDG edges for each path */
-      FOREACH_INQUEUE(paths, paths_iter) {
-         array_t *path = GET_DATA_T(array_t*, paths_iter);
-         array_t *insns = get_path_insns (path);
-         build_DDG(insns, NULL, ddg_edges, only_RAW);
-         array_free (insns, NULL);
-      }
+/* CF lcore_fctpath_getddg and build_DDG */
+static queue_t *objpath_getddg(array_t *paths_edges, arch_t *arch)
+{
+   queue_t *ddg_allpaths = queue_new();
 
-      /* Allocate temporary data structures */
+   /* For each path */
+   FOREACH_INARRAY(paths_edges, paths_edges_iter) {
+      array_t *edges = ARRAY_GET_DATA(edges, paths_edges_iter);
       ddg_context_t ctxt;
-      ctxt.ddg = obj_ddg;
-      ctxt.insn2node = hashtable_new(direct_hash, direct_equal);
-
-      /* Insert DDG edges in obj_ddg */
-      FOREACH_INARRAY(ddg_edges, ddg_edges_iter) {
-         ddg_edge_t *ddg_edge = ARRAY_GET_DATA(ddg_edge, ddg_edges_iter);
-         insert_in_DDG(ctxt, ddg_edge->src, ddg_edge->dst, ddg_edge->kind,
-               ddg_edge->distance);
-      }
+      ctxt.ddg = graph_new();
+      ctxt.edges = NULL;
+      ctxt.insn2node = hashmap_new(0);
 
-      /* Free temporary data structures */
-      array_free(ddg_edges, NULL);
-      hashtable_free(ctxt.insn2node, NULL, NULL);
+      insert_edges_in_DDG(ctxt, edges);
+      hashmap_free(ctxt.insn2node, NULL, NULL);
+
+      lcore_set_ddg_latency (ctxt.ddg, get_default_latency (arch));
+      queue_add_tail(ddg_allpaths, ctxt.ddg);
    }
 
-   /* Free paths if was computed on purpose */
-   if (paths_already_computed == FALSE)
-      free_paths(obj);
+   return ddg_allpaths;
+}
 
-   lcore_set_ddg_latency (obj_ddg, get_default_latency (arch));
+/* CF lcore_fct_getddg and build_DDG */
+static graph_t *obj_getddg(array_t *paths_edges, arch_t *arch)
+{
+   /* Build a global DDG from DDG edges of all paths */
+   ddg_context_t ctxt;
+   ctxt.ddg = graph_new();
+   ctxt.edges = NULL;
+   ctxt.insn2node = hashmap_new(0);
 
-   return obj_ddg;
+   FOREACH_INARRAY(paths_edges, paths_edges_iter) {
+      insert_edges_in_DDG(ctxt, ARRAY_GET_DATA(NULL, paths_edges_iter));
+   }
+   hashmap_free(ctxt.insn2node, NULL, NULL);
+
+   lcore_set_ddg_latency (ctxt.ddg, get_default_latency (arch));
+
+   return ctxt.ddg;
 }
 
 /***************************************************************************************************
@@ -590,13 +589,21 @@ static void fct_free_paths     (void *f) { lcore_fct_freepaths    (f); }
 static queue_t *fctpath_getddg(fct_t *fct, int only_RAW)
 {
    arch_t *arch = asmfile_get_arch (fct_get_asmfile (fct));
-   return objpath_getddg (fct, only_RAW, _fct_get_paths, fct_compute_paths, fct_free_paths, arch);
+   array_t *paths_edges = get_obj_paths_edges (fct, only_RAW, _fct_get_paths, fct_compute_paths, fct_free_paths);
+   queue_t *ddg_allpaths = objpath_getddg (paths_edges, arch);
+   free_paths_edges (paths_edges);
+
+   return ddg_allpaths;
 }
 
 static graph_t *fct_getddg(fct_t *fct, int only_RAW)
 {
    arch_t *arch = asmfile_get_arch (fct_get_asmfile (fct));
-   return obj_getddg(fct, only_RAW, _fct_get_paths, fct_compute_paths, fct_free_paths, arch);
+   array_t *paths_edges = get_obj_paths_edges (fct, only_RAW, _fct_get_paths, fct_compute_paths, fct_free_paths);
+   graph_t *ddg = obj_getddg (paths_edges, arch);
+   free_paths_edges (paths_edges);
+
+   return ddg;
 }
 
 /*
@@ -635,22 +642,82 @@ graph_t *lcore_fct_getddg_ext(fct_t *fct)
  *                                          Specific to loops                                      *
  ***************************************************************************************************/
 
+/* DDG edges saved in a loop by lcore_loop[path]_getddg[_ext]. CQA requests the DDG of a same
+ * loop several times (for each path and each unroll variant): edges are computed only once
+ * and reused while the loop keeps the same blocks */
+struct ddg_cache_s {
+   uint64_t blocks_sig; /* signature of the loop blocks (CF get_blocks_signature) */
+   array_t *paths_edges[2]; /* indexed by only_RAW: NULL or DDG edges of each path (CF get_obj_paths_edges) */
+};
+
 static queue_t *_loop_get_paths (void *l) { return loop_get_paths   (l); }
 static void loop_compute_paths  (void *l) { lcore_loop_computepaths (l); }
 static void loop_free_paths     (void *l) { lcore_loop_freepaths    (l); }
 
+/* Returns a signature (FNV-1a hash) of the set of blocks of a loop and of their sizes */
+static uint64_t get_blocks_signature(loop_t *loop)
+{
+   uint64_t sig = 14695981039346656037ULL;
+
+   FOREACH_INQUEUE(loop_get_blocks(loop), blocks_iter) {
+      block_t *block = GET_DATA_T(block_t*, blocks_iter);
+      sig = (sig ^ (uint64_t) (uintptr_t) block) * 1099511628211ULL;
+      sig = (sig ^ (uint64_t) block_get_size(block)) * 1099511628211ULL;
+   }
+
+   return sig;
+}
+
+/*
+ * Frees the DDG edges saved in a loop by lcore_loop[path]_getddg[_ext]
+ * \param loop a loop
+ */
+void lcore_loop_free_ddg_cache(loop_t *loop)
+{
+   if (loop == NULL || loop->ddg_cache == NULL)
+      return;
+
+   struct ddg_cache_s *cache = loop->ddg_cache;
+   if (cache->paths_edges[0] != NULL) free_paths_edges(cache->paths_edges[0]);
+   if (cache->paths_edges[1] != NULL) free_paths_edges(cache->paths_edges[1]);
+   lc_free(cache);
+   loop->ddg_cache = NULL;
+}
+
+/* Returns DDG edges for each path of a loop (CF get_obj_paths_edges), from the loop cache if valid */
+static array_t *get_loop_paths_edges(loop_t *loop, int only_RAW)
+{
+   const uint64_t blocks_sig = get_blocks_signature(loop);
+   const int idx = (only_RAW == FALSE) ? 0 : 1;
+
+   /* Loop blocks changed since edges were computed */
+   if (loop->ddg_cache != NULL && loop->ddg_cache->blocks_sig != blocks_sig)
+      lcore_loop_free_ddg_cache(loop);
+
+   if (loop->ddg_cache == NULL) {
+      loop->ddg_cache = lc_malloc0(sizeof *(loop->ddg_cache));
+      loop->ddg_cache->blocks_sig = blocks_sig;
+   }
+
+   if (loop->ddg_cache->paths_edges[idx] == NULL)
+      loop->ddg_cache->paths_edges[idx] = get_obj_paths_edges (loop, only_RAW,
+            _loop_get_paths, loop_compute_paths, loop_free_paths);
+
+   return loop->ddg_cache->paths_edges[idx];
+}
+
 /* CF lcore_looppath_getddg and build_DDG */
 static queue_t *looppath_getddg(loop_t *loop, int only_RAW)
 {
    arch_t *arch = asmfile_get_arch (loop_get_asmfile (loop));
-   return objpath_getddg (loop, only_RAW, _loop_get_paths, loop_compute_paths, loop_free_paths, arch);
+   return objpath_getddg (get_loop_paths_edges (loop, only_RAW), arch);
 }
 
 /* CF lcore_loop_getddg and build_DDG */
 static graph_t *loop_getddg(loop_t *loop, int only_RAW)
 {
    arch_t *arch = asmfile_get_arch (loop_get_asmfile (loop));
-   return obj_getddg(loop, only_RAW, _loop_get_paths, loop_compute_paths, loop_free_paths, arch);
+   return obj_getddg (get_loop_paths_edges (loop, only_RAW), arch);
 }
 
 /*
@@ -29,10 +29,28 @@
 ///////////////////////////////////////////////////////////////////////////////
 //										Dominance analysis									  //
 ///////////////////////////////////////////////////////////////////////////////
+/**
+ * Blocks of a function in the order they are fully explored by a traversal
+ */
+typedef struct postorder_s {
+   fct_t* fct; /**<Function whose blocks are saved*/
+   queue_t* blocks; /**<Saved blocks*/
+} postorder_t;
+
+/**
+ * Adds a block in a postorder (used by graph_node_DFS_iterative and graph_node_BackDFS_iterative).
+ * Blocks of other functions (reached by cross-function edges) are ignored: they can be analyzed
+ * concurrently and their ids are not valid indexes for the current function.
+ * \param node a CFG node
+ * \param user a postorder_t structure
+ */
 static void _DFS_postorder(graph_node_t* node, void* user)
 {
-   queue_t* postorder = (queue_t*) user;
-   queue_add_tail(postorder, node->data);
+   postorder_t* postorder = (postorder_t*) user;
+   block_t* b = node->data;
+
+   if (block_get_fct(b) == postorder->fct)
+      queue_add_tail(postorder->blocks, b);
 }
 
 static block_t* _intersect(block_t* b1, block_t* b2, block_t** doms,
@@ -53,7 +71,7 @@ static block_t* _intersect(block_t* b1, block_t* b2, block_t** doms,
 void _compute_dominance(fct_t* fct)
 {
    block_t* start_node = FCT_ENTRY(fct);
-   queue_t* postorder = queue_new();
+   postorder_t postorder = { fct, queue_new() };
    queue_t* reverse_postorder = queue_new();
    int* postorder_index = lc_malloc(fct_get_nb_blocks(fct) * sizeof(int));
    block_t** doms = lc_malloc(fct_get_nb_blocks(fct) * sizeof(block_t*));
@@ -64,8 +82,8 @@ void _compute_dominance(fct_t* fct)
 
    // Order nodes in reverse-postorder
    i = 0;
-   graph_node_DFS(start_node->cfg_node, NULL, &_DFS_postorder, NULL, postorder);
-   FOREACH_INQUEUE(postorder, it_b) {
+   graph_node_DFS_iterative(start_node->cfg_node, NULL, &_DFS_postorder, NULL, &postorder);
+   FOREACH_INQUEUE(postorder.blocks, it_b) {
       block_t* b = GET_DATA_T(block_t*, it_b);
       queue_add_head(reverse_postorder, b);
       postorder_index[b->id] = i++;
@@ -82,23 +100,27 @@ void _compute_dominance(fct_t* fct)
          block_t* b = GET_DATA_T(block_t*, it_b);
          if (b != start_node) {
             new_idom = NULL;
+            first_processed_pred = NULL;
 
             // get the first processed predecessor
             FOREACH_INLIST(b->cfg_node->in, it_ed) {
                graph_edge_t* ed = GET_DATA_T(graph_edge_t*, it_ed);
                block_t* tmp = ed->from->data;
-               if (doms[tmp->id] != NULL) {
+               if (block_get_fct(tmp) == fct && doms[tmp->id] != NULL) {
                   first_processed_pred = tmp;
                   break;
                }
             }
+            // no processed predecessor in the function yet
+            if (first_processed_pred == NULL)
+               continue;
 
             // then iterate over other predecessors
             new_idom = first_processed_pred;
             FOREACH_INLIST(b->cfg_node->in, it_ed0) {
                graph_edge_t* ed = GET_DATA_T(graph_edge_t*, it_ed0);
                block_t* p = ed->from->data;
-               if (p != first_processed_pred) {
+               if (p != first_processed_pred && block_get_fct(p) == fct) {
                   if (doms[p->id] != NULL)
                      new_idom = _intersect(p, new_idom, doms, postorder_index);
                }
@@ -115,13 +137,24 @@ void _compute_dominance(fct_t* fct)
    FOREACH_INQUEUE(fct->blocks, it_b1) {
       block_t* b = GET_DATA_T(block_t*, it_b1);
       block_t* Db = doms[b->id];
-      if (block_is_padding(b) == 0 && Db != b)
+      if (block_is_padding(b) == 0 && Db != NULL && Db != b)
          tree_insert(Db->domination_node, b->domination_node);
    }
    lc_free(doms);
    lc_free(postorder_index);
    queue_free(reverse_postorder, NULL);
-   queue_free(postorder, NULL);
+   queue_free(postorder.blocks, NULL);
+}
+
+/**
+ * Computes dominance of a function (used by lcore_foreach_fct_parallel)
+ * \param f a function
+ * \param user unused
+ */
+static void _compute_dominance_task(fct_t* f, void* user)
+{
+   (void) user;
+   _compute_dominance(f);
 }
 
 /*
@@ -137,10 +170,7 @@ void lcore_analyze_dominance(asmfile_t *asmfile)
       return;
 
    DBGMSG0("computing domination\n");
-   FOREACH_INQUEUE(asmfile_get_fcts(asmfile), iter) {
-      fct_t *f = GET_DATA_T(fct_t*, iter);
-      _compute_dominance(f);
-   }
+   lcore_foreach_fct_parallel(asmfile, &_compute_dominance_task, NULL);
 
    asmfile->analyze_flag |= DOM_ANALYZE;
 }
@@ -178,7 +208,7 @@ static void remove_virtual_end(fct_t* f)
 
 void _compute_post_dominance(fct_t* fct)
 {
-   queue_t* postorder = queue_new();
+   postorder_t postorder = { fct, queue_new() };
    queue_t* reverse_postorder = queue_new();
    int* postorder_index = lc_malloc(fct_get_nb_blocks(fct) * sizeof(int));
    block_t** postdoms = lc_malloc(fct_get_nb_blocks(fct) * sizeof(block_t*));
@@ -197,8 +227,8 @@ void _compute_post_dominance(fct_t* fct)
 
    // Order nodes in reverse-postorder
    i = 0;
-   graph_node_BackDFS(start_node->cfg_node, NULL, &_DFS_postorder, NULL, postorder);
-   FOREACH_INQUEUE(postorder, it_b) {
+   graph_node_BackDFS_iterative(start_node->cfg_node, NULL, &_DFS_postorder, NULL, &postorder);
+   FOREACH_INQUEUE(postorder.blocks, it_b) {
       block_t* b = GET_DATA_T(block_t*, it_b);
       queue_add_head(reverse_postorder, b);
       postorder_index[b->id] = i++;
@@ -215,22 +245,26 @@ void _compute_post_dominance(fct_t* fct)
          block_t* b = GET_DATA_T(block_t*, it_b);
          if (b != start_node) {
             new_ipostdom = NULL;
+            first_processed_succ = NULL;
 
             // get the first processed successor
             FOREACH_INLIST(b->cfg_node->out, it_ed) {
                graph_edge_t* ed = GET_DATA_T(graph_edge_t*, it_ed);
                block_t* tmp = ed->to->data;
-               if (postdoms[tmp->id] != NULL) {
+               if (block_get_fct(tmp) == fct && postdoms[tmp->id] != NULL) {
                   first_processed_succ = tmp;
                   break;
                }
             }
+            // no processed successor in the function yet
+            if (first_processed_succ == NULL)
+               continue;
             // then iterate over other successors
             new_ipostdom = first_processed_succ;
             FOREACH_INLIST(b->cfg_node->out, it_ed0) {
                graph_edge_t* ed = GET_DATA_T(graph_edge_t*, it_ed0);
                block_t* p = ed->to->data;
-               if (p != first_processed_succ) {
+               if (p != first_processed_succ && block_get_fct(p) == fct) {
                   if (postdoms[p->id] != NULL)
                      new_ipostdom = _intersect(p, new_ipostdom, postdoms,
                            postorder_index);
@@ -249,7 +283,7 @@ void _compute_post_dominance(fct_t* fct)
    FOREACH_INQUEUE(fct->blocks, it_b1) {
       block_t* b = GET_DATA_T(block_t*, it_b1);
       block_t* Db = postdoms[b->id];
-      if (block_is_padding(b) == 0 && Db != b) {
+      if (block_is_padding(b) == 0 && Db != NULL && Db != b) {
          tree_insert(Db->postdom_node, b->postdom_node);
       }
    }
@@ -257,7 +291,20 @@ void _compute_post_dominance(fct_t* fct)
    lc_free(postdoms);
    lc_free(postorder_index);
    queue_free(reverse_postorder, NULL);
-   queue_free(postorder, NULL);
+   queue_free(postorder.blocks, NULL);
+}
+
+/**
+ * Computes post dominance of a function (used by lcore_foreach_fct_parallel)
+ * \param f a function
+ * \param user unused
+ */
+static void _compute_post_dominance_task(fct_t* f, void* user)
+{
+   (void) user;
+   add_virtual_end(f);
+   _compute_post_dominance(f);
+   remove_virtual_end(f);
 }
 
 /*
@@ -275,12 +322,7 @@ void lcore_analyze_post_dominance(asmfile_t *asmfile)
       return;
 
    DBGMSG0("computing post-domination\n");
-   FOREACH_INQUEUE(asmfile_get_fcts(asmfile), iter) {
-      fct_t *f = GET_DATA_T(fct_t*, iter);
-      add_virtual_end(f);
-      _compute_post_dominance(f);
-      remove_virtual_end(f);
-   }
+   lcore_foreach_fct_parallel(asmfile, &_compute_post_dominance_task, NULL);
    asmfile->analyze_flag |= PDO_ANALYZE;
 }
 
@@ -44,9 +44,6 @@ extern int arm64_lcore_get_nb_registers (arch_t* arch);
 /* ************************************************************************* *
  *                               Internals
  * ************************************************************************* */
-#define USE_FLAG 1   /**<Flag indicating that the variable belongs to USE set*/
-#define DEF_FLAG 2   /**<Flag indicating that the variable belongs to DEF set*/
-
 /**
  * Returns an id corresponding to a register
  * Used in Live register analysis and SSA computation
@@ -107,15 +104,82 @@ reg_t* __IDreg(int id, arch_t* A)
    return (A->regs[type][name]);
 }
 
-void lcore_compute_use_def_in_block(block_t* b, char** UseDef, char mode)
+/**
+ * Returns the number of registers handled by the live register analysis
+ * \param arch an architecture
+ * \param mode if TRUE, use the context saving specific version
+ * \return number of registers, or -1 if the mode is not supported for the architecture
+ */
+static int _get_nb_registers(arch_t* arch, char mode)
+{
+   if (mode == FALSE)
+      return lcore_get_nb_registers(arch);
+   if (arch->code == ARCH_arm64) {
+#ifdef _ARCHDEF_arm64
+      return arm64_lcore_get_nb_registers(arch);
+#endif
+   }
+   return -1;
+}
+
+/**
+ * Adds a register to the USE set of a block if it does not belong to its DEF set
+ * \param b the block
+ * \param use USE set of the block
+ * \param def DEF set of the block
+ * \param V a register
+ * \param _regID function returning the identifier of a register
+ * \param ctxt context of the use, printed in debug messages
+ */
+static void _add_use(block_t* b, uint64_t* use, uint64_t* def, reg_t* V,
+      regid_f _regID, const char* ctxt)
 {
    arch_t* arch = b->function->asmfile->arch;
-   int (*_regID)(reg_t*, arch_t*) = arch_regid(arch,mode);
+   int id = _regID(V, arch);
+   if (!LIVE_REGSET_HAS(def, id)) {
+      LIVE_REGSET_ADD(use, id);
+      DBGMSG("%sUse(%d) += %s\n", ctxt, b->global_id,
+            arch_get_reg_name(arch, V->type, V->name));
+   }
+   (void) ctxt;
+}
 
+/**
+ * Adds a register to the DEF set of a block if it does not belong to its USE set
+ * \param b the block
+ * \param use USE set of the block
+ * \param def DEF set of the block
+ * \param V a register
+ * \param _regID function returning the identifier of a register
+ * \param ctxt context of the definition, printed in debug messages
+ */
+static void _add_def(block_t* b, uint64_t* use, uint64_t* def, reg_t* V,
+      regid_f _regID, const char* ctxt)
+{
+   arch_t* arch = b->function->asmfile->arch;
+   int id = _regID(V, arch);
+   if (!LIVE_REGSET_HAS(use, id)) {
+      LIVE_REGSET_ADD(def, id);
+      DBGMSG("%sDef(%d) += %s\n", ctxt, b->global_id,
+            arch_get_reg_name(arch, V->type, V->name));
+   }
+   (void) ctxt;
+}
+
+/**
+ * Computes USE and DEF sets of a basic block
+ * \param b a basic block
+ * \param use USE set of the block, updated with registers used before being defined
+ * \param def DEF set of the block, updated with registers defined before being used
+ * \param _regID function returning the identifier of a register
+ */
+static void _compute_use_def_in_block(block_t* b, uint64_t* use, uint64_t* def,
+      regid_f _regID)
+{
+   arch_t* arch = b->function->asmfile->arch;
    insn_t* in = NULL;
    int i = 0;
    oprnd_t* op = NULL;
-   reg_t* V = NULL;
    reg_t** implicits = NULL;
    int nb_implicits = 0;
 
@@ -125,23 +189,10 @@ void lcore_compute_use_def_in_block(block_t* b, char** UseDef, char mode)
 
       // Handle calls to external functions. Based on the AMD64 System V ABI.
       if (((insn_get_annotate(in) & A_CALL) != 0)) {
-         int i;
-         for (i = 0; i < arch->nb_arg_regs; i++) {
-            reg_t* V = arch->arg_regs[i];
-            if ((UseDef[b->id][_regID(V, arch)] & DEF_FLAG) == 0) {
-               UseDef[b->id][_regID(V, arch)] |= USE_FLAG;
-               DBGMSG("Call: Use(%d) += %s\n", b->global_id,
-                     arch_get_reg_name(arch, V->type, V->name));
-            }
-         }
-         for (i = 0; i < arch->nb_return_regs; i++) {
-            reg_t* V = arch->return_regs[i];
-            if ((UseDef[b->id][_regID(V, arch)] & USE_FLAG) == 0) {
-               UseDef[b->id][_regID(V, arch)] |= DEF_FLAG;
-               DBGMSG("Call: Def(%d) += %s\n", b->global_id,
-                     arch_get_reg_name(arch, V->type, V->name));
-            }
-         }
+         for (i = 0; i < arch->nb_arg_regs; i++)
+            _add_use(b, use, def, arch->arg_regs[i], _regID, "Call: ");
+         for (i = 0; i < arch->nb_return_regs; i++)
+            _add_def(b, use, def, arch->return_regs[i], _regID, "Call: ");
       }
 
       // -------------------------------------------------------------------
@@ -152,49 +203,25 @@ void lcore_compute_use_def_in_block(block_t* b, char** UseDef, char mode)
             switch (oprnd_get_type(op)) {
             case OT_REGISTER:
             case OT_REGISTER_INDEXED:
-               V = oprnd_get_reg(op);
-               if ((UseDef[b->id][_regID(V, arch)] & DEF_FLAG) == 0) {
-                  UseDef[b->id][_regID(V, arch)] |= USE_FLAG;
-                  DBGMSG("Use(%d) += %s\n", b->global_id,
-                        arch_get_reg_name(arch, V->type, V->name));
-               }
+               _add_use(b, use, def, oprnd_get_reg(op), _regID, "");
                break;
 
             case OT_MEMORY:
             case OT_MEMORY_RELATIVE:
-               if (oprnd_get_base(op)) {
-                  V = oprnd_get_base(op);
-                  if ((UseDef[b->id][_regID(V, arch)] & DEF_FLAG) == 0) {
-                     UseDef[b->id][_regID(V, arch)] |= USE_FLAG;
-                     DBGMSG("Use(%d) += %s\n", b->global_id,
-                           arch_get_reg_name(arch, V->type, V->name));
-                  }
-               }
-
-               if (oprnd_get_index(op)) {
-                  V = oprnd_get_index(op);
-                  if ((UseDef[b->id][_regID(V, arch)] & DEF_FLAG) == 0) {
-                     UseDef[b->id][_regID(V, arch)] |= USE_FLAG;
-                     DBGMSG("Use(%d) += %s\n", b->global_id,
-                           arch_get_reg_name(arch, V->type, V->name));
-                  }
-               }
+               if (oprnd_get_base(op))
+                  _add_use(b, use, def, oprnd_get_base(op), _regID, "");
+               if (oprnd_get_index(op))
+                  _add_use(b, use, def, oprnd_get_index(op), _regID, "");
                break;
             default:
                break;   //To avoid compilation warnings
             }
          }
       }
-      implicits = b->function->asmfile->arch->get_implicite_src(arch,
-            insn_get_opcode_code(in), &nb_implicits);
-      for (i = 0; i < nb_implicits; i++) {
-         V = implicits[i];
-         if ((UseDef[b->id][_regID(V, arch)] & DEF_FLAG) == 0) {
-            UseDef[b->id][_regID(V, arch)] |= USE_FLAG;
-            DBGMSG("Use(%d) += %s\n", b->global_id,
-                  arch_get_reg_name(arch, V->type, V->name));
-         }
-      }
+      implicits = arch->get_implicite_src(arch, insn_get_opcode_code(in),
+            &nb_implicits);
+      for (i = 0; i < nb_implicits; i++)
+         _add_use(b, use, def, implicits[i], _regID, "");
       if (implicits != NULL)
          lc_free(implicits);
 
@@ -202,76 +229,165 @@ void lcore_compute_use_def_in_block(block_t* b, char** UseDef, char mode)
       // Def: Iterate over operands to get registers defined before to be used
       for (i = 0; i < insn_get_nb_oprnds(in); i++) {
          op = insn_get_oprnd(in, i);
-         if (oprnd_is_dst(op) && oprnd_is_reg(op)) {
-            reg_t* V = oprnd_get_reg(op);
-            if ((UseDef[b->id][_regID(V, arch)] & USE_FLAG) == 0) {
-               UseDef[b->id][_regID(V, arch)] |= DEF_FLAG;
-               DBGMSG("Def(%d) += %s\n", b->global_id,
-                     arch_get_reg_name(arch, V->type, V->name));
-            }
-         }
-      }
-      implicits = b->function->asmfile->arch->get_implicite_dst(arch,
-            insn_get_opcode_code(in), &nb_implicits);
-      for (i = 0; i < nb_implicits; i++) {
-         V = implicits[i];
-         if ((UseDef[b->id][_regID(V, arch)] & USE_FLAG) == 0) {
-            UseDef[b->id][_regID(V, arch)] |= DEF_FLAG;
-            DBGMSG("Def(%d) += %s\n", b->global_id,
-                  arch_get_reg_name(arch, V->type, V->name));
-         }
+         if (oprnd_is_dst(op) && oprnd_is_reg(op))
+            _add_def(b, use, def, oprnd_get_reg(op), _regID, "");
       }
+      implicits = arch->get_implicite_dst(arch, insn_get_opcode_code(in),
+            &nb_implicits);
+      for (i = 0; i < nb_implicits; i++)
+         _add_def(b, use, def, implicits[i], _regID, "");
       if (implicits != NULL)
          lc_free(implicits);
+   }
+}
 
+/*
+ * Compute Use/Def set for a basic block
+ * \param b a basic block to analyze
+ * \param UseDef an array used to store use / def, built as the array returned
+ *         by lcore_compute_live_registers functions.
+ * \param mode if TRUE, use the context saving specific version
+ */
+void lcore_compute_use_def_in_block(block_t* b, char** UseDef, char mode)
+{
+   arch_t* arch = b->function->asmfile->arch;
+   int nb_reg = _get_nb_registers(arch, mode);
+   if (nb_reg < 0)
+      return;
+   int nb_words = LIVE_REGSET_NB_WORDS(nb_reg);
+   uint64_t* use = lc_malloc0(2 * nb_words * sizeof(uint64_t));
+   uint64_t* def = use + nb_words;
+   int i;
+
+   for (i = 0; i < nb_reg; i++) {
+      if (UseDef[b->id][i] & USE_FLAG)
+         LIVE_REGSET_ADD(use, i);
+      if (UseDef[b->id][i] & DEF_FLAG)
+         LIVE_REGSET_ADD(def, i);
    }
+   _compute_use_def_in_block(b, use, def, arch_regid(arch, mode));
+   for (i = 0; i < nb_reg; i++) {
+      if (LIVE_REGSET_HAS(use, i))
+         UseDef[b->id][i] |= USE_FLAG;
+      if (LIVE_REGSET_HAS(def, i))
+         UseDef[b->id][i] |= DEF_FLAG;
+   }
+   lc_free(use);
 }
 
 /*
  * Compute Use and Def sets for each basic block
  * \param f a function
- * \param UseDef an array used to return Use and Def sets. Its structure
- *               is detailed in lcore_compute_live_registers
+ * \param use USE sets, nb_words words per block, indexed by block id
+ * \param def DEF sets, same structure than use
+ * \param nb_words number of words in a register set
  */
-static void _compute_use_def(fct_t* f, char** UseDef, char mode)
+static void _compute_use_def(fct_t* f, uint64_t* use, uint64_t* def,
+      int nb_words, char mode)
 {
    arch_t* arch = f->asmfile->arch;
-   block_t* b = NULL;
    int i = 0;
    block_t* entry = fct_get_main_entry(f);
-   int (*_regID)(reg_t*, arch_t*) = arch_regid(arch,mode);
-
-   for (i = 0; i < arch->nb_arg_regs; i++) {
-      reg_t* V = arch->arg_regs[i];
-      if ((UseDef[entry->id][_regID(V, arch)] & DEF_FLAG) == 0) {
-         UseDef[entry->id][_regID(V, arch)] |= USE_FLAG;
-         DBGMSG("Entry: Use(%d) += %s\n", entry->global_id,
-               arch_get_reg_name(arch, V->type, V->name));
-      }
-   }
+   regid_f _regID = arch_regid(arch, mode);
+
+   for (i = 0; i < arch->nb_arg_regs; i++)
+      _add_use(entry, use + entry->id * nb_words, def + entry->id * nb_words,
+            arch->arg_regs[i], _regID, "Entry: ");
 
    // Iterate over function instructions block per block
    FOREACH_INQUEUE(f->blocks, it_b)
    {
-      b = GET_DATA_T(block_t*, it_b);
-      lcore_compute_use_def_in_block(b, UseDef, mode);
+      block_t* b = GET_DATA_T(block_t*, it_b);
+      _compute_use_def_in_block(b, use + b->id * nb_words,
+            def + b->id * nb_words, _regID);
+   }
+}
+
+/**
+ * Orders the blocks of a function in reverse postorder of a depth-first
+ * traversal of the CFG starting from the main entry. Blocks not reachable
+ * from it are traversed afterwards, in the order of the function.
+ * \param f a function whose blocks identifiers are up to date
+ * \param nb_blocks number of blocks of f
+ * \return an array of nb_blocks blocks
+ */
+static block_t** _get_reverse_postorder(fct_t* f, int nb_blocks)
+{
+   block_t** order = lc_malloc(nb_blocks * sizeof(block_t*));
+   block_t** stack = lc_malloc(nb_blocks * sizeof(block_t*));
+   list_t** edges = lc_malloc(nb_blocks * sizeof(list_t*));
+   char* visited = lc_malloc0(nb_blocks * sizeof(char));
+   int pos = nb_blocks;
+   block_t* entry = fct_get_main_entry(f);
+   list_t* it_root = queue_iterator(f->blocks);
+
+   while (pos > 0) {
+      // Picks the next root: the main entry first, then unvisited blocks
+      block_t* root = NULL;
+      if (entry != NULL && !visited[entry->id])
+         root = entry;
+      while (root == NULL && it_root != NULL) {
+         block_t* b = GET_DATA_T(block_t*, it_root);
+         if (!visited[b->id])
+            root = b;
+         it_root = it_root->next;
+      }
+      if (root == NULL)
+         break;
+
+      int top = 0;
+      visited[root->id] = TRUE;
+      stack[0] = root;
+      edges[0] = root->cfg_node->out;
+      while (top >= 0) {
+         block_t* b = stack[top];
+         list_t* it_ed = edges[top];
+         block_t* S = NULL;
+
+         // Looks for the next unvisited successor of b in the function
+         while (it_ed != NULL && S == NULL) {
+            block_t* succ = GET_DATA_T(graph_edge_t*, it_ed)->to->data;
+            if (succ->function == f && !visited[succ->id])
+               S = succ;
+            it_ed = it_ed->next;
+         }
+         edges[top] = it_ed;
+         if (S != NULL) {
+            visited[S->id] = TRUE;
+            top++;
+            stack[top] = S;
+            edges[top] = S->cfg_node->out;
+         } else {
+            order[--pos] = b;
+            top--;
+         }
+      }
    }
+   lc_free(stack);
+   lc_free(edges);
+   lc_free(visited);
+   return order;
 }
 
 /*
- * Computes IN and OUT sets for a given function
+ * Computes IN and OUT sets for a given function.
+ * Blocks are processed from a worklist initialized in postorder (reverse of
+ * the reverse postorder), so that successors are usually handled before
+ * their predecessors. A block is added back to the worklist when the IN set
+ * of one of its successors grows.
  * \param f a function
- * \param UseDef USE / DEF sets. Computed using _compute_use_def
- * \param InOut Used to return IN and OUT sets.
- * \param nb_reg number of registers (second dimension of UseDef or InOut)
+ * \param use USE sets. Computed using _compute_use_def
+ * \param def DEF sets. Computed using _compute_use_def
+ * \param inout Used to return IN and OUT sets (see lcore_compute_live_regsets)
+ * \param nb_words number of words in a register set
+ * \param nb_blocks number of blocks of f
  */
-static void _compute_in_out(fct_t* f, char** UseDef, char**InOut, int nb_reg,
-      int mode)
+static void _compute_in_out(fct_t* f, uint64_t* use, uint64_t* def,
+      uint64_t* inout, int nb_words, int nb_blocks, char mode)
 {
-   int changes = TRUE;
    int i = 0;
    arch_t* arch = f->asmfile->arch;
-   int (*_regID)(reg_t*, arch_t*) = arch_regid(arch,mode);
+   regid_f _regID = arch_regid(arch, mode);
 
    // Handle exits. Based on the AMD64 System V ABI.
    FOREACH_INQUEUE(f->blocks, exit_b) {
@@ -283,7 +399,8 @@ static void _compute_in_out(fct_t* f, char** UseDef, char**InOut, int nb_reg,
          if (insn_get_annotate(in) & A_EX) {
             for (i = 0; i < arch->nb_return_regs; i++) {
                reg_t* V = arch->return_regs[i];
-               InOut[b->id][_regID(V, arch)] |= OUT_FLAG;
+               LIVE_REGSET_ADD(LIVE_REGSET_OUT(inout, nb_words, b->id),
+                     _regID(V, arch));
                DBGMSG("Exit: OUT(%d) += %s\n", b->global_id,
                      arch_get_reg_name(arch, V->type, V->name));
             }
@@ -292,36 +409,62 @@ static void _compute_in_out(fct_t* f, char** UseDef, char**InOut, int nb_reg,
       }
    }
 
-   while (changes) {
-      changes = FALSE;
-      FOREACH_INQUEUE(f->blocks, it_b)
-      {
-         block_t* b = GET_DATA_T(block_t*, it_b);
-
-         // ----------------------------------------------------------------
-         // OUT(B) = U In(S), S a successor of B
-         FOREACH_INLIST(b->cfg_node->out, it_ed) {
-            graph_edge_t* ed = GET_DATA_T(graph_edge_t*, it_ed);
-            block_t* S = ed->to->data;
+   // The worklist is a circular buffer: each block is at most once in it
+   block_t** order = _get_reverse_postorder(f, nb_blocks);
+   block_t** worklist = lc_malloc(nb_blocks * sizeof(block_t*));
+   char* in_worklist = lc_malloc(nb_blocks * sizeof(char));
+   int head = 0, nb_pending = nb_blocks;
+   for (i = 0; i < nb_blocks; i++) {
+      worklist[i] = order[nb_blocks - 1 - i];
+      in_worklist[i] = TRUE;
+   }
+   lc_free(order);
+
+   while (nb_pending > 0) {
+      block_t* b = worklist[head];
+      head = (head + 1) % nb_blocks;
+      nb_pending--;
+      in_worklist[b->id] = FALSE;
+
+      uint64_t* in_b = LIVE_REGSET_IN(inout, nb_words, b->id);
+      uint64_t* out_b = LIVE_REGSET_OUT(inout, nb_words, b->id);
+      uint64_t* use_b = use + b->id * nb_words;
+      uint64_t* def_b = def + b->id * nb_words;
+      uint64_t changes = 0;
+
+      // ----------------------------------------------------------------
+      // OUT(B) = U In(S), S a successor of B
+      FOREACH_INLIST(b->cfg_node->out, it_ed) {
+         block_t* S = GET_DATA_T(graph_edge_t*, it_ed)->to->data;
+         if (S->function != f)
+            continue;
+         uint64_t* in_S = LIVE_REGSET_IN(inout, nb_words, S->id);
+         for (i = 0; i < nb_words; i++)
+            out_b[i] |= in_S[i];
+      }
 
-            for (i = 0; i < nb_reg; i++)
-               if (InOut[S->id][i] & IN_FLAG)
-                  InOut[b->id][i] |= OUT_FLAG;
-         }
+      // ----------------------------------------------------------------
+      // IN(B) = Use(B) U (Out(B) - Def(B))
+      for (i = 0; i < nb_words; i++) {
+         uint64_t in = use_b[i] | (out_b[i] & ~def_b[i]);
+         changes |= in & ~in_b[i];
+         in_b[i] |= in;
+      }
 
-         // ----------------------------------------------------------------
-         // IN(B) = Use(B) U (Out(B) - Def(B))
-         for (i = 0; i < nb_reg; i++) {
-            if ((UseDef[b->id][i] & USE_FLAG)
-                  || ((UseDef[b->id][i] & DEF_FLAG) == 0
-                        && (InOut[b->id][i] & OUT_FLAG))) {
-               if ((InOut[b->id][i] & IN_FLAG) == 0)
-                  changes = TRUE;
-               InOut[b->id][i] |= IN_FLAG;
-            }
+      // IN(B) has grown: OUT of predecessors must be updated
+      if (changes != 0) {
+         FOREACH_INLIST(b->cfg_node->in, it_ed) {
+            block_t* P = GET_DATA_T(graph_edge_t*, it_ed)->from->data;
+            if (P->function != f || in_worklist[P->id])
+               continue;
+            worklist[(head + nb_pending) % nb_blocks] = P;
+            nb_pending++;
+            in_worklist[P->id] = TRUE;
          }
       }
    }
+   lc_free(worklist);
+   lc_free(in_worklist);
 }
 
 /*
@@ -344,6 +487,59 @@ int lcore_get_nb_registers(arch_t* arch)
    return (nb_families * arch->nb_names_registers);
 }
 
+/*
+ * Computes live registers in a given function, as packed register sets
+ * \param fct a function to analyze
+ * \param nb_words used to return the number of words in a register set
+ * \param mode if TRUE, use the context saving specific version
+ * \return NULL if problem, else an array containing IN and OUT sets, to
+ *         access with LIVE_REGSET_IN and LIVE_REGSET_OUT
+ */
+uint64_t* lcore_compute_live_regsets(fct_t* fct, int* nb_words, char mode)
+{
+   if (fct == NULL) {
+      *nb_words = 0;
+      return NULL;
+   }
+   fct_upd_blocks_id(fct);
+   fct->asmfile->free_live_registers = &lcore_free_live_registers;
+
+   // Computes the number of register families (used to allocate register sets)
+   arch_t* arch = fct->asmfile->arch;
+   int nb_reg = _get_nb_registers(arch, mode);
+   if (nb_reg < 0) {
+      *nb_words = 0;
+      return NULL;
+   }
+   *nb_words = LIVE_REGSET_NB_WORDS(nb_reg);
+
+   // If live registers have already been computed, just return them
+   if (fct->live_regsets != NULL)
+      return (fct->live_regsets);
+
+   // -------------------------------------------------------------------------
+   // Define and initialize variables
+   // All sets are stored in contiguous arrays of *nb_words words per block,
+   // indexed by block id. Bit j of a set is the register whose id is j.
+   int nb_blocks = fct_get_nb_blocks(fct);
+   uint64_t* use = lc_malloc0(2 * nb_blocks * (*nb_words) * sizeof(uint64_t));
+   uint64_t* def = use + nb_blocks * (*nb_words);
+   uint64_t* inout = lc_malloc0(2 * nb_blocks * (*nb_words) * sizeof(uint64_t));
+
+   // -------------------------------------------------------------------------
+   // Compute USE and DEF for each block in the function
+   _compute_use_def(fct, use, def, *nb_words, mode);
+
+   // -------------------------------------------------------------------------
+   // Compute IN and OUT for each block in the function
+   if (nb_blocks > 0)
+      _compute_in_out(fct, use, def, inout, *nb_words, nb_blocks, mode);
+
+   lc_free(use);
+   fct->live_regsets = inout;
+   return (inout);
+}
+
 /*
  * Computes live registers in a given function
  * \param fct a function to analyze
@@ -360,64 +556,31 @@ int lcore_get_nb_registers(arch_t* arch)
  */
 char** lcore_compute_live_registers(fct_t* fct, int* nb_reg, char mode)
 {
-   if (fct == NULL) {
+   int nb_words = 0;
+   uint64_t* inout = lcore_compute_live_regsets(fct, &nb_words, mode);
+   if (inout == NULL) {
       *nb_reg = 0;
       return NULL;
    }
-   fct_upd_blocks_id(fct);
-   fct->asmfile->free_live_registers = &lcore_free_live_registers;
-
-   // -------------------------------------------------------------------------
-   // Define and initialize variables
-   char ** UseDef = NULL;        // Array of flags. UseDef[i] contains Use / Def
-                                 // for the block i and UseDef[i][j] is the flag
-                                 // for standardized variable whose 'id' is
-                                 // (family(reg) * nb_reg_name + name(reg) + 1)
-   char ** InOut = NULL;         // Array of flags. Same structure than useDef
-   arch_t* arch = fct->asmfile->arch;
+   (*nb_reg) = _get_nb_registers(fct->asmfile->arch, mode);
 
-   // Computes the number of register families (used to allocate Use / Def structures)
-   if (mode == FALSE)
-      (*nb_reg) = lcore_get_nb_registers(arch);
-   else {
-      if (arch->code == ARCH_arm64) {
-#ifdef _ARCHDEF_arm64
-         (*nb_reg) = arm64_lcore_get_nb_registers(arch);
-#else
-         return NULL;
-#endif
-      }
-   }
-
-   // If live registers have already been computed, just return them
+   // If live registers have already been expanded, just return them
    if (fct->live_registers != NULL)
       return (fct->live_registers);
 
-   UseDef = lc_malloc0(fct_get_nb_blocks(fct) * sizeof(char*));
-   InOut = lc_malloc0(fct_get_nb_blocks(fct) * sizeof(char*));
-
-   FOREACH_INQUEUE(fct->blocks, it_b0) {
-      block_t* b = GET_DATA_T(block_t*, it_b0);
-      UseDef[b->id] = lc_malloc0((*nb_reg) * sizeof(char));
+   // Expands packed sets into one array of flags per block
+   char** InOut = lc_malloc0(fct_get_nb_blocks(fct) * sizeof(char*));
+   FOREACH_INQUEUE(fct->blocks, it_b) {
+      block_t* b = GET_DATA_T(block_t*, it_b);
+      uint64_t* in = LIVE_REGSET_IN(inout, nb_words, b->id);
+      uint64_t* out = LIVE_REGSET_OUT(inout, nb_words, b->id);
+      int i;
       InOut[b->id] = lc_malloc0((*nb_reg) * sizeof(char));
+      for (i = 0; i < *nb_reg; i++)
+         InOut[b->id][i] = (LIVE_REGSET_HAS(in, i) ? IN_FLAG : 0)
+               | (LIVE_REGSET_HAS(out, i) ? OUT_FLAG : 0);
    }
 
-   // -------------------------------------------------------------------------
-   // Compute USE and DEF for each block in the function
-   _compute_use_def(fct, UseDef, mode);
-
-   // -------------------------------------------------------------------------
-   // Compute IN and OUT for each block in the function
-   _compute_in_out(fct, UseDef, InOut, *nb_reg, mode);
-
-   // -------------------------------------------------------------------------
-   // Free memory
-   FOREACH_INQUEUE(fct->blocks, it_b2) {
-      block_t* b = GET_DATA_T(block_t*, it_b2);
-      lc_free(UseDef[b->id]);
-   }
-   lc_free(UseDef);
-
    fct->live_registers = InOut;
    return (InOut);
 }
@@ -428,7 +591,9 @@ char** lcore_compute_live_registers(fct_t* fct, int* nb_reg, char mode)
  */
 void lcore_free_live_registers(fct_t* fct)
 {
-   if (fct != NULL && fct->live_registers != NULL) {
+   if (fct == NULL)
+      return;
+   if (fct->live_registers != NULL) {
       FOREACH_INQUEUE(fct->blocks, it_b) {
          block_t* b = GET_DATA_T(block_t*, it_b);
          lc_free(fct->live_registers[b->id]);
@@ -436,4 +601,8 @@ void lcore_free_live_registers(fct_t* fct)
       lc_free(fct->live_registers);
       fct->live_registers = NULL;
    }
+   if (fct->live_regsets != NULL) {
+      lc_free(fct->live_regsets);
+      fct->live_regsets = NULL;
+   }
 }
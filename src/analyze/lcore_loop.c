@@ -142,6 +142,10 @@ block_t *loop_constructor(block_t *root, int* NextDfn, global_t* global)
    //------ FIRST STEP ---------------------------------------------------------
    FOREACH_INLIST_REVERT(l, succiter) {
       block_t *b = GET_DATA_T(block_t*, GET_DATA_T(graph_edge_t*, succiter)->to);
+      // Blocks of other functions (cross-function edges) are not part of the loops of this
+      // function, and their loops can be built concurrently
+      if (block_get_fct(b) != block_get_fct(root))
+         continue;
       if (!global->order[block_get_id(b)].traversed) {
          // CASE (A) : new block
          DBGMSGLVL(2, "Block %d has not been analysed yet: building loops starting from it\n", block_get_id(b));
@@ -253,8 +257,8 @@ block_t *loop_constructor(block_t *root, int* NextDfn, global_t* global)
                {
                   block_t *b = GET_DATA_T(block_t*,
                         (GET_DATA_T(graph_edge_t*, blockiter))->to);
-                  //block not in loop
-                  if (b->loop == NULL) {
+                  //block not in loop (or in another function)
+                  if (block_get_fct(b) != block_get_fct(block) || b->loop == NULL) {
                      if (list_lookup(loop->exits, block) == NULL)
                         loop->exits = list_add_before(loop->exits, block);
                      block->is_loop_exit = 1;
@@ -292,7 +296,7 @@ block_t *loop_constructor(block_t *root, int* NextDfn, global_t* global)
                      {
                         block_t *b = GET_DATA_T(block_t*,
                               (GET_DATA_T(graph_edge_t*, blockiter))->to);
-                        if (b->loop) {
+                        if (b->loop && block_get_fct(b) == block_get_fct(iter)) {
                            if ((b->loop != loop)
                                  && ((b->loop->hierarchy_node->parent
                                        && !tree_is_ancestor(
@@ -378,6 +382,24 @@ static void build_loops(fct_t *f, global_t* global)
    lc_free(global->order);
 }
 
+/**
+ * Task launched by the parallel loop detection: each function uses its own
+ * global_t structure
+ * \param f a function
+ * \param user unused
+ */
+static void _build_loops_task(fct_t* f, void* user)
+{
+   (void) user;
+   global_t global;
+   global.order = NULL;
+   global.Bstack = NULL;
+   global.remove_from_stack = NULL;
+
+   DBGMSG("Analyzing loops of function %s\n", fct_get_name(f));
+   build_loops(f, &global);
+}
+
 /**
  * \brief After loop detection we need to verify if there are no remaining loops which are actually a connected
  * component's entry and not inserted into the connected components' entries list. This phase needs the loops hierarchy.
@@ -522,16 +544,25 @@ void lcore_analyze_loops(asmfile_t *asmfile)
       return;
    }
 
-   global_t global;
-   global.order = NULL;
-   global.Bstack = NULL;
-   global.remove_from_stack = NULL;
-
    DBGMSG0("computing loops\n");
-   FOREACH_INQUEUE(asmfile->functions, iter) {
-      f = GET_DATA_T(fct_t*, iter);
-      DBGMSG("Analyzing loops of function %s\n", fct_get_name(f));
-      build_loops(f, &global);
+   if (lcore_get_nb_threads(asmfile) > 1) {
+      // Loops of each function are detected in parallel, then renumbered
+      // to get the same global identifiers than a sequential detection
+      int first_id = asmfile->maxid_loop;
+      lcore_foreach_fct_parallel(asmfile, &_build_loops_task, NULL);
+      lcore_renumber_loops(asmfile, first_id);
+   }
+   else {
+      global_t global;
+      global.order = NULL;
+      global.Bstack = NULL;
+      global.remove_from_stack = NULL;
+
+      FOREACH_INQUEUE(asmfile->functions, iter) {
+         f = GET_DATA_T(fct_t*, iter);
+         DBGMSG("Analyzing loops of function %s\n", fct_get_name(f));
+         build_loops(f, &global);
+      }
    }
    asmfile->analyze_flag |= LOO_ANALYZE;
    //Special case where an independent loop is not recognized as a CC
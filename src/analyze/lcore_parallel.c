@@ -0,0 +1,138 @@
+/*
+   Copyright (C) 2004 - 2018 Université de Versailles Saint-Quentin-en-Yvelines (UVSQ)
+
+   This file is part of MAQAO.
+
+  MAQAO is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public License
+   as published by the Free Software Foundation; either version 3
+   of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "libmcore.h"
+
+/**
+ * \file
+ * \brief Drives per-function analyses on a pool of threads.
+ *
+ * Used by dominance, post dominance and loop detection. Each function owns its
+ * blocks, loops and analysis results, but CFG edges can lead to blocks of other
+ * functions: these passes ignore such blocks, so a task only writes to its own
+ * function. The other shared data are the asmfile counters (maxid_block,
+ * n_blocks, maxid_loop), which are updated atomically.
+ *
+ * Paths, live registers, SSA, grouping and polytopes stay sequential: the
+ * analyze and CQA drivers compute them lazily, one function or loop at a time,
+ * so no step runs them on every function.
+ * */
+
+///////////////////////////////////////////////////////////////////////////////
+//                        Parallel analysis driver                           //
+///////////////////////////////////////////////////////////////////////////////
+/**
+ * \struct fct_tasks_s
+ * Parameters of a parallel iteration over functions
+ */
+typedef struct fct_tasks_s {
+   fct_t** fcts; /**<Array of functions to analyze*/
+   void (*f)(fct_t*, void*); /**<Function to execute on each function*/
+   void* user; /**<User parameter given to f*/
+} fct_tasks_t;
+
+/**
+ * Task of the thread pool: analyzes one function
+ * \param task_id index of the function
+ * \param user a fct_tasks_t structure
+ */
+static void _fct_task(int task_id, void* user)
+{
+   fct_tasks_t* tasks = user;
+   tasks->f(tasks->fcts[task_id], tasks->user);
+}
+
+/*
+ * Returns the number of threads to use to analyze functions of an asmfile
+ * \param asmfile an existing asmfile
+ * \return number of threads (1 if the parameter is not set)
+ */
+int lcore_get_nb_threads(asmfile_t* asmfile)
+{
+   if (asmfile == NULL)
+      return 1;
+   int nb_threads = (int) (int64_t) asmfile_get_parameter(asmfile,
+         PARAM_MODULE_LCORE, PARAM_LCORE_NB_THREADS);
+
+   if (nb_threads < 0)
+      return threadpool_get_nb_cpus();
+   if (nb_threads == 0)
+      return 1;
+   return nb_threads;
+}
+
+/*
+ * Executes a function on each function of an asmfile, using a thread pool
+ * if the asmfile is configured to use several threads.
+ * \param asmfile an existing asmfile
+ * \param f function to execute on each asmfile function
+ * \param user a parameter given by the user to f
+ */
+void lcore_foreach_fct_parallel(asmfile_t* asmfile, void (*f)(fct_t*, void*),
+      void* user)
+{
+   if (asmfile == NULL || f == NULL)
+      return;
+   int nb_threads = lcore_get_nb_threads(asmfile);
+   int nb_fcts = queue_length(asmfile->functions);
+   if (nb_fcts == 0)
+      return;
+
+   if (nb_threads <= 1) {
+      FOREACH_INQUEUE(asmfile->functions, it_f) {
+         f(GET_DATA_T(fct_t*, it_f), user);
+      }
+      return;
+   }
+
+   fct_tasks_t tasks;
+   int i = 0;
+   tasks.fcts = lc_malloc(nb_fcts * sizeof(fct_t*));
+   tasks.f = f;
+   tasks.user = user;
+   FOREACH_INQUEUE(asmfile->functions, it_f) {
+      tasks.fcts[i++] = GET_DATA_T(fct_t*, it_f);
+   }
+
+   DBGMSG("Analyzing %d functions with %d threads\n", nb_fcts, nb_threads);
+   threadpool_run(nb_threads, nb_fcts, &_fct_task, &tasks);
+   lc_free(tasks.fcts);
+}
+
+/*
+ * Renumbers the global identifiers of loops in functions order
+ * \param asmfile an existing asmfile
+ * \param first_id identifier of the first loop
+ */
+void lcore_renumber_loops(asmfile_t* asmfile, int first_id)
+{
+   if (asmfile == NULL)
+      return;
+   int id = first_id;
+
+   FOREACH_INQUEUE(asmfile->functions, it_f) {
+      fct_t* f = GET_DATA_T(fct_t*, it_f);
+      FOREACH_INQUEUE(f->loops, it_l) {
+         loop_t* l = GET_DATA_T(loop_t*, it_l);
+         l->global_id = id++;
+      }
+   }
+   asmfile->maxid_loop = id;
+}
@@ -235,6 +235,147 @@ void lcore_loop_freepaths(loop_t *l)
    l->paths = NULL;
 }
 
+/*
+ * Lazy and top-K paths
+ * Unlike lcore_fct/loop_computepaths, the number of paths is not limited: paths are either
+ * enumerated one at a time or restricted to the K heaviest ones.
+ */
+
+/*
+ * Creates an iterator over the paths of a function
+ * \param f a function (with a single entry)
+ * \return a new iterator, to use with lcore_paths_iter_next and free with graph_paths_iter_free, or NULL
+ */
+graph_paths_iter_t *lcore_fct_paths_iter_new(fct_t *f)
+{
+   if (f == NULL || FCT_NB_ENTRIES (f) != 1)
+      return NULL;
+
+   block_t *root_block = queue_peek_head(fct_get_entry_blocks(f));
+
+   return graph_node_paths_iter_new(root_block->cfg_node);
+}
+
+/*
+ * Creates an iterator over the paths of a loop
+ * \param l a loop (with a single entry)
+ * \return a new iterator, to use with lcore_paths_iter_next and free with graph_paths_iter_free, or NULL
+ */
+graph_paths_iter_t *lcore_loop_paths_iter_new(loop_t *l)
+{
+   if (l == NULL || LOOP_NB_ENTRIES (l) != 1)
+      return NULL;
+
+   block_t *root_block = list_getdata(loop_get_entries(l));
+
+   // The iterator saves the loop subgraph: the CFG can be restored immediately
+   list_t* removed_edges = remove_edges_for_subgraph(l);
+   graph_paths_iter_t *iter = graph_node_paths_iter_new(root_block->cfg_node);
+   restore_edges_for_subgraph(removed_edges);
+
+   return iter;
+}
+
+/*
+ * Returns the next path of a function or a loop
+ * \param iter an iterator returned by lcore_fct/loop_paths_iter_new
+ * \param path an array, flushed and filled with the blocks of the next path
+ * \return path or NULL if no more paths
+ */
+array_t *lcore_paths_iter_next(graph_paths_iter_t *iter, array_t *path)
+{
+   array_t *path_nodes = graph_paths_iter_next(iter);
+   if (path_nodes == NULL || path == NULL)
+      return NULL;
+
+   array_flush(path, NULL);
+   FOREACH_INARRAY(path_nodes, it_n) {
+      graph_node_t *node = ARRAY_GET_DATA(node, it_n);
+      array_add(path, GET_DATA_T(block_t*, node));
+   }
+
+   return path;
+}
+
+/** Block weight function and its user parameter, passed to graph_node_get_top_paths */
+typedef struct {
+   float (*get_weight)(block_t *, void *);
+   void *user;
+} block_weight_t;
+
+/** Returns the weight of a CFG node: its block weight or, by default, its number of instructions */
+static float get_node_weight(const graph_node_t *node, void *data)
+{
+   block_weight_t *bw = data;
+   block_t *block = GET_DATA_T(block_t*, node);
+
+   if (bw->get_weight != NULL)
+      return bw->get_weight(block, bw->user);
+
+   return (float) block_get_size(block);
+}
+
+/** Converts paths of CFG nodes into paths of blocks */
+static queue_t *nodes_to_blocks_paths(queue_t *paths)
+{
+   FOREACH_INQUEUE(paths, it_p) {
+      array_t *path = GET_DATA_T(array_t*, it_p);
+      FOREACH_INARRAY(path, it_n) {
+         graph_node_t *node = ARRAY_GET_DATA(node, it_n);
+         *it_n = GET_DATA_T(block_t*, node);
+      }
+   }
+
+   return paths;
+}
+
+/*
+ * Returns the K heaviest paths of a function
+ * \param f a function (with a single entry)
+ * \param k maximum number of paths
+ * \param get_weight function returning the weight of a block (for instance its execution count), with user as second parameter.
+ * If NULL, the weight of a block is its number of instructions
+ * \param user a parameter given by the user to get_weight
+ * \return queue of paths (arrays of blocks) by decreasing weight, to free with graph_free_paths, or NULL
+ */
+queue_t *lcore_fct_get_top_paths(fct_t *f, int k,
+      float (*get_weight)(block_t *, void *), void *user)
+{
+   if (f == NULL || FCT_NB_ENTRIES (f) != 1)
+      return NULL;
+
+   block_t *root_block = queue_peek_head(fct_get_entry_blocks(f));
+   block_weight_t bw = { get_weight, user };
+
+   return nodes_to_blocks_paths(graph_node_get_top_paths(root_block->cfg_node,
+         k, get_node_weight, &bw));
+}
+
+/*
+ * Returns the K heaviest paths of a loop
+ * \param l a loop (with a single entry)
+ * \param k maximum number of paths
+ * \param get_weight CF lcore_fct_get_top_paths
+ * \param user a parameter given by the user to get_weight
+ * \return queue of paths (arrays of blocks) by decreasing weight, to free with graph_free_paths, or NULL
+ */
+queue_t *lcore_loop_get_top_paths(loop_t *l, int k,
+      float (*get_weight)(block_t *, void *), void *user)
+{
+   if (l == NULL || LOOP_NB_ENTRIES (l) != 1)
+      return NULL;
+
+   block_t *root_block = list_getdata(loop_get_entries(l));
+   block_weight_t bw = { get_weight, user };
+
+   list_t* removed_edges = remove_edges_for_subgraph(l);
+   queue_t *paths = graph_node_get_top_paths(root_block->cfg_node, k,
+         get_node_weight, &bw);
+   restore_edges_for_subgraph(removed_edges);
+
+   return nodes_to_blocks_paths(paths);
+}
+
 /*
  * \brief returns the number of paths without computing them
  * \param fct_t* f the targeted loop
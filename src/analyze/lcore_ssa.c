@@ -90,23 +90,30 @@
  */
 typedef struct ssa_context_s {
    fct_t* f; /**<Current function*/
-   hashtable_t* DF; /**<Dominance Frontier. 
-    key  : (block_t*)
-    data : (queue_t*) of (block_t*) */
-   hashtable_t* A; /**<Set of variables and blocks assigning them.
-    key  : (reg_t*)
-    data : (queue_t*) of (block_t*) */
+   block_t** dt_blocks; /**<Blocks of the dominator tree, in preorder*/
+   int* DF_start; /**<Dominance Frontier, CSR offsets indexed by block id.
+    DF of block b is DF[DF_start[b->id]] to DF[DF_start[b->id + 1] - 1]*/
+   block_t** DF; /**<Dominance Frontier, CSR elements*/
+   int* A_start; /**<Set of variables and blocks assigning them, CSR offsets
+    indexed by the id of a register (macro __regID(reg, arch))*/
+   block_t** A; /**<Set of variables and blocks assigning them, CSR elements*/
+   reg_t** A_reg; /**<Standardized register for each register id in A*/
    int* C; /**<Number of assignment processed for each (reg_t*).
     The index of a register is computed using 
     the macro __regID(reg, arch).*/
-   queue_t** S; /**<Stack of assignment processed for each (reg_t*).
+   int* S; /**<Top of the stack of assignment processed for each (reg_t*).
     The index of a register is computed using 
     the macro __regID(reg, arch).*/
+   int* undo; /**<Stack of (register id, previous top of S) pairs, used to
+    restore S when leaving a block*/
+   int nb_undo; /**<Number of pairs in undo*/
+   int max_undo; /**<Number of pairs undo can store*/
    ssa_insn_t*** def; /**<Array of definitions for each (reg_t*)
     The index of a register is computed using
     the macro __regID(reg, arch). Each subtable
     contains pointers on (ssa_insn_t*) defining
     the (reg_t*)*/
+   int* def_size; /**<Allocated size of each subtable in def*/
    arch_t* arch; /**<Architecture of current function*/
    ssa_block_t** ssa_blocks; /**<Array of ssa blocks*/
    int nb_reg; /**<Number of register in current architecture*/
@@ -488,174 +495,266 @@ static block_t* idom(block_t* X)
 }
 
 /*
- * Computes the Dominance Frontier of a block 
- * \param tX node in the dominance tree of the block to analyze
+ * Lists the blocks of the dominator tree rooted at the function entry,
+ * in preorder
  * \param cntxt current context
+ * \param entry the function entry
+ * \return number of blocks saved in cntxt->dt_blocks
  */
-static void _computes_DF(tree_t* tX, ssa_context_t* cntxt)
+static int _list_dominator_tree(ssa_context_t* cntxt, block_t* entry)
 {
-   if (tX == NULL)
-      return;
-
-   tree_t *tY = tX->children, *tZ = NULL;
-   block_t *bX = NULL, *bY = NULL;
-   queue_t *DF_X = NULL, *DF_Z = NULL;
+   int nb_blocks = fct_get_nb_blocks(cntxt->f);
+   tree_t** stack = lc_malloc(nb_blocks * sizeof(tree_t*));
+   int nb_stack = 0, nb = 0;
 
-   // Bottom-up traversal of the dominator tree
-   while (tY != NULL) {
-      _computes_DF(tY, cntxt);
-      tY = tY->next;
+   cntxt->dt_blocks = lc_malloc(nb_blocks * sizeof(block_t*));
+   if (entry == NULL || entry->domination_node == NULL) {
+      lc_free(stack);
+      return (0);
    }
-
-   // Add DF_local
-   bX = tX->data;
-   DF_X = hashtable_lookup(cntxt->DF, bX);
-   FOREACH_INLIST(bX->cfg_node->out, it_ed) {
-      graph_edge_t* ed = GET_DATA_T(graph_edge_t*, it_ed);
-      bY = ed->to->data;
-      if (idom(bY) != bX)
-         queue_add_tail(DF_X, bY);
+   stack[nb_stack++] = entry->domination_node;
+   while (nb_stack > 0) {
+      tree_t* tX = stack[--nb_stack];
+      tree_t* tY = tX->children;
+
+      cntxt->dt_blocks[nb++] = tX->data;
+      for (; tY != NULL && nb_stack < nb_blocks; tY = tY->next)
+         stack[nb_stack++] = tY;
    }
+   lc_free(stack);
+   return (nb);
+}
 
-   // Add DF_up
-   tZ = tX->children;
-   while (tZ != NULL) {
-      DF_Z = hashtable_lookup(cntxt->DF, tZ->data);
-      FOREACH_INQUEUE(DF_Z, it_Y) {
-         bY = GET_DATA_T(block_t*, it_Y);
-         if (idom(bY) != bX)
-            queue_add_tail(DF_X, bY);
+/*
+ * Computes the Dominance Frontier of all blocks of the dominator tree.
+ * For each edge P->Y, Y belongs to the frontier of P and of all dominators
+ * of P up to (excluding) the immediate dominator of Y. Results are saved in
+ * CSR form: the frontier of block b is DF[DF_start[b->id]..DF_start[b->id+1][.
+ * \param cntxt current context
+ * \param nb_dt number of blocks in the dominator tree (cntxt->dt_blocks)
+ */
+static void _computes_DF(ssa_context_t* cntxt, int nb_dt)
+{
+   int nb_blocks = fct_get_nb_blocks(cntxt->f);
+   int* stamp = lc_malloc(nb_blocks * sizeof(int));
+   int* pos = lc_malloc0((nb_blocks + 1) * sizeof(int));
+   char* in_dt = lc_malloc0(nb_blocks * sizeof(char));
+   int pass = 0, i = 0;
+
+   for (i = 0; i < nb_dt; i++)
+      in_dt[cntxt->dt_blocks[i]->id] = TRUE;
+
+   // First pass counts the frontier size of each block, second one fills it.
+   // stamp[X] is the last block Y added to DF(X): as dominators of X are
+   // already in DF(Y) too when it is set, the walk stops there.
+   for (pass = 0; pass < 2; pass++) {
+      memset(stamp, -1, nb_blocks * sizeof(int));
+      for (i = 0; i < nb_dt; i++) {
+         block_t* bY = cntxt->dt_blocks[i];
+         block_t* idomY = idom(bY);
+
+         FOREACH_INLIST(bY->cfg_node->in, it_ed) {
+            graph_edge_t* ed = GET_DATA_T(graph_edge_t*, it_ed);
+            block_t* runner = ed->from->data;
+
+            if (runner->function != cntxt->f || in_dt[runner->id] == FALSE)
+               continue;
+            while (runner != NULL && runner != idomY
+                  && stamp[runner->id] != (int) bY->id) {
+               stamp[runner->id] = bY->id;
+               if (pass == 0)
+                  pos[runner->id + 1]++;
+               else
+                  cntxt->DF[pos[runner->id]++] = bY;
+               runner = idom(runner);
+            }
+         }
+      }
+      if (pass == 0) {
+         for (i = 0; i < nb_blocks; i++)
+            pos[i + 1] += pos[i];
+         memcpy(cntxt->DF_start, pos, (nb_blocks + 1) * sizeof(int));
+         cntxt->DF = lc_malloc((pos[nb_blocks] + 1) * sizeof(block_t*));
       }
-      tZ = tZ->next;
    }
+   lc_free(stamp);
+   lc_free(pos);
+   lc_free(in_dt);
 }
 
 /* ************************************************************************* *
  *                         To insert phi-functions
  * ************************************************************************* */
 /*
- * Macro defined to does not duplicate some code
- * into  __compute_A function
+ * Saves a block as a definition site of a register
+ * \param cntxt current context
+ * \param o_reg a register defined in b
+ * \param b current block
+ * \param last last block saved for each register id
+ * \param pairs array of (register id, block id) pairs, resized if needed
+ * \param nb_pairs number of pairs in pairs
+ * \param max_pairs size of pairs
  */
-#define __compute_Av {\
-   if (o_reg != NULL)\
-   {\
-      s_reg = standardize_reg (o_reg, cntxt->arch);\
-      queue_t* Av = hashtable_lookup (cntxt->A, s_reg);\
-      if (Av == NULL)\
-      {\
-         Av = queue_new ();\
-         hashtable_insert (cntxt->A, s_reg, Av);\
-      }\
-      if (queue_peek_tail (Av) != b)\
-         queue_add_tail (Av, b);\
-   }\
+static void __add_defsite(ssa_context_t* cntxt, reg_t* o_reg, block_t* b,
+      int* last, int** pairs, int* nb_pairs, int* max_pairs)
+{
+   if (o_reg == NULL)
+      return;
+   int id = __regID(o_reg, cntxt->arch);
+
+   if (last[id] == (int) b->id)
+      return;
+   last[id] = b->id;
+   if (cntxt->A_reg[id] == NULL)
+      cntxt->A_reg[id] = standardize_reg(o_reg, cntxt->arch);
+   if (*nb_pairs == *max_pairs) {
+      *max_pairs *= 2;
+      *pairs = lc_realloc(*pairs, (*max_pairs) * 2 * sizeof(int));
+   }
+   (*pairs)[(*nb_pairs) * 2] = id;
+   (*pairs)[(*nb_pairs) * 2 + 1] = b->id;
+   (*nb_pairs)++;
 }
 
 /*
- * Computes the set of used registers and blocks defining them
+ * Computes the set of defined registers and blocks defining them.
+ * Results are saved in CSR form: blocks defining the register whose id is r
+ * are A[A_start[r]..A_start[r+1][, in the order of the function blocks.
  * \param cntxt current context
  */
 static void __compute_A(ssa_context_t* cntxt)
 {
    int i = 0;
-   oprnd_t* oprnd = NULL;
-   reg_t *o_reg = NULL, *s_reg = NULL;
+   int nb_pairs = 0, max_pairs = 64;
+   int* pairs = lc_malloc(max_pairs * 2 * sizeof(int));
+   int* last = lc_malloc(cntxt->nb_reg * sizeof(int));
+   int* pos = lc_malloc0((cntxt->nb_reg + 1) * sizeof(int));
+   block_t** blocks = lc_malloc(fct_get_nb_blocks(cntxt->f) * sizeof(block_t*));
+
+   memset(last, -1, cntxt->nb_reg * sizeof(int));
+   cntxt->A_reg = lc_malloc0(cntxt->nb_reg * sizeof(reg_t*));
 
    // Iterates over all instructions in the function
    // to analyze operands
    FOREACH_INQUEUE(cntxt->f->blocks, it_b)
    {
       block_t* b = GET_DATA_T(block_t*, it_b);
+      blocks[b->id] = b;
 
       FOREACH_INSN_INBLOCK(b, it_in)
       {
          insn_t* in = GET_DATA_T(insn_t*, it_in);
-         // For each operand, get used registers, standardize them
-         // then add them into used registers
+         // For each operand, get defined registers
          for (i = 0; i < insn_get_nb_oprnds(in); i++) {
-            oprnd = insn_get_oprnd(in, i);
-            if (oprnd_is_reg(oprnd) == TRUE && oprnd_is_dst(oprnd) == TRUE) {
-               o_reg = oprnd_get_reg(oprnd);
-               __compute_Av;
-            }
+            oprnd_t* oprnd = insn_get_oprnd(in, i);
+            if (oprnd_is_reg(oprnd) == TRUE && oprnd_is_dst(oprnd) == TRUE)
+               __add_defsite(cntxt, oprnd_get_reg(oprnd), b, last, &pairs,
+                     &nb_pairs, &max_pairs);
          }
 
          int nb_implicits = 0;
          reg_t** implicits = cntxt->arch->get_implicite_dst(cntxt->arch,
                insn_get_opcode_code(in), &nb_implicits);
-         for (i = 0; i < nb_implicits; i++) {
-            o_reg = implicits[i];
-            __compute_Av;
-         }
+         for (i = 0; i < nb_implicits; i++)
+            __add_defsite(cntxt, implicits[i], b, last, &pairs, &nb_pairs,
+                  &max_pairs);
          if (implicits != NULL)
             lc_free(implicits);
-
       }
    }
+
+   // Counting sort of (register, block) pairs on the register id
+   for (i = 0; i < nb_pairs; i++)
+      pos[pairs[i * 2] + 1]++;
+   for (i = 0; i < cntxt->nb_reg; i++)
+      pos[i + 1] += pos[i];
+   cntxt->A_start = lc_malloc((cntxt->nb_reg + 1) * sizeof(int));
+   memcpy(cntxt->A_start, pos, (cntxt->nb_reg + 1) * sizeof(int));
+   cntxt->A = lc_malloc((nb_pairs + 1) * sizeof(block_t*));
+   for (i = 0; i < nb_pairs; i++)
+      cntxt->A[pos[pairs[i * 2]]++] = blocks[pairs[i * 2 + 1]];
+
+   lc_free(pairs);
+   lc_free(last);
+   lc_free(pos);
+   lc_free(blocks);
 }
 
 /*
- * Inserts phi functions in the current function
+ * Inserts phi functions in the current function (pruned SSA).
+ * Only registers live at the entry of at least one block (global registers)
+ * are considered, then a phi-function is added only where the register is
+ * live.
+ * Semi-pruned SSA (globals computed from a local scan, without liveness) is
+ * not used: _rename_variables reads all register operands, destinations
+ * included, so the phi-functions it adds where a register is dead are
+ * referenced by instructions and change the reaching definitions seen by
+ * users of the SSA.
  * \param cntxt current context
- * \param InOut Array with live registers results
+ * \param live live registers sets, returned by lcore_compute_live_regsets
+ * \param nb_words number of words in a register set
  */
-static void _insert_phi_functions(ssa_context_t* cntxt, char** InOut)
+static void _insert_phi_functions(ssa_context_t* cntxt, uint64_t* live,
+      int nb_words)
 {
-   long int IterCount = 0;
-   queue_t* W = queue_new();
+   int nb_blocks = fct_get_nb_blocks(cntxt->f);
+   int IterCount = 0, nb_W = 0, i = 0, k = 0;
+   block_t** W = lc_malloc(nb_blocks * sizeof(block_t*));
    block_t *bX = NULL, *bY = NULL;
-   queue_t* DF_X = NULL;
-   int* HasAlready = lc_malloc(sizeof(int) * fct_get_nb_blocks(cntxt->f));
-   int* Work = lc_malloc(sizeof(int) * fct_get_nb_blocks(cntxt->f));
+   int* HasAlready = lc_malloc0(sizeof(int) * nb_blocks);
+   int* Work = lc_malloc0(sizeof(int) * nb_blocks);
+   uint64_t* globals = lc_malloc0(nb_words * sizeof(uint64_t));
 
    __compute_A(cntxt);
 
-   // Initializes arrays
+   // Global registers: union of IN sets
    FOREACH_INQUEUE(cntxt->f->blocks, it_b) {
       block_t* b = GET_DATA_T(block_t*, it_b);
-      HasAlready[b->id] = 0;
-      Work[b->id] = 0;
+      uint64_t* in = LIVE_REGSET_IN(live, nb_words, b->id);
+      for (k = 0; k < nb_words; k++)
+         globals[k] |= in[k];
    }
 
    // Iterates over variables
-   FOREACH_INHASHTABLE(cntxt->A, it_V) {
-      reg_t* V = GET_KEY(V, it_V);
-      queue_t* Av = GET_DATA_T(queue_t*, it_V);
+   for (i = 0; i < cntxt->nb_reg; i++) {
+      if (!LIVE_REGSET_HAS(globals, i)
+            || cntxt->A_start[i] == cntxt->A_start[i + 1])
+         continue;
+      reg_t* V = cntxt->A_reg[i];
       IterCount += 1;
 
       // List a set a blocks to analyze
-      FOREACH_INQUEUE(Av, it_X) {
-         bX = GET_DATA_T(block_t*, it_X);
+      for (k = cntxt->A_start[i]; k < cntxt->A_start[i + 1]; k++) {
+         bX = cntxt->A[k];
          Work[bX->id] = IterCount;
-         queue_add_tail(W, bX);
+         W[nb_W++] = bX;
       }
 
-      while (!queue_is_empty(W)) {
-         bX = queue_remove_head(W);
-         DF_X = hashtable_lookup(cntxt->DF, bX);
-         FOREACH_INQUEUE(DF_X, it_Y)
-         {
-            bY = GET_DATA_T(block_t*, it_Y);
+      while (nb_W > 0) {
+         bX = W[--nb_W];
+         for (k = cntxt->DF_start[bX->id]; k < cntxt->DF_start[bX->id + 1];
+               k++) {
+            bY = cntxt->DF[k];
 
             if (HasAlready[bY->id] < IterCount) {
                // if IN[V] then add a new phi-function
-               if (InOut[bY->id][__regID(V, cntxt->arch)] & IN_FLAG)
+               if (LIVE_REGSET_HAS(LIVE_REGSET_IN(live, nb_words, bY->id), i))
                   __new_ssa_insn(V, NULL, bY, cntxt);
                HasAlready[bY->id] = IterCount;
 
                if (Work[bY->id] < IterCount) {
                   Work[bY->id] = IterCount;
-                  queue_add_tail(W, bY);
+                  W[nb_W++] = bY;
                }
             }
          }
       }
    }
 
-   queue_free(W, NULL);
+   lc_free(W);
    lc_free(HasAlready);
    lc_free(Work);
+   lc_free(globals);
 }
 
 /* ************************************************************************* *
@@ -697,45 +796,72 @@ static int __filter_output_LHS(insn_t* in)
    return (0);
 }
 
+/*
+ * Pushes a new definition of a register on its stack
+ * \param cntxt current context
+ * \param id register id
+ * \param ssain the SSA instruction defining the register
+ * \return the index of the new definition
+ */
+static int __push_def(ssa_context_t* cntxt, int id, ssa_insn_t* ssain)
+{
+   int i = cntxt->C[id];
+
+   // Saves the previous top of the stack, restored when leaving the block
+   if (cntxt->nb_undo == cntxt->max_undo) {
+      cntxt->max_undo *= 2;
+      cntxt->undo = lc_realloc(cntxt->undo,
+            cntxt->max_undo * 2 * sizeof(int));
+   }
+   cntxt->undo[cntxt->nb_undo * 2] = id;
+   cntxt->undo[cntxt->nb_undo * 2 + 1] = cntxt->S[id];
+   cntxt->nb_undo++;
+   cntxt->S[id] = i;
+   cntxt->C[id] = i + 1;
+
+   if (i + 2 > cntxt->def_size[id]) {
+      while (i + 2 > cntxt->def_size[id])
+         cntxt->def_size[id] *= 2;
+      cntxt->def[id] = lc_realloc(cntxt->def[id],
+            cntxt->def_size[id] * sizeof(ssa_insn_t*));
+   }
+   cntxt->def[id][i] = ssain;
+   cntxt->def[id][i + 1] = NULL;
+   return (i);
+}
+
 void __handle_LHS_var(void* pcntxt, ssa_insn_t* ssa_insn, reg_t* V)
 {
    ssa_context_t* cntxt = (ssa_context_t*) pcntxt;
-   long int i = cntxt->C[__regID(V, cntxt->arch)];
-   queue_t* Sv = cntxt->S[__regID(V, cntxt->arch)];
+   int id = __regID(V, cntxt->arch);
 
    if (__filter_output_LHS(ssa_insn->in))
       return;
 
+   long int i = __push_def(cntxt, id, ssa_insn);
    ssa_insn->output = lc_realloc(ssa_insn->output,
          (ssa_insn->nb_output + 1) * sizeof(ssa_var_t*));
    ssa_insn->output[ssa_insn->nb_output] = __new_ssa_var(V, i, cntxt->arch);
-   ssa_insn->output[ssa_insn->nb_output]->insn = cntxt->def[__regID(V,
-         cntxt->arch)][i - 1];
+   ssa_insn->output[ssa_insn->nb_output]->insn = cntxt->def[id][i - 1];
    ssa_insn->nb_output = ssa_insn->nb_output + 1;
-
-   queue_add_head(Sv, (void*) i);
-   cntxt->C[__regID(V, cntxt->arch)] = i + 1;
-   cntxt->def[__regID(V, cntxt->arch)] = lc_realloc(
-         cntxt->def[__regID(V, cntxt->arch)], (i + 2) * sizeof(ssa_insn_t*));
-   cntxt->def[__regID(V, cntxt->arch)][i] = ssa_insn;
-   cntxt->def[__regID(V, cntxt->arch)][i + 1] = NULL;
 }
 
 void __handle_RHS_var(void* pcntxt, ssa_insn_t* ssa_insn, reg_t* V, int index)
 {
    ssa_context_t* cntxt = (ssa_context_t*) pcntxt;
-   queue_t* Sv = cntxt->S[__regID(V, cntxt->arch)];
-   ssa_insn->oprnds[index]->index = (long int) queue_peek_head(Sv);
-   ssa_insn->oprnds[index]->insn =
-         cntxt->def[__regID(V, cntxt->arch)][ssa_insn->oprnds[index]->index];
+   int id = __regID(V, cntxt->arch);
+   ssa_insn->oprnds[index]->index = cntxt->S[id];
+   ssa_insn->oprnds[index]->insn = cntxt->def[id][cntxt->S[id]];
 }
 
 /*
- * Recursive function used in variable renaming
+ * Renames variables defined and used in a block, then updates phi-functions
+ * of its successors. Definitions are pushed on register stacks, they are
+ * popped by the caller once the dominator subtree of the block is renamed.
  * \param bX a block
  * \param cntxt current context
  */
-static void SEARCH(block_t* bX, ssa_context_t* cntxt)
+static void __rename_block(block_t* bX, ssa_context_t* cntxt)
 {
    block_t* bY = NULL;
    int nb_implicits = 0;
@@ -763,17 +889,8 @@ static void SEARCH(block_t* bX, ssa_context_t* cntxt)
       // ssain->in != NULL means the instruction is not a phi-function
       if (ssain->in != NULL)
          break;
-      reg_t* V = standardize_reg(ssain->output[0]->reg, cntxt->arch);
-      long int i = cntxt->C[__regID(V, cntxt->arch)];
-      queue_t* Sv = cntxt->S[__regID(V, cntxt->arch)];
-
-      ssain->output[0]->index = i;
-      queue_add_head(Sv, (void*) i);
-      cntxt->C[__regID(V, cntxt->arch)] = i + 1;
-      cntxt->def[__regID(V, cntxt->arch)] = lc_realloc(
-            cntxt->def[__regID(V, cntxt->arch)], (i + 2) * sizeof(ssa_insn_t*));
-      cntxt->def[__regID(V, cntxt->arch)][i] = ssain;
-      cntxt->def[__regID(V, cntxt->arch)][i + 1] = NULL;
+      ssain->output[0]->index = __push_def(cntxt,
+            __regID(ssain->output[0]->reg, cntxt->arch), ssain);
    }
 
    FOREACH_INSN_INBLOCK(bX, it_in) {
@@ -785,28 +902,23 @@ static void SEARCH(block_t* bX, ssa_context_t* cntxt)
       //RHS
       for (iter = 0; iter < insn_get_nb_oprnds(in); iter++) {
          oprnd = insn_get_oprnd(in, iter);
-         reg_t* V = NULL;
 
          //oprnd belongs to RHS if the operand is not a destination operand
          //or if its type is not REGISTER
          switch (oprnd_get_type(oprnd)) {
          case OT_MEMORY:
          case OT_MEMORY_RELATIVE:
-            if (oprnd_get_base(oprnd)) {
-               V = standardize_reg(oprnd_get_base(oprnd), cntxt->arch);
-               __handle_RHS_var(cntxt, ssa_insn, V, iter * 2);
-            }
-
-            if (oprnd_get_index(oprnd)) {
-               V = standardize_reg(oprnd_get_index(oprnd), cntxt->arch);
-               __handle_RHS_var(cntxt, ssa_insn, V, iter * 2 + 1);
-            }
+            if (oprnd_get_base(oprnd))
+               __handle_RHS_var(cntxt, ssa_insn, oprnd_get_base(oprnd),
+                     iter * 2);
+            if (oprnd_get_index(oprnd))
+               __handle_RHS_var(cntxt, ssa_insn, oprnd_get_index(oprnd),
+                     iter * 2 + 1);
             break;
 
          case OT_REGISTER:
          case OT_REGISTER_INDEXED:
-            V = standardize_reg(oprnd_get_reg(oprnd), cntxt->arch);
-            __handle_RHS_var(cntxt, ssa_insn, V, iter * 2);
+            __handle_RHS_var(cntxt, ssa_insn, oprnd_get_reg(oprnd), iter * 2);
             break;
 
          default:
@@ -880,45 +992,55 @@ static void SEARCH(block_t* bX, ssa_context_t* cntxt)
             break;
 
          for (i = 0; i < ssain->nb_output; i++) {
-            reg_t* V = standardize_reg(ssain->output[i]->reg, cntxt->arch);
-            queue_t* Sv = cntxt->S[__regID(V, cntxt->arch)];
-            long int topSV = (long int) queue_peek_head(Sv);
+            int id = __regID(ssain->output[i]->reg, cntxt->arch);
+            int topSV = cntxt->S[id];
             ssain->oprnds[j]->index = topSV;
-            ssain->oprnds[j]->insn = cntxt->def[__regID(V, cntxt->arch)][topSV];
+            ssain->oprnds[j]->insn = cntxt->def[id][topSV];
          }
       }
    }
+}
 
-   // -------------------------------------------------------------------------
-   //Third loop: iterates over block children in DT to analyze them
-   // =================================
-   // for each Y in Children(X) do
-   //    call SEARCH(Y)
-
-   tree_t* tY = bX->domination_node->children;
-   while (tY != NULL) {
-      bY = tY->data;
-      SEARCH(bY, cntxt);
-      tY = tY->next;
-   }
-
-   // -------------------------------------------------------------------------
-   //Fourth loop: iterates over instructions to pop stacks
-   // =================================
-   // for each assignment A in X do
-   //    for each V in oldLHS(A)
-   //       pop S(V)
-
-   FOREACH_INQUEUE(cntxt->ssa_blocks[bX->id]->first_insn, it_phi1)
-   {
-      ssa_insn_t* ssain = GET_DATA_T(ssa_insn_t*, it_phi1);
-      int i = 0;
-      for (i = 0; i < ssain->nb_output; i++) {
-         reg_t* V = ssain->output[i]->reg;
-         queue_t* Sv = cntxt->S[__regID(V, cntxt->arch)];
-         queue_remove_head(Sv);
+/*
+ * Renames variables in a preorder traversal of the dominator tree, using an
+ * explicit stack. Definitions pushed by a block are popped (using the undo
+ * log) once all its children in the dominator tree have been renamed.
+ * \param bEntry the root of the dominator tree
+ * \param cntxt current context
+ */
+static void SEARCH(block_t* bEntry, ssa_context_t* cntxt)
+{
+   int nb_blocks = fct_get_nb_blocks(cntxt->f);
+   tree_t** next = lc_malloc(nb_blocks * sizeof(tree_t*));
+   int* mark = lc_malloc(nb_blocks * sizeof(int));
+   int depth = 0;
+
+   mark[depth] = cntxt->nb_undo;
+   __rename_block(bEntry, cntxt);
+   next[depth] = bEntry->domination_node->children;
+
+   while (depth >= 0) {
+      tree_t* tY = next[depth];
+
+      if (tY != NULL && depth + 1 < nb_blocks) {
+         // Renames the next child of the current block
+         next[depth] = tY->next;
+         depth++;
+         mark[depth] = cntxt->nb_undo;
+         __rename_block(tY->data, cntxt);
+         next[depth] = tY->children;
+      } else {
+         // All children renamed: pops definitions of the current block
+         while (cntxt->nb_undo > mark[depth]) {
+            cntxt->nb_undo--;
+            cntxt->S[cntxt->undo[cntxt->nb_undo * 2]] =
+                  cntxt->undo[cntxt->nb_undo * 2 + 1];
+         }
+         depth--;
       }
    }
+   lc_free(next);
+   lc_free(mark);
 }
 
 /*
@@ -929,17 +1051,18 @@ static void _rename_variables(ssa_context_t* cntxt)
 {
    int i = 0;
 
-   cntxt->C = lc_malloc0(cntxt->nb_reg * sizeof(int));
-   cntxt->S = lc_malloc0(cntxt->nb_reg * sizeof(queue_t*));
-   cntxt->def = lc_malloc0(cntxt->nb_reg * sizeof(queue_t*));
+   cntxt->C = lc_malloc(cntxt->nb_reg * sizeof(int));
+   cntxt->S = lc_malloc0(cntxt->nb_reg * sizeof(int));
+   cntxt->def = lc_malloc0(cntxt->nb_reg * sizeof(ssa_insn_t**));
+   cntxt->def_size = lc_malloc(cntxt->nb_reg * sizeof(int));
+   cntxt->max_undo = 64;
+   cntxt->nb_undo = 0;
+   cntxt->undo = lc_malloc(cntxt->max_undo * 2 * sizeof(int));
 
    // Iterates over variables
-   //FOREACH_INHASHTABLE (cntxt->A, it_V)
    for (i = 0; i < cntxt->nb_reg; i++) {
       cntxt->C[i] = 1;
-      cntxt->S[i] = queue_new();
-      queue_add_head(cntxt->S[i], (void*) 0);
-
+      cntxt->def_size[i] = 2;
       cntxt->def[i] = lc_malloc(sizeof(ssa_insn_t*) * 2);
       cntxt->def[i][0] = NULL;
       cntxt->def[i][1] = NULL;
@@ -982,9 +1105,8 @@ static void _rename_variables(ssa_context_t* cntxt)
             ssa_insn_t* ssain = GET_DATA_T(ssa_insn_t*, it_in);
             if (ssain->in != NULL)
                break;
-            reg_t* V = standardize_reg(ssain->output[0]->reg, cntxt->arch);
             ssain->output[0]->insn =
-                  cntxt->def[__regID(V, cntxt->arch)][ssain->oprnds[pred]->index];
+                  cntxt->def[__regID(ssain->output[0]->reg, cntxt->arch)][ssain->oprnds[pred]->index];
          }
       }
    }
@@ -1279,27 +1401,26 @@ ssa_block_t** lcore_compute_ssa(fct_t* fct)
    // -------------------------------------------------------------------------
    DBGMSG("Computing SSA for function %s\n", fct_get_name(fct));
    block_t* fct_entry = FCT_ENTRY(fct);
-   ssa_context_t* cntxt = lc_malloc(sizeof(ssa_context_t));
-   char** InOut = lcore_compute_live_registers(fct, &(cntxt->nb_reg), FALSE);
+   ssa_context_t* cntxt = lc_malloc0(sizeof(ssa_context_t));
+   int nb_words = 0;
+   uint64_t* live = lcore_compute_live_regsets(fct, &nb_words, FALSE);
    cntxt->f = fct;
-   cntxt->DF = hashtable_new_with_custom_size(direct_hash, direct_equal,
-         fct_get_nb_blocks(fct), TRUE);
-   cntxt->A = hashtable_new(direct_hash, direct_equal);
    cntxt->arch = fct->asmfile->arch;
+   cntxt->nb_reg = lcore_get_nb_registers(cntxt->arch);
+   cntxt->DF_start = lc_malloc0((fct_get_nb_blocks(fct) + 1) * sizeof(int));
    cntxt->ssa_blocks = lc_malloc(sizeof(ssa_block_t*) * fct_get_nb_blocks(fct));
 
    FOREACH_INQUEUE(fct->blocks, it_b) {
       block_t* b = GET_DATA_T(block_t*, it_b);
-      hashtable_insert(cntxt->DF, b, queue_new());
       cntxt->ssa_blocks[b->id] = __new_ssa_block(b);
    }
 
    // Run the analysis
    // -------------------------------------------------------------------------
    DBGMSG0("--- Computing dominance frontier ...\n");
-   _computes_DF(fct_entry->domination_node, cntxt);
+   _computes_DF(cntxt, _list_dominator_tree(cntxt, fct_entry));
    DBGMSG0("--- Computing phi functions ...\n");
-   _insert_phi_functions(cntxt, InOut);
+   _insert_phi_functions(cntxt, live, nb_words);
    DBGMSG0("--- Renaming variables ...\n");
    _rename_variables(cntxt);
    DBGMSG0("--- Simplify phi functions operands ...\n");
@@ -1313,30 +1434,16 @@ ssa_block_t** lcore_compute_ssa(fct_t* fct)
    // -------------------------------------------------------------------------
    // Temporary data (not used outside this function)
    DBGMSG0("--- Free memory ...\n");
-   int i = 0;
-   {
-      FOREACH_INHASHTABLE(cntxt->DF, it_1) {
-         queue_t* q = GET_DATA_T(queue_t*, it_1);
-         queue_free(q, NULL);
-      }
-      hashtable_free(cntxt->DF, NULL, NULL);
-   }
-   {
-      FOREACH_INHASHTABLE(cntxt->A, it_2) {
-         queue_t* q = GET_DATA_T(queue_t*, it_2);
-         queue_free(q, NULL);
-      }
-      hashtable_free(cntxt->A, NULL, NULL);
-   }
-   for (i = 0; i < cntxt->nb_reg; i++) {
-      if (cntxt->S[i])
-         queue_free(cntxt->S[i], NULL);
-      /*if (cntxt->def[i])
-       lc_free (cntxt->def[i]);*/
-   }
+   lc_free(cntxt->dt_blocks);
+   lc_free(cntxt->DF_start);
+   lc_free(cntxt->DF);
+   lc_free(cntxt->A_start);
+   lc_free(cntxt->A);
+   lc_free(cntxt->A_reg);
+   lc_free(cntxt->undo);
    lc_free(cntxt->S);
    lc_free(cntxt->C);
-   //lc_free (cntxt->def);
+   lc_free(cntxt->def_size);
 
    fct->ssa = cntxt;
    //__print_SSA_code (cntxt, stdout);
@@ -236,6 +236,66 @@ extern void lcore_fct_analyze_groups(fct_t* function);
  */
 extern void lcore_asmf_analyze_groups(asmfile_t* asmf, char* fctname);
 
+///////////////////////////////////////////////////////////////////////////////
+//                        Parallel analysis driver                           //
+///////////////////////////////////////////////////////////////////////////////
+/**
+ * Returns the number of threads to use to analyze functions of an asmfile,
+ * based on the PARAM_LCORE_NB_THREADS parameter.
+ * \param asmfile an existing asmfile
+ * \return number of threads (1 if the parameter is not set)
+ */
+extern int lcore_get_nb_threads(asmfile_t* asmfile);
+
+/**
+ * Executes a function on each function of an asmfile, using a work-stealing
+ * thread pool if the asmfile is configured to use several threads.
+ * \param asmfile an existing asmfile
+ * \param f function to execute on each asmfile function. It must only modify
+ *          data belonging to the function it receives
+ * \param user a parameter given by the user to f
+ */
+extern void lcore_foreach_fct_parallel(asmfile_t* asmfile,
+      void (*f)(fct_t*, void*), void* user);
+
+/**
+ * Renumbers the global identifiers of loops in functions order, starting from
+ * a given identifier. Used after a parallel loop detection to get the same
+ * identifiers than a sequential one.
+ * \param asmfile an existing asmfile
+ * \param first_id identifier of the first loop
+ */
+extern void lcore_renumber_loops(asmfile_t* asmfile, int first_id);
+
+///////////////////////////////////////////////////////////////////////////////
+//                           Analysis results cache                          //
+///////////////////////////////////////////////////////////////////////////////
+/**
+ * Saves the results of the flow, loop and connected components analyses of an
+ * asmfile (functions, blocks, CFG, CG, loops hierarchy, connected components
+ * and instructions annotations) in a cache file named after the hash of the
+ * contents of the binary file. The file also identifies the MAQAO version and
+ * the settings used by the analyses, so that it is ignored if one of them changes.
+ * \param asmfile an asmfile whose flow has been analyzed (must be called before
+ *        any other analysis modifies the functions)
+ * \param dir directory containing cache files (created if needed)
+ * \return EXIT_SUCCESS or an error code
+ */
+extern int lcore_cache_save(asmfile_t* asmfile, char* dir);
+
+/**
+ * Loads the results of the flow, loop and connected components analyses of an
+ * asmfile from the cache file saved by lcore_cache_save, instead of running
+ * these analyses
+ * \param asmfile a disassembled asmfile whose flow has not been analyzed yet
+ * \param dir directory containing cache files
+ * \return EXIT_SUCCESS if the results were loaded, else an error code
+ * (ERR_COMMON_FILE_NOT_FOUND if there is no cache file for the binary file,
+ * ERR_ANALYZE_CACHE_NOT_MATCHING if it was saved by another version of MAQAO
+ * or with other settings). In this case, the asmfile is not modified
+ */
+extern int lcore_cache_load(asmfile_t* asmfile, char* dir);
+
 /**
  * Computes the group increment, in bytes.
  * \param group a group to analyze
@@ -283,6 +343,45 @@ extern void lcore_group_memory(fct_t* function, void* user);
 #define USE_FLAG 1   /**<Flag indicating that the variable belongs to USE set*/
 #define DEF_FLAG 2   /**<Flag indicating that the variable belongs to DEF set*/
 
+/**Number of registers stored in each word of a packed register set*/
+#define LIVE_REGSET_WORD_BITS 64
+
+/**
+ * Returns the number of words of a packed register set
+ * \param N number of registers
+ */
+#define LIVE_REGSET_NB_WORDS(N) ((N) / LIVE_REGSET_WORD_BITS + 1)
+
+/**
+ * Checks if a register belongs to a packed register set
+ * \param S a register set (uint64_t*)
+ * \param R a register id
+ */
+#define LIVE_REGSET_HAS(S,R) ((((S)[(R) / LIVE_REGSET_WORD_BITS]) >> ((R) % LIVE_REGSET_WORD_BITS)) & 1)
+
+/**
+ * Adds a register to a packed register set
+ * \param S a register set (uint64_t*)
+ * \param R a register id
+ */
+#define LIVE_REGSET_ADD(S,R) ((S)[(R) / LIVE_REGSET_WORD_BITS] |= (uint64_t) 1 << ((R) % LIVE_REGSET_WORD_BITS))
+
+/**
+ * Returns the IN set of a block in the array returned by lcore_compute_live_regsets
+ * \param S the array returned by lcore_compute_live_regsets
+ * \param W number of words in a register set
+ * \param B identifier of the block
+ */
+#define LIVE_REGSET_IN(S,W,B) ((S) + 2 * (B) * (W))
+
+/**
+ * Returns the OUT set of a block in the array returned by lcore_compute_live_regsets
+ * \param S the array returned by lcore_compute_live_regsets
+ * \param W number of words in a register set
+ * \param B identifier of the block
+ */
+#define LIVE_REGSET_OUT(S,W,B) ((S) + (2 * (B) + 1) * (W))
+
 /**
  * Returns an id corresponding to a register
  * Used in Live register analysis and SSA computation
@@ -338,6 +437,18 @@ extern int arm64_cs_regID(reg_t* X, arch_t* A);
  */
 extern char** lcore_compute_live_registers(fct_t* fct, int* nb_reg, char mode);
 
+/**
+ * Computes live registers in a given function, as packed register sets.
+ * lcore_compute_live_registers returns the same results, with one char per register.
+ * \param fct a function to analyze
+ * \param nb_words used to return the number of words (uint64_t) in a register set
+ * \param mode if TRUE, use the context saving specific version
+ * \return NULL if problem, else an array containing IN and OUT sets of each
+ *         block, to access using LIVE_REGSET_IN and LIVE_REGSET_OUT. Bit j of a
+ *         set (LIVE_REGSET_HAS) is the register whose id is j (see __regID).
+ */
+extern uint64_t* lcore_compute_live_regsets(fct_t* fct, int* nb_words, char mode);
+
 /**
  * Compute Use/Def set for a basic block
  * \param b a basic block to analyze
@@ -841,6 +952,53 @@ extern void lcore_fct_freepaths(fct_t *f);
  */
 extern void lcore_loop_freepaths(loop_t *l);
 
+/**
+ * Creates an iterator over the paths of a function. Paths are enumerated on demand,
+ * one at a time, whatever their number (no FCT_MAX_PATHS limit)
+ * \param f a function (with a single entry)
+ * \return a new iterator, to use with lcore_paths_iter_next and free with graph_paths_iter_free, or NULL
+ */
+extern graph_paths_iter_t *lcore_fct_paths_iter_new(fct_t *f);
+
+/**
+ * Creates an iterator over the paths of a loop. Paths are enumerated on demand,
+ * one at a time, whatever their number (no LOOP_MAX_PATHS limit)
+ * \param l a loop (with a single entry)
+ * \return a new iterator, to use with lcore_paths_iter_next and free with graph_paths_iter_free, or NULL
+ */
+extern graph_paths_iter_t *lcore_loop_paths_iter_new(loop_t *l);
+
+/**
+ * Returns the next path of a function or a loop
+ * \param iter an iterator returned by lcore_fct/loop_paths_iter_new
+ * \param path an array, flushed and filled with the blocks of the next path
+ * \return path or NULL if no more paths
+ */
+extern array_t *lcore_paths_iter_next(graph_paths_iter_t *iter, array_t *path);
+
+/**
+ * Returns the K heaviest paths of a function, whatever its number of paths
+ * \param f a function (with a single entry)
+ * \param k maximum number of paths
+ * \param get_weight function returning the weight of a block (for instance its execution count), with user as second parameter.
+ * If NULL, the weight of a block is its number of instructions
+ * \param user a parameter given by the user to get_weight
+ * \return queue of paths (arrays of blocks) by decreasing weight, to free with graph_free_paths, or NULL
+ */
+extern queue_t *lcore_fct_get_top_paths(fct_t *f, int k,
+      float (*get_weight)(block_t *, void *), void *user);
+
+/**
+ * Returns the K heaviest paths of a loop, whatever its number of paths
+ * \param l a loop (with a single entry)
+ * \param k maximum number of paths
+ * \param get_weight CF lcore_fct_get_top_paths
+ * \param user a parameter given by the user to get_weight
+ * \return queue of paths (arrays of blocks) by decreasing weight, to free with graph_free_paths, or NULL
+ */
+extern queue_t *lcore_loop_get_top_paths(loop_t *l, int k,
+      float (*get_weight)(block_t *, void *), void *user);
+
 /**
  * \brief returns the number of paths without computing them
  * \param f the targeted function
@@ -928,6 +1086,14 @@ extern queue_t *lcore_looppath_getddg_ext(loop_t *loop);
  */
 extern graph_t *lcore_loop_getddg_ext(loop_t *loop);
 
+/**
+ * Frees the DDG edges saved in a loop by lcore_loop[path]_getddg[_ext]
+ * They are reused by next calls while the loop keeps the same blocks.
+ * \warning DDGs of a same loop must not be requested concurrently
+ * \param loop a loop
+ */
+extern void lcore_loop_free_ddg_cache(loop_t *loop);
+
 /**
  * Returns DDG for a path (array of blocks), with only RAW dependencies
  * \param path array of blocks
@@ -305,6 +305,8 @@ void asmfile_free(void* p)
 
    hashtable_free(asmf->data_ptrs_by_target_insn, NULL, NULL);
    hashtable_free(asmf->insn_ptrs_by_target_data, NULL, NULL);
+   //Must be done once all instructions have been freed
+   arena_free(asmf->arena);
    lc_free(asmf);
 
 }
@@ -577,6 +579,21 @@ queue_t* asmfile_get_insns(asmfile_t* asmf)
    return (asmf != NULL) ? asmf->insns : PTR_ERROR;
 }
 
+/*
+ * Gets the arena where instructions and operands of an asmfile are allocated, creating it if needed.
+ * The arena is freed with the asmfile
+ * \param asmf an asmfile
+ * \return the arena of the asmfile or PTR_ERROR if there is a problem
+ */
+arena_t* asmfile_get_arena(asmfile_t* asmf)
+{
+   if (asmf == NULL)
+      return PTR_ERROR;
+   if (asmf->arena == NULL)
+      asmf->arena = arena_new(0);
+   return asmf->arena;
+}
+
 /*
  * Gets the positions of gaps between decompiled instructions of an
  * asmfile.
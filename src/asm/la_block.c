@@ -52,9 +52,10 @@ block_t* block_new(fct_t* fct, insn_t* insn)
    block_t *new = lc_malloc0(sizeof *new);
 
    new->id = queue_length(fct->blocks); //uniq_id;
-   new->global_id = fct->asmfile->maxid_block++;
+   // Counters are shared by all functions, which can be analyzed in parallel
+   new->global_id = ATOMIC_FETCH_ADD(&fct->asmfile->maxid_block, 1);
    DBGMSG("\tNew block has id %d\n", new->global_id);
-   fct->asmfile->n_blocks++;
+   ATOMIC_FETCH_ADD(&fct->asmfile->n_blocks, 1);
 
    if (insn != NULL)
       queue_add_tail(fct->blocks, new);
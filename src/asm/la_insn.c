@@ -28,6 +28,43 @@
 ///////////////////////////////////////////////////////////////////////////////
 //                                  insn                                     //
 ///////////////////////////////////////////////////////////////////////////////
+/**Maximal size in bits of the codings stored inline in instructions allocated in an arena*/
+#define INSN_INLINE_CODING_BITS 64
+
+/**
+ * \brief Instruction allocated in an arena, with room for storing its coding inline
+ * */
+typedef struct insn_inline_s {
+   insn_t insn; /**<The instruction (must be the first member)*/
+   bitvector_t coding; /**<Coding of the instruction, if it is not larger than INSN_INLINE_CODING_BITS*/
+   bitvector_chunk_t chunks[INSN_INLINE_CODING_BITS / (8 * sizeof(bitvector_chunk_t))]; /**<Bits of the inline coding*/
+} insn_inline_t;
+
+/**Arena where the current thread allocates instructions and operands, NULL if they are allocated individually*/
+static THREAD_LOCAL arena_t* insn_arena = NULL;
+
+/*
+ * Sets the arena where the current thread allocates new instructions and operands.
+ * Those are then freed with the arena, and their individual freeing only releases their other members
+ * \param arena An arena, or NULL to allocate instructions and operands individually
+ * \return The arena previously used by the thread
+ * */
+arena_t* insn_set_arena(arena_t* arena)
+{
+   arena_t* prev = insn_arena;
+   insn_arena = arena;
+   return prev;
+}
+
+/*
+ * Returns the arena where the current thread allocates new instructions and operands
+ * \return The arena, or NULL if instructions and operands are allocated individually
+ * */
+arena_t* insn_get_arena()
+{
+   return insn_arena;
+}
+
 /*
  * Creates a new instruction
  * \param arch The architecture for which the instruction is defined
@@ -39,7 +76,12 @@ insn_t* insn_new(arch_t* arch)
    if (!arch)
       return NULL;
 
-   insn_t* new = lc_malloc0(sizeof *new);
+   insn_t* new = NULL;
+   if (insn_arena != NULL) {
+      new = arena_alloc(insn_arena, sizeof(insn_inline_t));
+      new->alloc = INSN_ALLOC_ARENA;
+   } else
+      new = lc_malloc0(sizeof *new);
 
    new->opcode = R_NONE;
    new->address = SIGNED_ERROR;
@@ -80,7 +122,8 @@ void insn_free_common(void* p)
 
    insn_t* insn = p;
 
-   bitvector_free(insn->coding);
+   if (!(insn->alloc & INSN_ALLOC_INLINE_CODING))
+      bitvector_free(insn->coding);
 
    int i;
    for (i = 0; i < insn->nb_oprnd; i++)
@@ -88,7 +131,9 @@ void insn_free_common(void* p)
    lc_free(insn->oprndtab);
 
    lc_free(insn->debug);
-   lc_free(insn);
+   //Instructions allocated in an arena are freed with it
+   if (!(insn->alloc & INSN_ALLOC_ARENA))
+      lc_free(insn);
 }
 
 /*
@@ -244,7 +289,7 @@ void insn_add_reg_oprnd(insn_t* insn, reg_t* name)
 void insn_append_coding(insn_t* insn, bitvector_t* appendcode)
 {
    // no need to check for NULL insn: getcoding will return NULL
-   bitvector_append(insn_get_coding(insn), appendcode);
+   bitvector_append(insn_get_resizable_coding(insn), appendcode);
 }
 
 /*
@@ -276,7 +321,7 @@ insn_t* insn_copy(insn_t* insn)
       insn_set_oprnd(cpy, i, opcpy);
    }
 
-   cpy->coding = bitvector_dup(insn->coding);
+   insn_set_coding(cpy, NULL, 0, bitvector_dup(insn->coding));
    cpy->read_size = insn->read_size;
    cpy->elt_in = insn->elt_in;
    cpy->elt_out = insn->elt_out;
@@ -1880,8 +1925,39 @@ void insn_set_coding(insn_t* insn, unsigned char* bytecode, int len,
    else if (bvcoding != NULL)
       newcoding = bvcoding;
 
-   bitvector_free(insn->coding);
+   if (!(insn->alloc & INSN_ALLOC_INLINE_CODING))
+      bitvector_free(insn->coding);
+   insn->alloc &= ~INSN_ALLOC_INLINE_CODING;
    insn->coding = newcoding;
+
+   //Storing the coding inline if the instruction has room for it
+   if ((insn->alloc & INSN_ALLOC_ARENA) && newcoding != NULL
+         && newcoding->bits <= INSN_INLINE_CODING_BITS) {
+      insn_inline_t* inl = (insn_inline_t*) insn;
+      inl->coding.bits = INSN_INLINE_CODING_BITS;
+      inl->coding.vector = inl->chunks;
+      bitvector_copy(newcoding, &inl->coding);
+      bitvector_free(newcoding);
+      insn->coding = &inl->coding;
+      insn->alloc |= INSN_ALLOC_INLINE_CODING;
+   }
+}
+
+/*
+ * Retrieves the coding of an instruction to update its size. If it was stored inline,
+ * it is first moved to a separate bitvector.
+ * \param insn An instruction
+ * \return The coding of the instruction, which can be resized
+ * */
+bitvector_t* insn_get_resizable_coding(insn_t* insn)
+{
+   if (insn == NULL)
+      return NULL;
+   if (insn->alloc & INSN_ALLOC_INLINE_CODING) {
+      insn->coding = bitvector_dup(insn->coding);
+      insn->alloc &= ~INSN_ALLOC_INLINE_CODING;
+   }
+   return insn->coding;
 }
 
 /*
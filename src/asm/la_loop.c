@@ -40,7 +40,9 @@ loop_t* loop_new(block_t* entry)
    loop_t* new = lc_malloc0(sizeof *new);
 
    new->id = queue_length(fct->loops);
-   new->global_id = fct_get_asmfile(fct)->maxid_loop++;
+   // Loops of different functions can be detected in parallel. In this case,
+   // global identifiers are renumbered once all functions are analyzed
+   new->global_id = ATOMIC_FETCH_ADD(&fct_get_asmfile(fct)->maxid_loop, 1);
    new->entries = list_add_before(new->entries, entry);
    new->exits = NULL;
    new->function = fct;
@@ -49,6 +51,7 @@ loop_t* loop_new(block_t* entry)
    new->groups = NULL;
    new->blocks = queue_new();
    new->nb_insns = 0;
+   new->ddg_cache = NULL;
 
    // Connect new loop to block (entry) and parent function
    queue_add_tail(fct->loops, new);
@@ -75,6 +78,7 @@ void loop_free(void* p)
    list_free(l->exits, NULL);
    queue_free(l->blocks, NULL);
    lcore_loop_freepaths (l);
+   lcore_loop_free_ddg_cache (l);
    lc_free(l->hierarchy_node);
    list_free(l->groups, &group_free);
 
@@ -1099,6 +1099,21 @@ void memrel_set_ptr(memrel_t* mpt, pointer_t* ptr)
 ///////////////////////////////////////////////////////////////////////////////
 //                               oprnd                                   //
 ///////////////////////////////////////////////////////////////////////////////
+/**
+ * Allocates a blank operand, in the arena of the current thread if there is one (see insn_set_arena)
+ * \return A new operand with all its members set to 0
+ */
+static oprnd_t* oprnd_alloc()
+{
+   arena_t* arena = insn_get_arena();
+   if (arena == NULL)
+      return lc_malloc0(sizeof(oprnd_t));
+
+   oprnd_t* oprnd = arena_alloc(arena, sizeof(oprnd_t));
+   oprnd->in_arena = TRUE;
+   return oprnd;
+}
+
 /*
  * Creates a new oprnd of type register
  * \param reg The register
@@ -1109,7 +1124,7 @@ oprnd_t* oprnd_new_reg(reg_t* reg)
    if (reg == NULL)
       return NULL;
 
-   oprnd_t* oprnd = (oprnd_t*) lc_malloc0(sizeof(oprnd_t));
+   oprnd_t* oprnd = oprnd_alloc();
    oprnd->type = OT_REGISTER;
    oprnd->role = OP_ROLE_UNDEF;
    oprnd->data.reg = reg;
@@ -1132,7 +1147,7 @@ oprnd_t* oprnd_new_mem(reg_t* seg, reg_t* base, reg_t* index, int scale,
       return oprnd_new_memrel(seg, base, index, scale, 0, offset,
             POINTER_RELATIVE);
 
-   oprnd_t* oprnd = (oprnd_t*) lc_malloc0(sizeof(oprnd_t));
+   oprnd_t* oprnd = oprnd_alloc();
    memory_t* mem = memory_new();
 
    oprnd->type = OT_MEMORY;
@@ -1161,7 +1176,7 @@ oprnd_t* oprnd_new_memory(memory_t* mem)
       return oprnd_new_memory_pointer(mem,
             pointer_new(0, mem->offset, NULL, POINTER_RELATIVE, TARGET_DATA));
 
-   oprnd_t* oprnd = (oprnd_t*) lc_malloc0(sizeof(oprnd_t));
+   oprnd_t* oprnd = oprnd_alloc();
 
    oprnd->type = OT_MEMORY;
 
@@ -1181,7 +1196,7 @@ oprnd_t* oprnd_new_memory(memory_t* mem)
  */
 oprnd_t* oprnd_new_imm(imm_t imm)
 {
-   oprnd_t* oprnd = (oprnd_t*) lc_malloc0(sizeof(oprnd_t));
+   oprnd_t* oprnd = oprnd_alloc();
    oprnd->type = OT_IMMEDIATE;
    oprnd->role = OP_ROLE_UNDEF;
    oprnd->data.imm = imm;
@@ -1198,7 +1213,7 @@ oprnd_t* oprnd_new_imm(imm_t imm)
 oprnd_t* oprnd_new_ptr(maddr_t addr, pointer_offset_t offset,
       pointer_type_t type)
 {
-   oprnd_t* oprnd = (oprnd_t*) lc_malloc0(sizeof(oprnd_t));
+   oprnd_t* oprnd = oprnd_alloc();
    oprnd->type = OT_POINTER;
    oprnd->role = OP_ROLE_UNDEF;
    oprnd->data.ptr = pointer_new(addr, offset, NULL, type, TARGET_UNDEF);
@@ -1214,7 +1229,7 @@ oprnd_t* oprnd_new_pointer(pointer_t* ptr)
 {
    if (!ptr)
       return NULL;
-   oprnd_t* oprnd = (oprnd_t*) lc_malloc0(sizeof(oprnd_t));
+   oprnd_t* oprnd = oprnd_alloc();
    oprnd->type = OT_POINTER;
    oprnd->role = OP_ROLE_UNDEF;
    oprnd->data.ptr = ptr;
@@ -1236,7 +1251,7 @@ oprnd_t* oprnd_new_memrel(reg_t* seg, reg_t* base, reg_t* index, int scale,
       maddr_t addr, memory_offset_t offset, pointer_type_t type)
 {
 
-   oprnd_t* oprnd = (oprnd_t*) lc_malloc0(sizeof(oprnd_t));
+   oprnd_t* oprnd = oprnd_alloc();
    oprnd->type = OT_MEMORY_RELATIVE;
    oprnd->role = OP_ROLE_UNDEF;
 
@@ -1262,7 +1277,7 @@ oprnd_t* oprnd_new_memrel(reg_t* seg, reg_t* base, reg_t* index, int scale,
  * */
 oprnd_t* oprnd_new_memory_pointer(memory_t* mem, pointer_t* ptr)
 {
-   oprnd_t* oprnd = (oprnd_t*) lc_malloc0(sizeof(oprnd_t));
+   oprnd_t* oprnd = oprnd_alloc();
    oprnd->type = OT_MEMORY_RELATIVE;
    oprnd->data.mpt = memrel_new(mem, ptr);
    return oprnd;
@@ -1379,7 +1394,9 @@ void oprnd_free(void* p)
       break;
    }
 
-   lc_free(oprnd);
+   //Operands allocated in an arena are freed with it
+   if (!oprnd->in_arena)
+      lc_free(oprnd);
 }
 
 /*
@@ -897,6 +897,8 @@ enum params_modules_id_e {
 enum params_DEBUG_id_e {
    PARAM_DEBUG_DISABLE_DEBUG = 0, // Select if debug data must be loaded or not (boolean)
    PARAM_DEBUG_ENABLE_VARS, // Select if debug vars must be loaded or not (boolean)
+   PARAM_DEBUG_LAZY_DWARF,  // Select if DWARF compilation units must be parsed on demand (boolean)
+   PARAM_DEBUG_NB_THREADS,  // Number of threads used to parse DWARF compilation units (integer, negative for one per processor)
    _NB_PARAM_DEBUG                  // Keep this element at the end
 };
 
@@ -906,6 +908,7 @@ enum params_DEBUG_id_e {
  */
 enum params_DISASS_id_e {
    PARAM_DISASS_OPTIONS = 0, // Mask of options for disassembly. Use values from DISASS_OPTIONS_* defines
+   PARAM_DISASS_NB_THREADS,  // Number of threads used to decode code sections (integer, negative for one per processor)
    _NB_PARAM_DISASS           // Keep this element at the end
 };
 
@@ -915,6 +918,8 @@ enum params_DISASS_id_e {
  */
 enum params_LCORE_id_e {
    PARAM_LCORE_FLOW_ANALYZE_ALL_SCNS, //Select if all executable sections must be analyzed during flow analysis
+   PARAM_LCORE_NB_THREADS,          //Number of threads used to analyze functions (integer, negative for one per processor)
+   PARAM_LCORE_CACHE_DIR,           //Directory where flow, loop and connected components analyses results are cached (string, NULL to disable)
    _NB_PARAM_LCORE                  // Keep this element at the end
 };
 
@@ -931,6 +936,9 @@ enum params_BINARY_id_e {
 #define DISASS_OPTIONS_FULLDISASS   0x00   // Default option, corresponds to a full disassembly
 #define DISASS_OPTIONS_NODISASS     0x01   // Option for disabling disassembly (only binary parsing will be done)
 #define DISASS_OPTIONS_NODATAPARSE  0x02   // Option for disabling parsing of data sections
+#define DISASS_OPTIONS_CHECKDECODING 0x04 // Option for checking instructions decoded in parallel or from the decoding cache against the FSM
+#define DISASS_OPTIONS_DECODECACHE   0x08 // Option for decoding repeated instruction codings of fixed-width architectures from a cache of the FSM results
+#define DISASS_OPTIONS_NOARENA      0x10   // Option for allocating instructions and operands individually instead of in the arena of the file
 /**\todo TODO (2015-03-09) BUG! Some of those names are also defined in libmdisass.h, and with different values. This leads to the
  * disassembly to ignore some options. Choose one header where to define those and stick to it
  * => (2015-05-29) Has been fixed*/
@@ -2121,6 +2129,7 @@ struct oprnd_s {
    unsigned role :2; /**<Role of the operand (source, dest or both)*/
    unsigned writeback :1; /**<Flag for memory base write back*/
    unsigned postindex :1; /**<Flag for memory post indexing*/
+   unsigned in_arena :1; /**<Flag set if the operand is allocated in an arena (see insn_set_arena)*/
 };
 
 /**
@@ -2650,6 +2659,9 @@ extern void oprnd_set_ext(oprnd_t* oprnd, void* ext);
 ///////////////////////////////////////////////////////////////////////////////
 //                                  insn                                     //
 ///////////////////////////////////////////////////////////////////////////////
+#define INSN_ALLOC_ARENA         0x01 /**<The instruction is allocated in an arena (see insn_set_arena)*/
+#define INSN_ALLOC_INLINE_CODING 0x02 /**<The coding of the instruction is stored inline, after the instruction*/
+
 /**
  * \struct insn_s
  *      \brief Describes an instruction
@@ -2674,6 +2686,7 @@ struct insn_s {
    uint8_t read_size; /**<Size of the elements the instruction work with*/
    uint8_t elt_out; /**<4 lsb: Size; 5th to 8th lsb: type of the elements the instruction returns */
    uint8_t elt_in; /**<4 lsb: Size; 5th to 8th lsb: type of the elements the instruction get as input*/
+   uint8_t alloc; /**<Flags describing how the instruction is allocated (INSN_ALLOC_* values)*/
 };
 
 /**
@@ -2717,6 +2730,21 @@ extern int insn_get_oprnd_bitsize(insn_t* insn, int pos);
  */
 extern insn_t* insn_new(arch_t* arch);
 
+/**
+ * Sets the arena where the current thread allocates new instructions and operands.
+ * Those are then freed with the arena, and their individual freeing only releases their other members.
+ * Codings of instructions allocated in an arena are stored inline when they are small enough.
+ * \param arena An arena, or NULL to allocate instructions and operands individually
+ * \return The arena previously used by the thread
+ */
+extern arena_t* insn_set_arena(arena_t* arena);
+
+/**
+ * Returns the arena where the current thread allocates new instructions and operands
+ * \return The arena, or NULL if instructions and operands are allocated individually
+ */
+extern arena_t* insn_get_arena();
+
 /**
  * Creates a new instruction from its string representation
  * \param strinsn The instruction in string form. It must have the same format as an instruction printed using insn_print
@@ -2961,6 +2989,15 @@ extern insn_dbg_t* insn_get_dbg(insn_t* insn);
  */
 extern bitvector_t* insn_get_coding(insn_t* insn);
 
+/**
+ * Retrieves the coding of an instruction to update its size. If it was stored inline,
+ * it is first moved to a separate bitvector. Codings must be retrieved with this function
+ * before being resized
+ * \param insn An instruction
+ * \return Its coding, which can be resized, or NULL if insn is NULL
+ */
+extern bitvector_t* insn_get_resizable_coding(insn_t* insn);
+
 /**
  * Retrieves extensions associated to an instruction
  * \param insn an instruction
@@ -4834,6 +4871,7 @@ struct loop_s {
    tree_t *hierarchy_node; /**<The node corresponding to the loop in the loopnest forest*/
    list_t* groups; /**<A list of group_t* structures containing groups for this loop*/
    int nb_insns; /**<Number of instructions in the loop*/
+   struct ddg_cache_s* ddg_cache; /**<DDG edges saved by lcore_loop[path]_getddg[_ext] (CF lcore_ddg.c)*/
 };
 
 /**
@@ -5138,6 +5176,7 @@ struct fct_s {
    void* polytopes; /**<Structure created by lcore_fct_analyze_polytopes. Should be casted
     in (polytope_context_t*) where libmcore.h is included*/
    char** live_registers; /**<Results of live register analysis*/
+   uint64_t* live_regsets; /**<Results of live register analysis, as packed register sets*/
    char is_grouping_analyzed; //*<Boolean set to TRUE when lcore_fct_analyze_groups is called*/
    maddr_t dbg_addr; /**< Private*/
 };
@@ -7739,6 +7778,7 @@ typedef struct asm_txt_origin_s {
 struct asmfile_s {
    void* params[_NB_PARAM_MODULE][_NB_OPT_BY_MODULE]; /**< Store parameters for some internal parts*/
    queue_t *insns; /**< A queue of instruction*/
+   arena_t* arena; /**< Arena where instructions and operands of the file are allocated (NULL if they are allocated individually)*/
    queue_t *insns_gaps; /**< A queue designating the gaps in the instructions.
     Contains a pointer to the list item just after the gap (in insns).
     Should remain empty for a linear disassembly. Its elements are
@@ -7949,6 +7989,14 @@ extern list_t* asmfile_get_fct_plt(asmfile_t* asmfile);
  */
 extern queue_t* asmfile_get_insns(asmfile_t* asmfile);
 
+/**
+ * Gets the arena where instructions and operands of an asmfile are allocated, creating it if needed.
+ * The arena is freed with the asmfile
+ * \param asmfile an asmfile
+ * \return the arena of the asmfile or PTR_ERROR if there is a problem
+ */
+extern arena_t* asmfile_get_arena(asmfile_t* asmfile);
+
 /**
  * Gets the array of labels associated to functions in an asmfile
  * \param asmfile The asmfile
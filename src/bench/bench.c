@@ -0,0 +1,189 @@
+/*
+   Copyright (C) 2004 - 2018 Université de Versailles Saint-Quentin-en-Yvelines (UVSQ)
+
+   This file is part of MAQAO.
+
+  MAQAO is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public License
+   as published by the Free Software Foundation; either version 3
+   of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+/**
+ * \file bench.c
+ * \brief maqao-bench measures the throughput of some MAQAO internals (decoding, memory, graphs, hashtables,
+ * debug data, dataflow analysis) and checks their results. It is built with "make maqao-bench" and is not installed.
+ *
+ * Usage: maqao-bench <benchmark> [<file>|<arch>] [<count>]
+ * */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <errno.h>
+#include <limits.h>
+
+#include "bench.h"
+#include "libmdisass.h"
+
+/**
+ * Description of a benchmark
+ * */
+typedef struct bench_s {
+   char* name; /**<Name of the benchmark on the command line*/
+   char* input; /**<Name of the mandatory input ("<file>" or "<arch>"), NULL if none*/
+   char* count; /**<Name of the optional count, NULL if none*/
+   long default_count; /**<Count used if none is given*/
+   bench_run_t run; /**<Function running the benchmark*/
+   char* desc; /**<Description printed by the usage*/
+} bench_t;
+
+/**List of the benchmarks*/
+static bench_t benchs[] = {
+   { "decode", "<file>", "<runs>", 5, &bench_decode,
+      "Disassembles the file <runs> times using only the decoding FSM, then using the decoding cache,\n"
+      "and prints the number of instructions decoded per second for the first (cold) run and the mean\n"
+      "of the next runs in each case." },
+   { "memory", "<file>", NULL, 0, &bench_memory,
+      "Disassembles the file with instructions allocated individually, then allocated in an arena,\n"
+      "and prints the heap memory used per instruction in each case (glibc only)." },
+   { "check-decoding", "<file>", NULL, 0, &bench_check_decoding,
+      "Disassembles the file in parallel, then using the decoding cache, and checks every decoded\n"
+      "instruction against the decoding FSM." },
+   { "debug", "<file>", NULL, 0, &bench_debug,
+      "Loads the DWARF debug data of the file eagerly, then lazily, and prints the time to retrieve\n"
+      "the function closest to the middle of the .text section, then all functions." },
+   { "graph", NULL, "<nodes>", 1000000, &bench_graph,
+      "Builds a synthetic graph of <nodes> nodes, traverses it with the recursive and the iterative\n"
+      "BFS, DFS, BackDFS and topological sort, and prints the time of each traversal." },
+   { "hashtable", NULL, "<entries>", 1000000, &bench_hashtable,
+      "Inserts and looks up pointer keys in hashtables (separate chaining) and hashmaps (open\n"
+      "addressing) of <entries> / 1000, <entries> / 16 and <entries> elements." },
+   { "dataflow", "<arch>", NULL, 0, &bench_dataflow,
+      "Generates functions of 2000 to 100000 instructions of <arch>, and prints the time taken by the\n"
+      "dataflow analysis to schedule their blocks. Checks that each block is visited once." },
+};
+
+/*
+ * Prints the usage of maqao-bench
+ * */
+static void usage(char* prog)
+{
+   unsigned int i;
+
+   printf("Usage: %s <benchmark> [<file>|<arch>] [<count>]\n"
+         "Exits with a non-zero status if a benchmark finds an inconsistent result.\n\n"
+         "Benchmarks:\n", prog);
+   for (i = 0; i < sizeof(benchs) / sizeof(*benchs); i++) {
+      printf("  %s", benchs[i].name);
+      if (benchs[i].input != NULL)
+         printf(" %s", benchs[i].input);
+      if (benchs[i].count != NULL)
+         printf(" [%s] (default %ld)", benchs[i].count, benchs[i].default_count);
+      printf("\n%s\n\n", benchs[i].desc);
+   }
+}
+
+/*
+ * Function defined in bench.h
+ * */
+asmfile_t* bench_disassemble(char* file, int64_t options, int nb_threads,
+      unsigned long long int* elapsed, int* answ)
+{
+   asmfile_t* asmf = asmfile_new(file);
+
+   asmfile_add_parameter(asmf, PARAM_MODULE_DEBUG, PARAM_DEBUG_DISABLE_DEBUG,
+         (void*) TRUE);
+   asmfile_add_parameter(asmf, PARAM_MODULE_DISASS, PARAM_DISASS_OPTIONS,
+         (void*) (options | DISASS_OPTIONS_NODATAPARSE));
+   if (nb_threads > 0)
+      asmfile_add_parameter(asmf, PARAM_MODULE_DISASS, PARAM_DISASS_NB_THREADS,
+            (void*) (int64_t) nb_threads);
+
+   unsigned long long int start = utime();
+   *answ = asmfile_disassemble(asmf);
+   if (elapsed != NULL)
+      *elapsed = utime() - start;
+
+   if (ISERROR(*answ)) {
+      asmfile_free(asmf);
+      return NULL;
+   }
+   return asmf;
+}
+
+/*
+ * Function defined in bench.h
+ * */
+void bench_report(char* name, char* format, ...)
+{
+   va_list args;
+
+   printf("%-16s ", name);
+   va_start(args, format);
+   vprintf(format, args);
+   va_end(args);
+   printf("\n");
+}
+
+int main(int argc, char* argv[])
+{
+   bench_t* bench = NULL;
+   unsigned int i;
+   int arg = 2;
+
+   if (argc < 2) {
+      usage(argv[0]);
+      return EXIT_FAILURE;
+   }
+   for (i = 0; i < sizeof(benchs) / sizeof(*benchs); i++)
+      if (str_equal(argv[1], benchs[i].name))
+         bench = &benchs[i];
+   if (bench == NULL) {
+      usage(argv[0]);
+      return (str_equal(argv[1], "-h") || str_equal(argv[1], "--help")) ?
+            EXIT_SUCCESS : EXIT_FAILURE;
+   }
+
+   char* input = NULL;
+   if (bench->input != NULL) {
+      if (argc <= arg) {
+         fprintf(stderr, "Benchmark %s needs %s\n", bench->name, bench->input);
+         return EXIT_FAILURE;
+      }
+      input = argv[arg++];
+   }
+
+   long count = bench->default_count;
+   if (bench->count != NULL && argc > arg) {
+      char* end = NULL;
+      errno = 0;
+      count = strtol(argv[arg], &end, 10);
+      if (errno != 0 || end == argv[arg] || *end != '\0' || count <= 0
+            || count > INT_MAX) {
+         fprintf(stderr, "Invalid %s for benchmark %s: %s\n", bench->count,
+               bench->name, argv[arg]);
+         return EXIT_FAILURE;
+      }
+      arg++;
+   }
+   if (argc > arg) {
+      fprintf(stderr, "Unexpected argument for benchmark %s: %s\n",
+            bench->name, argv[arg]);
+      return EXIT_FAILURE;
+   }
+
+   int answ = bench->run(input, count);
+   if (ISERROR(answ))
+      errcode_printfullmsg(answ);
+   return answ;
+}
@@ -0,0 +1,88 @@
+/*
+   Copyright (C) 2004 - 2018 Université de Versailles Saint-Quentin-en-Yvelines (UVSQ)
+
+   This file is part of MAQAO.
+
+  MAQAO is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public License
+   as published by the Free Software Foundation; either version 3
+   of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+/**
+ * \file bench.h
+ * \brief Declarations shared by the benchmarks of the maqao-bench executable
+ * */
+
+#ifndef BENCH_H_
+#define BENCH_H_
+
+#include "libmcore.h"
+
+/**
+ * Signature of a benchmark
+ * \param input input file or architecture name (NULL if the benchmark does not need one)
+ * \param count number of runs, nodes or entries (the default of the benchmark if not given on the command line)
+ * \return EXIT_SUCCESS if the benchmark succeeded, EXIT_FAILURE if a check failed, error code otherwise
+ * */
+typedef int (*bench_run_t)(char* input, long count);
+
+/**
+ * Disassembles a file without debug data and data sections, and measures the time taken
+ * \param file path to the file
+ * \param options disassembly options (DISASS_OPTIONS_*), DISASS_OPTIONS_NODATAPARSE is added
+ * \param nb_threads number of threads used for disassembling, 0 for the default
+ * \param elapsed return parameter, set to the time taken by the disassembly in microseconds. Can be NULL
+ * \param answ return parameter, set to the code returned by the disassembly
+ * \return the disassembled file, or NULL if the disassembly failed (answ is then set to an error code)
+ * */
+extern asmfile_t* bench_disassemble(char* file, int64_t options, int nb_threads,
+      unsigned long long int* elapsed, int* answ);
+
+/**
+ * Prints a result line of a benchmark: the name of the measured case, aligned, followed by the formatted result
+ * \param name name of the measured case
+ * \param format printf format of the result, followed by its arguments
+ * */
+extern void bench_report(char* name, char* format, ...);
+
+/**
+ * Returns the next value of the pseudo-random generator used to generate synthetic data
+ * \param seed current state of the generator, updated
+ * \return next pseudo-random value
+ * */
+static inline unsigned int bench_rand(unsigned int* seed)
+{
+   *seed = *seed * 1103515245 + 12345;
+   return *seed >> 8;
+}
+
+/*
+ * Benchmarks on disassembled files (bench_disass.c)
+ */
+extern int bench_decode(char* file, long runs);
+extern int bench_memory(char* file, long unused);
+extern int bench_check_decoding(char* file, long unused);
+extern int bench_debug(char* file, long unused);
+
+/*
+ * Benchmarks on synthetic data of libmcommon (bench_common.c)
+ */
+extern int bench_graph(char* unused, long nb_nodes);
+extern int bench_hashtable(char* unused, long nb_entries);
+
+/*
+ * Benchmarks on generated functions of libmcore (bench_analyze.c)
+ */
+extern int bench_dataflow(char* archname, long unused);
+
+#endif /* BENCH_H_ */
@@ -0,0 +1,224 @@
+/*
+   Copyright (C) 2004 - 2018 Université de Versailles Saint-Quentin-en-Yvelines (UVSQ)
+
+   This file is part of MAQAO.
+
+  MAQAO is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public License
+   as published by the Free Software Foundation; either version 3
+   of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+/**
+ * \file bench_analyze.c
+ * \brief Benchmarks of the analyses of libmcore, on generated functions
+ * */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+#include "archinterface.h"
+
+/**
+ * Generates a function of n instructions and analyzes it as a disassembled file would be (flow, loops, virtual
+ * entry block, dominance). Instructions have no operands except the target of conditional jumps: jmp_pct percents
+ * of them jump to an instruction at most span instructions before or after them. Every block is then reachable
+ * from the first one, and the last instruction returns.
+ * \param project an existing project
+ * \param arch architecture of the generated instructions
+ * \param seed seed of the generation
+ * \param n number of instructions
+ * \param jmp_pct percentage of conditional jumps
+ * \param span maximal distance between a jump and its target, in instructions
+ * \return the generated function
+ * */
+static fct_t* bench_dataflow_generate(project_t* project, arch_t* arch,
+      unsigned int seed, int n, int jmp_pct, int span)
+{
+   asmfile_t* asmf = project_add_file(project, "generated");
+   insn_t** insns = lc_malloc(n * sizeof(*insns));
+   int i;
+
+   asmfile_set_arch(asmf, arch);
+   asmfile_set_binfile(asmf, binfile_new("generated"));
+   for (i = 0; i < n; i++) {
+      insns[i] = insn_new(arch);
+      insn_set_addr(insns[i], 0x1000 + 4 * i);
+   }
+   label_t* lbl = label_new("generated", 0x1000, TARGET_INSN, insns[0]);
+   label_set_type(lbl, LBL_FUNCTION);
+   asmfile_add_label_unsorted(asmf, lbl);
+   for (i = 0; i < n; i++) {
+      unsigned int annotate = A_STDCODE;
+      insn_t* target = NULL;
+      int draw = (int) (bench_rand(&seed) % 100);
+
+      if (i == n - 1)
+         annotate |= A_RTRN;
+      else if (draw < jmp_pct) {
+         int t = i + (int) (bench_rand(&seed) % (2 * span + 1)) - span;
+         target = insns[(t < 1) ? 1 : ((t >= n) ? n - 1 : t)];
+         annotate |= A_JUMP | A_CONDITIONAL;
+      }
+      insn_link_fct_lbl(insns[i], lbl);
+      insn_set_annotate(insns[i], annotate);
+      if (target != NULL) {
+         oprnd_t* op = oprnd_new_ptr(INSN_GET_ADDR(target), 0,
+               POINTER_ABSOLUTE);
+         pointer_set_insn_target(oprnd_get_ptr(op), target);
+         insn_add_oprnd(insns[i], op);
+      }
+      add_insn_to_insnlst(insns[i], asmfile_get_insns(asmf));
+   }
+   lc_free(insns);
+   asmfile_upd_labels(asmf);
+   asmfile_add_analyzis(asmf, DIS_ANALYZE);
+
+   lcore_analyze_flow(asmf);
+   lcore_analyze_loops(asmf);
+   lcore_analyze_connected_components(asmf);
+   lcore_asmfile_extract_functions_from_cc(asmf);
+
+   // Virtual entry block linked to all connected components, as added when analyzing a disassembled file
+   fct_t* f = queue_peek_head(asmf->functions);
+   block_t* virtual = lc_malloc0(sizeof(block_t));
+   virtual->global_id = asmf->n_blocks++;
+   virtual->function = f;
+   virtual->cfg_node = graph_node_new(virtual);
+   virtual->domination_node = tree_new(virtual);
+   FOREACH_INQUEUE(f->components, it_cc) {
+      queue_t* cc = GET_DATA_T(queue_t*, it_cc);
+      FOREACH_INQUEUE(cc, it_en) {
+         block_t* b = GET_DATA_T(block_t*, it_en);
+         graph_add_edge(virtual->cfg_node, b->cfg_node, NULL);
+      }
+   }
+   queue_add_head(f->blocks, virtual);
+   fct_upd_loops_id(f);
+   fct_upd_blocks_id(f);
+   lcore_analyze_dominance(asmf);
+
+   return f;
+}
+
+/**
+ * Order in which the dataflow analysis visited blocks
+ * */
+typedef struct bench_dataflow_order_s {
+   int* ids; /**<Identifiers of visited blocks, in visit order*/
+   int nb_ids; /**<Number of visited blocks*/
+   int max_ids; /**<Size of ids*/
+   int nb_extra; /**<Number of visits beyond max_ids (blocks visited several times)*/
+} bench_dataflow_order_t;
+
+static void* bench_dataflow_visit(void* user, ssa_block_t* ssab)
+{
+   bench_dataflow_order_t* order = user;
+   if (order->nb_ids < order->max_ids)
+      order->ids[order->nb_ids++] = ssab->block->id;
+   else
+      order->nb_extra++;
+   return user;
+}
+
+static int bench_dataflow_filter(ssa_insn_t* ssain, void* user)
+{
+   (void) ssain;
+   (void) user;
+   return FALSE;
+}
+
+/**
+ * Measures the scheduling of blocks by the dataflow analysis (ADFA) on generated functions of increasing sizes
+ * (see bench_dataflow_generate), with instructions filtered out so that only the scheduling is measured.
+ * The visit order is checked: each block must be visited exactly once. Blocks visited before one of their
+ * predecessors (back edges excluded) are counted: they are released when no block is ready, for instance when
+ * a loop is entered from an inner loop.
+ * \param archname name of the architecture of the generated instructions
+ * \param unused not used
+ * \return EXIT_SUCCESS if each block was visited exactly once, EXIT_FAILURE otherwise, error code if the
+ * architecture is unknown
+ * */
+int bench_dataflow(char* archname, long unused)
+{
+   int sizes[] = { 2000, 10000, 40000, 100000 };
+   int res = EXIT_SUCCESS;
+   unsigned int s;
+   (void) unused;
+
+   arch_t* arch = getarch_byname(archname);
+   if (arch == NULL)
+      return ERR_LIBASM_ARCH_UNKNOWN;
+
+   for (s = 0; s < sizeof(sizes) / sizeof(*sizes); s++) {
+      project_t* project = project_new("bench");
+      fct_t* f = bench_dataflow_generate(project, arch, s + 1, sizes[s], 15,
+            50);
+      int nb_blocks = fct_get_nb_blocks(f);
+      bench_dataflow_order_t order;
+      adfa_driver_t driver;
+      int i;
+
+      order.ids = lc_malloc(nb_blocks * sizeof(*order.ids));
+      order.nb_ids = 0;
+      order.max_ids = nb_blocks;
+      order.nb_extra = 0;
+      memset(&driver, 0, sizeof(driver));
+      driver.insn_filter = &bench_dataflow_filter;
+      driver.propagate = &bench_dataflow_visit;
+      driver.user_struct = &order;
+
+      unsigned long long int start = utime();
+      adfa_cntxt_t* cntxt = ADFA_analyze_function(f, &driver);
+      unsigned long long int elapsed = utime() - start;
+      ADFA_free(cntxt);
+
+      // Rank of each block in the visit order
+      int* ranks = lc_malloc(nb_blocks * sizeof(*ranks));
+      int nb_twice = order.nb_extra, nb_early = 0;
+      for (i = 0; i < nb_blocks; i++)
+         ranks[i] = -1;
+      for (i = 0; i < order.nb_ids; i++) {
+         if (ranks[order.ids[i]] != -1)
+            nb_twice++;
+         ranks[order.ids[i]] = i;
+      }
+      FOREACH_INQUEUE(f->blocks, it_b) {
+         block_t* b = GET_DATA_T(block_t*, it_b);
+         int early = FALSE;
+         FOREACH_INLIST(b->cfg_node->in, it_e) {
+            graph_edge_t* e = GET_DATA_T(graph_edge_t*, it_e);
+            block_t* pred = e->from->data;
+            int back = (pred == b);
+            if (b->loop != NULL && pred->loop == b->loop)
+               back |= (list_lookup(loop_get_entries(b->loop), b) != NULL);
+            if (!back && ranks[pred->id] > ranks[b->id])
+               early = TRUE;
+         }
+         nb_early += early;
+      }
+      int nb_missing = nb_blocks - order.nb_ids + (nb_twice - order.nb_extra);
+
+      bench_report("ADFA", "%d blocks, %d loops: %.3f s, %d visited early%s",
+            nb_blocks, queue_length(f->loops), elapsed / 1e6, nb_early,
+            (nb_twice || nb_missing) ? ", BLOCKS VISITED TWICE OR MISSING" : "");
+      if (nb_twice || nb_missing)
+         res = EXIT_FAILURE;
+
+      lc_free(ranks);
+      lc_free(order.ids);
+      project_free(project);
+   }
+   return res;
+}
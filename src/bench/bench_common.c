@@ -0,0 +1,337 @@
+/*
+   Copyright (C) 2004 - 2018 Université de Versailles Saint-Quentin-en-Yvelines (UVSQ)
+
+   This file is part of MAQAO.
+
+  MAQAO is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public License
+   as published by the Free Software Foundation; either version 3
+   of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+/**
+ * \file bench_common.c
+ * \brief Benchmarks of the graphs and hashtables of libmcommon, on synthetic data
+ * */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bench.h"
+
+/**
+ * Adds a node to the array of nodes visited by a traversal
+ * \param node a graph node
+ * \param user array of visited nodes
+ * */
+static void bench_graph_visit(graph_node_t* node, void* user)
+{
+   array_add((array_t*) user, node);
+}
+
+/**
+ * Adds the nodes of a topologically sorted array to the array of visited nodes, then frees the sorted array
+ * \param sorted array of nodes returned by a topological sort
+ * \param visited array of visited nodes
+ * */
+static void bench_graph_add_sorted(array_t* sorted, array_t* visited)
+{
+   FOREACH_INARRAY(sorted, it_n) {
+      graph_node_t* node = ARRAY_GET_DATA(node, it_n);
+      array_add(visited, node);
+   }
+   array_free(sorted, NULL);
+}
+
+/**
+ * Runs a traversal from a node, in its recursive or iterative version
+ * \param t index of the traversal (0: BFS, 1: DFS, 2: BackDFS, 3: topological sort)
+ * \param iterative TRUE for the iterative version, FALSE for the recursive one
+ * \param root node the traversal starts from
+ * \param visited array of visited nodes, filled in visit order
+ * */
+static void bench_graph_traverse(int t, int iterative, graph_node_t* root,
+      array_t* visited)
+{
+   switch (t) {
+   case 0:
+      if (iterative)
+         graph_node_BFS_iterative(root, &bench_graph_visit, NULL, visited);
+      else
+         graph_node_BFS(root, &bench_graph_visit, NULL, visited);
+      break;
+   case 1:
+      if (iterative)
+         graph_node_DFS_iterative(root, NULL, &bench_graph_visit, NULL, visited);
+      else
+         graph_node_DFS(root, NULL, &bench_graph_visit, NULL, visited);
+      break;
+   case 2:
+      if (iterative)
+         graph_node_BackDFS_iterative(root, NULL, &bench_graph_visit, NULL, visited);
+      else
+         graph_node_BackDFS(root, NULL, &bench_graph_visit, NULL, visited);
+      break;
+   default:
+      bench_graph_add_sorted(iterative ?
+            graph_node_topological_sort_iterative(root) :
+            graph_node_topological_sort(root), visited);
+      break;
+   }
+}
+
+/**
+ * Measures the recursive and iterative graph traversals on a synthetic graph, and checks that both visit nodes
+ * in the same order.
+ * Nodes are laid out in layers of 1024 nodes. Each node has an edge to the node below it and an edge to a random
+ * node of the next layer, and each group of 4 nodes of a layer forms a loop. Nodes of the first layer are chained,
+ * so all nodes are reachable from the first one while the depth of recursive traversals stays bounded.
+ * The iterative DFS is also run on a chain of nb_nodes nodes, too deep for the recursive one.
+ * \param unused not used
+ * \param nb_nodes number of nodes of the graph
+ * \return EXIT_SUCCESS if all traversals visited the same nodes in the same order, EXIT_FAILURE otherwise
+ * */
+int bench_graph(char* unused, long nb_nodes)
+{
+   char* names[] = { "BFS", "DFS", "BackDFS", "Topological sort" };
+   const int width = 1024;
+   int n = (int) nb_nodes;
+   int res = EXIT_SUCCESS;
+   unsigned int seed = 1;
+   unsigned int t;
+   int i;
+   (void) unused;
+
+   // Builds the layered graph
+   graph_node_t** nodes = lc_malloc(n * sizeof(*nodes));
+   array_t* all = array_new_with_custom_size(n);
+   for (i = 0; i < n; i++) {
+      nodes[i] = graph_node_new(NULL);
+      array_add(all, nodes[i]);
+   }
+   for (i = 0; i < n; i++) {
+      int layer = i / width;
+      if (layer == 0 && i + 1 < width && i + 1 < n)
+         graph_add_edge(nodes[i], nodes[i + 1], NULL);
+      if (i + width < n) {
+         graph_add_edge(nodes[i], nodes[i + width], NULL);
+         int next = (layer + 1) * width + bench_rand(&seed) % width;
+         if (next < n)
+            graph_add_edge(nodes[i], nodes[next], NULL);
+      }
+      // Groups of 4 nodes of a layer form loops
+      if (layer > 0 && i % 4 != 3 && i + 1 < n)
+         graph_add_edge(nodes[i], nodes[i + 1], NULL);
+      if (i % 4 == 3)
+         graph_add_edge(nodes[i], nodes[i - 3], NULL);
+   }
+
+   array_t* rec_visited = array_new_with_custom_size(n);
+   array_t* it_visited = array_new_with_custom_size(n);
+   for (t = 0; t < sizeof(names) / sizeof(*names); t++) {
+      // BackDFS goes up from the last node
+      graph_node_t* root = (t == 2) ? nodes[n - 1] : nodes[0];
+
+      unsigned long long int start = utime();
+      bench_graph_traverse(t, FALSE, root, rec_visited);
+      unsigned long long int rec_elapsed = utime() - start;
+
+      start = utime();
+      bench_graph_traverse(t, TRUE, root, it_visited);
+      unsigned long long int it_elapsed = utime() - start;
+
+      int same = (array_length(rec_visited) == array_length(it_visited));
+      for (i = 0; same && i < array_length(rec_visited); i++)
+         same = (array_get_elt_at_pos(rec_visited, i)
+               == array_get_elt_at_pos(it_visited, i));
+      bench_report(names[t], "%d nodes: recursive %.3f s, iterative %.3f s (%s)",
+            array_length(it_visited), rec_elapsed / 1e6, it_elapsed / 1e6,
+            same ? "same order" : "ORDER DIFFERS");
+      if (!same)
+         res = EXIT_FAILURE;
+      array_flush(rec_visited, NULL);
+      array_flush(it_visited, NULL);
+   }
+   graph_free_from_nodes(all, NULL, NULL);
+   array_free(all, NULL);
+
+   // Builds the chain, then only runs the iterative DFS on it
+   all = array_new_with_custom_size(n);
+   for (i = 0; i < n; i++) {
+      nodes[i] = graph_node_new(NULL);
+      array_add(all, nodes[i]);
+      if (i > 0)
+         graph_add_edge(nodes[i - 1], nodes[i], NULL);
+   }
+   unsigned long long int start = utime();
+   bench_graph_traverse(1, TRUE, nodes[0], it_visited);
+   bench_report("DFS (chain)", "%d nodes: iterative %.3f s",
+         array_length(it_visited), (utime() - start) / 1e6);
+   graph_free_from_nodes(all, NULL, NULL);
+   array_free(all, NULL);
+
+   array_free(rec_visited, NULL);
+   array_free(it_visited, NULL);
+   lc_free(nodes);
+   return res;
+}
+
+/**
+ * Operations of a table measured by bench_hashtable, so that hashtables and hashmaps share the same measures
+ * */
+typedef struct bench_table_ops_s {
+   char* name; /**<Name of the table*/
+   void* (*create)(); /**<Creates an empty table*/
+   void (*insert)(void*, void*, void*); /**<Inserts a key and its data*/
+   void* (*lookup)(void*, void*); /**<Returns the data of a key*/
+   void (*destroy)(void*); /**<Frees the table*/
+} bench_table_ops_t;
+
+static void* bench_hashtable_create()
+{
+   return hashtable_new(&direct_hash, &direct_equal);
+}
+
+static void bench_hashtable_insert(void* t, void* key, void* data)
+{
+   hashtable_insert(t, key, data);
+}
+
+static void* bench_hashtable_lookup(void* t, void* key)
+{
+   return hashtable_lookup(t, key);
+}
+
+static void bench_hashtable_destroy(void* t)
+{
+   hashtable_free(t, NULL, NULL);
+}
+
+static void* bench_hashmap_create()
+{
+   return hashmap_new(0);
+}
+
+static void bench_hashmap_insert(void* m, void* key, void* data)
+{
+   hashmap_insert(m, key, data);
+}
+
+static void* bench_hashmap_lookup(void* m, void* key)
+{
+   return hashmap_lookup(m, key);
+}
+
+static void bench_hashmap_destroy(void* m)
+{
+   hashmap_free(m, NULL, NULL);
+}
+
+/**
+ * Measures a table built from keys, keys[i] being associated to i + 1
+ * \param ops operations of the table
+ * \param keys array of keys
+ * \param n number of keys
+ * \param reps number of times each measure is repeated
+ * \param insert_ns return parameter, set to the mean time of an insertion (including the creation and freeing
+ * of the table), in ns
+ * \param lookup_ns return parameter, set to the mean time of a lookup, in ns
+ * \return TRUE if all lookups returned the expected data, FALSE otherwise
+ * */
+static int bench_table(bench_table_ops_t* ops, void** keys, int n, int reps,
+      double* insert_ns, double* lookup_ns)
+{
+   int valid = TRUE;
+   void* table;
+   int i, r;
+
+   unsigned long long int start = utime();
+   for (r = 0; r < reps; r++) {
+      table = ops->create();
+      for (i = 0; i < n; i++)
+         ops->insert(table, keys[i], (void*) (intptr_t) (i + 1));
+      ops->destroy(table);
+   }
+   *insert_ns = (utime() - start) * 1e3 / ((double) reps * n);
+
+   table = ops->create();
+   for (i = 0; i < n; i++)
+      ops->insert(table, keys[i], (void*) (intptr_t) (i + 1));
+   start = utime();
+   for (r = 0; r < reps; r++) {
+      for (i = 0; i < n; i++) {
+         int k = (int) (((uint64_t) i * 7919) % n);
+         if (ops->lookup(table, keys[k]) != (void*) (intptr_t) (k + 1))
+            valid = FALSE;
+      }
+   }
+   *lookup_ns = (utime() - start) * 1e3 / ((double) reps * n);
+   ops->destroy(table);
+
+   return valid;
+}
+
+/**
+ * Measures insertions and lookups in hashtables (separate chaining) and hashmaps (open addressing) of
+ * nb_entries / 1000, nb_entries / 16 and nb_entries elements. Keys are heap pointers inserted in
+ * random order, as for most callers (instructions, blocks...), and lookups access keys in a scattered order.
+ * Small tables are measured several times to get a significant duration.
+ * \param unused not used
+ * \param nb_entries number of entries of the largest tables
+ * \return EXIT_SUCCESS if all lookups returned the expected data, EXIT_FAILURE otherwise
+ * */
+int bench_hashtable(char* unused, long nb_entries)
+{
+   bench_table_ops_t tables[] = {
+      { "Hashtable", &bench_hashtable_create, &bench_hashtable_insert,
+            &bench_hashtable_lookup, &bench_hashtable_destroy },
+      { "Hashmap", &bench_hashmap_create, &bench_hashmap_insert,
+            &bench_hashmap_lookup, &bench_hashmap_destroy },
+   };
+   int nb_keys = (int) nb_entries;
+   int sizes[] = { nb_keys / 1000, nb_keys / 16, nb_keys };
+   int res = EXIT_SUCCESS;
+   unsigned int seed = 1;
+   unsigned int s, t;
+   int i;
+   (void) unused;
+
+   void** keys = lc_malloc(nb_keys * sizeof(*keys));
+   for (i = 0; i < nb_keys; i++)
+      keys[i] = lc_malloc(24);
+   for (i = nb_keys - 1; i > 0; i--) {
+      int j = bench_rand(&seed) % (i + 1);
+      void* key = keys[i];
+      keys[i] = keys[j];
+      keys[j] = key;
+   }
+
+   for (s = 0; s < sizeof(sizes) / sizeof(*sizes); s++) {
+      int n = (sizes[s] > 0) ? sizes[s] : 1;
+      int reps = (n < 4000000) ? 4000000 / n : 1;
+      double insert_ns, lookup_ns;
+
+      for (t = 0; t < sizeof(tables) / sizeof(*tables); t++) {
+         if (!bench_table(&tables[t], keys, n, reps, &insert_ns, &lookup_ns))
+            res = EXIT_FAILURE;
+         bench_report(tables[t].name, "%d entries: insert %.1f ns, lookup %.1f ns",
+               n, insert_ns, lookup_ns);
+      }
+   }
+   if (res != EXIT_SUCCESS)
+      printf("Some lookups did not return the inserted data\n");
+
+   for (i = 0; i < nb_keys; i++)
+      lc_free(keys[i]);
+   lc_free(keys);
+   return res;
+}
@@ -0,0 +1,276 @@
+/*
+   Copyright (C) 2004 - 2018 Université de Versailles Saint-Quentin-en-Yvelines (UVSQ)
+
+   This file is part of MAQAO.
+
+  MAQAO is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public License
+   as published by the Free Software Foundation; either version 3
+   of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+/**
+ * \file bench_disass.c
+ * \brief Benchmarks of the disassembler and of the debug data on an input file
+ * */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+#include "bench.h"
+#include "libmdbg.h"
+
+/**
+ * Measures the number of instructions decoded per second when disassembling a file, using only the FSM
+ * and using the decoding cache (when the architecture supports it).
+ * The first run is reported separately, as it also includes loading the file in the page cache. The decoding
+ * cache is empty at the start of every run.
+ * \param file path to the file
+ * \param runs number of disassemblies for each mode
+ * \return EXIT_SUCCESS if the file could be disassembled, error code otherwise
+ * */
+int bench_decode(char* file, long runs)
+{
+   int64_t modes[] = { DISASS_OPTIONS_FULLDISASS, DISASS_OPTIONS_DECODECACHE };
+   char* names[] = { "FSM only", "Decoding cache" };
+   unsigned int m;
+   long run;
+   int answ;
+
+   for (m = 0; m < sizeof(modes) / sizeof(*modes); m++) {
+      unsigned long long int cold = 0, warm = 0;
+      int n_insns = 0;
+      for (run = 0; run < runs; run++) {
+         unsigned long long int elapsed;
+         asmfile_t* asmf = bench_disassemble(file, modes[m], 0, &elapsed, &answ);
+         if (asmf == NULL)
+            return answ;
+         if (run == 0)
+            cold = elapsed;
+         else
+            warm += elapsed;
+         n_insns = queue_length(asmfile_get_insns(asmf));
+         asmfile_free(asmf);
+      }
+      if (runs > 1) {
+         warm /= runs - 1;
+         bench_report(names[m], "%d instructions, cold run %.3f s: %.0f instructions/s,"
+               " next runs %.3f s: %.0f instructions/s", n_insns, cold / 1e6,
+               (cold > 0) ? n_insns * 1e6 / cold : 0, warm / 1e6,
+               (warm > 0) ? n_insns * 1e6 / warm : 0);
+      }
+      else
+         bench_report(names[m], "%d instructions, cold run %.3f s: %.0f instructions/s",
+               n_insns, cold / 1e6, (cold > 0) ? n_insns * 1e6 / cold : 0);
+   }
+   return EXIT_SUCCESS;
+}
+
+/**
+ * Returns the number of bytes currently allocated on the heap
+ * \return number of allocated bytes, or 0 if it can not be retrieved on this platform
+ * */
+static size_t heap_get_used_size()
+{
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+   struct mallinfo2 mi = mallinfo2();
+   return mi.uordblks + mi.hblkhd;
+#elif defined(__GLIBC__)
+   struct mallinfo mi = mallinfo();
+   return (size_t) (unsigned int) mi.uordblks + (size_t) (unsigned int) mi.hblkhd;
+#else
+   return 0;
+#endif
+}
+
+/**
+ * Measures the memory used for each instruction when disassembling a file, with instructions and
+ * operands allocated individually then allocated in the arena of the file.
+ * \param file path to the file
+ * \param unused not used
+ * \return EXIT_SUCCESS if the file could be disassembled, error code otherwise
+ * */
+int bench_memory(char* file, long unused)
+{
+   int64_t modes[] = { DISASS_OPTIONS_NOARENA, DISASS_OPTIONS_FULLDISASS };
+   char* names[] = { "Individual", "Arena" };
+   unsigned int m;
+   int answ;
+   (void) unused;
+
+   for (m = 0; m < sizeof(modes) / sizeof(*modes); m++) {
+      size_t before = heap_get_used_size();
+      asmfile_t* asmf = bench_disassemble(file, modes[m], 0, NULL, &answ);
+      size_t after = heap_get_used_size();
+      if (asmf == NULL)
+         return answ;
+      int n_insns = queue_length(asmfile_get_insns(asmf));
+      size_t used = (after > before) ? after - before : 0;
+      bench_report(names[m], "%d instructions, %zu bytes: %.1f bytes/instruction"
+            " (arena: %zu bytes reserved)", n_insns, used,
+            (n_insns > 0) ? (double) used / n_insns : 0,
+            arena_get_reserved_size(asmf->arena));
+      asmfile_free(asmf);
+   }
+   return EXIT_SUCCESS;
+}
+
+/**
+ * Disassembles a file in parallel (at least 4 threads), then sequentially using the decoding cache,
+ * and checks each decoded instruction against the one decoded by the FSM alone at the same address.
+ * \param file path to the file
+ * \param unused not used
+ * \return EXIT_SUCCESS if all instructions match, EXIT_FAILURE if a mismatch was found, error code otherwise
+ * */
+int bench_check_decoding(char* file, long unused)
+{
+   int nb_cpus = threadpool_get_nb_cpus();
+   int threads[] = { (nb_cpus > 4) ? nb_cpus : 4, 1 };
+   int64_t modes[] = { DISASS_OPTIONS_FULLDISASS, DISASS_OPTIONS_DECODECACHE };
+   char* names[] = { "Parallel", "Decoding cache" };
+   int res = EXIT_SUCCESS;
+   unsigned int m;
+   int answ;
+   (void) unused;
+
+   for (m = 0; m < sizeof(modes) / sizeof(*modes); m++) {
+      asmfile_t* asmf = bench_disassemble(file,
+            modes[m] | DISASS_OPTIONS_CHECKDECODING, threads[m], NULL, &answ);
+      if (asmf == NULL)
+         return answ;
+      bench_report(names[m], "%d instructions (%d threads): %s",
+            queue_length(asmfile_get_insns(asmf)), threads[m],
+            (answ == WRN_DISASS_DECODING_MISMATCH) ? "MISMATCH" : "OK");
+      if (answ == WRN_DISASS_DECODING_MISMATCH)
+         res = EXIT_FAILURE;
+      asmfile_free(asmf);
+   }
+   return res;
+}
+
+/**
+ * Returns the address of the function symbol closest to the middle of the .text section of an ELF file
+ * \param elf an opened 64 bits ELF file
+ * \return the address of the function, or 0 if the file has no .text section or no function symbol
+ * */
+static int64_t bench_debug_get_function_addr(Elf* elf)
+{
+   Elf64_Ehdr* ehdr = elf64_getehdr(elf);
+   Elf_Scn* symtab = NULL;
+   int64_t middle = 0, best = 0;
+   size_t i;
+
+   if (ehdr == NULL)
+      return 0;
+   for (i = 1; i < ehdr->e_shnum; i++) {
+      Elf_Scn* scn = elf_getscn(elf, i);
+      Elf64_Shdr* shdr = elf64_getshdr(scn);
+      if (shdr == NULL)
+         continue;
+      char* name = elf_strptr(elf, ehdr->e_shstrndx, shdr->sh_name);
+      if (name != NULL && str_equal(name, ".text"))
+         middle = shdr->sh_addr + shdr->sh_size / 2;
+      else if (shdr->sh_type == SHT_SYMTAB)
+         symtab = scn;
+   }
+   if (middle == 0 || symtab == NULL)
+      return 0;
+
+   Elf_Data* data = elf_getdata(symtab, NULL);
+   if (data == NULL)
+      return 0;
+   Elf64_Sym* syms = data->d_buf;
+   for (i = 0; i < data->d_size / sizeof(*syms); i++) {
+      int64_t addr = syms[i].st_value;
+      if (ELF64_ST_TYPE(syms[i].st_info) == STT_FUNC && addr != 0
+            && (best == 0 || llabs(addr - middle) < llabs(best - middle)))
+         best = addr;
+   }
+   return best;
+}
+
+/**
+ * Measures the time to the first result of the DWARF debug data of a file, loaded eagerly (all compilation
+ * units parsed first) then lazily (compilation units parsed on demand). The first result is the function whose
+ * symbol is the closest to the middle of the .text section. The time to retrieve all functions, which parses
+ * all compilation units, is also printed. The debug data are loaded directly from the ELF file, whatever its
+ * architecture.
+ * \param file path to the file
+ * \param unused not used
+ * \return EXIT_SUCCESS if both modes found the same function, EXIT_FAILURE otherwise, error code if the file could
+ * not be opened or has no DWARF debug data
+ * */
+int bench_debug(char* file, long unused)
+{
+   char* names[] = { "Eager", "Lazy" };
+   char* found[] = { NULL, NULL };
+   int res = EXIT_SUCCESS;
+   int m;
+   (void) unused;
+
+   FILE* stream = fopen(file, "r");
+   if (stream == NULL) {
+      ERRMSG("Unable to open file %s\n", file);
+      return ERR_COMMON_UNABLE_TO_OPEN_FILE;
+   }
+   elf_version(EV_CURRENT);
+
+   for (m = 0; m < 2 && res == EXIT_SUCCESS; m++) {
+      Elf* elf = elf_begin(fileno(stream), ELF_C_READ, NULL);
+      int64_t addr = (elf != NULL) ? bench_debug_get_function_addr(elf) : 0;
+      if (addr == 0) {
+         ERRMSG("File %s is not a 64 bits ELF file with a .text section and a symbol table\n",
+               file);
+         res = ERR_BINARY_FORMAT_NOT_RECOGNIZED;
+         if (elf != NULL)
+            elf_end(elf);
+         break;
+      }
+
+      unsigned long long int start = utime();
+      DwarfAPI* api = (m == 0) ?
+            dwarf_api_init_light(elf, file, NULL) :
+            dwarf_api_init_lazy(elf, file, NULL);
+      if (api == NULL) {
+         ERRMSG("File %s has no DWARF debug data\n", file);
+         res = WRN_LIBASM_NO_DEBUG_DATA;
+         elf_end(elf);
+         break;
+      }
+      DwarfFunction* f = dwarf_api_get_function_by_addr(api, addr);
+      unsigned long long int first = utime();
+      queue_t* fcts = dwarf_api_get_functions(api);
+      unsigned long long int all = utime();
+
+      found[m] = lc_strdup((f != NULL) ? dwarf_function_get_name(f) : "");
+      bench_report(names[m], "first result %.3f s (function at %#"PRIx64": %s),"
+            " all %d functions %.3f s", (first - start) / 1e6, addr,
+            (f != NULL) ? found[m] : "none", queue_length(fcts),
+            (all - start) / 1e6);
+      queue_free(fcts, NULL);
+      dwarf_api_close_light(api);
+      elf_end(elf);
+   }
+   fclose(stream);
+
+   if (res == EXIT_SUCCESS && !str_equal(found[0], found[1])) {
+      printf("Eager and lazy modes found different functions\n");
+      res = EXIT_FAILURE;
+   }
+   lc_free(found[0]);
+   lc_free(found[1]);
+   return res;
+}
@@ -0,0 +1,154 @@
+/*
+   Copyright (C) 2004 - 2018 Université de Versailles Saint-Quentin-en-Yvelines (UVSQ)
+
+   This file is part of MAQAO.
+
+  MAQAO is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public License
+   as published by the Free Software Foundation; either version 3
+   of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+/**
+ * \file lc_arena.c
+ * \brief defines an arena allocator, freeing all its allocations at once
+ * */
+#include "libmcommon.h"
+
+///////////////////////////////////////////////////////////////////////////////
+//                              arena functions                              //
+///////////////////////////////////////////////////////////////////////////////
+
+/**Size of the header of a block, containing the pointer to the previous block*/
+#define ARENA_HEADER_SIZE ((sizeof(void*) + ARENA_ALIGNMENT - 1) & ~(size_t) (ARENA_ALIGNMENT - 1))
+
+/**
+ * Returns the block preceding a block in the chain of blocks of an arena
+ * \param B a block
+ */
+#define ARENA_BLOCK_PREV(B) (*(void**) (B))
+
+/*
+ * Creates a new arena
+ * \param block_size size in bytes of the blocks reserved by the arena. If 0, ARENA_BLOCK_SIZE is used
+ * \return a new arena
+ */
+arena_t* arena_new(size_t block_size)
+{
+   arena_t* new = lc_malloc0(sizeof *new);
+   new->block_size = (block_size > 0) ? block_size : ARENA_BLOCK_SIZE;
+   return new;
+}
+
+/*
+ * Allocates an area in an arena and sets its content to 0
+ * \param arena an arena
+ * \param size size in bytes of the area
+ * \return a pointer to the area, aligned on ARENA_ALIGNMENT bytes, or NULL if arena is NULL
+ */
+void* arena_alloc(arena_t* arena, size_t size)
+{
+   if (arena == NULL)
+      return NULL;
+   size = (size + ARENA_ALIGNMENT - 1) & ~(size_t) (ARENA_ALIGNMENT - 1);
+   arena->used += size;
+
+   if (size > (size_t) (arena->end - arena->next)) {
+      if (size > arena->block_size / 4) {
+         // Large area: it gets its own block, inserted behind the current one to keep using its free space
+         void* block = lc_malloc0(ARENA_HEADER_SIZE + size);
+         arena->reserved += ARENA_HEADER_SIZE + size;
+         if (arena->blocks != NULL) {
+            ARENA_BLOCK_PREV(block) = ARENA_BLOCK_PREV(arena->blocks);
+            ARENA_BLOCK_PREV(arena->blocks) = block;
+         } else
+            arena->blocks = block;
+         return (char*) block + ARENA_HEADER_SIZE;
+      }
+      void* block = lc_malloc(ARENA_HEADER_SIZE + arena->block_size);
+      arena->reserved += ARENA_HEADER_SIZE + arena->block_size;
+      ARENA_BLOCK_PREV(block) = arena->blocks;
+      arena->blocks = block;
+      arena->next = (char*) block + ARENA_HEADER_SIZE;
+      arena->end = arena->next + arena->block_size;
+   }
+
+   void* area = arena->next;
+   arena->next += size;
+   memset(area, 0, size);
+   return area;
+}
+
+/*
+ * Moves all the blocks of an arena into another one, then frees it
+ * \param dst the arena receiving the blocks
+ * \param src the arena to merge into \c dst. It must not be used afterwards
+ */
+void arena_merge(arena_t* dst, arena_t* src)
+{
+   if (dst == NULL || src == NULL)
+      return;
+
+   if (dst->blocks == NULL) {
+      dst->blocks = src->blocks;
+      dst->next = src->next;
+      dst->end = src->end;
+   } else if (src->blocks != NULL) {
+      // Blocks of src are inserted behind the current block of dst
+      void* first = src->blocks;
+      while (ARENA_BLOCK_PREV(first) != NULL)
+         first = ARENA_BLOCK_PREV(first);
+      ARENA_BLOCK_PREV(first) = ARENA_BLOCK_PREV(dst->blocks);
+      ARENA_BLOCK_PREV(dst->blocks) = src->blocks;
+   }
+   dst->reserved += src->reserved;
+   dst->used += src->used;
+   lc_free(src);
+}
+
+/*
+ * Returns the total size of the blocks reserved by an arena
+ * \param arena an arena
+ * \return size in bytes
+ */
+size_t arena_get_reserved_size(arena_t* arena)
+{
+   return (arena != NULL) ? arena->reserved : 0;
+}
+
+/*
+ * Returns the total size of the areas allocated in an arena
+ * \param arena an arena
+ * \return size in bytes
+ */
+size_t arena_get_used_size(arena_t* arena)
+{
+   return (arena != NULL) ? arena->used : 0;
+}
+
+/*
+ * Frees an arena and all the areas allocated in it
+ * \param arena an arena
+ */
+void arena_free(arena_t* arena)
+{
+   if (arena == NULL)
+      return;
+
+   void* block = arena->blocks;
+   while (block != NULL) {
+      void* prev = ARENA_BLOCK_PREV(block);
+      lc_free(block);
+      block = prev;
+   }
+   lc_free(arena);
+}
@@ -151,6 +151,72 @@ unsigned long file_hash(char *filename)
    return add_hash((unsigned long) st.st_mtime, filename);
 }
 
+/*
+ * Hashes a buffer (FNV-1a over 64 bits words, then over the remaining bytes)
+ * \param h an original value (FILE_HASH_INIT to start a new hash)
+ * \param data a buffer to hash
+ * \param len size in bytes of the buffer
+ * \return the hash value of the buffer
+ */
+uint64_t add_data_hash(uint64_t h, const void* data, size_t len)
+{
+   const unsigned char* c = data;
+   size_t i = 0;
+
+   for (; i + sizeof(uint64_t) <= len; i += sizeof(uint64_t)) {
+      uint64_t w;
+      memcpy(&w, c + i, sizeof(w));
+      h = (h ^ w) * 0x100000001b3ULL;
+   }
+   for (; i < len; i++)
+      h = (h ^ c[i]) * 0x100000001b3ULL;
+   return h;
+}
+
+/*
+ * Hashes the contents of a file. Unlike file_hash, the result does not depend
+ * on the name or the modification date of the file.
+ * \param filename a file to hash
+ * \param size if not NULL, used to return the size of the file
+ * \return the hash value of the file contents, or 0 if the file can not be read
+ */
+uint64_t file_content_hash(char* filename, uint64_t* size)
+{
+   // Chunks are filled completely so that the words hashed do not depend
+   // on the size returned by each read
+   const size_t chunk_size = 1 << 20;
+   uint64_t h = FILE_HASH_INIT;
+   uint64_t total = 0;
+
+   if (filename == NULL)
+      return 0;
+   int fd = open(filename, O_RDONLY);
+   if (fd < 0)
+      return 0;
+   unsigned char* chunk = lc_malloc(chunk_size);
+   for (;;) {
+      size_t len = 0;
+      while (len < chunk_size) {
+         ssize_t n = read(fd, chunk + len, chunk_size - len);
+         if (n < 0 && errno == EINTR)
+            continue;
+         if (n <= 0)
+            break;
+         len += n;
+      }
+      h = add_data_hash(h, chunk, len);
+      total += len;
+      if (len < chunk_size)
+         break;
+   }
+   lc_free(chunk);
+   close(fd);
+
+   if (size != NULL)
+      *size = total;
+   return h;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 //                           general functions                               //
 ///////////////////////////////////////////////////////////////////////////////
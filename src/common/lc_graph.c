@@ -467,60 +467,242 @@ array_t *graph_node_get_accessible_nodes(const graph_node_t *root)
    return nodes;
 }
 
-/** Hashtable used by graph_node_topological_sort, to save DFS end time for each node */
-static hashtable_t *end_time_table;
-
 /** Helper function passed to graph_node_DFS when called by graph_node_topological_sort */
-static void inc_time(graph_node_t *node, void *user_data)
+static void add_node_to_postorder(graph_node_t *node, void *user_data)
 {
-   (void) node;
-   (*((int *) user_data))++;
+   array_add((array_t *) user_data, node);
 }
 
-/** Helper function passed to graph_node_DFS when called by graph_node_topological_sort */
-static void update_end_time_table(graph_node_t *node, void *user_data)
+/*
+ * Topologically sorts a graph from a root node.
+ * Nodes are sorted by decreasing DFS end time, that is in reverse postorder.
+ * \param root a graph (root node)
+ * \return sorted set of nodes (as dynamic array)
+ */
+array_t *graph_node_topological_sort(const graph_node_t *root)
 {
-   ptrdiff_t time = *((int *) user_data);
+   /* Explores the graph from the root node using DFS and saves nodes
+    * in the order they are fully explored */
+   array_t *postorder = array_new();
+   graph_node_DFS((graph_node_t *) root, NULL, add_node_to_postorder, NULL, postorder);
+
+   /* Reverses the postorder */
+   array_t *nodes = array_new_with_custom_size(array_length(postorder));
+   FOREACH_INARRAY_REVERSE(postorder, it_node) {
+      graph_node_t *node = ARRAY_GET_DATA(node, it_node);
+      array_add(nodes, node);
+   }
+   array_free(postorder, NULL);
 
-   hashtable_insert(end_time_table, node, (void *) time);
-   inc_time(node, user_data);
+   return nodes;
 }
 
-/** Helper function passed to array_sort when called by graph_node_topological_sort */
-static int cmp_nodes(const void *a, const void *b)
+/*
+ * Iterative traversals
+ * Nodes discovered by a traversal are saved in an open-addressing hashmap owned by the traversal
+ * (nodes are not modified, so traversals can be nested or run concurrently on the same graph),
+ * and in an array in discovery order.
+ */
+
+/** Nodes discovered by an iterative traversal */
+typedef struct {
+   hashmap_t *discovered; /**<Discovered nodes (keys), data is not NULL*/
+   graph_node_t **nodes; /**<Discovered nodes, in discovery order*/
+   unsigned int nb; /**<Number of discovered nodes*/
+   unsigned int max; /**<Capacity of nodes*/
+} graph_marks_t;
+
+/** Initializes the set of discovered nodes of an iterative traversal */
+static void marks_init(graph_marks_t *marks)
 {
-   ptrdiff_t end_time_a = (ptrdiff_t) hashtable_lookup(end_time_table,
-         *((void **) a));
-   ptrdiff_t end_time_b = (ptrdiff_t) hashtable_lookup(end_time_table,
-         *((void **) b));
+   marks->discovered = hashmap_new(0);
+   marks->nb = 0;
+   marks->max = 64;
+   marks->nodes = lc_malloc(marks->max * sizeof marks->nodes[0]);
+}
 
-   return end_time_b - end_time_a;
+/** Frees the set of discovered nodes of an iterative traversal */
+static void marks_free(graph_marks_t *marks)
+{
+   hashmap_free(marks->discovered, NULL, NULL);
+   lc_free(marks->nodes);
+}
+
+/** Returns TRUE if a node was discovered by an iterative traversal */
+static inline int marks_is_discovered(const graph_marks_t *marks,
+      const graph_node_t *node)
+{
+   return hashmap_lookup(marks->discovered, node) != NULL;
+}
+
+/** Marks a node as discovered by an iterative traversal */
+static inline void marks_discover(graph_marks_t *marks, graph_node_t *node)
+{
+   if (marks->nb == marks->max) {
+      marks->max *= 2;
+      marks->nodes = lc_realloc(marks->nodes, marks->max * sizeof marks->nodes[0]);
+   }
+   hashmap_insert(marks->discovered, node, node);
+   marks->nodes[marks->nb++] = node;
 }
 
 /*
- * Topologically sorts a graph from a root node.
+ * Traverses a graph using standard Breadth First Search (BFS) algorithm from a source node.
+ * Discovered nodes are the queue: they are dequeued in discovery (index) order.
+ * \see graph_node_BFS
+ */
+void graph_node_BFS_iterative(graph_node_t *root,
+      void (*func_node)(graph_node_t *, void*),
+      void (*func_edge)(graph_node_t *, graph_node_t *), void* un_data)
+{
+   if (root == NULL)
+      return;
+   graph_marks_t marks;
+   unsigned int head;
+
+   marks_init(&marks);
+   marks_discover(&marks, root);
+
+   for (head = 0; head < marks.nb; head++) {
+      graph_node_t *current_node = marks.nodes[head];
+
+      if (func_node)
+         func_node(current_node, un_data);
+
+      FOREACH_INLIST(current_node->out, it)
+      {
+         graph_edge_t *edge = GET_DATA_T(graph_edge_t*, it);
+         graph_node_t *node = edge->to;
+
+         /* If not already visited/inserted */
+         if (!marks_is_discovered(&marks, node))
+            marks_discover(&marks, node);
+
+         if (func_edge)
+            func_edge(current_node, node);
+      }
+   }
+
+   marks_free(&marks);
+}
+
+/** Frame of the explicit stack used by DFS_iterative: a node and its next edge to traverse */
+typedef struct {
+   graph_node_t *node; /**<Node being explored*/
+   list_t *edge; /**<Next edge to traverse from node*/
+} DFS_frame_t;
+
+/**
+ * Iterative version of DFS and BackDFS: same visit order and callbacks
  * \param root a graph (root node)
- * \return sorted set of nodes (as dynamic array)
+ * \param backward if TRUE, traverses incoming edges (BackDFS) instead of outgoing ones
  */
-array_t *graph_node_topological_sort(const graph_node_t *root)
+static void DFS_iterative(graph_node_t *root, int backward,
+      void (*func_node_before)(graph_node_t *, void *),
+      void (*func_node_after)(graph_node_t *, void *),
+      void (*func_edge)(graph_edge_t *, void *), void *user_data)
 {
-   int time = 0; /* Incremented before and after discovering a node during DFS */
+   if (root == NULL)
+      return;
+   graph_marks_t marks;
+   unsigned int nb_frames = 0, max_frames = 64;
+   DFS_frame_t *stack = lc_malloc(max_frames * sizeof stack[0]);
+
+   marks_init(&marks);
+
+   /* Discovers the root and pushes it */
+   marks_discover(&marks, root);
+   if (func_node_before != NULL)
+      func_node_before(root, user_data);
+   stack[0].node = root;
+   stack[0].edge = backward ? root->in : root->out;
+   nb_frames = 1;
+
+   while (nb_frames > 0) {
+      DFS_frame_t *top = &stack[nb_frames - 1];
+
+      /* All children visited: the node is fully discovered, pops it */
+      if (top->edge == NULL) {
+         if (func_node_after != NULL)
+            func_node_after(top->node, user_data);
+         nb_frames--;
+         continue;
+      }
+
+      graph_edge_t *cur_edge = GET_DATA_T(graph_edge_t*, top->edge);
+      graph_node_t *child = backward ? cur_edge->from : cur_edge->to;
+      top->edge = top->edge->next;
+
+      /* Before traversing the current edge, calls the corresponding function */
+      if (func_edge != NULL)
+         func_edge(cur_edge, user_data);
 
-   /* Creates an hashtable to associate an end time to each node */
-   end_time_table = hashtable_new(direct_hash, direct_equal);
+      /* If child not yet discovered, visits it */
+      if (!marks_is_discovered(&marks, child)) {
+         marks_discover(&marks, child);
+         if (func_node_before != NULL)
+            func_node_before(child, user_data);
+
+         if (nb_frames == max_frames) {
+            max_frames *= 2;
+            stack = lc_realloc(stack, max_frames * sizeof stack[0]);
+         }
+         stack[nb_frames].node = child;
+         stack[nb_frames].edge = backward ? child->in : child->out;
+         nb_frames++;
+      }
+   }
+
+   lc_free(stack);
+   marks_free(&marks);
+}
 
-   /* Explores the graph from the root node using DFS and, during exploration,
-    * keep at each time each node were explored */
-   graph_node_DFS((graph_node_t *) root, inc_time, update_end_time_table, NULL, &time);
+/*
+ * Traverses a graph using standard Depth First Search (DFS) algorithm from a source node,
+ * with an explicit stack.
+ * \see graph_node_DFS
+ */
+void graph_node_DFS_iterative(graph_node_t *root,
+      void (*func_node_before)(graph_node_t *, void *),
+      void (*func_node_after)(graph_node_t *, void *),
+      void (*func_edge)(graph_edge_t *, void *), void *user_data)
+{
+   DFS_iterative(root, FALSE, func_node_before, func_node_after, func_edge,
+         user_data);
+}
 
-   /* Gets the list of nodes accessible from the root node */
-   array_t *nodes = graph_node_get_accessible_nodes(root);
+/*
+ * Traverses a graph using standard Back Depth First Search (DFS) algorithm from a source node,
+ * with an explicit stack.
+ * \see graph_node_BackDFS
+ */
+void graph_node_BackDFS_iterative(graph_node_t *root,
+      void (*func_node_before)(graph_node_t *, void *),
+      void (*func_node_after)(graph_node_t *, void *),
+      void (*func_edge)(graph_edge_t *, void *), void *user_data)
+{
+   DFS_iterative(root, TRUE, func_node_before, func_node_after, func_edge,
+         user_data);
+}
 
-   /* Sorts the list */
-   array_sort(nodes, cmp_nodes);
+/*
+ * Topologically sorts a graph from a root node, using graph_node_DFS_iterative.
+ * \param root a graph (root node)
+ * \return sorted set of nodes (as dynamic array)
+ */
+array_t *graph_node_topological_sort_iterative(const graph_node_t *root)
+{
+   array_t *postorder = array_new();
+   graph_node_DFS_iterative((graph_node_t *) root, NULL, add_node_to_postorder,
+         NULL, postorder);
 
-   /* Frees memory allocated for end_time_table */
-   hashtable_free(end_time_table, NULL, NULL);
+   /* Reverses the postorder */
+   array_t *nodes = array_new_with_custom_size(array_length(postorder));
+   FOREACH_INARRAY_REVERSE(postorder, it_node) {
+      graph_node_t *node = ARRAY_GET_DATA(node, it_node);
+      array_add(nodes, node);
+   }
+   array_free(postorder, NULL);
 
    return nodes;
 }
@@ -797,6 +979,288 @@ int graph_node_get_nb_paths(const graph_node_t *root, int max_paths)
    return nb_paths;
 }
 
+/*
+ * Lazy paths enumeration
+ * The iterator saves, for each node reachable from the root, its children through non-back edges
+ * (so later changes in the graph do not affect it). Paths are then enumerated by a depth-first
+ * traversal with an explicit stack (the current path): only one path is in memory at a time.
+ */
+
+/*
+ * Creates an iterator over the paths of a graph starting from a given source (root) node,
+ * ignoring backedges. Same paths as graph_node_compute_paths but in depth-first order.
+ * \param root a graph (root node)
+ * \return a new iterator, to free with graph_paths_iter_free
+ */
+graph_paths_iter_t *graph_node_paths_iter_new(const graph_node_t *root)
+{
+   if (root == NULL)
+      return NULL;
+   graph_paths_iter_t *iter = lc_malloc0(sizeof *iter);
+   hashtable_t *bet = graph_node_get_backedges_table(root);
+   hashmap_t *node2id = hashmap_new(0);
+   array_t *nodes = array_new();
+   array_t *children = array_new();
+   int i, max_nodes = 64;
+
+   iter->children_start = lc_malloc(max_nodes * sizeof iter->children_start[0]);
+
+   /* Numbers nodes by discovery order (BFS), root first, and saves children of each node */
+   array_add(nodes, (void *) root);
+   hashmap_insert(node2id, (void *) root, (void *) (intptr_t) 0);
+   for (i = 0; i < array_length(nodes); i++) {
+      const graph_node_t *node = nodes->mem[i];
+
+      if (i + 1 >= max_nodes) {
+         max_nodes *= 2;
+         iter->children_start = lc_realloc(iter->children_start,
+               max_nodes * sizeof iter->children_start[0]);
+      }
+      iter->children_start[i] = array_length(children);
+
+      FOREACH_INLIST(node->out, it_e) {
+         const graph_edge_t *edge = GET_DATA_T(graph_edge_t*, it_e);
+         if (graph_is_backedge_from_table(edge, bet))
+            continue;
+
+         hashmap_slot_t *slot = hashmap_lookup_slot(node2id, edge->to);
+         intptr_t id;
+         if (slot == NULL) {
+            id = array_length(nodes);
+            array_add(nodes, edge->to);
+            hashmap_insert(node2id, edge->to, (void *) id);
+         } else
+            id = (intptr_t) slot->data;
+         array_add(children, (void *) id);
+      }
+   }
+   iter->children_start[i] = array_length(children);
+
+   iter->nb_nodes = array_length(nodes);
+   iter->nodes = lc_malloc(iter->nb_nodes * sizeof iter->nodes[0]);
+   memcpy(iter->nodes, nodes->mem, iter->nb_nodes * sizeof iter->nodes[0]);
+   iter->children = lc_malloc((array_length(children) + 1) * sizeof iter->children[0]);
+   for (i = 0; i < array_length(children); i++)
+      iter->children[i] = (intptr_t) children->mem[i];
+
+   /* A path (without backedges) goes at most once through each node */
+   iter->path = lc_malloc(iter->nb_nodes * sizeof iter->path[0]);
+   iter->followed = lc_malloc(iter->nb_nodes * sizeof iter->followed[0]);
+   iter->depth = -1;
+   iter->path_nodes = array_new();
+
+   array_free(nodes, NULL);
+   array_free(children, NULL);
+   hashmap_free(node2id, NULL, NULL);
+   hashtable_free(bet, NULL, NULL);
+
+   return iter;
+}
+
+/** Extends the current path of an iterator to a leaf, following first children */
+static void paths_iter_descend(graph_paths_iter_t *iter)
+{
+   int node = iter->path[iter->depth];
+
+   while (iter->children_start[node] < iter->children_start[node + 1]) {
+      iter->followed[iter->depth] = iter->children_start[node];
+      node = iter->children[iter->children_start[node]];
+      iter->path[++iter->depth] = node;
+   }
+}
+
+/*
+ * Returns the next path of an iterator
+ * \param iter an iterator returned by graph_node_paths_iter_new
+ * \return path (array of nodes) owned by the iterator and valid until the next call, or NULL if no more paths
+ */
+array_t *graph_paths_iter_next(graph_paths_iter_t *iter)
+{
+   if (iter == NULL || iter->depth == -2)
+      return NULL;
+
+   if (iter->depth == -1) {
+      /* First path */
+      iter->depth = 0;
+      iter->path[0] = 0;
+   } else {
+      /* Backtracks to the deepest node having a next child */
+      do {
+         iter->depth--;
+      } while (iter->depth >= 0
+            && iter->followed[iter->depth] + 1
+                  >= iter->children_start[iter->path[iter->depth] + 1]);
+
+      /* All paths enumerated */
+      if (iter->depth < 0) {
+         iter->depth = -2;
+         array_flush(iter->path_nodes, NULL);
+         return NULL;
+      }
+
+      const int child = iter->children[++iter->followed[iter->depth]];
+      iter->path[++iter->depth] = child;
+   }
+   paths_iter_descend(iter);
+
+   /* Converts node identifiers to nodes */
+   int i;
+   array_flush(iter->path_nodes, NULL);
+   for (i = 0; i <= iter->depth; i++)
+      array_add(iter->path_nodes, iter->nodes[iter->path[i]]);
+
+   return iter->path_nodes;
+}
+
+/*
+ * Frees an iterator returned by graph_node_paths_iter_new
+ * \param iter an iterator
+ */
+void graph_paths_iter_free(graph_paths_iter_t *iter)
+{
+   if (iter == NULL)
+      return;
+
+   lc_free(iter->nodes);
+   lc_free(iter->children_start);
+   lc_free(iter->children);
+   lc_free(iter->path);
+   lc_free(iter->followed);
+   array_free(iter->path_nodes, NULL);
+   lc_free(iter);
+}
+
+/*
+ * Top-K paths
+ * For each node, in reverse topological order, the K heaviest paths from this node to a leaf are
+ * saved as (weight, child, rank in child paths). Paths of a node are obtained by merging the
+ * sorted paths of its children.
+ */
+
+/** One of the K heaviest paths from a node: its weight and its continuation */
+typedef struct {
+   float weight; /**<Sum of the weights of the path nodes*/
+   graph_node_t *child; /**<Next node in the path, or NULL for a leaf*/
+   int rank; /**<Rank of the continuation in the child paths*/
+} top_path_t;
+
+/*
+ * Returns the K heaviest paths in a graph starting from a given source (root) node, ignoring backedges.
+ * Memory is proportional to the number of nodes times K, whatever the number of paths.
+ * \param root a graph (root node)
+ * \param k maximum number of paths to return
+ * \param get_weight function returning the weight of a node (with user as second parameter).
+ * If NULL, all nodes have the weight 1 (longest paths)
+ * \param user a parameter given by the user to get_weight
+ * \return queue of paths (arrays of nodes) starting from root, by decreasing weight
+ */
+queue_t *graph_node_get_top_paths(const graph_node_t *root, int k,
+      float (*get_weight)(const graph_node_t *, void *), void *user)
+{
+   queue_t *paths = queue_new();
+   if (root == NULL || k <= 0)
+      return paths;
+
+   hashtable_t *bet = graph_node_get_backedges_table(root);
+   array_t *sorted_nodes = graph_node_topological_sort_iterative(root);
+   const int nb_nodes = array_length(sorted_nodes);
+
+   /* Dense index of each node: its rank in topological order (root is first) */
+   hashmap_t *ranks = hashmap_new(nb_nodes);
+   int n;
+   for (n = 0; n < nb_nodes; n++)
+      hashmap_insert(ranks, array_get_elt_at_pos(sorted_nodes, n),
+            (void *) (intptr_t) n);
+
+   top_path_t *top = lc_malloc((size_t) nb_nodes * k * sizeof top[0]);
+   int *nb_top = lc_malloc0(nb_nodes * sizeof nb_top[0]);
+   int *heads = NULL;
+   int max_heads = 0;
+
+   /* For each node, children first */
+   FOREACH_INARRAY_REVERSE(sorted_nodes, it_n) {
+      graph_node_t *node = ARRAY_GET_DATA(node, it_n);
+      const int index = (int) (intptr_t) hashmap_lookup(ranks, node);
+      top_path_t *node_top = &top[(size_t) index * k];
+      const float weight = (get_weight != NULL) ? get_weight(node, user) : 1.0f;
+      int nb_children = 0;
+
+      FOREACH_INLIST(node->out, it_e) {
+         nb_children++;
+      }
+      if (nb_children > max_heads) {
+         max_heads = nb_children;
+         heads = lc_realloc(heads, max_heads * sizeof heads[0]);
+      }
+      memset(heads, 0, nb_children * sizeof heads[0]);
+
+      /* Merges paths of children (each sorted by decreasing weight) */
+      while (nb_top[index] < k) {
+         int i = 0, best = -1;
+         float best_weight = 0;
+         graph_node_t *best_child = NULL;
+
+         FOREACH_INLIST(node->out, it_e) {
+            const graph_edge_t *edge = GET_DATA_T(graph_edge_t*, it_e);
+            graph_node_t *child = edge->to;
+            const int child_index = (int) (intptr_t) hashmap_lookup(ranks, child);
+
+            if (!graph_is_backedge_from_table(edge, bet)
+                  && heads[i] < nb_top[child_index]) {
+               const float w = top[(size_t) child_index * k + heads[i]].weight;
+               if (best == -1 || w > best_weight) {
+                  best = i;
+                  best_weight = w;
+                  best_child = child;
+               }
+            }
+            i++;
+         }
+         if (best == -1)
+            break;
+
+         top_path_t *tp = &node_top[nb_top[index]++];
+         tp->weight = weight + best_weight;
+         tp->child = best_child;
+         tp->rank = heads[best]++;
+      }
+
+      /* Leaf */
+      if (nb_top[index] == 0 && get_nb_children(node, bet) == 0) {
+         node_top[0].weight = weight;
+         node_top[0].child = NULL;
+         node_top[0].rank = 0;
+         nb_top[index] = 1;
+      }
+   }
+
+   /* Builds paths from the root */
+   int r;
+   for (r = 0; r < nb_top[0]; r++) {
+      array_t *path = array_new();
+      graph_node_t *node = (graph_node_t *) root;
+      int rank = r;
+
+      while (node != NULL) {
+         const int index = (int) (intptr_t) hashmap_lookup(ranks, node);
+         const top_path_t *tp = &top[(size_t) index * k + rank];
+         array_add(path, node);
+         node = tp->child;
+         rank = tp->rank;
+      }
+      queue_add_tail(paths, path);
+   }
+
+   lc_free(heads);
+   lc_free(nb_top);
+   lc_free(top);
+   array_free(sorted_nodes, NULL);
+   hashmap_free(ranks, NULL, NULL);
+   hashtable_free(bet, NULL, NULL);
+
+   return paths;
+}
+
 /*
  * Removes and frees a node and frees all edges linked to it
  * \see graph_free_from_nodes to easily and quickly free an entire graph (connected component) or, better, use new interface (based on graph_connected_component_t)
@@ -0,0 +1,344 @@
+/*
+   Copyright (C) 2004 - 2018 Université de Versailles Saint-Quentin-en-Yvelines (UVSQ)
+
+   This file is part of MAQAO.
+
+  MAQAO is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public License
+   as published by the Free Software Foundation; either version 3
+   of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+/**
+ * \file lc_hashmap.c
+ * \brief defines an open-addressing hashtable with pointer/integer keys
+ *
+ * Slots (key/data pairs) are stored inline in an array whose size is a power of two.
+ * A parallel array holds one control byte per slot: HASHMAP_CTRL_EMPTY, HASHMAP_CTRL_DELETED
+ * or, for a used slot, the 7 lowest bits of the key hash. A lookup compares control bytes
+ * by groups of HASHMAP_GROUP_SIZE (one SSE2 instruction) and compares keys only for matching
+ * bytes. Groups are probed in triangular order, which visits all of them. The first
+ * HASHMAP_GROUP_SIZE control bytes are copied after the last one so that a group can start
+ * at any slot.
+ * */
+#include "libmcommon.h"
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+//                              hashmap functions                            //
+///////////////////////////////////////////////////////////////////////////////
+
+/**Maximal load (used and deleted slots) is 7/8 of the capacity*/
+#define HASHMAP_MAX_LOAD(C) ((C) - (C) / 8)
+
+/**Returns the part of a hash selecting the first probed slot*/
+#define H1(H) ((H) >> 7)
+
+/**Returns the part of a hash saved in control bytes*/
+#define H2(H) ((uint8_t) ((H) & 0x7F))
+
+/** Hashes a key (64-bit finalizer of MurmurHash3: mixes all bits, pointers being aligned) */
+static inline uint64_t hashmap_hash(const void *key)
+{
+   uint64_t h = (uint64_t) (uintptr_t) key;
+   h ^= h >> 33;
+   h *= 0xff51afd7ed558ccdULL;
+   h ^= h >> 33;
+   h *= 0xc4ceb9fe1a85ec53ULL;
+   h ^= h >> 33;
+   return h;
+}
+
+#ifdef __SSE2__
+/** Returns a bitmask of the control bytes of a group equal to a value */
+static inline uint32_t group_match(const uint8_t *ctrl, uint8_t value)
+{
+   const __m128i group = _mm_loadu_si128((const __m128i*) ctrl);
+   return _mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8((char) value)));
+}
+
+/** Returns a bitmask of the empty or deleted slots of a group (control bytes with the high bit set) */
+static inline uint32_t group_match_free(const uint8_t *ctrl)
+{
+   return _mm_movemask_epi8(_mm_loadu_si128((const __m128i*) ctrl));
+}
+#else
+static inline uint32_t group_match(const uint8_t *ctrl, uint8_t value)
+{
+   uint32_t mask = 0, i;
+   for (i = 0; i < HASHMAP_GROUP_SIZE; i++)
+      mask |= (uint32_t) (ctrl[i] == value) << i;
+   return mask;
+}
+
+static inline uint32_t group_match_free(const uint8_t *ctrl)
+{
+   uint32_t mask = 0, i;
+   for (i = 0; i < HASHMAP_GROUP_SIZE; i++)
+      mask |= (uint32_t) (ctrl[i] >> 7) << i;
+   return mask;
+}
+#endif
+
+/** Sets the control byte of a slot, and its copy for the first slots */
+static inline void set_ctrl(hashmap_t *m, uint32_t i, uint8_t value)
+{
+   m->ctrl[i] = value;
+   if (i < HASHMAP_GROUP_SIZE)
+      m->ctrl[m->capacity + i] = value;
+}
+
+/** Returns the slot holding a key or NULL */
+static inline hashmap_slot_t* find_slot(const hashmap_t *m, const void *key,
+      uint64_t hash)
+{
+   const uint32_t mask = m->capacity - 1;
+   const uint8_t h2 = H2(hash);
+   uint32_t pos = H1(hash) & mask, step = 0;
+
+   while (TRUE) {
+      uint32_t match = group_match(m->ctrl + pos, h2);
+      while (match != 0) {
+         const uint32_t i = (pos + __builtin_ctz(match)) & mask;
+         if (m->slots[i].key == key)
+            return &(m->slots[i]);
+         match &= match - 1;
+      }
+      /* An empty slot ends the probe sequence (there is always one) */
+      if (group_match(m->ctrl + pos, HASHMAP_CTRL_EMPTY) != 0)
+         return NULL;
+      step += HASHMAP_GROUP_SIZE;
+      pos = (pos + step) & mask;
+   }
+}
+
+/** Returns the index of the first empty or deleted slot in the probe sequence of a hash */
+static inline uint32_t find_free(const hashmap_t *m, uint64_t hash)
+{
+   const uint32_t mask = m->capacity - 1;
+   uint32_t pos = H1(hash) & mask, step = 0;
+
+   while (TRUE) {
+      const uint32_t match = group_match_free(m->ctrl + pos);
+      if (match != 0)
+         return (pos + __builtin_ctz(match)) & mask;
+      step += HASHMAP_GROUP_SIZE;
+      pos = (pos + step) & mask;
+   }
+}
+
+/** Allocates empty slots and control bytes for a given capacity (power of two) */
+static void hashmap_alloc(hashmap_t *m, uint32_t capacity)
+{
+   m->capacity = capacity;
+   m->ctrl = lc_malloc(capacity + HASHMAP_GROUP_SIZE);
+   memset(m->ctrl, HASHMAP_CTRL_EMPTY, capacity + HASHMAP_GROUP_SIZE);
+   m->slots = lc_malloc(capacity * sizeof m->slots[0]);
+   m->growth_left = HASHMAP_MAX_LOAD(capacity);
+}
+
+/** Moves all elements to new slots, dropping deleted ones. Doubles the capacity if needed */
+static void hashmap_rehash(hashmap_t *m)
+{
+   uint8_t *old_ctrl = m->ctrl;
+   hashmap_slot_t *old_slots = m->slots;
+   const uint32_t old_capacity = m->capacity;
+   uint32_t i;
+
+   /* Same capacity if mostly deleted slots, else double it */
+   uint32_t capacity = old_capacity;
+   if (m->nnodes >= HASHMAP_MAX_LOAD(old_capacity) / 2) {
+      if (old_capacity >= (UINT32_C(1) << 31))
+         HLTMSG("Cannot increase hashmap capacity beyond %"PRIu32"\n", old_capacity);
+      capacity *= 2;
+   }
+   hashmap_alloc(m, capacity);
+
+   for (i = 0; i < old_capacity; i++) {
+      if ((old_ctrl[i] & 0x80) != 0)
+         continue;
+      const uint64_t hash = hashmap_hash(old_slots[i].key);
+      const uint32_t j = find_free(m, hash);
+      set_ctrl(m, j, H2(hash));
+      m->slots[j] = old_slots[i];
+   }
+   m->growth_left -= m->nnodes;
+
+   lc_free(old_ctrl);
+   lc_free(old_slots);
+}
+
+/*
+ * Creates a new hashmap
+ * \param size expected number of elements. If 0, use HASHMAP_INIT_SIZE
+ * \return a new hashmap
+ */
+hashmap_t* hashmap_new(uint32_t size)
+{
+   hashmap_t* m = lc_malloc(sizeof *m);
+   uint32_t capacity = HASHMAP_GROUP_SIZE;
+
+   if (size == 0)
+      size = HASHMAP_INIT_SIZE;
+   while (HASHMAP_MAX_LOAD(capacity) < size && capacity < (UINT32_C(1) << 31))
+      capacity *= 2;
+
+   hashmap_alloc(m, capacity);
+   m->nnodes = 0;
+   return m;
+}
+
+/*
+ * Inserts an element into a hashmap. If the key is already present, its data is replaced
+ * \param m a hashmap
+ * \param key element key (pointer or integer)
+ * \param data element to insert
+ */
+void hashmap_insert(hashmap_t *m, void *key, void *data)
+{
+   if (m == NULL)
+      return;
+   const uint64_t hash = hashmap_hash(key);
+
+   hashmap_slot_t* slot = find_slot(m, key, hash);
+   if (slot != NULL) {
+      slot->data = data;
+      return;
+   }
+
+   /* Reusing a deleted slot does not decrease the number of empty slots */
+   uint32_t i = find_free(m, hash);
+   if (m->growth_left == 0 && m->ctrl[i] == HASHMAP_CTRL_EMPTY) {
+      hashmap_rehash(m);
+      i = find_free(m, hash);
+   }
+   if (m->ctrl[i] == HASHMAP_CTRL_EMPTY)
+      m->growth_left--;
+
+   set_ctrl(m, i, H2(hash));
+   m->slots[i].key = key;
+   m->slots[i].data = data;
+   m->nnodes++;
+}
+
+/*
+ * Looks for the slot corresponding to a key
+ * \param m a hashmap
+ * \param key a key
+ * \return the slot (valid until next insertion) or NULL if not found
+ */
+hashmap_slot_t* hashmap_lookup_slot(const hashmap_t *m, const void *key)
+{
+   if (m == NULL)
+      return NULL;
+   return find_slot(m, key, hashmap_hash(key));
+}
+
+/*
+ * Looks for the element corresponding to a key
+ * \param m a hashmap
+ * \param key a key
+ * \return the element or NULL if not found
+ */
+void* hashmap_lookup(const hashmap_t *m, const void *key)
+{
+   hashmap_slot_t* slot = hashmap_lookup_slot(m, key);
+   return (slot != NULL) ? slot->data : NULL;
+}
+
+/*
+ * Removes the element corresponding to a key (but does not free it)
+ * \param m a hashmap
+ * \param key a key
+ * \return the element if found, else NULL
+ */
+void* hashmap_remove(hashmap_t *m, const void *key)
+{
+   hashmap_slot_t* slot = hashmap_lookup_slot(m, key);
+   if (slot == NULL)
+      return NULL;
+
+   /* Marked as deleted (not empty) to keep probe sequences going through it */
+   set_ctrl(m, slot - m->slots, HASHMAP_CTRL_DELETED);
+   m->nnodes--;
+   return slot->data;
+}
+
+/*
+ * Traverses a hashmap and executes a function on each element
+ * \param m a hashmap
+ * \param f a function with the same prototype as for hashtable_foreach (key, element, user)
+ * \param user a parameter given by the user for the function to execute
+ */
+void hashmap_foreach(const hashmap_t *m, void (*f)(void *, void *, void *),
+      void *user)
+{
+   if (m == NULL || f == NULL)
+      return;
+
+   FOREACH_INHASHMAP(m, iter) {
+      f(iter->key, iter->data, user);
+   }
+}
+
+/*
+ * Returns the number of elements in a hashmap
+ * \param m a hashmap
+ * \return number of elements
+ */
+uint32_t hashmap_size(const hashmap_t *m)
+{
+   return (m != NULL) ? m->nnodes : 0;
+}
+
+/*
+ * Empties a hashmap, but does not free it
+ * \param m a hashmap
+ * \param f Function for freeing an element's data (or NULL)
+ * \param fk Function for freeing an element's key (or NULL)
+ */
+void hashmap_flush(hashmap_t *m, void (*f)(void*), void (*fk)(void*))
+{
+   if (m == NULL)
+      return;
+
+   if (f != NULL || fk != NULL) {
+      FOREACH_INHASHMAP(m, iter) {
+         if (f != NULL)
+            f(iter->data);
+         if (fk != NULL)
+            fk(iter->key);
+      }
+   }
+   memset(m->ctrl, HASHMAP_CTRL_EMPTY, m->capacity + HASHMAP_GROUP_SIZE);
+   m->nnodes = 0;
+   m->growth_left = HASHMAP_MAX_LOAD(m->capacity);
+}
+
+/*
+ * Empties a hashmap and frees it
+ * \param m a hashmap
+ * \param f Function for freeing an element's data (or NULL)
+ * \param fk Function for freeing an element's key (or NULL)
+ */
+void hashmap_free(hashmap_t *m, void (*f)(void*), void (*fk)(void*))
+{
+   if (m == NULL)
+      return;
+
+   hashmap_flush(m, f, fk);
+   lc_free(m->ctrl);
+   lc_free(m->slots);
+   lc_free(m);
+}
@@ -0,0 +1,233 @@
+/*
+   Copyright (C) 2004 - 2018 Université de Versailles Saint-Quentin-en-Yvelines (UVSQ)
+
+   This file is part of MAQAO.
+
+  MAQAO is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public License
+   as published by the Free Software Foundation; either version 3
+   of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+/**
+ * \file lc_threadpool.c
+ * \brief defines a work-stealing thread pool used to run independent tasks
+ * */
+#ifndef _WIN32
+#include <pthread.h>
+#endif
+
+#include "libmcommon.h"
+
+///////////////////////////////////////////////////////////////////////////////
+//                            thread pool functions                          //
+///////////////////////////////////////////////////////////////////////////////
+
+/*
+ * Returns the number of processors available on the host
+ * \return number of online processors (at least 1)
+ */
+int threadpool_get_nb_cpus()
+{
+#ifdef _WIN32
+   SYSTEM_INFO sysinfo;
+   GetSystemInfo(&sysinfo);
+   return (sysinfo.dwNumberOfProcessors > 0) ? sysinfo.dwNumberOfProcessors : 1;
+#else
+   long nb_cpus = sysconf(_SC_NPROCESSORS_ONLN);
+   return (nb_cpus > 0) ? (int) nb_cpus : 1;
+#endif
+}
+
+#ifndef _WIN32
+/**
+ * \struct tp_worker_s
+ * Range of tasks owned by a worker. Other workers can steal its upper part.
+ */
+typedef struct tp_worker_s {
+   pthread_mutex_t lock; /**<Protects next and end. Stores are atomic since thieves read them without lock*/
+   int next; /**<Next task to run*/
+   int end; /**<End (excluded) of the range owned by the worker*/
+   char started; /**<TRUE if a thread has been created for the worker*/
+   struct tp_pool_s* pool; /**<Pool the worker belongs to*/
+} tp_worker_t;
+
+/**
+ * \struct tp_pool_s
+ * Data shared by all workers of a pool
+ */
+typedef struct tp_pool_s {
+   tp_worker_t* workers; /**<Array of workers*/
+   int nb_workers; /**<Size of workers array*/
+   threadpool_task_t task; /**<Function to run for each task*/
+   void* user; /**<User parameter given to task*/
+} tp_pool_t;
+
+/*
+ * Takes the next task in a worker range
+ * \param w a worker
+ * \return a task index or -1 if the range is empty
+ */
+static int _worker_pop(tp_worker_t* w)
+{
+   int task_id = -1;
+   pthread_mutex_lock(&w->lock);
+   if (w->next < w->end) {
+      task_id = w->next;
+      __atomic_store_n(&w->next, task_id + 1, __ATOMIC_RELAXED);
+   }
+   pthread_mutex_unlock(&w->lock);
+   return task_id;
+}
+
+/*
+ * Steals the upper half of the largest range among other workers
+ * \param w the worker looking for tasks. Its range is updated with stolen tasks
+ * \return TRUE if some tasks have been stolen, else FALSE
+ */
+static int _worker_steal(tp_worker_t* w)
+{
+   tp_pool_t* pool = w->pool;
+
+   while (TRUE) {
+      tp_worker_t* victim = NULL;
+      int max_remaining = 0;
+      int i;
+
+      // Looks for the worker with the most remaining tasks
+      // Values are read without lock (atomically): they are checked again once locked
+      for (i = 0; i < pool->nb_workers; i++) {
+         tp_worker_t* candidate = &pool->workers[i];
+         int remaining = __atomic_load_n(&candidate->end, __ATOMIC_RELAXED)
+               - __atomic_load_n(&candidate->next, __ATOMIC_RELAXED);
+         if (candidate != w && remaining > max_remaining) {
+            max_remaining = remaining;
+            victim = candidate;
+         }
+      }
+      if (victim == NULL)
+         return FALSE;
+
+      int start = 0, end = 0;
+      pthread_mutex_lock(&victim->lock);
+      int remaining = victim->end - victim->next;
+      if (remaining > 0) {
+         end = victim->end;
+         start = end - (remaining + 1) / 2;
+         __atomic_store_n(&victim->end, start, __ATOMIC_RELAXED);
+      }
+      pthread_mutex_unlock(&victim->lock);
+
+      if (end > start) {
+         pthread_mutex_lock(&w->lock);
+         __atomic_store_n(&w->next, start, __ATOMIC_RELAXED);
+         __atomic_store_n(&w->end, end, __ATOMIC_RELAXED);
+         pthread_mutex_unlock(&w->lock);
+         return TRUE;
+      }
+      // The victim has been emptied in the meantime: look for another one
+   }
+}
+
+/*
+ * Main loop of a worker: runs its own tasks then steals from others
+ * \param p a worker (tp_worker_t*)
+ * \return NULL
+ */
+static void* _worker_routine(void* p)
+{
+   tp_worker_t* w = p;
+   tp_pool_t* pool = w->pool;
+
+   do {
+      int task_id;
+      while ((task_id = _worker_pop(w)) >= 0)
+         pool->task(task_id, pool->user);
+   } while (_worker_steal(w) == TRUE);
+
+   return NULL;
+}
+#endif
+
+/*
+ * Runs a set of independent tasks on a work-stealing thread pool and waits for
+ * their completion.
+ * \param nb_threads number of threads to use. If <= 0, use threadpool_get_nb_cpus()
+ * \param nb_tasks number of tasks to run
+ * \param task function executed for each task
+ * \param user a parameter given by the user, passed to each task
+ * \return number of threads actually used
+ */
+int threadpool_run(int nb_threads, int nb_tasks, threadpool_task_t task,
+      void* user)
+{
+   int i;
+   if (task == NULL || nb_tasks <= 0)
+      return 0;
+   if (nb_threads <= 0)
+      nb_threads = threadpool_get_nb_cpus();
+   if (nb_threads > nb_tasks)
+      nb_threads = nb_tasks;
+
+#ifndef _WIN32
+   if (nb_threads > 1) {
+      tp_pool_t pool;
+      pool.nb_workers = nb_threads;
+      pool.task = task;
+      pool.user = user;
+      pool.workers = lc_malloc0(nb_threads * sizeof(tp_worker_t));
+
+      // Initial static split of the tasks
+      for (i = 0; i < nb_threads; i++) {
+         tp_worker_t* w = &pool.workers[i];
+         pthread_mutex_init(&w->lock, NULL);
+         w->next = (int) (((int64_t) nb_tasks * i) / nb_threads);
+         w->end = (int) (((int64_t) nb_tasks * (i + 1)) / nb_threads);
+         w->started = FALSE;
+         w->pool = &pool;
+      }
+
+      pthread_attr_t attr;
+      pthread_attr_init(&attr);
+      pthread_attr_setstacksize(&attr, THREADPOOL_STACK_SIZE);
+      pthread_t* threads = lc_malloc0(nb_threads * sizeof(pthread_t));
+      int nb_started = 1;
+
+      // Worker 0 is the calling thread
+      for (i = 1; i < nb_threads; i++) {
+         if (pthread_create(&threads[i], &attr, &_worker_routine,
+               &pool.workers[i]) != 0) {
+            WRNMSG("Unable to create thread %d of the pool: its tasks will be stolen\n", i);
+            continue;
+         }
+         pool.workers[i].started = TRUE;
+         nb_started++;
+      }
+      _worker_routine(&pool.workers[0]);
+
+      for (i = 1; i < nb_threads; i++)
+         if (pool.workers[i].started == TRUE)
+            pthread_join(threads[i], NULL);
+
+      pthread_attr_destroy(&attr);
+      for (i = 0; i < nb_threads; i++)
+         pthread_mutex_destroy(&pool.workers[i].lock);
+      lc_free(threads);
+      lc_free(pool.workers);
+      return nb_started;
+   }
+#endif
+
+   for (i = 0; i < nb_tasks; i++)
+      task(i, user);
+   return 1;
+}
@@ -439,6 +439,11 @@ typedef struct graph_edge_s graph_edge_t;
  */
 typedef struct graph_connected_component_s graph_connected_component_t;
 
+/**
+ * Alias for struct graph_paths_iter_s structure
+ */
+typedef struct graph_paths_iter_s graph_paths_iter_t;
+
 /**
  * Alias for struct graph_s structure
  */
@@ -454,6 +459,21 @@ typedef struct hashtable_s hashtable_t;
  */
 typedef struct hashnode_s hashnode_t;
 
+/**
+ * Alias for struct arena_s structure
+ */
+typedef struct arena_s arena_t;
+
+/**
+ * Alias for struct hashmap_s structure
+ */
+typedef struct hashmap_s hashmap_t;
+
+/**
+ * Alias for struct hashmap_slot_s structure
+ */
+typedef struct hashmap_slot_s hashmap_slot_t;
+
 ///////////////////////////////////////////////////////////////////////////////
 //                            memory functions                               //
 ///////////////////////////////////////////////////////////////////////////////
@@ -859,6 +879,28 @@ extern unsigned long add_hash(unsigned long h, char *c);
  */
 extern unsigned long file_hash(char *filename);
 
+/**
+ * Initial value for add_data_hash
+ */
+#define FILE_HASH_INIT 0xcbf29ce484222325ULL
+
+/**
+ * Hashes a buffer
+ * \param h an original value (FILE_HASH_INIT to start a new hash)
+ * \param data a buffer to hash
+ * \param len size in bytes of the buffer
+ * \return the hash value of the buffer
+ */
+extern uint64_t add_data_hash(uint64_t h, const void* data, size_t len);
+
+/**
+ * Hashes the contents of a file
+ * \param filename a file to hash
+ * \param size if not NULL, used to return the size of the file
+ * \return the hash value of the file contents, or 0 if the file can not be read
+ */
+extern uint64_t file_content_hash(char* filename, uint64_t* size);
+
 ///////////////////////////////////////////////////////////////////////////////
 //                                  lists                                    //
 ///////////////////////////////////////////////////////////////////////////////
@@ -2320,6 +2362,119 @@ extern int strcmp_qsort(const void* a, const void* b);
  */
 extern int strcmp_bsearch(const void* a, const void* b);
 
+///////////////////////////////////////////////////////////////////////////////
+//                                 hashmaps                                  //
+///////////////////////////////////////////////////////////////////////////////
+#define HASHMAP_GROUP_SIZE 16 /**<Number of slots probed at once (one SSE2 vector of control bytes)*/
+#define HASHMAP_INIT_SIZE  64 /**<Hashmap default initial capacity*/
+#define HASHMAP_CTRL_EMPTY   ((uint8_t) 0x80) /**<Control byte of a never used slot*/
+#define HASHMAP_CTRL_DELETED ((uint8_t) 0xFE) /**<Control byte of a removed slot*/
+
+/**
+ * \struct hashmap_slot_s
+ * \brief Key/data pair stored inline in a hashmap
+ * */
+struct hashmap_slot_s {
+   void *key; /**<Key (pointer or integer)*/
+   void *data; /**<Pointer to the object*/
+};
+
+/**
+ * \struct hashmap_s
+ * \brief Open-addressing hashtable with pointer/integer keys (compared with ==).
+ *        Contrary to hashtable_t, keys are unique and no memory is allocated per element:
+ *        slots are stored in a power-of-two sized array, next to an array of control bytes
+ *        (7 bits of the key hash for used slots) probed by groups of HASHMAP_GROUP_SIZE.
+ * */
+struct hashmap_s {
+   uint8_t *ctrl; /**<Control bytes: capacity + HASHMAP_GROUP_SIZE (copy of the first ones)*/
+   hashmap_slot_t *slots; /**<Slots, indexed by the key hash*/
+   uint32_t capacity; /**<Number of slots (power of two)*/
+   uint32_t nnodes; /**<Number of elements*/
+   uint32_t growth_left; /**<Number of elements that can be inserted before a rehash*/
+};
+
+/**
+ * Macro used to traverse a hashmap. GET_KEY and GET_DATA_T can be used on the iterator
+ * X: a hashmap
+ * Y: name of an iterator (not already used)
+ */
+#define FOREACH_INHASHMAP(X,Y)\
+        hashmap_slot_t *Y; uint32_t __j;\
+        for (__j = 0; __j < (X)->capacity; __j++)\
+                if (((X)->ctrl[__j] & 0x80) == 0 && ((Y) = &((X)->slots[__j])) != NULL)
+
+/**
+ * Creates a new hashmap
+ * \param size expected number of elements. If 0, use HASHMAP_INIT_SIZE
+ * \return a new hashmap
+ */
+extern hashmap_t* hashmap_new(uint32_t size);
+
+/**
+ * Inserts an element into a hashmap. If the key is already present, its data is replaced
+ * \param m a hashmap
+ * \param key element key (pointer or integer)
+ * \param data element to insert
+ */
+extern void hashmap_insert(hashmap_t *m, void *key, void *data);
+
+/**
+ * Looks for the element corresponding to a key
+ * \param m a hashmap
+ * \param key a key
+ * \return the element or NULL if not found
+ */
+extern void* hashmap_lookup(const hashmap_t *m, const void *key);
+
+/**
+ * Looks for the slot corresponding to a key
+ * \param m a hashmap
+ * \param key a key
+ * \return the slot (valid until next insertion) or NULL if not found
+ */
+extern hashmap_slot_t* hashmap_lookup_slot(const hashmap_t *m, const void *key);
+
+/**
+ * Removes the element corresponding to a key (but does not free it)
+ * \param m a hashmap
+ * \param key a key
+ * \return the element if found, else NULL
+ */
+extern void* hashmap_remove(hashmap_t *m, const void *key);
+
+/**
+ * Traverses a hashmap and executes a function on each element
+ * \param m a hashmap
+ * \param f a function with the same prototype as for hashtable_foreach (key, element, user)
+ * \param user a parameter given by the user for the function to execute
+ */
+extern void hashmap_foreach(const hashmap_t *m, void (*f)(void *, void *, void *),
+      void *user);
+
+/**
+ * Returns the number of elements in a hashmap
+ * \param m a hashmap
+ * \return number of elements
+ */
+extern uint32_t hashmap_size(const hashmap_t *m);
+
+/**
+ * Empties a hashmap, but does not free it
+ * \param m a hashmap
+ * \param f Function for freeing an element's data (or NULL)
+ * \param fk Function for freeing an element's key (or NULL)
+ */
+extern void hashmap_flush(hashmap_t *m, void (*f)(void*), void (*fk)(void*));
+
+/**
+ * Empties a hashmap and frees it
+ * \param m a hashmap
+ * \param f Function for freeing an element's data (or NULL)
+ * \param fk Function for freeing an element's key (or NULL)
+ */
+extern void hashmap_free(hashmap_t *m, void (*f)(void*), void (*fk)(void*));
+
 ///////////////////////////////////////////////////////////////////////////////
 //                                     arrays                                //
 ///////////////////////////////////////////////////////////////////////////////
@@ -3174,6 +3329,41 @@ extern void graph_node_BackDFS(graph_node_t *root,
  */
 extern array_t *graph_node_topological_sort(const graph_node_t *root);
 
+/**
+ * Same as graph_node_BFS, using a hashmap owned by the traversal instead of a hashtable to mark nodes.
+ * \see graph_node_BFS for parameters
+ */
+extern void graph_node_BFS_iterative(graph_node_t *root,
+      void (*func_node)(graph_node_t *, void*),
+      void (*func_edge)(graph_node_t *, graph_node_t *), void* un_data);
+
+/**
+ * Same as graph_node_DFS, with an explicit stack (no recursion, any depth) and a hashmap owned
+ * by the traversal instead of a hashtable to mark nodes.
+ * Nodes are not modified, so traversals can run concurrently on the same graph.
+ * \see graph_node_DFS for parameters
+ */
+extern void graph_node_DFS_iterative(graph_node_t *root,
+      void (*func_node_before)(graph_node_t *, void *),
+      void (*func_node_after)(graph_node_t *, void *),
+      void (*func_edge)(graph_edge_t *, void *), void *user_data);
+
+/**
+ * Same as graph_node_BackDFS, with an explicit stack and a hashmap owned by the traversal to mark nodes.
+ * \see graph_node_BackDFS for parameters
+ */
+extern void graph_node_BackDFS_iterative(graph_node_t *root,
+      void (*func_node_before)(graph_node_t *, void *),
+      void (*func_node_after)(graph_node_t *, void *),
+      void (*func_edge)(graph_edge_t *, void *), void *user_data);
+
+/**
+ * Same as graph_node_topological_sort, based on graph_node_DFS_iterative
+ * \param root a graph (root node)
+ * \return sorted list of nodes (as a dynamic array)
+ */
+extern array_t *graph_node_topological_sort_iterative(const graph_node_t *root);
+
 /**
  * Returns a table that can be passed to graph_is_backedge_from_table
  * \param root a graph (root node)
@@ -3216,6 +3406,57 @@ extern queue_t *graph_node_compute_paths(const graph_node_t *root);
  */
 extern int graph_node_get_nb_paths(const graph_node_t *root, int user_max_paths);
 
+/**
+ * \struct graph_paths_iter_s
+ * \brief Iterator over the paths of a graph (CF graph_node_paths_iter_new). Only the current path is in memory
+ */
+struct graph_paths_iter_s {
+   graph_node_t **nodes; /**<Nodes reachable from the root, by identifier (root is 0)*/
+   int *children_start; /**<Children of node i: identifiers in children from children_start[i] to children_start[i+1]-1*/
+   int *children; /**<Identifiers of children (through non-back edges), grouped by parent node*/
+   int nb_nodes; /**<Number of nodes*/
+   int *path; /**<Identifiers of the nodes of the current path*/
+   int *followed; /**<For each node of the current path but the last, index in children of the next node*/
+   int depth; /**<Index of the last node of the current path. -1 before the first path, -2 after the last one*/
+   array_t *path_nodes; /**<Current path (array of nodes), returned to the user*/
+};
+
+/**
+ * Creates an iterator over the paths of a graph starting from a given source (root) node,
+ * ignoring backedges. Same paths as graph_node_compute_paths but in depth-first order and
+ * with a memory footprint independent of the number of paths.
+ * The graph is read only by this function: the iterator remains valid if edges are changed later.
+ * \param root a graph (root node)
+ * \return a new iterator, to free with graph_paths_iter_free
+ */
+extern graph_paths_iter_t *graph_node_paths_iter_new(const graph_node_t *root);
+
+/**
+ * Returns the next path of an iterator
+ * \param iter an iterator returned by graph_node_paths_iter_new
+ * \return path (array of nodes) owned by the iterator and valid until the next call, or NULL if no more paths
+ */
+extern array_t *graph_paths_iter_next(graph_paths_iter_t *iter);
+
+/**
+ * Frees an iterator returned by graph_node_paths_iter_new
+ * \param iter an iterator
+ */
+extern void graph_paths_iter_free(graph_paths_iter_t *iter);
+
+/**
+ * Returns the K heaviest paths in a graph starting from a given source (root) node, ignoring backedges.
+ * Memory is proportional to the number of nodes times K, whatever the number of paths.
+ * \param root a graph (root node)
+ * \param k maximum number of paths to return
+ * \param get_weight function returning the weight of a node (with user as second parameter).
+ * If NULL, all nodes have the weight 1 (longest paths)
+ * \param user a parameter given by the user to get_weight
+ * \return queue of paths (arrays of nodes) starting from root, by decreasing weight
+ */
+extern queue_t *graph_node_get_top_paths(const graph_node_t *root, int k,
+      float (*get_weight)(const graph_node_t *, void *), void *user);
+
 /**
  * Checks whether a graph is consistent
  * \param root a graph (root node)
@@ -3366,6 +3607,125 @@ extern void graph_get_critical_paths (graph_t *graph, int max_paths,
                                       array_t **crit_paths,
                                       float (*get_edge_weight) (graph_edge_t *));
 
+///////////////////////////////////////////////////////////////////////////////
+//                               thread pools                                //
+///////////////////////////////////////////////////////////////////////////////
+#define THREADPOOL_STACK_SIZE (64 * 1024 * 1024) /**<Stack size of worker threads.
+                                                      Some analyses are recursive*/
+
+/**
+ * Atomically adds a value to an integer and returns its previous value
+ * X: pointer to the integer to update
+ * V: value to add
+ */
+#ifdef _WIN32
+#define ATOMIC_FETCH_ADD(X, V) InterlockedExchangeAdd((volatile LONG*)(X), (V))
+#else
+#define ATOMIC_FETCH_ADD(X, V) __sync_fetch_and_add((X), (V))
+#endif
+
+/**
+ * A task executed by a thread pool
+ * \param task_id index of the task to execute (between 0 and the number of tasks - 1)
+ * \param user a parameter given by the user
+ */
+typedef void (*threadpool_task_t)(int task_id, void* user);
+
+/**
+ * Returns the number of processors available on the host
+ * \return number of online processors (at least 1)
+ */
+extern int threadpool_get_nb_cpus();
+
+/**
+ * Runs a set of independent tasks on a work-stealing thread pool and waits for
+ * their completion. Tasks are initially split in contiguous ranges, one per thread.
+ * A thread whose range is empty steals the upper half of the largest remaining range.
+ * The calling thread is used as one of the workers.
+ * \param nb_threads number of threads to use. If <= 0, use threadpool_get_nb_cpus().
+ *                   If 1, tasks are run in order by the calling thread
+ * \param nb_tasks number of tasks to run
+ * \param task function executed for each task
+ * \param user a parameter given by the user, passed to each task
+ * \return number of threads actually used
+ */
+extern int threadpool_run(int nb_threads, int nb_tasks, threadpool_task_t task,
+      void* user);
+
+/**
+ * Declares a variable local to each thread
+ */
+#ifdef _WIN32
+#define THREAD_LOCAL __declspec(thread)
+#else
+#define THREAD_LOCAL __thread
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+//                                  arenas                                   //
+///////////////////////////////////////////////////////////////////////////////
+#define ARENA_BLOCK_SIZE (1024 * 1024) /**<Default size in bytes of the blocks of an arena*/
+#define ARENA_ALIGNMENT 8 /**<Alignment in bytes of the areas allocated in an arena*/
+
+/**
+ * \struct arena_s
+ * \brief Allocator reserving memory by large blocks and handing out areas from
+ *        them. Areas can not be freed individually: all the blocks are freed
+ *        at once with the arena. This removes the per-allocation overhead of
+ *        malloc and keeps objects allocated together close in memory.
+ *        An arena is not thread-safe: use one per thread and merge them.
+ * */
+struct arena_s {
+   void* blocks; /**<Last block allocated (blocks are chained through their first bytes)*/
+   char* next; /**<First free byte in the last block*/
+   char* end; /**<End of the last block*/
+   size_t block_size; /**<Size in bytes of the blocks*/
+   size_t reserved; /**<Total size in bytes of the blocks*/
+   size_t used; /**<Total size in bytes of the allocated areas*/
+};
+
+/**
+ * Creates a new arena
+ * \param block_size size in bytes of the blocks reserved by the arena. If 0, ARENA_BLOCK_SIZE is used
+ * \return a new arena
+ */
+extern arena_t* arena_new(size_t block_size);
+
+/**
+ * Allocates an area in an arena and sets its content to 0
+ * \param arena an arena
+ * \param size size in bytes of the area
+ * \return a pointer to the area, aligned on ARENA_ALIGNMENT bytes, or NULL if arena is NULL
+ */
+extern void* arena_alloc(arena_t* arena, size_t size);
+
+/**
+ * Moves all the blocks of an arena into another one, then frees it
+ * \param dst the arena receiving the blocks
+ * \param src the arena to merge into \c dst. It must not be used afterwards
+ */
+extern void arena_merge(arena_t* dst, arena_t* src);
+
+/**
+ * Returns the total size of the blocks reserved by an arena
+ * \param arena an arena
+ * \return size in bytes
+ */
+extern size_t arena_get_reserved_size(arena_t* arena);
+
+/**
+ * Returns the total size of the areas allocated in an arena
+ * \param arena an arena
+ * \return size in bytes
+ */
+extern size_t arena_get_used_size(arena_t* arena);
+
+/**
+ * Frees an arena and all the areas allocated in it
+ * \param arena an arena
+ */
+extern void arena_free(arena_t* arena);
+
 ///////////////////////////////////////////////////////////////////////////////
 //                                  help                                     //
 ///////////////////////////////////////////////////////////////////////////////
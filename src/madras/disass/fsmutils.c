@@ -1934,6 +1934,16 @@ unsigned int fsm_getmaxinsnlength(fsmcontext_t* fc)
    return fc->fsmvars.insn_maxlen;
 }
 
+/*
+ * Returns the minimum instruction's length in the current FSM
+ * \param fc Pointer to the structure containing the current FSM context
+ * \return The minimum instruction's length
+ */
+unsigned int fsm_getmininsnlength(fsmcontext_t* fc)
+{
+   return fc->fsmvars.insn_minlen;
+}
+
 /*
  * Performs the parsing of a binary stream
  * \param fc Pointer to the structure holding the details about a FSM operation
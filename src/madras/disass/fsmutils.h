@@ -358,6 +358,13 @@ extern bitvector_t* fsm_getcurrentcoding(fsmcontext_t* fc);
  */
 extern unsigned int fsm_getmaxinsnlength(fsmcontext_t* fc);
 
+/*
+ * Returns the minimum instruction's length in the current FSM
+ * \param fc Pointer to the structure containing the current FSM context
+ * \return The minimum instruction's length
+ */
+extern unsigned int fsm_getmininsnlength(fsmcontext_t* fc);
+
 /**
  * Initialises the variables in a FSM context used for a parsing.
  * Has to be called before launching a parse operation
@@ -271,6 +271,391 @@ static int get_insnannotate(uint16_t scnattr)
    return scnanno;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+//                              Decoding cache                               //
+///////////////////////////////////////////////////////////////////////////////
+/**Maximal number of entries in a decoding cache (must be a power of 2)*/
+#define DECODECACHE_MAXSIZE 0x10000
+
+/**Minimal number of entries in a decoding cache (must be a power of 2)*/
+#define DECODECACHE_MINSIZE 0x100
+
+/**
+ * \brief Entry of a decoding cache
+ * */
+typedef struct decodeentry_s {
+   uint64_t word; /**<Coding of the instruction, as found in the stream*/
+   insn_t* insn; /**<Instruction decoded by the FSM from this coding, NULL if the entry is empty*/
+} decodeentry_t;
+
+/**
+ * \brief Memo cache of the instructions already decoded by the FSM, indexed by their coding.
+ *
+ * On architectures where all instructions have the same length, the decoded instruction only depends on its coding, so
+ * a coding already encountered can be decoded with a single lookup and a copy instead of a walk through the FSM.
+ * The cache starts empty for each disassembly and is only filled by the FSM: the first occurrence of every coding
+ * is still decoded by the FSM, and only repeated codings are faster.
+ * The cache is direct-mapped: a new coding replaces the one stored in its entry, which keeps its size bounded.
+ * It is only used if the DISASS_OPTIONS_DECODECACHE option is set, as it has not been validated on real binaries yet.
+ * */
+typedef struct decodecache_s {
+   decodeentry_t* entries; /**<Entries of the cache*/
+   uint32_t mask; /**<Number of entries minus one*/
+   unsigned int insnlen; /**<Length in bytes of the instructions*/
+} decodecache_t;
+
+/**
+ * Creates a new decoding cache for the architecture of a FSM
+ * \param fc The context of the FSM used to disassemble the file
+ * \param n_bytes Number of bytes to decode, used to size the cache
+ * \return A new decoding cache, or NULL if instructions of the architecture do not all have the same length
+ * */
+static decodecache_t* decodecache_new(fsmcontext_t* fc, uint64_t n_bytes)
+{
+   unsigned int minlen = fsm_getmininsnlength(fc);
+   if (minlen != fsm_getmaxinsnlength(fc) || minlen == 0 || (minlen % 8) != 0
+         || minlen > sizeof(uint64_t) * 8)
+      return NULL;
+   uint32_t size = DECODECACHE_MINSIZE;
+   while (size < DECODECACHE_MAXSIZE && size < n_bytes / (minlen / 8))
+      size <<= 1;
+
+   decodecache_t* dc = lc_malloc(sizeof(*dc));
+   dc->entries = lc_malloc0(size * sizeof(*dc->entries));
+   dc->mask = size - 1;
+   dc->insnlen = minlen / 8;
+   return dc;
+}
+
+/**
+ * Frees a decoding cache and the instructions it contains
+ * \param dc The decoding cache
+ * */
+static void decodecache_free(decodecache_t* dc)
+{
+   uint32_t i;
+   if (!dc)
+      return;
+   for (i = 0; i <= dc->mask; i++)
+      if (dc->entries[i].insn)
+         insn_free(dc->entries[i].insn);
+   lc_free(dc->entries);
+   lc_free(dc);
+}
+
+/**
+ * Retrieves the entry of a decoding cache corresponding to the coding of an instruction
+ * \param dc The decoding cache
+ * \param bytes Pointer to the first byte of the instruction in the stream. It must contain at least dc->insnlen bytes
+ * \param word Return parameter. Will contain the coding of the instruction
+ * \return The entry where the coding is or would be stored
+ * */
+static decodeentry_t* decodecache_getentry(decodecache_t* dc,
+      unsigned char* bytes, uint64_t* word)
+{
+   *word = 0;
+   memcpy(word, bytes, dc->insnlen);
+   return &dc->entries[((*word * 0x9E3779B97F4A7C15ULL) >> 32) & dc->mask];
+}
+
+/**
+ * Decodes an instruction using a decoding cache
+ * \param dc The decoding cache
+ * \param bytes Pointer to the first byte of the instruction in the stream. It must contain at least dc->insnlen bytes
+ * \param addr Address of the instruction
+ * \return A new instruction if its coding was found in the cache, NULL otherwise
+ * */
+static insn_t* decodecache_decode(decodecache_t* dc, unsigned char* bytes,
+      int64_t addr)
+{
+   uint64_t word;
+   decodeentry_t* entry = decodecache_getentry(dc, bytes, &word);
+   if (entry->insn == NULL || entry->word != word)
+      return NULL;
+   insn_t* insn = insn_copy(entry->insn);
+   insn_set_addr(insn, addr);
+   return insn;
+}
+
+/**
+ * Stores an instruction successfully decoded by the FSM in a decoding cache
+ * \param dc The decoding cache
+ * \param bytes Pointer to the first byte of the instruction in the stream
+ * \param insn The instruction. It is copied, so it can be freely modified afterwards
+ * */
+static void decodecache_add(decodecache_t* dc, unsigned char* bytes,
+      insn_t* insn)
+{
+   uint64_t word;
+   decodeentry_t* entry = decodecache_getentry(dc, bytes, &word);
+   if (entry->insn)
+      insn_free(entry->insn);
+   entry->word = word;
+   //The stored instruction belongs to the cache, not to the file being disassembled
+   arena_t* arena = insn_set_arena(NULL);
+   entry->insn = insn_copy(insn);
+   insn_set_arena(arena);
+}
+
+/**
+ * Checks that an instruction decoded without walking through the FSM is identical to the one decoded by the FSM
+ * \param insn The instruction decoded in parallel or from the decoding cache
+ * \param error Error code associated to \c insn
+ * \param next_addr Address following \c insn in the stream
+ * \param ref The instruction decoded by the FSM
+ * \param referror Error code returned by the FSM
+ * \param refnext_addr Address of the FSM stream after decoding \c ref
+ * \param origin Way \c insn was decoded, used in the error message
+ * \return TRUE if both instructions are identical, FALSE otherwise
+ * */
+static int check_decoded_insn(insn_t* insn, int error, int64_t next_addr,
+      insn_t* ref, int referror, int64_t refnext_addr, const char* origin)
+{
+   char buf[256], refbuf[256];
+   insn_print(insn, buf, sizeof(buf));
+   insn_print(ref, refbuf, sizeof(refbuf));
+   if (error == referror && next_addr == refnext_addr
+         && insn_get_opcode_code(insn) == insn_get_opcode_code(ref)
+         && insn_get_variant_id(insn) == insn_get_variant_id(ref)
+         && bitvector_equal(insn_get_coding(insn), insn_get_coding(ref))
+         && strcmp(buf, refbuf) == 0)
+      return TRUE;
+   ERRMSG("Instruction at address %#"PRIx64" decoded %s (%s) differs from its decoding by the FSM (%s)\n",
+         insn_get_addr(ref), origin, buf, refbuf);
+   return FALSE;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+//                           Parallel decoding                               //
+///////////////////////////////////////////////////////////////////////////////
+/**
+ * \brief Instruction decoded in advance by the parallel disassembly
+ * */
+typedef struct predecoded_s {
+   insn_t* insn; /**<Decoded instruction (coding and address set), NULL if not decoded or already used*/
+   int64_t next_addr; /**<Address of the FSM stream after decoding the instruction*/
+   int error; /**<Value returned by fsm_parse when decoding the instruction*/
+} predecoded_t;
+
+/**
+ * \brief Range of bytes of a section decoded by a single task
+ * */
+typedef struct predecode_chunk_s {
+   uint64_t start; /**<Offset of the first byte of the range in the section*/
+   uint64_t len; /**<Length in bytes of the range*/
+} predecode_chunk_t;
+
+/**
+ * \brief Parameters shared by all the tasks decoding a section
+ * */
+typedef struct predecode_s {
+   asmfile_t* af; /**<The ASM file being disassembled*/
+   void (*fsmloader)(fsmload_t*); /**<Loader of the FSM for the architecture*/
+   unsigned char* bytestream; /**<Bytes of the section*/
+   int64_t startaddr; /**<Address of the first byte of the section*/
+   unsigned int insnlen; /**<Length in bytes of all instructions*/
+   uint8_t endianness; /**<Endianness of the instructions of the architecture*/
+   predecode_chunk_t* chunks; /**<Ranges of bytes to decode, one per task*/
+   predecoded_t* insns; /**<Decoded instructions, indexed by their offset divided by insnlen*/
+   arena_t** arenas; /**<Arenas where each task allocates its instructions, or NULL if they are allocated individually*/
+   int usecache; /**<TRUE if tasks use a decoding cache, FALSE if they only use the FSM*/
+} predecode_t;
+
+/**
+ * Decodes a range of bytes of a section with its own FSM context.
+ * Only the decoding itself is done here, everything updating the asmfile is left to stream_parse
+ * \param task_id Index of the range to decode
+ * \param user Pointer to the predecode_t structure describing the section
+ * */
+static void predecode_chunk(int task_id, void* user)
+{
+   predecode_t* pd = user;
+   predecode_chunk_t* chunk = &pd->chunks[task_id];
+   uint64_t i;
+
+   //Applying the endianness of the architecture once and for all, as all instructions have the same length
+   unsigned char* str = lc_malloc(chunk->len);
+   memcpy(str, pd->bytestream + chunk->start, chunk->len);
+   if (pd->endianness == CODE_ENDIAN_LITTLE_32B) {
+      for (i = 0; i + 4 <= chunk->len; i += 4) {
+         unsigned char tmp = str[i];
+         str[i] = str[i + 3];
+         str[i + 3] = tmp;
+         tmp = str[i + 1];
+         str[i + 1] = str[i + 2];
+         str[i + 2] = tmp;
+      }
+   } else if (pd->endianness == CODE_ENDIAN_LITTLE_16B) {
+      for (i = 0; i + 2 <= chunk->len; i += 2) {
+         unsigned char tmp = str[i];
+         str[i] = str[i + 1];
+         str[i + 1] = tmp;
+      }
+   }
+
+   fsmcontext_t* fc = fsm_init(pd->fsmloader);
+   fsm_seterrorhandler(fc, error_handler);
+   fsm_setstream(fc, str, chunk->len, pd->startaddr + chunk->start);
+   fsm_parseinit(fc);
+   //Instructions are allocated in an arena of the task, merged into the arena of the file afterwards
+   arena_t* prev_arena = NULL;
+   if (pd->arenas) {
+      pd->arenas[task_id] = arena_new(0);
+      prev_arena = insn_set_arena(pd->arenas[task_id]);
+   }
+   decodecache_t* dc = NULL;
+   if (pd->usecache)
+      dc = decodecache_new(fc, chunk->len);
+
+   while (!fsm_isparsecompleted(fc)) {
+      insn_t* insn = NULL;
+      int error = EXIT_SUCCESS;
+      int64_t addr = fsm_getcurrentaddress(fc);
+      uint64_t offset = addr - pd->startaddr;
+      if (dc && offset + pd->insnlen <= chunk->start + chunk->len
+            && (insn = decodecache_decode(dc, pd->bytestream + offset, addr))) {
+         fsm_resetstream(fc, addr + pd->insnlen);
+      } else {
+         error = fsm_parse(fc, (void**) &insn, pd->af, pd->af);
+         insn_set_addr(insn, addr);
+         insn_set_coding(insn, NULL, 0, fsm_getcurrentcoding(fc));
+         if (dc && !ISERROR(error)
+               && fsm_getcurrentaddress(fc) == addr + pd->insnlen)
+            decodecache_add(dc, pd->bytestream + offset, insn);
+      }
+
+      predecoded_t* slot = &pd->insns[(addr - pd->startaddr) / pd->insnlen];
+      slot->insn = insn;
+      slot->next_addr = fsm_getcurrentaddress(fc);
+      slot->error = error;
+   }
+   decodecache_free(dc);
+   if (pd->arenas)
+      insn_set_arena(prev_arena);
+   fsm_parseend(fc);
+   fsm_terminate(fc);
+   lc_free(str);
+}
+
+/**
+ * Decodes all instructions of a section on several threads. This is only possible for architectures where all instructions
+ * have the same length and do not switch to another architecture, as the section can then be split on any aligned boundary.
+ * Ranges are preferably split at function labels.
+ * \param fc The context of the FSM used to disassemble the file (used to retrieve the characteristics of the architecture)
+ * \param driver The disassembler driver of the architecture
+ * \param af The ASM file being disassembled
+ * \param bytestream The bytes of the section
+ * \param bslen The length of \c bytestream
+ * \param startaddr Address of the first byte of the section
+ * \param nb_threads Number of threads to use
+ * \param usecache TRUE if the instructions can be decoded using a decoding cache, FALSE if they must be decoded by the FSM
+ * \param insnlen_out Return parameter. Will contain the length in bytes of instructions
+ * \return An array of decoded instructions indexed by their offset in the section divided by the instruction length, to pass to
+ * stream_parse, or NULL if the section can not be decoded in parallel. It must be freed with predecoded_free
+ * */
+static predecoded_t* predecode_section(fsmcontext_t* fc, dsmbldriver_t* driver,
+      asmfile_t* af, unsigned char* bytestream, uint64_t bslen,
+      int64_t startaddr, int nb_threads, int usecache,
+      unsigned int* insnlen_out)
+{
+   unsigned int minlen = fsm_getmininsnlength(fc);
+   arch_t* arch = asmfile_get_arch(af);
+   if (nb_threads <= 1 || minlen != fsm_getmaxinsnlength(fc)
+         || minlen == 0 || (minlen % 8) != 0)
+      return NULL;   //Instructions do not all have the same length
+   unsigned int insnlen = minlen / 8;
+   if ((startaddr % insnlen) != 0
+         || (arch->endianness == CODE_ENDIAN_LITTLE_32B && (insnlen % 4) != 0)
+         || (arch->endianness == CODE_ENDIAN_LITTLE_16B && (insnlen % 2) != 0))
+      return NULL;
+   //Instructions must all belong to the architecture of the file
+   int64_t reset_addr = startaddr;
+   list_t* container = NULL;
+   if (driver->switchfsm(af, startaddr, &reset_addr, &container)
+         != arch_get_code(arch))
+      return NULL;
+
+   //Splitting the section in ranges of bytes, several per thread to balance the load
+   uint64_t nb_chunks_max = nb_threads * 8;
+   uint64_t target = bslen / nb_chunks_max;
+   if (target < 4096)
+      target = 4096;
+   if (bslen <= target)
+      return NULL;   //Not worth it
+   target -= target % insnlen;
+
+   unsigned int n_fctlabels = 0, l = 0;
+   label_t** fctlabels = asmfile_get_fct_labels(af, &n_fctlabels);
+   predecode_chunk_t* chunks = lc_malloc((nb_chunks_max + 1) * sizeof(*chunks));
+   int nb_chunks = 0;
+   uint64_t start = 0;
+   while (start < bslen) {
+      uint64_t end = start + target;
+      //Moving the end of the range to the next function label if there is one close enough
+      while (l < n_fctlabels
+            && label_get_addr(fctlabels[l]) < startaddr + (int64_t) end)
+         l++;
+      if (l < n_fctlabels) {
+         int64_t lbladdr = label_get_addr(fctlabels[l]);
+         if (lbladdr < startaddr + (int64_t) (end + target / 2)
+               && (lbladdr - startaddr) % insnlen == 0)
+            end = lbladdr - startaddr;
+      }
+      if (end > bslen || bslen - end < insnlen)
+         end = bslen;
+      chunks[nb_chunks].start = start;
+      chunks[nb_chunks].len = end - start;
+      nb_chunks++;
+      start = end;
+   }
+
+   predecode_t pd;
+   pd.af = af;
+   pd.fsmloader = driver->fsmloader;
+   pd.bytestream = bytestream;
+   pd.startaddr = startaddr;
+   pd.insnlen = insnlen;
+   pd.endianness = arch->endianness;
+   pd.chunks = chunks;
+   pd.insns = lc_malloc0((bslen / insnlen + 1) * sizeof(*pd.insns));
+   pd.usecache = usecache;
+   //Tasks use their own arena if the file uses one
+   pd.arenas = NULL;
+   if (insn_get_arena() != NULL)
+      pd.arenas = lc_malloc0(nb_chunks * sizeof(*pd.arenas));
+
+   DBGMSG("Decoding %"PRIu64" bytes in %d ranges on %d threads\n", bslen,
+         nb_chunks, nb_threads);
+   threadpool_run(nb_threads, nb_chunks, &predecode_chunk, &pd);
+
+   if (pd.arenas) {
+      int c;
+      for (c = 0; c < nb_chunks; c++)
+         arena_merge(insn_get_arena(), pd.arenas[c]);
+      lc_free(pd.arenas);
+   }
+
+   lc_free(chunks);
+   *insnlen_out = insnlen;
+   return pd.insns;
+}
+
+/**
+ * Frees the instructions decoded in advance that were not used by stream_parse
+ * \param insns Array returned by predecode_section
+ * \param n_insns Size of the array
+ * */
+static void predecoded_free(predecoded_t* insns, uint64_t n_insns)
+{
+   uint64_t i;
+   if (!insns)
+      return;
+   for (i = 0; i < n_insns; i++)
+      if (insns[i].insn)
+         insn_free(insns[i].insn);
+   lc_free(insns);
+}
+
 /**
  * Parses a stream of bytes depending on the associated architecture
  * \param fc The context of the FSM used to disassemble this stream
@@ -281,11 +666,18 @@ static int get_insnannotate(uint16_t scnattr)
  * \param scn The binary section to which the stream belongs (can be NULL if doing raw disassembly)
  * \param unlinked_targets Queue of data_t structures from the binfile containing pointers with an unknown destination
  * \param branches Queue of branch instructions with a NULL target
+ * \param predecoded Instructions of the stream already decoded by predecode_section, or NULL. Used instructions are removed from it
+ * \param insnlen Length in bytes of instructions in \c predecoded
+ * \param dc Decoding cache to use for the architecture of \c fc, or NULL
+ * \param n_mismatches If not NULL, instructions from \c predecoded or \c dc are compared to their decoding by the FSM, which is kept,
+ * and the number of differences is added to it
  * \return A queue of instructions corresponding to the disassembly of the stream defined in \e fc
  * */
 static queue_t* stream_parse(fsmcontext_t* fc, asmfile_t* af,
       unsigned char* bytestream, uint64_t bslen, int64_t startaddr,
-      binscn_t* scn, queue_t* unlinked_targets, queue_t* branches)
+      binscn_t* scn, queue_t* unlinked_targets, queue_t* branches,
+      predecoded_t* predecoded, unsigned int insnlen, decodecache_t* dc,
+      uint64_t* n_mismatches)
 {
    /**\todo This function may gain in readability from being split, but it will be tough*/
    queue_t* output = queue_new();
@@ -423,6 +815,9 @@ static queue_t* stream_parse(fsmcontext_t* fc, asmfile_t* af,
          next_driver = dsmbldriver_load_byarchcode(next_archcode);
          fsm_reinit(fc, next_driver->fsmloader);
          current_archcode = next_archcode;
+         //Instructions decoded in advance are not valid for the new architecture
+         predecoded = NULL;
+         dc = NULL;
 
          // Updating architecture related variables
          current_arch = next_driver->getarch();
@@ -430,91 +825,141 @@ static queue_t* stream_parse(fsmcontext_t* fc, asmfile_t* af,
          current_driver = next_driver;
       }
 
-      DBGMSG0LVL(2, "Endianness: Handling code's endianness\n");
-      previous_endian = current_endian;
-      current_endian = current_arch->endianness;
-
-      int i = nb_parsed_bytes;
-      if (current_endian == CODE_ENDIAN_LITTLE_16B) {
-         DBGMSG0LVL(2, "Endianness: CODE_ENDIAN_LITTLE_16B\n");
-         DBGMSGLVL(2, "bytes read so far: %d/%d\n", nb_parsed_bytes, bslen);
-         DBGMSGLVL(2, "bytes already swapped: %d\n", inverted_bytes);
-         // We need to check that the previous swap was made
-         // with the same chunk size (here it is 16 bits)
-         if ((inverted_bytes != 0)
-               && (inverted_bytes < ((int) fsm_getmaxinsnlength(fc) / 8))
-               && (previous_endian != CODE_ENDIAN_LITTLE_16B)) {
-            // The previous swap was made with another endianness, we have to roll it back.
-            // TODO Find a way for handling the rollback without listing every possibility..
-            if (previous_endian == CODE_ENDIAN_LITTLE_32B) {
-               str[nb_parsed_bytes] = bytestream[nb_parsed_bytes];
-               str[nb_parsed_bytes + 1] = bytestream[nb_parsed_bytes + 1];
-               str[nb_parsed_bytes + 2] = bytestream[nb_parsed_bytes + 2];
-               str[nb_parsed_bytes + 3] = bytestream[nb_parsed_bytes + 3];
+      //Retrieving the instruction if it has already been decoded in parallel
+      predecoded_t* pre = NULL;
+      if (predecoded && (nb_parsed_bytes % insnlen) == 0) {
+         pre = &predecoded[nb_parsed_bytes / insnlen];
+         if (pre->insn == NULL || insn_get_addr(pre->insn) != current_addr
+               || pre->next_addr > startaddr + (int64_t) bslen)
+            pre = NULL;
+      }
+      //Otherwise looking up its coding in the decoding cache
+      insn_t* tabinsn = NULL;
+      if (!pre && dc && nb_parsed_bytes + dc->insnlen <= bslen)
+         tabinsn = decodecache_decode(dc, bytestream + nb_parsed_bytes,
+               current_addr);
+
+      if (pre && !n_mismatches) {
+         current_insn = pre->insn;
+         fsmerror = pre->error;
+         pre->insn = NULL;
+         //The stream was not swapped for this instruction
+         inverted_bytes = pre->next_addr - current_addr;
+         fsm_resetstream(fc, pre->next_addr);
+      } else if (tabinsn && !n_mismatches) {
+         current_insn = tabinsn;
+         fsmerror = EXIT_SUCCESS;
+         //The stream was not swapped for this instruction
+         inverted_bytes = dc->insnlen;
+         fsm_resetstream(fc, current_addr + dc->insnlen);
+      } else {
+         DBGMSG0LVL(2, "Endianness: Handling code's endianness\n");
+         previous_endian = current_endian;
+         current_endian = current_arch->endianness;
+
+         int i = nb_parsed_bytes;
+         if (current_endian == CODE_ENDIAN_LITTLE_16B) {
+            DBGMSG0LVL(2, "Endianness: CODE_ENDIAN_LITTLE_16B\n");
+            DBGMSGLVL(2, "bytes read so far: %d/%d\n", nb_parsed_bytes, bslen);
+            DBGMSGLVL(2, "bytes already swapped: %d\n", inverted_bytes);
+            // We need to check that the previous swap was made
+            // with the same chunk size (here it is 16 bits)
+            if ((inverted_bytes != 0)
+                  && (inverted_bytes < ((int) fsm_getmaxinsnlength(fc) / 8))
+                  && (previous_endian != CODE_ENDIAN_LITTLE_16B)) {
+               // The previous swap was made with another endianness, we have to roll it back.
+               // TODO Find a way for handling the rollback without listing every possibility..
+               if (previous_endian == CODE_ENDIAN_LITTLE_32B) {
+                  str[nb_parsed_bytes] = bytestream[nb_parsed_bytes];
+                  str[nb_parsed_bytes + 1] = bytestream[nb_parsed_bytes + 1];
+                  str[nb_parsed_bytes + 2] = bytestream[nb_parsed_bytes + 2];
+                  str[nb_parsed_bytes + 3] = bytestream[nb_parsed_bytes + 3];
+               }
+            } else if ((inverted_bytes != 0)
+                  && (inverted_bytes < ((int) fsm_getmaxinsnlength(fc) / 8))) {
+               // Else we skip the chunks already swapped
+               i = nb_parsed_bytes + inverted_bytes;
             }
-         } else if ((inverted_bytes != 0)
-               && (inverted_bytes < ((int) fsm_getmaxinsnlength(fc) / 8))) {
-            // Else we skip the chunks already swapped
-            i = nb_parsed_bytes + inverted_bytes;
-         }
-         // Stop at the end of the bytesteam
-         if (i + 2 <= bslen) {
-            // Apply correct endianness for the maximum instruction length of the current architecture
-            for (;
-                  (i + 2)
-                        <= (nb_parsed_bytes
-                              + ((int) fsm_getmaxinsnlength(fc) / 8));
-                  i = i + 2) {
-               unsigned char tmp = str[i];
-               str[i] = str[i + 1];
-               str[i + 1] = tmp;
+            // Stop at the end of the bytesteam
+            if (i + 2 <= bslen) {
+               // Apply correct endianness for the maximum instruction length of the current architecture
+               for (;
+                     (i + 2)
+                           <= (nb_parsed_bytes
+                                 + ((int) fsm_getmaxinsnlength(fc) / 8));
+                     i = i + 2) {
+                  unsigned char tmp = str[i];
+                  str[i] = str[i + 1];
+                  str[i + 1] = tmp;
+               }
+               inverted_bytes = (int) fsm_getmaxinsnlength(fc) / 8;
             }
-            inverted_bytes = (int) fsm_getmaxinsnlength(fc) / 8;
-         }
-      } else if (current_endian == CODE_ENDIAN_LITTLE_32B) {
-         // We need to check that the previous swap was made
-         // with the same chunk size (here it is 32 bits)
-         if ((inverted_bytes != 0)
-               && (inverted_bytes < ((int) fsm_getmaxinsnlength(fc) / 8))
-               && (previous_endian != CODE_ENDIAN_LITTLE_32B)) {
-            // The previous swap was made with another endianness, we have to roll it back.
-            // TODO Find a way for handling the rollback without listing every possiblity..
-            if (previous_endian == CODE_ENDIAN_LITTLE_16B) {
-               str[nb_parsed_bytes] = bytestream[nb_parsed_bytes];
-               str[nb_parsed_bytes + 1] = bytestream[nb_parsed_bytes + 1];
+         } else if (current_endian == CODE_ENDIAN_LITTLE_32B) {
+            // We need to check that the previous swap was made
+            // with the same chunk size (here it is 32 bits)
+            if ((inverted_bytes != 0)
+                  && (inverted_bytes < ((int) fsm_getmaxinsnlength(fc) / 8))
+                  && (previous_endian != CODE_ENDIAN_LITTLE_32B)) {
+               // The previous swap was made with another endianness, we have to roll it back.
+               // TODO Find a way for handling the rollback without listing every possiblity..
+               if (previous_endian == CODE_ENDIAN_LITTLE_16B) {
+                  str[nb_parsed_bytes] = bytestream[nb_parsed_bytes];
+                  str[nb_parsed_bytes + 1] = bytestream[nb_parsed_bytes + 1];
+               }
+            } else if ((inverted_bytes != 0)
+                  && (inverted_bytes < ((int) fsm_getmaxinsnlength(fc) / 8))) {
+               // Else we skip the chunks already swapped
+               i = nb_parsed_bytes + inverted_bytes;
             }
-         } else if ((inverted_bytes != 0)
-               && (inverted_bytes < ((int) fsm_getmaxinsnlength(fc) / 8))) {
-            // Else we skip the chunks already swapped
-            i = nb_parsed_bytes + inverted_bytes;
-         }
-         // Stop at the end of the bytesteam
-         if (i + 4 <= bslen) {
-            // Apply correct endianness for the maximum instruction length of the current architecture
-            for (;
-                  (i + 4)
-                        <= (nb_parsed_bytes
-                              + ((int) fsm_getmaxinsnlength(fc) / 8));
-                  i = i + 4) {
-               unsigned char tmp = str[i];
-               str[i] = str[i + 3];
-               str[i + 3] = tmp;
-               tmp = str[i + 1];
-               str[i + 1] = str[i + 2];
-               str[i + 2] = tmp;
+            // Stop at the end of the bytesteam
+            if (i + 4 <= bslen) {
+               // Apply correct endianness for the maximum instruction length of the current architecture
+               for (;
+                     (i + 4)
+                           <= (nb_parsed_bytes
+                                 + ((int) fsm_getmaxinsnlength(fc) / 8));
+                     i = i + 4) {
+                  unsigned char tmp = str[i];
+                  str[i] = str[i + 3];
+                  str[i + 3] = tmp;
+                  tmp = str[i + 1];
+                  str[i + 1] = str[i + 2];
+                  str[i + 2] = tmp;
+               }
+               inverted_bytes = (int) fsm_getmaxinsnlength(fc) / 8;
             }
-            inverted_bytes = (int) fsm_getmaxinsnlength(fc) / 8;
          }
-      }
 
-      fsmerror = fsm_parse(fc, (void**) (&current_insn), af,
-            af);
+         fsmerror = fsm_parse(fc, (void**) (&current_insn), af,
+               af);
 
 //      DBGMSG("INSN: %p\n",current_insn);
-      /*Initializes the address of the decoded instruction*/
-      insn_set_addr(current_insn, current_addr);
-      /*Updates instruction's coding*/
-      insn_set_coding(current_insn, NULL, 0, fsm_getcurrentcoding(fc));
+         /*Initializes the address of the decoded instruction*/
+         insn_set_addr(current_insn, current_addr);
+         /*Updates instruction's coding*/
+         insn_set_coding(current_insn, NULL, 0, fsm_getcurrentcoding(fc));
+
+         if (pre) {
+            //Checking the instruction decoded in parallel against the one we just decoded
+            if (!check_decoded_insn(pre->insn, pre->error, pre->next_addr,
+                  current_insn, fsmerror, fsm_getcurrentaddress(fc),
+                  "in parallel"))
+               (*n_mismatches)++;
+            insn_free(pre->insn);
+            pre->insn = NULL;
+         } else if (tabinsn) {
+            //Checking the instruction retrieved from the decoding cache against the one we just decoded
+            if (!check_decoded_insn(tabinsn, EXIT_SUCCESS,
+                  current_addr + dc->insnlen, current_insn, fsmerror,
+                  fsm_getcurrentaddress(fc), "from the decoding cache"))
+               (*n_mismatches)++;
+            insn_free(tabinsn);
+         } else if (dc && !ISERROR(fsmerror)
+               && fsm_getcurrentaddress(fc) == current_addr + dc->insnlen) {
+            //Storing the instruction for the next occurrences of its coding
+            decodecache_add(dc, bytestream + nb_parsed_bytes, current_insn);
+         }
+      }
 
       /*Updates the label the instruction belongs to*/
       if (next_fctlbl_addr <= current_addr) {
@@ -581,7 +1026,7 @@ static queue_t* stream_parse(fsmcontext_t* fc, asmfile_t* af,
             assert(
                   (insn_get_fctlbl(lastinsn)!=lastlbl) && (INSN_GET_ADDR(lastinsn) < label_get_addr(lastlbl)));
             //Cutting the coding of the last encountered instruction so that we remove the overlap
-            overlap = bitvector_cutright(insn_get_coding(lastinsn),
+            overlap = bitvector_cutright(insn_get_resizable_coding(lastinsn),
                   (current_addr - label_get_addr(lastlbl)) * 8);
             DBG(
                   char buf[256];bitvector_hexprint(overlap, buf, sizeof(buf), " "); DBGMSG("Last instruction overlapped with the new label %s on the bytes %s\n",label_get_name(lastlbl),buf););
@@ -784,6 +1229,30 @@ static int disassemble_parsed_asmfile(asmfile_t* af)
    //Initialises the list of branch instructions
    queue_t* branches = queue_new();
 
+   //Retrieves the number of threads to use for decoding sections
+   int nb_threads = (int) (int64_t) asmfile_get_parameter(af,
+         PARAM_MODULE_DISASS, PARAM_DISASS_NB_THREADS);
+   if (nb_threads < 0)
+      nb_threads = threadpool_get_nb_cpus();
+   int64_t options = (int64_t) asmfile_get_parameter(af, PARAM_MODULE_DISASS,
+         PARAM_DISASS_OPTIONS);
+   int usecache = ((options & DISASS_OPTIONS_DECODECACHE) != 0);
+   uint64_t n_mismatches = 0;
+
+   //Instructions and operands are allocated in the arena of the file
+   arena_t* prev_arena = insn_get_arena();
+   if ((options & DISASS_OPTIONS_NOARENA) == 0)
+      insn_set_arena(asmfile_get_arena(af));
+
+   //Creates the decoding cache if the architecture allows it
+   decodecache_t* dc = NULL;
+   if (usecache) {
+      uint64_t n_bytes = 0;
+      for (i = 0; i < binfile_get_nb_code_scns(bf); i++)
+         n_bytes += binscn_get_size(binfile_get_code_scn(bf, i));
+      dc = decodecache_new(fc, n_bytes);
+   }
+
    /*Disassemble all sections containing program data*/
    for (i = 0; i < binfile_get_nb_code_scns(bf); i++) {
       binscn_t* scn = binfile_get_code_scn(bf, i);
@@ -807,9 +1276,17 @@ static int disassemble_parsed_asmfile(asmfile_t* af)
 
       /*Parse instructions*/
       if (bytestream != NULL) {
+         //Decodes the section in parallel if possible
+         unsigned int insnlen = 0;
+         predecoded_t* predecoded = predecode_section(fc, driver, af,
+               bytestream, bslen, startaddr, nb_threads, usecache, &insnlen);
+
          /*Invoke the parser on the bytecode and retrieve the disassembled instruction list*/
          insn_queue = stream_parse(fc, af, bytestream, bslen, startaddr, scn,
-               unlinked_targets, branches);
+               unlinked_targets, branches, predecoded, insnlen, dc,
+               (options & DISASS_OPTIONS_CHECKDECODING) ? &n_mismatches : NULL);
+         if (predecoded)
+            predecoded_free(predecoded, bslen / insnlen + 1);
 
          /*Updates the current section first and last instruction*/
          binscn_set_first_insn_seq(scn, queue_iterator(insn_queue));
@@ -837,9 +1314,18 @@ static int disassemble_parsed_asmfile(asmfile_t* af)
    //Frees the list of branch instructions
    queue_free(branches, NULL);
 
+   decodecache_free(dc);
+   insn_set_arena(prev_arena);
    fsm_terminate(fc);
    dsmbldriver_free(driver);
 
+   //The instructions decoded by the FSM were kept, but the faster decodings differed
+   if (n_mismatches > 0) {
+      WRNMSG("%"PRIu64" instructions decoded in parallel or from the decoding cache differ from the FSM\n",
+            n_mismatches);
+      res = WRN_DISASS_DECODING_MISMATCH;
+   }
+
    return res;
 }
 #if 0
@@ -1045,7 +1531,7 @@ int stream_disassemble(asmfile_t* af, unsigned char* stream, uint64_t len,
 
    /*Invoke the parser on the bytecode and retrieve the disassembled instruction list*/
    queue_t* insn_queue = stream_parse(fc, af, stream, len, startaddr, NULL,
-         NULL, branches);
+         NULL, branches, NULL, 0, NULL, NULL);
 
    /*Adds the disassembled instruction list to the list of instructions in the ASM file*/
    queue_append(asminsns, insn_queue);
@@ -48,6 +48,8 @@ static DwarfVar* __var_new(DwarfAPI* api, Dwarf_Die* d_die, DwarfFunction* func,
       DwarfFile* file);
 static void __var_free(void* v);
 
+typedef struct _DwarfCURange DwarfCURange;
+
 /* ----------------------------- Data structures --------------------------- */
 /*
  *	Structure containing DwarfAPI
@@ -68,9 +70,40 @@ struct _DwarfAPI {
    char* dwz_debug_str; /**< Content of corresponding dwz file or NULL if no dwz file*/
    unsigned int fct_array_size; /**< Size of fct_array array*/
    unsigned int dwz_debug_str_size; /**< Size of dwz_debug_str array*/
+   DwarfCURange* cu_ranges; /**< Ranges of addresses covered by CUs, sorted by start address (lazy mode only)*/
+   unsigned int nb_cu_ranges; /**< Size of cu_ranges array*/
+   Dwarf_Debug* worker_dbgs; /**< Dwarf debug structures of the threads parsing CUs (parallel mode only)*/
+   int nb_worker_dbgs; /**< Size of worker_dbgs array*/
    char is_range; /**< Flag set to TRUE when ranges are computed*/
+   char is_lazy; /**< Flag set to TRUE when CUs are parsed on demand*/
+   char is_loaded; /**< Flag set to TRUE when functions of all CUs are parsed*/
+   char is_lines_loaded; /**< Flag set to TRUE when lines of all CUs are parsed*/
+   char has_unindexed; /**< Flag set to TRUE when some CUs with no known range of addresses are not parsed yet*/
+};
+
+/*
+ * Structure defining a range of addresses covered by a compilation unit.
+ * Used in lazy mode to find the CUs to parse for a given address
+ */
+struct _DwarfCURange {
+   Dwarf_Addr start; /**< First address of the range*/
+   Dwarf_Addr stop; /**< First address after the range*/
+   Dwarf_Addr max_stop; /**< Highest stop of this range and of all ranges before it in the index*/
+   DwarfFile* file; /**< CU covering the range*/
 };
 
+/*
+ * Structure describing the parsing of CUs by a pool of threads.
+ * Each task uses its own Dwarf debug structure and takes the next CU to parse until all are parsed
+ */
+typedef struct _DwarfParseTasks {
+   DwarfAPI* api; /**< Current DWARF session*/
+   DwarfFile** files; /**< CUs to parse*/
+   Dwarf_Off* die_offs; /**< Offset of the DIE of each CU in the section*/
+   int nb_files; /**< Size of files and die_offs arrays*/
+   int next; /**< Index of the next CU to parse (updated atomically)*/
+} DwarfParseTasks;
+
 /*
  *	Structure containing DwarfFile
  *	Each DwarfFile is a compiled file
@@ -91,12 +124,21 @@ struct _DwarfFile {
    queue_t *functions; /**< Queue of (DwarfFunctions*) in this DwarfFile*/
    queue_t *global_var; /**< Queue of (DwarfVar*) in this DwarfFile*/
    Dwarf_Die *d_die; /**< Corresponding Dwarf DIE*/
+   Dwarf_Debug *dbg; /**< Dwarf debug structure d_die and the DIEs of the CU belong to*/
    DwarfAPI* api; /**< Dwarf session the file belongs to*/
+   queue_t *new_lines; /**< Lines of the CU not yet added to api->lines (parallel mode only)*/
+   queue_t *new_fcts; /**< Functions to add in api->functions, in parsing order (parallel mode only)*/
+   queue_t *new_fcts_off; /**< Functions to add in api->functions_off, in parsing order (parallel mode only)*/
+   queue_t *new_fcts_linkname; /**< Functions to add in api->functions_linkname, in parsing order (parallel mode only)*/
    long int off; /**< Offset of the CU in the section*/
    int filenames_size; /**< Number of elements in filenames*/
    int lang_code; /**< Code used to represent the language, defined by LANG_ macros*/
    int comp_code; /**< Code used to represent the compiler, defined by COMP_ macros*/
+   char state; /**< Parts of the CU already parsed, defined by DFILE_ macros*/
 };
+#define DFILE_FCTS_LOADED  0x01 /**< Functions of the CU are parsed*/
+#define DFILE_LINES_LOADED 0x02 /**< Source lines of the CU are parsed*/
+#define DFILE_INDEXED      0x04 /**< The range of addresses of the CU is known (lazy mode)*/
 
 /*
  * Structure defining an inlined function
@@ -346,6 +388,7 @@ static DwarfFile* __file_new(DwarfAPI* api, Dwarf_Die* die, long int off)
    file->off = off;
    file->functions = queue_new();
    file->api = api;
+   file->dbg = api->dbg;
    file->d_die = lc_malloc(sizeof(Dwarf_Die));
    file->fcts_ao = hashtable_new(&direct_hash, &direct_equal);
    memcpy(file->d_die, die, sizeof(Dwarf_Die));
@@ -589,14 +632,14 @@ static DwarfInlinedFunction* __inlinedFunction_new(DwarfAPI* api,
                &dwarf_attrs[i], api);
          Dwarf_Signed nb_ranges = 0;
          Dwarf_Ranges* ranges = NULL;
-         dwarf_get_ranges(*(api->dbg), ranges_off, &ranges, &nb_ranges, NULL,
+         dwarf_get_ranges(*(file->dbg), ranges_off, &ranges, &nb_ranges, NULL,
                &err);
          if (ranges == NULL)
             break;
          ifunc->ranges = lc_malloc((nb_ranges - 1) * sizeof(Dwarf_Ranges));
          memcpy(ifunc->ranges, ranges, (nb_ranges - 1) * sizeof(Dwarf_Ranges));
          ifunc->nb_ranges = nb_ranges - 1;
-         dwarf_ranges_dealloc(*(api->dbg), ranges, nb_ranges);
+         dwarf_ranges_dealloc(*(file->dbg), ranges, nb_ranges);
 
          // Ranges are relative to file lowpc value, so add it to store ranges real addresses
          int ii = 0;
@@ -610,7 +653,7 @@ static DwarfInlinedFunction* __inlinedFunction_new(DwarfAPI* api,
          break;
       }
    }
-   dwarf_dealloc(*(api->dbg), dwarf_attrs, DW_DLA_LIST);
+   dwarf_dealloc(*(file->dbg), dwarf_attrs, DW_DLA_LIST);
 
    if (file->comp_code == COMP_GNU && ifunc->high_pc > 0 && ifunc->low_pc > 0
          && str_compare_version("4.8", file->short_version) >= 0)
@@ -631,6 +674,23 @@ static void __inlinedFunction_free(void* p)
    lc_free(ifunc);
 }
 
+/*
+ * Adds a function in one of the tables of a DWARF session. If the CU of the function
+ * is parsed by a worker thread, the function is queued to be added when CUs are merged
+ * \param table a table of the DWARF session
+ * \param new_fcts queue of functions waiting to be added in table, or NULL
+ * \param key key of the function in the table
+ * \param func a function
+ */
+static void __function_register(hashtable_t* table, queue_t* new_fcts,
+      void* key, DwarfFunction* func)
+{
+   if (new_fcts != NULL)
+      queue_add_tail(new_fcts, func);
+   else
+      hashtable_insert(table, key, func);
+}
+
 /*
  * Creates a new function from a DIE
  * \param api current DWARF session
@@ -663,7 +723,8 @@ static DwarfFunction* __function_new(DwarfAPI* api, Dwarf_Die *d_die,
    func->decl_file = -1;
    func->ranges = queue_new();
    dwarf_die_CU_offset(*d_die, (Dwarf_Off*) (&(func->offset)), &err);
-   hashtable_insert(api->functions_off, (void*) (func->offset), func);
+   __function_register(api->functions_off, file->new_fcts_off,
+         (void*) (func->offset), func);
 //   printf("%p, %p(%d)\n", &dwarf_attrs, &attrs_count, attrs_count);
    for (i = 0; i < attrs_count; i++) {
 //      if (i < attrs_count) 
@@ -689,12 +750,14 @@ static DwarfFunction* __function_new(DwarfAPI* api, Dwarf_Die *d_die,
          func->linkage_name = lc_strdup(
                __dwarf_reader_attr_init_data(form, &dwarf_attrs[i], api));
          if (func->linkage_name != NULL)
-            hashtable_insert(api->functions_linkname, (char*)func->linkage_name, func);
+            __function_register(api->functions_linkname,
+                  file->new_fcts_linkname, func->linkage_name, func);
          break;
       case DW_AT_low_pc:
          func->low_pc = (Dwarf_Addr) __dwarf_reader_attr_init_data(form,
                &dwarf_attrs[i], api);
-         hashtable_insert(api->functions, (void*) (func->low_pc), func);
+         __function_register(api->functions, file->new_fcts,
+               (void*) (func->low_pc), func);
          break;
       case DW_AT_high_pc:
          func->high_pc = (Dwarf_Addr) __dwarf_reader_attr_init_data(form,
@@ -720,7 +783,7 @@ static DwarfFunction* __function_new(DwarfAPI* api, Dwarf_Die *d_die,
       }
 //      printf("%d(%d)\n", i, attrs_count);
    }
-   dwarf_dealloc(*(api->dbg), dwarf_attrs, DW_DLA_LIST);
+   dwarf_dealloc(*(file->dbg), dwarf_attrs, DW_DLA_LIST);
 
    //dwarf_function_get_returned_var (func);
    dwarf_function_get_parameters(func);
@@ -761,7 +824,7 @@ static DwarfFunction* __function_new(DwarfAPI* api, Dwarf_Die *d_die,
             }
             queue_add_tail(func->inlinedFunctions, idf);
          }
-      } while (dwarf_siblingof_b(*(func->file->api->dbg), child_die, TRUE,
+      } while (dwarf_siblingof_b(*(func->file->dbg), child_die, TRUE,
             &sibling_die, &err) == DW_DLV_OK);
    }
    return (func);
@@ -999,7 +1062,7 @@ static DwarfStruct* __struct_new(DwarfAPI* api, Dwarf_Die* d_die,
          struc->size = (long int) __dwarf_reader_attr_init_data(form,
                &dwarf_attrs[i], api);
    }
-   dwarf_dealloc(*(api->dbg), dwarf_attrs, DW_DLA_LIST);
+   dwarf_dealloc(*(file->dbg), dwarf_attrs, DW_DLA_LIST);
 
    // Now iterates over child to get members
    if (dwarf_child(*d_die, &child_die, &err) == DW_DLV_OK) {
@@ -1018,7 +1081,7 @@ static DwarfStruct* __struct_new(DwarfAPI* api, Dwarf_Die* d_die,
          default:
             break;
          }
-      } while (dwarf_siblingof_b(*(api->dbg), child_die, TRUE, &sibling_die,
+      } while (dwarf_siblingof_b(*(file->dbg), child_die, TRUE, &sibling_die,
             &err) == DW_DLV_OK);
    }
    return (struc);
@@ -1087,7 +1150,7 @@ static void __read_type(DwarfAPI* api, Dwarf_Die* d_die, DwarfVar* var,
             break;
          }
       }
-      dwarf_dealloc(*(api->dbg), dwarf_attrs, DW_DLA_LIST);
+      dwarf_dealloc(*(file->dbg), dwarf_attrs, DW_DLA_LIST);
       break;
 
    case DW_TAG_pointer_type:
@@ -1107,7 +1170,7 @@ static void __read_type(DwarfAPI* api, Dwarf_Die* d_die, DwarfVar* var,
             type = (long int) __dwarf_reader_attr_init_data(form,
                   &dwarf_attrs[i], api);
             if (type > 0) {
-               if (dwarf_offdie(*(api->dbg), type + file->off, &die_type, &err)
+               if (dwarf_offdie(*(file->dbg), type + file->off, &die_type, &err)
                      != 0)
                   return;
                __read_type(api, &die_type, var, file);
@@ -1118,7 +1181,7 @@ static void __read_type(DwarfAPI* api, Dwarf_Die* d_die, DwarfVar* var,
                   __dwarf_reader_attr_init_data(form, &dwarf_attrs[i], api));
          }
       }
-      dwarf_dealloc(*(api->dbg), dwarf_attrs, DW_DLA_LIST);
+      dwarf_dealloc(*(file->dbg), dwarf_attrs, DW_DLA_LIST);
       break;
 
    default:
@@ -1180,7 +1243,7 @@ static DwarfVar* __var_new(DwarfAPI* api, Dwarf_Die* d_die, DwarfFunction* func,
       case DW_AT_type:	//type of the variable
          off_type = (long int) __dwarf_reader_attr_init_data(form,
                &dwarf_attrs[i], api);
-         if (dwarf_offdie(*(api->dbg), off_type + file->off, &die_type, &err)
+         if (dwarf_offdie(*(file->dbg), off_type + file->off, &die_type, &err)
                != 0)
             return (NULL);
          __read_type(api, &die_type, var, file);
@@ -1191,7 +1254,7 @@ static DwarfVar* __var_new(DwarfAPI* api, Dwarf_Die* d_die, DwarfFunction* func,
          break;
       case DW_AT_artificial:
          if (__dwarf_reader_attr_init_data(form, &dwarf_attrs[i], api)) {
-            dwarf_dealloc(*(api->dbg), dwarf_attrs, DW_DLA_LIST);
+            dwarf_dealloc(*(file->dbg), dwarf_attrs, DW_DLA_LIST);
             __var_free(var);
             return (NULL);
          }
@@ -1203,7 +1266,7 @@ static DwarfVar* __var_new(DwarfAPI* api, Dwarf_Die* d_die, DwarfFunction* func,
          break;
       }
    }
-   dwarf_dealloc(*(api->dbg), dwarf_attrs, DW_DLA_LIST);
+   dwarf_dealloc(*(file->dbg), dwarf_attrs, DW_DLA_LIST);
 
    // Use data to create the variable full type.
    if (var->state & DL_STATIC)
@@ -1276,7 +1339,7 @@ static DwarfVar* __ret_var_new(DwarfAPI* api, DwarfFunction* func,
    var->function = func;
    var->name = lc_strdup("-RET-");
 
-   if (dwarf_offdie(*(api->dbg), off_type + func->file->off, &die_type, &err)
+   if (dwarf_offdie(*(func->file->dbg), off_type + func->file->off, &die_type, &err)
          != 0)
       return NULL;
    __read_type(api, &die_type, var, func->file);
@@ -1313,13 +1376,12 @@ static DwarfVar* __ret_var_new(DwarfAPI* api, DwarfFunction* func,
 
 /*
  * Loads sources lines from a CU and add them in a queue
- * \param api current DWARF session
  * \param d_die a Dwarf DIE representing a CU
  * \param lines a queue where to add extracted sources lines
  * \param file current CU
  */
-static void __load_lines_from_file(DwarfAPI* api, Dwarf_Die *d_die,
-      queue_t* lines, DwarfFile* file)
+static void __load_lines_from_file(Dwarf_Die *d_die, queue_t* lines,
+      DwarfFile* file)
 {
    Dwarf_Error err;
    int i = 0;
@@ -1333,12 +1395,12 @@ static void __load_lines_from_file(DwarfAPI* api, Dwarf_Die *d_die,
          memset(line, 0, sizeof(DwarfLine));
          dwarf_linesrc(d_lines[i], &name, &err);
          line->filename = lc_strdup(name);
-         dwarf_dealloc(*(api->dbg), name, DW_DLA_STRING);
+         dwarf_dealloc(*(file->dbg), name, DW_DLA_STRING);
          dwarf_lineaddr(d_lines[i], &(line->address), &err);
          dwarf_lineno(d_lines[i], &(line->no), &err);
          queue_add_tail(lines, line);
       }
-      dwarf_srclines_dealloc(*(api->dbg), d_lines, line_count);
+      dwarf_srclines_dealloc(*(file->dbg), d_lines, line_count);
    }
 
    char** file_buff = NULL;
@@ -1398,7 +1460,7 @@ static void __dwarf_traverse_DIE_tree(DwarfAPI* api, Dwarf_Die* root,
             __dwarf_traverse_DIE_tree(api, &sibling_die, file);
             break;
          }
-      } while (dwarf_siblingof_b(*(api->dbg), child_die, TRUE, &sibling_die,
+      } while (dwarf_siblingof_b(*(file->dbg), child_die, TRUE, &sibling_die,
             &err) == DW_DLV_OK);
    }
 }
@@ -1568,15 +1630,490 @@ static void load_dwz(Elf* elf, DwarfAPI *api)
    fclose(file);
 }
 
-/* -------------------------- DwarfAPI functions --------------------------- */
+/*
+ * Links the functions of a parsed CU with their abstract origin and with the functions they inline.
+ * Functions of the CU must already be in the tables of the DWARF session
+ * \param api current DWARF session
+ * \param file a CU
+ */
+static void __file_link_functions(DwarfAPI* api, DwarfFile* file)
+{
+   //Here simplify functions of the file using abstract_origin and offset members
+   FOREACH_INQUEUE(file->functions, it_f)
+   {
+      DwarfFunction* fct = GET_DATA_T(DwarfFunction*, it_f);
+      // Simplify functions
+      DwarfFunction* fctsib = hashtable_lookup(file->fcts_ao,
+            (void*) (fct->offset));
+      if (fctsib != NULL) {
+         fct->low_pc = fctsib->low_pc;
+         fct->high_pc = fctsib->high_pc;
+         hashtable_remove(api->functions, (void*) (fctsib->low_pc));
+         hashtable_remove(file->fcts_ao, (void*) (fct->offset));
+         hashtable_insert(api->functions, (void*) (fct->low_pc), fct);
+         //queue_remove (file->functions, fctsib, &__function_free);
+      }
+
+      // Link inlined function to the function
+      FOREACH_INQUEUE(fct->inlinedFunctions, it_inlined)
+      {
+         DwarfInlinedFunction* ifct = GET_DATA_T(DwarfInlinedFunction*,
+               it_inlined);
+         DwarfFunction* fctsib = hashtable_lookup(api->functions_off,
+               (void*) (ifct->abstract_origin));
+         if (fctsib != NULL)
+            ifct->function = fctsib;
+      }
+   }
+}
+
+/*
+ * Parses the functions of a CU, if not already done
+ * \param api current DWARF session
+ * \param file a CU
+ */
+static void __file_load_functions(DwarfAPI* api, DwarfFile* file)
+{
+   if (file->state & DFILE_FCTS_LOADED)
+      return;
+   file->state |= DFILE_FCTS_LOADED;
+
+   // Then all childs are traversed to look for functions. When a function is
+   // found, do not need to traverse its sons. If the DIE is a type, it is saved too.
+   __dwarf_traverse_DIE_tree(api, file->d_die, file);
+   __file_link_functions(api, file);
+}
+
+/*
+ * Parses the source lines of a CU, if not already done
+ * \param api current DWARF session
+ * \param file a CU
+ */
+static void __file_load_lines(DwarfAPI* api, DwarfFile* file)
+{
+   if (file->state & DFILE_LINES_LOADED)
+      return;
+   file->state |= DFILE_LINES_LOADED;
+   __load_lines_from_file(file->d_die, api->lines, file);
+}
+
+/*
+ * Builds the array of functions sorted by low_pc used to look for functions by interval
+ * \param api current DWARF session
+ */
+static void __api_sort_functions(DwarfAPI* api)
+{
+   if (api->fct_array != NULL)
+      lc_free(api->fct_array);
+   api->fct_array_size = 0;
+   HASHTABLE_TO_MALLOC_ARRAY(DwarfFunction*, api->functions, fct_array,
+         api->fct_array_size);
+   qsort(fct_array, api->fct_array_size, sizeof(DwarfFunction*),
+         &_dwarf_function_cmp);
+   api->fct_array = fct_array;
+}
+
+/*
+ * Parses the functions of all CUs, if not already done (lazy mode)
+ * \param api current DWARF session
+ */
+static void __api_load_functions(DwarfAPI* api)
+{
+   if (api->is_loaded)
+      return;
+   DBGMSG0("Parsing functions of all compilation units\n");
+
+   FOREACH_INQUEUE(api->files, it_file) {
+      __file_load_functions(api, GET_DATA_T(DwarfFile*, it_file));
+   }
+   api->is_loaded = TRUE;
+   api->has_unindexed = FALSE;
+   __api_sort_functions(api);
+}
+
+/*
+ * Parses the source lines of all CUs, if not already done (lazy mode).
+ * CUs are parsed in the same order as in eager mode, so that lines with the same address are ordered the same way.
+ * \param api current DWARF session
+ */
+static void __api_load_lines(DwarfAPI* api)
+{
+   if (api->is_lines_loaded)
+      return;
+
+   FOREACH_INQUEUE(api->files, it_file) {
+      __file_load_lines(api, GET_DATA_T(DwarfFile*, it_file));
+   }
+   api->is_lines_loaded = TRUE;
+}
+
+/*
+ * Parses the functions of the CUs whose range of addresses contains a given address (lazy mode).
+ * CUs whose range is unknown are parsed on the first call.
+ * \param api current DWARF session
+ * \param addr an address
+ */
+static void __api_load_functions_at(DwarfAPI* api, Dwarf_Addr addr)
+{
+   if (api->is_loaded)
+      return;
+
+   // Looks for the first range starting after addr
+   unsigned int first = 0, last = api->nb_cu_ranges;
+   while (first < last) {
+      unsigned int middle = (first + last) / 2;
+      if (api->cu_ranges[middle].start <= addr)
+         first = middle + 1;
+      else
+         last = middle;
+   }
+   // Ranges before it start at or before addr. Stops at the first one whose
+   // max_stop shows that no range before it (included) contains addr
+   int i;
+   for (i = (int) first - 1; i >= 0 && api->cu_ranges[i].max_stop > addr; i--) {
+      if (api->cu_ranges[i].stop > addr)
+         __file_load_functions(api, api->cu_ranges[i].file);
+   }
+
+   if (api->has_unindexed) {
+      FOREACH_INQUEUE(api->files, it_file) {
+         DwarfFile* file = GET_DATA_T(DwarfFile*, it_file);
+         if (!(file->state & DFILE_INDEXED))
+            __file_load_functions(api, file);
+      }
+      api->has_unindexed = FALSE;
+   }
+}
+
+/*
+ * Adds a range of addresses covered by a CU in the index of a DWARF session
+ * \param api current DWARF session
+ * \param file a CU
+ * \param start first address of the range
+ * \param stop first address after the range
+ * \param max_ranges size of the allocated cu_ranges array, updated if it is resized
+ */
+static void __api_add_cu_range(DwarfAPI* api, DwarfFile* file,
+      Dwarf_Addr start, Dwarf_Addr stop, unsigned int* max_ranges)
+{
+   if (stop <= start)
+      return;
+   if (api->nb_cu_ranges == *max_ranges) {
+      *max_ranges = (*max_ranges > 0) ? 2 * (*max_ranges) : 64;
+      api->cu_ranges = lc_realloc(api->cu_ranges,
+            (*max_ranges) * sizeof(DwarfCURange));
+   }
+   DwarfCURange* range = &(api->cu_ranges[api->nb_cu_ranges++]);
+   range->start = start;
+   range->stop = stop;
+   range->file = file;
+   file->state |= DFILE_INDEXED;
+}
+
+/*
+ * Adds the ranges of addresses listed in .debug_aranges in the index of a DWARF session
+ * \param api current DWARF session
+ * \param files_by_die table of CUs indexed by the offset of their DIE in the section
+ * \param max_ranges size of the allocated cu_ranges array, updated if it is resized
+ */
+static void __api_index_aranges(DwarfAPI* api, hashtable_t* files_by_die,
+      unsigned int* max_ranges)
+{
+   Dwarf_Arange* aranges = NULL;
+   Dwarf_Signed nb_aranges = 0;
+   Dwarf_Error err;
+   Dwarf_Signed i;
+
+   if (dwarf_get_aranges(*(api->dbg), &aranges, &nb_aranges, &err) != DW_DLV_OK)
+      return;
+
+   for (i = 0; i < nb_aranges; i++) {
+      Dwarf_Addr start = 0;
+      Dwarf_Unsigned length = 0;
+      Dwarf_Off cu_die_offset = 0;
+
+      if (dwarf_get_arange_info(aranges[i], &start, &length, &cu_die_offset,
+            &err) == DW_DLV_OK) {
+         DwarfFile* file = hashtable_lookup(files_by_die,
+               (void*) cu_die_offset);
+         if (file != NULL)
+            __api_add_cu_range(api, file, start, start + length, max_ranges);
+      }
+      dwarf_dealloc(*(api->dbg), aranges[i], DW_DLA_ARANGE);
+   }
+   dwarf_dealloc(*(api->dbg), aranges, DW_DLA_LIST);
+}
+
+/*
+ * Adds the ranges of addresses of a CU in the index of a DWARF session, based on the
+ * attributes of its DIE (DW_AT_low_pc / DW_AT_high_pc or DW_AT_ranges)
+ * \param api current DWARF session
+ * \param file a CU
+ * \param max_ranges size of the allocated cu_ranges array, updated if it is resized
+ */
+static void __file_index_ranges(DwarfAPI* api, DwarfFile* file,
+      unsigned int* max_ranges)
+{
+   Dwarf_Addr lowpc = 0, highpc = 0;
+   Dwarf_Half form = 0;
+   enum Dwarf_Form_Class form_class;
+   Dwarf_Attribute attr;
+   Dwarf_Error err;
+
+   if (dwarf_lowpc(*(file->d_die), &lowpc, &err) == DW_DLV_OK
+         && dwarf_highpc_b(*(file->d_die), &highpc, &form, &form_class, &err)
+               == DW_DLV_OK) {
+      //Handling the case where high_pc is an offset
+      if (form_class == DW_FORM_CLASS_CONSTANT)
+         highpc += lowpc;
+      __api_add_cu_range(api, file, lowpc, highpc, max_ranges);
+   } else if (dwarf_attr(*(file->d_die), DW_AT_ranges, &attr, &err)
+         == DW_DLV_OK) {
+      Dwarf_Ranges* ranges = NULL;
+      Dwarf_Signed nb_ranges = 0, i;
+      dwarf_whatform(attr, &form, &err);
+      Dwarf_Off ranges_off = (Dwarf_Off) __dwarf_reader_attr_init_data(form,
+            &attr, api);
+
+      if (dwarf_get_ranges_a(*(api->dbg), ranges_off, *(file->d_die), &ranges,
+            &nb_ranges, NULL, &err) == DW_DLV_OK) {
+         // Ranges are relative to the base address of the CU, which can be changed by a selection entry
+         Dwarf_Addr base = file->lowpc;
+         for (i = 0; i < nb_ranges; i++) {
+            if (ranges[i].dwr_type == DW_RANGES_ENTRY)
+               __api_add_cu_range(api, file, base + ranges[i].dwr_addr1,
+                     base + ranges[i].dwr_addr2, max_ranges);
+            else if (ranges[i].dwr_type == DW_RANGES_ADDRESS_SELECTION)
+               base = ranges[i].dwr_addr2;
+         }
+         dwarf_ranges_dealloc(*(api->dbg), ranges, nb_ranges);
+      }
+      dwarf_dealloc(*(api->dbg), attr, DW_DLA_ATTR);
+   }
+}
+
+/*
+ * Compares two ranges of addresses of CUs by start address
+ * \param p1 a pointer to a DwarfCURange
+ * \param p2 a pointer to a DwarfCURange
+ * \return an integer less than, equal to, or greater than 0 if p1 starts before, at the same address or after p2
+ */
+static int _dwarf_cu_range_cmp(const void* p1, const void* p2)
+{
+   const DwarfCURange* r1 = p1;
+   const DwarfCURange* r2 = p2;
+
+   if (r1->start < r2->start)
+      return (-1);
+   else if (r1->start > r2->start)
+      return (1);
+   return (0);
+}
+
+/*
+ * Builds the index of ranges of addresses covered by the CUs of a DWARF session (lazy mode).
+ * Ranges are taken from .debug_aranges if present, else from the CU DIEs.
+ * \param api current DWARF session
+ * \param files_by_die table of CUs indexed by the offset of their DIE in the section
+ */
+static void __api_index_cus(DwarfAPI* api, hashtable_t* files_by_die)
+{
+   unsigned int max_ranges = 0;
+   unsigned int i;
+
+   __api_index_aranges(api, files_by_die, &max_ranges);
+
+   FOREACH_INQUEUE(api->files, it_file) {
+      DwarfFile* file = GET_DATA_T(DwarfFile*, it_file);
+      if (!(file->state & DFILE_INDEXED))
+         __file_index_ranges(api, file, &max_ranges);
+      if (!(file->state & DFILE_INDEXED))
+         api->has_unindexed = TRUE;
+   }
+
+   if (api->nb_cu_ranges > 0)
+      qsort(api->cu_ranges, api->nb_cu_ranges, sizeof(DwarfCURange),
+            &_dwarf_cu_range_cmp);
+   for (i = 0; i < api->nb_cu_ranges; i++) {
+      api->cu_ranges[i].max_stop = api->cu_ranges[i].stop;
+      if (i > 0 && api->cu_ranges[i - 1].max_stop > api->cu_ranges[i].max_stop)
+         api->cu_ranges[i].max_stop = api->cu_ranges[i - 1].max_stop;
+   }
+   DBGMSG("%d compilation units indexed with %u ranges of addresses\n",
+         queue_length(api->files), api->nb_cu_ranges);
+}
+
+/*
+ * Loads the DWARF sections of an ELF file, so that they can then be read concurrently
+ * \param elf an Elf structure
+ */
+static void __elf_load_debug_scns(Elf* elf)
+{
+   Elf64_Half nb_scns = Elf_Ehdr_get_e_shnum(elf);
+   Elf64_Half shstrndx = Elf_Ehdr_get_e_shstrndx(elf);
+   Elf64_Half i = 0;
+
+   for (i = 1; i < nb_scns; i++) {
+      char* name = elf_strptr(elf, shstrndx, Elf_Shdr_get_sh_name(elf, i));
+      if (name != NULL && strncmp(name, ".debug", strlen(".debug")) == 0)
+         elf_getdata(elf_getscn(elf, i), NULL);
+   }
+}
+
+/*
+ * Task of the thread pool parsing CUs: parses the lines and functions of CUs until all are parsed.
+ * Functions are not added to the tables of the DWARF session but queued in their CU.
+ * \param task_id index of the task, used to select its Dwarf debug structure
+ * \param user a DwarfParseTasks structure
+ */
+static void __file_parse_task(int task_id, void* user)
+{
+   DwarfParseTasks* tasks = user;
+   DwarfAPI* api = tasks->api;
+   Dwarf_Debug* dbg = &(api->worker_dbgs[task_id]);
+   int i = 0;
+
+   while ((i = __sync_fetch_and_add(&(tasks->next), 1)) < tasks->nb_files) {
+      DwarfFile* file = tasks->files[i];
+      Dwarf_Die die;
+      Dwarf_Error err = NULL;
+
+      // The CU will be parsed on the main thread when results are merged
+      if (dwarf_offdie_b(*dbg, tasks->die_offs[i], TRUE, &die, &err) != DW_DLV_OK)
+         continue;
+
+      memcpy(file->d_die, &die, sizeof(Dwarf_Die));
+      file->dbg = dbg;
+      file->new_lines = queue_new();
+      file->new_fcts = queue_new();
+      file->new_fcts_off = queue_new();
+      file->new_fcts_linkname = queue_new();
+      file->state |= DFILE_FCTS_LOADED | DFILE_LINES_LOADED;
+      __load_lines_from_file(file->d_die, file->new_lines, file);
+      __dwarf_traverse_DIE_tree(api, file->d_die, file);
+   }
+}
+
+/*
+ * Adds the lines and functions of a CU parsed by a worker thread to the DWARF session, in the
+ * same order as if the CU had been parsed sequentially. CUs must be merged in the order of the section.
+ * \param api current DWARF session
+ * \param file a CU
+ */
+static void __file_merge(DwarfAPI* api, DwarfFile* file)
+{
+   if (file->new_lines == NULL) {
+      __file_load_lines(api, file);
+      __file_load_functions(api, file);
+      return;
+   }
+   queue_append(api->lines, file->new_lines);
+
+   FOREACH_INQUEUE(file->new_fcts_off, it_off) {
+      DwarfFunction* fct = GET_DATA_T(DwarfFunction*, it_off);
+      hashtable_insert(api->functions_off, (void*) (fct->offset), fct);
+   }
+   FOREACH_INQUEUE(file->new_fcts, it_pc) {
+      DwarfFunction* fct = GET_DATA_T(DwarfFunction*, it_pc);
+      hashtable_insert(api->functions, (void*) (fct->low_pc), fct);
+   }
+   FOREACH_INQUEUE(file->new_fcts_linkname, it_name) {
+      DwarfFunction* fct = GET_DATA_T(DwarfFunction*, it_name);
+      hashtable_insert(api->functions_linkname, fct->linkage_name, fct);
+   }
+   queue_free(file->new_fcts_off, NULL);
+   queue_free(file->new_fcts, NULL);
+   queue_free(file->new_fcts_linkname, NULL);
+   file->new_lines = NULL;
+   file->new_fcts = NULL;
+   file->new_fcts_off = NULL;
+   file->new_fcts_linkname = NULL;
+
+   __file_link_functions(api, file);
+}
+
+/*
+ * Parses the lines and functions of all CUs using a pool of threads.
+ * Each thread uses its own Dwarf debug structure, which then owns the DIEs of the CUs it parsed.
+ * Relocatable files are not handled, as libdwarf relocates their sections in place, and neither
+ * are sessions loading variables, as types are shared between CUs.
+ * \param api current DWARF session
+ * \param nb_threads number of threads to use
+ * \return TRUE if CUs have been parsed, FALSE if they must be parsed sequentially
+ */
+static int __api_load_parallel(DwarfAPI* api, int nb_threads)
+{
+   int nb_files = queue_length(api->files);
+   int i = 0;
+
+   if (nb_threads > nb_files)
+      nb_threads = nb_files;
+   if (nb_threads <= 1 || Elf_Ehdr_get_e_type(api->elf) == ET_REL
+         || asmfile_get_parameter(api->asmf, PARAM_MODULE_DEBUG,
+               PARAM_DEBUG_ENABLE_VARS) != FALSE)
+      return FALSE;
+
+   // Sections are loaded by libelf on first access: this must not happen concurrently
+   __elf_load_debug_scns(api->elf);
+
+   api->worker_dbgs = lc_malloc(nb_threads * sizeof(Dwarf_Debug));
+   for (i = 0; i < nb_threads; i++) {
+      Dwarf_Error err = NULL;
+      if (dwarf_elf_init(api->elf, DW_DLC_READ, NULL, NULL,
+            &(api->worker_dbgs[i]), &err) != DW_DLV_OK)
+         break;
+   }
+   api->nb_worker_dbgs = i;
+   if (api->nb_worker_dbgs <= 1) {
+      if (api->nb_worker_dbgs == 1) {
+         Dwarf_Error err = NULL;
+         dwarf_finish(api->worker_dbgs[0], &err);
+      }
+      lc_free(api->worker_dbgs);
+      api->worker_dbgs = NULL;
+      api->nb_worker_dbgs = 0;
+      return FALSE;
+   }
+
+   DwarfParseTasks tasks;
+   tasks.api = api;
+   tasks.files = lc_malloc(nb_files * sizeof(DwarfFile*));
+   tasks.die_offs = lc_malloc(nb_files * sizeof(Dwarf_Off));
+   tasks.nb_files = nb_files;
+   tasks.next = 0;
+   i = 0;
+   FOREACH_INQUEUE(api->files, it_file) {
+      DwarfFile* file = GET_DATA_T(DwarfFile*, it_file);
+      Dwarf_Error err = NULL;
+      tasks.files[i] = file;
+      dwarf_dieoffset(*(file->d_die), &(tasks.die_offs[i]), &err);
+      i++;
+   }
+
+   DBGMSG("Parsing %d compilation units with %d threads\n", nb_files,
+         api->nb_worker_dbgs);
+   threadpool_run(api->nb_worker_dbgs, api->nb_worker_dbgs, &__file_parse_task,
+         &tasks);
+
+   for (i = 0; i < nb_files; i++)
+      __file_merge(api, tasks.files[i]);
+
+   lc_free(tasks.files);
+   lc_free(tasks.die_offs);
+   return TRUE;
+}
+
 /*
  * Initialize the Dwarf API
  * \param elf an Elf structure used as input for libdwarf
  * \param elf_name
  * \param asmf corresponding assembly file or NULL
+ * \param is_lazy TRUE if functions and lines of CUs must be parsed on demand
+ * \param nb_threads number of threads used to parse CUs (not lazy mode)
  * \return The API object
  */
-DwarfAPI* dwarf_api_init_light(Elf* elf, char* elf_name, asmfile_t* asmf)
+static DwarfAPI* __dwarf_api_init(Elf* elf, char* elf_name, asmfile_t* asmf,
+      char is_lazy, int nb_threads)
 {
    //TODO DEBUG DarfLight on Windows..
 #ifdef _WIN32
@@ -1607,6 +2144,7 @@ DwarfAPI* dwarf_api_init_light(Elf* elf, char* elf_name, asmfile_t* asmf)
    api->asmf = asmf;
    api->fct_array_size = 0;
    api->dwz_debug_str = NULL;
+   api->is_lazy = is_lazy;
    if (elf_name != NULL)
       api->elf_name = lc_strdup(elf_name);
    else
@@ -1622,6 +2160,8 @@ DwarfAPI* dwarf_api_init_light(Elf* elf, char* elf_name, asmfile_t* asmf)
    Dwarf_Unsigned next_cu_header;
    Dwarf_Off offset;
    Dwarf_Off overall_offset;
+   // CUs indexed by the offset of their DIE, to match them with .debug_aranges entries
+   hashtable_t* files_by_die = (is_lazy) ? hashtable_new(&direct_hash, &direct_equal) : NULL;
 
    // Do the loop till the last of the CU headers
    while ((res = dwarf_next_cu_header_b(dbg, NULL, NULL, NULL, NULL, NULL, NULL,
@@ -1646,41 +2186,26 @@ DwarfAPI* dwarf_api_init_light(Elf* elf, char* elf_name, asmfile_t* asmf)
       DwarfFile* file = __file_new(api, &die, overall_offset - offset);
       if (file != NULL) {
          queue_add_tail(api->files, file);
-         __load_lines_from_file(api, &die, api->lines, file);
 
-         // Then all childs are traversed to look for functions. When a function is
-         // found, do not need to traverse its sons. If the DIE is a type, it is saved too.
-         __dwarf_traverse_DIE_tree(api, &die, file);
-
-         //Here simplify functions of the file using abstract_origin and offset members
-         FOREACH_INQUEUE(file->functions, it_f)
-         {
-            DwarfFunction* fct = GET_DATA_T(DwarfFunction*, it_f);
-            // Simplify functions
-            DwarfFunction* fctsib = hashtable_lookup(file->fcts_ao,
-                  (void*) (fct->offset));
-            if (fctsib != NULL) {
-               fct->low_pc = fctsib->low_pc;
-               fct->high_pc = fctsib->high_pc;
-               hashtable_remove(api->functions, (void*) (fctsib->low_pc));
-               hashtable_remove(file->fcts_ao, (void*) (fct->offset));
-               hashtable_insert(api->functions, (void*) (fct->low_pc), fct);
-               //queue_remove (file->functions, fctsib, &__function_free);
-            }
+         // In lazy mode, only the CU itself is parsed: its lines and functions are parsed when queried
+         if (is_lazy)
+            hashtable_insert(files_by_die, (void*) overall_offset, file);
+      }
+   }
 
-            // Link inlined function to the function
-            FOREACH_INQUEUE(fct->inlinedFunctions, it_inlined)
-            {
-               DwarfInlinedFunction* ifct = GET_DATA_T(DwarfInlinedFunction*,
-                     it_inlined);
-               DwarfFunction* fctsib = hashtable_lookup(api->functions_off,
-                     (void*) (ifct->abstract_origin));
-               if (fctsib != NULL)
-                  ifct->function = fctsib;
-            }
+   if (is_lazy) {
+      __api_index_cus(api, files_by_die);
+      hashtable_free(files_by_die, NULL, NULL);
+   } else {
+      if (!__api_load_parallel(api, nb_threads)) {
+         FOREACH_INQUEUE(api->files, it_file) {
+            DwarfFile* file = GET_DATA_T(DwarfFile*, it_file);
+            __file_load_lines(api, file);
+            __file_load_functions(api, file);
          }
-
       }
+      api->is_loaded = TRUE;
+      api->is_lines_loaded = TRUE;
    }
 
    // ------------------------------------------------------------------------
@@ -1759,18 +2284,69 @@ DwarfAPI* dwarf_api_init_light(Elf* elf, char* elf_name, asmfile_t* asmf)
    }
 
    // Generate an array of function to improve search in next steps
-   api->fct_array_size = 0;
-   HASHTABLE_TO_MALLOC_ARRAY(DwarfFunction*, api->functions, fct_array,
-         api->fct_array_size);
-   qsort(fct_array, api->fct_array_size, sizeof(DwarfFunction*),
-         &_dwarf_function_cmp);
-   api->fct_array = fct_array;
+   if (api->is_loaded)
+      __api_sort_functions(api);
 
    DBGMSG0("End of dwarf_api_init_light\n");
    return api;
 #endif
 }
 
+/* -------------------------- DwarfAPI functions --------------------------- */
+/*
+ * Initialize the Dwarf API
+ * \param elf an Elf structure used as input for libdwarf
+ * \param elf_name
+ * \param asmf corresponding assembly file or NULL
+ * \return The API object
+ */
+DwarfAPI* dwarf_api_init_light(Elf* elf, char* elf_name, asmfile_t* asmf)
+{
+   int nb_threads = (int) (int64_t) asmfile_get_parameter(asmf,
+         PARAM_MODULE_DEBUG, PARAM_DEBUG_NB_THREADS);
+   return dwarf_api_init_parallel(elf, elf_name, asmf, nb_threads);
+}
+
+/*
+ * Initialize the Dwarf API, parsing compilation units (CU) with a pool of threads.
+ * The result is the same as with a sequential parsing.
+ * \param elf an Elf structure used as input for libdwarf
+ * \param elf_name
+ * \param asmf corresponding assembly file or NULL
+ * \param nb_threads number of threads to use (negative for one per processor, 0 or 1 for none)
+ * \return The API object
+ */
+DwarfAPI* dwarf_api_init_parallel(Elf* elf, char* elf_name, asmfile_t* asmf,
+      int nb_threads)
+{
+   if (nb_threads < 0)
+      nb_threads = threadpool_get_nb_cpus();
+   return __dwarf_api_init(elf, elf_name, asmf, FALSE, nb_threads);
+}
+
+/*
+ * Initialize the Dwarf API in lazy mode: only the compilation units (CU) and the ranges of
+ * addresses they cover are read. Functions and lines of a CU are parsed when first queried.
+ * \param elf an Elf structure used as input for libdwarf
+ * \param elf_name
+ * \param asmf corresponding assembly file or NULL
+ * \return The API object
+ */
+DwarfAPI* dwarf_api_init_lazy(Elf* elf, char* elf_name, asmfile_t* asmf)
+{
+   return __dwarf_api_init(elf, elf_name, asmf, TRUE, 1);
+}
+
+/*
+ * Checks if a Dwarf API parses compilation units on demand
+ * \param api a Dwarf API
+ * \return TRUE if api has been created with dwarf_api_init_lazy, FALSE otherwise
+ */
+int dwarf_api_is_lazy(DwarfAPI* api)
+{
+   return (api != NULL) ? api->is_lazy : FALSE;
+}
+
 /*
  * Frees a Dwarf API structure
  * \param api a Dwarf API created with dwarf_api_init_light
@@ -1789,14 +2365,21 @@ void dwarf_api_close_light(DwarfAPI* api)
    queue_free(api->lines, __line_free);
 
    dwarf_finish(*(api->dbg), &err);
+   int i = 0;
+   for (i = 0; i < api->nb_worker_dbgs; i++)
+      dwarf_finish(api->worker_dbgs[i], &err);
+   if (api->worker_dbgs != NULL)
+      lc_free(api->worker_dbgs);
    hashtable_free(api->strct, __struc_free, NULL);
    hashtable_free(api->functions, NULL, NULL);
    hashtable_free(api->functions_off, NULL, NULL);
    hashtable_free(api->functions_linkname, NULL, NULL);
    if (api->elf_name)
       lc_free(api->elf_name);
-   if (api->fct_array_size > 0)
+   if (api->fct_array != NULL)
       lc_free(api->fct_array);
+   if (api->cu_ranges != NULL)
+      lc_free(api->cu_ranges);
    lc_free(api->dbg);
    lc_free(api);
 }
@@ -1835,6 +2418,8 @@ static int compare_lines(const void* p1, const void* p2)
 void dwarf_api_get_all_lines(DwarfAPI *api, char ***filename, maddr_t** addrs,
       int ** srcs, unsigned int* size)
 {
+   __api_load_lines(api);
+
    // No debug data on lines, set outputs to NULL then exit
    if (queue_length(api->lines) == 0) {
       if (addrs)
@@ -1882,6 +2467,8 @@ static queue_t* dwarf_api_get_functions_static(DwarfAPI *api)
    DwarfFile *file;
    queue_t* ret = queue_new();
 
+   __api_load_functions(api);
+
    FOREACH_INQUEUE(api->files, file_link) {
       file = GET_DATA_T(DwarfFile*, file_link);
 
@@ -2005,6 +2592,7 @@ DwarfFunction* dwarf_api_get_function_by_addr(DwarfAPI *api, Dwarf_Addr low_pc)
 {
    if (api == NULL)
       return (NULL);
+   __api_load_functions_at(api, low_pc);
    return (hashtable_lookup(api->functions, (void*) low_pc));
 }
 
@@ -2020,6 +2608,7 @@ DwarfFunction* dwarf_api_get_function_by_interval(DwarfAPI *api,
 {
    if (api == NULL)
       return (NULL);
+   __api_load_functions(api);
 
    if ((api == NULL) || (api->fct_array_size == 0)
          || (uint64_t) (api->fct_array[0]->low_pc) < low_pc)
@@ -2049,6 +2638,9 @@ DwarfFunction* dwarf_api_get_function_by_interval(DwarfAPI *api,
 DwarfFunction* dwarf_api_get_function_by_src(DwarfAPI *api, const char* name,
       int srcl)
 {
+   // Names of source files of a CU are retrieved with its lines
+   __api_load_lines(api);
+
    FOREACH_INQUEUE(api->files, file_link) {
       DwarfFile *file = GET_DATA_T(DwarfFile*, file_link);
       int i = 0;
@@ -2073,6 +2665,7 @@ DwarfFunction* dwarf_api_get_function_by_linkname(DwarfAPI *api, char* linkname)
 {
    if (api == NULL || linkname == NULL)
       return (NULL);
+   __api_load_functions(api);
    return (hashtable_lookup(api->functions_linkname, linkname));
 }
 
@@ -2195,6 +2788,7 @@ DwarfFunction* dwarf_file_get_function_by_addr(DwarfFile *file,
    if (file == NULL)
       return (NULL);
    DwarfFunction *function;
+   __file_load_functions(file->api, file);
 
    FOREACH_INQUEUE(file->functions, function_link) {
       function = function_link->data;
@@ -2225,6 +2819,7 @@ DwarfFunction* dwarf_file_get_function_by_interval(DwarfFile *file,
 {
    if (file == NULL)
       return (NULL);
+   __file_load_functions(file->api, file);
 
    FOREACH_INQUEUE(file->functions, function_link) {
       DwarfFunction *function = GET_DATA_T(DwarfFunction*, function_link);
@@ -2274,7 +2869,7 @@ queue_t* dwarf_file_get_global_variables(DwarfFile *file)
             if (var != NULL)
                queue_add_tail(file->global_var, var);
          }
-      } while (dwarf_siblingof_b(*(file->api->dbg), child_die, TRUE,
+      } while (dwarf_siblingof_b(*(file->dbg), child_die, TRUE,
             &sibling_die, &err) == DW_DLV_OK);
    }
    return (file->global_var);
@@ -2292,6 +2887,7 @@ DwarfFunction* dwarf_file_get_function_by_src(DwarfFile *file, int srcl)
       return (NULL);
    DwarfFunction *fct = NULL;
    int diff = -1;
+   __file_load_functions(file->api, file);
 
    FOREACH_INQUEUE(file->functions, function_link) {
       DwarfFunction *function = GET_DATA_T(DwarfFunction*, function_link);
@@ -2416,7 +3012,7 @@ static void dwarf_function_load_variables(DwarfFunction *func)
             if (var != NULL)
                queue_add_tail(func->local_vars, var);
          }
-      } while (dwarf_siblingof_b(*(func->file->api->dbg), child_die, TRUE,
+      } while (dwarf_siblingof_b(*(func->file->dbg), child_die, TRUE,
             &sibling_die, &err) == DW_DLV_OK);
    }
 }
@@ -2493,7 +3089,7 @@ DwarfVar* dwarf_function_get_returned_var(DwarfFunction *func)
    }
    if (func->ret == NULL)
       func->flags |= DFUNC_NO_RET;
-   dwarf_dealloc(*(func->file->api->dbg), dwarf_attrs, DW_DLA_LIST);
+   dwarf_dealloc(*(func->file->dbg), dwarf_attrs, DW_DLA_LIST);
    return (func->ret);
 }
 
@@ -38,7 +38,8 @@ typedef enum _DwarfMemLocType DwarfMemLocType;
 
 /* ------------------------ DwarfAPI functions ----------------------------- */
 /**
- * Initializes the Dwarf API
+ * Initializes the Dwarf API. Compilation units are parsed with the number of threads set
+ * by the PARAM_DEBUG_NB_THREADS parameter of asmf
  * \param api The API object
  * \param elf_name
  * \param asmf corresponding assembly file or NULL
@@ -46,6 +47,39 @@ typedef enum _DwarfMemLocType DwarfMemLocType;
  */
 extern DwarfAPI* dwarf_api_init_light(Elf* elf, char* elf_name, asmfile_t* asmf);
 
+/**
+ * Initializes the Dwarf API, parsing compilation units (CU) with a pool of threads.
+ * Each thread parses CUs with its own libdwarf handle, then results are merged in the order
+ * of CUs, so the API object is the same as with dwarf_api_init_light.
+ * Relocatable files and sessions loading variables are parsed sequentially.
+ * \param elf an Elf structure used as input for libdwarf
+ * \param elf_name
+ * \param asmf corresponding assembly file or NULL
+ * \param nb_threads number of threads to use (negative for one per processor, 0 or 1 for none)
+ * \return The API object
+ */
+extern DwarfAPI* dwarf_api_init_parallel(Elf* elf, char* elf_name, asmfile_t* asmf,
+      int nb_threads);
+
+/**
+ * Initializes the Dwarf API in lazy mode. Only compilation units (CU) and the ranges of
+ * addresses they cover are read. Functions and lines of a CU are parsed when first queried:
+ * looking for a function by address parses only the CUs covering this address, while
+ * queries over all functions or lines parse all CUs.
+ * \param elf an Elf structure used as input for libdwarf
+ * \param elf_name
+ * \param asmf corresponding assembly file or NULL
+ * \return The API object
+ */
+extern DwarfAPI* dwarf_api_init_lazy(Elf* elf, char* elf_name, asmfile_t* asmf);
+
+/**
+ * Checks if a Dwarf API parses compilation units on demand
+ * \param api a Dwarf API
+ * \return TRUE if api has been created with dwarf_api_init_lazy, FALSE otherwise
+ */
+extern int dwarf_api_is_lazy(DwarfAPI* api);
+
 /**
  * Frees a Dwarf API structure
  * \param api a Dwarf API created with dwarf_api_init_light
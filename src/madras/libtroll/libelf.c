@@ -24,6 +24,8 @@
 #else
 #include <ar.h>
 #include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #endif
 #include <stdlib.h>
 #include <stdio.h>
@@ -125,6 +127,12 @@ struct Elf {
    Elf64_Shdr* shdr_64; /**< Section header in 64b*/
    Elf32_Shdr* shdr_32; /**< Section header in 32b*/
 
+   unsigned char* map; /**< If the file is mapped in memory (ELF_C_READ_MMAP), address of
+    the byte at offset off in the file, else NULL*/
+   uint64_t map_size; /**< Number of bytes of the ELF structure available from map*/
+   void* map_base; /**< Address returned by mmap (map rounded down to a page boundary)*/
+   size_t map_len; /**< Length of the mapping starting at map_base*/
+
 /**\todo TODO (2014-06-06) Those two members are there to retrieve easily the sections containing labels (according
  * to ELF standard, there should be only one of each). Later on, we need to have something more streamlined, such as
  * moving the indexes array that is in the elffile_t structure in the Elf structure (and the definitions of indexes
@@ -646,6 +654,115 @@ static int scntype_to_datatype(int sh_type)
    return (ELF_T_BYTE);
 }
 
+// ============================================================================
+//                           FILE ACCESS HANDLING
+// ============================================================================
+/*
+ * Maps the bytes of an ELF structure in memory. The mapping is private and
+ * writable: sections are served as pointers into it and a page is only
+ * copied if it is modified. On failure (non-seekable input, empty file, no
+ * mmap on the system), the structure keeps using read().
+ * \param elf an Elf structure whose fildes and off members are set
+ * \param size number of bytes to map starting at off
+ * \return 1 if the file is mapped, else 0
+ */
+static int _elf_map(Elf* elf, uint64_t size)
+{
+#ifdef _WIN32
+   (void) elf;
+   (void) size;
+   return 0;
+#else
+   struct stat st;
+   if (fstat(elf->fildes, &st) != 0 || !S_ISREG(st.st_mode))
+      return 0;
+   if (elf->off >= (uint64_t) st.st_size)
+      return 0;
+   if (size == 0 || elf->off + size > (uint64_t) st.st_size)
+      size = st.st_size - elf->off;
+
+   // mmap requires an offset aligned on a page
+   uint64_t pagesize = sysconf(_SC_PAGESIZE);
+   uint64_t base_off = elf->off - (elf->off % pagesize);
+   size_t len = (elf->off - base_off) + size;
+   void* base = mmap(NULL, len, PROT_READ | PROT_WRITE, MAP_PRIVATE,
+         elf->fildes, base_off);
+   if (base == MAP_FAILED) {
+      VERBOSE(0, "Unable to map the file in memory: using read\n")
+      return 0;
+   }
+   elf->map_base = base;
+   elf->map_len = len;
+   elf->map = (unsigned char*) base + (elf->off - base_off);
+   elf->map_size = size;
+   VERBOSE(0, "Mapped %#"PRIx64" bytes from offset %#"PRIx64"\n", size, elf->off)
+   return 1;
+#endif
+}
+
+/*
+ * Unmaps the bytes of an ELF structure
+ * \param elf an Elf structure
+ */
+static void _elf_unmap(Elf* elf)
+{
+#ifndef _WIN32
+   if (elf->map_base != NULL)
+      munmap(elf->map_base, elf->map_len);
+#endif
+   elf->map_base = NULL;
+   elf->map_len = 0;
+   elf->map = NULL;
+   elf->map_size = 0;
+}
+
+/*
+ * Returns a pointer into the mapping of an ELF structure
+ * \param elf an Elf structure
+ * \param off offset relative to the beginning of the ELF structure
+ * \param size number of bytes that must be available
+ * \return a pointer on the byte at offset off or NULL if the file is not
+ *         mapped or the range is outside the mapping
+ */
+static unsigned char* _elf_mapped_ptr(Elf* elf, uint64_t off, uint64_t size)
+{
+   if (elf->map == NULL || off > elf->map_size || size > elf->map_size - off)
+      return NULL;
+   return elf->map + off;
+}
+
+/*
+ * Checks if a buffer belongs to the mapping of an ELF structure
+ * \param elf an Elf structure
+ * \param ptr a buffer
+ * \return 1 if ptr is inside the mapping, else 0
+ */
+static int _elf_is_mapped(Elf* elf, void* ptr)
+{
+   return (elf->map_base != NULL && (unsigned char*) ptr >= (unsigned char*) elf->map_base
+         && (unsigned char*) ptr < (unsigned char*) elf->map_base + elf->map_len);
+}
+
+/*
+ * Reads bytes of an ELF structure, from the mapping if it exists, else from the file
+ * \param elf an Elf structure
+ * \param off offset relative to the beginning of the ELF structure
+ * \param buf buffer to fill
+ * \param size number of bytes to read
+ * \return number of bytes read or a negative value if there is an error
+ */
+static int64_t _elf_read(Elf* elf, uint64_t off, void* buf, size_t size)
+{
+   unsigned char* src = _elf_mapped_ptr(elf, off, size);
+   if (src != NULL) {
+      memcpy(buf, src, size);
+      return size;
+   }
+   if (lseek(elf->fildes, elf->off + off, SEEK_SET) < 0)
+      return -1;
+   return read(elf->fildes, buf, size);
+}
+
 /*
  * Loads a 32b Elf file
  * \param elf an Elf structure
@@ -655,13 +772,11 @@ static Elf* _elf_begin32(Elf* elf)
 {
    int error = 0;
    int i = 0;
-   int fd = elf->fildes;
    VERBOSE(0,
          "*Warning* Not verbose output was added when parsing 32 bits files\n")
    // read the elf header
    Elf32_Ehdr* header = malloc(sizeof(Elf32_Ehdr));
-   error = lseek(fd, elf->off, SEEK_SET);
-   error += read(fd, header, sizeof(Elf32_Ehdr));
+   error = _elf_read(elf, 0, header, sizeof(Elf32_Ehdr));
    elf->ehdr_32 = header;
 
    //TODO: check error
@@ -670,8 +785,7 @@ static Elf* _elf_begin32(Elf* elf)
    // read sections
    if (elf->ehdr_32->e_shoff != 0) {
       elf->shdr_32 = malloc(elf->ehdr_32->e_shnum * sizeof(Elf32_Shdr));
-      error = lseek(fd, elf->off + elf->ehdr_32->e_shoff, SEEK_SET);
-      error += read(fd, elf->shdr_32,
+      error = _elf_read(elf, elf->ehdr_32->e_shoff, elf->shdr_32,
             elf->ehdr_32->e_shnum * sizeof(Elf32_Shdr));
 
       elf->scn = malloc(elf->ehdr_32->e_shnum * sizeof(Elf_Scn*));
@@ -702,8 +816,7 @@ static Elf* _elf_begin32(Elf* elf)
    // read segments
    if (elf->ehdr_32->e_phoff != 0) {
       elf->phdr_32 = malloc(elf->ehdr_32->e_phnum * sizeof(Elf32_Phdr));
-      error = lseek(fd, elf->off + elf->ehdr_32->e_phoff, SEEK_SET);
-      error += read(fd, elf->phdr_32,
+      error = _elf_read(elf, elf->ehdr_32->e_phoff, elf->phdr_32,
             elf->ehdr_32->e_phnum * sizeof(Elf32_Phdr));
 
       //TODO: check error
@@ -722,12 +835,10 @@ static Elf* _elf_begin64(Elf* elf)
 {
    int error = 0;
    int i = 0;
-   int fd = elf->fildes;
 
    // read the elf header
    Elf64_Ehdr* header = malloc(sizeof(Elf64_Ehdr));
-   error = lseek(fd, elf->off, SEEK_SET);
-   error += read(fd, header, sizeof(Elf64_Ehdr));
+   error = _elf_read(elf, 0, header, sizeof(Elf64_Ehdr));
    elf->ehdr_64 = header;
 
    VERBOSE(0,
@@ -743,8 +854,7 @@ static Elf* _elf_begin64(Elf* elf)
    // read sections
    if (elf->ehdr_64->e_shoff != 0) {
       elf->shdr_64 = malloc(elf->ehdr_64->e_shnum * sizeof(Elf64_Shdr));
-      error = lseek(fd, elf->off + elf->ehdr_64->e_shoff, SEEK_SET);
-      error += read(fd, elf->shdr_64,
+      error = _elf_read(elf, elf->ehdr_64->e_shoff, elf->shdr_64,
             elf->ehdr_64->e_shnum * sizeof(Elf64_Shdr));
 
       VERBOSE(0, "Parsed section header at offset %#"PRIx64"\n",
@@ -769,12 +879,15 @@ static Elf* _elf_begin64(Elf* elf)
 
          VERBOSE_ACTION(3, fprintf(stderr, "Bytes: ");
             unsigned char* __scn_buf = NULL;
-            int __error = lseek(fd, elf->off + elf->shdr_64[i].sh_offset, SEEK_SET);
+            int64_t __error = 0;
             if (elf->shdr_64[i].sh_type != SHT_NOBITS && elf->shdr_64[i].sh_size > 0) {
                __scn_buf = malloc(elf->shdr_64[i].sh_size);
-               __error += read(fd, __scn_buf, elf->shdr_64[i].sh_size);
+               __error = _elf_read(elf, elf->shdr_64[i].sh_offset, __scn_buf, elf->shdr_64[i].sh_size);
             }
-            if (__scn_buf == NULL) fprintf(stderr, "<NULL>\n"); else {
+            if (__scn_buf != NULL && __error < (int64_t) elf->shdr_64[i].sh_size) {
+               fprintf(stderr, "<read error>\n");
+               free(__scn_buf);
+            } else if (__scn_buf == NULL) fprintf(stderr, "<NULL>\n"); else {
                Elf64_Xword c;
                for (c = 0; c < elf->shdr_64[i].sh_size; c++) {
                   fprintf(stderr, "%02x ", __scn_buf[c]);
@@ -804,8 +917,7 @@ static Elf* _elf_begin64(Elf* elf)
    // read segments
    if (elf->ehdr_64->e_phoff != 0) {
       elf->phdr_64 = malloc(elf->ehdr_64->e_phnum * sizeof(Elf64_Phdr));
-      error = lseek(fd, elf->off + elf->ehdr_64->e_phoff, SEEK_SET);
-      error += read(fd, elf->phdr_64,
+      error = _elf_read(elf, elf->ehdr_64->e_phoff, elf->phdr_64,
             elf->ehdr_64->e_phnum * sizeof(Elf64_Phdr));
 
       VERBOSE(0, "Parsed segment header at offset %#"PRIx64"\n",
@@ -864,7 +976,9 @@ static Elf* _elf_init(int fd, Elf_Cmd cmd, Elf_Kind kind, long off)
  * Loads an Elf file
  * \param __filedes the input file file descriptor
  * \param __cmd flags used to open the file. 
- *              Only ELF_C_READ and ELF_C_READ_MMAP are supported
+ *              Only ELF_C_READ and ELF_C_READ_MMAP are supported.
+ *              With ELF_C_READ_MMAP, section data point into a private
+ *              mapping of the file (read() is used if mapping fails)
  * \param __ref Reference Elf file. If __ref is an Elf file, it is
  *              returned. If __ref is an archive (AR file), then 
  *              an object file is extracted from the archive.
@@ -913,6 +1027,15 @@ Elf *elf_begin(int __fildes, Elf_Cmd __cmd, Elf *__ref)
             __ref->ar->ELFpositionInFile[__ref->ar->current - 1]);
       elf->name = __ref->ar->objectNames[__ref->ar->current - 1]; //__ref->ar->headerFiles[__ref->ar->current - 1].ar_name;
 
+      // Only the bytes of the member are mapped
+      if (__cmd == ELF_C_READ_MMAP) {
+         long member_size = 0;
+         ar_hdr_t* member_hdr = &__ref->ar->headerFiles[__ref->ar->current - 1];
+         if (AR_getfieldvalue_long(member_hdr->ar_size, SIZE_AR_SIZE, &member_size)
+               && member_size > 0)
+            _elf_map(elf, member_size);
+      }
+
       switch (ident[EI_CLASS]) {
       case ELFCLASSNONE:
          fprintf(stderr, "[elf_begin] No class\n");
@@ -974,6 +1097,10 @@ Elf *elf_begin(int __fildes, Elf_Cmd __cmd, Elf *__ref)
       elf->name = elf->ar->objectNames[elf->ar->current]; //elf->ar->headerFiles[elf->ar->current].ar_name;
       return (elf);
    }
+   //serve headers and sections from a mapping of the file if requested
+   if (__cmd == ELF_C_READ_MMAP)
+      _elf_map(elf, 0);
+
    //get the mode (32b / 64b) and load the
    //file using the corresponding function
    switch (ident[EI_CLASS]) {
@@ -1027,13 +1154,16 @@ Elf_Data *elf_getdata(Elf_Scn *__scn, Elf_Data *__data)
       int error = 0;
       //load the data and save it into data structures
       if (__scn->shdr_32 != NULL) {
-         error = lseek(__scn->elf->fildes,
-               __scn->elf->off + __scn->shdr_32->sh_offset, SEEK_SET);
          __scn->data = malloc(sizeof(Elf_Data));
          if (__scn->shdr_32->sh_type != SHT_NOBITS) {
-            __scn->data->d_buf = malloc(__scn->shdr_32->sh_size);
-            error += read(__scn->elf->fildes, __scn->data->d_buf,
-                  __scn->shdr_32->sh_size);
+            //section bytes are used in place if the file is mapped
+            __scn->data->d_buf = _elf_mapped_ptr(__scn->elf,
+                  __scn->shdr_32->sh_offset, __scn->shdr_32->sh_size);
+            if (__scn->data->d_buf == NULL) {
+               __scn->data->d_buf = malloc(__scn->shdr_32->sh_size);
+               error = _elf_read(__scn->elf, __scn->shdr_32->sh_offset,
+                     __scn->data->d_buf, __scn->shdr_32->sh_size);
+            }
          } else {
             __scn->data->d_buf = NULL;
          }
@@ -1047,13 +1177,16 @@ Elf_Data *elf_getdata(Elf_Scn *__scn, Elf_Data *__data)
          __scn->data->d_off = 0;
          __scn->data->d_align = __scn->shdr_32->sh_addralign;
       } else if (__scn->shdr_64 != NULL) {
-         error = lseek(__scn->elf->fildes,
-               __scn->elf->off + __scn->shdr_64->sh_offset, SEEK_SET);
          __scn->data = malloc(sizeof(Elf_Data));
          if (__scn->shdr_64->sh_type != SHT_NOBITS) {
-            __scn->data->d_buf = malloc(__scn->shdr_64->sh_size);
-            error += read(__scn->elf->fildes, __scn->data->d_buf,
-                  __scn->shdr_64->sh_size);
+            //section bytes are used in place if the file is mapped
+            __scn->data->d_buf = _elf_mapped_ptr(__scn->elf,
+                  __scn->shdr_64->sh_offset, __scn->shdr_64->sh_size);
+            if (__scn->data->d_buf == NULL) {
+               __scn->data->d_buf = malloc(__scn->shdr_64->sh_size);
+               error = _elf_read(__scn->elf, __scn->shdr_64->sh_offset,
+                     __scn->data->d_buf, __scn->shdr_64->sh_size);
+            }
          } else {
             __scn->data->d_buf = NULL;
          }
@@ -1105,7 +1238,7 @@ static int elf_end_s(Elf *__elf, int freedata)
       for (i = 0; i < __elf->ehdr_64->e_shnum; i++) {
          free(__elf->scn[i]->shdr_64);
          if (__elf->scn[i]->data != NULL) {
-            if (freedata)
+            if (freedata && !_elf_is_mapped(__elf, __elf->scn[i]->data->d_buf))
                free(__elf->scn[i]->data->d_buf);
             /**\todo TODO (2015-06-05) Find a way to avoid making the test for each section without duplicating the code
              * Maybe use a macro (this would also allow to get rid of the double code for 32/64)*/
@@ -1122,7 +1255,7 @@ static int elf_end_s(Elf *__elf, int freedata)
       for (i = 0; i < __elf->ehdr_32->e_shnum; i++) {
          free(__elf->scn[i]->shdr_32);
          if (__elf->scn[i]->data != NULL) {
-            if (freedata)
+            if (freedata && !_elf_is_mapped(__elf, __elf->scn[i]->data->d_buf))
                free(__elf->scn[i]->data->d_buf);
             /**\todo TODO (2015-06-05) Find a way to avoid making the test for each section without duplicating the code
              * Maybe use a macro (this would also allow to get rid of the double code for 32/64)*/
@@ -1136,6 +1269,7 @@ static int elf_end_s(Elf *__elf, int freedata)
       free(__elf->phdr_32);
       __elf->ehdr_32 = NULL;
    }
+   _elf_unmap(__elf);
 
    free(__elf);
    return (0);
@@ -164,7 +164,12 @@ extern Elf_Kind elf_kind (Elf *__elf);
  * Loads an Elf file
  * \param __filedes the input file file descriptor
  * \param __cmd flags used to open the file. 
- *              Only ELF_C_READ and ELF_C_READ_MMAP are supported
+ *              Only ELF_C_READ and ELF_C_READ_MMAP are supported.
+ *              With ELF_C_READ_MMAP, the file is mapped in memory and the
+ *              data of sections point into the mapping instead of being
+ *              read into allocated buffers. The mapping is private, so
+ *              modified pages are copied and the file is never altered.
+ *              If the file can not be mapped, ELF_C_READ is used instead.
  * \param __ref Reference Elf file. If __ref is an Elf file, it is
  *              returned. If __ref is an archive (AR file), then 
  *              an object file is extracted from the archive.
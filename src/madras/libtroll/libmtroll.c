@@ -9622,7 +9622,7 @@ static int elf_binfile_load_from_ar(binfile_t* bf, Elf* elf, FILE* filestream)
    n_ar_elts = elf_get_ar_size(elf);
    binfile_set_nb_ar_elts(bf, n_ar_elts);
 
-   while ((ar_o = elf_begin(fileno(filestream), ELF_C_READ, elf)) != NULL) {
+   while ((ar_o = elf_begin(fileno(filestream), ELF_C_READ_MMAP, elf)) != NULL) {
       binfile_t* ar_elt = binfile_new(
             (elf_getname(ar_o) != NULL) ? elf_getname(ar_o) : "[no name]");
       res = elf_load_to_binfile(ar_elt, ar_o);
@@ -9648,8 +9648,15 @@ dbg_file_t* elf_binfile_parse_dbg(binfile_t* bf)
    elffile_t* efile = binfile_get_parsed_bin(bf);
 
    //Attempts to parse DWARF format
-   DwarfAPI* dwarf = dwarf_api_init_light(efile->elf, binfile_get_file_name(bf),
-         NULL);
+   DwarfAPI* dwarf = NULL;
+   asmfile_t* asmf = binfile_get_asmfile(bf);
+   if (asmfile_get_parameter(asmf, PARAM_MODULE_DEBUG,
+         PARAM_DEBUG_LAZY_DWARF) == FALSE)
+      dwarf = dwarf_api_init_parallel(efile->elf, binfile_get_file_name(bf),
+            NULL, (int) (int64_t) asmfile_get_parameter(asmf,
+                  PARAM_MODULE_DEBUG, PARAM_DEBUG_NB_THREADS));
+   else
+      dwarf = dwarf_api_init_lazy(efile->elf, binfile_get_file_name(bf), NULL);
    if (dwarf) {
       return dbg_file_new(dwarf, DBG_FORMAT_DWARF);
    }
@@ -9679,7 +9686,7 @@ int elf_binfile_load(binfile_t* bf)
    } else
       return ERR_COMMON_FILE_NAME_MISSING;
 
-   Elf* elf = elf_begin(fileno(filestream), ELF_C_READ, NULL);
+   Elf* elf = elf_begin(fileno(filestream), ELF_C_READ_MMAP, NULL);
    switch (elf_kind(elf)) {
    case ELF_K_ELF:
       elf_load_to_binfile(bf, elf);
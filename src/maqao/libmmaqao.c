@@ -64,36 +64,45 @@ static void analyze_disassembled_file(project_t* project, asmfile_t* asmfile)
    printf ("debug data loading ...[%.2f s]\n", (float) (t2-t1) / CLOCKS_PER_SEC);
    t1 = clock();
 #endif
-   DBGMSG0("flow analysing ...\n");
-   lcore_analyze_flow(asmfile);
+   // Results of the flow, loop and connected components analyses are reloaded
+   // from the cache if it contains them for this binary file
+   char* cache_dir = asmfile_get_parameter(asmfile, PARAM_MODULE_LCORE,
+         PARAM_LCORE_CACHE_DIR);
+   if (cache_dir == NULL || lcore_cache_load(asmfile, cache_dir) != EXIT_SUCCESS) {
+      DBGMSG0("flow analysing ...\n");
+      lcore_analyze_flow(asmfile);
 #ifdef _MAQAO_TIMER_
-   t2 = clock();
-   printf ("flow analysing ...[%.2f s]\n", (float) (t2-t1) / CLOCKS_PER_SEC);
-   t1 = clock();
+      t2 = clock();
+      printf ("flow analysing ...[%.2f s]\n", (float) (t2-t1) / CLOCKS_PER_SEC);
+      t1 = clock();
 #endif
-   DBGMSG0("loop analysing ...\n");
-   lcore_analyze_loops(asmfile);
+      DBGMSG0("loop analysing ...\n");
+      lcore_analyze_loops(asmfile);
 #ifdef _MAQAO_TIMER_
-   t2 = clock();
-   printf ("loop analysing ...[%.2f s]\n", (float) (t2-t1) / CLOCKS_PER_SEC);
-   t1 = clock();
+      t2 = clock();
+      printf ("loop analysing ...[%.2f s]\n", (float) (t2-t1) / CLOCKS_PER_SEC);
+      t1 = clock();
 #endif
-   DBGMSG0("connected components analysing ...\n");
-   lcore_analyze_connected_components(asmfile);
+      DBGMSG0("connected components analysing ...\n");
+      lcore_analyze_connected_components(asmfile);
 #ifdef _MAQAO_TIMER_
-   t2 = clock();
-   printf ("connected components analysing ...[%.2f s]\n", (float) (t2-t1) / CLOCKS_PER_SEC);
+      t2 = clock();
+      printf ("connected components analysing ...[%.2f s]\n", (float) (t2-t1) / CLOCKS_PER_SEC);
 #endif
-   if (project->cc_mode != CCMODE_OFF) {
+      if (project->cc_mode != CCMODE_OFF) {
 #ifdef _MAQAO_TIMER_
-      t1 = clock();
+         t1 = clock();
 #endif
-      DBGMSG0("extract functions from connected components ...\n");
-      lcore_asmfile_extract_functions_from_cc(asmfile);
+         DBGMSG0("extract functions from connected components ...\n");
+         lcore_asmfile_extract_functions_from_cc(asmfile);
 #ifdef _MAQAO_TIMER_
-      t2 = clock();
-      printf ("extract functions from connected components ...[%.2f s]\n", (float) (t2-t1) / CLOCKS_PER_SEC);
+         t2 = clock();
+         printf ("extract functions from connected components ...[%.2f s]\n", (float) (t2-t1) / CLOCKS_PER_SEC);
 #endif
+      }
+      if (cache_dir != NULL && lcore_cache_save(asmfile, cache_dir) != EXIT_SUCCESS)
+         DBGMSG("Unable to save analysis results of %s in %s\n",
+               asmfile_get_name(asmfile), cache_dir);
    }
 #ifdef _MAQAO_TIMER_
    t1 = clock();
@@ -405,6 +405,14 @@ char* errcode_getmsg(const int errcode) {
 
    case WRN_DISASS_INCOMPLETE_DISASSEMBLY:
       return "Disassembly is incomplete";  /**<Disassembly is incomplete*/
+   case WRN_DISASS_DECODING_MISMATCH:
+      return "Instructions decoded in parallel or from the decoding cache differ from their decoding by the FSM";  /**<Instructions decoded in parallel or from the decoding cache differ from the FSM*/
+
+      /** Error codes for the ANALYZE module **/
+   case ERR_ANALYZE_CACHE_NOT_MATCHING:
+      return "Cached analysis results do not match the file or the MAQAO version";  /**<Cached analysis results do not match the file or the MAQAO version*/
+   case ERR_ANALYZE_CACHE_UNSUPPORTED:
+      return "Analysis results can not be stored in a cache file";  /**<Analysis results can not be stored in a cache file*/
 
       /** Error codes for the PATCH module **/
    case ERR_PATCH_ARCH_NOT_SUPPORTED:
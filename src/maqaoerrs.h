@@ -316,6 +316,11 @@
 #define WRN_DISASS_FSM_RESET_ADDRESS_PARSING_IN_PROGRESS ERRORCODE_DECLARE(ERRLVL_WRN, MODULE_DISASS, 0x0011)  /**<Requested parser reset while parsing in progress*/
 
 #define WRN_DISASS_INCOMPLETE_DISASSEMBLY                ERRORCODE_DECLARE(ERRLVL_WRN, MODULE_DISASS, 0x0020)  /**<Disassembly is incomplete*/
+#define WRN_DISASS_DECODING_MISMATCH                     ERRORCODE_DECLARE(ERRLVL_WRN, MODULE_DISASS, 0x0021)  /**<Instructions decoded in parallel or from the decoding cache differ from the FSM*/
+
+/** Error codes for the ANALYZE module **/
+#define ERR_ANALYZE_CACHE_NOT_MATCHING                   ERRORCODE_DECLARE(ERRLVL_ERR, MODULE_ANALYZE, 0x0001)  /**<Cached analysis results do not match the file or the MAQAO version*/
+#define ERR_ANALYZE_CACHE_UNSUPPORTED                    ERRORCODE_DECLARE(ERRLVL_ERR, MODULE_ANALYZE, 0x0002)  /**<Analysis results can not be stored in a cache file*/
 
 /** Error codes for the PATCH module **/
 #define ERR_PATCH_ARCH_NOT_SUPPORTED               ERRORCODE_DECLARE(ERRLVL_ERR, MODULE_PATCH, 0x0001)   /**<Architecture not supported for patching*/
@@ -129,4 +129,14 @@ extern int blocks_iter(lua_State * L);
 extern int loop_is_dominant(loop_t *loop);
 extern void _group_totable(lua_State * L, group_t* group, long user);
 
+/** Lua table of block weights (indexed by block ID), passed to get_lua_block_weight */
+typedef struct {
+   lua_State *L;
+   int index; /**<Stack index of the table*/
+} lua_block_weights_t;
+
+extern int push_paths_iter(lua_State * L, graph_paths_iter_t *paths_iter);
+extern float get_lua_block_weight(block_t *block, void *user);
+extern int push_top_paths(lua_State * L, queue_t *paths);
+
 #endif
@@ -577,6 +577,127 @@ static int l_function_free_paths(lua_State *L)
    return 0;
 }
 
+/**
+ this function is internally used by push_paths_iter to free the paths iterator
+ */
+static int lazy_paths_gc(lua_State * L)
+{
+   graph_paths_iter_t **iter = lua_touserdata(L, 1);
+
+   graph_paths_iter_free(*iter);
+   *iter = NULL;
+
+   return 0;
+}
+
+/**
+ this function is internally used by push_paths_iter
+ */
+static int lazy_paths_iter(lua_State * L)
+{
+   graph_paths_iter_t **iter = lua_touserdata(L, lua_upvalueindex(1));
+
+   if ((iter != NULL) && (*iter != NULL)) {
+      array_t *path = graph_paths_iter_next(*iter);
+      int i = 1;
+
+      if (path == NULL)
+         return 0;
+
+      lua_newtable(L);
+
+      FOREACH_INARRAY(path, iter_n) {
+         graph_node_t *node = ARRAY_GET_DATA(node, iter_n);
+         create_block(L, node->data);
+         lua_rawseti(L, -2, i++);
+      }
+
+      return 1;
+   }
+
+   return 0;
+}
+
+/**
+ this function is internally used by l_function_lazy_paths and l_loop_lazy_paths
+ */
+int push_paths_iter(lua_State * L, graph_paths_iter_t *paths_iter)
+{
+   graph_paths_iter_t **iter = lua_newuserdata(L, sizeof *iter);
+
+   /* The iterator is freed when garbage collected (even if not exhausted) */
+   *iter = paths_iter;
+   if (luaL_newmetatable(L, "paths_iter")) {
+      lua_pushcfunction(L, lazy_paths_gc);
+      lua_setfield(L, -2, "__gc");
+   }
+   lua_setmetatable(L, -2);
+
+   lua_pushcclosure(L, lazy_paths_iter, 1);
+
+   return 1;
+}
+
+static int l_function_lazy_paths(lua_State * L)
+{
+   f_t *f = luaL_checkudata(L, 1, FUNCTION);
+
+   return push_paths_iter(L, lcore_fct_paths_iter_new(f->p));
+}
+
+/**
+ this function is internally used by l_function_get_top_paths and l_loop_get_top_paths
+ */
+float get_lua_block_weight(block_t *block, void *user)
+{
+   lua_block_weights_t *weights = user;
+
+   lua_rawgeti(weights->L, weights->index, block_get_id(block));
+   float weight = (float) lua_tonumber(weights->L, -1);
+   lua_pop(weights->L, 1);
+
+   return weight;
+}
+
+/**
+ this function is internally used by l_function_get_top_paths and l_loop_get_top_paths
+ */
+int push_top_paths(lua_State * L, queue_t *paths)
+{
+   int i = 1;
+
+   if (paths == NULL)
+      return 0;
+
+   lua_newtable(L);
+
+   FOREACH_INQUEUE(paths, iter_p) {
+      array_t *path = GET_DATA_T(array_t*, iter_p);
+      int j = 1;
+
+      lua_newtable(L);
+      FOREACH_INARRAY(path, iter_b) {
+         create_block(L, *iter_b);
+         lua_rawseti(L, -2, j++);
+      }
+      lua_rawseti(L, -2, i++);
+   }
+
+   graph_free_paths(paths);
+
+   return 1;
+}
+
+static int l_function_get_top_paths(lua_State * L)
+{
+   f_t *f = luaL_checkudata(L, 1, FUNCTION);
+   int k = luaL_checkinteger(L, 2);
+   lua_block_weights_t weights = { L, 3 };
+
+   return push_top_paths(L, lcore_fct_get_top_paths(f->p, k,
+         lua_istable(L, 3) ? &get_lua_block_weight : NULL, &weights));
+}
+
 /**
  this function is internally used by l_function_padding_blocks
  */
@@ -1234,6 +1355,8 @@ const luaL_reg function_methods[] = {
    {"paths"                   , l_function_paths},
    {"are_paths_computed"      , l_function_are_paths_computed},
    {"free_paths"              , l_function_free_paths},
+   {"lazy_paths"              , l_function_lazy_paths},
+   {"get_top_paths"           , l_function_get_top_paths},
    {"padding_blocks"          , l_function_padding_blocks},
    {"innermost_loops"         , l_function_innermost_loops},
    {"get_predecessors"        , l_fct_get_predecessors},
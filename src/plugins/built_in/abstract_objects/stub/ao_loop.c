@@ -298,6 +298,23 @@ static int l_loop_free_paths(lua_State *L)
    return 0;
 }
 
+static int l_loop_lazy_paths(lua_State * L)
+{
+   l_t *l = luaL_checkudata(L, 1, LOOP);
+
+   return push_paths_iter(L, lcore_loop_paths_iter_new(l->p));
+}
+
+static int l_loop_get_top_paths(lua_State * L)
+{
+   l_t *l = luaL_checkudata(L, 1, LOOP);
+   int k = luaL_checkinteger(L, 2);
+   lua_block_weights_t weights = { L, 3 };
+
+   return push_top_paths(L, lcore_loop_get_top_paths(l->p, k,
+         lua_istable(L, 3) ? &get_lua_block_weight : NULL, &weights));
+}
+
 static int l_loop_get_first_path(lua_State * L)
 {
    l_t *l = luaL_checkudata(L, 1, LOOP);
@@ -826,6 +843,8 @@ const luaL_reg loop_methods[] = {
    {"paths"                , l_loop_paths},
    {"are_paths_computed"   , l_loop_are_paths_computed},
    {"free_paths"           , l_loop_free_paths},
+   {"lazy_paths"           , l_loop_lazy_paths},
+   {"get_top_paths"        , l_loop_get_top_paths},
    {"get_DDG"              , l_loop_get_DDG},
    {"get_DDG_file_path"    , l_loop_get_DDG_file_path},
    {"get_polytopes"        , l_loop_get_polytopes},
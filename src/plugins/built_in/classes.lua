@@ -0,0 +1,45 @@
+---
+--  Copyright (C) 2004 - 2018 Université de Versailles Saint-Quentin-en-Yvelines (UVSQ)
+--
+-- This file is part of MAQAO.
+--
+-- MAQAO is free software; you can redistribute it and/or
+--  modify it under the terms of the GNU Lesser General Public License
+--  as published by the Free Software Foundation; either version 3
+--  of the License, or (at your option) any later version.
+--
+--  This program is distributed in the hope that it will be useful,
+--  but WITHOUT ANY WARRANTY; without even the implied warranty of
+--  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+--  GNU Lesser General Public License for more details.
+--
+--  You should have received a copy of the GNU Lesser General Public License
+--  along with this program; if not, write to the Free Software
+--  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+---
+
+module("classes",package.seeall)
+dofile("/root/repo/src/plugins//built_in/classes/Table.lua");
+dofile("/root/repo/src/plugins//built_in/classes/Help.lua");
+dofile("/root/repo/src/plugins//built_in/classes/Consts.lua");
+dofile("/root/repo/src/plugins//built_in/classes/Utils.lua");
+dofile("/root/repo/src/plugins//built_in/classes/String.lua");
+dofile("/root/repo/src/plugins//built_in/classes/Message.lua");
+dofile("/root/repo/src/plugins//built_in/classes/Debug.lua");
+dofile("/root/repo/src/plugins//built_in/classes/Convert.lua");
+dofile("/root/repo/src/plugins//built_in/classes/Math.lua");
+dofile("/root/repo/src/plugins//built_in/classes/Graph.lua");
+dofile("/root/repo/src/plugins//built_in/classes/graph/DAG.lua");
+dofile("/root/repo/src/plugins//built_in/classes/Tree.lua");
+dofile("/root/repo/src/plugins//built_in/classes/Stack.lua");
+dofile("/root/repo/src/plugins//built_in/classes/List.lua");
+dofile("/root/repo/src/plugins//built_in/classes/Queue.lua");
+dofile("/root/repo/src/plugins//built_in/classes/SVG.lua");
+dofile("/root/repo/src/plugins//built_in/classes/MDSAPI.lua");
+dofile("/root/repo/src/plugins//built_in/classes/XLSX.lua");
+dofile("/root/repo/src/plugins//built_in/classes/HTML.lua");
+dofile("/root/repo/src/plugins//built_in/classes/Stream.lua");
+dofile("/root/repo/src/plugins//built_in/classes/TEXT.lua");
+dofile("/root/repo/src/plugins//built_in/classes/TextOutput.lua");
+dofile("/root/repo/src/plugins//built_in/classes/Base64.lua");
+
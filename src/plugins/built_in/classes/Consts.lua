@@ -0,0 +1,86 @@
+---
+--  Copyright (C) 2004 - 2018 Université de Versailles Saint-Quentin-en-Yvelines (UVSQ)
+--
+-- This file is part of MAQAO.
+--
+-- MAQAO is free software; you can redistribute it and/or
+--  modify it under the terms of the GNU Lesser General Public License
+--  as published by the Free Software Foundation; either version 3
+--  of the License, or (at your option) any later version.
+--
+--  This program is distributed in the hope that it will be useful,
+--  but WITHOUT ANY WARRANTY; without even the implied warranty of
+--  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+--  GNU Lesser General Public License for more details.
+--
+--  You should have received a copy of the GNU Lesser General Public License
+--  along with this program; if not, write to the Free Software
+--  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+---
+
+Consts = {};
+
+ConstsMeta = {};
+ConstsMeta._NAME       = "Consts";
+ConstsMeta.__index     = Consts;
+ConstsMeta.__tostring  = Consts.tostring;
+
+
+-- Must be the same than its java counterpart
+Consts.ERROR_TYPE           = -1
+Consts.ASMCODE_TYPE         = 1
+Consts.SRCCODE_TYPE         = 2
+Consts.DIR_TYPE				   = 3
+Consts.CGNAME_TYPE          = 4
+Consts.CG_TYPE              = 5
+Consts.CFGNAME_TYPE         = 6
+Consts.CFG_TYPE             = 7
+Consts.FUNCSTAT_TYPE        = 8
+Consts.LOOP_SELECT          = 9
+Consts.LOOPSTAT_TYPE        = 10
+Consts.REPORT_TYPE          = 11
+Consts.FUNCLIST_TYPE        = 12
+Consts.LOOPLIST_TYPE        = 13
+Consts.DETAILED_REPORT_TYPE = 14
+Consts.LOOP_DDG_TYPE        = 15
+Consts.PROFILE_TYPE         = 16
+Consts.LOOP_VERSIONING_TYPE = 17
+Consts.OPTIONS_TYPE         = 18
+
+-- Paths
+Consts.GRAPHS_PATH = "/tmp/"
+Consts.MAQAO_PATH = "/root/repo"
+Consts.ENVVAR_MODULES_PATH = "MAQAO_PLUGIN_PATH"
+
+-- GUI options
+Consts.IP 		= "127.0.0.1"
+Consts.PORT	= "8180"
+Consts.LOCAL_PORT = 8080
+Consts.ITER						= 1
+Consts.LOC = 50
+Consts.GRAPH_INTERFACE = "Exagraph"
+
+-- OS specific variables
+Consts.is_UNIX    = true
+Consts.is_APPLE   = false
+Consts.is_WINDOWS = false
+
+-- Compiler path
+Consts.COMPILER_FULLPATH = "/usr/bin/cc"
+
+-- Loading generated constants
+dofile("/root/repo/src/plugins//built_in/classes/Consts_c.lua")
+dofile("/root/repo/src/plugins//built_in/classes/Consts_errs.lua")
+
+-- Declaration of architectures definitions
+local is_arm64 = "true";
+
+-- Inclusion of architectures C constants
+Consts.arm64 = {};
+dofile("/root/repo/src/plugins//built_in/classes/Consts/arm64.lua");
+dofile("/root/repo/src/plugins//built_in/classes/Consts/arm64_c.lua");
+
+
+function Consts:tostring ()
+   return "Consts defined by MAQAO"
+end
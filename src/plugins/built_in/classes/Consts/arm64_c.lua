@@ -0,0 +1,49 @@
+---
+--  Copyright (C) 2004 - 2018 Université de Versailles Saint-Quentin-en-Yvelines (UVSQ)
+--
+-- This file is part of MAQAO.
+--
+-- MAQAO is free software; you can redistribute it and/or
+--  modify it under the terms of the GNU Lesser General Public License
+--  as published by the Free Software Foundation; either version 3
+--  of the License, or (at your option) any later version.
+--
+--  This program is distributed in the hope that it will be useful,
+--  but WITHOUT ANY WARRANTY; without even the implied warranty of
+--  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+--  GNU Lesser General Public License for more details.
+--
+--  You should have received a copy of the GNU Lesser General Public License
+--  along with this program; if not, write to the Free Software
+--  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+--
+
+
+-- WARNING: This is a generated file. Do not modify it.
+-- If you want to add constants, update file 
+-- /root/repo/src/plugins/built_in/classes/Consts/arm64.lua
+
+--Instruction sets indexes*/
+ --Code for the ARM64 instruction set
+Consts.arm64.ISET_ARM64 = 1
+--Register families*/
+ --Code for the GENREG register family
+Consts.arm64.GENREG = 0
+ --Code for the SSEREG register family
+Consts.arm64.SSEREG = 1
+ --Code for the SPCREG register family
+Consts.arm64.SPCREG = 2
+-- Identifiers of the processor variants for arm64 */
+Consts.arm64.arm64_PROC_NONE = 0  --No processor variant
+--Processor IDs for the Cortex A57 micro-architecture
+--No processor that I could find!
+Consts.arm64.arm64_PROC_CORTEX_A57_PROC0 = 1  --Cortex A57, processor variant 0
+--   arm64_PROC_CORTEX_A57_PROCX, /**< Cortex A57, processor variant X*/
+--Processor IDs for the Cortex XXX micro-architecture
+--   arm64_PROC_CORTEX_XXX_PROC0, /**< Cortex XXX, processor variant 0 */
+Consts.arm64.arm64_PROC_MAX = 2  --Max number of processors variants, must always be last
+-- Identifiers of the micro-architectures for arm64 */
+Consts.arm64.arm64_UARCH_NONE = 0 
+Consts.arm64.arm64_UARCH_CORTEX_A57 = 1  --Cortex A57 
+--   arm64_UARCH_CORTEX_XXX,  /**< Cortex XXX */
+Consts.arm64.arm64_UARCH_MAX = 2  --Max number of micro-architectures, must always be last
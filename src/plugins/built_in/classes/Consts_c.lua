@@ -0,0 +1,626 @@
+---
+--  Copyright (C) 2004 - 2018 Université de Versailles Saint-Quentin-en-Yvelines (UVSQ)
+--
+-- This file is part of MAQAO.
+--
+-- MAQAO is free software; you can redistribute it and/or
+--  modify it under the terms of the GNU Lesser General Public License
+--  as published by the Free Software Foundation; either version 3
+--  of the License, or (at your option) any later version.
+--
+--  This program is distributed in the hope that it will be useful,
+--  but WITHOUT ANY WARRANTY; without even the implied warranty of
+--  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+--  GNU Lesser General Public License for more details.
+--
+--  You should have received a copy of the GNU Lesser General Public License
+--  along with this program; if not, write to the Free Software
+--  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+--
+
+
+-- WARNING: This is a generated file. Do not modify it.
+-- If you want to add constants, update file 
+-- /root/repo/src/plugins/built_in/classes/Consts.lua
+
+
+Consts.MAQAO_VERSION = "2.5.9"
+
+Consts.MAQAO_BUILD = "f63e7b43587859648b1d5d4c23c996e01534987d::20261016-193044"
+
+Consts.MAQAO_DATE = "2026/10/16"
+
+Consts.MAQAO_COPYRIGHT = "MAQAO (C), 2004-2018 Universite de Versailles Saint-Quentin-en-Yvelines (UVSQ), \n"..
+                          "is distributed under the GNU Lesser General Public License (GNU LGPL). MAQAO is \n"..
+                          "free software; you can use it under the terms of the GNU Lesser General \n"..
+                          "Public License as published by the Free Software Foundation; either version 2.1 \n"..
+                          "of the License, or (at your option) any later version. This software is distributed \n"..
+                          "in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the \n"..
+                          "implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the \n"..
+                          "GNU Lesser General Public License for more details.\n"..
+                          "\n"..
+                          "The full legal text of the GNU Lesser General Public License (GNU LGPL) is available\n"..
+                          "at http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html."
+
+Consts.MAQAO_AUTHORS = "The MAQAO team"
+
+Consts.MAQAO_BUGREPORT = "support@maqao.org"
+--
+-- Definition of architectures
+-- Architectures codes should be obey the following naming convention:
+-- ARCH_<archname>, where <archname> is the name used for the architecture in its ISA description file
+--
+Consts.ARCH_NONE = 0  --No architecture
+Consts.ARCH_arm64 = 1  --ARM64
+Consts.ARCH_MAXCODES = 2  --Max number of architectures
+--Methods for handling the stack before inserting function calls*/
+
+Consts.STACK_KEEP = 0
+
+Consts.STACK_MOVE = 1
+
+Consts.STACK_SHIFT = 2
+ --Defaut name for the log file
+Consts.DFLT_TRACELOG = "madras_trace.log"
+ --An inserted function call will not be wrapped by instruction for saving/restoring the registers context
+Consts.PATCHOPT_FCTCALL_NOWRAP = 0x00000040
+ --Only a function code or stub will added to the file without any call site
+Consts.PATCHOPT_FCTCALL_FCTONLY = 0x00000080
+ --Inserted branch(es) pointing to an instruction is/are not updated if an insertion is performed before this instruction
+Consts.PATCHOPT_BRANCHINS_NO_UPD_DST = 0x00000100
+ --Allows to establish a correspondence between original addresses and those in the patched file
+Consts.PATCHOPT_TRACK_ADDRESSES = 0x00000200
+ --Code relocated due to modification must be moved at a fixed address
+Consts.PATCHOPT_MODIF_FIXED = 0x00000200
+ --The inserted library has no priority
+Consts.PATCHOPT_LIBFLAG_NO_PRIORITY = 0x00000000
+ --The inserted library has priority
+Consts.PATCHOPT_LIBFLAG_PRIORITY = 0x00000001
+--
+-- \enum condtypes
+-- Type of possible conditions to use
+--
+Consts.COND_NONE = 0  --No condition
+Consts.LOGICAL_AND = 1  --AND condition (to be used between conditions)
+Consts.LOGICAL_OR = 2  --OR condition (to be used between conditions)
+Consts.LAST_LOGICAL_CONDTYPE = 3  --Last logical condition (must NOT be used as a condition type)
+Consts.COMP_EQUAL = 4  --EQUAL condition (to be used between an operand and a value)
+Consts.COMP_NEQUAL = 5  --NOT EQUAL condition  (to be used between an operand and a value)
+Consts.COMP_LESS = 6  --LESS condition (to be used between an operand and a value)
+Consts.COMP_GREATER = 7  --MORE condition (to be used between an operand and a value)
+Consts.COMP_EQUALLESS = 8  --LESS or EQUAL condition (to be used between an operand and a value)
+Consts.COMP_EQUALGREATER = 9  --MORE or EQUAL condition (to be used between an operand and a value)
+ --Identifier of an erroneous or absent instruction set (instruction sets identifiers begin at 1 by design)
+Consts.ISET_NONE = 0
+ --Identifier of an erroneous or absent micro-architecture. DO NOT CHANGE TO OTHER VALUE THAN 0 (used for enums begins)
+Consts.UARCH_NONE = 0
+ --Identifier of an erroneous or absent processor version. DO NOT CHANGE TO OTHER VALUE THAN 0 (used for enums begins)
+Consts.PROC_NONE = 0
+--
+-- \enum classes_e
+-- Enumeration of classes
+--
+Consts.C_OTHER = 0  --Undefined class
+Consts.C_ARITH = 1  --Instruction performs arithmetic computations
+Consts.C_CONV = 2  --Instruction performs conversions
+Consts.C_CRYPTO = 3  --Instruction performs cryptographic computations
+Consts.C_CONTROL = 4  --Instruction performs control operations
+Consts.C_LOGIC = 5  --Instruction performs logic computations
+Consts.C_MATH = 6  --Instruction performs mathematics computations
+Consts.C_MOVE = 7  --Instruction performs memory operations
+Consts.C_APP_SPECIFIC = 8  --Instruction performs application specifics operations
+--
+-- \enum fam_flags_e
+-- Enumeration of flags
+--
+Consts.FL_NONE = 0  --Instruction has no family flag
+Consts.FL_COND = 1  --Instruction always operates under conditions
+Consts.FL_MASK = 2  --Instruction operates under a mask
+--
+-- Enumeration of families, classes and flags
+--
+
+Consts.FM_UNDEF = 0x0000
+
+Consts.FM_ABS = 0x1001
+
+Consts.FM_ADD = 0x1002
+
+Consts.FM_AND = 0x5003
+
+Consts.FM_ATAN = 0x6004
+
+Consts.FM_AVG = 0x1005
+
+Consts.FM_BROADCAST = 0x7006
+
+Consts.FM_BSWAP = 0x7007
+
+Consts.FM_CALL = 0x4008
+
+Consts.FM_CLR = 0x0009
+
+Consts.FM_CMP = 0x100A
+
+Consts.FM_CVT = 0x200B
+
+Consts.FM_COS = 0x600C
+
+Consts.FM_CNT = 0x500D
+
+Consts.FM_CRYPTO = 0x800E
+
+Consts.FM_DEC = 0x100F
+
+Consts.FM_DIV = 0x1010
+
+Consts.FM_DSP = 0x8011
+
+Consts.FM_ENV = 0x4012
+
+Consts.FM_EXP = 0x6013
+
+Consts.FM_FMA = 0x1014
+
+Consts.FM_FMS = 0x1015
+
+Consts.FM_GATHER = 0x7016
+
+Consts.FM_HASH = 0x8017
+
+Consts.FM_HW = 0x4018
+
+Consts.FM_IN = 0x7019
+
+Consts.FM_INC = 0x101A
+
+Consts.FM_INFO = 0x001B
+
+Consts.FM_JUMP = 0x401C
+
+Consts.FM_CJUMP = 0x411C
+
+Consts.FM_LEA = 0x101D
+
+Consts.FM_LOAD = 0x701E
+
+Consts.FM_LOCK = 0x001F
+
+Consts.FM_LOG = 0x6020
+
+Consts.FM_LOOP = 0x4021
+
+Consts.FM_MASK = 0x0022
+
+Consts.FM_MAX = 0x1023
+
+Consts.FM_MERGE = 0x7024
+
+Consts.FM_MIN = 0x1025
+
+Consts.FM_MOV = 0x7026
+
+Consts.FM_CMOV = 0x7126
+
+Consts.FM_MMOV = 0x7226
+
+Consts.FM_MUL = 0x1027
+
+Consts.FM_NEG = 0x5028
+
+Consts.FM_NOP = 0x0029
+
+Consts.FM_NOT = 0x502A
+
+Consts.FM_OR = 0x502B
+
+Consts.FM_OS = 0x402C
+
+Consts.FM_OTHER_APP_SPECIFIC = 0x802D
+
+Consts.FM_OTHER_ARITH = 0x102E
+
+Consts.FM_OTHER_CONTROL = 0x402F
+
+Consts.FM_OTHER_LOGIC = 0x5030
+
+Consts.FM_OTHER_MATH = 0x6031
+
+Consts.FM_OUT = 0x7032
+
+Consts.FM_PACK = 0x7033
+
+Consts.FM_POP = 0x7034
+
+Consts.FM_PREFETCH = 0x0035
+
+Consts.FM_PUSH = 0x7036
+
+Consts.FM_RAND = 0x8037
+
+Consts.FM_RCP = 0x1038
+
+Consts.FM_REM = 0x1039
+
+Consts.FM_RET = 0x403A
+
+Consts.FM_ROT = 0x503B
+
+Consts.FM_RND = 0x103C
+
+Consts.FM_RSQRT = 0x603D
+
+Consts.FM_SCAN = 0x503E
+
+Consts.FM_SCATTER = 0x703F
+
+Consts.FM_SET = 0x7040
+
+Consts.FM_SHIFT = 0x5041
+
+Consts.FM_SHUFFLE = 0x7042
+
+Consts.FM_SIN = 0x6043
+
+Consts.FM_SQRT = 0x6044
+
+Consts.FM_STACK_INIT = 0x4045
+
+Consts.FM_STACK_RELEASE = 0x4046
+
+Consts.FM_STACK_ROT = 0x4047
+
+Consts.FM_STORE = 0x7048
+
+Consts.FM_SUB = 0x1049
+
+Consts.FM_SYNC = 0x404A
+
+Consts.FM_TAN = 0x604B
+
+Consts.FM_TM = 0x404C
+
+Consts.FM_UNPACK = 0x704D
+
+Consts.FM_VIRT = 0x404E
+
+Consts.FM_XCHG = 0x704F
+
+Consts.FM_XOR = 0x5050
+--
+-- Simd flag
+--
+
+Consts.S_NO = 0
+
+Consts.S_YES = 1
+--
+-- \def T_MASK
+-- Mask used to access the type in ::insn_s::elt_in and ::insn_s::elt_out fields
+--
+
+Consts.T_MASK = 0xF0
+--
+-- \enum elt_types_e
+-- Enumeration of element's types
+--
+Consts.T_UNDEF = 0  --Undefined elements' type
+Consts.T_BIT = 1  --Elements are bits
+Consts.T_INT = 2  --Elements are integers
+Consts.T_UINT = 3  --Elements are unsigned integers
+Consts.T_SINT = 4  --Elements are signed integers
+Consts.T_FP = 5  --Elements are floating-points
+Consts.T_POL = 6  --Elements are 'polynomials'
+Consts.T_BCD = 7  --Elements are Binary Coded Decimal
+Consts.T_STR = 8  --Elements are strings
+--
+-- \def T_MAKS
+-- Mask used to access the size in ::insn_s::elt_in and ::insn_s::elt_out fields
+--
+
+Consts.SZ_MASK = 0x0F
+--
+-- \enum elt_sizes_e
+-- Enumeration of element's sizes
+--
+Consts.SZ_UNDEF = 0  --Undefined elements' size
+Consts.SZ_8 = 1  --Elements are 8 bits long
+Consts.SZ_16 = 2  --Elements are 16 bits long
+Consts.SZ_32 = 3  --Elements are 32 bits long
+Consts.SZ_64 = 4  --Elements are 64 bits long
+Consts.SZ_80 = 5  --Elements are 80 bits long
+Consts.SZ_128 = 6  --Elements are 128 bits long
+Consts.SZ_256 = 7  --Elements are 256 bits long
+Consts.SZ_512 = 8  --Elements are 512 bits long
+--
+-- Languages supported by the demangling library. These macros can represent
+-- several DW_LANG_ macros
+--
+ --Unknown language
+Consts.LANG_ERR = 0
+ --C language
+Consts.LANG_C = 1
+ --C++ language
+Consts.LANG_CPP = 2
+ --Fortran language
+Consts.LANG_FORTRAN = 3
+--
+-- Compilers supported by the demangling library. A macro is a compiler family
+-- (for example, all Intel compilers (icc, icpc, ifort ...) have the same family)
+--
+ --Unknown compiler
+Consts.COMP_ERR = 0
+ --GNU compilers (gcc, gfortran, g++ ...)
+Consts.COMP_GNU = 1
+ --Intel compilers (icc, icpc, ifort ...)
+Consts.COMP_INTEL = 2
+--
+-- Suffix of external labels
+-- \todo Use a non ELF-specific name
+--
+
+Consts.EXT_LBL_SUF = "@plt"
+--
+-- Comma separated list of function names that do not return the control flow after their call
+-- These functions have to be handled as a RET for the purpose of building the graph
+-- Names should not include a suffix for external labels
+-- \warning Make sure to add there only unambiguous names!
+-- */
+--#define DEFAULT_EXIT_FUNCTIONS_NAMES "exit", "__assert_fail", "abort"
+--**
+-- Values for project cc_mode member
+-- Define how functions are extracted from connected components (CCs)
+--
+ --Do not extract functions from CCs
+Consts.CCMODE_OFF = 0
+ --Extract only functions whose get debug data
+Consts.CCMODE_DEBUG = 1
+ --Extract all functions from CCs
+Consts.CCMODE_ALL = 2
+--
+-- \enum data_sizes
+-- Code for the different types of data sizes
+-- The values in the enum must appear in the same relative order as the order
+-- of the sizes they represent
+--
+Consts.DATASZ_UNDEF = 0  --Size is not defined
+Consts.DATASZ_1b = 1  --Size is 1 bit
+Consts.DATASZ_2b = 2  --Size is 2 bits
+Consts.DATASZ_3b = 3  --Size is 3 bits
+Consts.DATASZ_4b = 4  --Size is 4 bits
+Consts.DATASZ_5b = 5  --Size is 5 bits
+Consts.DATASZ_6b = 6  --Size is 6 bits
+Consts.DATASZ_7b = 7  --Size is 7 bits
+Consts.DATASZ_8b = 8  --Size is 8 bits (1 Byte)
+Consts.DATASZ_9b = 9  --Size is 9 bits
+Consts.DATASZ_10b = 10  --Size is 10 bits
+Consts.DATASZ_11b = 11  --Size is 11 bits
+Consts.DATASZ_12b = 12  --Size is 12 bits
+Consts.DATASZ_13b = 13  --Size is 13 bits
+Consts.DATASZ_14b = 14  --Size is 14 bits
+Consts.DATASZ_16b = 15  --Size is 16 bits (2 Bytes)
+Consts.DATASZ_20b = 16  --Size is 20 bits
+Consts.DATASZ_21b = 17  --Size is 21 bits
+Consts.DATASZ_23b = 18  --Size is 23 bits
+Consts.DATASZ_24b = 19  --Size is 24 bits (3 Bytes)
+Consts.DATASZ_25b = 20  --Size is 25 bits
+Consts.DATASZ_26b = 21  --Size is 26 bits
+Consts.DATASZ_28b = 22  --Size is 28 bits
+Consts.DATASZ_32b = 23  --Size is 32 bits (4 Bytes)
+Consts.DATASZ_64b = 24  --Size is 64 bits (8 Bytes)
+Consts.DATASZ_80b = 25  --Size is 80 bits (10 Bytes)
+Consts.DATASZ_112b = 26  --Size is 112 bits (14 Bytes)
+Consts.DATASZ_128b = 27  --Size is 128 bits (16 Bytes)
+Consts.DATASZ_224b = 28  --Size is 224 bits (28 Bytes)
+Consts.DATASZ_256b = 29  --Size is 256 bits (32 Bytes)
+Consts.DATASZ_512b = 30  --Size is 512 bits (64 Bytes)
+Consts.DATASZ_672b = 31  --Size is 672 bits (94 Bytes)
+Consts.DATASZ_864b = 32  --Size is 864 bits (108 Bytes)
+Consts.DATASZ_4096b = 33  --Size is 4096 bits (512 Bytes)
+Consts.DATASZ_MAX = 34  --Maximal representable size
+--
+-- \enum memalign_e
+-- Enumeration of flags representing the alignment value of a memory operand
+--
+Consts.M_NO_ALIGN = 0 
+Consts.M_ALIGN_16 = 1 
+Consts.M_ALIGN_32 = 2 
+Consts.M_ALIGN_64 = 3 
+Consts.M_ALIGN_128 = 4 
+Consts.M_ALIGN_256 = 5 
+
+Consts.M_POSITIVE_SIGN = 0x0
+
+Consts.M_NEGATIVE_SIGN = 0x1
+--
+-- \enum oprnd_type_e
+-- Codes indicating the type of a oprnd
+--
+Consts.OT_REGISTER = 0  --oprnd is a register
+Consts.OT_MEMORY = 1  --oprnd is a memory address
+Consts.OT_IMMEDIATE = 2  --oprnd is an immediate value
+Consts.OT_POINTER = 3  --oprnd is a pointer to another instruction
+Consts.OT_MEMORY_RELATIVE = 4  --oprnd is a memory address referencing an address in the file
+Consts.OT_IMMEDIATE_ADDRESS = 5  --oprnd is an immediate value representing an address
+Consts.OT_REGISTER_INDEXED = 6  --oprnd is an element inside a register
+Consts.OT_UNKNOWN = 7  --Max number of operand types, also used to indicate an erroneous operand type
+ --Name of the operand type register
+Consts.OT_NAME_REGISTER = "register"
+ --Name of the operand type indexed register
+Consts.OT_NAME_REGISTER_INDEXED = "indexed register"
+ --Name of the operand type memory
+Consts.OT_NAME_MEMORY = "memory"
+ --Name of the operand type relative memory
+Consts.OT_NAME_MEMORY_RELATIVE = "relative memory"
+ --Name of the operand type immediate
+Consts.OT_NAME_IMMEDIATE = "immediate"
+ --Name of the operand type immediate address
+Consts.OT_NAME_IMMEDIATE_ADDRESS = "immediate address"
+ --Name of the operand type pointer
+Consts.OT_NAME_POINTER = "pointer"
+--
+-- \enum grouping_format_type
+-- Defines available formats when groups are displayed
+--
+Consts.GROUPING_FORMAT_LINE = 0  --One group per line, default mode
+Consts.GROUPING_FORMAT_CSV = 1  --Based on LINE format but respecting CSV format
+Consts.GROUPING_FORMAT_TEXT = 2  --Readable format
+Consts.GROUPING_FORMAT_CM = 3  --Special
+Consts.GROUPING_FORMAT_PCR = 4  --Special
+--
+-- \enum params_modules_id_e
+-- Defines available values for module parameters
+--
+Consts.PARAM_MODULE_DEBUG = 0  --Options about debug data handling
+Consts.PARAM_MODULE_DISASS = 1  --Options about disassembly
+Consts.PARAM_MODULE_LCORE = 2 
+Consts.PARAM_MODULE_BINARY = 3  --Options about handling binary files
+Consts._NB_PARAM_MODULE = 4  --Keep this element at the end
+-- Defines the maximal number of parameters for a module
+
+Consts._NB_OPT_BY_MODULE = 64
+--
+-- \enum params_DEBUG_id_e
+-- Defines available values for DEBUG module parameters
+--
+Consts.PARAM_DEBUG_DISABLE_DEBUG = 0  --Select if debug data must be loaded or not (boolean)
+Consts.PARAM_DEBUG_ENABLE_VARS = 1  --Select if debug vars must be loaded or not (boolean)
+Consts.PARAM_DEBUG_LAZY_DWARF = 2  --Select if DWARF compilation units must be parsed on demand (boolean)
+Consts.PARAM_DEBUG_NB_THREADS = 3  --Number of threads used to parse DWARF compilation units (integer, negative for one per processor)
+Consts._NB_PARAM_DEBUG = 4  --Keep this element at the end
+--
+-- \enum params_DISASS_id_e
+-- Defines available values for DISASS module parameters
+--
+Consts.PARAM_DISASS_OPTIONS = 0  --Mask of options for disassembly. Use values from DISASS_OPTIONS_* defines
+Consts.PARAM_DISASS_NB_THREADS = 1  --Number of threads used to decode code sections (integer, negative for one per processor)
+Consts._NB_PARAM_DISASS = 2  --Keep this element at the end
+--
+-- \enum params_LCORE_id_e
+-- Defines available values for libcore module parameters
+--
+Consts.PARAM_LCORE_FLOW_ANALYZE_ALL_SCNS = 0  --Select if all executable sections must be analyzed during flow analysis
+Consts.PARAM_LCORE_NB_THREADS = 1  --Number of threads used to analyze functions (integer, negative for one per processor)
+Consts.PARAM_LCORE_CACHE_DIR = 2  --Directory where flow, loop and connected components analyses results are cached (string, NULL to disable)
+Consts._NB_PARAM_LCORE = 3  --Keep this element at the end
+--
+-- \enum params_BINARY_id_e
+-- Defines available values for BINARY module parameters
+--
+Consts.PARAM_BINPRINT_OPTIONS = 0  --Mask of options for printing a binary file. Use values from BINPRINT_OPTIONS_* defines
+Consts._NB_PARAM_BINARY = 1  --Keep this element at the end
+--Options to use as masks in disassembly*/
+ --Default option, corresponds to a full disassembly
+Consts.DISASS_OPTIONS_FULLDISASS = 0x00
+ --Option for disabling disassembly (only binary parsing will be done)
+Consts.DISASS_OPTIONS_NODISASS = 0x01
+ --Option for disabling parsing of data sections
+Consts.DISASS_OPTIONS_NODATAPARSE = 0x02
+ --Option for checking instructions decoded in parallel or from the decoding cache against the FSM
+Consts.DISASS_OPTIONS_CHECKDECODING = 0x04
+ --Option for decoding repeated instruction codings of fixed-width architectures from a cache of the FSM results
+Consts.DISASS_OPTIONS_DECODECACHE = 0x08
+ --Option for allocating instructions and operands individually instead of in the arena of the file
+Consts.DISASS_OPTIONS_NOARENA = 0x10
+--\todo TODO (2015-03-09) BUG! Some of those names are also defined in libmdisass.h, and with different values. This leads to the
+-- disassembly to ignore some options. Choose one header where to define those and stick to it
+-- => (2015-05-29) Has been fixed*/
+--/Options to use as masks for printing the contents of a parsed binary file
+--#define BINPRINT_OPTIONS_NOPRINT 0x00  // Does not print anything (defined mainly for coherence)
+--#define BINPRINT_OPTIONS_HDR     0x01  // Prints the header of the file
+--#define BINPRINT_OPTIONS_SCNHDR  0x02  // Prints the sections header
+--#define BINPRINT_OPTIONS_SEGHDR  0x04  // Prints the segments header, if the binary format support segments
+--#define BINPRINT_OPTIONS_DYN     0x08  // Prints the dynamic informations for the file
+--#define BINPRINT_OPTIONS_REL     0x10  // Prints the relocation informations for the file
+--#define BINPRINT_OPTIONS_SYM     0x20  // Prints the symbols from the file
+--#define BINPRINT_OPTIONS_VER     0x40  // Prints version information for the file
+--#define BINPRINT_OPTIONS_ALL     0xff  // Prints all informations for the file (if the number of options increases above 8, update accordingly to always be 0xfff...)
+--**
+-- Defines identifiers for all the fields potentially associated with an assembly instruction
+-- */
+--typedef enum insn_fields_e {
+--INSNF_FULL_ASSEMBLY = 0, /**<Full assembly representation of the instruction*/
+--INSNF_ADDRESS, /**<Address of the instruction*/
+--INSNF_ANNOTATE, /**<Annotate of the instruction*/
+--INSNF_ARCH, /**<Architecture of the instruction*/
+--INSNF_BLOCK_ID, /**<Block id of the instruction*/
+--INSNF_CODING, /**<Binary coding of the instruction*/
+--INSNF_DBG_SRCFILE, /**<Source file of the instruction*/
+--INSNF_DBG_SRCLINE, /**<Source line of the instruction*/
+--INSNF_ELT_IN, /**<Size of input elements of the instruction*/
+--INSNF_ELT_OUT, /**<Size of output elements of the instruction*/
+--INSNF_FCTLBL, /**<Label of the instruction*/
+--INSNF_LOOP_ID, /**<Loop identifier of the instruction*/
+--INSNF_NB_OPRND, /**<Number of operands of the instruction*/
+--INSNF_OPCODE, /**<Opcode of the instruction*/
+--INSNF_MAX /**<Maximum number of fields, must always be last*/
+--} insn_fields_t;
+--**
+-- Defines identifiers for all the fields potentially associated with an assembly label
+-- */
+--typedef enum label_fields_e {
+--LBLF_NAME = 0, /**<Name of the label*/
+--LBLF_ADDRESS, /**<Address of the label*/
+--LBLF_MAX /**<Maximum number of fields, must always be last*/
+--} label_fields_t;
+--**
+-- Defines identifiers for all the fields potentially associated with an assembly block
+-- */
+--typedef enum block_fields_e {
+--BLOCKF_GLOBAL_ID = 0, /**<Block global id*/
+--BLOCKF_ID, /**<Block id*/
+--BLOCKF_FIRST_INSN_ADDR, /**<Address of the first instruction in the block*/
+--BLOCKF_LAST_INSN_ADDR, /**<Address of the last instruction in the block*/
+--BLOCKF_FUNCTION_NAME, /**<Name of the function to which the block belongs*/
+--BLOCKF_IS_LOOP_EXIT, /**<Specifies whether the block is an exit for the loop to which it belongs*/
+--BLOCKF_IS_PADDING, /**<Specifies whether the block is a padding block*/
+--BLOCKF_LOOP_ID, /**<Identifier of the loop to which the block belongs*/
+--BLOCKF_MAX /**<Maximum number of fields, must always be last*/
+--} block_fields_t;
+--**
+-- Defines identifiers for all the fields potentially associated with an assembly loop
+-- */
+--typedef enum loop_fields_e {
+--LOOPF_GLOBAL_ID = 0, /**<Loop global id*/
+--LOOPF_ID, /**<Loop id*/
+--LOOPF_FUNCTION_NAME, /**<Name of the function to which the loop belongs*/
+--LOOPF_BLOCKS, /**<List of blocks presents in the loop*/
+--LOOPF_MAX /**<Maximum number of fields, must always be last*/
+--} loop_fields_t;
+--**
+-- Defines identifiers for all the fields potentially associated with an assembly function
+-- */
+--typedef enum fct_fields_e {
+--FCTF_GLOBAL_ID = 0, /**<Function global id*/
+--FCTF_ID, /**<Function id*/
+--FCTF_FIRST_INSN_ADDR, /**<Address of the first instruction in the function*/
+--FCTF_LAST_INSN_ADDR, /**<Address of the last instruction in the function*/
+--FCTF_NAME, /**<Name of the function*/
+--FCTF_MAX /**<Maximum number of fields, must always be last*/
+--} fct_fields_t;
+--**
+-- Defines identifiers for all the fields potentially associated with an architecture
+-- */
+--typedef enum arch_fields_e {
+--ARCHF_NAME = 0, /**<Name of the architecture*/
+--ARCHF_MAX /**<Maximum number of fields, must always be last*/
+--} arch_fields_t;
+--**
+-- Defines identifiers for all the fields potentially associated with a formatted text file
+-- */
+--typedef enum file_fields_e {
+--TXTFILEF_BLOCKID_SCOPE = 0,/**<Specifies whether the scope over which block identifiers are unique (file, function, loop)*/
+--TXTFILEF_MAX /**<Maximum number of fields, must always be last*/
+--} file_fields_t;
+--**
+--	Enumeration of different kind of registers
+--
+Consts.DWARF_REG = 0  --The value is directly in a register
+Consts.DWARF_BREG = 1  --The value is at the address contained in reg + offset
+Consts.DWARF_FBREG = 2  --The value is at the address contained in reg + offset
+Consts.DWARF_ADDR = 3  --The value is at a fixed address
+Consts.DWARF_BREGX, DWARF_NONE, DWARF_FBREG_TBRES = 4 
+ --Flag indicating that the variable belongs to IN set
+Consts.IN_FLAG = 1
+ --Flag indicating that the variable belongs to OUT set
+Consts.OUT_FLAG = 2
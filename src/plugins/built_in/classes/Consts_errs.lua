@@ -0,0 +1,248 @@
+---
+--  Copyright (C) 2004 - 2018 Université de Versailles Saint-Quentin-en-Yvelines (UVSQ)
+--
+-- This file is part of MAQAO.
+--
+-- MAQAO is free software; you can redistribute it and/or
+--  modify it under the terms of the GNU Lesser General Public License
+--  as published by the Free Software Foundation; either version 3
+--  of the License, or (at your option) any later version.
+--
+--  This program is distributed in the hope that it will be useful,
+--  but WITHOUT ANY WARRANTY; without even the implied warranty of
+--  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+--  GNU Lesser General Public License for more details.
+--
+--  You should have received a copy of the GNU Lesser General Public License
+--  along with this program; if not, write to the Free Software
+--  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+--
+
+
+-- WARNING: This is a generated file. Do not modify it.
+-- If you want to add constants, update file 
+-- /root/repo/src/maqaoerrs.h
+
+
+Consts.errors = {}
+Consts.errors.ERRLVL_NONE	= 0x0
+Consts.errors.ERRLVL_NFO	= 0x1
+Consts.errors.ERRLVL_WRN	= 0x2
+Consts.errors.ERRLVL_ERR	= 0x3
+Consts.errors.ERRLVL_CRI	= 0x4
+Consts.errors.ERRLVL_MAX	= 0xf
+
+Consts.errors.MODULE_NONE	= 0x0
+Consts.errors.MODULE_COMMON	= 0x1
+Consts.errors.MODULE_LIBASM	= 0x2
+Consts.errors.MODULE_BINARY	= 0x3
+Consts.errors.MODULE_DISASS	= 0x4
+Consts.errors.MODULE_ANALYZE	= 0x5
+Consts.errors.MODULE_PATCH	= 0x6
+Consts.errors.MODULE_MADRAS	= 0x7
+Consts.errors.MODULE_MAQAO	= 0x8
+Consts.errors.MODULE_DECAN	= 0x9
+Consts.errors.MODULE_ASMBL	= 0xa
+Consts.errors.MODULE_LUAEXE	= 0xb
+Consts.errors.MODULE_CQA	= 0x20
+Consts.errors.MODULE_UBENCH	= 0x21
+Consts.errors.MODULE_MAX	= 0xff
+
+
+Consts.errors.CRI_COMMON_UNABLE_TO_ALLOCATE_MEMORY		= 0x1040001		-- Unable to allocate memory
+Consts.errors.ERR_COMMON_FILE_NOT_FOUND		= 0x1030001		-- Unable to find requested file
+Consts.errors.ERR_COMMON_FILE_INVALID		= 0x1030002		-- File is invalid
+Consts.errors.ERR_COMMON_FILE_NAME_MISSING		= 0x1030003		-- File name is missing
+Consts.errors.ERR_COMMON_PARAMETER_MISSING		= 0x1030004		-- A required parameter is NULL
+Consts.errors.ERR_COMMON_UNABLE_TO_OPEN_FILE		= 0x1030005		-- Unable to open file
+Consts.errors.ERR_COMMON_PARAMETER_INVALID		= 0x1030006		-- A parameter is invalid
+Consts.errors.ERR_COMMON_FILE_STREAM_MISSING		= 0x1030007		-- File stream missing
+Consts.errors.ERR_COMMON_UNABLE_TO_READ_FILE		= 0x1030008		-- Unable to read file
+Consts.errors.ERR_COMMON_NUMERICAL_BASE_NOT_SUPPORTED		= 0x1030010		-- Base not supported
+Consts.errors.ERR_COMMON_INTEGER_SIZE_INCORRECT		= 0x1030011		-- Size of integer not supported
+Consts.errors.ERR_COMMON_UNEXPECTED_CHARACTER		= 0x1030012		-- Unexpected character
+Consts.errors.ERR_COMMON_TXTFILE_COMMENT_END_NOT_FOUND		= 0x1030020		-- Comment ending tag not found
+Consts.errors.ERR_COMMON_TXTFILE_TAG_END_NOT_FOUND		= 0x1030021		-- Ending tag not found
+Consts.errors.ERR_COMMON_TXTFILE_PROPERTIES_MUTUALLY_EXCLUSIVE		= 0x1030022		-- Mutually exclusive properties
+Consts.errors.ERR_COMMON_TXTFILE_HEADER_EMPTY		= 0x1030023		-- Header empty
+Consts.errors.ERR_COMMON_TXTFILE_HEADER_END_NOT_FOUND		= 0x1030024		-- End of header not found
+Consts.errors.ERR_COMMON_TXTFILE_SECTION_DUPLICATED		= 0x1030025		-- Section duplicated
+Consts.errors.ERR_COMMON_TXTFILE_SECTION_EMPTY		= 0x1030026		-- Section empty
+Consts.errors.ERR_COMMON_TXTFILE_SECTION_END_NOT_FOUND		= 0x1030027		-- End section not found
+Consts.errors.ERR_COMMON_TXTFILE_SECTION_TOO_MANY_FIELDS		= 0x1030028		-- Section has too many fields
+Consts.errors.ERR_COMMON_TXTFILE_SECTION_PROPERTY_UNKNOWN		= 0x1030029		-- Unknown property for section
+Consts.errors.ERR_COMMON_TXTFILE_SECTION_TYPE_UNKNOWN		= 0x1030030		-- Type of section unknonwn
+Consts.errors.ERR_COMMON_TXTFILE_BODY_END_LINE_NOT_FOUND		= 0x1030031		-- End of body not found
+Consts.errors.ERR_COMMON_TXTFILE_BODY_DEFINITION_NOT_FOUND		= 0x1030032		-- Body definition not found
+Consts.errors.ERR_COMMON_TXTFILE_FIELD_ALIGNMENT_NOT_RESPECTED		= 0x1030033		-- Field alignment not respected
+Consts.errors.ERR_COMMON_TXTFILE_FIELD_NAME_DUPLICATED		= 0x1030034		-- Field name duplicated
+Consts.errors.ERR_COMMON_TXTFILE_FIELD_ENDING_NOT_FOUND		= 0x1030035		-- Field ending not found
+Consts.errors.ERR_COMMON_TXTFILE_FIELD_PARSING_ERROR		= 0x1030036		-- Field parsing error
+Consts.errors.ERR_COMMON_TXTFILE_FIELD_SEPARATOR_NOT_FOUND		= 0x1030037		-- Field separator not found
+Consts.errors.ERR_COMMON_TXTFILE_FIELD_PREFIX_NOT_FOUND		= 0x1030038		-- Field prefix not found
+Consts.errors.ERR_COMMON_TXTFILE_FIELD_UNAUTHORISED		= 0x1030039		-- Field not authorised
+Consts.errors.ERR_COMMON_TXTFILE_FIELD_NAME_UNKNOWN		= 0x1030040		-- Field name unknown
+Consts.errors.ERR_COMMON_TXTFILE_FIELD_IDENTIFIER_UNKNOWN		= 0x1030041		-- Field declaration identifier unknown
+Consts.errors.ERR_COMMON_TXTFILE_OPTIONAL_FIELDS_CONFUSION		= 0x1030042		-- Optional fields can't be distinguished
+Consts.errors.ERR_COMMON_TXTFILE_NOT_PARSED		= 0x1030050		-- Text file has not been parsed
+Consts.errors.ERR_COMMON_TXTFILE_FIELD_NAME_MISSING		= 0x1030060		-- Missing field name
+Consts.errors.ERR_COMMON_TXTFILE_MISSING_MANDATORY_FIELD		= 0x1030061		-- Mandatory field missing
+Consts.errors.WRN_COMMON_TXTFILE_HEADER_COMPLETED		= 0x1020010		-- Header completed
+Consts.errors.WRN_COMMON_TXTFILE_NO_SECTIONS_REMAINING		= 0x1020011		-- No section remaining
+Consts.errors.WRN_COMMON_TXTFILE_IGNORING_CHARACTERS		= 0x1020012		-- Ignoring characters
+Consts.errors.ERR_LIBASM_MISSING_ASMFILE		= 0x2030001		-- Missing asmfile
+Consts.errors.ERR_LIBASM_ARCH_MISSING		= 0x2030002		-- Missing architecture
+Consts.errors.ERR_LIBASM_ARCH_UNKNOWN		= 0x2030003		-- Unknown architecture
+Consts.errors.ERR_LIBASM_ADDRESS_INVALID		= 0x2030004		-- Invalid address
+Consts.errors.ERR_LIBASM_MISSING_PROJECT		= 0x2030005		-- Missing project
+Consts.errors.ERR_LIBASM_UARCH_NAME_INVALID		= 0x2030006		-- Invalid micro-architecture name
+Consts.errors.ERR_LIBASM_PROC_NAME_INVALID		= 0x2030007		-- Invalid processor version name
+Consts.errors.ERR_LIBASM_INSTRUCTION_NOT_FOUND		= 0x2030010		-- Instruction not found
+Consts.errors.ERR_LIBASM_INSTRUCTION_NOT_BRANCH		= 0x2030011		-- Instruction is not a branch
+Consts.errors.ERR_LIBASM_INSTRUCTION_MISSING		= 0x2030012		-- Missing instruction
+Consts.errors.ERR_LIBASM_INSTRUCTION_NOT_PARSED		= 0x2030013		-- Instruction could not be parsed
+Consts.errors.ERR_LIBASM_OPERAND_NOT_FOUND		= 0x2030020		-- Operand not found
+Consts.errors.ERR_LIBASM_OPERAND_MISSING		= 0x2030021		-- Missing operand
+Consts.errors.ERR_LIBASM_OPERAND_NOT_REGISTER		= 0x2030022		-- Operand is not a register
+Consts.errors.ERR_LIBASM_OPERAND_NOT_MEMORY		= 0x2030023		-- Operand is not a memory address
+Consts.errors.ERR_LIBASM_OPERAND_NOT_IMMEDIATE		= 0x2030024		-- Operand is not an immediate value
+Consts.errors.ERR_LIBASM_OPERAND_NOT_POINTER		= 0x2030025		-- Operand is not a pointer
+Consts.errors.ERR_LIBASM_OPERAND_NOT_PARSED		= 0x2030026		-- Operand could not be parsed
+Consts.errors.ERR_LIBASM_OPERAND_NOT_CREATED		= 0x2030027		-- Operand could not be created
+Consts.errors.ERR_LIBASM_FUNCTION_NOT_FOUND		= 0x2030030		-- Function not found
+Consts.errors.ERR_LIBASM_INCORRECT_DATA_TYPE		= 0x2030040		-- Incorrect data type
+Consts.errors.ERR_LIBASM_DATA_MISSING		= 0x2030041		-- Missing data
+Consts.errors.ERR_LIBASM_ERROR_RETRIEVING_DATA_BYTES		= 0x2030042		-- Unable to retrieve the bytes of a data entry
+Consts.errors.ERR_LIBASM_LABEL_MISSING		= 0x2030050		-- Label missing
+Consts.errors.WRN_LIBASM_NO_DEBUG_DATA		= 0x2020001		-- File has no debug information
+Consts.errors.WRN_LIBASM_BRANCH_OPPOSITE_COND		= 0x2020010		-- Opposite of the branch instruction is conditional
+Consts.errors.WRN_LIBASM_BRANCH_HAS_NO_OPPOSITE		= 0x2020011		-- Branch instruction has no opposite
+Consts.errors.ERR_BINARY_FORMAT_NOT_RECOGNIZED		= 0x3030001		-- Binary format not recognised or not supported
+Consts.errors.ERR_BINARY_MISSING_BINFILE		= 0x3030002		-- Missing structure representing the binary file
+Consts.errors.ERR_BINARY_HEADER_NOT_FOUND		= 0x3030003		-- Binary file header not found
+Consts.errors.ERR_BINARY_ARCHIVE_PARSING_ERROR		= 0x3030004		-- Error when parsing archive file
+Consts.errors.ERR_BINARY_UNKNOWN_FILE_TYPE		= 0x3030005		-- Unknown file type for this binary format
+Consts.errors.ERR_BINARY_FILE_ALREADY_PARSED		= 0x3030006		-- Binary file has already been parsed
+Consts.errors.ERR_BINARY_NO_EXTFCTS_SECTION		= 0x3030007		-- No section for external functions found
+Consts.errors.ERR_BINARY_NO_EXTLIBS		= 0x3030008		-- File has no external libraries
+Consts.errors.ERR_BINARY_NO_SECTIONS_FOUND		= 0x3030009		-- File has no sections
+Consts.errors.ERR_BINARY_SECTION_EMPTY		= 0x303000a		-- Section is empty
+Consts.errors.ERR_BINARY_SECTION_NOT_FOUND		= 0x303000b		-- Section was not found
+Consts.errors.ERR_BINARY_LIBRARY_TYPE_UNDEFINED		= 0x303000c		-- Library has an undefined type
+Consts.errors.ERR_BINARY_NO_SYMBOL_SECTION		= 0x303000d		-- No section for symbols found
+Consts.errors.ERR_BINARY_MISSING_SECTION		= 0x303000e		-- Missing structure representing a section
+Consts.errors.ERR_BINARY_BAD_SECTION_TYPE		= 0x303000f		-- Section had an incorrect type for the required operation
+Consts.errors.ERR_BINARY_BAD_SECTION_ENTRYSZ		= 0x3030010		-- Section had an incorrect entry size
+Consts.errors.ERR_BINARY_HEADER_ALREADY_PARSED		= 0x3030011		-- Header was already parsed
+Consts.errors.ERR_BINARY_SECTION_SEGMENT_NOT_FOUND		= 0x3030012		-- The section could not be associated to a segment
+Consts.errors.ERR_BINARY_UNEXPECTED_FILE_FORMAT		= 0x3030013		-- Unexpected file format
+Consts.errors.ERR_BINARY_NO_STRING_SECTION		= 0x3030014		-- No section containing strings found
+Consts.errors.ERR_BINARY_MISSING_SEGMENT		= 0x3030015		-- Missing structure representing a segment
+Consts.errors.ERR_BINARY_SYMBOL_NOT_FOUND		= 0x3030020		-- Symbol was not found
+Consts.errors.ERR_BINARY_EXTFCT_NOT_FOUND		= 0x3030021		-- External function not found
+Consts.errors.ERR_BINARY_TARGET_ADDRESS_NOT_FOUND		= 0x3030022		-- Targeted address not found in the file
+Consts.errors.ERR_BINARY_EXTLIB_NOT_FOUND		= 0x3030023		-- External library not found
+Consts.errors.ERR_BINARY_SECTIONS_NOT_REORDERED		= 0x3030030		-- Unable to reorder the sections in the binary file
+Consts.errors.ERR_BINARY_FILE_NOT_BEING_PATCHED		= 0x3030031		-- Binary file is not in the process of being patched
+Consts.errors.ERR_BINARY_SECTION_DATA_NOT_LOCAL		= 0x3030032		-- Data in the section not allocated locally
+Consts.errors.ERR_BINARY_FAILED_SAVING_DATA_TO_SECTION		= 0x3030033		-- Data entry could not be saved to section
+Consts.errors.ERR_BINARY_PATCHED_FILE_NOT_FINALISED		= 0x3030034		-- Binary file is being patched but not finalised
+Consts.errors.ERR_BINARY_PATCHED_SECTION_NOT_CREATED		= 0x3030035		-- Patched copy of the section could not be created
+Consts.errors.ERR_BINARY_FAILED_INSERTING_STRING		= 0x3030036		-- String could not be inserted
+Consts.errors.ERR_BINARY_SECTION_NOT_RELOCATED		= 0x3030037		-- Section could not be relocated
+Consts.errors.ERR_BINARY_SECTION_ALREADY_EXISTING		= 0x3030038		-- Attempted to updated or create an already existing section
+Consts.errors.ERR_BINARY_UNABLE_TO_CREATE_FILE		= 0x3030040		-- Unable to initialise binary file for writing
+Consts.errors.ERR_BINARY_UNABLE_TO_WRITE_FILE		= 0x3030041		-- Unable to write binary file
+Consts.errors.ERR_BINARY_RELOCATION_NOT_SUPPORTED		= 0x3030050		-- Relocation type not supported
+Consts.errors.ERR_BINARY_RELOCATION_NOT_RECOGNISED		= 0x3030051		-- Relocation type not recognised
+Consts.errors.ERR_BINARY_RELOCATION_INVALID		= 0x3030052		-- Invalid relocation type
+Consts.errors.ERR_BINARY_BAD_RELOCATION_ADDRESS		= 0x3030053		-- Invalid relocation address
+Consts.errors.ERR_BINARY_UNKNOWN_DEBUG_FORMAT		= 0x3030060		-- Unknown or unsupported debug format
+Consts.errors.ERR_ASMBL_ARCH_NOT_SUPPORTED		= 0xa030001		-- Architecture not supported for assembly
+Consts.errors.ERR_ASMBL_INSTRUCTION_NOT_ASSEMBLED		= 0xa030010		-- Instruction could not be assembled
+Consts.errors.ERR_ASMBL_INSTRUCTION_HAS_CODING		= 0xa030011		-- Instruction already has a coding
+Consts.errors.ERR_ASMBL_CODING_HAS_DIFFERENT_LENGTH		= 0xa030012		-- New coding of instruction has a different length
+Consts.errors.ERR_DISASS_FILE_NOT_PARSED		= 0x4030001		-- File has not been parsed
+Consts.errors.ERR_DISASS_STREAM_EMPTY		= 0x4030002		-- Stream to disassemble is empty
+Consts.errors.ERR_DISASS_ARCH_NOT_SUPPORTED		= 0x4030003		-- Architecture not supported for disassembly
+Consts.errors.ERR_DISASS_FILE_PARSING_FAILED		= 0x4030004		-- File parsing failed
+Consts.errors.ERR_DISASS_FILE_DISASSEMBLY_FAILED		= 0x4030005		-- File disassembly failed
+Consts.errors.ERR_DISASS_FSM_NO_MATCH_FOUND		= 0x4030010		-- Parser failed to find a match
+Consts.errors.ERR_DISASS_FSM_END_OF_STREAM_REACHED		= 0x4030011		-- End of stream reached during parsing
+Consts.errors.WRN_DISASS_EXT_FCTS_LBLS_NOT_RETRIEVED		= 0x4020001		-- Unable to retrieve labels for external functions
+Consts.errors.WRN_DISASS_DBG_LBLS_NOT_RETRIEVED		= 0x4020002		-- Unable to retrieve debug labels
+Consts.errors.WRN_DISASS_FSM_RESET_ADDRESS_OUT_OF_RANGE		= 0x4020010		-- Requested parser reset to an out of range address
+Consts.errors.WRN_DISASS_FSM_RESET_ADDRESS_PARSING_IN_PROGRESS		= 0x4020011		-- Requested parser reset while parsing in progress
+Consts.errors.WRN_DISASS_INCOMPLETE_DISASSEMBLY		= 0x4020020		-- Disassembly is incomplete
+Consts.errors.WRN_DISASS_DECODING_MISMATCH		= 0x4020021		-- Instructions decoded in parallel or from the decoding cache differ from the FSM
+Consts.errors.ERR_ANALYZE_CACHE_NOT_MATCHING		= 0x5030001		-- Cached analysis results do not match the file or the MAQAO version
+Consts.errors.ERR_ANALYZE_CACHE_UNSUPPORTED		= 0x5030002		-- Analysis results can not be stored in a cache file
+Consts.errors.ERR_PATCH_ARCH_NOT_SUPPORTED		= 0x6030001		-- Architecture not supported for patching
+Consts.errors.ERR_PATCH_NOT_INITIALISED		= 0x6030002		-- Patcher not initialised
+Consts.errors.ERR_PATCH_MISSING_MODIF_STRUCTURE		= 0x6030003		-- Missing modification structure
+Consts.errors.ERR_PATCH_WRONG_MODIF_TYPE		= 0x6030004		-- Wrong type of modification request
+Consts.errors.ERR_PATCH_INSERT_LIST_EMPTY		= 0x6030005		-- List of instructions to insert is empty
+Consts.errors.ERR_PATCH_MISSING_MODIF_ADDRESS		= 0x6030006		-- Modification has no address
+Consts.errors.ERR_PATCH_FLOATING_MODIF_NO_SUCCESSOR		= 0x6030007		-- Floating modification has no successor
+Consts.errors.ERR_PATCH_FILE_NOT_FINALISED		= 0x6030008		-- Patched file is not finalised
+Consts.errors.ERR_PATCH_ADDRESS_LIST_ALREADY_CREATED		= 0x6030009		-- List of addresses has already been initialised
+Consts.errors.ERR_PATCH_MODIF_NOT_FINALISED		= 0x603000a		-- Modification is not finalised
+Consts.errors.ERR_PATCH_EXTFCT_STUB_NOT_GENERATED		= 0x6030010		-- Stub for external function could not be generated
+Consts.errors.ERR_PATCH_LABEL_INSERT_FAILURE		= 0x6030011		-- Label insertion failed
+Consts.errors.ERR_PATCH_RELOCATION_NOT_ADDED		= 0x6030012		-- Relocation not added to the binary file
+Consts.errors.ERR_PATCH_FUNCTION_NOT_INSERTED		= 0x6030013		-- Function could not be inserted to the file
+Consts.errors.ERR_PATCH_FUNCTION_CALL_NOT_GENERATED		= 0x6030014		-- Code for the function call could not be generated
+Consts.errors.ERR_PATCH_PADDING_INSN_TOO_BIG		= 0x6030020		-- Padding instruction is larger than the default one
+Consts.errors.ERR_PATCH_CONDITION_ARGUMENTS_MISMATCH		= 0x6030030		-- Mismatch between the condition arguments and type
+Consts.errors.ERR_PATCH_CONDITION_TYPE_UNKNOWN		= 0x6030031		-- Condition type unknown
+Consts.errors.ERR_PATCH_CONDITION_PARSE_ERROR		= 0x6030032		-- Error when parsing a condition
+Consts.errors.ERR_PATCH_CONDITION_MISSING		= 0x6030033		-- Expected condition was missing
+Consts.errors.ERR_PATCH_CONDITION_UNSUPPORTED_MODIF_TYPE		= 0x6030034		-- Condition not supported for this type of modification
+Consts.errors.ERR_PATCH_REFERENCED_GLOBVAR_MISSING		= 0x6030040		-- Global variable to be referenced by an instruction is missing
+Consts.errors.ERR_PATCH_GLOBVAR_MISSING		= 0x6030041		-- Missing global variable
+Consts.errors.ERR_PATCH_NO_SPACE_FOUND_FOR_GLOBVAR		= 0x6030042		-- No space found for inserting a global variable
+Consts.errors.ERR_PATCH_BASIC_BLOCK_NOT_FOUND		= 0x6030050		-- Unable to find a basic block around a given instruction
+Consts.errors.ERR_PATCH_INSERT_INSNLIST_FAILED		= 0x6030051		-- Unable to insert list of instructions
+Consts.errors.ERR_PATCH_INSUFFICIENT_SIZE_FOR_INSERT		= 0x6030052		-- Insufficient size for insertion of instructions
+Consts.errors.ERR_PATCH_UNABLE_TO_MOVE_TRAMPOLINE		= 0x6030053		-- Unable to move trampoline block
+Consts.errors.ERR_PATCH_UNABLE_TO_CREATE_TRAMPOLINE		= 0x6030054		-- Unable to insert trampoline rebound
+Consts.errors.ERR_PATCH_NO_SPACE_FOUND_FOR_BLOCK		= 0x6030055		-- No space found for moving a block
+Consts.errors.ERR_PATCH_NO_SPACE_FOUND_FOR_SECTION		= 0x6030056		-- No space found for moving a section
+Consts.errors.ERR_PATCH_UNRESOLVED_SYMBOL		= 0x6030060		-- Symbol not found in the inserted libraries
+Consts.errors.WRN_PATCH_SIZE_TOO_SMALL_FORCED_INSERT		= 0x6020001		-- Insertion was forced while insertion site was too small
+Consts.errors.WRN_PATCH_FUNCTION_MOVED		= 0x6020002		-- A function was moved to perform the insertion
+Consts.errors.WRN_PATCH_MOVED_FUNCTION_HAS_INDIRECT_BRCH		= 0x6020003		-- A function containing an indirect branch was moved
+Consts.errors.WRN_PATCH_SYMBOL_ADDED_AS_EXTERNAL		= 0x6020010		-- Undefined symbol was added as an external
+Consts.errors.WRN_PATCH_MODIF_NOT_PROCESSED		= 0x6020020		-- Modification has not been processed and will not be applied
+Consts.errors.WRN_PATCH_NO_PENDING_MODIFS		= 0x6020030		-- Attempted to finalise patching session with no modification pending
+Consts.errors.WRN_PATCH_FILE_SAVED_WITH_DEFAULT_NAME		= 0x6020040		-- File was saved with a default name as the given name was invalid
+Consts.errors.ERR_MADRAS_MISSING_MADRAS_STRUCTURE		= 0x7030001		-- Missing MADRAS structure
+Consts.errors.ERR_MADRAS_MODIF_TYPE_NOT_SUPPORTED		= 0x7030004		-- Modification type not supported
+Consts.errors.ERR_MADRAS_MISSING_CURSOR		= 0x7030010		-- Missing MADRAS cursor
+Consts.errors.ERR_MADRAS_CURSOR_NOT_ALIGNED		= 0x7030011		-- Unable to align cursor
+Consts.errors.ERR_MADRAS_MISSING_GLOBVAR		= 0x7030012		-- Missing global variable
+Consts.errors.ERR_MADRAS_MODIF_COND_MISSING		= 0x7030013		-- Modification has no condition
+Consts.errors.ERR_MADRAS_MODIF_ALREADY_HAS_ELSE		= 0x7030014		-- Modification already has "else" code
+Consts.errors.ERR_MADRAS_ELSE_MODIF_IS_FIXED		= 0x7030015		-- "Else" modification has a fixed address
+Consts.errors.ERR_MADRAS_MODIF_HAS_CUSTOM_PADDING		= 0x7030016		-- Modification already has custom padding instruction
+Consts.errors.ERR_MADRAS_MODIF_ADD_COND_FAILED		= 0x7030017		-- Unable to add condition to modification
+Consts.errors.ERR_MADRAS_ADD_LIBRARY_FAILED		= 0x7030020		-- Unable to add request for library insertion
+Consts.errors.ERR_MADRAS_ADDRESSES_NOT_TRACKED		= 0x7030021		-- Addresses were not tracked
+Consts.errors.ERR_MADRAS_MODIF_LABEL_FAILED		= 0x7030022		-- Unable to add request for label modification
+Consts.errors.ERR_MADRAS_MODIF_CODE_FAILED		= 0x7030023		-- Unable to add request for code modification
+Consts.errors.ERR_MADRAS_MODIF_LIBRARY_FAILED		= 0x7030024		-- Unable to add request for library modification
+Consts.errors.ERR_MADRAS_MODIF_VARIABLE_FAILED		= 0x7030025		-- Unable to add request for variable modification
+Consts.errors.ERR_MADRAS_RENAMING_LIBRARY_EXISTING		= 0x7030026		-- A request for renaming the library already exists
+Consts.errors.WRN_MADRAS_MODIFS_ALREADY_INIT		= 0x7020001		-- Modifications were already initiated for this file
+Consts.errors.WRN_MADRAS_STACK_SHIFT_NULL		= 0x7020010		-- Stack shift requested for patching with a null shift value
+Consts.errors.WRN_MADRAS_NEWNAME_IDENTICAL		= 0x7020020		-- Requested renaming of element to an identical name
+Consts.errors.ERR_LUAEXE_MISSING_LUA_STATE		= 0xb030001		-- Missing Lua state
+Consts.errors.ERR_LUAEXE_MISSING_LUA_CHUNK		= 0xb030002		-- Missing Lua chunk to execute
+Consts.errors.ERR_LUAEXE_PRECOMP_SYNTAX_ERROR		= 0xb030003		-- Syntax error during pre-compilation
+Consts.errors.ERR_LUAEXE_PRECOMP_MEMORY_ALLOCATION		= 0xb030004		-- Memory allocation error during pre-compilation
+Consts.errors.ERR_LUAEXE_RUNTIME_ERROR		= 0xb030005		-- Lua runtime error
+Consts.errors.ERR_LUAEXE_UNKNOWN_RUNTIME_ERROR		= 0xb030006		-- Unspecified Lua runtime error
+Consts.errors.ERR_LUAEXE_MEMORY_ALLOCATION		= 0xb030007		-- Memory allocation error
+Consts.errors.ERR_LUAEXE_ERROR_HANDLER		= 0xb030008		-- Error while running the error handler
+Consts.errors.ERR_MAQAO_UNABLE_TO_DETECT_PROC_HOST		= 0x8030001		-- Unable to retrieve processor version of the host
+Consts.errors.ERR_MAQAO_MISSING_UARCH_OR_PROC		= 0x8030002		-- Missing micro architecture or processor version
@@ -0,0 +1,57 @@
+---
+--  Copyright (C) 2004 - 2018 Université de Versailles Saint-Quentin-en-Yvelines (UVSQ)
+--
+-- This file is part of MAQAO.
+--
+-- MAQAO is free software; you can redistribute it and/or
+--  modify it under the terms of the GNU Lesser General Public License
+--  as published by the Free Software Foundation; either version 3
+--  of the License, or (at your option) any later version.
+--
+--  This program is distributed in the hope that it will be useful,
+--  but WITHOUT ANY WARRANTY; without even the implied warranty of
+--  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+--  GNU Lesser General Public License for more details.
+--
+--  You should have received a copy of the GNU Lesser General Public License
+--  along with this program; if not, write to the Free Software
+--  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+---
+
+------------------------------------------------------------------------
+--------------------------LUA MDS API functions-------------------------
+------------------------------------------------------------------------
+
+--- @class MDSAPI Class
+
+MDSAPI = {};
+
+--Patch option flags
+MDSAPI.PATCHOPT_SAFEMODE = 0x00000000	       --Option flag for safe mode (patch operations won't be 
+                                              -- performed if they can cause the code to crash). Default
+MDSAPI.PATCHOPT_FORCEINS = 0x00000001	       --Option flag for forcing insertions when there is not enough
+                                              -- space for them
+MDSAPI.PATCHOPT_MOVEFCTS = 0x00000002	       --Option flag for moving functions when a basic block is not
+                                              -- large enough to perform a patch operation
+MDSAPI.PATCHOPT_MOV1INSN = 0x00000004	       --Option flag for moving only a single instruction when 
+                                              -- performing a patch operation.
+
+MDSAPI.STACK_KEEP  = 0;
+MDSAPI.STACK_MOVE  = 1;
+MDSAPI.STACK_SHIFT = 2;
+
+--Constant values for Elf OSABI
+MDSAPI.ELFOSABI_NONE                 = 0      --UNIX System V ABI
+MDSAPI.ELFOSABI_SYSV                 = 0      --Alias.
+MDSAPI.ELFOSABI_HPUX                 = 1      --HP-UX
+MDSAPI.ELFOSABI_NETBSD               = 2      --NetBSD.
+MDSAPI.ELFOSABI_LINUX                = 3      --Linux.
+MDSAPI.ELFOSABI_SOLARIS              = 6      --Sun Solaris.
+MDSAPI.ELFOSABI_AIX                  = 7      --IBM AIX.
+MDSAPI.ELFOSABI_IRIX                 = 8      --SGI Irix.
+MDSAPI.ELFOSABI_FREEBSD              = 9      --FreeBSD.
+MDSAPI.ELFOSABI_TRU64                = 10     --Compaq TRU64 UNIX.
+MDSAPI.ELFOSABI_MODESTO              = 11     --Novell Modesto.
+MDSAPI.ELFOSABI_OPENBSD              = 12     --OpenBSD.
+MDSAPI.ELFOSABI_ARM_AEABI            = 64     --ARM EABI
+MDSAPI.ELFOSABI_ARM                  = 97     --ARM
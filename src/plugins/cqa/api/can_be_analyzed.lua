@@ -169,12 +169,27 @@ function can_be_analyzed (crc)
 
       if (nb_paths > cqa_context.max_paths) then
          crc ["nb paths"] = nb_paths;
-         return false, string.format (
-            "too many paths (%d paths > max_paths=%d)",
-            nb_paths, cqa_context.max_paths);
+         if (not cqa_context.top_paths) then
+            return false, string.format (
+               "too many paths (%d paths > max_paths=%d)",
+               nb_paths, cqa_context.max_paths);
+         end
+
+         -- Only the max_paths heaviest paths are analyzed, without enumerating other ones
+         crc._top_paths = blocks:get_top_paths (cqa_context.max_paths);
+         Debug:warn (string.format ("too many paths (%d paths > max_paths=%d): analyzing only the %d heaviest ones",
+                                    nb_paths, cqa_context.max_paths, cqa_context.max_paths));
       end
 
       -- for each path
+      if (crc._top_paths ~= nil) then
+         for _,path in ipairs (crc._top_paths) do
+            local r1, r2, r3, r4 = check_path_insns (crc, path);
+            if (not r1) then return false, r2, r3, r4 end
+         end
+         return true;
+      end
+
       for path in blocks:paths() do
          local r1, r2, r3, r4 = check_path_insns (crc, path);
          if (not r1) then return false, r2, r3, r4 end
@@ -587,9 +587,18 @@ function get_cqa_results (blocks, cqa_context)
 
    crc ["nb paths"] = blocks:get_nb_paths();
 
+   -- Paths selected by can_be_analyzed when only the heaviest ones are analyzed (top-paths)
+   local paths_iter;
+   if (crc._top_paths ~= nil) then
+      local i = 0;
+      paths_iter = function () i = i + 1; return crc._top_paths [i] end
+   else
+      paths_iter = blocks:paths();
+   end
+
    -- for each path
    local path_ID = 1;
-   for path in blocks:paths() do
+   for path in paths_iter do
       local _blocks;
       if (blocks_type == "loop") then
          _blocks = get_blocks_from_path (blocks, cqa_context, path);
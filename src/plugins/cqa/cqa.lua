@@ -531,6 +531,9 @@ function cqa:cqa_launch (args, proj)
    local max_paths = tonumber (get_opt ("max-paths-nb", "max_paths"));
    cqa_context.max_paths = max_paths or cqa.consts.MAX_NB_PATHS
 
+   -- [ADVANCED FEATURE] For loops with more than max_paths paths, analyze only the max_paths heaviest ones
+   cqa_context.top_paths = is_opt_set ("top-paths", "tp");
+
    -- [ADVANCED FEATURE] For multiple paths loops, consider all blocks as belonging to a unique path
    cqa_context.ignore_paths = is_opt_set ("ignore-paths", "igp");
 
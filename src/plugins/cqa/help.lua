@@ -54,6 +54,7 @@ function cqa:init_help ()
    help:add_option ("instructions-modifier-options", "imo", "<string>", false, "Options to refine instructions modifier behavior. Available: vector_aligned, vector_unaligned, force_sse, int_novec, force_vec, no_gather\n");
    help:add_option ("loop-distance", "dist", "<positive integer>", false, "Override LOOP_MERGE_DISTANCE default value ("..cqa.consts.LOOP_MERGE_DISTANCE.."). Prevents loop unrolling detector from assuming close source lines correspond to the same loop.")
    help:add_option ("max-paths-nb", "max_paths", "<positive integer>", false, "Override MAX_NB_PATHS default value ("..cqa.consts.MAX_NB_PATHS.."), allow to analyze loops with more paths.")
+   help:add_option ("top-paths", "tp", nil, false, "For loops with more than max-paths-nb paths, analyze only the max-paths-nb heaviest paths (by number of instructions) instead of skipping the loop.");
    help:add_option ("ignore-paths", "igp", nil, false, "Ignore paths: assume all blocks as belonging to a unique path. Be aware that such a path has no real existence !");
    help:add_option ("follow-calls", "fc", "\"append\"|\"inline\"", false, "Follow calls by appending/inlining corresponding instructions");
    help:add_option ("select-blocks", "sb", "<string>", false, "Name of a Lua function to use to select loop blocks. Such a function must be defined in loop_blocks_selection_functions.lua (located in current directory) and return a list of blocks from a loop. Example:\n"..
@@ -0,0 +1,4 @@
+-- This file contains all images used by MAQAO modules saved in base64
+-- /!\ It is generated during the compilation of MAQAO
+-- and should not be modified by hand /!\ 
+maqao_images = {}
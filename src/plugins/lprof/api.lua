@@ -447,6 +447,12 @@ function lprof:get_default_collect_options()
       -- Library structure analysis (disassembling to get loops)
       library_debug_info = "", -- CLI: -ldi/--library-debug-info
 
+      -- Library metafiles cache: "on" (user cache directory), "off" or a directory
+      library_cache = "off", -- CLI: -lc/--library-cache (default: <--cache-dir>/lprof_libs if set)
+
+      -- Number of processes analyzing libraries (-1: one per processor)
+      nb_threads = 1, -- CLI: --threads
+
       -- User guided: start after X seconds or pause/resume counters at CTRL+Z
       -- CLI: -ug/--user-guided
       user_guided = -1,
@@ -463,6 +469,7 @@ function lprof:get_default_collect_options()
       -- CLI: -btm/--backtrace-mode
       backtrace_mode = lprof.BACKTRACE_MODE_CALL,
       -- lprof.BACKTRACE_MODE_STACK: libunwind. CLI: btm=stack
+      -- lprof.BACKTRACE_MODE_STACK_OFFLINE: libunwind, after the run. CLI: btm=stack-offline
       -- lprof.BACKTRACE_MODE_BRANCH: LBR. CLI: btm=branch
       -- lprof.BACKTRACE_MODE_OFF: no callchain collection. CLI: btm=off
 
@@ -253,6 +253,15 @@ function set_opts_from_cmdline (args, options)
    -- Library structure analysis (disassembling to get loops)
    options.library_debug_info = get_opt ("library-debug-info", "ldi") or "off"
 
+   -- Library metafiles cache (off by default, in the common cache directory if set)
+   -- and number of processes analyzing libraries (common --threads option)
+   options.library_cache = get_opt ("library-cache", "lc")
+   if (options.library_cache == nil) then
+      local cache_dir = get_opt ("cache-dir")
+      options.library_cache = (cache_dir ~= nil) and (cache_dir.."/lprof_libs") or "off"
+   end
+   options.nb_threads = Utils:get_nb_threads (args)
+
    -- User guided: start after X seconds or pause/resume counters at CTRL+Z
    local ug = get_opt ("user-guided", "ug")
    if (ug == "on") then
@@ -278,13 +287,15 @@ function set_opts_from_cmdline (args, options)
       options.backtrace_mode = lprof.BACKTRACE_MODE_CALL
    elseif (btm == "stack") then
       options.backtrace_mode = lprof.BACKTRACE_MODE_STACK
+   elseif (btm == "stack-offline") then
+      options.backtrace_mode = lprof.BACKTRACE_MODE_STACK_OFFLINE
    elseif (btm == "branch") then
       options.backtrace_mode = lprof.BACKTRACE_MODE_BRANCH
    elseif (btm == "off") then
       options.backtrace_mode = lprof.BACKTRACE_MODE_OFF
    else
       Message:error ("[MAQAO] Unknown backtrace mode "..btm)
-      Message:error ("[MAQAO] Available backtrace modes : call (default), stack, branch, off")
+      Message:error ("[MAQAO] Available backtrace modes : call (default), stack, stack-offline, branch, off")
       os.exit()
    end
 
@@ -363,7 +374,8 @@ local function kernel_version_detection (options)
    --      "\nSUB2 = ",sub2_number);
 
    -- CHECK OPTIONS COMPATIBILITIES
-   if ( options ["backtrace_mode"] == lprof.BACKTRACE_MODE_STACK ) then
+   if ( options ["backtrace_mode"] == lprof.BACKTRACE_MODE_STACK or
+        options ["backtrace_mode"] == lprof.BACKTRACE_MODE_STACK_OFFLINE ) then
       if (major_number > 3) then
          -- OK
       elseif (major_number == 3 and minor_number >= 7) then
@@ -680,7 +692,8 @@ function collect_hwc (options, proj, needs_barrier)
          binary = t[1]
       end
 
-      lprof.generate_metafile_binformat_new (exp_path, hostname, pid, binary, options.library_debug_info, proj)
+      lprof.generate_metafile_binformat_new (exp_path, hostname, pid, binary, options.library_debug_info, proj,
+                                             options.library_cache, options.nb_threads)
    end
 
    -- Notify master rank that hostname/pid has finished sampling and metafile generation
@@ -145,6 +145,7 @@ BACKTRACE_MODE_CALL     = 1
 BACKTRACE_MODE_STACK    = 2
 BACKTRACE_MODE_BRANCH   = 3
 BACKTRACE_MODE_OFF      = 4
+BACKTRACE_MODE_STACK_OFFLINE = 5
 
 FULL_COLUMN_NAMES_FCT         = "Function Name,Module,Source Info,Time %,Time(s),CPI ratio";
 FULL_COLUMN_NAMES_LOOP        = "Loop ID,Module,Function Name,Source Info,Level,Time %,Time (s),CPI ratio";
@@ -111,6 +111,22 @@ function lprof:init_help()
                     "<.br><.br>/!\\ Warning: this option can increase the analysis overhead."
    );
 
+   help:add_option ("library-cache", "lc=", "<dir>/on/off", false,
+                    "Cache libraries information (functions and loops) to reuse it for all hosts and for next experiments.\n"..
+                    "<.br>Libraries are identified by their contents, so a library is only analyzed once while it is not modified.\n"..
+                    "<.br>Allowed values are:\n"..
+                    "<.br>  - on    : Use $XDG_CACHE_HOME/maqao/lprof_libs, or $HOME/.cache/maqao/lprof_libs.\n"..
+                    "<.br>  - off   : Do not use a cache (default, unless --cache-dir is set).\n"..
+                    "<.br>  - <dir> : Use <dir>. Select a directory shared by all hosts to analyze a library on one host only.\n"..
+                    "<.br>If --cache-dir=<dir> is set, <dir>/lprof_libs is used by default."
+   );
+
+   help:add_option ("cache-dir", nil, "<dir>", false,
+                    "Cache directory shared with other MAQAO modules. Libraries information is cached in <dir>/lprof_libs, unless --library-cache is set."
+   );
+
+   Utils:add_threads_help_option (help)
+
    help:add_option ("user-guided", "ug=", "<delay (seconds)> (timer mode) / on (signal mode)", false,
                     "Allow user to control the sampling in two modes:\n"..
                     "<.br>  - timer mode  : user-defined delay (in seconds) before the data collection process.\n"..
@@ -119,11 +135,13 @@ function lprof:init_help()
                     "<.br>                  Can be used as many times as necessary during the run of the application."
    );
 
-   help:add_option ( "backtrace-mode", "btm=", "call/stack/branch/off", false,
+   help:add_option ( "backtrace-mode", "btm=", "call/stack/stack-offline/branch/off", false,
                      "[Advanced] Select the perf_event_open sample type used to collect callchains:\n"..
                      "<.br>  - call   : use the PERF_SAMPLE_CALLCHAIN sample type (default).\n"..
                      "<.br>  - stack  : use the PERF_SAMPLE_STACK_USER sample type.\n"..
                      "<.br>             Allows stack unwinding. Requires Linux 3.7.\n"..
+                     "<.br>  - stack-offline : same as stack but unwinding is deferred after the run.\n"..
+                     "<.br>             Raw stacks are saved to temporary files and unwound in parallel before display.\n"..
                      "<.br>  - branch : use the PERF_SAMPLE_BRANCH_STACK sample type.\n"..
                      "<.br>             Uses CPU sampling hardware. Requires Linux 3.4.\n"..
                      "<.br>  - off    : Disable callchains collection.\n"..
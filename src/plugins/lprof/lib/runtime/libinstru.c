@@ -32,6 +32,16 @@ bench_instru_fcts *imcp;
 static instru_t *instru_session;
 static unsigned long long start_cycles;
 
+/* Thread bound to the calling thread for a session. Probes only look it up here,
+ * get_thread_id is called once per thread and per session (by _bind_thread).
+ * initial-exec: the library is loaded with the program, so its TLS block is static
+ * and the access does not go through __tls_get_addr */
+typedef struct instru_tls_s{
+	instru_t *session;   /**<session the thread is bound to*/
+	thread_t *thread;    /**<data of the thread in this session*/
+}instru_tls_t;
+static __thread instru_tls_t instru_tls __attribute__ ((tls_model ("initial-exec")));
+
 /*
  * ...
  */
@@ -82,9 +92,10 @@ void instru_load(char *parameters)
 	threading_type 	= 1;
 #endif
 
-	instru_init("pname","binfilename",0,1,1,1,1,1,"companion","binfile_hash");
+	// Probes are priced on a session with as many threads as the program
+	instru_init("pname","binfilename",0,nb_threads,1,1,1,1,"companion","binfile_hash");
 	intru_probes_warmup();
-	imcp = intru_probes_price();
+	imcp = intru_probes_price(nb_threads);
   instru_free();
 
 	instru_init(pname,binfilename,threading_type,nb_threads,nb_functions,nb_calls,
@@ -112,7 +123,7 @@ void instru_init(char *pname,char* binfilename,int threading_type,int nb_threads
 {
 	/*fprintf(stdout,"instru_init(\"%s\",\"%s\",%d,%d,%d,%d,%d,%d,\"%s\",\"%s\")\n",
 	   pname,binfilename,threading_type,nb_threads,nb_functions,nb_calls,nb_loops,nb_edges,companion,binfile_hash);*/
-	int i,j;
+	int i;
 	instru_session = (instru_t *)malloc(sizeof(instru_t));
 
 	switch(threading_type)
@@ -153,56 +164,99 @@ void instru_init(char *pname,char* binfilename,int threading_type,int nb_threads
 	instru_session->nb_edges	 	   = nb_edges;
 	instru_session->threads 		   = (thread_t *)malloc(sizeof(thread_t)*nb_threads);
 
+	/* All tables of a thread are stored in a single block aligned on a cache line,
+	 * each table starting on its own line, so no line is shared between threads */
+	size_t fcts_size  = INSTRU_ALIGN(sizeof(function_t)*nb_functions);
+	size_t calls_size = INSTRU_ALIGN(sizeof(call_t)*nb_calls);
+	size_t loops_size = INSTRU_ALIGN(sizeof(loop_t)*nb_loops);
+	size_t edges_size = INSTRU_ALIGN(sizeof(unsigned long long)*nb_edges);
+	size_t size = fcts_size + calls_size + loops_size + edges_size;
+
 	for(i=0;i<nb_threads;i++)
 	{
 		//fprintf(stdout,"Initializing thread %d data structure\n",i);
-		instru_session->threads[i].functions = (function_t *)malloc(sizeof(function_t)*nb_functions);
-		instru_session->threads[i].calls	 	 = (call_t *)malloc(sizeof(call_t)*nb_calls);
-		instru_session->threads[i].loops 		 = (loop_t *)malloc(sizeof(loop_t)*nb_loops);
-		instru_session->threads[i].edges		 = (unsigned long long*)malloc(sizeof(unsigned long long)*nb_edges);
-		for(j=0;j<nb_functions;j++)
-		{
-			instru_session->threads[i].functions[j].elapsed_cycles = 0;
-			instru_session->threads[i].functions[j].start_cycles	 = 0;
-			instru_session->threads[i].functions[j].stop_cycles		 = 0;
-			instru_session->threads[i].functions[j].depth					 = 0;
-			instru_session->threads[i].functions[j].instances			 = 0;
-		}
-		for(j=0;j<nb_calls;j++)
-		{
-			instru_session->threads[i].calls[j].elapsed_cycles = 0;
-			instru_session->threads[i].calls[j].start_cycles	 = 0;
-			instru_session->threads[i].calls[j].stop_cycles		 = 0;
-			instru_session->threads[i].calls[j].depth					 = 0;
-			instru_session->threads[i].calls[j].instances			 = 0;
-		}
-		for(j=0;j<nb_loops;j++)
+		thread_t *thread = &instru_session->threads[i];
+		char *counters;
+
+		if(posix_memalign((void **)&counters,INSTRU_CACHE_LINE,(size > 0) ? size : INSTRU_CACHE_LINE) != 0)
 		{
-			instru_session->threads[i].loops[j].elapsed_cycles = 0;
-			instru_session->threads[i].loops[j].start_cycles	 = 0;
-			instru_session->threads[i].loops[j].stop_cycles		 = 0;
-			instru_session->threads[i].loops[j].iters				   = 0;
-			instru_session->threads[i].loops[j].instances		   = 0;
-		}
-		for(j=0;j<nb_edges;j++){
-			instru_session->threads->edges[j] = 0;
+			fprintf(stderr,"MAQAO Instrumentation runtime: unable to allocate data of thread %d\n",i);
+			exit(-1);
 		}
+		memset(counters,0,size);
+		thread->counters	= counters;
+		thread->functions = (function_t *)counters;
+		thread->calls	 	  = (call_t *)(counters + fcts_size);
+		thread->loops 		= (loop_t *)(counters + fcts_size + calls_size);
+		thread->edges		  = (unsigned long long *)(counters + fcts_size + calls_size + loops_size);
+		thread->id				= i;
 	}
 }
 
+/*
+ * Binds the calling thread to its data in the current session
+ * \param tid index of the thread in the session
+ * \return the data of the thread
+ */
+static thread_t *_bind_thread_id(int tid)
+{
+	if(tid < 0 || tid >= instru_session->nb_threads)
+	{
+		int otid = tid;
+		tid = (tid < 0) ? 0 : tid % instru_session->nb_threads;
+		fprintf(stderr,"MAQAO Instrumentation runtime: thread %d out of the %d threads set by OMP_NUM_THREADS, "
+				"using data of thread %d\n",otid,instru_session->nb_threads,tid);
+	}
+	instru_tls.thread  = &instru_session->threads[tid];
+	instru_tls.session = instru_session;
+
+	return instru_tls.thread;
+}
+
+/*
+ * Binds the calling thread to its data in the current session, as identified
+ * by the threading runtime (slow path of _get_thread)
+ * \return the data of the thread
+ */
+static thread_t *_bind_thread(void)
+{
+	return _bind_thread_id(get_thread_id());
+}
+
+/*
+ * Binds the calling thread to the data of a given thread in the current session.
+ * Used for threads unknown to the threading runtime (probes benchmark)
+ * \param tid index of the thread in the session
+ */
+void instru_bind_thread(int tid)
+{
+	_bind_thread_id(tid);
+}
+
+/*
+ * Retrieves the data of the calling thread in the current session
+ * \return the data of the thread
+ */
+static inline thread_t *_get_thread(void)
+{
+	if(__builtin_expect(instru_tls.session == instru_session,1))
+		return instru_tls.thread;
+	return _bind_thread();
+}
+
 void instru_fct_tstart(int fid)
 {
 	unsigned long long tmp_cycles,tmp_cycles2;
-	int tid	= get_thread_id();
+	thread_t *thread = _get_thread();
 
-	function_t *fct = &instru_session->threads[tid].functions[fid];
-	//fprintf(stdout,"In instru_fct_tstart (fid=%d,tid=%d,depth=%lld)\n",fid,tid,fct->depth);
+	function_t *fct = &thread->functions[fid];
+	//fprintf(stdout,"In instru_fct_tstart (fid=%d,tid=%d,depth=%lld)\n",fid,thread->id,fct->depth);
 
-	fct->instances++;
-	if(fct == NULL)
-			fprintf(stdout,"Error trying to access an undefined function (fid %d,tid %d)\n",fid,tid);
+	if(__builtin_expect(fid >= instru_session->nb_functions,0))
+			fprintf(stdout,"Error trying to access an undefined function (fid %d,tid %d)\n",fid,thread->id);
 	else
 	{
+		fct->instances++;
 		/* Recursivity is handled thanks to a depth attribute
 		 * At the end of the profiling depth must be equal to zero (entries == exits).
 		 */
@@ -218,7 +272,7 @@ void instru_fct_tstart(int fid)
 			rdtscll(tmp_cycles);
 			tmp_cycles2 = tmp_cycles - fct->start_cycles;
 			/*if(tmp_cycles2 < 0)
-				fprintf(stdout,"In instru_fct_tstart : Detected an incoherent measure from rdtsc call (fid %d,tid %d)\n",fid,tid);*/
+				fprintf(stdout,"In instru_fct_tstart : Detected an incoherent measure from rdtsc call (fid %d,tid %d)\n",fid,thread->id);*/
 			fct->elapsed_cycles += tmp_cycles2;
 			fct->start_cycles   = tmp_cycles;
 		}
@@ -228,50 +282,58 @@ void instru_fct_tstart(int fid)
 
 }
 
-void instru_fct_tstop(int fid)
+/*
+ * Stops the timer of a function
+ * \param fct data of the function for the calling thread
+ */
+static void _fct_tstop(function_t *fct)
 {
 	unsigned long long tmp_cycles,tmp_cycles2;
-	int tid	= get_thread_id();
 
-	function_t *fct = &instru_session->threads[tid].functions[fid];
-	//fprintf(stdout,"In instru_fct_stop (fid=%d,tid=%d,depth=%lld)\n",fid,tid,fct->depth-1);
+	rdtscll(tmp_cycles);
+	fct->depth--;
+	tmp_cycles2 	= tmp_cycles - fct->stop_cycles;
+	/*if(tmp_cycles2 < 0)
+		fprintf(stdout,"In instru_fct_tstop : Detected an incoherent measure from rdtsc call\n");*/
+	fct->elapsed_cycles += tmp_cycles2;
 
-	if(fct == NULL)
-		fprintf(stdout,"Error trying to access an undefined function (fid %d,tid %d)\n",fid,tid);
+	if(fct->depth == 0)
+	{
+		//printf("In instru_fct_stop : stopping\n");
+		fct->start_cycles = 0;
+		fct->stop_cycles 	= 0;
+	}
 	else
 	{
-		rdtscll(tmp_cycles);
-		fct->depth--;
-		tmp_cycles2 	= tmp_cycles - fct->stop_cycles;
-		/*if(tmp_cycles2 < 0)
-			fprintf(stdout,"In instru_fct_tstop : Detected an incoherent measure from rdtsc call (fid %d,tid %d)\n",fid,tid);*/
-		fct->elapsed_cycles += tmp_cycles2;
-
-		if(fct->depth == 0)
-		{
-			//printf("In instru_fct_stop : stopping\n");
-			fct->start_cycles = 0;
-			fct->stop_cycles 	= 0;
-		}
-		else
-		{
-			fct->stop_cycles  = tmp_cycles;
-		}
+		fct->stop_cycles  = tmp_cycles;
 	}
 }
 
+void instru_fct_tstop(int fid)
+{
+	thread_t *thread = _get_thread();
+
+	function_t *fct = &thread->functions[fid];
+	//fprintf(stdout,"In instru_fct_stop (fid=%d,tid=%d,depth=%lld)\n",fid,thread->id,fct->depth-1);
+
+	if(__builtin_expect(fid >= instru_session->nb_functions,0))
+		fprintf(stdout,"Error trying to access an undefined function (fid %d,tid %d)\n",fid,thread->id);
+	else
+		_fct_tstop(fct);
+}
+
 void instru_fct_call_tstart(int callid)
 {
 	unsigned long long tmp_cycles,tmp_cycles2;
-	int tid = get_thread_id();
-	//fprintf(stdout,"In instru_fct_call_tstart (cid=%d,tid=%d)\n",callid,tid);
-	call_t *call = &instru_session->threads[tid].calls[callid];
+	thread_t *thread = _get_thread();
+	//fprintf(stdout,"In instru_fct_call_tstart (cid=%d,tid=%d)\n",callid,thread->id);
+	call_t *call = &thread->calls[callid];
 
-	call->instances++;
-	if(call == NULL)
-		fprintf(stdout,"Error trying to access an undefined call (cid %d,tid %d)\n",callid,tid);
+	if(__builtin_expect(callid >= instru_session->nb_calls,0))
+		fprintf(stdout,"Error trying to access an undefined call (cid %d,tid %d)\n",callid,thread->id);
 	else
 	{
+		call->instances++;
 		/* Recursivity is handled thanks to a depth attribute
 		 * At the end of the profiling depth must be equal to zero (#before == #after).
 		 */
@@ -287,7 +349,7 @@ void instru_fct_call_tstart(int callid)
 			rdtscll(tmp_cycles);
 			tmp_cycles2 	= tmp_cycles - call->start_cycles;
 			/*if(tmp_cycles2 < 0)
-				fprintf(stdout,"In instru_fct_call_tstart : Detected an incoherent measure from rdtsc call (fid %d,tid %d)\n",callid,tid);*/
+				fprintf(stdout,"In instru_fct_call_tstart : Detected an incoherent measure from rdtsc call (fid %d,tid %d)\n",callid,thread->id);*/
 			call->elapsed_cycles += tmp_cycles2;
 			call->start_cycles   = tmp_cycles;
 		}
@@ -298,19 +360,19 @@ void instru_fct_call_tstart(int callid)
 void instru_fct_call_tstop(int callid)
 {
 	unsigned long long tmp_cycles,tmp_cycles2;
-	int tid	= get_thread_id();
-	//fprintf(stdout,"In instru_fct_call_tstop (cid %d,tid = %d)\n",callid,tid);
-	call_t *call = &instru_session->threads[tid].calls[callid];
+	thread_t *thread = _get_thread();
+	//fprintf(stdout,"In instru_fct_call_tstop (cid %d,tid = %d)\n",callid,thread->id);
+	call_t *call = &thread->calls[callid];
 
-	if(call == NULL)
-		fprintf(stdout,"Error trying to access an undefined call (cid %d,tid %d)\n",callid,tid);
+	if(__builtin_expect(callid >= instru_session->nb_calls,0))
+		fprintf(stdout,"Error trying to access an undefined call (cid %d,tid %d)\n",callid,thread->id);
 	else
 	{
 		rdtscll(tmp_cycles);
 		call->depth--;
 		tmp_cycles2 = tmp_cycles - call->stop_cycles;
 		/*if(tmp_cycles2 < 0)
-			fprintf(stdout,"Detected an incoherent measure from rdtsc call (cid %d,tid %d)\n",callid,tid);*/
+			fprintf(stdout,"Detected an incoherent measure from rdtsc call (cid %d,tid %d)\n",callid,thread->id);*/
 		call->elapsed_cycles += tmp_cycles2;
 
 		if(call->depth == 0)
@@ -330,11 +392,11 @@ void instru_loop_tstart(int lid)
 {
 	//fprintf(stdout,"In instru_loop_tstart lid = %d\n",lid);
 	unsigned long long tmp_cycles,tmp_cycles2;
-	int tid	= get_thread_id();
-	loop_t *loop = &instru_session->threads[tid].loops[lid];
+	thread_t *thread = _get_thread();
+	loop_t *loop = &thread->loops[lid];
 
-	if(loop == NULL || lid > instru_session->nb_loops)
-		fprintf(stdout,"Error trying to access an undefined loop (lid %d,tid %d)\n",lid,tid);
+	if(__builtin_expect(lid >= instru_session->nb_loops,0))
+		fprintf(stdout,"Error trying to access an undefined loop (lid %d,tid %d)\n",lid,thread->id);
 	else
 	{
 		loop->instances++;
@@ -343,7 +405,7 @@ void instru_loop_tstart(int lid)
 			rdtscll(tmp_cycles);
 			tmp_cycles2 	= tmp_cycles - loop->start_cycles;
 			/*if(tmp_cycles2 < 0)
-				fprintf(stdout,"In instru_loop_tstart : Detected an incoherent measure from rdtsc call (lid %d,tid %d)\n",lid,tid);*/
+				fprintf(stdout,"In instru_loop_tstart : Detected an incoherent measure from rdtsc call (lid %d,tid %d)\n",lid,thread->id);*/
 			loop->elapsed_cycles += tmp_cycles2;
 			loop->start_cycles   = tmp_cycles;
 		}
@@ -357,18 +419,18 @@ void instru_loop_tstart(int lid)
 void instru_loop_tstop(int lid)
 {
 	//fprintf(stderr,"In instru_loop_tstop lid = %d\n",lid);
-	int tid		 = get_thread_id();
-	loop_t *loop = &instru_session->threads[tid].loops[lid];
+	thread_t *thread = _get_thread();
+	loop_t *loop = &thread->loops[lid];
 	unsigned long long tmp_cycles;
 
-	if(loop == NULL || lid > instru_session->nb_loops)
-		fprintf(stdout,"Error trying to access an undefined loop (lid %d,tid %d)\n",lid,tid);
+	if(__builtin_expect(lid >= instru_session->nb_loops,0))
+		fprintf(stdout,"Error trying to access an undefined loop (lid %d,tid %d)\n",lid,thread->id);
 	else
 	{
 		rdtscll(loop->stop_cycles);
 		tmp_cycles = loop->stop_cycles - loop->start_cycles;
 		/*if(tmp_cycles < 0)
-			fprintf(stdout,"Detected an incoherent measure from rdtsc call (lid %d,tid %d)\n",lid,tid);
+			fprintf(stdout,"Detected an incoherent measure from rdtsc call (lid %d,tid %d)\n",lid,thread->id);
 		else
 		{*/
 			loop->elapsed_cycles	+= tmp_cycles;
@@ -381,12 +443,12 @@ void instru_loop_tstop(int lid)
 void instru_loop_tstart_count(int lid,int edgeid)
 {
 	//fprintf(stderr,"In instru_loop_tstart_count  lid = %d edgeid = %d\n",lid,edgeid);
-	int tid				= get_thread_id();
-	loop_t *loop 	= &instru_session->threads[tid].loops[lid];
-	unsigned long long *edges = instru_session->threads[tid].edges;
+	thread_t *thread = _get_thread();
+	loop_t *loop 	= &thread->loops[lid];
+	unsigned long long *edges = thread->edges;
 
-	if(loop == NULL || lid > instru_session->nb_loops)
-		fprintf(stdout,"Error trying to update an undefined loop (lid %d,tid %d)\n",lid,tid);
+	if(__builtin_expect(lid >= instru_session->nb_loops,0))
+		fprintf(stdout,"Error trying to update an undefined loop (lid %d,tid %d)\n",lid,thread->id);
 	else
 	{
 		loop->instances++;
@@ -394,8 +456,8 @@ void instru_loop_tstart_count(int lid,int edgeid)
 		//fprintf(stdout,"In instru_loop_tstart_count  lid = %d edgeid = %d | cycles = %llu | time = %ld\n",lid,edgeid,loop->start_cycles,loop->start_time.tv_sec);
 	}
 
-	if(edgeid >= instru_session->nb_edges){
-		fprintf(stdout,"Error trying to update an undefined edge (eid %d,tid %d)\n",edgeid,tid);
+	if(__builtin_expect(edgeid >= instru_session->nb_edges,0)){
+		fprintf(stdout,"Error trying to update an undefined edge (eid %d,tid %d)\n",edgeid,thread->id);
 	}else{
 		edges[edgeid]++;
 	}
@@ -405,20 +467,20 @@ void instru_loop_tstop_count(int lid,int edgeid)
 {
 	//fprintf(stderr,"In instru_loop_tstop_count lid = %d edgeid = %d\n",lid,edgeid);
 	unsigned long long tmp_cycles;
-	int tid				            = get_thread_id();
-	loop_t *loop 		          = &instru_session->threads[tid].loops[lid];
-	unsigned long long *edges = instru_session->threads[tid].edges;
+	thread_t *thread = _get_thread();
+	loop_t *loop 		          = &thread->loops[lid];
+	unsigned long long *edges = thread->edges;
 
-	if(loop == NULL || lid > instru_session->nb_loops)
+	if(__builtin_expect(lid >= instru_session->nb_loops,0))
 	{
-		fprintf(stdout,"Error trying to access an undefined loop (lid %d,tid %d)\n",lid,tid);
+		fprintf(stdout,"Error trying to access an undefined loop (lid %d,tid %d)\n",lid,thread->id);
 	}
 	else
 	{
 		rdtscll(loop->stop_cycles);
 		tmp_cycles  = loop->stop_cycles - loop->start_cycles;
 		/*if(tmp_cycles < 0)
-			fprintf(stdout,"Detected an incoherent measure from rdtsc call (lid %d,eid %d,tid %d)\n",lid,edgeid,tid);
+			fprintf(stdout,"Detected an incoherent measure from rdtsc call (lid %d,eid %d,tid %d)\n",lid,edgeid,thread->id);
 		else
 		{*/
 			loop->elapsed_cycles 	+= tmp_cycles;
@@ -427,8 +489,8 @@ void instru_loop_tstop_count(int lid,int edgeid)
 			loop->stop_cycles 	 	= 0;
 		//}
 	}
-	if(edgeid >= instru_session->nb_edges){
-		fprintf(stdout,"Error trying to update an undefined edge (eid %d,tid %d)\n",edgeid,tid);
+	if(__builtin_expect(edgeid >= instru_session->nb_edges,0)){
+		fprintf(stdout,"Error trying to update an undefined edge (eid %d,tid %d)\n",edgeid,thread->id);
 	}else{
 		edges[edgeid]++;
 	}
@@ -437,18 +499,18 @@ void instru_loop_tstop_count(int lid,int edgeid)
 void instru_loop_backedge_count(int lid,int edgeid)
 {
 	//fprintf(stderr,"In instru_loop_backedge_count lid = %d edgeid = %d\n",lid,edgeid);
-	int tid				            = get_thread_id();
-	loop_t *loop 		          = &instru_session->threads[tid].loops[lid];
-	unsigned long long *edges = instru_session->threads[tid].edges;
+	thread_t *thread = _get_thread();
+	loop_t *loop 		          = &thread->loops[lid];
+	unsigned long long *edges = thread->edges;
 
-	if(loop == NULL || lid > instru_session->nb_loops){
-		fprintf(stdout,"Error trying to update an undefined loop (lid %d,tid %d)\n",lid,tid);
+	if(__builtin_expect(lid >= instru_session->nb_loops,0)){
+		fprintf(stdout,"Error trying to update an undefined loop (lid %d,tid %d)\n",lid,thread->id);
 	}else{
 		loop->iters++;
 	}
 
-	if(edgeid >= instru_session->nb_edges){
-		fprintf(stdout,"Error trying to update an undefined edgeid (eid %d,tid %d)\n",edgeid,tid);
+	if(__builtin_expect(edgeid >= instru_session->nb_edges,0)){
+		fprintf(stdout,"Error trying to update an undefined edgeid (eid %d,tid %d)\n",edgeid,thread->id);
 	}else{
 		edges[edgeid]++;
 	}
@@ -457,11 +519,11 @@ void instru_loop_backedge_count(int lid,int edgeid)
 void instru_block_count(int edgeid)
 {
 	//fprintf(stdout,"In instru_loop_count edgeid = %d\n",edgeid);
-	int tid	= get_thread_id();
-	unsigned long long *edges = instru_session->threads[tid].edges;
+	thread_t *thread = _get_thread();
+	unsigned long long *edges = thread->edges;
 
-	if(edgeid >= instru_session->nb_edges){
-		fprintf(stdout,"Error trying to update an undefined edge (eid %d,tid %d)\n",edgeid,tid);
+	if(__builtin_expect(edgeid >= instru_session->nb_edges,0)){
+		fprintf(stdout,"Error trying to update an undefined edge (eid %d,tid %d)\n",edgeid,thread->id);
 	}else{
 		edges[edgeid]++;
 	}
@@ -479,7 +541,7 @@ void instru_terminate(void)
          {
             fprintf(stdout,"Function %d being stop because of early exit (tid %d,depth %lld)\n",
             		j,i,instru_session->threads[i].functions[j].depth);
-            instru_fct_tstop(j);
+            _fct_tstop(&instru_session->threads[i].functions[j]);
          }
       }
    }
@@ -526,11 +588,14 @@ void instru_dump(unsigned long long wall_cycles)
   for (bif = imcp; bif->id != -1; bif++)
      fprintf(stdout,"Bench time for %s => AVG Overhead = %d cycles\n",bif->name,bif->avg_overhead );*/
 
+  //Prices of one probe, measured with nb_threads threads running probes concurrently
   fprintf(trace,"price_tprobe = %d,\n",imcp[1].avg_overhead - imcp[0].avg_overhead);
-	fprintf(trace,"price_fct = %d,\n",imcp[0].avg_overhead);
-	fprintf(trace,"price_call = %d,\n",imcp[0].avg_overhead);
-	fprintf(trace,"price_loop = %d,\n",imcp[0].avg_overhead);
-	fprintf(trace,"price_loop_count = %d,\n",imcp[0].avg_overhead);
+	fprintf(trace,"price_fct = %d,\n",imcp[2].avg_overhead);
+	fprintf(trace,"price_call = %d,\n",imcp[3].avg_overhead);
+	fprintf(trace,"price_loop = %d,\n",imcp[4].avg_overhead);
+	fprintf(trace,"price_loop_count = %d,\n",imcp[5].avg_overhead);
+	fprintf(trace,"price_block_count = %d,\n",imcp[6].avg_overhead);
+	fprintf(trace,"price_nb_threads = %d,\n",instru_session->nb_threads);
 	fprintf(trace,"pname = \"%s\",\n",instru_session->pname);
 	fprintf(trace,"binfilename = \"%s\",\n",instru_session->binfilename);
 	fprintf(trace,"binfile_hash = \"%s\",\n",instru_session->binfile_hash);
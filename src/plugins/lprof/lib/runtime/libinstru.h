@@ -33,6 +33,12 @@
 #include "typedefs.h"
 #include "rdtsc.h"
 
+/* Alignment of the per-thread counters. Two 64-byte lines, since the adjacent line
+ * prefetcher of x86 cores fetches lines by pairs: this keeps the counters of two
+ * threads from ever being in the same prefetched pair */
+#define INSTRU_CACHE_LINE 128
+#define INSTRU_ALIGN(S) (((S) + INSTRU_CACHE_LINE - 1) & ~((size_t)INSTRU_CACHE_LINE - 1))
+
 typedef struct loop_s{
    unsigned long long elapsed_cycles;
    unsigned long long start_cycles;
@@ -63,6 +69,8 @@ typedef struct thread_s{
    unsigned long long *edges; /**<table of edges*/
    call_t *calls;             /**<table of calls*/
    /* All of these tables : indexed by id defined in the intrumentation's lua companion file*/
+   void *counters;            /**<block holding all the tables, aligned and padded on INSTRU_CACHE_LINE*/
+   int id;                    /**<index of the thread in the session*/
 }thread_t;
 
 typedef struct instru_s{
@@ -90,9 +98,10 @@ extern void instru_unload(void);
 extern void instru_init(char *pname,char* binfilename,int threading_type,int nb_threads,
 						int nb_functions,int nb_calls,int nb_loops,int nb_edges,
 						char *companion,char *binfile_hash);
-extern bench_instru_fcts *intru_probes_price(void);
+extern bench_instru_fcts *intru_probes_price(int nb_threads);
 extern void intru_probes_warmup(void);
 extern void instru_terminate();
+extern void instru_bind_thread(int tid);
 extern void instru_fct_tstart(int fid);
 extern void instru_fct_tstop(int fid);
 extern void instru_fct_call_tstart(int callid);
@@ -102,6 +111,8 @@ extern void instru_loop_tstart_count(int lid,int edgeid);
 extern void instru_loop_tstop(int lid);
 extern void instru_loop_tstop_count(int lid,int edgeid);
 extern void instru_loop_count(int edgeid);
+extern void instru_loop_backedge_count(int lid,int edgeid);
+extern void instru_block_count(int edgeid);
 extern void instru_dump(unsigned long long wall_cycles);
 extern void instru_free(void);
 
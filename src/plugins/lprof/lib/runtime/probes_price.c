@@ -18,19 +18,40 @@
    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
  */
 
+#include <pthread.h>
 #include "libinstru.h"
 
 // Only used at initialization for overhead benchmarking
 static bench_instru_fcts functions_to_bench[] = {
 		{0,"instru_probes_call_empty",0},
 		{1,"instru_probes_call_rdtsc",0},
-		/*{2,"instru_fct_tstop",0},
-		{3,"instru_fct_call_tstop",0},
-		{4,"instru_loop_tstop",0},
-		{5,"instru_loop_tstop_count",0},*/
+		{2,"instru_fct_tstart/instru_fct_tstop",0},
+		{3,"instru_fct_call_tstart/instru_fct_call_tstop",0},
+		{4,"instru_loop_tstart/instru_loop_tstop",0},
+		{5,"instru_loop_tstart_count/instru_loop_tstop_count",0},
+		{6,"instru_block_count",0},
 		{-1,"",0}
 };
 
+// Number of probes called by instru_dummy for each benchmarked function
+static const int probes_per_call[] = {1,1,2,2,2,2,1};
+
+// Starting line of the threads running a benchmark
+typedef struct bench_start_s {
+	pthread_mutex_t lock;
+	pthread_cond_t cond;
+	int ready;                    /**<number of threads waiting for the start*/
+	int go;                       /**<set when all threads can start*/
+} bench_start_t;
+
+// Data of a thread running a benchmark
+typedef struct bench_thread_s {
+	int tid;                      /**<index of the thread in the session*/
+	int id;                       /**<id of the benchmarked function*/
+	bench_start_t *start;         /**<starting line shared by all threads*/
+	unsigned long long cycles;    /**<cycles spent by the thread in the benchmark*/
+} bench_thread_t;
+
 #define WARMITERS 1024
 #define FORI 512
 #define FORJ 512
@@ -72,37 +93,143 @@ void instru_probes_call_rdtsc(void)
 
 /*
  * Used to measurate a part of the instrumentation overhead
- * \param id action to do.
+ * \param id action to do (probes operate on function, call, loop and edge 0)
  *    0 => call a dummy function
- *    1 => function probe
- *    2 => call probe
- *    3 => loop probe
- *    4 => loop_count probe
+ *    1 => call a function reading the timer
+ *    2 => function probes
+ *    3 => call probes
+ *    4 => loop probes
+ *    5 => loop_count probes
+ *    6 => block_count probe
+ */
+static void __attribute__ ((noinline)) instru_dummy(int id)
+{
+	switch(id)
+	{
+		case 0:
+			instru_probes_call_empty();
+			break;
+		case 1:
+			instru_probes_call_rdtsc();
+			break;
+		case 2:
+			instru_fct_tstart(0);
+			instru_fct_tstop(0);
+			break;
+		case 3:
+			instru_fct_call_tstart(0);
+			instru_fct_call_tstop(0);
+			break;
+		case 4:
+			instru_loop_tstart(0);
+			instru_loop_tstop(0);
+			break;
+		case 5:
+			instru_loop_tstart_count(0,0);
+			instru_loop_tstop_count(0,0);
+			break;
+		case 6:
+			instru_block_count(0);
+			break;
+	}
+}
+
+/*
+ * Runs a benchmark in a thread, using the data of the thread bt->tid
+ * \param arg a bench_thread_t structure
+ * \return NULL
  */
-static void instru_dummy(int id)
+static void *bench_thread(void *arg)
 {
+	bench_thread_t *bt = (bench_thread_t *)arg;
+	unsigned long long start_cycles,stop_cycles;
+	int i,j;
+
+	instru_bind_thread(bt->tid);
+	if(bt->tid != 0)
+	{
+		pthread_mutex_lock(&bt->start->lock);
+		bt->start->ready++;
+		pthread_cond_broadcast(&bt->start->cond);
+		while(!bt->start->go)
+			pthread_cond_wait(&bt->start->cond,&bt->start->lock);
+		pthread_mutex_unlock(&bt->start->lock);
+	}
+
+	rdtscll(start_cycles);
+	for(i=0;i<FORI;i++)
+		for(j=0;j<FORJ;j++)
+			instru_dummy(bt->id);
+	rdtscll(stop_cycles);
+	bt->cycles = stop_cycles - start_cycles;
+
+	return NULL;
 }
 
 /*
- *
+ * Measures the average price of each probe when nb_threads threads are calling
+ * probes at the same time. The current session must have at least nb_threads threads.
+ * \param nb_threads number of threads running probes concurrently
+ * \return the array of benchmarked functions, ended by an element of id -1
  */
-bench_instru_fcts *intru_probes_price(void)
+bench_instru_fcts *intru_probes_price(int nb_threads)
 {
-   int i,j;
-   unsigned long long start_cycles,stop_cycles,tmp_cycles;
    bench_instru_fcts *bif;
+   bench_thread_t *bts;
+   bench_start_t start;
+   pthread_t *threads;
+   int i,nb_started;
+
+   if(nb_threads < 1)
+      nb_threads = 1;
+   bts = (bench_thread_t *)malloc(sizeof(bench_thread_t)*nb_threads);
+   threads = (pthread_t *)malloc(sizeof(pthread_t)*nb_threads);
+   pthread_mutex_init(&start.lock,NULL);
+   pthread_cond_init(&start.cond,NULL);
 
    for (bif = functions_to_bench; bif->id != -1; bif++)
    {
-      rdtscll(start_cycles);
-      for(i=0;i<FORI;i++)
-         for(j=0;j<FORJ;j++)
-            instru_dummy(bif->id);
-      rdtscll(stop_cycles);
-      tmp_cycles  = stop_cycles - start_cycles;
-      bif->avg_overhead = tmp_cycles / (FORI * FORJ);
-      //fprintf(stdout,"Bench time for %s => AVG Overhead = %d cycles\n",bif->name,bif->avg_overhead );
+      unsigned long long tmp_cycles = 0;
+
+      start.ready = 0;
+      start.go    = 0;
+      for(i=0;i<nb_threads;i++)
+      {
+         bts[i].tid    = i;
+         bts[i].id     = bif->id;
+         bts[i].start  = &start;
+         bts[i].cycles = 0;
+      }
+      // The calling thread is thread 0: it starts the others once they are all ready
+      for(nb_started=1;nb_started<nb_threads;nb_started++)
+         if(pthread_create(&threads[nb_started],NULL,bench_thread,&bts[nb_started]) != 0)
+            break;
+      if(nb_started < nb_threads)
+      {
+         fprintf(stderr,"MAQAO Instrumentation runtime: probes priced with %d threads instead of %d\n",
+               nb_started,nb_threads);
+         nb_threads = nb_started;
+      }
+      pthread_mutex_lock(&start.lock);
+      while(start.ready < nb_started - 1)
+         pthread_cond_wait(&start.cond,&start.lock);
+      start.go = 1;
+      pthread_cond_broadcast(&start.cond);
+      pthread_mutex_unlock(&start.lock);
+
+      bench_thread(&bts[0]);
+      for(i=1;i<nb_started;i++)
+         pthread_join(threads[i],NULL);
+
+      for(i=0;i<nb_started;i++)
+         tmp_cycles += bts[i].cycles;
+      bif->avg_overhead = tmp_cycles / ((unsigned long long)nb_started * FORI * FORJ * probes_per_call[bif->id]);
+      //fprintf(stdout,"Bench time for %s => AVG Overhead = %d cycles (%d threads)\n",bif->name,bif->avg_overhead,nb_started);
    }
+   pthread_cond_destroy(&start.cond);
+   pthread_mutex_destroy(&start.lock);
+   free(threads);
+   free(bts);
 
    return functions_to_bench;
 }
@@ -21,5 +21,37 @@
 #ifndef _RDTSC_H_
 #define _RDTSC_H_
 
+#include <stdint.h>
+#include <time.h>
+
+/*
+ * Reads the timer used by the probes into val (unsigned long long)
+ * - x86: rdtscp (CPU reference cycles). Unlike rdtsc, it waits for all previous
+ *   instructions to complete, so the probed code is not overlapped with the read
+ * - ARM64: virtual counter of the generic timer (cntvct_el0 ticks), isb prevents
+ *   the counter from being read ahead of the previous instructions
+ * - other architectures: CLOCK_MONOTONIC, in nanoseconds
+ */
+#if defined(__x86_64__) || defined(__i386__)
+#define rdtscll(val) do {                                                  \
+      uint32_t __lo, __hi, __aux;                                          \
+      __asm__ __volatile__ ("rdtscp" : "=a" (__lo), "=d" (__hi), "=c" (__aux)); \
+      (void) __aux;                                                        \
+      (val) = ((unsigned long long) __hi << 32) | __lo;                    \
+   } while (0)
+#elif defined(__aarch64__)
+#define rdtscll(val) do {                                                  \
+      uint64_t __cnt;                                                      \
+      __asm__ __volatile__ ("isb\n\tmrs %0, cntvct_el0" : "=r" (__cnt) :: "memory"); \
+      (val) = __cnt;                                                       \
+   } while (0)
+#else
+#define rdtscll(val) do {                                                  \
+      struct timespec __ts;                                                \
+      clock_gettime (CLOCK_MONOTONIC, &__ts);                              \
+      (val) = (unsigned long long) __ts.tv_sec * 1000000000ULL + __ts.tv_nsec; \
+   } while (0)
+#endif
+
 #endif
 
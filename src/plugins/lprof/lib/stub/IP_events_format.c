@@ -182,20 +182,7 @@ int read_IP_events  (FILE *fp, raw_IP_events_t *IP_events, unsigned HW_evts_per_
    size_t nb_callchains;
    if (fread (&nb_callchains, sizeof nb_callchains, 1, fp) != 1) return -3;
    IP_events->nb_callchains = nb_callchains;
-
-   if (nb_callchains > IP_events->max_nb_callchains) {
-      size_t new_max = MAX (2 * IP_events->max_nb_callchains, nb_callchains);
-      IP_events->callchains = lc_realloc (IP_events->callchains,
-                                          new_max * sizeof IP_events->callchains[0]);
-
-      unsigned i;
-      for (i=IP_events->max_nb_callchains; i<new_max; i++) {
-         uint64_t *IPs = lc_malloc0 (IP_events->max_callchain_len *
-                                             sizeof IPs[0]);
-         IP_events->callchains[i].IPs = IPs;
-      }
-      IP_events->max_nb_callchains = new_max;
-   }
+   raw_IP_events_reserve_callchains (IP_events, nb_callchains);
 
    // Callchains: for each callchain
    unsigned i;
@@ -209,16 +196,7 @@ int read_IP_events  (FILE *fp, raw_IP_events_t *IP_events, unsigned HW_evts_per_
       if (fread (&nb_IPs, sizeof nb_IPs, 1, fp) != 1) return -5;
 
       // Realloc/alloc as needed
-      if (nb_IPs > IP_events->max_callchain_len) {
-         size_t new_max = MAX (2 * IP_events->max_callchain_len, nb_IPs);
-         unsigned j;
-         for (j=0; j<IP_events->max_nb_callchains; j++) {
-            uint64_t *IPs = lc_realloc (IP_events->callchains[j].IPs,
-                                                new_max * sizeof IPs[0]);
-            IP_events->callchains[j].IPs = IPs;
-         }
-         IP_events->max_callchain_len = new_max;
-      }
+      raw_IP_events_reserve_callchain_len (IP_events, nb_IPs);
 
       IP_callchain_t *cc = &(IP_events->callchains[i]);
       cc->nb_hits = nb_hits;
@@ -232,6 +210,88 @@ int read_IP_events  (FILE *fp, raw_IP_events_t *IP_events, unsigned HW_evts_per_
    return 0;
 }
 
+// Same format as write_IP_events, from data read by read_IP_events or merged by raw_IP_events_add_callchain
+int write_raw_IP_events (FILE *fp, const raw_IP_events_t *IP_events, unsigned HW_evts_per_grp)
+{
+   // Address/IP
+   if (fwrite (&(IP_events->ip), sizeof IP_events->ip, 1, fp) != 1) return -1;
+
+   // eventsNb (hit counts for each HW event)
+   const hits_nb_t *eventsNb = IP_events->eventsNb;
+   if (fwrite (eventsNb, sizeof eventsNb[0], HW_evts_per_grp, fp) != HW_evts_per_grp)
+      return -2;
+
+   // Callchains: number of callchains
+   size_t nb_callchains = IP_events->nb_callchains;
+   if (fwrite (&nb_callchains, sizeof nb_callchains, 1, fp) != 1) return -3;
+
+   // Callchains: for each callchain
+   unsigned i;
+   for (i=0; i<nb_callchains; i++) {
+      const IP_callchain_t *callchain = &(IP_events->callchains[i]);
+      if (fwrite (&(callchain->nb_hits), sizeof callchain->nb_hits, 1, fp) != 1) return -4;
+      if (fwrite (&(callchain->nb_IPs) , sizeof callchain->nb_IPs , 1, fp) != 1) return -5;
+      if (fwrite (callchain->IPs, sizeof callchain->IPs[0], callchain->nb_IPs, fp) != callchain->nb_IPs)
+         return -6;
+   }
+
+   return 0;
+}
+
+// Ensures that at least nb_callchains callchains can be stored in IP_events
+void raw_IP_events_reserve_callchains (raw_IP_events_t *IP_events, size_t nb_callchains)
+{
+   if (nb_callchains <= IP_events->max_nb_callchains) return;
+
+   size_t new_max = MAX (2 * IP_events->max_nb_callchains, nb_callchains);
+   IP_events->callchains = lc_realloc (IP_events->callchains,
+                                       new_max * sizeof IP_events->callchains[0]);
+
+   unsigned i;
+   for (i=IP_events->max_nb_callchains; i<new_max; i++) {
+      uint64_t *IPs = lc_malloc0 (IP_events->max_callchain_len *
+                                  sizeof IPs[0]);
+      IP_events->callchains[i].IPs = IPs;
+   }
+   IP_events->max_nb_callchains = new_max;
+}
+
+// Ensures that callchains of nb_IPs addresses can be stored in IP_events
+void raw_IP_events_reserve_callchain_len (raw_IP_events_t *IP_events, size_t nb_IPs)
+{
+   if (nb_IPs <= IP_events->max_callchain_len) return;
+
+   size_t new_max = MAX (2 * IP_events->max_callchain_len, nb_IPs);
+   unsigned j;
+   for (j=0; j<IP_events->max_nb_callchains; j++) {
+      uint64_t *IPs = lc_realloc (IP_events->callchains[j].IPs,
+                                  new_max * sizeof IPs[0]);
+      IP_events->callchains[j].IPs = IPs;
+   }
+   IP_events->max_callchain_len = new_max;
+}
+
+// Adds hits for a callchain to IP_events, appending the callchain if not already present
+void raw_IP_events_add_callchain (raw_IP_events_t *IP_events, hits_nb_t nb_hits,
+                                  uint32_t nb_IPs, const uint64_t *IPs)
+{
+   size_t i;
+   for (i=0; i<IP_events->nb_callchains; i++) {
+      IP_callchain_t *cc = &(IP_events->callchains[i]);
+      if (cc->nb_IPs == nb_IPs && memcmp (cc->IPs, IPs, nb_IPs * sizeof IPs[0]) == 0) {
+         cc->nb_hits += nb_hits;
+         return;
+      }
+   }
+
+   raw_IP_events_reserve_callchains (IP_events, IP_events->nb_callchains + 1);
+   raw_IP_events_reserve_callchain_len (IP_events, nb_IPs);
+   IP_callchain_t *cc = &(IP_events->callchains[IP_events->nb_callchains++]);
+   cc->nb_hits = nb_hits;
+   cc->nb_IPs = nb_IPs;
+   memcpy (cc->IPs, IPs, nb_IPs * sizeof IPs[0]);
+}
+
 raw_IP_events_t *raw_IP_events_new (unsigned HW_evts_per_grp)
 {
    raw_IP_events_t *new = lc_malloc0 (sizeof *new);
@@ -50,6 +50,11 @@ int read_IP_events_header  (FILE *fp, uint64_t *tid, unsigned *events_nb);
 
 int write_IP_events (FILE *fp, uint64_t ip, const IP_events_t *IP_events, unsigned HW_evts_per_grp);
 int read_IP_events  (FILE *fp, raw_IP_events_t *raw_IP_events, unsigned HW_evts_per_grp);
+int write_raw_IP_events (FILE *fp, const raw_IP_events_t *raw_IP_events, unsigned HW_evts_per_grp);
 
 raw_IP_events_t *raw_IP_events_new (unsigned HW_evts_per_grp);
 void raw_IP_events_free (raw_IP_events_t *IP_events);
+void raw_IP_events_reserve_callchains (raw_IP_events_t *IP_events, size_t nb_callchains);
+void raw_IP_events_reserve_callchain_len (raw_IP_events_t *IP_events, size_t nb_IPs);
+void raw_IP_events_add_callchain (raw_IP_events_t *IP_events, hits_nb_t nb_hits,
+                                  uint32_t nb_IPs, const uint64_t *IPs);
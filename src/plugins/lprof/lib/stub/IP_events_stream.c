@@ -0,0 +1,483 @@
+/*
+   Copyright (C) 2004 - 2018 Université de Versailles Saint-Quentin-en-Yvelines (UVSQ)
+
+   This file is part of MAQAO.
+
+  MAQAO is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public License
+   as published by the Free Software Foundation; either version 3
+   of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+/* Defines functions to write/read IP events temporary files as a stream of chunks
+ *
+ * Samples file: concatenation of chunks, one chunk per flush of a files buffer.
+ * A chunk is a sequence of records sorted by TID then IP, each record being:
+ *  - TID delta from previous record, IP delta from previous record of same TID
+ *  - hit count for each HW event
+ *  - number of callchains, then for each: hits, length and IPs (zigzag delta from previous IP)
+ * All integers are LEB128 varints. Index file: one IP_events_chunk_t per chunk.
+ *
+ * Chunks are encoded by sampler threads then written by a background thread,
+ * so that sampling is not stalled by disk I/O. */
+
+#include <stdio.h>
+#include <stdlib.h>      // qsort
+#include <string.h>      // memset
+#include <unistd.h>      // pread, write, close
+#include <fcntl.h>       // open
+#include <pthread.h>
+#include "IP_events_stream.h"
+
+///////////////////////////////////////////////////////////////////////////////
+//                              Encoding                                     //
+///////////////////////////////////////////////////////////////////////////////
+
+// Growing bytes buffer receiving an encoded chunk
+typedef struct {
+   uint8_t *data;
+   size_t size;
+   size_t max_size;
+} chunk_buf_t;
+
+static inline void put_varint (chunk_buf_t *cb, uint64_t value)
+{
+   // A 64 bits varint takes at most 10 bytes
+   if (cb->size + 10 > cb->max_size) {
+      cb->max_size = (cb->max_size * 2) + 10;
+      cb->data = lc_realloc (cb->data, cb->max_size);
+   }
+
+   while (value >= 0x80) {
+      cb->data [cb->size++] = (uint8_t) (value | 0x80);
+      value >>= 7;
+   }
+   cb->data [cb->size++] = (uint8_t) value;
+}
+
+// Maps signed deltas to small unsigned values: 0,-1,1,-2... => 0,1,2,3...
+static inline uint64_t zigzag_encode (int64_t value)
+{
+   return ((uint64_t) value << 1) ^ (uint64_t) (value >> 63);
+}
+
+static inline int64_t zigzag_decode (uint64_t value)
+{
+   return (int64_t) (value >> 1) ^ -(int64_t) (value & 1);
+}
+
+static int cmp_IP_events_ref (const void *a, const void *b)
+{
+   const IP_events_ref_t *ra = a;
+   const IP_events_ref_t *rb = b;
+
+   if (ra->tid != rb->tid) return ra->tid < rb->tid ? -1 : 1;
+   if (ra->ip  != rb->ip ) return ra->ip  < rb->ip  ? -1 : 1;
+   return 0;
+}
+
+// Returns IP events of a TID to (IP to IP_events) table, sorted by TID then IP
+IP_events_ref_t *IP_events_sort (const lprof_hashtable_t *tid2ipt, size_t *nb_refs)
+{
+   size_t nb = 0;
+   {
+      FOREACH_IN_LPROF_HASHTABLE (tid2ipt, tid_iter) {
+         lprof_hashtable_t *const ip2smp = GET_DATA (tid_iter);
+         FOREACH_IN_LPROF_HASHTABLE (ip2smp, ip_iter) nb++;
+      }
+   }
+
+   IP_events_ref_t *refs = lc_malloc ((nb > 0 ? nb : 1) * sizeof refs[0]);
+   size_t i = 0;
+   FOREACH_IN_LPROF_HASHTABLE (tid2ipt, tid_iter) {
+      const uint64_t tid = GET_KEY (uint64_t, tid_iter);
+      lprof_hashtable_t *const ip2smp = GET_DATA (tid_iter);
+      FOREACH_IN_LPROF_HASHTABLE (ip2smp, ip_iter) {
+         refs[i].tid = tid;
+         refs[i].ip  = GET_KEY (uint64_t, ip_iter);
+         refs[i].IP_events = GET_DATA (ip_iter);
+         i++;
+      }
+   }
+
+   qsort (refs, nb, sizeof refs[0], cmp_IP_events_ref);
+   *nb_refs = nb;
+
+   return refs;
+}
+
+// Encodes sorted IP events to a chunk buffer
+static void encode_chunk (chunk_buf_t *cb, const IP_events_ref_t *refs, size_t nb_refs,
+                          unsigned HW_evts_per_grp)
+{
+   uint64_t prev_tid = 0, prev_ip = 0;
+   size_t i;
+   for (i=0; i<nb_refs; i++) {
+      const IP_events_ref_t *ref = &refs[i];
+      if (ref->tid != prev_tid) prev_ip = 0;
+      put_varint (cb, ref->tid - prev_tid);
+      put_varint (cb, ref->ip  - prev_ip);
+      prev_tid = ref->tid;
+      prev_ip  = ref->ip;
+
+      // eventsNb (hit counts for each HW event)
+      unsigned ev;
+      for (ev=0; ev<HW_evts_per_grp; ev++)
+         put_varint (cb, ref->IP_events->eventsNb [ev]);
+
+      // Callchains
+      put_varint (cb, lprof_queue_length (ref->IP_events->callchains));
+      FOREACH_IN_LPROF_QUEUE (ref->IP_events->callchains, cc_iter) {
+         const IP_callchain_t *callchain = GET_DATA_T (IP_callchain_t *, cc_iter);
+         put_varint (cb, callchain->nb_hits);
+         put_varint (cb, callchain->nb_IPs);
+
+         uint64_t prev_cc_ip = ref->ip;
+         uint32_t j;
+         for (j=0; j<callchain->nb_IPs; j++) {
+            put_varint (cb, zigzag_encode ((int64_t) (callchain->IPs[j] - prev_cc_ip)));
+            prev_cc_ip = callchain->IPs[j];
+         }
+      }
+   }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+//                              Writer                                       //
+///////////////////////////////////////////////////////////////////////////////
+
+struct IP_events_stream_writer_s {
+   int fd;            // samples file
+   FILE *fp_idx;      // index file
+   uint64_t size;     // size of chunks written or waiting to be written
+   uint64_t offset;   // offset of the next chunk to write (writer thread only)
+
+   // Chunks waiting to be written (circular buffer)
+   chunk_buf_t pending [IP_EVENTS_STREAM_MAX_PENDING];
+   uint64_t pending_nb_records [IP_EVENTS_STREAM_MAX_PENDING];
+   unsigned first_pending;
+   unsigned nb_pending;
+
+   boolean_t closing;
+   boolean_t error;
+   pthread_t thread;
+   pthread_mutex_t lock;
+   pthread_cond_t cond;
+};
+
+// Writes size bytes to fd, retrying after partial writes
+static int write_all (int fd, const uint8_t *data, size_t size)
+{
+   while (size > 0) {
+      ssize_t ret = write (fd, data, size);
+      if (ret <= 0) return -1;
+      data += ret;
+      size -= ret;
+   }
+
+   return 0;
+}
+
+// Background thread: writes pending chunks and related index entries
+static void *writer_routine (void *pwriter)
+{
+   IP_events_stream_writer_t *writer = pwriter;
+
+   pthread_mutex_lock (&writer->lock);
+   while (TRUE) {
+      while (writer->nb_pending == 0 && writer->closing == FALSE)
+         pthread_cond_wait (&writer->cond, &writer->lock);
+      if (writer->nb_pending == 0) break; // closing and nothing left
+
+      chunk_buf_t *cb = &(writer->pending [writer->first_pending]);
+      IP_events_chunk_t chunk = { .offset = writer->offset, .size = cb->size,
+                                  .nb_records = writer->pending_nb_records [writer->first_pending] };
+      pthread_mutex_unlock (&writer->lock);
+
+      // Writing done without lock: sampler thread can encode the next chunk meanwhile
+      boolean_t error = FALSE;
+      if (write_all (writer->fd, cb->data, cb->size) != 0 ||
+          fwrite (&chunk, sizeof chunk, 1, writer->fp_idx) != 1)
+         error = TRUE;
+      lc_free (cb->data);
+      cb->data = NULL;
+
+      pthread_mutex_lock (&writer->lock);
+      writer->offset += chunk.size;
+      if (error == TRUE) writer->error = TRUE;
+      writer->first_pending = (writer->first_pending + 1) % IP_EVENTS_STREAM_MAX_PENDING;
+      writer->nb_pending--;
+      pthread_cond_broadcast (&writer->cond);
+   }
+   pthread_mutex_unlock (&writer->lock);
+
+   return NULL;
+}
+
+// Creates samples and index files and starts the related writer thread
+IP_events_stream_writer_t *IP_events_stream_writer_new (const char *file_name, const char *idx_file_name)
+{
+   int fd = open (file_name, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+   if (fd == -1) return NULL;
+   FILE *fp_idx = fopen (idx_file_name, "wb");
+   if (!fp_idx) { close (fd); return NULL; }
+
+   IP_events_stream_writer_t *writer = lc_malloc0 (sizeof *writer);
+   writer->fd = fd;
+   writer->fp_idx = fp_idx;
+   writer->closing = FALSE;
+   writer->error = FALSE;
+   pthread_mutex_init (&writer->lock, NULL);
+   pthread_cond_init (&writer->cond, NULL);
+
+   if (pthread_create (&writer->thread, NULL, writer_routine, writer) != 0) {
+      pthread_mutex_destroy (&writer->lock);
+      pthread_cond_destroy (&writer->cond);
+      fclose (fp_idx); close (fd);
+      lc_free (writer);
+      return NULL;
+   }
+
+   return writer;
+}
+
+/* Encodes content of a TID to (IP to IP_events) table as a new chunk and queues it for writing
+ * Waits if too many chunks are already waiting to be written. Table can be reset on return */
+int IP_events_stream_write_chunk (IP_events_stream_writer_t *writer, const lprof_hashtable_t *tid2ipt,
+                                  unsigned HW_evts_per_grp)
+{
+   size_t nb_refs;
+   IP_events_ref_t *refs = IP_events_sort (tid2ipt, &nb_refs);
+   if (nb_refs == 0) { lc_free (refs); return 0; }
+
+   // Encoding done without lock: writer thread can write the previous chunk meanwhile
+   chunk_buf_t cb = { .data = NULL, .size = 0, .max_size = 0 };
+   encode_chunk (&cb, refs, nb_refs, HW_evts_per_grp);
+   lc_free (refs);
+
+   pthread_mutex_lock (&writer->lock);
+   while (writer->nb_pending == IP_EVENTS_STREAM_MAX_PENDING)
+      pthread_cond_wait (&writer->cond, &writer->lock);
+   const unsigned rank = (writer->first_pending + writer->nb_pending) % IP_EVENTS_STREAM_MAX_PENDING;
+   writer->pending [rank] = cb;
+   writer->pending_nb_records [rank] = nb_refs;
+   writer->nb_pending++;
+   writer->size += cb.size;
+   const boolean_t error = writer->error;
+   pthread_cond_broadcast (&writer->cond);
+   pthread_mutex_unlock (&writer->lock);
+
+   return (error == TRUE) ? -1 : 0;
+}
+
+// Returns size of chunks written or waiting to be written
+uint64_t IP_events_stream_writer_get_size (IP_events_stream_writer_t *writer)
+{
+   pthread_mutex_lock (&writer->lock);
+   uint64_t size = writer->size;
+   pthread_mutex_unlock (&writer->lock);
+
+   return size;
+}
+
+// Waits for pending chunks to be written, closes files and frees the writer
+int IP_events_stream_writer_close (IP_events_stream_writer_t *writer)
+{
+   if (writer == NULL) return 0;
+
+   pthread_mutex_lock (&writer->lock);
+   writer->closing = TRUE;
+   pthread_cond_broadcast (&writer->cond);
+   pthread_mutex_unlock (&writer->lock);
+   pthread_join (writer->thread, NULL);
+
+   int ret = (writer->error == TRUE) ? -1 : 0;
+   if (close (writer->fd) != 0) ret = -1;
+   if (fclose (writer->fp_idx) != 0) ret = -1;
+   pthread_mutex_destroy (&writer->lock);
+   pthread_cond_destroy (&writer->cond);
+   lc_free (writer);
+
+   return ret;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+//                              Reader                                       //
+///////////////////////////////////////////////////////////////////////////////
+
+struct IP_events_stream_s {
+   int fd;                     // samples file, shared by cursors (read with pread)
+   IP_events_chunk_t *chunks;  // content of the index file
+   unsigned nb_chunks;
+};
+
+struct IP_events_cursor_s {
+   const IP_events_stream_t *stream;
+   uint64_t pos;        // offset in samples file of the next bytes to load
+   uint64_t end;        // end offset of the chunk
+   uint64_t nb_records; // number of records not yet read
+   uint64_t tid, ip;    // last decoded TID and IP (deltas base)
+   size_t buf_pos, buf_len;
+   uint8_t buf [IP_EVENTS_CURSOR_BUF_SIZE];
+};
+
+// Opens a samples file and loads its index. Returns NULL if no chunk was written
+IP_events_stream_t *IP_events_stream_open (const char *file_name, const char *idx_file_name)
+{
+   FILE *fp_idx = fopen (idx_file_name, "rb");
+   if (!fp_idx) return NULL;
+
+   IP_events_stream_t *stream = lc_malloc0 (sizeof *stream);
+   unsigned max_chunks = 0;
+   IP_events_chunk_t chunk;
+   while (fread (&chunk, sizeof chunk, 1, fp_idx) == 1) {
+      if (stream->nb_chunks == max_chunks) {
+         max_chunks = (max_chunks > 0) ? 2 * max_chunks : 16;
+         stream->chunks = lc_realloc (stream->chunks, max_chunks * sizeof stream->chunks[0]);
+      }
+      stream->chunks [stream->nb_chunks++] = chunk;
+   }
+   fclose (fp_idx);
+
+   stream->fd = (stream->nb_chunks > 0) ? open (file_name, O_RDONLY) : -1;
+   if (stream->fd == -1) {
+      lc_free (stream->chunks);
+      lc_free (stream);
+      return NULL;
+   }
+
+   return stream;
+}
+
+unsigned IP_events_stream_get_nb_chunks (const IP_events_stream_t *stream)
+{
+   return stream->nb_chunks;
+}
+
+void IP_events_stream_close (IP_events_stream_t *stream)
+{
+   if (stream == NULL) return;
+
+   close (stream->fd);
+   lc_free (stream->chunks);
+   lc_free (stream);
+}
+
+// Returns a cursor on the first record of a chunk
+IP_events_cursor_t *IP_events_cursor_new (const IP_events_stream_t *stream, unsigned chunk_rank)
+{
+   const IP_events_chunk_t *chunk = &(stream->chunks [chunk_rank]);
+
+   IP_events_cursor_t *cursor = lc_malloc (sizeof *cursor);
+   cursor->stream = stream;
+   cursor->pos = chunk->offset;
+   cursor->end = chunk->offset + chunk->size;
+   cursor->nb_records = chunk->nb_records;
+   cursor->tid = 0;
+   cursor->ip  = 0;
+   cursor->buf_pos = 0;
+   cursor->buf_len = 0;
+
+   return cursor;
+}
+
+void IP_events_cursor_free (IP_events_cursor_t *cursor)
+{
+   lc_free (cursor);
+}
+
+// Decodes a varint. Returns 0 on success, -1 if the chunk is truncated
+static int get_varint (IP_events_cursor_t *cursor, uint64_t *value)
+{
+   uint64_t result = 0;
+   unsigned shift = 0;
+
+   while (shift < 64) {
+      if (cursor->buf_pos == cursor->buf_len) {
+         // Load next bytes of the chunk
+         size_t len = cursor->end - cursor->pos;
+         if (len > sizeof cursor->buf) len = sizeof cursor->buf;
+         if (len == 0) return -1;
+         ssize_t ret = pread (cursor->stream->fd, cursor->buf, len, cursor->pos);
+         if (ret <= 0) return -1;
+         cursor->pos += ret;
+         cursor->buf_pos = 0;
+         cursor->buf_len = ret;
+      }
+
+      const uint8_t byte = cursor->buf [cursor->buf_pos++];
+      result |= (uint64_t) (byte & 0x7F) << shift;
+      if ((byte & 0x80) == 0) {
+         *value = result;
+         return 0;
+      }
+      shift += 7;
+   }
+
+   return -1;
+}
+
+/* Decodes the next record of a chunk to IP_events (its IP in IP_events->ip)
+ * Returns 1 if a record was read, 0 at end of chunk and -1 on read/format error */
+int IP_events_cursor_next (IP_events_cursor_t *cursor, uint64_t *tid,
+                           raw_IP_events_t *IP_events, unsigned HW_evts_per_grp)
+{
+   if (cursor->nb_records == 0) return 0;
+
+   // TID and IP
+   uint64_t tid_delta, ip_delta;
+   if (get_varint (cursor, &tid_delta) != 0) return -1;
+   if (get_varint (cursor, &ip_delta ) != 0) return -1;
+   if (tid_delta != 0) cursor->ip = 0;
+   cursor->tid += tid_delta;
+   cursor->ip  += ip_delta;
+   *tid = cursor->tid;
+   IP_events->ip = cursor->ip;
+
+   // eventsNb (hit counts for each HW event)
+   unsigned ev;
+   for (ev=0; ev<HW_evts_per_grp; ev++) {
+      uint64_t nb;
+      if (get_varint (cursor, &nb) != 0) return -1;
+      IP_events->eventsNb [ev] = (hits_nb_t) nb;
+   }
+
+   // Callchains
+   uint64_t nb_callchains;
+   if (get_varint (cursor, &nb_callchains) != 0) return -1;
+   raw_IP_events_reserve_callchains (IP_events, nb_callchains);
+   IP_events->nb_callchains = nb_callchains;
+
+   uint64_t i;
+   for (i=0; i<nb_callchains; i++) {
+      uint64_t nb_hits, nb_IPs;
+      if (get_varint (cursor, &nb_hits) != 0) return -1;
+      if (get_varint (cursor, &nb_IPs ) != 0) return -1;
+      raw_IP_events_reserve_callchain_len (IP_events, nb_IPs);
+
+      IP_callchain_t *cc = &(IP_events->callchains[i]);
+      cc->nb_hits = (hits_nb_t) nb_hits;
+      cc->nb_IPs  = (uint32_t) nb_IPs;
+
+      uint64_t prev_cc_ip = cursor->ip;
+      uint64_t j;
+      for (j=0; j<nb_IPs; j++) {
+         uint64_t delta;
+         if (get_varint (cursor, &delta) != 0) return -1;
+         prev_cc_ip += (uint64_t) zigzag_decode (delta);
+         cc->IPs[j] = prev_cc_ip;
+      }
+   }
+
+   cursor->nb_records--;
+   return 1;
+}
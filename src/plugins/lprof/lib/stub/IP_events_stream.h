@@ -0,0 +1,74 @@
+/*
+   Copyright (C) 2004 - 2018 Université de Versailles Saint-Quentin-en-Yvelines (UVSQ)
+
+   This file is part of MAQAO.
+
+  MAQAO is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public License
+   as published by the Free Software Foundation; either version 3
+   of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+/* Declares functions to write/read IP events temporary files as a stream of chunks
+ * Each chunk is the delta/varint encoded content of a sampler thread files buffer,
+ * with records sorted by TID then IP, so that chunks can be merged in a single pass */
+
+#ifndef __IP_EVENTS_STREAM_H__
+#define __IP_EVENTS_STREAM_H__
+
+#include "IP_events_format.h" // raw_IP_events_t
+
+// Maximum number of encoded chunks waiting to be written by a writer thread
+#define IP_EVENTS_STREAM_MAX_PENDING 2
+
+// Size of the read buffer of a cursor (one cursor per chunk during merge)
+#define IP_EVENTS_CURSOR_BUF_SIZE (16 * 1024)
+
+// Entry of the index file: location of a chunk in the samples file
+typedef struct {
+   uint64_t offset;     // offset of the first encoded record
+   uint64_t size;       // size in bytes of encoded records
+   uint64_t nb_records; // number of (TID, IP) records
+} IP_events_chunk_t;
+
+// Reference to IP events saved in a sampler thread buffer
+typedef struct {
+   uint64_t tid;
+   uint64_t ip;
+   IP_events_t *IP_events;
+} IP_events_ref_t;
+
+typedef struct IP_events_stream_writer_s IP_events_stream_writer_t;
+typedef struct IP_events_stream_s IP_events_stream_t;
+typedef struct IP_events_cursor_s IP_events_cursor_t;
+
+// Returns IP events of a TID to (IP to IP_events) table, sorted by TID then IP
+IP_events_ref_t *IP_events_sort (const lprof_hashtable_t *tid2ipt, size_t *nb_refs);
+
+// Writer: encodes chunks in sampler threads and writes them from a background thread
+IP_events_stream_writer_t *IP_events_stream_writer_new (const char *file_name, const char *idx_file_name);
+int IP_events_stream_write_chunk (IP_events_stream_writer_t *writer, const lprof_hashtable_t *tid2ipt,
+                                  unsigned HW_evts_per_grp);
+uint64_t IP_events_stream_writer_get_size (IP_events_stream_writer_t *writer);
+int IP_events_stream_writer_close (IP_events_stream_writer_t *writer);
+
+// Reader: a stream lists chunks, each chunk is read in streaming by a cursor
+IP_events_stream_t *IP_events_stream_open (const char *file_name, const char *idx_file_name);
+unsigned IP_events_stream_get_nb_chunks (const IP_events_stream_t *stream);
+void IP_events_stream_close (IP_events_stream_t *stream);
+
+IP_events_cursor_t *IP_events_cursor_new (const IP_events_stream_t *stream, unsigned chunk_rank);
+int IP_events_cursor_next (IP_events_cursor_t *cursor, uint64_t *tid,
+                           raw_IP_events_t *IP_events, unsigned HW_evts_per_grp);
+void IP_events_cursor_free (IP_events_cursor_t *cursor);
+
+#endif // __IP_EVENTS_STREAM_H__
@@ -0,0 +1,153 @@
+/*
+   Copyright (C) 2004 - 2018 Université de Versailles Saint-Quentin-en-Yvelines (UVSQ)
+
+   This file is part of MAQAO.
+
+  MAQAO is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public License
+   as published by the Free Software Foundation; either version 3
+   of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+/* Defines functions to build and search a flattened address index (CF address_index.h)
+ *
+ * Objects (functions/loops) can only change at bounds (start and stop+1 addresses of ranges,
+ * libraries mapping...): evaluating them once per bound gives non-overlapping segments,
+ * consecutive segments with same objects being merged. A lookup is then a predecessor search.
+ * Random lookups descend the Eytzinger layout (children of k at 2k and 2k+1: top levels
+ * share cache lines), sorted lookups walk segments from a cursor (galloping search). */
+
+#include <stdlib.h> // qsort
+#include "libmcommon.h"
+#include "address_index.h"
+
+static int compare_addresses (const void *p1, const void *p2)
+{
+   const uint64_t a1 = *((const uint64_t *) p1);
+   const uint64_t a2 = *((const uint64_t *) p2);
+
+   if (a1 < a2) return -1;
+   return a1 > a2 ? 1 : 0;
+}
+
+// Saves segments start addresses to Eytzinger layout by an in-order traversal, returns next rank
+static uint32_t fill_eytzinger (address_index_t *index, uint32_t rank, uint32_t k)
+{
+   if (k > index->nb_segments) return rank;
+
+   rank = fill_eytzinger (index, rank, 2 * k);
+   index->eytzinger      [k] = index->segments [rank].start;
+   index->eytzinger_rank [k] = rank;
+
+   return fill_eytzinger (index, rank + 1, 2 * k + 1);
+}
+
+address_index_t *address_index_new (uint64_t *bounds, size_t nb_bounds, address_resolver_t resolve, void *user)
+{
+   address_index_t *index = lc_malloc (sizeof *index);
+   address_segment_t *segments = lc_malloc ((nb_bounds + 1) * sizeof segments[0]);
+   uint32_t nb_segments = 0;
+
+   qsort (bounds, nb_bounds, sizeof bounds[0], compare_addresses);
+
+   size_t i = 0;
+   uint64_t start = 0;
+   for (;;) {
+      SinfoFunc *fct; SinfoLoop *loop;
+      resolve (start, user, &fct, &loop);
+
+      // New segment only if objects changed
+      if (nb_segments == 0 || segments [nb_segments-1].fct != fct || segments [nb_segments-1].loop != loop) {
+         segments [nb_segments].start = start;
+         segments [nb_segments].fct   = fct;
+         segments [nb_segments].loop  = loop;
+         nb_segments++;
+      }
+
+      // Go to next (unique) bound
+      while (i < nb_bounds && bounds [i] <= start) i++;
+      if (i == nb_bounds) break;
+      start = bounds [i];
+   }
+
+   index->nb_segments    = nb_segments;
+   index->segments       = lc_realloc (segments, nb_segments * sizeof segments[0]);
+   index->eytzinger      = lc_malloc ((nb_segments + 1) * sizeof index->eytzinger[0]);
+   index->eytzinger_rank = lc_malloc ((nb_segments + 1) * sizeof index->eytzinger_rank[0]);
+   fill_eytzinger (index, 0, 1);
+
+   return index;
+}
+
+void address_index_free (address_index_t *index)
+{
+   if (index == NULL) return;
+
+   lc_free (index->segments);
+   lc_free (index->eytzinger);
+   lc_free (index->eytzinger_rank);
+   lc_free (index);
+}
+
+const address_segment_t *address_index_lookup (const address_index_t *index, uint64_t addr)
+{
+   const uint64_t *eytzinger = index->eytzinger;
+   const uint32_t n = index->nb_segments;
+   uint32_t k = 1;
+
+   // Descend to the first start greater than addr (8 starts per cache line: prefetch 3 levels below)
+   while (k <= n) {
+      __builtin_prefetch (eytzinger + 8 * k);
+      k = 2 * k + (eytzinger [k] <= addr);
+   }
+
+   // Cancel last moves to the right: k is then the first greater start (0 if none)
+   k >>= __builtin_ffs (~k);
+
+   // Segment containing addr is the previous one (segments[0].start = 0)
+   const uint32_t rank = (k == 0) ? n - 1 : index->eytzinger_rank [k] - 1;
+
+   return &(index->segments [rank]);
+}
+
+const address_segment_t *address_index_lookup_next (const address_index_t *index, uint64_t addr, uint32_t *cursor)
+{
+   const address_segment_t *segments = index->segments;
+   const uint32_t n = index->nb_segments;
+   uint32_t low = *cursor;
+
+   // Address before the cursor (addresses not sorted): full lookup
+   if (low >= n || addr < segments [low].start) {
+      const address_segment_t *segment = address_index_lookup (index, addr);
+      *cursor = segment - segments;
+      return segment;
+   }
+
+   // Gallop from cursor: segments[low].start <= addr < segments[high].start (or high = n)
+   uint32_t step = 1;
+   while (low + step < n && segments [low + step].start <= addr) {
+      low += step;
+      step *= 2;
+   }
+   uint32_t high = (low + step < n) ? low + step : n;
+
+   while (high - low > 1) {
+      const uint32_t middle = low + (high - low) / 2;
+      if (segments [middle].start <= addr)
+         low = middle;
+      else
+         high = middle;
+   }
+
+   *cursor = low;
+   return &(segments [low]);
+}
@@ -0,0 +1,63 @@
+/*
+   Copyright (C) 2004 - 2018 Université de Versailles Saint-Quentin-en-Yvelines (UVSQ)
+
+   This file is part of MAQAO.
+
+  MAQAO is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public License
+   as published by the Free Software Foundation; either version 3
+   of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+/* Declares a flattened address index: the address space of a process is split into segments,
+ * each one resolving to a single function part and innermost loop part (or none).
+ * Start addresses are also saved in Eytzinger (breadth-first) order for cache-friendly lookups */
+
+#ifndef __ADDRESS_INDEX_H__
+#define __ADDRESS_INDEX_H__
+
+#include <stdint.h>  // uint64_t...
+#include <stddef.h>  // size_t
+#include "avltree.h" // SinfoFunc, SinfoLoop
+
+// Addresses from start to the start of the next segment (excluded)
+typedef struct {
+   uint64_t start;
+   SinfoFunc *fct;  // NULL if no function
+   SinfoLoop *loop; // NULL if no loop
+} address_segment_t;
+
+typedef struct {
+   uint32_t nb_segments;
+   address_segment_t *segments; // sorted by start, segments[0].start = 0
+   uint64_t *eytzinger;         // segments start addresses in Eytzinger order, from rank 1
+   uint32_t *eytzinger_rank;    // rank in segments of eytzinger[k]
+} address_index_t;
+
+/* Returns function and loop at a given address, called for increasing addresses when building an index
+ * Returned objects are constant between two bounds passed to address_index_new */
+typedef void (*address_resolver_t) (uint64_t addr, void *user, SinfoFunc **fct, SinfoLoop **loop);
+
+/* Builds an address index from bounds: addresses where resolved objects can change (in any order, sorted in place)
+ * Resolver is called once per unique bound (and for address 0) */
+address_index_t *address_index_new (uint64_t *bounds, size_t nb_bounds, address_resolver_t resolve, void *user);
+
+void address_index_free (address_index_t *index);
+
+// Returns the segment containing an address
+const address_segment_t *address_index_lookup (const address_index_t *index, uint64_t addr);
+
+/* Same as address_index_lookup, starting from cursor (rank of the previously returned segment, 0 initially)
+ * For increasing addresses (like sorted IPs), all lookups take a single pass over segments */
+const address_segment_t *address_index_lookup_next (const address_index_t *index, uint64_t addr, uint32_t *cursor);
+
+#endif // __ADDRESS_INDEX_H__
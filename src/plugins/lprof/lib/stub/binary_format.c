@@ -31,6 +31,8 @@
 #include <errno.h>
 #include <assert.h>
 #include <inttypes.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 #include "binary_format.h"
 #include "libmcommon.h"
@@ -687,6 +689,16 @@ void get_function (FILE* file, lprof_fct_t* myFct)
       myFct->outermostLoopsList = NULL;
 }
 
+// Frees data allocated by get_function
+void free_function (lprof_fct_t* myFct)
+{
+   lc_free (myFct->name);
+   lc_free (myFct->startAddress);
+   lc_free (myFct->stopAddress);
+   lc_free (myFct->srcFile);
+   lc_free (myFct->outermostLoopsList);
+}
+
 void print_function (lprof_fct_t* myFct)
 {
    unsigned i;
@@ -750,6 +762,22 @@ void get_library (FILE* file, lprof_library_t* myLib)
 
 }
 
+// Frees data allocated by get_library
+void free_library (lprof_library_t* myLib)
+{
+   unsigned i;
+
+   lc_free (myLib->name);
+   lc_free (myLib->startMapAddress);
+   lc_free (myLib->stopMapAddress);
+   for (i=0; i < myLib->nbFunctions; i++)
+      free_function (&myLib->fctsInfo[i]);
+   lc_free (myLib->fctsInfo);
+   for (i=0; i < myLib->nbLoops; i++)
+      free_loop (&myLib->loopsInfo[i]);
+   lc_free (myLib->loopsInfo);
+}
+
 void print_library (lprof_library_t* myLib)
 {
    unsigned i;
@@ -855,6 +883,17 @@ void get_loop (FILE* file, lprof_loop_t* myLoop)
       myLoop->childrenList = NULL;
 }
 
+// Frees data allocated by get_loop
+void free_loop (lprof_loop_t* myLoop)
+{
+   lc_free (myLoop->startAddress);
+   lc_free (myLoop->stopAddress);
+   free (myLoop->blockIds);
+   lc_free (myLoop->srcFile);
+   lc_free (myLoop->srcFunctionName);
+   lc_free (myLoop->childrenList);
+}
+
 void print_loop (lprof_loop_t* myLoop)
 {
 
@@ -1200,3 +1239,425 @@ void print_events_info (lprof_events_info_t* lprofEventsInfo, uint32_t* nbThread
    for (i=0; i< *nbThreads; i++)
       print_event (&lprofEventsInfo->events[i]);
 }
+
+
+/* ------ INDEXED METAFILES (CF lprof_index_header_t) ------
+ * An executable/library metafile is an index image following the lprof header: it is mapped as is
+ * and functions/loops are found from an address by a binary search in the sorted ranges */
+
+// Strings pool of an index being built: each string is saved once
+typedef struct {
+   hashtable_t* offsets;   // string => offset in pool
+   char*        pool;
+   uint64_t     size;
+   uint64_t     capacity;
+} index_strings_t;
+
+// Returns the offset of a string in the strings pool, adding it if needed
+static uint64_t add_index_string (index_strings_t* strings, const char* string)
+{
+   uint64_t offset;
+   size_t stringLength;
+
+   // NULL OR EMPTY STRING : OFFSET 0
+   if (string == NULL || string[0] == '\0')
+      return 0;
+
+   if ((offset = (uint64_t) hashtable_lookup (strings->offsets, string)) != 0)
+      return offset;
+
+   stringLength = strlen (string) + 1; // +1 for the '\0' character
+   if (strings->size + stringLength > strings->capacity)
+   {
+      strings->capacity = (strings->size + stringLength) * 2;
+      strings->pool = lc_realloc (strings->pool, strings->capacity);
+   }
+   offset = strings->size;
+   memcpy (&strings->pool[offset], string, stringLength);
+   strings->size += stringLength;
+   hashtable_insert (strings->offsets, (void*) string, (void*) offset);
+
+   return offset;
+}
+
+// Orders ranges by start address and then by insertion order (entry, part)
+static int compare_ranges (const void* r1, const void* r2)
+{
+   const lprof_range_t* range1 = r1;
+   const lprof_range_t* range2 = r2;
+
+   if (range1->start != range2->start)
+      return (range1->start < range2->start) ? -1 : 1;
+   if (range1->entry != range2->entry)
+      return (range1->entry < range2->entry) ? -1 : 1;
+   return (range1->part > range2->part) - (range1->part < range2->part);
+}
+
+/* Sorts ranges and sets maxStop. For a given start address, only the last inserted range is kept
+ * (as with the AVL trees previously built at display). Returns the number of kept ranges */
+static uint32_t sort_ranges (lprof_range_t* ranges, uint32_t nbRanges)
+{
+   uint32_t i, nbKept = 0;
+   uint64_t maxStop = 0;
+
+   qsort (ranges, nbRanges, sizeof(*ranges), compare_ranges);
+   for (i=0; i < nbRanges; i++)
+   {
+      if (i+1 < nbRanges && ranges[i+1].start == ranges[i].start)
+         continue;
+      ranges[nbKept] = ranges[i];
+      if (ranges[nbKept].stop > maxStop)
+         maxStop = ranges[nbKept].stop;
+      ranges[nbKept].maxStop = maxStop;
+      nbKept++;
+   }
+
+   return nbKept;
+}
+
+// Appends to ranges the parts of a function/loop (entry). Returns the new number of ranges
+static uint32_t add_index_ranges (lprof_range_t* ranges, uint32_t nbRanges, uint32_t entry,
+                                  uint32_t nbParts, const uint64_t* startAddress, const uint64_t* stopAddress)
+{
+   uint32_t i;
+
+   for (i=0; i < nbParts; i++, nbRanges++)
+   {
+      ranges[nbRanges].start = startAddress[i];
+      ranges[nbRanges].stop  = stopAddress[i];
+      ranges[nbRanges].entry = entry;
+      ranges[nbRanges].part  = i;
+   }
+
+   return nbRanges;
+}
+
+/* Builds (in a single allocated block of size bytes) the index image of an executable/library
+ * Sections: header, functions, loops, functions ranges, loops ranges, IDs pool and strings pool */
+static void* build_lprof_index (const char* name, uint32_t nbFunctions, const lprof_fct_t* fcts,
+                                uint32_t nbLoops, const lprof_loop_t* loops, uint64_t* size)
+{
+   uint32_t i, nbFctRanges, nbLoopRanges, nbIds = 0;
+   lprof_range_t* fctRanges, *loopRanges;
+   lprof_index_header_t header;
+   index_strings_t strings;
+   char* image;
+
+   // GET RANGES, SORTED BY START ADDRESS, AND STRINGS
+   strings.offsets  = hashtable_new (str_hash, str_equal);
+   strings.capacity = 4096;
+   strings.pool     = lc_malloc (strings.capacity);
+   strings.pool[0]  = '\0';
+   strings.size     = 1;
+   add_index_string (&strings, name);
+
+   for (i=0, nbFctRanges=0; i < nbFunctions; i++)
+      nbFctRanges += fcts[i].nbParts;
+   fctRanges = lc_malloc (nbFctRanges * sizeof(*fctRanges));
+   for (i=0, nbFctRanges=0; i < nbFunctions; i++)
+   {
+      nbFctRanges = add_index_ranges (fctRanges, nbFctRanges, i, fcts[i].nbParts, fcts[i].startAddress, fcts[i].stopAddress);
+      add_index_string (&strings, fcts[i].name);
+      add_index_string (&strings, fcts[i].srcFile);
+      nbIds += fcts[i].nbOutermostLoops;
+   }
+   nbFctRanges = sort_ranges (fctRanges, nbFctRanges);
+
+   for (i=0, nbLoopRanges=0; i < nbLoops; i++)
+      nbLoopRanges += loops[i].nbParts;
+   loopRanges = lc_malloc (nbLoopRanges * sizeof(*loopRanges));
+   for (i=0, nbLoopRanges=0; i < nbLoops; i++)
+   {
+      nbLoopRanges = add_index_ranges (loopRanges, nbLoopRanges, i, loops[i].nbParts, loops[i].startAddress, loops[i].stopAddress);
+      add_index_string (&strings, loops[i].srcFile);
+      add_index_string (&strings, loops[i].srcFunctionName);
+      nbIds += loops[i].nbChildren;
+   }
+   nbLoopRanges = sort_ranges (loopRanges, nbLoopRanges);
+
+   // SET SECTIONS OFFSETS (EACH SECTION ALIGNED ON 8 BYTES)
+   memset (&header, 0, sizeof(header));
+   header.name             = add_index_string (&strings, name);
+   header.nbFunctions      = nbFunctions;
+   header.nbLoops          = nbLoops;
+   header.nbFctRanges      = nbFctRanges;
+   header.nbLoopRanges     = nbLoopRanges;
+   header.nbIds            = nbIds;
+   header.fctsOffset       = sizeof(header);
+   header.loopsOffset      = header.fctsOffset       + nbFunctions  * sizeof(lprof_index_fct_t);
+   header.fctRangesOffset  = header.loopsOffset      + nbLoops      * sizeof(lprof_index_loop_t);
+   header.loopRangesOffset = header.fctRangesOffset  + nbFctRanges  * sizeof(lprof_range_t);
+   header.idsOffset        = header.loopRangesOffset + nbLoopRanges * sizeof(lprof_range_t);
+   header.stringsOffset    = (header.idsOffset + nbIds * sizeof(uint32_t) + 7) & ~((uint64_t) 7);
+   header.stringsSize      = strings.size;
+   *size = header.stringsOffset + header.stringsSize;
+
+   // FILL SECTIONS
+   image = lc_malloc0 (*size);
+   memcpy (image, &header, sizeof(header));
+   memcpy (image + header.fctRangesOffset , fctRanges , nbFctRanges  * sizeof(*fctRanges));
+   memcpy (image + header.loopRangesOffset, loopRanges, nbLoopRanges * sizeof(*loopRanges));
+   memcpy (image + header.stringsOffset, strings.pool, strings.size);
+
+   lprof_index_fct_t* indexFcts = (lprof_index_fct_t*) (image + header.fctsOffset);
+   lprof_index_loop_t* indexLoops = (lprof_index_loop_t*) (image + header.loopsOffset);
+   uint32_t* ids = (uint32_t*) (image + header.idsOffset);
+   nbIds = 0;
+   for (i=0; i < nbFunctions; i++)
+   {
+      indexFcts[i].name             = add_index_string (&strings, fcts[i].name);
+      indexFcts[i].srcFile          = add_index_string (&strings, fcts[i].srcFile);
+      indexFcts[i].srcLine          = fcts[i].srcLine;
+      indexFcts[i].nbParts          = fcts[i].nbParts;
+      indexFcts[i].nbOutermostLoops = fcts[i].nbOutermostLoops;
+      indexFcts[i].outermostLoops   = nbIds;
+      if (fcts[i].nbOutermostLoops != 0)
+         memcpy (&ids[nbIds], fcts[i].outermostLoopsList, fcts[i].nbOutermostLoops * sizeof(*ids));
+      nbIds += fcts[i].nbOutermostLoops;
+   }
+   for (i=0; i < nbLoops; i++)
+   {
+      indexLoops[i].srcFile         = add_index_string (&strings, loops[i].srcFile);
+      indexLoops[i].srcFunctionName = add_index_string (&strings, loops[i].srcFunctionName);
+      indexLoops[i].id              = loops[i].id;
+      indexLoops[i].nbParts         = loops[i].nbParts;
+      indexLoops[i].srcFunctionLine = loops[i].srcFunctionLine;
+      indexLoops[i].srcStartLine    = loops[i].srcStartLine;
+      indexLoops[i].srcStopLine     = loops[i].srcStopLine;
+      indexLoops[i].nbChildren      = loops[i].nbChildren;
+      indexLoops[i].children        = nbIds;
+      indexLoops[i].level           = loops[i].level;
+      if (loops[i].nbChildren != 0)
+         memcpy (&ids[nbIds], loops[i].childrenList, loops[i].nbChildren * sizeof(*ids));
+      nbIds += loops[i].nbChildren;
+   }
+
+   hashtable_free (strings.offsets, NULL, NULL);
+   lc_free (strings.pool);
+   lc_free (fctRanges);
+   lc_free (loopRanges);
+
+   return image;
+}
+
+// Returns TRUE if a section of nb elements of eltSize bytes, starting at offset, is aligned and fits in size bytes
+static int is_valid_section (uint64_t offset, uint64_t nb, uint64_t eltSize, uint64_t align, uint64_t size)
+{
+   return (offset % align == 0) && (offset <= size) && (nb <= (size - offset) / eltSize);
+}
+
+// Sets index sections from an index image of size bytes. Returns 0 on success, -1 if the image is invalid
+static int init_lprof_index (lprof_index_t* index, void* image, uint64_t size)
+{
+   const lprof_index_header_t* header = image;
+   char* base = image;
+   uint32_t i;
+
+   if (size < sizeof(*header)
+       || !is_valid_section (header->fctsOffset      , header->nbFunctions , sizeof(lprof_index_fct_t) , 8, size)
+       || !is_valid_section (header->loopsOffset     , header->nbLoops     , sizeof(lprof_index_loop_t), 8, size)
+       || !is_valid_section (header->fctRangesOffset , header->nbFctRanges , sizeof(lprof_range_t)     , 8, size)
+       || !is_valid_section (header->loopRangesOffset, header->nbLoopRanges, sizeof(lprof_range_t)     , 8, size)
+       || !is_valid_section (header->idsOffset       , header->nbIds       , sizeof(uint32_t)          , 4, size)
+       || !is_valid_section (header->stringsOffset   , header->stringsSize , sizeof(char)              , 1, size)
+       || header->stringsSize == 0 || base [header->stringsOffset + header->stringsSize - 1] != '\0'
+       || header->name >= header->stringsSize)
+      return -1;
+
+   index->header     = header;
+   index->fcts       = (const lprof_index_fct_t*)  (base + header->fctsOffset);
+   index->loops      = (const lprof_index_loop_t*) (base + header->loopsOffset);
+   index->fctRanges  = (const lprof_range_t*)      (base + header->fctRangesOffset);
+   index->loopRanges = (const lprof_range_t*)      (base + header->loopRangesOffset);
+   index->ids        = (const uint32_t*)           (base + header->idsOffset);
+   index->strings    = base + header->stringsOffset;
+
+   // CHECK REFERENCES TO STRINGS, IDS AND ENTRIES (NEVER READ OUT OF THE IMAGE)
+   for (i=0; i < header->nbFunctions; i++)
+   {
+      const lprof_index_fct_t* fct = &index->fcts[i];
+      if (fct->name >= header->stringsSize || fct->srcFile >= header->stringsSize
+          || (uint64_t) fct->outermostLoops + fct->nbOutermostLoops > header->nbIds)
+         return -1;
+   }
+   for (i=0; i < header->nbLoops; i++)
+   {
+      const lprof_index_loop_t* loop = &index->loops[i];
+      if (loop->srcFile >= header->stringsSize || loop->srcFunctionName >= header->stringsSize
+          || (uint64_t) loop->children + loop->nbChildren > header->nbIds)
+         return -1;
+   }
+   for (i=0; i < header->nbFctRanges; i++)
+      if (index->fctRanges[i].entry >= header->nbFunctions)
+         return -1;
+   for (i=0; i < header->nbLoopRanges; i++)
+      if (index->loopRanges[i].entry >= header->nbLoops)
+         return -1;
+
+   return 0;
+}
+
+/* Writes to an (empty) file the indexed metafile of an executable/library: lprof header,
+ * whose binary/library info header offsets are the index header one, followed by the index image
+ * Returns 0 on success, -1 on error */
+int write_lprof_index (FILE* file, const char* name, uint32_t nbFunctions, const lprof_fct_t* fcts, uint32_t nbLoops, const lprof_loop_t* loops)
+{
+   assert (file != NULL);
+
+   uint64_t size;
+   char* image = build_lprof_index (name, nbFunctions, fcts, nbLoops, loops, &size);
+   const lprof_index_header_t* header = (const lprof_index_header_t*) image;
+   uint64_t indexOffset         = MAQAO_LPROF_INDEX_OFFSET;
+   uint64_t eventsHdrOffset     = 0;
+   uint64_t serializedStrOffset = MAQAO_LPROF_INDEX_OFFSET + header->stringsOffset;
+   char padding [MAQAO_LPROF_INDEX_OFFSET] = {0};
+   long filePosition;
+
+   //WRITE LPROF HEADER (CF write_lprof_header)
+   fwrite (MAQAO_LPROF_MAGIC,sizeof(char),MAQAO_LPROF_MAGIC_SIZE,file);
+   fwrite (MAQAO_LPROF_VERSION,sizeof(char),MAQAO_LPROF_VERSION_SIZE,file);
+   fwrite (&indexOffset,sizeof(uint64_t),1,file);
+   fwrite (&indexOffset,sizeof(uint64_t),1,file);
+   fwrite (&eventsHdrOffset,sizeof(uint64_t),1,file);
+   fwrite (&header->stringsSize,sizeof(uint64_t),1,file);
+   fwrite (&serializedStrOffset,sizeof(uint64_t),1,file);
+
+   //WRITE INDEX IMAGE
+   filePosition = ftell (file);
+   if (filePosition < 0 || filePosition > MAQAO_LPROF_INDEX_OFFSET)
+   {
+      lc_free (image);
+      return -1;
+   }
+   fwrite (padding, sizeof(char), MAQAO_LPROF_INDEX_OFFSET - filePosition, file);
+   fwrite (image, sizeof(char), size, file);
+   lc_free (image);
+
+   return ferror (file) ? -1 : 0;
+}
+
+/* Builds in memory the index of an executable/library (to use metafiles written before indexed ones)
+ * Returns 0 on success, -1 on error */
+int load_lprof_index (lprof_index_t* index, const char* name, uint32_t nbFunctions, const lprof_fct_t* fcts, uint32_t nbLoops, const lprof_loop_t* loops)
+{
+   uint64_t size;
+   void* image = build_lprof_index (name, nbFunctions, fcts, nbLoops, loops, &size);
+
+   memset (index, 0, sizeof(*index));
+   if (init_lprof_index (index, image, size) != 0)
+   {
+      lc_free (image);
+      return -1;
+   }
+   index->image = image;
+
+   return 0;
+}
+
+/* Maps an indexed metafile to memory and sets index from it (no data is copied)
+ * If not NULL, version is set to the metafile version
+ * Returns 0 on success, 1 if the metafile is not indexed (then file is rewound), -1 on error */
+int map_lprof_index (FILE* file, lprof_index_t* index, char* version)
+{
+   assert (file != NULL);
+
+   char magicNumber [MAQAO_LPROF_MAGIC_SIZE];
+   char fileVersion [MAQAO_LPROF_VERSION_SIZE];
+   float versionNumber;
+   uint64_t indexOffset;
+   struct stat st;
+   void* map;
+
+   memset (index, 0, sizeof(*index));
+
+   //GET MAGIC NUMBER AND VERSION
+   rewind (file);
+   if (fread (magicNumber, sizeof(char), MAQAO_LPROF_MAGIC_SIZE, file) != MAQAO_LPROF_MAGIC_SIZE
+       || memcmp (magicNumber, MAQAO_LPROF_MAGIC, MAQAO_LPROF_MAGIC_SIZE) != 0
+       || fread (fileVersion, sizeof(char), MAQAO_LPROF_VERSION_SIZE, file) != MAQAO_LPROF_VERSION_SIZE)
+   {
+      fprintf(stderr, "[ERROR] Unrecognized file format\n");
+      return -1;
+   }
+   fileVersion [MAQAO_LPROF_VERSION_SIZE - 1] = '\0';
+   if (version != NULL)
+      strcpy (version, fileVersion);
+   if (sscanf (fileVersion, "%f", &versionNumber) != 1)
+      return -1;
+   if (versionNumber < MAQAO_LPROF_INDEX_VERSION)
+   {
+      rewind (file);
+      return 1;
+   }
+
+   //GET INDEX HEADER OFFSET (BINARY INFO HEADER OFFSET)
+   if (fread (&indexOffset, sizeof(indexOffset), 1, file) != 1
+       || fstat (fileno (file), &st) != 0 || indexOffset >= (uint64_t) st.st_size)
+   {
+      DBGMSG0 ("Error while reading index header offset\n");
+      return -1;
+   }
+
+   // Private writable mapping: strings can be modified (e.g. by basename) without changing the file
+   map = mmap (NULL, st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fileno (file), 0);
+   if (map == MAP_FAILED)
+      return -1;
+   if (init_lprof_index (index, (char*) map + indexOffset, st.st_size - indexOffset) != 0)
+   {
+      fprintf(stderr, "[ERROR] Invalid lprof index\n");
+      munmap (map, st.st_size);
+      memset (index, 0, sizeof(*index));
+      return -1;
+   }
+   index->map     = map;
+   index->mapSize = st.st_size;
+
+   return 0;
+}
+
+// Releases an index set by map_lprof_index or load_lprof_index
+void free_lprof_index (lprof_index_t* index)
+{
+   if (index->map != NULL)
+      munmap (index->map, index->mapSize);
+   lc_free (index->image);
+   memset (index, 0, sizeof(*index));
+}
+
+// Returns the string saved at a given offset in the strings pool of an index
+char* get_lprof_index_string (const lprof_index_t* index, uint64_t offset)
+{
+   return &index->strings[offset];
+}
+
+/* Returns the rank of the range containing address (start <= address <= stop), -1 if none
+ * If ranges overlap, the one starting the latest is returned. This differs from the AVL trees
+ * previously built at display, which returned the first containing range met on the search path
+ * (depending on tree balance). Loop ranges are built from the blocks of the innermost loop only
+ * (CF loop_get_ranges), so parts of nested loops do not overlap and samples stay attributed to
+ * the innermost loop, as expected by display. Overlapping ranges (functions sharing code, loops
+ * with interleaved parts) are now resolved to the innermost (latest starting) one, deterministically */
+int64_t search_lprof_ranges (const lprof_range_t* ranges, uint32_t nbRanges, uint64_t address)
+{
+   uint32_t low = 0, high = nbRanges;
+
+   // FIRST RANGE STARTING AFTER ADDRESS
+   while (low < high)
+   {
+      uint32_t middle = low + (high - low) / 2;
+      if (ranges[middle].start <= address)
+         low = middle + 1;
+      else
+         high = middle;
+   }
+
+   // PREVIOUS RANGES, WHILE ONE OF THEM CAN STILL CONTAIN ADDRESS
+   while (low > 0 && ranges[low-1].maxStop >= address)
+   {
+      low--;
+      if (ranges[low].stop >= address)
+         return low;
+   }
+
+   return -1;
+}
@@ -29,8 +29,12 @@
 #define MAQAO_LPROF_MAGIC_SIZE 8
 #define MAQAO_LPROF_VERSION_SIZE 4
 #define MAQAO_LPROF_VERSION_MAJOR 2
-#define MAQAO_LPROF_VERSION_MINOR 2
-#define MAQAO_LPROF_VERSION "2.2\0"
+#define MAQAO_LPROF_VERSION_MINOR 3
+#define MAQAO_LPROF_VERSION "2.3\0"
+
+// Executable/libraries metafiles are indexed (CF lprof_index_t) since version 2.3
+#define MAQAO_LPROF_INDEX_VERSION 2.3f
+#define MAQAO_LPROF_INDEX_OFFSET  64   // Offset in the file of the index header section
 
 #define OUTERMOST_LOOP 0
 #define INNERMOST_LOOP 1
@@ -209,6 +213,74 @@ typedef struct lprof_events_header_s {
 } lprof_events_header_t;
 
 
+//INDEX HEADER SECTION : ONE EXECUTABLE OR LIBRARY PER INDEXED METAFILE
+// All offsets are relative to the index header, strings are offsets in the strings pool (0 = empty string)
+typedef struct lprof_index_header_s {
+   uint64_t name;                   // Name of the executable/library
+   uint32_t nbFunctions;            // Number of functions entries
+   uint32_t nbLoops;                // Number of loops entries
+   uint32_t nbFctRanges;            // Number of functions address ranges (parts)
+   uint32_t nbLoopRanges;           // Number of loops address ranges (parts)
+   uint32_t nbIds;                  // Number of loop IDs in the IDs pool
+   uint32_t reserved;
+   uint64_t fctsOffset;             // Offset of the functions entries (lprof_index_fct_t)
+   uint64_t loopsOffset;            // Offset of the loops entries (lprof_index_loop_t)
+   uint64_t fctRangesOffset;        // Offset of the functions ranges (lprof_range_t)
+   uint64_t loopRangesOffset;       // Offset of the loops ranges (lprof_range_t)
+   uint64_t idsOffset;              // Offset of the IDs pool (outermost loops and children lists)
+   uint64_t stringsOffset;          // Offset of the strings pool
+   uint64_t stringsSize;            // Size in bytes of the strings pool
+} lprof_index_header_t;
+
+//INDEXED FUNCTION : FIXED SIZE VERSION OF lprof_fct_t (ranges are saved apart)
+typedef struct lprof_index_fct_s {
+   uint64_t name;                   // The name of the function
+   uint64_t srcFile;                // The source file name where is coded the function
+   uint32_t srcLine;                // The source line of the function declaration
+   uint32_t nbParts;                // The parts number of the function
+   uint32_t nbOutermostLoops;       // The number of outermost loops in this function
+   uint32_t outermostLoops;         // Rank in the IDs pool of the first outermost loop ID
+} lprof_index_fct_t;
+
+//INDEXED LOOP : FIXED SIZE VERSION OF lprof_loop_t (ranges are saved apart, blocks are not saved)
+typedef struct lprof_index_loop_s {
+   uint64_t srcFile;                // Source file name containing the loop
+   uint64_t srcFunctionName;        // The function name containing the loop
+   uint32_t id;                     // The loop id in maqao
+   uint32_t nbParts;                // The parts number of the loop
+   uint32_t srcFunctionLine;        // Source line of the function containing the loop
+   uint32_t srcStartLine;           // The starting source line of the loop
+   uint32_t srcStopLine;            // The stopping source line of the loop
+   uint32_t nbChildren;             // The number of children loops (0 if innermost)
+   uint32_t children;               // Rank in the IDs pool of the first child loop ID
+   uint8_t  level;                  // The loop level (CF OUTERMOST_LOOP...)
+   uint8_t  reserved[3];
+} lprof_index_loop_t;
+
+//ADDRESS RANGE OF A FUNCTION/LOOP PART. RANGES ARE SORTED BY START ADDRESS (UNIQUE) TO BE BINARY-SEARCHED
+typedef struct lprof_range_s {
+   uint64_t start;                  // The starting assembly address of the part
+   uint64_t stop;                   // The stopping assembly address of the part
+   uint64_t maxStop;                // Highest stop address of this range and all previous ones
+   uint32_t entry;                  // Rank of the function/loop entry
+   uint32_t part;                   // Rank of the part in the function/loop
+} lprof_range_t;
+
+//INDEX OF AN EXECUTABLE OR LIBRARY, MAPPED FROM AN INDEXED METAFILE OR BUILT IN MEMORY FROM AN OLDER ONE
+typedef struct lprof_index_s {
+   const lprof_index_header_t* header;
+   const lprof_index_fct_t*    fcts;
+   const lprof_index_loop_t*   loops;
+   const lprof_range_t*        fctRanges;
+   const lprof_range_t*        loopRanges;
+   const uint32_t*             ids;
+   char*                       strings;
+   void*                       map;        // Mapped metafile (NULL if built in memory)
+   uint64_t                    mapSize;
+   void*                       image;      // Index built in memory (NULL if mapped)
+} lprof_index_t;
+
+
 //BINARY INFO SECTION
 typedef struct lprof_binary_info_s {
    lprof_fct_t*   functions;  // Array containing the functions info of the binary.
@@ -318,6 +390,17 @@ void print_events_header (lprof_events_header_t* lprofEventsHeader);
 void get_events_info (FILE* file, uint32_t* , lprof_events_info_t* lprofEventsInfo);
 void print_events_info (lprof_events_info_t* lprofLibsInfo, uint32_t* nbThreads);
 
+void free_function (lprof_fct_t* myFct);
+void free_loop (lprof_loop_t* myLoop);
+void free_library (lprof_library_t* myLib);
+
+int write_lprof_index (FILE* file, const char* name, uint32_t nbFunctions, const lprof_fct_t* fcts, uint32_t nbLoops, const lprof_loop_t* loops);
+int load_lprof_index (lprof_index_t* index, const char* name, uint32_t nbFunctions, const lprof_fct_t* fcts, uint32_t nbLoops, const lprof_loop_t* loops);
+int map_lprof_index (FILE* file, lprof_index_t* index, char* version);
+void free_lprof_index (lprof_index_t* index);
+char* get_lprof_index_string (const lprof_index_t* index, uint64_t offset);
+int64_t search_lprof_ranges (const lprof_range_t* ranges, uint32_t nbRanges, uint64_t address);
+
 void get_call_chain (FILE* file, call_chain_t* myCallChain);
 void print_call_chain (call_chain_t* myCallChain);
 int write_call_chain (FILE* file, call_chain_t* myCallChain);
@@ -157,6 +157,7 @@ void set_sample_type ( uint64_t sampleTypes, int backtrace_mode, int nbEvents, u
          break;
 
       case BACKTRACE_MODE_STACK:
+      case BACKTRACE_MODE_STACK_OFFLINE:
          sampleTypesList[eventIdx] = LPROF_SAMPLE_TYPE_LIST | LPROF_SAMPLE_TYPE_EXTRA | PERF_SAMPLE_STACK_USER;
          break;
 
@@ -120,6 +120,7 @@
 #define BACKTRACE_MODE_STACK 2
 #define BACKTRACE_MODE_BRANCH 3
 #define BACKTRACE_MODE_OFF 4
+#define BACKTRACE_MODE_STACK_OFFLINE 5 // same as STACK, unwinding deferred after collection
 
 typedef struct sampleInfo_s
 {
@@ -24,6 +24,12 @@
  * Finding address ranges needs to parse the /proc/pid/maps file to locate the file
  * (executable or a library) related to a given virtual address.
  * Main functions are: write_exe_metafile, write_exe_offset and write_libs_metafile.
+ *
+ * Library metafiles only depend on the library file and on analysis settings.
+ * They are saved in a cache directory shared by all hosts and experiments, under
+ * a name made of the hash of the library contents and of the hash of the settings
+ * (MAQAO version, parse/disassemble mode, library name and analysis options).
+ * Libraries missing from the cache are analyzed by several worker processes.
  */
 
 #include <time.h>
@@ -33,6 +39,9 @@
 #include <unistd.h> // access
 #include <sys/stat.h> // mkdir
 #include <sys/types.h> // mkdir
+#include <sys/wait.h> // wait
+#include <errno.h>
+#include <inttypes.h> // PRIx64
 
 #include "utils.h" // fopen_in_directory...
 #include "generate_metafile_shared.h" // loop_get_ranges...
@@ -40,6 +49,20 @@
 #include "libmadras.h" // madras_is_file_valid, includes libmtroll declaring elffile_isdyn
 #include "libmmaqao.h" // project_parse_file
 #include "libmcommon.h" // hashtable_t...
+#include "version.h" // MAQAO_VERSION
+
+#define LIB_CACHE_SUBDIR      "maqao/lprof_libs" // Default cache directory, relative to the user cache directory
+#define LIB_CACHE_LOCK_EXT    ".lock"            // Extension of lock directories of cache entries being written
+#define LIB_CACHE_LOCK_TIMEOUT 3600              // Age (seconds) after which a lock is considered stale
+
+// A library metafile to write to <host>/libs
+typedef struct lib_job_s {
+   lib_range_t *lib_range; // library
+   boolean_t disass;       // TRUE if the library must be disassembled, FALSE if only parsed
+   char *out_path;         // path to the library metafile in the host directory
+   char *cache_path;       // path to the cache entry, NULL if no cache
+   boolean_t locked;       // TRUE if the cache entry is locked by this instance
+} lib_job_t;
 
 static void add_maps_file (const char *process_path, const char *file_name, void *files_ptr)
 {
@@ -404,8 +427,257 @@ static void free_lprof_loops (lprof_loop_t *lprof_loops, unsigned nb_loops)
    lc_free (lprof_loops);
 }
 
+// Write to name the metafile of a library, parsed or disassembled
+static boolean_t write_lib_metafile (const char *name, lib_range_t *lib_range, boolean_t disass,
+                                     const char *host_path, project_t *proj)
+{
+   // Create output file
+   FILE *fp = fopen (name, "w");
+   if (!fp) return FALSE;
+
+   asmfile_t *asmf;
+   lprof_library_t lib = { .name = lib_range->name,
+                           .nbProcesses = 0,
+                           .startMapAddress = NULL,
+                           .stopMapAddress = NULL };
+   if (disass == FALSE)
+      asmf = parse_lib (proj, &lib);
+   else {
+      char *cp_host_path = lc_strdup (host_path);
+      printf ("[MAQAO] ANALYZING LIBRARY %s (host %s)\n", lib.name, basename (cp_host_path));
+      fflush (stdout);
+
+      asmf = disass_bin (proj, lib.name,
+                         &(lib.nbFunctions),
+                         &(lib.fctsInfo),
+                         &(lib.nbLoops),
+                         &(lib.loopsInfo));
+
+      printf ("[MAQAO] LIBRARY %s DONE (host %s)\n", lib.name, basename (cp_host_path));
+      fflush (stdout);
+      lc_free (cp_host_path);
+   }
+
+   int err = write_lprof_index (fp, lib.name, lib.nbFunctions, lib.fctsInfo, lib.nbLoops, lib.loopsInfo);
+
+   // Free data allocated by parse/disass_lib
+   free_lprof_fcts  (lib.fctsInfo , lib.nbFunctions);
+   free_lprof_loops (lib.loopsInfo, lib.nbLoops    );
+   project_remove_file (proj, asmf);
+
+   // Close
+   return (fclose (fp) == 0 && err == 0) ? TRUE : FALSE;
+}
+
+// Return the cache directory selected by lib_cache ("on", "off" or a path), NULL if disabled
+static char *get_lib_cache_dir (const char *lib_cache)
+{
+   if (lib_cache == NULL || strcmp (lib_cache, "off") == 0) return NULL;
+
+   char *dir;
+   if (strcmp (lib_cache, "on") == 0) {
+      // Default: user cache directory (XDG), shared by all hosts if home is
+      const char *xdg_cache = getenv ("XDG_CACHE_HOME");
+      const char *home = getenv ("HOME");
+      if (xdg_cache != NULL && xdg_cache[0] != '\0') {
+         dir = lc_malloc (strlen (xdg_cache) + strlen (LIB_CACHE_SUBDIR) + 3);
+         sprintf (dir, "%s/%s/", xdg_cache, LIB_CACHE_SUBDIR);
+      } else if (home != NULL && home[0] != '\0') {
+         dir = lc_malloc (strlen (home) + strlen ("/.cache/") + strlen (LIB_CACHE_SUBDIR) + 2);
+         sprintf (dir, "%s/.cache/%s/", home, LIB_CACHE_SUBDIR);
+      } else
+         return NULL;
+   } else {
+      dir = lc_malloc (strlen (lib_cache) + 2);
+      sprintf (dir, "%s/", lib_cache);
+   }
+
+   // createDir only creates the components followed by a '/' in the path
+   if (dirExist (dir) == FALSE) createDir (dir, S_IRWXU);
+   if (dirExist (dir) == FALSE) {
+      WRNMSG ("Cannot create library metafiles cache directory %s: cache disabled\n", dir);
+      lc_free (dir);
+      return NULL;
+   }
+   dir [strlen (dir) - 1] = '\0';
+   return dir;
+}
+
+// Return the path to the cache entry of a library metafile, NULL if the library cannot be read
+static char *get_lib_cache_path (const char *cache_dir, const lib_range_t *lib_range,
+                                 boolean_t disass, project_t *proj)
+{
+   uint64_t content_size = 0;
+   uint64_t content_hash = file_content_hash (lib_range->name, &content_size);
+   if (content_hash == 0) return NULL;
+
+   // Everything else changing the metafile contents
+   const char *version = MAQAO_VERSION "::" MAQAO_BUILD;
+   uint64_t h = add_data_hash (FILE_HASH_INIT, version, strlen (version));
+   h = add_data_hash (h, MAQAO_LPROF_VERSION, MAQAO_LPROF_VERSION_SIZE);
+   h = add_data_hash (h, lib_range->name, strlen (lib_range->name) + 1);
+   h = add_data_hash (h, &content_size, sizeof content_size);
+   char settings[4];
+   settings[0] = disass;
+   settings[1] = project_get_cc_mode (proj);
+   settings[2] = (project_get_parameter (proj, PARAM_MODULE_LCORE,
+                                         PARAM_LCORE_FLOW_ANALYZE_ALL_SCNS) != NULL);
+   settings[3] = (project_get_parameter (proj, PARAM_MODULE_DEBUG,
+                                         PARAM_DEBUG_DISABLE_DEBUG) != NULL);
+   h = add_data_hash (h, settings, sizeof settings);
+
+   char *path = lc_malloc (strlen (cache_dir) + 2 * 16 + strlen ("/-.lprof") + 1);
+   sprintf (path, "%s/%016"PRIx64"-%016"PRIx64".lprof", cache_dir, content_hash, h);
+   return path;
+}
+
+// Return TRUE if the lock directory of a cache entry exists and is not stale
+static boolean_t is_lib_cache_locked (const char *cache_path)
+{
+   char lock_path [strlen (cache_path) + strlen (LIB_CACHE_LOCK_EXT) + 1];
+   sprintf (lock_path, "%s%s", cache_path, LIB_CACHE_LOCK_EXT);
+   struct stat st;
+   if (stat (lock_path, &st) != 0) return FALSE;
+   return (time (NULL) - st.st_mtime < LIB_CACHE_LOCK_TIMEOUT) ? TRUE : FALSE;
+}
+
+// Lock (locked = TRUE) or unlock a cache entry. Return TRUE on success
+static boolean_t lock_lib_cache (const char *cache_path, boolean_t locked)
+{
+   char lock_path [strlen (cache_path) + strlen (LIB_CACHE_LOCK_EXT) + 1];
+   sprintf (lock_path, "%s%s", cache_path, LIB_CACHE_LOCK_EXT);
+   if (locked == TRUE)
+      return (mkdir (lock_path, S_IRWXU) == 0) ? TRUE : FALSE;
+   return (rmdir (lock_path) == 0) ? TRUE : FALSE;
+}
+
+// Write a library metafile to the cache: written to a temporary file, then renamed
+static boolean_t write_lib_cache (const lib_job_t *job, const char *host_path, project_t *proj)
+{
+   char hostname [256] = "";
+   gethostname (hostname, sizeof hostname - 1);
+   char tmp_path [strlen (job->cache_path) + strlen (hostname) + 32];
+   sprintf (tmp_path, "%s.%s.%d.tmp", job->cache_path, hostname, (int) getpid ());
+
+   if (write_lib_metafile (tmp_path, job->lib_range, job->disass, host_path, proj) == TRUE &&
+       rename (tmp_path, job->cache_path) == 0)
+      return TRUE;
+
+   unlink (tmp_path);
+   return FALSE;
+}
+
+// Copy a cache entry to a host libs directory (hard link if possible)
+static boolean_t copy_lib_cache (const char *cache_path, const char *out_path)
+{
+   if (link (cache_path, out_path) == 0) return TRUE;
+
+   FILE *in = fopen (cache_path, "r");
+   if (!in) return FALSE;
+   FILE *out = fopen (out_path, "w");
+   if (!out) {
+      fclose (in);
+      return FALSE;
+   }
+   boolean_t ret = TRUE;
+   char buf [1 << 16]; size_t n;
+   while ((n = fread (buf, 1, sizeof buf, in)) > 0)
+      if (fwrite (buf, 1, n, out) != n) {
+         ret = FALSE; break;
+      }
+   fclose (in);
+   if (fclose (out) != 0) ret = FALSE;
+   if (ret == FALSE) unlink (out_path);
+   return ret;
+}
+
+// Write the metafile of a library (via the cache if enabled) to the host libs directory
+static boolean_t run_lib_job (const lib_job_t *job, const char *host_path, project_t *proj)
+{
+   if (job->cache_path == NULL)
+      return write_lib_metafile (job->out_path, job->lib_range, job->disass, host_path, proj);
+
+   return write_lib_cache (job, host_path, proj);
+}
+
+// Wait for one of the worker processes in pids to end and remove it. Return FALSE if none left
+static boolean_t wait_lib_worker (pid_t *pids, int *nb_pids)
+{
+   while (*nb_pids > 0) {
+      pid_t pid = wait (NULL);
+      if (pid < 0 && errno != EINTR) {
+         *nb_pids = 0; // no more children
+         break;
+      }
+      int i;
+      for (i = 0; i < *nb_pids; i++)
+         if (pids[i] == pid) {
+            pids[i] = pids[--(*nb_pids)];
+            return TRUE;
+         }
+   }
+   return FALSE;
+}
+
+// Run jobs, using up to nb_procs worker processes
+static void run_lib_jobs (array_t *jobs, int nb_procs, const char *host_path, project_t *proj)
+{
+   if (nb_procs <= 1 || array_length (jobs) <= 1) {
+      FOREACH_INARRAY (jobs, jobs_iter) {
+         const lib_job_t *job = ARRAY_GET_DATA (NULL, jobs_iter);
+         run_lib_job (job, host_path, proj);
+      }
+      return;
+   }
+
+   // Analysis data (project, serialized strings...) cannot be shared between libraries
+   // analyzed concurrently: each library is analyzed by a child process, on its own copy
+   pid_t pids [nb_procs]; int nb_pids = 0;
+   fflush (stdout); fflush (stderr);
+   FOREACH_INARRAY (jobs, jobs_iter) {
+      const lib_job_t *job = ARRAY_GET_DATA (NULL, jobs_iter);
+
+      if (nb_pids == nb_procs) wait_lib_worker (pids, &nb_pids);
+
+      pid_t pid = fork ();
+      if (pid == 0) {
+         boolean_t ret = run_lib_job (job, host_path, proj);
+         fflush (stdout); fflush (stderr);
+         _exit (ret == TRUE ? EXIT_SUCCESS : EXIT_FAILURE);
+      }
+      else if (pid < 0)
+         run_lib_job (job, host_path, proj); // cannot fork: do it in the current process
+      else
+         pids [nb_pids++] = pid;
+   }
+
+   // Wait for all workers
+   while (wait_lib_worker (pids, &nb_pids) == TRUE);
+}
+
+// Copy a cache entry, written by the current or by another instance, to the host libs directory
+static void finalize_lib_job (lib_job_t *job, const char *host_path, project_t *proj)
+{
+   if (job->cache_path == NULL) return;
+
+   // Written by another instance (possibly on another host): wait for it
+   if (job->locked == FALSE)
+      while (access (job->cache_path, F_OK) != 0 && is_lib_cache_locked (job->cache_path) == TRUE)
+         sleep (1);
+
+   if (access (job->cache_path, F_OK) != 0 ||
+       copy_lib_cache (job->cache_path, job->out_path) == FALSE) {
+      // Failed or stale lock: analyze the library here, without cache
+      write_lib_metafile (job->out_path, job->lib_range, job->disass, host_path, proj);
+   }
+
+   if (job->locked == TRUE)
+      lock_lib_cache (job->cache_path, FALSE);
+}
+
 static void disass_libs (const char *exe_name, const hashtable_t *lib_ranges,
-                         const char *host_path, const char *disass_list, project_t *proj)
+                         const char *host_path, const char *disass_list,
+                         const char *lib_cache, int nb_procs, project_t *proj)
 {
    // Check whether libraries must be parsed of disassembled
    unsigned disass_mode; hashtable_t *disass_table = NULL;
@@ -422,6 +694,15 @@ static void disass_libs (const char *exe_name, const hashtable_t *lib_ranges,
 
    hashtable_t *phy2sym = (disass_mode == 1) ? get_phy2sym (exe_name) : NULL;
 
+   char libs_path [strlen (host_path) + strlen ("/libs") + 1];
+   sprintf (libs_path, "%s/libs", host_path);
+   if (mkdir (libs_path, S_IRWXU) != 0) {}
+
+   char *cache_dir = get_lib_cache_dir (lib_cache);
+   array_t *jobs = array_new();   // all metafiles to write
+   array_t *misses = array_new(); // metafiles to analyze in this instance
+   hashtable_t *out_paths = hashtable_new (str_hash, str_equal);
+
    FOREACH_INHASHTABLE (lib_ranges, lib_ranges_iter) {
       char *const phy_name = GET_KEY (char *, lib_ranges_iter);
       lib_range_t *lib_range = GET_DATA_T (lib_range_t *, lib_ranges_iter);
@@ -431,59 +712,49 @@ static void disass_libs (const char *exe_name, const hashtable_t *lib_ranges,
          if (sym_name != NULL) lib_range->name = lc_strdup (sym_name);
       }
 
-      char libs_path [strlen (host_path) + strlen ("/libs") + 1];
-      sprintf (libs_path, "%s/libs", host_path);
-      if (mkdir (libs_path, S_IRWXU) != 0) {}
-
       char *lib_name = lc_strdup (lib_range->name);
       char *lib_basename = basename (lib_name);
-      char name [strlen (libs_path) + strlen (lib_basename) + strlen (".lprof") + 2];
+      char *name = lc_malloc (strlen (libs_path) + strlen (lib_basename) + strlen (".lprof") + 2);
       sprintf (name, "%s/%s.lprof", libs_path, lib_basename);
-      if (access (name, F_OK) == 0) continue;
-
-      // Create output file
-      FILE *fp = fopen (name, "w");
-      if (!fp) continue;
-      long lprofHeaderPosition = write_lprof_header (fp);
-      write_libraries_info_header (fp, 1, 0x0);
-
-      asmfile_t *asmf;
-      lprof_library_t lib = { .name = lib_range->name,
-                              .nbProcesses = 0,
-                              .startMapAddress = NULL,
-                              .stopMapAddress = NULL };
-      if (disass_mode == 0 || (disass_mode == 1 && !hashtable_lookup (disass_table, lib_basename)))
-         asmf = parse_lib (proj, &lib);
-      else {
-         char *cp_host_path = lc_strdup (host_path);
-         printf ("[MAQAO] ANALYZING LIBRARY %s (host %s)\n", lib.name, basename (cp_host_path));
-         fflush (stdout);
-
-         asmf = disass_bin (proj, lib.name,
-                            &(lib.nbFunctions),
-                            &(lib.fctsInfo),
-                            &(lib.nbLoops),
-                            &(lib.loopsInfo));
-
-         printf ("[MAQAO] LIBRARY %s DONE (host %s)\n", lib.name, basename (cp_host_path));
-         fflush (stdout);
-         lc_free (cp_host_path);
+      if (access (name, F_OK) == 0 || hashtable_lookup (out_paths, name) != NULL) {
+         lc_free (name); lc_free (lib_name);
+         continue;
       }
-
-      write_library (fp, &lib);
+      hashtable_insert (out_paths, name, name);
+
+      lib_job_t *job = lc_malloc0 (sizeof *job);
+      job->lib_range = lib_range;
+      job->disass = (disass_mode == 0 || (disass_mode == 1 && !hashtable_lookup (disass_table, lib_basename))) ?
+         FALSE : TRUE;
+      job->out_path = name;
+      if (cache_dir != NULL)
+         job->cache_path = get_lib_cache_path (cache_dir, lib_range, job->disass, proj);
+      array_add (jobs, job);
       lc_free (lib_name);
 
-      // Free data allocated by parse/disass_lib
-      free_lprof_fcts  (lib.fctsInfo , lib.nbFunctions);
-      free_lprof_loops (lib.loopsInfo, lib.nbLoops    );
-      project_remove_file (proj, asmf);
-
-      // Finalyze and close
-      long strSerializedOffset = write_serialized_str_array (fp);
-      update_lprof_header (fp, strSerializedOffset, lprofHeaderPosition);
-      fclose (fp);
+      // Cache hit or being written by another instance: nothing to analyze
+      if (job->cache_path != NULL) {
+         if (access (job->cache_path, F_OK) == 0) continue;
+         job->locked = lock_lib_cache (job->cache_path, TRUE);
+         if (job->locked == FALSE && is_lib_cache_locked (job->cache_path) == TRUE) continue;
+      }
+      array_add (misses, job);
    } // for each lib file
 
+   // Analyze missing libraries, then copy cache entries to the host directory
+   if (nb_procs <= 0) nb_procs = threadpool_get_nb_cpus();
+   run_lib_jobs (misses, nb_procs, host_path, proj);
+   FOREACH_INARRAY (jobs, jobs_iter) {
+      lib_job_t *job = ARRAY_GET_DATA (NULL, jobs_iter);
+      finalize_lib_job (job, host_path, proj);
+      lc_free (job->cache_path);
+      lc_free (job);
+   }
+
+   array_free (misses, NULL);
+   array_free (jobs, NULL);
+   hashtable_free (out_paths, NULL, lc_free); // key = data => lc_free only on keys
+   lc_free (cache_dir);
    hashtable_free (phy2sym, lc_free, lc_free);
    hashtable_free (disass_table, NULL, lc_free); // key = data => lc_free only on keys
 }
@@ -542,14 +813,9 @@ static void write_exe_metafile (const char *exp_path, const char *exe_name, proj
    printf ("[MAQAO] EXECUTABLE %s DONE\n", exe_name);
    fflush (stdout);
 
-   // Write lprof header and executable data
-   long lprofHeaderPosition = write_lprof_header (fp);
-   write_binary_info_header (fp, (char *) exe_name, nb_functions, nb_loops);
-   write_binary_info (fp, &lb, nb_functions, nb_loops);
-
-   // Finalize and close binary.lprof
-   long strSerializedOffset = write_serialized_str_array (fp);
-   update_lprof_header (fp, strSerializedOffset, lprofHeaderPosition);
+   // Write executable data (indexed) and close binary.lprof
+   if (write_lprof_index (fp, exe_name, nb_functions, lb.functions, nb_loops, lb.loops) != 0)
+      ERRMSG ("Cannot write executable metadata to %s/binary.lprof\n", exp_path);
    fclose (fp);
 
    // Free data allocated by disass_bin
@@ -560,7 +826,8 @@ static void write_exe_metafile (const char *exp_path, const char *exe_name, proj
 
 void generate_metafile_binformat_new (const char *exp_path, const char *hostname,
                                       pid_t pid, const char *exe_name,
-                                      const char *disass_list, project_t *proj)
+                                      const char *disass_list, const char *lib_cache,
+                                      int nb_procs, project_t *proj)
 {
    // From maps, allocate/fill data structures used to write metafiles (libs and exe_offset)
    uint64_t exe_offset = 0;
@@ -582,7 +849,7 @@ void generate_metafile_binformat_new (const char *exp_path, const char *hostname
    sprintf (host_lock_name, "%s/lockdir", host_path);
    while (mkdir (host_lock_name, S_IRWXU) != 0) sleep (1); // Wait for lock (node level)
 
-   disass_libs (exe_name, lib_ranges, host_path, disass_list, proj);
+   disass_libs (exe_name, lib_ranges, host_path, disass_list, lib_cache, nb_procs, proj);
 
    rmdir (host_lock_name); // Release lock (node level)
    lc_free (host_lock_name);
@@ -25,7 +25,13 @@
 
 #include "libmasm.h" // project_t
 
+/*
+ * Writes metafiles of the executable and of the libraries used by a process
+ * \param lib_cache directory caching library metafiles: "on" (user cache directory), "off" or a path
+ * \param nb_procs maximum number of processes analyzing libraries, <= 0 for one per processor
+ */
 void generate_metafile_binformat_new (const char *exp_path, const char *hostname,
                                       pid_t pid, const char *exe_name,
-                                      const char *disass_list, project_t *proj);
+                                      const char *disass_list, const char *lib_cache,
+                                      int nb_procs, project_t *proj);
 #endif // __GENERATE_METAFILE_H__
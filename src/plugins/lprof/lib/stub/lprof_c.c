@@ -146,8 +146,11 @@ static int l_lprof_generate_metafile_binformat_new (lua_State *L)
    const char *exe_name    = lua_tostring    (L, 4);
    const char *disass_list = lua_tostring    (L, 5);
    const p_t  *proj        = luaL_checkudata (L, 6, PROJECT);
+   const char *lib_cache   = luaL_optstring  (L, 7, "off");
+   const int   nb_procs    = luaL_optinteger (L, 8, 1);
 
-   generate_metafile_binformat_new (exp_path, host_path, pid, exe_name, disass_list, proj->p);
+   generate_metafile_binformat_new (exp_path, host_path, pid, exe_name, disass_list,
+                                    lib_cache, nb_procs, proj->p);
 
    return 0;
 }
@@ -207,6 +207,19 @@ perf_get_group_nevents(perf_event_desc_t *fds, int num, int idx)
 	return i - leader;
 }
 
+/*
+ * size of the metadata page preceding the buffer payload
+ */
+static size_t
+perf_get_page_size(void)
+{
+	static size_t page_size = 0;
+
+	if (!page_size)
+		page_size = sysconf(_SC_PAGESIZE);
+	return page_size;
+}
+
 int
 perf_read_buffer(perf_event_desc_t *hw, void *buf, size_t sz)
 {
@@ -219,7 +232,7 @@ perf_read_buffer(perf_event_desc_t *hw, void *buf, size_t sz)
 	/*
 	 * data points to beginning of buffer payload
 	 */
-	data = ((void *)hdr)+sysconf(_SC_PAGESIZE);
+	data = ((void *)hdr)+perf_get_page_size();
 
 	/*
 	 * position of tail within the buffer payload
@@ -280,6 +293,88 @@ perf_skip_buffer(perf_event_desc_t *hw, size_t sz)
 	hdr->data_tail += sz;
 }
 
+void
+perf_record_iter_begin(perf_record_iter_t *it, perf_event_desc_t *hw)
+{
+	it->hdr = hw->buf;
+	it->data = (char *)hw->buf + perf_get_page_size();
+	it->pgmsk = hw->pgmsk;
+	it->tail = it->hdr->data_tail;
+	it->head = it->hdr->data_head;
+	it->wrap_buf = NULL;
+	it->corrupted = 0;
+
+	/*
+	 * records up to data_head must be visible before being read
+	 */
+	__sync_synchronize();
+}
+
+/*
+ * Returns the next complete record of the batch, NULL at the end of the batch
+ */
+struct perf_event_header *
+perf_record_iter_next(perf_record_iter_t *it)
+{
+	struct perf_event_header *ehdr;
+	size_t avail_sz, tail, c;
+
+	avail_sz = it->head - it->tail;
+	if (avail_sz < sizeof(*ehdr))
+		return NULL;
+
+	/*
+	 * records are 8-byte aligned: a header never wraps around
+	 */
+	tail = it->tail & it->pgmsk;
+	ehdr = (struct perf_event_header *)(it->data + tail);
+
+	if (ehdr->size < sizeof(*ehdr) || ehdr->size > avail_sz) {
+		/*
+		 * cannot find next record: drop the whole batch
+		 */
+		it->corrupted = 1;
+		it->tail = it->head;
+		return NULL;
+	}
+
+	/*
+	 * c = size till end of buffer
+	 */
+	c = it->pgmsk + 1 - tail;
+	if (ehdr->size > c) {
+		/*
+		 * record size is 16-bit: one buffer fits all records
+		 */
+		if (!it->wrap_buf)
+			it->wrap_buf = malloc(UINT16_MAX + 1);
+		if (!it->wrap_buf)
+			return NULL;
+		memcpy(it->wrap_buf, ehdr, c);
+		memcpy((char *)it->wrap_buf + c, it->data, ehdr->size - c);
+		ehdr = it->wrap_buf;
+	}
+	it->tail += ehdr->size;
+
+	return ehdr;
+}
+
+/*
+ * Releases to the kernel the space of all records returned in the batch
+ */
+void
+perf_record_iter_end(perf_record_iter_t *it)
+{
+	/*
+	 * records must be read before their space is released
+	 */
+	__sync_synchronize();
+	it->hdr->data_tail = it->tail;
+
+	free(it->wrap_buf);
+	it->wrap_buf = NULL;
+}
+
 static size_t
 __perf_handle_raw(perf_event_desc_t *hw)
 {
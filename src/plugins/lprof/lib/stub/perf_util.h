@@ -26,6 +26,7 @@
 
 #include <sys/types.h>
 #include <inttypes.h>
+#include <string.h>
 #include <err.h>
 #include "perf_event.h"
 
@@ -55,6 +56,84 @@ extern int perf_read_buffer(perf_event_desc_t *hw, void *buf, size_t sz);
 extern void perf_free_fds(perf_event_desc_t *fds, int num_fds);
 extern void perf_skip_buffer(perf_event_desc_t *hw, size_t sz);
 
+/*
+ * Batch iterator over the records of a ring buffer
+ *
+ * Records in [data_tail, data_head) are walked in place: a record is
+ * returned as a pointer into the ring, or into a copy for the (rare)
+ * records straddling the end of the buffer. data_tail is advanced once,
+ * by perf_record_iter_end(), so returned records stay valid until then.
+ */
+typedef struct {
+	struct perf_event_mmap_page *hdr;
+	char *data;		/* beginning of buffer payload */
+	size_t pgmsk;
+	uint64_t head;		/* data_head when the batch was started */
+	uint64_t tail;		/* position of next record */
+	void *wrap_buf;		/* copy of a record wrapping around */
+	int corrupted;		/* set if an invalid record header was met */
+} perf_record_iter_t;
+
+/*
+ * Cursor on the payload of a record returned by perf_record_iter_next()
+ */
+typedef struct {
+	const char *pos;
+	size_t sz;		/* remaining bytes */
+} perf_record_cursor_t;
+
+extern void perf_record_iter_begin(perf_record_iter_t *it, perf_event_desc_t *hw);
+extern struct perf_event_header *perf_record_iter_next(perf_record_iter_t *it);
+extern void perf_record_iter_end(perf_record_iter_t *it);
+
+static inline void
+perf_record_cursor_init(perf_record_cursor_t *c, const struct perf_event_header *ehdr)
+{
+	c->pos = (const char *)(ehdr + 1);
+	c->sz = ehdr->size - sizeof(*ehdr);
+}
+
+/*
+ * Returns a pointer to the next sz bytes of a record (no copy), NULL if the record is too short
+ */
+static inline const void *
+perf_record_get(perf_record_cursor_t *c, size_t sz)
+{
+	const void *p = c->pos;
+
+	if (sz > c->sz)
+		return NULL;
+	c->pos += sz;
+	c->sz -= sz;
+	return p;
+}
+
+static inline int
+perf_record_read(perf_record_cursor_t *c, void *buf, size_t sz)
+{
+	const void *p = perf_record_get(c, sz);
+
+	if (!p)
+		return -1;
+	memcpy(buf, p, sz);
+	return 0;
+}
+
+static inline int
+perf_record_read_64(perf_record_cursor_t *c, void *buf)
+{
+	return perf_record_read(c, buf, sizeof(uint64_t));
+}
+
+static inline void
+perf_record_skip(perf_record_cursor_t *c, size_t sz)
+{
+	if (sz > c->sz)
+		sz = c->sz;
+	c->pos += sz;
+	c->sz -= sz;
+}
+
 static inline int
 perf_read_buffer_32(perf_event_desc_t *hw, void *buf)
 {
@@ -27,6 +27,8 @@
 #include <string.h> // strcmp...
 #include <libgen.h> // basename
 #include <unistd.h> // access
+#include <pthread.h> // pthread_mutex_t
+#include <sys/stat.h> // stat
 #include "utils.h" // for_each_directory...
 #include "libmcommon.h" // hashtable_t...
 #include "list_libc.h" // load_libc_functions
@@ -53,6 +55,21 @@ static void insert_thread_to_process (long tid, lprof_process_t *process, unsign
    array_add (process->threads, t);
 }
 
+static void free_thread (lprof_thread_t *thread)
+{
+   hashtable_free (thread->fcts, NULL, NULL);
+   lc_free (thread->events_nb);
+   lc_free (thread->categories);
+   lc_free (thread->libc_categories);
+
+   // Loops
+   FOREACH_INHASHTABLE (thread->loops, module) {
+      hashtable_t *module_loops = GET_DATA_T (hashtable_t *, module);
+      hashtable_free (module_loops, NULL, NULL);
+   }
+   hashtable_free (thread->loops, NULL, NULL);
+}
+
 // To call via for_each_directory_in_directory
 // Create a process and insert it to parent node
 static void insert_process_to_node (const char *node_path, const char *process_id, void *data)
@@ -70,7 +87,6 @@ static void insert_process_to_node (const char *node_path, const char *process_i
    p->parent_node = node;
    p->threads     = array_new(); // array of threads
    p->is_library  = hashtable_new (int_hash, int_equal);
-   p->ip2fct_cache= hashtable_new (direct_hash, direct_equal);
    
    sampling_display_context_t *context = node->parent_context;
    char process_path [strlen (context->exp_path) + strlen (node->name) + strlen (process_id) + 3];
@@ -173,85 +189,164 @@ static void insert_nodes_and_processes_to_context (sampling_display_context_t *c
    for_each_directory_in_directory (context->exp_path, insert_node_to_context, context);
 }
 
-// Loads executable metadata from exp_path/binary.lprof
-static void load_exe_metadata (const char *exp_path, lprof_header_t *lprof_header,
-                               lprof_binary_info_header_t *exe_metadata_header,
-                               lprof_binary_info_t *exe_metadata)
+// Loads executable metadata from exp_path/binary.lprof to context (index, lprof version...)
+static void load_exe_metadata (sampling_display_context_t *context)
 {
-   FILE *fp = fopen_in_directory (exp_path, "binary.lprof", "r");
+   FILE *fp = fopen_in_directory (context->exp_path, "binary.lprof", "r");
    if (!fp) {
-      HLTMSG ("Cannot load executable metadata from %s\n", exp_path);
+      HLTMSG ("Cannot load executable metadata from %s\n", context->exp_path);
       exit (-1);
    }
 
-   // Read lprof header (including lprof version...)
-   get_lprof_header (fp, lprof_header);
+   // Map the (indexed) metafile, including lprof version
+   int ret = map_lprof_index (fp, &(context->exe_index), context->lprof_version);
 
-   // Get number of functions and loops
-   get_bin_info_header (fp, exe_metadata_header);
+   // Metafile written before indexed ones: read functions and loops and index them in memory
+   if (ret == 1) {
+      lprof_header_t lprof_header;
+      lprof_binary_info_header_t header;
+      lprof_binary_info_t info;
+      get_lprof_header (fp, &lprof_header);
+      get_bin_info_header (fp, &header);
+      get_bin_info (fp, &(header.nbFunctions), &(header.nbLoops), &info);
 
-   // Write metadata to exe_metadata
-   get_bin_info (fp, &(exe_metadata_header->nbFunctions), &(exe_metadata_header->nbLoops), exe_metadata);
+      ret = load_lprof_index (&(context->exe_index), header.binName,
+                              header.nbFunctions, info.functions, header.nbLoops, info.loops);
+
+      unsigned i;
+      for (i=0; i < header.nbFunctions; i++) free_function (&(info.functions [i]));
+      for (i=0; i < header.nbLoops    ; i++) free_loop     (&(info.loops     [i]));
+      lc_free (info.functions);
+      lc_free (info.loops);
+      lc_free (header.binName);
+   }
 
    fclose (fp);
+
+   if (ret != 0) {
+      HLTMSG ("Cannot load executable metadata from %s\n", context->exp_path);
+      exit (-1);
+   }
+
+   const lprof_index_t *index = &(context->exe_index);
+   context->exe_name     = get_lprof_index_string (index, index->header->name);
+   context->nb_exe_fcts  = index->header->nbFunctions;
+   context->nb_exe_loops = index->header->nbLoops;
 }
 
-// Loads libraries metadata from exp_path/node_name/libs/*.lprof
-static void load_lib_metadata (const char *libs_path, const char *file_name,
-                               lprof_libraries_info_header_t *lib_metadata_header,
-                               lprof_libraries_info_t *lib_metadata)
+/* Loads to index library metadata from libs_path/file_name (one library per file)
+ * Returns 0 on success */
+static int load_lib_metadata (const char *libs_path, const char *file_name, lprof_index_t *index)
 {
    FILE *fp = fopen_in_directory (libs_path, file_name, "r");
    if (!fp) {
       ERRMSG ("Cannot load libraries metadata from %s\n", libs_path);
-      memset (lib_metadata_header, 0, sizeof *lib_metadata_header);
-      lib_metadata_header->nbLibraries = 0;
-      return;
+      return -1;
    }
 
-   // Skip header (unused)
-   lprof_header_t lprof_header;
-   get_lprof_header (fp, &lprof_header);
-
-   // Get number of functions and loops
-   get_libs_info_header (fp, lib_metadata_header);
+   // Map the (indexed) metafile
+   int ret = map_lprof_index (fp, index, NULL);
+
+   // Metafile written before indexed ones: read the library and index it in memory
+   if (ret == 1) {
+      lprof_header_t lprof_header;
+      lprof_libraries_info_header_t header;
+      lprof_libraries_info_t info;
+      get_lprof_header (fp, &lprof_header);
+      get_libs_info_header (fp, &header);
+      get_libs_info (fp, &(header.nbLibraries), &info);
+
+      ret = -1;
+      if (header.nbLibraries > 0) {
+         const lprof_library_t *lib = &(info.libraries [0]);
+         ret = load_lprof_index (index, lib->name, lib->nbFunctions, lib->fctsInfo,
+                                 lib->nbLoops, lib->loopsInfo);
+      }
 
-   // Write metadata to lib_metadata
-   get_libs_info (fp, &(lib_metadata_header->nbLibraries), lib_metadata);
+      unsigned i;
+      for (i=0; i < header.nbLibraries; i++) free_library (&(info.libraries [i]));
+      lc_free (info.libraries);
+   }
 
    fclose (fp);
+
+   if (ret != 0)
+      ERRMSG ("Cannot load library metadata from %s/%s\n", libs_path, file_name);
+
+   return ret;
 }
 
-// Returns AVL tree corresponding to functions read from metadata
-static avlTree_t *get_fcts_tree (unsigned nb_fcts, lprof_fct_t *fcts, unsigned nb_processes)
+/* Sets functions/loops of a module from its index: one per range, all allocated at once
+ * lib_rank is saved as libraryIdx (-1 for executable) so that concurrent searches never write to them */
+static void init_module (lprof_module_t *module, const lprof_index_t *index, int32_t lib_rank,
+                         unsigned nb_processes, const sampling_display_context_t *context)
 {
-   unsigned i, j;
-   avlTree_t *fcts_tree = NULL;
-
-   for (i=0; i < nb_fcts; i++) {
-      for (j=0; j < fcts[i].nbParts; j++) {
-         SinfoFunc *fct = function_to_infoFunc (&fcts[i], j, nb_processes);
-         fcts_tree = insert (fcts[i].startAddress[j], fct, fcts_tree);
+   const lprof_index_header_t *header = index->header;
+   uint32_t i;
+
+   module->index = index;
+   module->fcts  = NULL;
+   module->loops = NULL;
+
+   if (context->display_functions && header->nbFctRanges > 0) {
+      const uint32_t nb_fcts = header->nbFctRanges;
+      SinfoFunc *fcts            = lc_malloc0 (nb_fcts * sizeof fcts[0]);
+      uint32_t ***hwc            = lc_calloc (nb_fcts * nb_processes, sizeof hwc[0]);
+      hashtable_t ***callchains  = lc_calloc (nb_fcts * nb_processes, sizeof callchains[0]);
+      uint32_t **total           = lc_calloc (nb_fcts * nb_processes, sizeof total[0]);
+
+      for (i=0; i < nb_fcts; i++) {
+         const lprof_range_t *range = &(index->fctRanges [i]);
+         const lprof_index_fct_t *fct = &(index->fcts [range->entry]);
+         fcts[i].name            = get_lprof_index_string (index, fct->name);
+         fcts[i].start           = range->start;
+         fcts[i].stop            = range->stop;
+         fcts[i].src_file        = get_lprof_index_string (index, fct->srcFile);
+         fcts[i].src_line        = fct->srcLine;
+         fcts[i].hwcInfo         = &(hwc        [i * nb_processes]);
+         fcts[i].callChainsInfo  = &(callchains [i * nb_processes]);
+         fcts[i].totalCallChains = &(total      [i * nb_processes]);
+         fcts[i].libraryIdx      = lib_rank;
       }
+      module->fcts = fcts;
    }
 
-   return fcts_tree;
+   if (context->display_loops && header->nbLoopRanges > 0) {
+      const uint32_t nb_loops = header->nbLoopRanges;
+      SinfoLoop *loops = lc_malloc0 (nb_loops * sizeof loops[0]);
+      uint32_t ***hwc  = lc_calloc (nb_loops * nb_processes, sizeof hwc[0]);
+
+      for (i=0; i < nb_loops; i++) {
+         const lprof_range_t *range = &(index->loopRanges [i]);
+         const lprof_index_loop_t *loop = &(index->loops [range->entry]);
+         loops[i].loop_id        = loop->id;
+         loops[i].start          = range->start;
+         loops[i].stop           = range->stop;
+         loops[i].src_file       = get_lprof_index_string (index, loop->srcFile);
+         loops[i].func_name      = get_lprof_index_string (index, loop->srcFunctionName);
+         loops[i].src_line_start = loop->srcStartLine;
+         loops[i].src_line_end   = loop->srcStopLine;
+         loops[i].level          = loop_level_enum_to_char (loop->level);
+         loops[i].hwcInfo        = &(hwc [i * nb_processes]);
+         loops[i].libraryIdx     = lib_rank;
+      }
+      module->loops = loops;
+   }
 }
 
-// Returns AVL tree corresponding to loops read from metadata
-static avlTree_t *get_loops_tree (unsigned nb_loops, lprof_loop_t *loops, unsigned nb_processes)
+// Frees functions/loops set by init_module
+static void free_module (lprof_module_t *module)
 {
-   unsigned i, j;
-   avlTree_t *loops_tree = NULL;
-
-   for (i=0; i < nb_loops; i++) {
-      for (j=0; j < loops[i].nbParts; j++) {
-         SinfoLoop *loop = lprof_loop_to_infoLoop (&loops[i], j, nb_processes);
-         loops_tree = insert (loops[i].startAddress[j], loop, loops_tree);
-      }
+   if (module->fcts != NULL) {
+      lc_free (module->fcts[0].hwcInfo);
+      lc_free (module->fcts[0].callChainsInfo);
+      lc_free (module->fcts[0].totalCallChains);
+      lc_free (module->fcts);
+   }
+   if (module->loops != NULL) {
+      lc_free (module->loops[0].hwcInfo);
+      lc_free (module->loops);
    }
-
-   return loops_tree;
 }
 
 // Used by load_system_maps
@@ -261,32 +356,19 @@ static int compar_map_symbols (const void *p1, const void *p2)
 {
    const map_symbol_t *s1 = *((map_symbol_t *const *) p1);
    const map_symbol_t *s2 = *((map_symbol_t *const *) p2);
-   return s1->addr - s2->addr;
+   if (s1->addr < s2->addr) return -1;
+   return s1->addr > s2->addr ? 1 : 0;
 }
 
-static void insert_last_symbol (avlTree_t **sys_tree, uint64_t addr, unsigned nb_processes)
+/* Converts system maps file (node_path/system_map) to node system functions, sorted by address ranges
+ * Like init_module, all functions (and their HW events pointers) are allocated at once */
+static void load_system_maps (const char *node_path, lprof_node_t *node, unsigned nb_processes)
 {
-   SinfoFunc *fct = lc_malloc (sizeof *fct);
-   fct->name            = lc_strdup ("unknown kernel region");
-   fct->src_file        = NULL;
-   fct->src_line        = -1;
-   fct->hwcInfo         = lc_calloc (nb_processes, sizeof fct->hwcInfo[0]);
-   fct->callChainsInfo  = lc_calloc (nb_processes, sizeof fct->callChainsInfo[0]);
-   fct->totalCallChains = lc_calloc (nb_processes, sizeof fct->totalCallChains[0]);
-   fct->libraryIdx      = -2; //  -2 == SYSTEM CALL
-
-   // CF AMD64 (x86-64) "canonical form addresses"
-   fct->start           = (addr == 0) ? 0xFFFF800000000000 : addr;
-   fct->stop            = UINT64_MAX;
+   node->nb_sys_fcts = 0;
+   node->sys_fcts    = NULL;
 
-   *sys_tree = insert (addr, fct, *sys_tree);
-}
-
-// Converts system maps file (node_path/system_map) to a tree of system functions (indexed by address ranges)
-static avlTree_t *load_system_maps (const char *node_path, unsigned nb_processes)
-{
    FILE *fp = fopen_in_directory (node_path, "system_map", "r");
-   if (!fp) return NULL;
+   if (!fp) return;
 
    array_t *map_symbols = array_new();
 
@@ -305,12 +387,22 @@ static avlTree_t *load_system_maps (const char *node_path, unsigned nb_processes
 
    fclose (fp);
 
-   if (array_length (map_symbols) == 0) return NULL;
+   const unsigned nb_symbols = array_length (map_symbols);
+   if (nb_symbols == 0) {
+      array_free (map_symbols, NULL);
+      return;
+   }
   
    // Sort symbols by increasing address
    array_sort (map_symbols, compar_map_symbols);
 
-   avlTree_t *sys_tree = NULL;
+   // At most one function per symbol, plus the last (unknown) region
+   SinfoFunc *fcts           = lc_malloc0 ((nb_symbols + 1) * sizeof fcts[0]);
+   uint32_t ***hwc           = lc_calloc ((nb_symbols + 1) * nb_processes, sizeof hwc[0]);
+   hashtable_t ***callchains = lc_calloc ((nb_symbols + 1) * nb_processes, sizeof callchains[0]);
+   uint32_t **total          = lc_calloc ((nb_symbols + 1) * nb_processes, sizeof total[0]);
+   uint32_t nb_fcts = 0;
+
    map_symbol_t *prv = NULL; // previous symbol
    FOREACH_INARRAY (map_symbols, ms_iter) {
       map_symbol_t *cur = ARRAY_GET_DATA (NULL, ms_iter); // current symbol
@@ -318,32 +410,47 @@ static avlTree_t *load_system_maps (const char *node_path, unsigned nb_processes
       // Inserting previous function
       // Stop address for a function can be deduced only from next function start address
       if (prv != NULL && prv->addr < cur->addr) {
-         SinfoFunc *fct = lc_malloc (sizeof *fct);
+         SinfoFunc *fct = &(fcts [nb_fcts++]);
          fct->name            = prv->name;
          fct->start           = prv->addr; // current function start addr. is previous function stop addr.
          fct->stop            = cur->addr - 1;
          fct->src_file        = NULL;
          fct->src_line        = -1;
-         fct->hwcInfo         = lc_calloc (nb_processes, sizeof fct->hwcInfo[0]);
-         fct->callChainsInfo  = lc_calloc (nb_processes, sizeof fct->callChainsInfo[0]);
-         fct->totalCallChains = lc_calloc (nb_processes, sizeof fct->totalCallChains[0]);
          fct->libraryIdx      = -2; //  -2 == SYSTEM CALL
          DBGMSGLVL(1, "%s [%"PRIx64"- %"PRIx64"]\n", fct->name, fct->start, fct->stop);
-         sys_tree = insert (prv->addr, fct, sys_tree);
       } else if (prv != NULL)
          lc_free (prv->name);
 
       prv = cur;
    }
-   insert_last_symbol (&sys_tree, prv->addr, nb_processes);
+   lc_free (prv->name);
+
+   // Last symbol
+   SinfoFunc *fct = &(fcts [nb_fcts++]);
+   fct->name            = lc_strdup ("unknown kernel region");
+   fct->src_file        = NULL;
+   fct->src_line        = -1;
+   fct->libraryIdx      = -2; //  -2 == SYSTEM CALL
+
+   // CF AMD64 (x86-64) "canonical form addresses"
+   fct->start           = (prv->addr == 0) ? 0xFFFF800000000000 : prv->addr;
+   fct->stop            = UINT64_MAX;
+
+   unsigned i;
+   for (i=0; i < nb_fcts; i++) {
+      fcts[i].hwcInfo         = &(hwc        [i * nb_processes]);
+      fcts[i].callChainsInfo  = &(callchains [i * nb_processes]);
+      fcts[i].totalCallChains = &(total      [i * nb_processes]);
+   }
 
    array_free (map_symbols, lc_free);
 
-   return sys_tree;
+   node->nb_sys_fcts = nb_fcts;
+   node->sys_fcts    = fcts;
 }
 
 // Pushes (as a table) to the LUA stack data related to a function coming from application executable
-static void push_exe_fct (lua_State *L, lprof_fct_t *fct)
+static void push_exe_fct (lua_State *L, const lprof_index_t *index, const lprof_index_fct_t *fct)
 {
    lua_newtable (L); // function data
 
@@ -352,15 +459,15 @@ static void push_exe_fct (lua_State *L, lprof_fct_t *fct)
    lua_newtable (L);                      // value: outermost loops table
    unsigned i;
    for (i=0; i<fct->nbOutermostLoops; i++) {
-      lua_pushnumber (L, fct->outermostLoopsList [i]); // key: loop ID
-      lua_pushboolean (L, TRUE);                       // value: boolean true
-      lua_rawset (L, -3);                              // set key+value for level-2 table (loops)
+      lua_pushnumber (L, index->ids [fct->outermostLoops + i]); // key: loop ID
+      lua_pushboolean (L, TRUE);                                // value: boolean true
+      lua_rawset (L, -3);                                       // set key+value for level-2 table (loops)
    }
    lua_rawset (L, -3); // set outermost loops key to "outermost loops"
 }
 
 // Pushes (as a table) to the LUA stack data related to a loop coming from application executable
-static void push_exe_loop (lua_State *L, lprof_loop_t *loop)
+static void push_exe_loop (lua_State *L, const lprof_index_t *index, const lprof_index_loop_t *loop)
 {
    lua_newtable (L); // loop data
 
@@ -369,16 +476,16 @@ static void push_exe_loop (lua_State *L, lprof_loop_t *loop)
    lua_newtable (L);               // value: table with (ID,true) pairs
    unsigned i;
    for (i=0; i<loop->nbChildren; i++) {
-      lua_pushnumber (L, loop->childrenList [i]); // key
-      lua_pushboolean (L, TRUE);                  // value
-      lua_rawset (L, -3);                         // set key+value for children loops table
+      lua_pushnumber (L, index->ids [loop->children + i]); // key
+      lua_pushboolean (L, TRUE);                           // value
+      lua_rawset (L, -3);                                  // set key+value for children loops table
    }
    lua_rawset (L, -3); // set children table key to "children"
 
    // Source file
-   lua_pushstring (L, "src_file");               // key
-   lua_pushstring (L, basename (loop->srcFile)); // value
-   lua_rawset (L, -3);                           // set value key to "src_file"
+   lua_pushstring (L, "src_file");                                                // key
+   lua_pushstring (L, basename (get_lprof_index_string (index, loop->srcFile))); // value
+   lua_rawset (L, -3);                                                            // set value key to "src_file"
 
    // Start source line
    lua_pushstring (L, "src_line_start");    // key
@@ -640,6 +747,7 @@ static void push_node (lua_State *L, const lprof_node_t *node)
  * Each element is pushed by a generic function passed as parameter */
 static void push_context (lua_State *L, const sampling_display_context_t *context)
 {
+   const lprof_index_t *exe_index = &(context->exe_index);
    unsigned i;
    lua_newtable (L); // context data
 
@@ -658,9 +766,9 @@ static void push_context (lua_State *L, const sampling_display_context_t *contex
       lua_pushstring (L, "executable functions");
       lua_newtable (L); // table of functions
       for (i=0; i<context->nb_exe_fcts; i++) {
-         lprof_fct_t *fct = &(context->exe_fcts [i]);
-         lua_pushstring (L, fct->name); // key
-         push_exe_fct (L, fct);         // value
+         const lprof_index_fct_t *fct = &(exe_index->fcts [i]);
+         lua_pushstring (L, get_lprof_index_string (exe_index, fct->name)); // key
+         push_exe_fct (L, exe_index, fct);                                  // value
          lua_rawset (L, -3); // set function data key
       }
       lua_rawset (L, -3); // set table of functions key to "executable functions"
@@ -671,9 +779,9 @@ static void push_context (lua_State *L, const sampling_display_context_t *contex
       lua_pushstring (L, "executable loops");
       lua_newtable (L); // table of loops
       for (i=0; i<context->nb_exe_loops; i++) {
-         lprof_loop_t *loop = &(context->exe_loops [i]);
-         lua_pushnumber (L, loop->id); // key
-         push_exe_loop (L, loop);      // value
+         const lprof_index_loop_t *loop = &(exe_index->loops [i]);
+         lua_pushnumber (L, loop->id);        // key
+         push_exe_loop (L, exe_index, loop);  // value
          lua_rawset (L, -3); // set loop data key
       }
       lua_rawset (L, -3); // set table of loops key to "executable loops"
@@ -699,12 +807,29 @@ int push_outputs (lua_State *L, sampling_display_context_t *context)
    return 1;
 }
 
+/* In a module (executable or library), look for the object (function/loop part) containing a given address
+ * (such as obj.start_addr <= addr <= obj.end_addr). Among overlapping parts, the latest starting one is returned
+ */
+static void *search_obj_in_module (uint64_t addr, const lprof_module_t *module, int display_type)
+{
+   const lprof_index_t *index = module->index;
+   int64_t rank;
+
+   if (display_type == PERF_FUNC) {
+      if (module->fcts == NULL) return NULL;
+      rank = search_lprof_ranges (index->fctRanges, index->header->nbFctRanges, addr);
+      return rank >= 0 ? &(module->fcts [rank]) : NULL;
+   }
+
+   if (module->loops == NULL) return NULL;
+   rank = search_lprof_ranges (index->loopRanges, index->header->nbLoopRanges, addr);
+   return rank >= 0 ? &(module->loops [rank]) : NULL;
+}
+
 /* In libraries, look for the object (function/loop) containing a given address
  * (such as obj.start_addr <= addr <= obj.end_addr)
  */
-static avlTree_t *search_obj_in_libraries (uint64_t addr, avlTree_t **lib_trees,
-                                           const lprof_process_t *process,
-                                           int display_type, int *lib_rank)
+static void *search_obj_in_libraries (uint64_t addr, const lprof_process_t *process, int display_type)
 {
    if (addr <= 0x3000000) return NULL;
 
@@ -714,8 +839,10 @@ static avlTree_t *search_obj_in_libraries (uint64_t addr, avlTree_t **lib_trees,
 
    // For each library in the current node
    for (i=0; i < node->nb_libs; i++) {
+      const lprof_module_t *module = &(node->libs [i]);
 
-      if (lib_trees[i] == NULL) continue; // skip libraries with no ranges info
+      // skip libraries with no ranges info
+      if ((display_type == PERF_FUNC ? (void *) module->fcts : (void *) module->loops) == NULL) continue;
 
       // Skip non-matching libraries
       if (addr >= libs[i].startMapAddress[process->map_rank] &&
@@ -725,88 +852,166 @@ static avlTree_t *search_obj_in_libraries (uint64_t addr, avlTree_t **lib_trees,
          if (addr <= 0x3000000000 || addr >= 0x4000000000)
             addr -= libs[i].startMapAddress[process->map_rank];
 
-         avlTree_t *found = search_address (addr, lib_trees[i], display_type);
-         *lib_rank = i;
-         return found;
+         return search_obj_in_module (addr, module, display_type);
       }
    }
 
    return NULL;
 }
 
+// Returns the system function containing a given address, NULL if none
+static SinfoFunc *search_sys_fct (uint64_t addr, const lprof_node_t *node)
+{
+   uint32_t low = 0, high = node->nb_sys_fcts;
+
+   // First function starting after addr
+   while (low < high) {
+      const uint32_t middle = low + (high - low) / 2;
+      if (node->sys_fcts [middle].start <= addr)
+         low = middle + 1;
+      else
+         high = middle;
+   }
+
+   if (low == 0) return NULL;
+   SinfoFunc *fct = &(node->sys_fcts [low-1]);
+
+   return fct->stop >= addr ? fct : NULL;
+}
+
 /* Returns the object (function or loop), if any, related to the address for a given process
- * Common part to search_fct_from_addr and search_loop_from_addr => CF these functions
+ * Searched in executable, then in libraries and then (functions only) in system (kernel) functions
+ * Defines what the process address index resolves to (CF get_process_address_index)
  */
-static avlTree_t *search_obj (uint64_t addr, const lprof_process_t *process,
-                              avlTree_t *exe_tree, avlTree_t *sys_tree, avlTree_t **lib_trees,
-                              int display_type, int *lib_rank)
+static void *search_obj (uint64_t addr, const lprof_process_t *process, int display_type)
 {
+   const lprof_node_t *node = process->parent_node;
+
    // Search in executable functions/loops
-   avlTree_t *found = search_address (addr - process->exe_offset, exe_tree, display_type);
-   if (found != NULL) { *lib_rank = -1; return found; }
+   void *found = search_obj_in_module (addr - process->exe_offset, &(node->exe), display_type);
+   if (found != NULL) return found;
 
    // If not found in executable, search in libraries functions/loops
-   found = search_obj_in_libraries (addr, lib_trees, process, display_type, lib_rank);
+   found = search_obj_in_libraries (addr, process, display_type);
    if (found != NULL) return found;
 
    // If not found in libraries, search in system (kernel) functions
-   if (sys_tree != NULL) {
-      found = search_address (addr, sys_tree, display_type);
-      if (found != NULL) *lib_rank = -2;
-   }
+   if (display_type == PERF_FUNC)
+      return search_sys_fct (addr, node);
 
-   return found;
+   return NULL;
 }
 
-/* Returns the function (SinfoFunc), if any, related to the address for a given process
- * Function will be searched in executable (in user code and then in system code) and then in libraries
- */
-static SinfoFunc *search_fct_from_addr (uint64_t addr, const lprof_process_t *process)
+// Used by get_process_address_index to evaluate function and loop at an address (CF address_resolver_t)
+static void resolve_process_address (uint64_t addr, void *user, SinfoFunc **fct, SinfoLoop **loop)
 {
-   SinfoFunc *cached = hashtable_lookup (process->ip2fct_cache, (void *) addr);
-   if (cached) return cached;
+   const lprof_process_t *process = user;
+   const sampling_display_context_t *context = process->parent_node->parent_context;
 
-   const lprof_node_t *node = process->parent_node;
+   *fct  = context->display_functions ? search_obj (addr, process, PERF_FUNC) : NULL;
+   *loop = context->display_loops     ? search_obj (addr, process, PERF_LOOP) : NULL;
+}
 
-   int lib_rank = -1;
-   avlTree_t *found = search_obj (addr, process,
-                                  node->exe_fcts_tree,
-                                  node->sys_fcts_tree,
-                                  node->libs_fcts_tree,
-                                  PERF_FUNC, &lib_rank);
+/* Appends to bounds the address following an inclusive stop address
+ * Nothing follows UINT64_MAX (stop+1 would wrap to 0): no bound needed */
+static size_t add_bound_after (uint64_t *bounds, size_t nb_bounds, uint64_t stop)
+{
+   if (stop != UINT64_MAX)
+      bounds [nb_bounds++] = stop + 1;
+
+   return nb_bounds;
+}
+
+// Appends to bounds the start and stop+1 addresses of the function/loop ranges of a module, moved by offset
+static size_t add_module_bounds (uint64_t *bounds, size_t nb_bounds, const lprof_module_t *module, uint64_t offset)
+{
+   const lprof_index_t *index = module->index;
+   uint32_t i;
+
+   if (module->fcts != NULL) {
+      for (i=0; i < index->header->nbFctRanges; i++) {
+         bounds [nb_bounds++] = index->fctRanges[i].start + offset;
+         nb_bounds = add_bound_after (bounds, nb_bounds, index->fctRanges[i].stop + offset);
+      }
+   }
 
-   if (found != NULL) {
-      SinfoFunc *fct = found->value;
-      fct->libraryIdx = lib_rank;
-      hashtable_insert (process->ip2fct_cache, (void *) addr, fct);
-      return fct;
+   if (module->loops != NULL) {
+      for (i=0; i < index->header->nbLoopRanges; i++) {
+         bounds [nb_bounds++] = index->loopRanges[i].start + offset;
+         nb_bounds = add_bound_after (bounds, nb_bounds, index->loopRanges[i].stop + offset);
+      }
    }
 
-   hashtable_insert (process->ip2fct_cache, (void *) addr, process->parent_node->unknown_fcts);
-   return process->parent_node->unknown_fcts;
+   return nb_bounds;
 }
 
-/* Returns the loop (SinfoLoop), if any, related to the address for a given process
- * Loop will be searched in executable (in user code only, system code excluded) and then in libraries
- */
-static SinfoLoop *search_loop_from_addr (uint64_t addr, const lprof_process_t *process)
+// Returns the maximum number of bounds added by add_module_bounds
+static size_t get_module_nb_bounds (const lprof_module_t *module)
+{
+   const lprof_index_header_t *header = module->index->header;
+
+   return 2 * ((module->fcts  != NULL ? header->nbFctRanges  : 0) +
+               (module->loops != NULL ? header->nbLoopRanges : 0));
+}
+
+/* Returns the address index of a process, resolving any IP to function and innermost loop at once
+ * (executable, libraries and system functions). Objects are evaluated by search_obj at every address
+ * where they can change: ranges bounds (moved like in search_obj_in_libraries for libraries),
+ * libraries mapping and system functions */
+static address_index_t *get_process_address_index (const lprof_process_t *process)
 {
    const lprof_node_t *node = process->parent_node;
+   const unsigned rank = process->map_rank;
+   unsigned i;
 
-   int lib_rank = -1;
-   avlTree_t *found = search_obj (addr, process,
-                                  node->exe_loops_tree,
-                                  NULL,
-                                  node->libs_loops_tree,
-                                  PERF_LOOP, &lib_rank);
+   // Allocate bounds
+   size_t max_bounds = 3 + get_module_nb_bounds (&(node->exe)) + 2 * node->nb_sys_fcts;
+   for (i=0; i < node->nb_libs; i++)
+      max_bounds += 2 + 2 * get_module_nb_bounds (&(node->libs [i]));
+   uint64_t *bounds = lc_malloc (max_bounds * sizeof bounds[0]);
 
-   if (found != NULL) {
-      SinfoLoop *loop = found->value;
-      loop->libraryIdx = lib_rank;
-      return loop;
+   // Executable
+   size_t nb_bounds = add_module_bounds (bounds, 0, &(node->exe), process->exe_offset);
+
+   // Libraries (CF search_obj_in_libraries)
+   bounds [nb_bounds++] = 0x3000001;
+   bounds [nb_bounds++] = 0x3000000001;
+   bounds [nb_bounds++] = 0x4000000000;
+   for (i=0; i < node->nb_libs; i++) {
+      const uint64_t start = node->libsInfo.libraries [i].startMapAddress [rank];
+      const uint64_t stop  = node->libsInfo.libraries [i].stopMapAddress  [rank];
+      if (start == 0 && stop == 0) continue; // not mapped by this process
+
+      bounds [nb_bounds++] = start;
+      nb_bounds = add_bound_after (bounds, nb_bounds, stop);
+
+      // libc/libld are mapped between 0x3000000000 and 0x4000000000: no offset there
+      if (start <= 0x3000000000 || stop >= 0x4000000000)
+         nb_bounds = add_module_bounds (bounds, nb_bounds, &(node->libs [i]), start);
+      if (start < 0x4000000000 && stop > 0x3000000000)
+         nb_bounds = add_module_bounds (bounds, nb_bounds, &(node->libs [i]), 0);
    }
 
-   return NULL;
+   // System functions
+   for (i=0; i < node->nb_sys_fcts; i++) {
+      bounds [nb_bounds++] = node->sys_fcts[i].start;
+      nb_bounds = add_bound_after (bounds, nb_bounds, node->sys_fcts[i].stop);
+   }
+
+   address_index_t *index = address_index_new (bounds, nb_bounds, resolve_process_address, (void *) process);
+   lc_free (bounds);
+
+   return index;
+}
+
+/* Returns the function (SinfoFunc) related to the address for a given process, unknown functions if none
+ * Only while mapping samples of the process (CF map_process_samples_to_hotspots)
+ */
+static SinfoFunc *search_fct_from_addr (uint64_t addr, const lprof_process_t *process)
+{
+   SinfoFunc *fct = address_index_lookup (process->addr_index, addr)->fct;
+
+   return fct != NULL ? fct : process->parent_node->unknown_fcts;
 }
 
 // Remark: does not cover 100% cases
@@ -1064,16 +1269,59 @@ static void update_categories (const raw_IP_events_t *IP_events, lprof_thread_t
    }
 }
 
-// Increments/updates results of the function "hit" by a given sample
-static void map_IP_to_function (lprof_thread_t *thread, const raw_IP_events_t *IP_events,
+// Returns the function saved in a thread for a function part, inserting it if needed (one per name+module)
+static SinfoFunc *insert_fct_to_thread (lprof_thread_t *thread, SinfoFunc *fct_part)
+{
+   char *key = lc_malloc (strlen (fct_part->name) + strlen ("4000000000") + 1);
+   sprintf (key, "%s%d", fct_part->name, fct_part->libraryIdx);
+   SinfoFunc *f = hashtable_lookup (thread->fcts, key);
+   if (f == NULL) {
+      hashtable_insert (thread->fcts, key, fct_part);
+      // key will be freed at hashtable_free
+      return fct_part;
+   }
+
+   lc_free (key);
+   return f;
+}
+
+// Returns the loop saved in a thread for a loop part, inserting it if needed (one per ID+module)
+static SinfoLoop *insert_loop_to_thread (lprof_thread_t *thread, SinfoLoop *loop_part)
+{
+   const lprof_node_t *node = thread->parent_process->parent_node;
+   char *module_name;
+   if (loop_part->libraryIdx > -1)
+      module_name = node->libsInfo.libraries [loop_part->libraryIdx].name;
+   else if (loop_part->libraryIdx == -2)
+      module_name = "SYSTEM CALL";
+   else
+      module_name = node->parent_context->exe_name;
+
+   hashtable_t *module_loops = hashtable_lookup (thread->loops, module_name);
+   if (module_loops == NULL) {
+      module_loops = hashtable_new (direct_hash, direct_equal);
+      hashtable_insert (module_loops, (void *)(uint64_t) loop_part->loop_id, loop_part);
+      hashtable_insert (thread->loops, module_name, module_loops);
+      return loop_part;
+   }
+
+   SinfoLoop *l = hashtable_lookup (module_loops, (void *)(uint64_t) loop_part->loop_id);
+   if (l == NULL) {
+      hashtable_insert (module_loops, (void *)(uint64_t) loop_part->loop_id, loop_part);
+      return loop_part;
+   }
+
+   return l;
+}
+
+// Increments/updates results of the function "hit" by a given sample (fct_part: related function part, if any)
+static void map_IP_to_function (lprof_thread_t *thread, const raw_IP_events_t *IP_events, SinfoFunc *fct_part,
                                 unsigned nb_threads, unsigned HW_evts_per_grp)
 {
    const lprof_process_t *process = thread->parent_process;
    unsigned i;
 
-   // Get related function part (start-end addresses range)
-   SinfoFunc *fct_part = search_fct_from_addr (IP_events->ip, process);
-   if (!fct_part || fct_part == process->parent_node->unknown_fcts) {
+   if (!fct_part) {
       fct_part = process->parent_node->unknown_fcts;
       for (i=0; i<HW_evts_per_grp; i++)
          fct_part->hwcInfo [process->map_rank][thread->rank][i] += IP_events->eventsNb[i];
@@ -1085,16 +1333,7 @@ static void map_IP_to_function (lprof_thread_t *thread, const raw_IP_events_t *I
       hashtable_insert (process->is_library, fct_part, fct_part);
 
    // Insert to process functions (if not already inserted: one per name+module)
-   char *key = lc_malloc (strlen (fct_part->name) + strlen ("4000000000") + 1);
-   sprintf (key, "%s%d", fct_part->name, fct_part->libraryIdx);
-   SinfoFunc *f = hashtable_lookup (thread->fcts, key);
-   if (f == NULL) {
-      hashtable_insert (thread->fcts, key, fct_part);
-      // key will be freed at hashtable_free
-   } else {
-      fct_part = f;
-      lc_free (key);
-   }
+   fct_part = insert_fct_to_thread (thread, fct_part);
 
    // Increment events for current thread
    const sampling_display_context_t *context = process->parent_node->parent_context;
@@ -1109,40 +1348,17 @@ static void map_IP_to_function (lprof_thread_t *thread, const raw_IP_events_t *I
    insert_callChainsInfo (IP_events, thread, fct_part);
 }
 
-// Increments/updates results of the loop "hit" by a given sample
-static void map_IP_to_loop (lprof_thread_t *thread, const raw_IP_events_t *IP_events,
+// Increments/updates results of the loop "hit" by a given sample (loop_part: related innermost loop part, if any)
+static void map_IP_to_loop (lprof_thread_t *thread, const raw_IP_events_t *IP_events, SinfoLoop *loop_part,
                             unsigned nb_threads, unsigned HW_evts_per_grp)
 {
    const lprof_process_t *process = thread->parent_process;
    unsigned i;
 
-   // Get related loop part (start-end addresses range)
-   SinfoLoop *loop_part = search_loop_from_addr (IP_events->ip, process);
    if (loop_part == NULL) return;
 
    // Insert to thread loops (if not already inserted: one per ID+module)
-   lprof_node_t *node = process->parent_node;
-   char *module_name;
-   if (loop_part->libraryIdx > -1)
-      module_name = node->libsInfo.libraries [loop_part->libraryIdx].name;
-   else if (loop_part->libraryIdx == -2)
-      module_name = "SYSTEM CALL";
-   else
-      module_name = node->parent_context->exe_name;
-
-   hashtable_t *module_loops = hashtable_lookup (thread->loops, module_name);
-   if (module_loops == NULL) {
-      module_loops = hashtable_new (direct_hash, direct_equal);
-      hashtable_insert (module_loops, (void *)(uint64_t) loop_part->loop_id, loop_part);
-      hashtable_insert (thread->loops, module_name, module_loops);
-   } else {
-      SinfoLoop *l = hashtable_lookup (module_loops, (void *)(uint64_t) loop_part->loop_id);
-      if (l == NULL) {
-         hashtable_insert (module_loops, (void *)(uint64_t) loop_part->loop_id, loop_part);
-      } else {
-         loop_part = l;
-      }
-   }
+   loop_part = insert_loop_to_thread (thread, loop_part);
 
    // Increment events for current thread
    const sampling_display_context_t *context = process->parent_node->parent_context;
@@ -1151,17 +1367,467 @@ static void map_IP_to_loop (lprof_thread_t *thread, const raw_IP_events_t *IP_ev
       loop_part->hwcInfo [process->map_rank][thread->rank][i] += IP_events->eventsNb[i];
 }
 
-// Map (from instruction addresses) samples to executable/libraries functions/loops
+// Protects events list setting (processes are mapped concurrently)
+static pthread_mutex_t ev_list_lock = PTHREAD_MUTEX_INITIALIZER;
+
+// Sets the events list of the context from the first mapped process
+static void set_events_list (sampling_display_context_t *context, const char *ev_list, unsigned evts_per_grp)
+{
+   pthread_mutex_lock (&ev_list_lock);
+   if (!context->ev_list) {
+      context->ev_list = strdup (ev_list);
+      context->events_per_group = evts_per_grp;
+   }
+   pthread_mutex_unlock (&ev_list_lock);
+}
+
+/* Hotspots cache: <process path>/hotspots_<F><L>.lprof, F (resp. L) being 1 if functions (resp. loops) are displayed
+ * Saves results of map_process_samples_to_hotspots so that a next display of the same experiment (other view or
+ * output format) reuses them instead of mapping samples again. Functions and loops are saved as (library rank,
+ * start address) pairs, searched again in node trees at loading.
+ * A cache file is used only if its key (CF get_hotspots_cache_key) matches the current one */
+#define HOTSPOTS_CACHE_VERSION 1
+
+// Returns the name of the hotspots cache file for a process
+static char *get_hotspots_cache_name (const char *process_path, const sampling_display_context_t *context)
+{
+   char *name = lc_malloc (strlen (process_path) + strlen ("/hotspots_11.lprof") + 1);
+   sprintf (name, "%s/hotspots_%d%d.lprof", process_path,
+            context->display_functions ? 1 : 0, context->display_loops ? 1 : 0);
+   return name;
+}
+
+// Hotspots cache key under construction (CF get_hotspots_cache_key)
+typedef struct {
+   char *str;
+   size_t len;
+} hotspots_cache_key_t;
+
+// Appends to a hotspots cache key the name, size and modification time of a file (used as for_each_file_in_directory callback)
+static void append_file_stamp (const char *dir_name, const char *file_name, void *data)
+{
+   hotspots_cache_key_t *key = data;
+
+   char full_name [strlen (dir_name) + strlen (file_name) + 2];
+   sprintf (full_name, "%s/%s", dir_name, file_name);
+   struct stat st;
+   if (stat (full_name, &st) != 0) memset (&st, 0, sizeof st);
+
+   key->str = lc_realloc (key->str, key->len + strlen (file_name) + 64);
+   key->len += sprintf (key->str + key->len, "|%s %"PRIu64" %"PRId64".%09ld", file_name, (uint64_t) st.st_size,
+                        (int64_t) st.st_mtim.tv_sec, (long) st.st_mtim.tv_nsec);
+}
+
+/* Returns a string identifying inputs of map_process_samples_to_hotspots for a process:
+ * samples file and metafiles (size and modification time), libraries and options changing results */
+static char *get_hotspots_cache_key (const char *node_path, const char *process_path, const lprof_process_t *process)
+{
+   const lprof_node_t *node = process->parent_node;
+   const sampling_display_context_t *context = node->parent_context;
+
+   char IP_events_name [strlen (process_path) + strlen ("/IP_events.lprof") + 1];
+   sprintf (IP_events_name, "%s/IP_events.lprof", process_path);
+   struct stat st;
+   if (stat (IP_events_name, &st) != 0) return NULL;
+
+   unsigned i;
+   size_t key_size = strlen (context->lecLibs) + 256;
+   for (i=0; i < node->nb_libs; i++)
+      key_size += strlen (node->libsInfo.libraries[i].name) + 1;
+
+   char *key = lc_malloc (key_size);
+   int pos = sprintf (key, "v%d %"PRIu64" %"PRId64".%09ld %u %u %d %d %u %u %s",
+                      HOTSPOTS_CACHE_VERSION, (uint64_t) st.st_size,
+                      (int64_t) st.st_mtim.tv_sec, (long) st.st_mtim.tv_nsec,
+                      context->nb_exe_fcts, context->nb_exe_loops,
+                      context->display_functions, context->display_loops,
+                      context->callchain_filter, context->nbExtraCat, context->lecLibs);
+   for (i=0; i < node->nb_libs; i++)
+      pos += sprintf (key + pos, "|%s", node->libsInfo.libraries[i].name);
+
+   // Metafiles, libraries ones in the same order as in load_node_libs (library ranks are saved)
+   hotspots_cache_key_t cache_key = { key, pos };
+   append_file_stamp (context->exp_path, "binary.lprof", &cache_key);
+   char libs_path [strlen (node_path) + strlen ("/libs") + 1];
+   sprintf (libs_path, "%s/libs", node_path);
+   for_each_file_in_directory (libs_path, append_file_stamp, &cache_key);
+
+   return cache_key.str;
+}
+
+static void write_cache_string (FILE *fp, const char *str)
+{
+   uint32_t len = strlen (str);
+   fwrite (&len, sizeof len, 1, fp);
+   fwrite (str, sizeof str[0], len, fp);
+}
+
+// Returns a string read from a cache file (to free with lc_free), NULL on error
+static char *read_cache_string (FILE *fp)
+{
+   uint32_t len;
+   if (fread (&len, sizeof len, 1, fp) != 1 || len > (1 << 24)) return NULL;
+
+   char *str = lc_malloc (len + 1);
+   if (fread (str, sizeof str[0], len, fp) != len) {
+      lc_free (str);
+      return NULL;
+   }
+   str [len] = '\0';
+
+   return str;
+}
+
+// Writes to a cache file a reference to a function/loop: rank of its library (-1: executable, -2: system) and start address
+static void write_cache_obj_ref (FILE *fp, int32_t lib_rank, uint64_t start)
+{
+   fwrite (&lib_rank, sizeof lib_rank, 1, fp);
+   fwrite (&start   , sizeof start   , 1, fp);
+}
+
+// Returns the function/loop referenced in a cache file (CF write_cache_obj_ref), NULL if error or not found
+static void *read_cache_obj_ref (FILE *fp, const lprof_node_t *node, int display_type)
+{
+   int32_t lib_rank; uint64_t start;
+   if (fread (&lib_rank, sizeof lib_rank, 1, fp) != 1 ||
+       fread (&start   , sizeof start   , 1, fp) != 1) return NULL;
+
+   if (lib_rank >= 0 && (uint32_t) lib_rank < node->nb_libs)
+      return search_obj_in_module (start, &(node->libs [lib_rank]), display_type);
+   if (lib_rank == -1)
+      return search_obj_in_module (start, &(node->exe), display_type);
+
+   if (lib_rank == -2 && display_type == PERF_FUNC)
+      return search_sys_fct (start, node);
+
+   return NULL;
+}
+
+// Writes to a cache file functions results for a thread
+static void save_thread_fcts (FILE *fp, const lprof_thread_t *thread, unsigned evts_per_grp)
+{
+   const lprof_process_t *process = thread->parent_process;
+   const unsigned rank = process->map_rank;
+
+   uint32_t nb_fcts = hashtable_size (thread->fcts) - 1; // "UNKNOWN FCTS" saved apart
+   fwrite (&nb_fcts, sizeof nb_fcts, 1, fp);
+
+   FOREACH_INHASHTABLE (thread->fcts, fct_iter) {
+      const SinfoFunc *fct = GET_DATA_T (SinfoFunc *, fct_iter);
+      if (fct == process->parent_node->unknown_fcts) continue;
+
+      write_cache_obj_ref (fp, fct->libraryIdx, fct->start);
+      fwrite (fct->hwcInfo [rank][thread->rank], sizeof fct->hwcInfo[0][0][0], evts_per_grp, fp);
+      fwrite (&(fct->totalCallChains [rank][thread->rank]), sizeof fct->totalCallChains[0][0], 1, fp);
+
+      const hashtable_t *callchains = fct->callChainsInfo [rank][thread->rank];
+      uint32_t nb_callchains = callchains != NULL ? hashtable_size (callchains) : 0;
+      fwrite (&nb_callchains, sizeof nb_callchains, 1, fp);
+      if (callchains == NULL) continue;
+      FOREACH_INHASHTABLE (callchains, callchain_iter) {
+         write_cache_string (fp, GET_KEY (char *, callchain_iter));
+         fwrite (GET_DATA_T (uint64_t *, callchain_iter), sizeof (uint64_t), 1, fp);
+      }
+   }
+}
+
+// Writes to a cache file loops results for a thread
+static void save_thread_loops (FILE *fp, const lprof_thread_t *thread, unsigned evts_per_grp)
+{
+   const unsigned rank = thread->parent_process->map_rank;
+
+   uint32_t nb_modules = hashtable_size (thread->loops);
+   fwrite (&nb_modules, sizeof nb_modules, 1, fp);
+
+   FOREACH_INHASHTABLE (thread->loops, module) {
+      const hashtable_t *module_loops = GET_DATA_T (hashtable_t *, module);
+      uint32_t nb_loops = hashtable_size (module_loops);
+      fwrite (&nb_loops, sizeof nb_loops, 1, fp);
+
+      FOREACH_INHASHTABLE (module_loops, loop_iter) {
+         const SinfoLoop *loop = GET_DATA_T (SinfoLoop *, loop_iter);
+         write_cache_obj_ref (fp, loop->libraryIdx, loop->start);
+         fwrite (loop->hwcInfo [rank][thread->rank], sizeof loop->hwcInfo[0][0][0], evts_per_grp, fp);
+      }
+   }
+}
+
+// Saves to the hotspots cache results of map_process_samples_to_hotspots for a process
+static void save_hotspots_cache (const char *process_path, const lprof_process_t *process,
+                                 const char *key, unsigned nb_threads, unsigned evts_per_grp)
+{
+   const lprof_node_t *node = process->parent_node;
+   const sampling_display_context_t *context = node->parent_context;
+
+   // Write to a temporary file, renamed when complete (never read a partially written cache)
+   char *const cache_name = get_hotspots_cache_name (process_path, context);
+   char tmp_name [strlen (cache_name) + strlen (".tmp") + 1];
+   sprintf (tmp_name, "%s.tmp", cache_name);
+   FILE *fp = fopen (tmp_name, "wb");
+   if (!fp) {
+      DBGMSG ("Cannot save hotspots cache to %s\n", tmp_name);
+      lc_free (cache_name);
+      return;
+   }
+
+   // Header
+   write_cache_string (fp, key);
+   write_cache_string (fp, context->ev_list);
+   uint32_t header [2] = { evts_per_grp, nb_threads };
+   fwrite (header, sizeof header[0], 2, fp);
+
+   // Threads
+   FOREACH_INARRAY (process->threads, thread_iter) {
+      const lprof_thread_t *thread = ARRAY_GET_DATA (NULL, thread_iter);
+      int64_t tid = thread->tid;
+      fwrite (&tid, sizeof tid, 1, fp);
+      fwrite (thread->events_nb, sizeof thread->events_nb[0], evts_per_grp, fp);
+      fwrite (thread->categories, sizeof thread->categories[0], NB_CATEGORIES + context->nbExtraCat, fp);
+      fwrite (thread->libc_categories, sizeof thread->libc_categories[0], LIBC_NB_CATEGORIES, fp);
+      fwrite (node->unknown_fcts->hwcInfo [process->map_rank][thread->rank],
+              sizeof node->unknown_fcts->hwcInfo[0][0][0], evts_per_grp, fp);
+
+      if (context->display_functions) save_thread_fcts  (fp, thread, evts_per_grp);
+      if (context->display_loops    ) save_thread_loops (fp, thread, evts_per_grp);
+   }
+
+   // Process libraries functions
+   uint32_t nb_lib_fcts = hashtable_size (process->is_library);
+   fwrite (&nb_lib_fcts, sizeof nb_lib_fcts, 1, fp);
+   FOREACH_INHASHTABLE (process->is_library, fct_iter) {
+      const SinfoFunc *fct = GET_DATA_T (SinfoFunc *, fct_iter);
+      write_cache_obj_ref (fp, fct->libraryIdx, fct->start);
+   }
+
+   if (ferror (fp) || fclose (fp) != 0 || rename (tmp_name, cache_name) != 0) {
+      DBGMSG ("Cannot save hotspots cache to %s\n", cache_name);
+      remove (tmp_name);
+   }
+   lc_free (cache_name);
+}
+
+// Loads from a cache file functions results for a thread. Returns FALSE on error
+static boolean_t load_thread_fcts (FILE *fp, lprof_thread_t *thread, unsigned nb_threads, unsigned evts_per_grp)
+{
+   const lprof_process_t *process = thread->parent_process;
+   const unsigned rank = process->map_rank;
+
+   uint32_t nb_fcts, i, j;
+   if (fread (&nb_fcts, sizeof nb_fcts, 1, fp) != 1) return FALSE;
+
+   for (i=0; i < nb_fcts; i++) {
+      SinfoFunc *fct = read_cache_obj_ref (fp, process->parent_node, PERF_FUNC);
+      if (fct == NULL) return FALSE;
+      fct = insert_fct_to_thread (thread, fct);
+      init_sinfo_func_hwc (fct, rank, nb_threads, evts_per_grp);
+
+      uint32_t hwc [evts_per_grp], total_callchains, nb_callchains;
+      if (fread (hwc, sizeof hwc[0], evts_per_grp, fp) != evts_per_grp ||
+          fread (&total_callchains, sizeof total_callchains, 1, fp) != 1 ||
+          fread (&nb_callchains, sizeof nb_callchains, 1, fp) != 1)
+         return FALSE;
+      for (j=0; j < evts_per_grp; j++)
+         fct->hwcInfo [rank][thread->rank][j] += hwc[j];
+      fct->totalCallChains [rank][thread->rank] += total_callchains;
+
+      hashtable_t *callchains = fct->callChainsInfo [rank][thread->rank];
+      for (j=0; j < nb_callchains; j++) {
+         uint64_t nb_occurrences;
+         char *callchain = read_cache_string (fp);
+         if (callchain == NULL || fread (&nb_occurrences, sizeof nb_occurrences, 1, fp) != 1) {
+            lc_free (callchain);
+            return FALSE;
+         }
+         if (callchains == NULL) {
+            callchains = hashtable_new (str_hash, str_equal);
+            fct->callChainsInfo [rank][thread->rank] = callchains;
+         }
+         uint64_t *saved_nb = hashtable_lookup (callchains, callchain);
+         if (saved_nb == NULL) {
+            saved_nb = lc_malloc0 (sizeof *saved_nb);
+            hashtable_insert (callchains, callchain, saved_nb);
+         } else
+            lc_free (callchain);
+         *saved_nb += nb_occurrences;
+      }
+   }
+
+   return TRUE;
+}
+
+// Loads from a cache file loops results for a thread. Returns FALSE on error
+static boolean_t load_thread_loops (FILE *fp, lprof_thread_t *thread, unsigned nb_threads, unsigned evts_per_grp)
+{
+   const lprof_process_t *process = thread->parent_process;
+   const unsigned rank = process->map_rank;
+
+   uint32_t nb_modules, nb_loops, i, j, k;
+   if (fread (&nb_modules, sizeof nb_modules, 1, fp) != 1) return FALSE;
+
+   for (i=0; i < nb_modules; i++) {
+      if (fread (&nb_loops, sizeof nb_loops, 1, fp) != 1) return FALSE;
+
+      for (j=0; j < nb_loops; j++) {
+         SinfoLoop *loop = read_cache_obj_ref (fp, process->parent_node, PERF_LOOP);
+         if (loop == NULL) return FALSE;
+         loop = insert_loop_to_thread (thread, loop);
+         init_sinfo_loop_hwc (loop, rank, nb_threads, evts_per_grp);
+
+         uint32_t hwc [evts_per_grp];
+         if (fread (hwc, sizeof hwc[0], evts_per_grp, fp) != evts_per_grp) return FALSE;
+         for (k=0; k < evts_per_grp; k++)
+            loop->hwcInfo [rank][thread->rank][k] += hwc[k];
+      }
+   }
+
+   return TRUE;
+}
+
+// Loads from a cache file results for a thread and inserts it to its process. Returns FALSE on error
+static boolean_t load_thread (FILE *fp, lprof_process_t *process, unsigned nb_threads, unsigned evts_per_grp)
+{
+   const lprof_node_t *node = process->parent_node;
+   const sampling_display_context_t *context = node->parent_context;
+
+   int64_t tid;
+   if (fread (&tid, sizeof tid, 1, fp) != 1) return FALSE;
+
+   insert_thread_to_process (tid, process, evts_per_grp, context->nbExtraCat);
+   lprof_thread_t *thread = array_get_last_elt (process->threads);
+   hashtable_insert (thread->fcts, lc_strdup ("UNKNOWN FCTS"), node->unknown_fcts);
+
+   const size_t nb_categories = NB_CATEGORIES + context->nbExtraCat;
+   if (fread (thread->events_nb, sizeof thread->events_nb[0], evts_per_grp, fp) != evts_per_grp ||
+       fread (thread->categories, sizeof thread->categories[0], nb_categories, fp) != nb_categories ||
+       fread (thread->libc_categories, sizeof thread->libc_categories[0], LIBC_NB_CATEGORIES, fp) != LIBC_NB_CATEGORIES ||
+       fread (node->unknown_fcts->hwcInfo [process->map_rank][thread->rank],
+              sizeof node->unknown_fcts->hwcInfo[0][0][0], evts_per_grp, fp) != evts_per_grp)
+      return FALSE;
+
+   if (context->display_functions && !load_thread_fcts (fp, thread, nb_threads, evts_per_grp))
+      return FALSE;
+   if (context->display_loops && !load_thread_loops (fp, thread, nb_threads, evts_per_grp))
+      return FALSE;
+
+   return TRUE;
+}
+
+// Frees process results partially loaded from an invalid cache file
+static void reset_process_hotspots (lprof_process_t *process, unsigned nb_threads)
+{
+   const unsigned rank = process->map_rank;
+   unsigned i;
+
+   // Functions and loops results are released to be allocated again by map_IP_to_function/loop
+   FOREACH_INARRAY (process->threads, thread_iter) {
+      lprof_thread_t *const thread = ARRAY_GET_DATA (NULL, thread_iter);
+      {
+         FOREACH_INHASHTABLE (thread->fcts, fct_iter) {
+            SinfoFunc *fct = GET_DATA_T (SinfoFunc *, fct_iter);
+            if (fct->hwcInfo [rank] == NULL) continue;
+            for (i=0; i < nb_threads; i++) {
+               lc_free (fct->hwcInfo [rank][i]);
+               hashtable_free (fct->callChainsInfo [rank][i], lc_free, lc_free);
+            }
+            lc_free (fct->hwcInfo [rank]);        fct->hwcInfo [rank] = NULL;
+            lc_free (fct->callChainsInfo [rank]); fct->callChainsInfo [rank] = NULL;
+            lc_free (fct->totalCallChains [rank]); fct->totalCallChains [rank] = NULL;
+         }
+      }
+      FOREACH_INHASHTABLE (thread->loops, module) {
+         hashtable_t *module_loops = GET_DATA_T (hashtable_t *, module);
+         FOREACH_INHASHTABLE (module_loops, loop_iter) {
+            SinfoLoop *loop = GET_DATA_T (SinfoLoop *, loop_iter);
+            if (loop->hwcInfo [rank] == NULL) continue;
+            for (i=0; i < nb_threads; i++)
+               lc_free (loop->hwcInfo [rank][i]);
+            lc_free (loop->hwcInfo [rank]); loop->hwcInfo [rank] = NULL;
+         }
+      }
+
+      free_thread (thread);
+      lc_free (thread);
+   }
+   array_flush (process->threads, NULL);
+   hashtable_flush (process->is_library, NULL, NULL);
+}
+
+/* Loads from the hotspots cache results of map_process_samples_to_hotspots for a process
+ * Events and threads saved in the cache must match the samples file header (TID_events_header)
+ * Returns TRUE if loaded, FALSE if no valid cache (then, nothing is loaded) */
+static boolean_t load_hotspots_cache (const char *process_path, lprof_process_t *process, const char *key,
+                                      const TID_events_header_t *TID_events_header)
+{
+   lprof_node_t *const node = process->parent_node;
+   sampling_display_context_t *context = node->parent_context;
+
+   char *const cache_name = get_hotspots_cache_name (process_path, context);
+   FILE *fp = fopen (cache_name, "rb");
+   lc_free (cache_name);
+   if (!fp) return FALSE;
+
+   // Header: check that the cache was saved from the same inputs
+   char *saved_key = read_cache_string (fp);
+   boolean_t valid = (saved_key != NULL && strcmp (saved_key, key) == 0);
+   lc_free (saved_key);
+   char *ev_list = valid ? read_cache_string (fp) : NULL;
+   uint32_t header [2]; // events per group, threads number
+   if (ev_list == NULL || fread (header, sizeof header[0], 2, fp) != 2 ||
+       header[0] != TID_events_header->HW_evts_per_grp || header[1] != TID_events_header->nb_threads ||
+       strcmp (ev_list, TID_events_header->HW_evts_list) != 0) {
+      if (ev_list != NULL)
+         WRNMSG ("Ignoring hotspots cache for process %ld: events or threads do not match samples\n", process->pid);
+      lc_free (ev_list);
+      fclose (fp);
+      return FALSE;
+   }
+   const unsigned evts_per_grp = header[0];
+   const unsigned nb_threads   = header[1];
+   set_events_list (context, ev_list, evts_per_grp);
+   lc_free (ev_list);
+
+   // Threads
+   init_sinfo_func_hwc (node->unknown_fcts, process->map_rank, nb_threads, evts_per_grp);
+   unsigned thr_rank;
+   for (thr_rank=0; valid && thr_rank < nb_threads; thr_rank++)
+      valid = load_thread (fp, process, nb_threads, evts_per_grp);
+
+   // Process libraries functions
+   uint32_t nb_lib_fcts, i;
+   if (valid && fread (&nb_lib_fcts, sizeof nb_lib_fcts, 1, fp) != 1)
+      valid = FALSE;
+   for (i=0; valid && i < nb_lib_fcts; i++) {
+      SinfoFunc *fct = read_cache_obj_ref (fp, node, PERF_FUNC);
+      if (fct == NULL) valid = FALSE;
+      else if (hashtable_lookup (process->is_library, fct) == NULL)
+         hashtable_insert (process->is_library, fct, fct);
+   }
+   fclose (fp);
+
+   if (!valid) {
+      WRNMSG ("Ignoring invalid hotspots cache for process %ld\n", process->pid);
+      reset_process_hotspots (process, nb_threads);
+      return FALSE;
+   }
+
+   DBGMSG ("Loaded hotspots for process %ld from cache\n", process->pid);
+   return TRUE;
+}
+
+/* Map (from instruction addresses) samples to executable/libraries functions/loops
+ * Results are saved to (or loaded from, if up to date) the hotspots cache of the process.
+ * Processes are mapped concurrently: only process-owned data are written (map_rank-indexed
+ * results in functions/loops, threads, is_library and addr_index) */
 static void map_process_samples_to_hotspots (const char *node_path, lprof_process_t *process)
 {
    const lprof_node_t *node = process->parent_node;
    sampling_display_context_t *context = node->parent_context;
 
-   // Load process samples from <process path>/IP_events.lprof
    char *const process_path = lc_malloc (strlen (node_path) + strlen ("999999") + 2);
    sprintf (process_path, "%s/%ld", node_path, process->pid);
+
+   // Load process samples from <process path>/IP_events.lprof
    FILE *fp = fopen_in_directory (process_path, "IP_events.lprof", "rb");
-   lc_free (process_path);
    if (!fp) {
       HLTMSG ("Cannot load events for %s\n", process_path);
       exit (-1);
@@ -1170,26 +1836,39 @@ static void map_process_samples_to_hotspots (const char *node_path, lprof_proces
    if (read_TID_events_header (fp, &TID_events_header) != 0) {
       ERRMSG ("Cannot read TID events header\n");
       fclose (fp);
+      lc_free (process_path);
       return;
    }
-   unsigned evts_per_grp = TID_events_header.HW_evts_per_grp;
-   if (!context->ev_list) {
-      context->ev_list = strdup (TID_events_header.HW_evts_list);
-      context->events_per_group = evts_per_grp;
+
+   // Reuse results from a previous display if inputs did not change
+   char *const cache_key = get_hotspots_cache_key (node_path, process_path, process);
+   if (cache_key != NULL && load_hotspots_cache (process_path, process, cache_key, &TID_events_header)) {
+      fclose (fp);
+      free_TID_events_header (&TID_events_header);
+      lc_free (cache_key);
+      lc_free (process_path);
+      return;
    }
+   unsigned evts_per_grp = TID_events_header.HW_evts_per_grp;
+   set_events_list (context, TID_events_header.HW_evts_list, evts_per_grp);
 
    // Initialize unknown functions data for this process
    init_sinfo_func_hwc (node->unknown_fcts, process->map_rank,
                         TID_events_header.nb_threads, evts_per_grp);
    raw_IP_events_t *IP_events = raw_IP_events_new (context->events_per_group);
 
+   // Flattened index resolving IPs (samples and callchains) to functions/loops
+   process->addr_index = get_process_address_index (process);
+
    /* For each thread */
+   boolean_t complete = TRUE;
    unsigned thr_rank;
-   for (thr_rank=0; thr_rank < TID_events_header.nb_threads; thr_rank++) {
+   for (thr_rank=0; complete && thr_rank < TID_events_header.nb_threads; thr_rank++) {
       // Read header (description of IP events for this thread)
       uint64_t tid; unsigned IP_events_nb;
       if (read_IP_events_header (fp, &tid, &IP_events_nb) != 0) {
          ERRMSG ("Cannot read IP events header\n");
+         complete = FALSE;
          break;
       }
 
@@ -1198,12 +1877,14 @@ static void map_process_samples_to_hotspots (const char *node_path, lprof_proces
       hashtable_insert (thread->fcts, lc_strdup ("UNKNOWN FCTS"), node->unknown_fcts);
       memset (thread->events_nb, 0, evts_per_grp * sizeof thread->events_nb[0]);
 
+      // IPs of a thread are sorted (CF sampling_engine_dump_collect_data.c): resolved in a single pass
+      uint32_t cursor = 0;
       unsigned ip_rank;
       for (ip_rank=0; ip_rank < IP_events_nb; ip_rank++) {
          if (read_IP_events (fp, IP_events, evts_per_grp) != 0) {
             ERRMSG ("Cannot read IP events\n");
-            fclose (fp);
-            return;
+            complete = FALSE;
+            break;
          }
 
          // Increment nb occurrences
@@ -1211,33 +1892,43 @@ static void map_process_samples_to_hotspots (const char *node_path, lprof_proces
          for (i=0; i<evts_per_grp; i++)
             thread->events_nb [i] += IP_events->eventsNb[i];
 
+         const address_segment_t *segment = address_index_lookup_next (process->addr_index, IP_events->ip, &cursor);
+
          if (context->display_functions)
-            map_IP_to_function (thread, IP_events, TID_events_header.nb_threads, evts_per_grp);
+            map_IP_to_function (thread, IP_events, segment->fct, TID_events_header.nb_threads, evts_per_grp);
 
          if (context->display_loops)
-            map_IP_to_loop (thread, IP_events, TID_events_header.nb_threads, evts_per_grp);
+            map_IP_to_loop (thread, IP_events, segment->loop, TID_events_header.nb_threads, evts_per_grp);
       }
    } // for each event
 
    fclose (fp);
 
+   address_index_free (process->addr_index);
+   process->addr_index = NULL;
+
+   if (complete && cache_key != NULL)
+      save_hotspots_cache (process_path, process, cache_key, TID_events_header.nb_threads, evts_per_grp);
+
+   lc_free (cache_key);
+   lc_free (process_path);
    free_TID_events_header (&TID_events_header);
    raw_IP_events_free (IP_events);
 }
 
-static void free_thread (lprof_thread_t *thread)
+// Parameters of the parallel mapping of node processes samples to hotspots
+typedef struct {
+   const char *node_path;
+   array_t *processes;
+} map_processes_tasks_t;
+
+// Task of the thread pool: maps samples of one process to hotspots
+static void map_process_task (int task_id, void *user)
 {
-   hashtable_free (thread->fcts, NULL, NULL);
-   lc_free (thread->events_nb);
-   lc_free (thread->categories);
-   lc_free (thread->libc_categories);
+   map_processes_tasks_t *tasks = user;
+   lprof_process_t *process = array_get_elt_at_pos (tasks->processes, task_id);
 
-   // Loops
-   FOREACH_INHASHTABLE (thread->loops, module) {
-      hashtable_t *module_loops = GET_DATA_T (hashtable_t *, module);
-      hashtable_free (module_loops, NULL, NULL);
-   }
-   hashtable_free (thread->loops, NULL, NULL);
+   map_process_samples_to_hotspots (tasks->node_path, process);
 }
 
 static void free_process (lprof_process_t *process)
@@ -1249,7 +1940,6 @@ static void free_process (lprof_process_t *process)
    array_free (process->threads, NULL);
 
    hashtable_free (process->is_library, NULL, NULL);
-   hashtable_free (process->ip2fct_cache, NULL, NULL);
 }
 
 static void free_node (lprof_node_t *node)
@@ -1261,8 +1951,28 @@ static void free_node (lprof_node_t *node)
    array_free (node->processes, NULL);
 
    lc_free (node->unknown_fcts);
-   lc_free (node->libs_fcts_tree);
-   lc_free (node->libs_loops_tree);
+
+   // Free system functions (CF load_system_maps)
+   unsigned i;
+   if (node->sys_fcts != NULL) {
+      for (i=0; i < node->nb_sys_fcts; i++) lc_free (node->sys_fcts[i].name);
+      lc_free (node->sys_fcts[0].hwcInfo);
+      lc_free (node->sys_fcts[0].callChainsInfo);
+      lc_free (node->sys_fcts[0].totalCallChains);
+      lc_free (node->sys_fcts);
+   }
+
+   // Free functions/loops and libraries metadata
+   free_module (&(node->exe));
+   for (i=0; i < node->nb_libs; i++) {
+      free_module (&(node->libs [i]));
+      free_lprof_index (&(node->libs_index [i]));
+      lc_free (node->libsInfo.libraries [i].startMapAddress);
+      lc_free (node->libsInfo.libraries [i].stopMapAddress);
+   }
+   lc_free (node->libs);
+   lc_free (node->libs_index);
+   lc_free (node->libsInfo.libraries);
 }
 
 /* Release memory allocated for the context.
@@ -1276,6 +1986,8 @@ void free_context (sampling_display_context_t *context)
    array_free (context->nodes, NULL);
 
    hashtable_free (context->libc_fct_to_cat, NULL, NULL);
+
+   free_lprof_index (&(context->exe_index));
 }
 
 static void add_pid (const char *host_path, const char *process_name, void *pids)
@@ -1322,11 +2034,12 @@ static void write_processes_index (const char *exp_path, const char *hostname, v
 
 static void add_lib (const char *libs_path, const char *file_name, void *data)
 {
-   lprof_libraries_info_header_t metadata_header;
-   lprof_libraries_info_t metadata;
-   load_lib_metadata (libs_path, file_name, &metadata_header, &metadata);
+   lprof_index_t index;
+   if (load_lib_metadata (libs_path, file_name, &index) != 0) return;
 
-   array_add ((array_t *) data, metadata.libraries);
+   lprof_index_t *lib_index = lc_malloc (sizeof *lib_index);
+   *lib_index = index;
+   array_add ((array_t *) data, lib_index);
 }
 
 static void add_process_ranges (const char *node_path, const char *process_id, void *data)
@@ -1375,24 +2088,29 @@ static void load_node_libs (sampling_display_context_t *context, lprof_node_t *n
    hashtable_t *node_ranges = hashtable_new (str_hash, str_equal);
    for_each_directory_in_directory (node_path, add_process_ranges, node_ranges);
    
-   node->nb_libs = array_length (libs);
-   node->libs_fcts_tree = context->display_functions ?
-      lc_malloc (node->nb_libs * sizeof node->libs_fcts_tree[0]) : NULL;
-   node->libs_loops_tree = context->display_loops ?
-      lc_malloc (node->nb_libs * sizeof node->libs_loops_tree[0]) : NULL;
+   node->nb_libs    = array_length (libs);
+   node->libs_index = lc_malloc (node->nb_libs * sizeof node->libs_index[0]);
+   node->libs       = lc_malloc (node->nb_libs * sizeof node->libs[0]);
 
-   lprof_library_t *concat_libs = lc_malloc (node->nb_libs * sizeof concat_libs[0]);
+   lprof_library_t *concat_libs = lc_malloc0 (node->nb_libs * sizeof concat_libs[0]);
 
-   // Complete libraries address ranges and trees
+   // Complete libraries address ranges and functions/loops
    unsigned lib_rank = 0;
    FOREACH_INARRAY (libs, libs_iter) {
-      lprof_library_t *lib = ARRAY_GET_DATA (lprof_library_t *, libs_iter);
-
+      lprof_index_t *lib_index = ARRAY_GET_DATA (lprof_index_t *, libs_iter);
+      lprof_index_t *index = &(node->libs_index [lib_rank]);
+      *index = *lib_index;
+      lc_free (lib_index);
+
+      lprof_library_t *lib = &(concat_libs [lib_rank]);
+      lib->name        = get_lprof_index_string (index, index->header->name);
+      lib->nbFunctions = index->header->nbFunctions;
+      lib->nbLoops     = index->header->nbLoops;
       lib->nbProcesses = array_length (node->processes);
 
-      // Set ranges
-      lib->startMapAddress = lc_realloc (lib->startMapAddress, lib->nbProcesses * sizeof lib->startMapAddress[0]);
-      lib->stopMapAddress  = lc_realloc (lib->stopMapAddress , lib->nbProcesses * sizeof lib->stopMapAddress [0]);
+      // Set ranges (null for processes not mapping this library)
+      lib->startMapAddress = lc_calloc (lib->nbProcesses, sizeof lib->startMapAddress[0]);
+      lib->stopMapAddress  = lc_calloc (lib->nbProcesses, sizeof lib->stopMapAddress [0]);
 
       unsigned process_rank = 0;
       FOREACH_INARRAY (node->processes, process_iter) {
@@ -1415,15 +2133,8 @@ static void load_node_libs (sampling_display_context_t *context, lprof_node_t *n
          process_rank++;
       }
 
-      // Set trees
-      if (context->display_functions)
-         node->libs_fcts_tree [lib_rank] = get_fcts_tree (lib->nbFunctions, lib->fctsInfo, lib->nbProcesses);
-      if (context->display_loops)
-         node->libs_loops_tree[lib_rank] = get_loops_tree (lib->nbLoops, lib->loopsInfo, lib->nbProcesses);
-
-      // Save updated library
-      concat_libs [lib_rank] = *lib;
-      lc_free (lib);
+      // Set functions/loops
+      init_module (&(node->libs [lib_rank]), index, lib_rank, lib->nbProcesses, context);
 
       lib_rank++;
    }
@@ -1447,14 +2158,7 @@ static void load_node_libs (sampling_display_context_t *context, lprof_node_t *n
 // Refactored function to prepare sampling display, deprecating processing_parallel_new
 void prepare_sampling_display (sampling_display_context_t *context) {
    // Load executable metadata (from exp_path/binary.lprof)
-   lprof_header_t lprof_header; lprof_binary_info_header_t exe_metadata_header; lprof_binary_info_t exe_metadata;
-   load_exe_metadata (context->exp_path, &lprof_header, &exe_metadata_header, &exe_metadata);
-   strcpy (context->lprof_version, lprof_header.version);
-   context->exe_name     = exe_metadata_header.binName;
-   context->nb_exe_fcts  = exe_metadata_header.nbFunctions;
-   context->nb_exe_loops = exe_metadata_header.nbLoops;
-   context->exe_fcts     = exe_metadata.functions;
-   context->exe_loops    = exe_metadata.loops;
+   load_exe_metadata (context);
 
    // For all nodes, write processes index (list of PIDs)
    for_each_directory_in_directory (context->exp_path, write_processes_index, NULL);
@@ -1492,36 +2196,18 @@ void prepare_sampling_display (sampling_display_context_t *context) {
       sprintf (node_path, "%s/%s", context->exp_path, node->name);
       const unsigned nb_processes = array_length (node->processes);
 
-      // Get ranges trees for executable
-      if (context->display_functions)
-         node->exe_fcts_tree = get_fcts_tree (context->nb_exe_fcts, exe_metadata.functions,
-                                              nb_processes);
-      if (context->display_loops)
-         node->exe_loops_tree = get_loops_tree (context->nb_exe_loops, exe_metadata.loops,
-                                                nb_processes);
+      // Get functions/loops for executable
+      init_module (&(node->exe), &(context->exe_index), -1, nb_processes, context);
 
       // Load libraries metadata for this node (from node_path/libs/*.lprof)
       load_node_libs (context, node, node_path);
 
-      // Get ranges trees for system calls (from node_path/system_map)
-      node->sys_fcts_tree = load_system_maps (node_path, nb_processes);
+      // Get system calls (from node_path/system_map)
+      load_system_maps (node_path, node, nb_processes);
 
-      // For each process, map samples to hotspots
-      FOREACH_INARRAY (node->processes, processes_iter) {
-         lprof_process_t *const process = ARRAY_GET_DATA (NULL, processes_iter);
-
-         map_process_samples_to_hotspots (node_path, process);
-      }
-
-      // Free hotspots trees
-      destroy (node->exe_fcts_tree);
-      destroy (node->exe_loops_tree);
-      destroy (node->sys_fcts_tree);
-      unsigned i;
-      for (i=0; i < node->nb_libs; i++) {
-         if (context->display_functions) destroy (node->libs_fcts_tree  [i]);
-         if (context->display_loops    ) destroy (node->libs_loops_tree [i]);
-      }
+      // Map samples to hotspots, one task per process
+      map_processes_tasks_t tasks = { node_path, node->processes };
+      threadpool_run (0, nb_processes, map_process_task, &tasks);
 
       lc_free (node_path);
    } // for each node
@@ -29,6 +29,7 @@
 #include "libmcommon.h" // array_t...
 #include "avltree.h" // SinfoFunc/Loop, avlTree_t
 #include "binary_format.h" // lprof_loop_t...
+#include "address_index.h" // address_index_t
 
 // lua_State
 #include <lua.h>
@@ -58,8 +59,7 @@ typedef struct {
    char lprof_version [MAQAO_LPROF_VERSION_SIZE];
    char *exe_name;
    uint32_t nb_exe_fcts, nb_exe_loops;
-   lprof_fct_t *exe_fcts;
-   lprof_loop_t *exe_loops;
+   lprof_index_t exe_index; // functions/loops (CF binary.lprof)
 
    // Misc.
    float base_clk;
@@ -71,6 +71,14 @@ typedef struct {
    unsigned int nbExtraCat; // number of elements in "libsExtraCat" hashtable
 } sampling_display_context_t;
 
+/* Functions/loops of an executable or library, found from addresses by a binary search in its index ranges
+ * fcts[i] (resp. loops[i]) is the function (resp. loop) part of index->fctRanges[i] (resp. loopRanges[i]) */
+typedef struct {
+   const lprof_index_t *index;
+   SinfoFunc *fcts;  // NULL if functions are not displayed or if no ranges
+   SinfoLoop *loops; // NULL if loops are not displayed or if no ranges
+} lprof_module_t;
+
 // Nodes, references processes
 typedef struct {
    char *name;
@@ -81,20 +89,20 @@ typedef struct {
 
    SinfoFunc *unknown_fcts; // virtual function
 
-   // Addresses for functions/loops in executable
-   avlTree_t *exe_fcts_tree;
-   avlTree_t *exe_loops_tree;
+   // Functions/loops in executable
+   lprof_module_t exe;
 
    // Libraries data
    uint32_t nb_libs;
    lprof_libraries_info_t libsInfo;
+   lprof_index_t *libs_index; // functions/loops (CF libs/*.lprof)
 
-   // Addresses for functions/loops in libraries
-   avlTree_t **libs_fcts_tree;
-   avlTree_t **libs_loops_tree;
+   // Functions/loops in libraries
+   lprof_module_t *libs;
 
-   // Addresses for system functions
-   avlTree_t *sys_fcts_tree;
+   // System functions, sorted by address (CF system_map)
+   uint32_t nb_sys_fcts;
+   SinfoFunc *sys_fcts;
 } lprof_node_t;
 
 // Process, references threads
@@ -108,7 +116,7 @@ typedef struct {
    hashtable_t *is_library;
    uint64_t exe_offset;
 
-   hashtable_t *ip2fct_cache; // cache to reduce calls to search_fct_from_address
+   address_index_t *addr_index; // IP to function/loop, while mapping samples
 } lprof_process_t;
 
 // Thread (leaf)
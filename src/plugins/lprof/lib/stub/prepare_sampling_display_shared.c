@@ -51,19 +51,19 @@ SinfoFunc* function_to_infoFunc (lprof_fct_t* myFct,unsigned rangeIdx, unsigned
    return myInfoFunc;
 }
 
-static char* loop_level_enum_to_char (unsigned loopLevel)
+// Returns loop level as string (constant, not to be freed)
+char* loop_level_enum_to_char (unsigned loopLevel)
 {
-   char* strLoopLevel = NULL;
    if (loopLevel == SINGLE_LOOP)
-      strLoopLevel = lc_strdup ("Single");
+      return "Single";
    if (loopLevel == INNERMOST_LOOP)
-      strLoopLevel = lc_strdup ("Innermost");
+      return "Innermost";
    if (loopLevel == OUTERMOST_LOOP)
-      strLoopLevel = lc_strdup ("Outermost");
+      return "Outermost";
    if (loopLevel == INBETWEEN_LOOP)
-      strLoopLevel = lc_strdup ("InBetween");
+      return "InBetween";
 
-   return strLoopLevel;
+   return NULL;
 }
 
 // From a lprof loop (lprof_loop_t), creates a AVLtree loop (SinfoLoop)
@@ -58,6 +58,9 @@
 // From a lprof function (lprof_fct_t), creates a AVLtree function (SinfoFunc)
 SinfoFunc* function_to_infoFunc (lprof_fct_t* myFct,unsigned rangeIdx, unsigned nbPids);
 
+// Returns loop level as string (constant, not to be freed)
+char* loop_level_enum_to_char (unsigned loopLevel);
+
 // From a lprof loop (lprof_loop_t), creates a AVLtree loop (SinfoLoop)
 SinfoLoop* lprof_loop_to_infoLoop (lprof_loop_t* myLoop,unsigned rangeIdx,unsigned nbPids);
 
@@ -42,6 +42,7 @@
 #include <sys/mman.h> // munmap
 #include <libunwind.h>
 #include "unwind.h" // PERF_STACK_USER_SIZE
+#include "unwind_offline.h" // init_raw_stacks, unwind_raw_stacks...
 // CF arch/x86/include/uapi/asm/perf_regs.h in kernel source tree
 #define PERF_REG_X86_BP 6
 #define PERF_REG_X86_SP 7
@@ -54,7 +55,8 @@
 #include "sampling_engine_shared.h"  // smpl_context_t, clean_abort
 #include "sampling_engine_inherit.h" // inherit_sampler, enable/disable_all_cpus
 #include "sampling_engine_ptrace.h"  // tracer_new, create_ptrace_sampler, enable_disable_all_threads
-#include "sampling_engine_timers.h"  // timers_sampler
+#include "sampling_engine_timers.h"  // timers_setup_event
+#include "IP_events_stream.h"        // IP_events_stream_writer_close
 
 #define MMAP_PAGES      4 // Default number of mmap pages per ring buffer (1 per thread)
 
@@ -63,7 +65,9 @@ extern void dump_collect_data (smpl_context_t *context, const char *process_path
 pid_t application_pid; // TODO: try to remove this
 const char *exp_path;  // TODO: try to remove this
 
-static int check_perf_event_paranoid ()
+/* Checks that perf_event_paranoid level allows to sample the application
+ * \param max_paranoid highest accepted level: 1 for hardware events, 2 for user-space only software events */
+static int check_perf_event_paranoid (int max_paranoid)
 {
    int paranoid = 3; // Possible values are 2,1,0 and -1
 
@@ -81,7 +85,7 @@ static int check_perf_event_paranoid ()
       return -2;
    }
 
-   if (paranoid >= 2) {
+   if (paranoid > max_paranoid) {
       ERRMSG ("[MAQAO] You don't have the permission to access the performance counters.\n"
               "[MAQAO] Consider changing the value of /proc/sys/kernel/perf_event_paranoid:\n"
               "\t\t-1 - No restrictions.\n"
@@ -390,14 +394,13 @@ static void init_sampler_data (smpl_context_t *context, const char *process_path
                                      strlen ("/smp_999_999.tmp") + 1);
       sprintf (sd->smp_file_name, "%s/smp_%u_%u.tmp",
                process_path, i+1, context->nb_sampler_threads);
-      sd->fp_smp = NULL;
+      sd->smp_writer = NULL;
 
       // smp_idx*.tmp
       sd->smp_idx_file_name = lc_malloc (strlen (process_path) +
                                          strlen ("/smp_idx_999_999.tmp") + 1);
       sprintf (sd->smp_idx_file_name, "%s/smp_idx_%u_%u.tmp",
                process_path, i+1, context->nb_sampler_threads);
-      sd->fp_smp_idx = NULL;
 
       // cpu*.tmp
       sd->cpu_file_name = lc_malloc (strlen (process_path) +
@@ -415,63 +418,36 @@ static void init_sampler_data (smpl_context_t *context, const char *process_path
 
       sd->lost_events = 0;
       sd->coll_events = 0;
+      sd->saved_samples = 0;
+      sd->save_cycles = 0;
 
 #ifdef __LIBUNWIND__
-      if (backtrace_mode == BACKTRACE_MODE_STACK)
+      if (backtrace_mode == BACKTRACE_MODE_STACK || backtrace_mode == BACKTRACE_MODE_STACK_OFFLINE)
          sd->unwind_data = hashtable_new (direct_hash, direct_equal);
+      if (backtrace_mode == BACKTRACE_MODE_STACK_OFFLINE)
+         init_raw_stacks (sd, process_path, i, context->nb_sampler_threads);
 #endif
    }
 }
 
-// Sets context and allocates hashtables/arrays for a HW counters based engine
-static void init_context_hwc (smpl_context_t *context, unsigned sampling_period,
-                              const char* hwc_list, const char *default_hwc_list,
+// Sets context fields related to perf-events: sampler data, mmap size, sample types and attributes
+static void init_context_fds (smpl_context_t *context, perf_event_desc_t *fds,
+                              unsigned nb_fds, const uint64_t *hwc_period,
                               const int backtrace_mode, const char *process_path,
                               size_t max_buf_MB)
 {
-
-   // TODO: remove as soon as dependency with maqao_get_os_event_encoding broken
-   int arch; context->uarch = get_uarch (&arch);
-
-   const char *hwcList = (default_hwc_list != NULL) ? default_hwc_list : lc_strdup (hwc_list);
-
-   size_t nb_events = get_nb_events (hwcList);
-   context->events_per_group = nb_events;
-   uint64_t hwc_period [nb_events];
-   int64_t  raw_code   [nb_events];
-
-   if (hwcList != default_hwc_list) {
-      // Custom
-      set_context_evlist_custom (context, hwcList, hwc_period, raw_code, context->output_path);
-   } else {
-      // Default
-      context->eventsList = (char *) hwcList;
-      unsigned i;
-      for (i=0; i<nb_events; i++) {
-         hwc_period [i] = sampling_period;
-         raw_code [i] = -1;
-      }
-   }
-
-   // Checks for eventsList correctness + counts number of events
-   perf_event_desc_t *fds = NULL; int _nb_fds = 0;
-   if (perf_setup_list_events (context->eventsList, &fds, &_nb_fds, raw_code) == -1) {
-      ERRMSG ("Cannot setup events\n");
-      clean_abort (context->child_pid, context->output_path);
-   }
-   if (nb_events != (unsigned) _nb_fds) {
-      ERRMSG ("Number of events differs from lprof front-end\n");
-      clean_abort (context->child_pid, context->output_path);
-   }
-
    // Sets most context fields
    const size_t page_size = sysconf(_SC_PAGESIZE);
-   const unsigned nb_fds = (unsigned) _nb_fds;
    context->events_per_group = nb_fds;
+   const boolean_t stack_mode = (backtrace_mode == BACKTRACE_MODE_STACK ||
+                                 backtrace_mode == BACKTRACE_MODE_STACK_OFFLINE) ? TRUE : FALSE;
+#ifdef __LIBUNWIND__
+   context->offline_unwinding = (backtrace_mode == BACKTRACE_MODE_STACK_OFFLINE) ? TRUE : FALSE;
+#endif
    init_sampler_data (context, process_path, max_buf_MB, backtrace_mode);
 
 #ifdef __LIBUNWIND__
-   if (backtrace_mode == BACKTRACE_MODE_STACK)
+   if (stack_mode == TRUE)
       context->mmap_size = (64 + 1) * page_size;
    else
       context->mmap_size = (MMAP_PAGES + 1) * page_size;
@@ -497,7 +473,7 @@ static void init_context_hwc (smpl_context_t *context, unsigned sampling_period,
       // TODO: remove as soon as legacy code removed
       if (i == 0 && context->sampling_engine == SAMPLING_ENGINE_INHERIT)
          hw->sample_type = context->sampleTypesList[0] & ~PERF_SAMPLE_CPU;
-      else if (i == 0 && backtrace_mode == BACKTRACE_MODE_STACK) {
+      else if (i == 0 && stack_mode == TRUE) {
 #ifdef __LIBUNWIND__
          hw->sample_type = context->sampleTypesList[0] | PERF_SAMPLE_REGS_USER;
          hw->sample_regs_user  = 1UL << PERF_REG_X86_BP | 1UL << PERF_REG_X86_SP;
@@ -538,6 +514,90 @@ static void init_context_hwc (smpl_context_t *context, unsigned sampling_period,
    }
 }
 
+// Sets context and allocates hashtables/arrays for a HW counters based engine
+static void init_context_hwc (smpl_context_t *context, unsigned sampling_period,
+                              const char* hwc_list, const char *default_hwc_list,
+                              const int backtrace_mode, const char *process_path,
+                              size_t max_buf_MB)
+{
+
+   // TODO: remove as soon as dependency with maqao_get_os_event_encoding broken
+   int arch; context->uarch = get_uarch (&arch);
+
+   const char *hwcList = (default_hwc_list != NULL) ? default_hwc_list : lc_strdup (hwc_list);
+
+   size_t nb_events = get_nb_events (hwcList);
+   context->events_per_group = nb_events;
+   uint64_t hwc_period [nb_events];
+   int64_t  raw_code   [nb_events];
+
+   if (hwcList != default_hwc_list) {
+      // Custom
+      set_context_evlist_custom (context, hwcList, hwc_period, raw_code, context->output_path);
+   } else {
+      // Default
+      context->eventsList = (char *) hwcList;
+      unsigned i;
+      for (i=0; i<nb_events; i++) {
+         hwc_period [i] = sampling_period;
+         raw_code [i] = -1;
+      }
+   }
+
+   // Checks for eventsList correctness + counts number of events
+   perf_event_desc_t *fds = NULL; int _nb_fds = 0;
+   if (perf_setup_list_events (context->eventsList, &fds, &_nb_fds, raw_code) == -1) {
+      ERRMSG ("Cannot setup events\n");
+      clean_abort (context->child_pid, context->output_path);
+   }
+   if (nb_events != (unsigned) _nb_fds) {
+      ERRMSG ("Number of events differs from lprof front-end\n");
+      clean_abort (context->child_pid, context->output_path);
+   }
+
+   init_context_fds (context, fds, (unsigned) _nb_fds, hwc_period,
+                     backtrace_mode, process_path, max_buf_MB);
+}
+
+// Sets context and allocates hashtables/arrays for the OS timers based engine
+static void init_context_timers (smpl_context_t *context, unsigned sampling_period,
+                                 const int backtrace_mode, const char *process_path,
+                                 size_t max_buf_MB)
+{
+   int arch; context->uarch = get_uarch (&arch);
+
+   perf_event_desc_t *fds = timers_setup_event (sampling_period);
+   if (fds == NULL) {
+      ERRMSG ("Cannot setup OS clock event\n");
+      clean_abort (context->child_pid, context->output_path);
+   }
+   context->eventsList = lc_strdup (TIMERS_EVENT_NAME);
+
+   uint64_t period = fds[0].hw.sample_period;
+   init_context_fds (context, fds, 1, &period, backtrace_mode, process_path, max_buf_MB);
+}
+
+// Print average cost of saving a sample (in timestamp counter ticks), for all sampler threads
+static void print_save_sample_cost (smpl_context_t *context, const char *hostname)
+{
+   unsigned i;
+
+   uint64_t saved_samples = 0;
+   uint64_t save_cycles = 0;
+
+   // Sum contributions from sampler threads
+   for (i=0; i < context->nb_sampler_threads; i++) {
+      saved_samples += context->sampler_data[i].saved_samples;
+      save_cycles   += context->sampler_data[i].save_cycles;
+   }
+
+   if (saved_samples == 0) return;
+
+   printf ("[MAQAO] %"PRIu64" samples saved, average %"PRIu64" cycles per sample (host %s, process %d)\n",
+           saved_samples, save_cycles / saved_samples, hostname, context->child_pid);
+   fflush (stdout);
+}
+
 // Print lost events for each event rank
 // Since IP is de facto not available, related contribution is not accounted
 static void print_lost_events (smpl_context_t *context, const int backtrace_mode,
@@ -568,7 +628,8 @@ static void print_lost_events (smpl_context_t *context, const int backtrace_mode
          sampling_period <= TIMER_MEDIUM_SAMPLING_PERIOD :
          sampling_period <= MEDIUM_SAMPLING_PERIOD;
 
-      if (backtrace_mode == BACKTRACE_MODE_STACK) { // heavy backtrace
+      if (backtrace_mode == BACKTRACE_MODE_STACK ||
+          backtrace_mode == BACKTRACE_MODE_STACK_OFFLINE) { // heavy backtrace
          INFOMSG ("Rerun without --backtrace-mode=stack or with another backtrace-mode%s.\n",
                   high_rate ? " and/or with lower sampling rate (e.g with --sampling-rate=low)" : "");
       } else if (backtrace_mode != BACKTRACE_MODE_OFF) { // light backtrace
@@ -581,6 +642,29 @@ static void print_lost_events (smpl_context_t *context, const int backtrace_mode
    }
 }
 
+#ifdef __LIBUNWIND__
+// Frees unwinding data (address spaces and maps) of a sampler thread
+static void free_unwind_data (sampler_data_t *sd)
+{
+   FOREACH_INHASHTABLE (sd->unwind_data, ud_iter) {
+      unwind_data_t *ud = GET_DATA_T (unwind_data_t *, ud_iter);
+      if (ud->addr_space != NULL) unw_destroy_addr_space (ud->addr_space);
+      if (ud->context.maps != NULL) {
+         FOREACH_INARRAY (ud->context.maps, map_iter) {
+            map_t *map = ARRAY_GET_DATA (map_t *, map_iter);
+            lc_free (map->name);
+            if (map->data) munmap (map->data, map->length);
+            if (map->fd >= 0) close (map->fd);
+            lc_free (map->di);
+         }
+         array_free (ud->context.maps, lc_free);
+      }
+      lc_free (ud);
+   }
+   hashtable_free (sd->unwind_data, NULL, NULL);
+}
+#endif
+
 // Close files and free related buffers that are not used by dump_collect_data()
 static void free_sampler_data_before_dump (const smpl_context_t *context, const int backtrace_mode)
 {
@@ -590,32 +674,27 @@ static void free_sampler_data_before_dump (const smpl_context_t *context, const
 
       if (sd->cur == sd->file) {
          dump_to_files (context, sd);
-         fclose (sd->fp_smp);     sd->fp_smp     = NULL;
-         fclose (sd->fp_smp_idx); sd->fp_smp_idx = NULL;
+         if (IP_events_stream_writer_close (sd->smp_writer) != 0)
+            ERRMSG ("Write error in %s\n", sd->smp_file_name);
+         sd->smp_writer = NULL;
          fclose (sd->fp_cpu);     sd->fp_cpu     = NULL;
          fclose (sd->fp_cpu_idx); sd->fp_cpu_idx = NULL;
          sampler_data_buf_free (sd->file);
       }
 
 #ifdef __LIBUNWIND__
-      if (backtrace_mode == BACKTRACE_MODE_STACK) {
-         FOREACH_INHASHTABLE (sd->unwind_data, ud_iter) {
-            unwind_data_t *ud = GET_DATA_T (unwind_data_t *, ud_iter);
-            unw_destroy_addr_space (ud->addr_space);
-            FOREACH_INARRAY (ud->context.maps, map_iter) {
-               map_t *map = ARRAY_GET_DATA (map_t *, map_iter);
-               lc_free (map->name);
-               if (map->data) munmap (map->data, map->length);
-               if (map->fd >= 0) close (map->fd);
-               lc_free (map->di);
-            }
-            array_free (ud->context.maps, lc_free);
-            lc_free (ud);
-         }
-         hashtable_free (sd->unwind_data, NULL, NULL);
-      }
+      if (backtrace_mode == BACKTRACE_MODE_STACK)
+         free_unwind_data (sd);
+
+      // Offline unwinding: maps are used by unwind_raw_stacks(), freed after dump
+      else if (backtrace_mode == BACKTRACE_MODE_STACK_OFFLINE)
+         close_raw_stacks_file (sd);
 #endif
    }
+#ifdef __LIBUNWIND__
+   if (backtrace_mode == BACKTRACE_MODE_STACK)
+      free_eh_frame_headers ();
+#endif
 }
 
 // Remove temporary files and free memory that were processed by dump_collect_data()
@@ -631,7 +710,17 @@ static void free_sampler_data_after_dump (const smpl_context_t *context)
       remove (sd->smp_idx_file_name); lc_free (sd->smp_idx_file_name);
       remove (sd->cpu_file_name);     lc_free (sd->cpu_file_name);
       remove (sd->cpu_idx_file_name); lc_free (sd->cpu_idx_file_name);
+#ifdef __LIBUNWIND__
+      if (context->offline_unwinding == TRUE) {
+         free_unwind_data (sd);
+         free_raw_stacks (sd);
+      }
+#endif
    }
+#ifdef __LIBUNWIND__
+   if (context->offline_unwinding == TRUE)
+      free_eh_frame_headers ();
+#endif
    lc_free (context->sampler_data);
 }
 
@@ -930,13 +1019,17 @@ returnInfo_t sample (const char *cmd, const char* output_path,
    retInfo.pid = 0;
    if (gethostname (retInfo.hostname, sizeof (retInfo.hostname)) != 0) return retInfo;
 
-   if (sampling_engine != SAMPLING_ENGINE_TIMERS && check_perf_event_paranoid() != 0)
+   // OS timers: user-space CPU clock event, allowed up to perf_event_paranoid=2
+   const boolean_t use_timers = (sampling_engine == SAMPLING_ENGINE_TIMERS);
+   if (check_perf_event_paranoid (use_timers ? 2 : 1) != 0)
       return retInfo;
 
+   // OS clock samples are collected by the inherit engine, without stopping the application
+   if (use_timers) sampling_engine = SAMPLING_ENGINE_INHERIT;
+
    // Check for default events list availability (host processor may not be supported)
    char *default_hwc_list = NULL;
-   if (sampling_engine != SAMPLING_ENGINE_TIMERS &&
-       (hwc_list == NULL || strlen (hwc_list) == 0)) {
+   if (!use_timers && (hwc_list == NULL || strlen (hwc_list) == 0)) {
       int arch; int uarch = get_uarch (&arch);
       default_hwc_list = getHwcList (arch, uarch, LPROF_VERBOSITY_OFF, NULL);
       if (default_hwc_list == NULL) return retInfo;
@@ -972,14 +1065,6 @@ returnInfo_t sample (const char *cmd, const char* output_path,
             clean_abort (getppid(), output_path);
          }
          break;
-      case SAMPLING_ENGINE_TIMERS:
-         // TODO: see man prctl + try to simplify/improve this
-         // TODO: related: behavior of while (waitpid) loop in timers_sampler()
-         prctl (PR_SET_DUMPABLE, (long)1); // can work without SET_PTRACER ?
-#ifdef PR_SET_PTRACER
-         prctl (PR_SET_PTRACER, (long)getppid()); // Since Linux 3.4
-#endif
-         break;
       }
       if (user_guided >= 0) signal (SIGTSTP, SIG_IGN);
       run_application (sampling_engine == SAMPLING_ENGINE_INHERIT ? wait_pipe : NULL, cmd, output_path, retInfo.hostname);
@@ -1075,17 +1160,12 @@ returnInfo_t sample (const char *cmd, const char* output_path,
                               .max_files_size = max_files_MB * 1024 * 1024,
                               .files_buf_size = files_buf_MB * 1024 * 1024 };
 
-   if (sampling_engine != SAMPLING_ENGINE_TIMERS)
+   if (use_timers)
+      init_context_timers (&context, sampling_period, backtrace_mode,
+                           process_path, max_buf_MB);
+   else
       init_context_hwc (&context, sampling_period, hwc_list, default_hwc_list,
                         backtrace_mode, process_path, max_buf_MB);
-   else {
-      int arch; context.uarch = get_uarch (&arch);
-      context.events_per_group = 1;
-      context.eventsList = lc_strdup (hwc_list);
-      init_sampler_data (&context, process_path, max_buf_MB, backtrace_mode);
-      context.sampleTypesList = lc_calloc (1, sizeof context.sampleTypesList[0]);
-      set_sample_type (0, backtrace_mode, 1, context.sampleTypesList);
-   }
 
    // Block SIGTSTP (terminal STOP: CTRL+Z) in user guided mode to enable sigwait
    sigset_t sigset;
@@ -1137,8 +1217,6 @@ returnInfo_t sample (const char *cmd, const char* output_path,
       inherit_sampler (&context, nprocs, wait_pipe, cpu_array); break;
    case SAMPLING_ENGINE_PTRACE:
       tracer_new (&context, nprocs, sync, finalize_signal); break;
-   case SAMPLING_ENGINE_TIMERS:
-      timers_sampler (&context, sampling_period, finalize_signal); break;
    }
    // END OF HIGH EFFORTS ZONE
 
@@ -1149,7 +1227,9 @@ returnInfo_t sample (const char *cmd, const char* output_path,
       fflush (stdout);
    }
 
-   print_lost_events (&context, backtrace_mode, sampling_engine, sampling_period);
+   print_lost_events (&context, backtrace_mode,
+                      use_timers ? SAMPLING_ENGINE_TIMERS : sampling_engine, sampling_period);
+   if (verbose == TRUE) print_save_sample_cost (&context, retInfo.hostname);
 
    // Properly ends current work...
    pthread_cancel (threadMaps); // cancel: no wait
@@ -1171,6 +1251,10 @@ returnInfo_t sample (const char *cmd, const char* output_path,
       // Dumps to samples.lprof and cpu_ids.info data accumulated in memory and temporary files
       printf ("[MAQAO] PROCESSING SAMPLES (host %s, process %d)\n", retInfo.hostname, child_pid);
       fflush (stdout);
+#ifdef __LIBUNWIND__
+      if (context.offline_unwinding == TRUE)
+         unwind_raw_stacks (&context);
+#endif
       dump_collect_data (&context, process_path, stop - start);
       printf ("[MAQAO] FINISHED PROCESSING SAMPLES (host %s, process %d)\n", retInfo.hostname, child_pid);
       fflush (stdout);
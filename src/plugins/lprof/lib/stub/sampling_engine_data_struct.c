@@ -19,6 +19,7 @@
  */
 
 #include <stdlib.h>
+#include <string.h> // memset
 #include <libmcommon.h> // lc_malloc
 #include "sampling_engine_data_struct.h"
 
@@ -159,9 +160,41 @@ void lprof_queue_add (lprof_queue_t *queue, const void *data)
  *                             lprof_hashtable_t: simple hashtable                                *
  **************************************************************************************************/
 /* This hashtable uses buf_add instead of lc_malloc to add elements.
- * It is a feature-limited adaptation of generic hashtable_t */
+ * Nodes are stored in a single array (open addressing with linear probing), doubled when more
+ * than 3/4 of its slots are used. Since buf_t cannot free memory, the previous array is lost:
+ * the total size of successive arrays stays below twice the size of the last one.
+ * Data pointers are never NULL: a NULL data marks an empty slot. */
 
-// Creates an empty simple hashtable, using given allocator
+#define LPROF_HASHTABLE_MIN_SIZE 8
+
+// Allocates and clears an array of nodes in a buffer
+static lprof_hashnode_t *lprof_hashtable_nodes_new (buf_t *buf, lprof_hashtable_size_t size)
+{
+   const size_t nodes_size = size * sizeof (lprof_hashnode_t);
+   lprof_hashnode_t *nodes = buf_add (buf, nodes_size);
+   if (!nodes) return NULL;
+
+   memset (nodes, 0, nodes_size);
+
+   return nodes;
+}
+
+// Returns the number of slots of a new simple hashtable: size rounded up to a power of 2
+static lprof_hashtable_size_t lprof_hashtable_pow2_size (lprof_hashtable_size_t size)
+{
+   lprof_hashtable_size_t pow2 = LPROF_HASHTABLE_MIN_SIZE;
+   while (pow2 < size) pow2 <<= 1;
+
+   return pow2;
+}
+
+// Returns the size (in bytes) allocated from the buffer by lprof_hashtable_new for a given size
+size_t lprof_hashtable_new_size (lprof_hashtable_size_t size)
+{
+   return sizeof (lprof_hashtable_t) + lprof_hashtable_pow2_size (size) * sizeof (lprof_hashnode_t);
+}
+
+// Creates an empty simple hashtable, using given allocator. Size is rounded up to a power of 2
 lprof_hashtable_t *lprof_hashtable_new (buf_t *buf, lprof_hashtable_size_t size)
 {
    lprof_hashtable_t *t = buf_add (buf, sizeof *t);
@@ -170,23 +203,24 @@ lprof_hashtable_t *lprof_hashtable_new (buf_t *buf, lprof_hashtable_size_t size)
       return NULL;
    }
 
+   const lprof_hashtable_size_t pow2 = lprof_hashtable_pow2_size (size);
+
    t->buf = buf;
-   t->size = size;
-   t->nodes = buf_add (buf, size * sizeof t->nodes[0]);
+   t->size = pow2;
+   t->nodes = lprof_hashtable_nodes_new (buf, pow2);
    t->nnodes = 0;
+   if (!t->nodes) {
+      DBGMSG ("Cannot create lprof_hashtable nodes: allocation failed from buffer %p\n", buf);
+      return NULL;
+   }
 
    return t;
 }
 
-static int lprof_hashtable_equal (uint64_t v1, uint64_t v2)
-{
-   return (v1 == v2);
-}
-
 static lprof_hashtable_size_t lprof_hashtable_hash (uint64_t key, lprof_hashtable_size_t size)
 {
-   // Performance critical: see hashtable_hash
-   return ((lprof_hashtable_size_t) key) % size;
+   // Performance critical: multiplicative hashing, spreading consecutive addresses over slots
+   return ((lprof_hashtable_size_t) ((key * 0x9E3779B97F4A7C15ULL) >> 32)) & (size - 1);
 }
 
 // Returns first element with a given key
@@ -194,11 +228,26 @@ void *lprof_hashtable_lookup (const lprof_hashtable_t *t, uint64_t key)
 {
    if (t == NULL) return NULL;
 
-   const lprof_hashtable_size_t slot = lprof_hashtable_hash (key, t->size);
-   lprof_hashnode_t *n;
-   for (n = t->nodes[slot]; n != NULL; n = n->next) {
-      if (lprof_hashtable_equal (key, n->key))
-         return n->data;
+   const lprof_hashtable_size_t mask = t->size - 1;
+   lprof_hashtable_size_t slot;
+   for (slot = lprof_hashtable_hash (key, t->size); t->nodes[slot].data != NULL; slot = (slot + 1) & mask) {
+      if (t->nodes[slot].key == key)
+         return t->nodes[slot].data;
+   }
+   return NULL;
+}
+
+// Returns first element with a given key for which match (data, user) is true
+void *lprof_hashtable_lookup_match (const lprof_hashtable_t *t, uint64_t key,
+                                    int (*match) (const void *data, const void *user), const void *user)
+{
+   if (t == NULL) return NULL;
+
+   const lprof_hashtable_size_t mask = t->size - 1;
+   lprof_hashtable_size_t slot;
+   for (slot = lprof_hashtable_hash (key, t->size); t->nodes[slot].data != NULL; slot = (slot + 1) & mask) {
+      if (t->nodes[slot].key == key && match (t->nodes[slot].data, user))
+         return t->nodes[slot].data;
    }
    return NULL;
 }
@@ -209,36 +258,73 @@ array_t *lprof_hashtable_lookup_all (const lprof_hashtable_t *t, uint64_t key)
    if (t == NULL) return NULL;
 
    array_t *a = NULL;
-   const lprof_hashtable_size_t slot = lprof_hashtable_hash (key, t->size);
-   lprof_hashnode_t *n;
-   for (n = t->nodes[slot]; n != NULL; n = n->next) {
-      if (lprof_hashtable_equal (key, n->key)) {
+   const lprof_hashtable_size_t mask = t->size - 1;
+   lprof_hashtable_size_t slot;
+   for (slot = lprof_hashtable_hash (key, t->size); t->nodes[slot].data != NULL; slot = (slot + 1) & mask) {
+      if (t->nodes[slot].key == key) {
          if (a == NULL) a = array_new();
-         array_add (a, n->data);
+         array_add (a, t->nodes[slot].data);
       }
    }
    return a;
 }
 
+// Stores a node in the first empty slot following the slot of its key
+static void lprof_hashtable_put (lprof_hashnode_t *nodes, lprof_hashtable_size_t size,
+                                 uint64_t key, const void *data)
+{
+   const lprof_hashtable_size_t mask = size - 1;
+   lprof_hashtable_size_t slot = lprof_hashtable_hash (key, size);
+   while (nodes[slot].data != NULL) slot = (slot + 1) & mask;
+
+   nodes[slot].key = key;
+   nodes[slot].data = (void *) data;
+}
+
+// Doubles the number of slots of a simple hashtable
+static int lprof_hashtable_grow (lprof_hashtable_t *t)
+{
+   const lprof_hashtable_size_t new_size = t->size * 2;
+   lprof_hashnode_t *nodes = lprof_hashtable_nodes_new (t->buf, new_size);
+   if (!nodes) {
+      DBGMSG ("Cannot grow lprof_hashtable: allocation failed from buffer %p\n", t->buf);
+      return -1;
+   }
+
+   lprof_hashtable_size_t i;
+   for (i = 0; i < t->size; i++)
+      if (t->nodes[i].data != NULL)
+         lprof_hashtable_put (nodes, new_size, t->nodes[i].key, t->nodes[i].data);
+
+   t->nodes = nodes;
+   t->size = new_size;
+   return 0;
+}
+
+// Returns the size (in bytes) allocated from the buffer by the next insertion in a simple hashtable
+size_t lprof_hashtable_grow_size (const lprof_hashtable_t *t)
+{
+   if (t == NULL || (uint64_t) (t->nnodes + 1) * 4 <= (uint64_t) t->size * 3) return 0;
+
+   return 2 * t->size * sizeof (lprof_hashnode_t);
+}
+
 // Inserts new element in a simple hashtable, pointing to 'data' and associated to 'key'
 void lprof_hashtable_insert (lprof_hashtable_t *t, uint64_t key, const void *data)
 {
-   if (t == NULL) return;
+   if (t == NULL || data == NULL) return;
 
    if (t->nnodes == LPROF_HASHTABLE_MAX_NNODES) {
       HLTMSG ("Cannot insert in already full hashtable (max nodes nb: %"PRIu32")\n", LPROF_HASHTABLE_MAX_NNODES);
    }
 
-   const lprof_hashtable_size_t slot = lprof_hashtable_hash (key, t->size);
-   lprof_hashnode_t **node = &(t->nodes [slot]);
-   lprof_hashnode_t *new = buf_add (t->buf, sizeof *new);
-   if (!new) {
-      DBGMSG ("Cannot create lprof_hashnode: allocation failed from buffer %p\n", t->buf);
+   // Keeps load factor below 3/4. If the array cannot grow, fills it up to its last free slot
+   if ((uint64_t) (t->nnodes + 1) * 4 > (uint64_t) t->size * 3 && lprof_hashtable_grow (t) != 0
+       && t->nnodes + 1 >= t->size) {
+      DBGMSG ("Cannot insert in lprof_hashtable %p: no free slot\n", t);
       return;
    }
-   new->next = *node;
-   new->data = (void *) data;
-   new->key = key;
-   *node = new;
+
+   lprof_hashtable_put (t->nodes, t->size, key, data);
    t->nnodes++;
 }
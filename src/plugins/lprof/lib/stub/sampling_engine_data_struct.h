@@ -93,36 +93,53 @@ typedef uint32_t lprof_hashtable_nnodes_t;
 #define LPROF_HASHTABLE_MAX_NNODES UINT32_MAX
 typedef uint32_t lprof_hashtable_size_t;
 
-// Internally used by lprof_hashtable_t
+// Internally used by lprof_hashtable_t (slot of the nodes array, empty if data is NULL)
 typedef struct lprof_hashnode_s {
    uint64_t key;
    void *data;
-   struct lprof_hashnode_s *next;
 } lprof_hashnode_t;
 
 typedef struct {
    buf_t *buf;
    lprof_hashtable_nnodes_t nnodes; /**<Total number of nodes*/
-   lprof_hashtable_size_t size; /**<Number of slots, size of the 'nodes' array*/
-   lprof_hashnode_t** nodes; /**<Array containing the queues of nodes, indexed by they key's hash*/
+   lprof_hashtable_size_t size; /**<Number of slots, size of the 'nodes' array (power of 2)*/
+   lprof_hashnode_t* nodes; /**<Array of nodes, probed linearly from the slot given by they key's hash*/
 } lprof_hashtable_t;
 
-// Creates an empty simple hashtable, using given allocator
+// Creates an empty simple hashtable, using given allocator. It grows when needed
 lprof_hashtable_t *lprof_hashtable_new (buf_t *buf, lprof_hashtable_size_t size);
 
 // Returns first element with a given key
 void *lprof_hashtable_lookup (const lprof_hashtable_t *t, uint64_t key);
 
+// Returns first element with a given key for which match (element, user) returns non zero
+void *lprof_hashtable_lookup_match (const lprof_hashtable_t *t, uint64_t key,
+                                    int (*match) (const void *data, const void *user), const void *user);
+
 // Returns array of all elements with a given key
 array_t *lprof_hashtable_lookup_all (const lprof_hashtable_t *t, uint64_t key);
 
-// Inserts new element in a simple hashtable, pointing to 'data' and associated to 'key'
+// Returns the size (in bytes) allocated from the buffer by lprof_hashtable_new for a given size
+size_t lprof_hashtable_new_size (lprof_hashtable_size_t size);
+
+// Returns the size (in bytes) allocated from the buffer by the next insertion in a simple hashtable
+size_t lprof_hashtable_grow_size (const lprof_hashtable_t *t);
+
+// Inserts new element in a simple hashtable, pointing to 'data' (not NULL) and associated to 'key'
 void lprof_hashtable_insert (lprof_hashtable_t *t, uint64_t key, const void *data);
 
+// Returns the first used slot of a simple hashtable from slot i (size if none)
+static inline lprof_hashtable_size_t lprof_hashtable_next_slot (const lprof_hashtable_t *t, lprof_hashtable_size_t i)
+{
+   while (i < t->size && t->nodes[i].data == NULL) i++;
+   return i;
+}
+
 // Iterates elements (key-value pairs) of a simple hashtable
-#define FOREACH_IN_LPROF_HASHTABLE(X,Y)                 \
-   lprof_hashnode_t *Y; lprof_hashtable_size_t __i;     \
-   for (__i = 0; __i < X->size; __i++)                  \
-      for (Y = X->nodes[__i]; Y != NULL; Y = Y->next)
+#define FOREACH_IN_LPROF_HASHTABLE(X,Y)                                          \
+   lprof_hashnode_t *Y; lprof_hashtable_size_t __i;                              \
+   for (__i = lprof_hashtable_next_slot (X, 0);                                  \
+        __i < (X)->size && ((Y) = &((X)->nodes[__i])) != NULL;                   \
+        __i = lprof_hashtable_next_slot (X, __i + 1))
 
 #endif // __SAMPLING_ENGINE_DATA_STRUCT_H__
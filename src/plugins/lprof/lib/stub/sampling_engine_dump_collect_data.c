@@ -21,40 +21,37 @@
 /* Defines the dump_collect_data function() to dump smaples to IP_events.lprof and cpu_ids.info */
 
 #include "sampling_engine_shared.h"
-#include "IP_events_format.h"
+#include "IP_events_stream.h"
 #include "utils.h"
+#ifdef __LIBUNWIND__
+#include "unwind_offline.h" // IS_RAW_STACK_ID, get_unwound_raw_stack
+#endif
 
-#define INIT_MERGE_BUF_SZ   (10 * 1024 * 1024) // 10 MB
-#define MAX_MERGE_BUF_SZ  (1024 * 1024 * 1024) // 1 GB
-
-// Write data contained in tid2ipt to IP_events.lprof
-static void write_to_IP_events_dot_lprof (const smpl_context_t *context, FILE *fp,
-                                          hashtable_t *tid2ipt, IP_events_t *(*get_IP_events)
-                                          (const smpl_context_t *context, void *ip_data,
-                                           buf_t **buf, raw_IP_events_t *raw_IP_events))
+// Writes IP_events.lprof header (HW events names, list and sample types)
+static int write_header (const smpl_context_t *context, FILE *fp, unsigned nb_threads)
 {
-   // Write header data
    char *HW_event_name [context->events_per_group];
    unsigned i;
-   if (context->sampling_engine != SAMPLING_ENGINE_TIMERS)
-      for (i=0; i<context->events_per_group; i++)
-         HW_event_name [i] = context->fds [i].name;
-   else
-      HW_event_name [0] = "OS_CLK";
-   TID_events_header_t TID_events_header = { .nb_threads      = hashtable_size (tid2ipt),
+   for (i=0; i<context->events_per_group; i++)
+      HW_event_name [i] = context->fds [i].name;
+   TID_events_header_t TID_events_header = { .nb_threads      = nb_threads,
                                              .HW_evts_per_grp = context->events_per_group,
                                              .HW_evts_name    = HW_event_name,
                                              .HW_evts_list    = context->eventsList,
                                              .sampleTypesList = context->sampleTypesList };
-   if (write_TID_events_header (fp, &TID_events_header) != 0) {
+   return write_TID_events_header (fp, &TID_events_header);
+}
+
+// Write data contained in tid2ipt to IP_events.lprof
+static void write_to_IP_events_dot_lprof (const smpl_context_t *context, FILE *fp,
+                                          hashtable_t *tid2ipt)
+{
+   // Write header data
+   if (write_header (context, fp, hashtable_size (tid2ipt)) != 0) {
       ERRMSG ("Cannot write TID events header\n");
       return;
    }
 
-   // Allocate data/buffers reused for all TIDs/IPs
-   raw_IP_events_t *raw_IP_events = raw_IP_events_new (context->events_per_group);
-   buf_t *merge_buf = NULL;
-
    // For each thread/TID
    FOREACH_INHASHTABLE (tid2ipt, tid_iter) {
       const uint64_t tid = (uint64_t) GET_KEY (uint64_t, tid_iter);
@@ -68,27 +65,14 @@ static void write_to_IP_events_dot_lprof (const smpl_context_t *context, FILE *f
       // For each address/IP
       FOREACH_INHASHTABLE (ip2smp, ip_iter) {
          uint64_t ip = (uint64_t) GET_KEY (uint64_t, ip_iter);
-         void *ip_data = GET_DATA_T (void *, ip_iter);
-
-         // Get data (sample) related to current TID, IP and event
-         IP_events_t *IP_events;
-         if (get_IP_events != NULL)
-            IP_events = get_IP_events (context, ip_data, &merge_buf, raw_IP_events);
-         else
-            IP_events = ip_data;
+         IP_events_t *IP_events = GET_DATA_T (IP_events_t *, ip_iter);
 
          if (write_IP_events (fp, ip, IP_events, context->events_per_group) != 0) {
             ERRMSG ("Cannot write IP events\n");
-            raw_IP_events_free (raw_IP_events);
-            buf_free (merge_buf);
             return;
          }
       } // for each IP
    } // for each thread/TID
-
-   // Deallocate reused data/buffers
-   raw_IP_events_free (raw_IP_events);
-   buf_free (merge_buf);
 }
 
 // Write to cpu_ids.info the line corresponding to the thread 'tid'
@@ -120,37 +104,6 @@ typedef struct {
    unsigned pos; // in fp
 } file_pos_t;
 
-typedef struct {
-   array_t *events; // array of IP_events_t (from memory)
-   array_t *file_idx; // array of file_pos_t (each pointing to an IP_events_t object)
-} index_ip_data_t;
-
-/* Lookups by TID the (IP to IP_events) hashtable in index_tid2ipt
- * Creates empty one if needed */
-static hashtable_t *get_insert_ip2smp (hashtable_t *index_tid2ipt, uint64_t tid)
-{
-   hashtable_t *ip2smp = hashtable_lookup (index_tid2ipt, (void *) tid);
-   if (ip2smp == NULL) {
-      ip2smp = hashtable_new (direct_hash, direct_equal);
-      hashtable_insert (index_tid2ipt, (void *) tid, ip2smp);
-   }
-
-   return ip2smp;
-}
-
-/* Lookups by IP the related data in index_ip2smp
- * Creates empty one if needed */
-static index_ip_data_t *get_insert_ip_data (hashtable_t *index_ip2smp, uint64_t ip)
-{
-   index_ip_data_t * ip_data = hashtable_lookup (index_ip2smp, (void *) ip);
-   if (ip_data == NULL) {
-      ip_data = lc_malloc0 (sizeof *ip_data);
-      hashtable_insert (index_ip2smp, (void *) ip, ip_data);
-   }
-
-   return ip_data;
-}
-
 /* Gathers CPU IDs from all temporary files, by thread/TID
  * Returns as TID-indexed hashtable */
 static hashtable_t *index_cpu_files (const smpl_context_t *context)
@@ -185,14 +138,14 @@ static hashtable_t *index_cpu_files (const smpl_context_t *context)
    return index_tid2cpu;
 }
 
-// Writes cpu_id.info from data aggregated in tid2cpu and using tid2ipt to iterate over threads
+// Writes cpu_id.info from data aggregated in tid2cpu and using tids (keys) to iterate over threads
 static void write_merged_cpus (const smpl_context_t *context, FILE *glob_fp_cpu,
-                               hashtable_t *tid2ipt, hashtable_t *tid2cpu)
+                               hashtable_t *tids, hashtable_t *tid2cpu)
 {
    hits_nb_t merged_cpus [context->online_cpus]; // reused for each thread/TID
 
    // For each thread/TID
-   FOREACH_INHASHTABLE (tid2ipt, tid_iter) {
+   FOREACH_INHASHTABLE (tids, tid_iter) {
       uint64_t tid = (uint64_t) GET_KEY (uint64_t, tid_iter);
       cpu_id_t cpu;
 
@@ -246,191 +199,218 @@ static void write_merged_cpus (const smpl_context_t *context, FILE *glob_fp_cpu,
    } // for each thread
 }
 
-static hashtable_t *index_samples (const smpl_context_t *context)
+// Source of IP events sorted by TID then IP: a memory buffer or a chunk in temporary files
+typedef struct {
+   // Memory buffer: IP events references
+   IP_events_ref_t *refs;
+   size_t nb_refs;
+   size_t next_ref;
+
+   // Temporary files: cursor on a chunk and last record read
+   IP_events_cursor_t *cursor;
+   raw_IP_events_t *raw_IP_events;
+
+   // Current record
+   uint64_t tid;
+   uint64_t ip;
+   IP_events_t *IP_events; // memory buffer only
+} merge_source_t;
+
+/* Moves a source to its next record
+ * Returns FALSE if no more records (or read error) */
+static boolean_t merge_source_next (const smpl_context_t *context, merge_source_t *source)
 {
-   hashtable_t *tid2ipt = hashtable_new (direct_hash, direct_equal);
-
-   unsigned i;
-   // For each sampler thread
-   for (i=0; i<context->nb_sampler_threads; i++) {
-      sampler_data_t *const sd = &(context->sampler_data[i]);
-      // For each TID, add data from memory
-      FOREACH_IN_LPROF_HASHTABLE (sd->mem->tid2ipt, tid_iter) {
-         uint64_t tid = GET_KEY (uint64_t, tid_iter);
-         hashtable_t *ip2smp = get_insert_ip2smp (tid2ipt, tid);
-
-         // For each IP/address, add data from memory
-         lprof_hashtable_t *mem_ip2smp = GET_DATA_T (lprof_hashtable_t *, tid_iter);
-         FOREACH_IN_LPROF_HASHTABLE (mem_ip2smp, ip_iter) {
-            uint64_t ip = GET_KEY (uint64_t, ip_iter);
-            IP_events_t *events = GET_DATA_T (IP_events_t *, ip_iter);
-
-            index_ip_data_t *ip_data = get_insert_ip_data (ip2smp, ip);
-            if (ip_data->events == NULL) ip_data->events = array_new();
-            array_add (ip_data->events, events);
-         }
-      }
-
-      // Add data from file
-      FILE *fp_idx = fopen (sd->smp_idx_file_name, "rb");
-      if (!fp_idx) continue;
-      FILE *fp = fopen (sd->smp_file_name, "rb");
-      if (!fp) { fclose (fp_idx); continue; }
-
-      uint64_t tid; boolean_t read_error = FALSE;
-      while (fread (&tid, sizeof tid, 1, fp_idx) == 1) {
-         hashtable_t *ip2smp = get_insert_ip2smp (tid2ipt, tid);
+   if (source->cursor != NULL) {
+      int ret = IP_events_cursor_next (source->cursor, &(source->tid), source->raw_IP_events,
+                                       context->events_per_group);
+      if (ret < 0) ERRMSG ("Read error in temporary samples file\n");
+      if (ret != 1) return FALSE;
+      source->ip = source->raw_IP_events->ip;
+      return TRUE;
+   }
 
-         uint64_t ip;
-         if (fread (&ip, sizeof ip, 1, fp_idx) != 1) {
-            read_error = TRUE; break;
-         }
-         unsigned pos;
-         if (fread (&pos, sizeof pos, 1, fp_idx) != 1) {
-            read_error = TRUE; break;
-         }
+   if (source->next_ref == source->nb_refs) return FALSE;
+   const IP_events_ref_t *ref = &(source->refs [source->next_ref++]);
+   source->tid = ref->tid;
+   source->ip  = ref->ip;
+   source->IP_events = ref->IP_events;
+   return TRUE;
+}
 
-         file_pos_t *file_pos = lc_malloc (sizeof *file_pos);
-         file_pos->fp = fp;
-         file_pos->pos = pos;
+// Adds a callchain to merged IP events, replacing saved stacks (offline unwinding) with unwound callchains
+static void merge_callchain (const smpl_context_t *context, const IP_callchain_t *callchain,
+                             raw_IP_events_t *merged)
+{
+#ifdef __LIBUNWIND__
+   if (callchain->nb_IPs == 1 && IS_RAW_STACK_ID (callchain->IPs[0])) {
+      const IP_callchain_t *unwound = get_unwound_raw_stack (context, callchain->IPs[0]);
+      if (unwound != NULL && unwound->nb_IPs > 0)
+         raw_IP_events_add_callchain (merged, callchain->nb_hits, unwound->nb_IPs, unwound->IPs);
+      return;
+   }
+#else
+   (void) context;
+#endif
+   raw_IP_events_add_callchain (merged, callchain->nb_hits, callchain->nb_IPs, callchain->IPs);
+}
 
-         index_ip_data_t *ip_data = get_insert_ip_data (ip2smp, ip);
-         if (ip_data->file_idx == NULL) ip_data->file_idx = array_new();
-         array_add (ip_data->file_idx, file_pos);
+// Accumulates current record of a source to merged IP events
+static void merge_source_add (const smpl_context_t *context, const merge_source_t *source,
+                              raw_IP_events_t *merged)
+{
+   unsigned i;
+   if (source->cursor != NULL) {
+      const raw_IP_events_t *raw = source->raw_IP_events;
+      for (i=0; i<context->events_per_group; i++)
+         merged->eventsNb[i] += raw->eventsNb[i];
+      size_t j;
+      for (j=0; j<raw->nb_callchains; j++) {
+         const IP_callchain_t *callchain = &(raw->callchains[j]);
+         merge_callchain (context, callchain, merged);
       }
+      return;
+   }
 
-      if (read_error == TRUE) ERRMSG ("Read error in %s\n", sd->smp_idx_file_name);
-
-      fclose (fp_idx);
+   for (i=0; i<context->events_per_group; i++)
+      merged->eventsNb[i] += source->IP_events->eventsNb[i];
+   FOREACH_IN_LPROF_QUEUE (source->IP_events->callchains, cc_iter) {
+      const IP_callchain_t *callchain = GET_DATA_T (IP_callchain_t *, cc_iter);
+      merge_callchain (context, callchain, merged);
    }
+}
 
-   return tid2ipt;
+static inline boolean_t merge_source_lower (const merge_source_t *a, const merge_source_t *b)
+{
+   return (a->tid < b->tid || (a->tid == b->tid && a->ip < b->ip)) ? TRUE : FALSE;
 }
 
-static IP_events_t *_get_merged_IP_events (unsigned events_per_group, index_ip_data_t *ip_data,
-                                           buf_t *buf, raw_IP_events_t *IP_events)
+// Restores min-heap order (by TID then IP) from heap[i] downwards
+static void heap_sift_down (merge_source_t **heap, size_t nb, size_t i)
 {
-   // Create empty IP_events structure
-   IP_events_t *merged_IP_events = buf_add (buf, sizeof *merged_IP_events);
-   size_t eventsNb_size = events_per_group * sizeof merged_IP_events->eventsNb[0];
-   merged_IP_events->eventsNb   = buf_add (buf, eventsNb_size);
-   memset (merged_IP_events->eventsNb, 0, eventsNb_size);
-   merged_IP_events->callchains = lprof_queue_new (buf);
-
-   // Copy from memory
-   if (ip_data->events != NULL) {
-      FOREACH_INARRAY (ip_data->events, ev_iter) {
-         IP_events_t *mem_IP_events = ARRAY_GET_DATA (IP_events_t *, ev_iter);
-         // Copy from memory: eventsNb
-         unsigned ev_rank;
-         for (ev_rank=0; ev_rank<events_per_group; ev_rank++)
-            merged_IP_events->eventsNb[ev_rank] += mem_IP_events->eventsNb[ev_rank];
-
-         // Copy from memory: callchains
-         FOREACH_IN_LPROF_QUEUE (mem_IP_events->callchains, cc_iter) {
-            IP_callchain_t *callchain = GET_DATA_T(IP_callchain_t *, cc_iter);
-            IP_callchain_t *found = lookup_IP_callchain (merged_IP_events->callchains,
-                                                         callchain->nb_IPs, callchain->IPs);
-            if (found == NULL) {
-               lprof_queue_add (merged_IP_events->callchains, callchain);
-            } else
-               found->nb_hits += callchain->nb_hits;
-         }
-      }
+   while (TRUE) {
+      size_t min = i;
+      const size_t left = 2 * i + 1, right = left + 1;
+      if (left  < nb && merge_source_lower (heap[left] , heap[min])) min = left;
+      if (right < nb && merge_source_lower (heap[right], heap[min])) min = right;
+      if (min == i) return;
+      merge_source_t *tmp = heap[i]; heap[i] = heap[min]; heap[min] = tmp;
+      i = min;
    }
+}
 
-   if (ip_data->file_idx == NULL) return merged_IP_events;
+// Overwrites an unsigned value previously written at position pos in fp
+static int patch_unsigned (FILE *fp, long pos, unsigned value)
+{
+   long cur = ftell (fp);
+   if (fseek (fp, pos, SEEK_SET) != 0) return -1;
+   if (fwrite (&value, sizeof value, 1, fp) != 1) return -1;
+   return fseek (fp, cur, SEEK_SET);
+}
 
-   // Merge from files
-   unsigned nb_skip = 0;
-   FOREACH_INARRAY (ip_data->file_idx, file_iter) {
-      file_pos_t *file_pos = ARRAY_GET_DATA (file_pos_t *, file_iter);
-      if ((fseek (file_pos->fp, file_pos->pos, SEEK_SET) != 0) ||
-          (read_IP_events (file_pos->fp, IP_events, events_per_group) != 0)) {
-         nb_skip++;
-         continue;
-      }
+/* Writes IP_events.lprof from all memory buffers and all temporary files chunks
+ * All sources are sorted by TID then IP: they are merged in a single pass,
+ * reading temporary files in streaming. Saves TIDs (keys) to tids */
+static void write_merged_IP_events (const smpl_context_t *context, FILE *fp, hashtable_t *tids)
+{
+   const unsigned nb_smpl = context->nb_sampler_threads;
+   IP_events_stream_t *streams [nb_smpl];
+   size_t nb_sources = 0;
+   unsigned i, j;
 
-      // eventsNb
-      unsigned i;
-      for (i=0; i<events_per_group; i++)
-         merged_IP_events->eventsNb[i] += IP_events->eventsNb[i];
-
-      // callchains
-      // callchains: read number of callchains
-      size_t nb_callchains = IP_events->nb_callchains;
-
-      // callchains: for each callchain
-      for (i=0; i<nb_callchains; i++) {
-         IP_callchain_t *callchain = &(IP_events->callchains[i]);
-         IP_callchain_t *found = lookup_IP_callchain (merged_IP_events->callchains,
-                                                      callchain->nb_IPs, callchain->IPs);
-         if (found == NULL) {       
-            // If too big for current buffer, give up
-            size_t cc_size = callchain->nb_IPs * sizeof callchain->IPs[0];
-            if ((sizeof *callchain + cc_size) > buf_avail (buf)) return NULL;
-
-            IP_callchain_t *new_callchain = buf_add (buf, sizeof *new_callchain);
-            new_callchain->nb_IPs = callchain->nb_IPs;
-            new_callchain->IPs    = buf_add (buf, cc_size);
-            memcpy (new_callchain->IPs, callchain->IPs, cc_size);
-            new_callchain->nb_hits = callchain->nb_hits;
-
-            lprof_queue_add (merged_IP_events->callchains, new_callchain);
-         } else
-            found->nb_hits += callchain->nb_hits;
-      }
+   // Count sources: one per memory buffer and one per chunk
+   for (i=0; i<nb_smpl; i++) {
+      sampler_data_t *const sd = &(context->sampler_data[i]);
+      streams[i] = IP_events_stream_open (sd->smp_file_name, sd->smp_idx_file_name);
+      nb_sources++;
+      if (streams[i] != NULL) nb_sources += IP_events_stream_get_nb_chunks (streams[i]);
    }
 
-   if (nb_skip > 0) WRNMSG ("Ignored %u IP events records\n", nb_skip);
+   merge_source_t *sources = lc_malloc0 (nb_sources * sizeof sources[0]);
+   merge_source_t **heap = lc_malloc (nb_sources * sizeof heap[0]);
+   size_t nb_heap = 0, k = 0;
+   for (i=0; i<nb_smpl; i++) {
+      sampler_data_t *const sd = &(context->sampler_data[i]);
+      sources[k].refs = IP_events_sort (sd->mem->tid2ipt, &(sources[k].nb_refs));
+      if (merge_source_next (context, &sources[k])) heap [nb_heap++] = &sources[k];
+      k++;
+
+      if (streams[i] == NULL) continue;
+      for (j=0; j<IP_events_stream_get_nb_chunks (streams[i]); j++) {
+         sources[k].cursor = IP_events_cursor_new (streams[i], j);
+         sources[k].raw_IP_events = raw_IP_events_new (context->events_per_group);
+         if (merge_source_next (context, &sources[k])) heap [nb_heap++] = &sources[k];
+         k++;
+      }
+   }
+   size_t h;
+   for (h = nb_heap / 2; h > 0; h--) heap_sift_down (heap, nb_heap, h - 1);
 
-   return merged_IP_events;
-}
+   // Header: number of threads known only at the end
+   const long header_pos = ftell (fp);
+   if (write_header (context, fp, 0) != 0) {
+      ERRMSG ("Cannot write TID events header\n");
+      nb_heap = 0;
+   }
 
-// Returns a merged IP_events data, from all memory buffers and all tmp files
-static IP_events_t *get_merged_IP_events (const smpl_context_t *context, void *ip_data,
-                                          buf_t **merge_buf, raw_IP_events_t *raw_IP_events)
-{
-#ifndef NDEBUG
-   static uint64_t cycles = 0;
-   static unsigned nb_visits = 1;
-   uint64_t start; rdtscll (start);
-#endif
+   raw_IP_events_t *merged = raw_IP_events_new (context->events_per_group);
+   unsigned nb_threads = 0, nb_IPs = 0;
+   long IP_header_pos = -1;
+   uint64_t cur_tid = 0;
+
+   while (nb_heap > 0) {
+      const uint64_t tid = heap[0]->tid;
+      const uint64_t ip  = heap[0]->ip;
+
+      // Merge all records for (tid, ip)
+      memset (merged->eventsNb, 0, context->events_per_group * sizeof merged->eventsNb[0]);
+      merged->nb_callchains = 0;
+      merged->ip = ip;
+      while (nb_heap > 0 && heap[0]->tid == tid && heap[0]->ip == ip) {
+         merge_source_add (context, heap[0], merged);
+         if (merge_source_next (context, heap[0]) == FALSE)
+            heap[0] = heap[--nb_heap];
+         heap_sift_down (heap, nb_heap, 0);
+      }
 
-   IP_events_t *merged_IP_events = NULL; // return value
-
-   // Get merge buffer (create or flush existing)
-   if (*merge_buf == NULL) // first invocation
-      *merge_buf = buf_new (INIT_MERGE_BUF_SZ);
-   else // buffer already created
-      buf_flush (*merge_buf);
-
-   // If 10 MB buffer not big enough, retry with doubled size until success
-   while (merged_IP_events == NULL) {
-      merged_IP_events = _get_merged_IP_events (context->events_per_group,
-                                                ip_data, *merge_buf, raw_IP_events);
-      if (merged_IP_events == NULL) {
-         size_t buf_size = buf_length (*merge_buf);
-         if (buf_size > MAX_MERGE_BUF_SZ) {
-            ERRMSG ("Refusing to double merge buffer size after %.1f MB: probable bug\n",
-                    MAX_MERGE_BUF_SZ / (float) (1024 * 1024));
+      // New thread: complete previous IP events header and start a new one
+      if (IP_header_pos == -1 || tid != cur_tid) {
+         if (IP_header_pos != -1 &&
+             patch_unsigned (fp, IP_header_pos + sizeof (uint64_t), nb_IPs) != 0) break;
+         IP_header_pos = ftell (fp);
+         if (write_IP_events_header (fp, tid, 0) != 0) {
+            ERRMSG ("Cannot write IP events header\n");
             break;
          }
-         buf_free (*merge_buf);
-         *merge_buf = buf_new (buf_size * 2);
+         hashtable_insert (tids, (void *) tid, (void *) tid);
+         cur_tid = tid;
+         nb_threads++;
+         nb_IPs = 0;
       }
-   }
 
-#ifndef NDEBUG
-   uint64_t stop; rdtscll (stop);
-   DBG (cycles += stop - start;
-        if (nb_visits % (10 * 1000) == 0)
-           fprintf (stderr, "%uK get_merged_IP_events visits: %lu RDTSC cycles (%.2f seconds @1 GHz)\n",
-                    nb_visits / 1000, cycles, (float) cycles / (1000 * 1000 * 1000));
-        nb_visits++);
-#endif
+      if (write_raw_IP_events (fp, merged, context->events_per_group) != 0) {
+         ERRMSG ("Cannot write IP events\n");
+         break;
+      }
+      nb_IPs++;
+   }
 
-   return merged_IP_events;
+   if ((IP_header_pos != -1 &&
+        patch_unsigned (fp, IP_header_pos + sizeof (uint64_t), nb_IPs) != 0) ||
+       patch_unsigned (fp, header_pos, nb_threads) != 0)
+      ERRMSG ("Cannot write IP events headers\n");
+
+   // Free sources
+   raw_IP_events_free (merged);
+   for (k=0; k<nb_sources; k++) {
+      lc_free (sources[k].refs);
+      if (sources[k].cursor != NULL) {
+         IP_events_cursor_free (sources[k].cursor);
+         raw_IP_events_free (sources[k].raw_IP_events);
+      }
+   }
+   for (i=0; i<nb_smpl; i++) IP_events_stream_close (streams[i]);
+   lc_free (heap);
+   lc_free (sources);
 }
 
 void dump_collect_data (smpl_context_t *context, const char *process_path, int64_t walltime)
@@ -441,7 +421,9 @@ void dump_collect_data (smpl_context_t *context, const char *process_path, int64
    FILE *glob_fp_cpu = fopen_in_directory (process_path, "cpu_id.info"  , "w");
    if (!glob_fp_smp || !glob_fp_cpu) return;
 
-   if (context->nb_sampler_threads == 1 && context->sampler_data[0].file == NULL) {
+   // Saved stacks (offline unwinding) are replaced with unwound callchains only while merging
+   if (context->nb_sampler_threads == 1 && context->sampler_data[0].file == NULL &&
+       context->offline_unwinding == FALSE) {
       // No merge needed, can directly write files
       sampler_data_buf_t *mem = context->sampler_data[0].mem;
 
@@ -460,7 +442,7 @@ void dump_collect_data (smpl_context_t *context, const char *process_path, int64
             hashtable_insert (tid2ipt, (void *) tid, ip2smp);
          }
       }
-      write_to_IP_events_dot_lprof (context, glob_fp_smp, tid2ipt, NULL);
+      write_to_IP_events_dot_lprof (context, glob_fp_smp, tid2ipt);
       {
          FOREACH_INHASHTABLE (tid2ipt, tid_iter) {
             hashtable_t *ip2smp = GET_DATA_T (hashtable_t *, tid_iter);
@@ -482,42 +464,30 @@ void dump_collect_data (smpl_context_t *context, const char *process_path, int64
    else {
       // Merge needed
       // Dump samples to <process_path>/IP_events.lprof
-      DBGMSG0 ("index_samples\n");
-      hashtable_t *tid2ipt = index_samples (context);
-      DBGMSG0 ("write_to_IP_events_dot_lprof\n");
+      hashtable_t *tids = hashtable_new (direct_hash, direct_equal);
 #ifndef NDEBUG
       uint64_t start; rdtscll (start);
 #endif
-      write_to_IP_events_dot_lprof (context, glob_fp_smp, tid2ipt, get_merged_IP_events);
+      write_merged_IP_events (context, glob_fp_smp, tids);
 #ifndef NDEBUG
       uint64_t stop; rdtscll (stop);
-      DBGMSG ("write_to_IP_events_dot_lprof: %lu RDTSC cycles (%.2f seconds @1 GHz)\n",
+      DBGMSG ("write_merged_IP_events: %lu RDTSC cycles (%.2f seconds @1 GHz)\n",
               stop - start, (float) (stop - start) / (1000 * 1000 * 1000));
 #endif
 
       hashtable_t *tid2cpu = index_cpu_files (context);
-      write_merged_cpus (context, glob_fp_cpu, tid2ipt, tid2cpu);
+      write_merged_cpus (context, glob_fp_cpu, tids, tid2cpu);
 
-      // Close temporary files opened (but not closed) by index_samples and index_cpu_files
+      // Close temporary files opened (but not closed) by index_cpu_files
       unsigned i;
       for (i=0; i<context->nb_sampler_threads; i++) {
          sampler_data_t *const sd = &(context->sampler_data[i]);
-         if (sd->fp_smp != NULL) fclose (sd->fp_smp);
          if (sd->fp_cpu != NULL) fclose (sd->fp_cpu);
       }
 
       // Free memory used for merge tables
       hashtable_free (tid2cpu, lc_free, NULL);
-      FOREACH_INHASHTABLE (tid2ipt, tid_iter) {
-         hashtable_t *ip2smp = GET_DATA_T (hashtable_t *, tid_iter);
-         FOREACH_INHASHTABLE (ip2smp, ip_iter) {
-            index_ip_data_t *ip_data = GET_DATA_T (index_ip_data_t *, ip_iter);
-            array_free (ip_data->events, NULL);
-            array_free (ip_data->file_idx, lc_free); /* file_pos */
-         }
-         hashtable_free (ip2smp, lc_free, NULL); /* ip_data: get_insert_ip_data */
-      }
-      hashtable_free (tid2ipt, NULL, NULL);
+      hashtable_free (tids, NULL, NULL);
    } // merge needed
 
    fclose (glob_fp_smp);
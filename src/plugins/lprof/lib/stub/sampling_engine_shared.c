@@ -26,20 +26,21 @@
 #include <sys/mman.h>  // mmap/unmap
 #include <sys/types.h> // kill
 #include <signal.h>    // kill
-#ifndef NDEBUG
 #include "utils.h" // rdtscll
-#endif
 #ifdef __LIBUNWIND__
 #include <libunwind.h> // unw_init_remote...
 #include "unwind.h" // unwind_context_t
+#include "unwind_offline.h" // save_raw_stack
 #endif
-#include "IP_events_format.h" // write_IP_events
+#include "IP_events_stream.h" // IP_events_stream_write_chunk
 #include "sampling_engine_shared.h" // smpl_context_t, enable/disable_events_group, process_overflow...
 #include "sampling_engine_data_struct.h" // buf_t, lprof_queue_t...
 
-#define CC_MAX_LEN   100 // Maximum callchain length for lprof
-#define TID2X_SIZE  4096
-#define IP2SMP_SIZE 12251 // Big prime number far away from 2 consecutive powers of 2 (8K and 16K)
+// Initial sizes of hashtables (all of them grow with data)
+#define TID2X_SIZE     64
+#define IP2SMP_SIZE  1024
+#define CALLCHAINS_SIZE 1024
+#define ID2CC_SIZE      8
 
 sampler_data_buf_t *sampler_data_buf_new (size_t buf_size)
 {
@@ -48,6 +49,8 @@ sampler_data_buf_t *sampler_data_buf_new (size_t buf_size)
    new->buf = buf_new (buf_size);
    new->tid2ipt = lprof_hashtable_new (new->buf, TID2X_SIZE);
    new->tid2cpu = lprof_hashtable_new (new->buf, TID2X_SIZE);
+   new->callchains = lprof_hashtable_new (new->buf, CALLCHAINS_SIZE);
+   new->last_callchain_id = 0;
 
    return new;
 }
@@ -59,6 +62,8 @@ void sampler_data_buf_reset (sampler_data_buf_t *sampler_data_buf)
    buf_flush (buf);
    sampler_data_buf->tid2ipt = lprof_hashtable_new (buf, TID2X_SIZE);
    sampler_data_buf->tid2cpu = lprof_hashtable_new (buf, TID2X_SIZE);
+   sampler_data_buf->callchains = lprof_hashtable_new (buf, CALLCHAINS_SIZE);
+   sampler_data_buf->last_callchain_id = 0;
 }
 
 void sampler_data_buf_free (sampler_data_buf_t *sampler_data_buf)
@@ -244,8 +249,10 @@ static void swap_to_files (const smpl_context_t *context, sampler_data_t *sample
    sampler_data->cur = sampler_data->file;
 
    // Open temporary files related to the files buffer
-   sampler_data->fp_smp     = fopen (sampler_data->smp_file_name    , "wb");
-   sampler_data->fp_smp_idx = fopen (sampler_data->smp_idx_file_name, "wb");
+   sampler_data->smp_writer = IP_events_stream_writer_new (sampler_data->smp_file_name,
+                                                           sampler_data->smp_idx_file_name);
+   if (sampler_data->smp_writer == NULL)
+      ERRMSG ("Cannot create %s\n", sampler_data->smp_file_name);
    sampler_data->fp_cpu     = fopen (sampler_data->cpu_file_name    , "wb");
    sampler_data->fp_cpu_idx = fopen (sampler_data->cpu_idx_file_name, "wb");
 }
@@ -263,40 +270,15 @@ static boolean_t needs_dump_to_files (sampler_data_t *sampler_data, size_t size)
    return (size > buf_avail (buf)) ? TRUE : FALSE;
 }
 
-/* Flushes content of files buffer to related samples files (sampler_data->fp_smp*)
- * For each sampler_data->fp_smp record, write related offsets to sampler_data->fp_smp_idx */
+/* Flushes content of files buffer to related samples files (sampler_data->smp_writer)
+ * Content is encoded as a new chunk, written to disk by the writer thread */
 static void dump_to_smp_file (const smpl_context_t *context, sampler_data_t *sampler_data)
 {
-   FILE *fp_smp = sampler_data->fp_smp;
-   FILE *fp_smp_idx = sampler_data->fp_smp_idx;
-
-   // For each thread/TID
-   FOREACH_IN_LPROF_HASHTABLE (sampler_data->file->tid2ipt, tid2ipt_iter) {
-      const uint64_t tid = GET_KEY (uint64_t, tid2ipt_iter);
-      lprof_hashtable_t *const ip2smp = GET_DATA (tid2ipt_iter);
-
-      // For each address/IP
-      FOREACH_IN_LPROF_HASHTABLE (ip2smp, ip2smp_iter) {
-         const uint64_t ip = GET_KEY (uint64_t, ip2smp_iter);
-         IP_events_t *const IP_events = GET_DATA (ip2smp_iter);
-
-         // Write indexing data to index file: TID, IP and file offset
-         boolean_t write_error = FALSE;
-         unsigned pos = ftell (fp_smp);
-         if (fwrite (&tid, sizeof tid, 1, fp_smp_idx) != 1) write_error = TRUE;
-         if (fwrite (&ip , sizeof ip , 1, fp_smp_idx) != 1) write_error = TRUE;
-         if (fwrite (&pos, sizeof pos, 1, fp_smp_idx) != 1) write_error = TRUE;
-         if (write_error == TRUE) {
-            ERRMSG ("Write error in %s\n", sampler_data->smp_idx_file_name);
-            return;
-         }
+   if (sampler_data->smp_writer == NULL) return;
 
-         if (write_IP_events (fp_smp, ip, IP_events, context->events_per_group) != 0) {
-            ERRMSG ("Cannot write IP events\n");
-            return;
-         }
-      }
-   }
+   if (IP_events_stream_write_chunk (sampler_data->smp_writer, sampler_data->file->tid2ipt,
+                                     context->events_per_group) != 0)
+      ERRMSG ("Write error in %s\n", sampler_data->smp_file_name);
 }
 
 /* Flushes content of files buffer to related CPUs files (sampler_data->fp_cpu*)
@@ -350,7 +332,8 @@ static void dump_to_files_and_reset (smpl_context_t *context, sampler_data_t *sa
    unsigned i; size_t tot_files_size = 0;
    for (i=0; i<context->nb_sampler_threads; i++) {
       sampler_data_t *const sd = &(context->sampler_data[i]);
-      tot_files_size += ftell (sd->fp_smp) + ftell (sd->fp_smp_idx);
+      if (sd->smp_writer != NULL)
+         tot_files_size += IP_events_stream_writer_get_size (sd->smp_writer);
       tot_files_size += ftell (sd->fp_cpu) + ftell (sd->fp_cpu_idx);
    }
 
@@ -364,42 +347,54 @@ static void dump_to_files_and_reset (smpl_context_t *context, sampler_data_t *sa
 }
 
 // PERFORMANCE AND RESULTS CRITICAL: HIGH EFFORT NEEDED FOR DESIGN/IMPLEMENTATION
-static int read_sample_callchain (perf_event_desc_t *group_leader, size_t *sz,
-                                  sampleInfo_t *sampleInfo)
+/* Reads the callchain of a sample. IPs are not copied: sampleInfo points to them in the record,
+ * valid until the end of the current ring buffer batch (CF process_overflow) */
+static int read_sample_callchain (perf_record_cursor_t *record, sampleInfo_t *sampleInfo)
 {
    uint64_t nr; // number of records
-   if (perf_read_buffer_64 (group_leader, &nr) == -1) {
+   if (perf_record_read_64 (record, &nr) == -1) {
       DBGMSG0 ("Cannot read callchain length\n");
       return -1;
    }
-   *sz -= sizeof (nr);
 
    if (nr < 3) {
       DBGMSGLVL (1, "Too small callchain (nr=%"PRIu64")\n", nr);
-      const size_t size_to_skip = nr * sizeof (uint64_t);
-      perf_skip_buffer (group_leader, size_to_skip); *sz -= size_to_skip;
+      perf_record_skip (record, nr * sizeof (uint64_t));
       return 0;
    }
 
    // 1st entry is on kernel (probably related to perf-events) and 2nd is target IP => skip them
-   const size_t size_to_skip = 2 * sizeof (uint64_t);
-   perf_skip_buffer (group_leader, size_to_skip); *sz -= size_to_skip;
+   perf_record_skip (record, 2 * sizeof (uint64_t));
    nr -= 2;
 
    sampleInfo->nbAddresses = (nr <= (CC_MAX_LEN) ? nr : CC_MAX_LEN);
 
    const size_t cc_size = sampleInfo->nbAddresses * sizeof sampleInfo->callChainAddress[0];
-   if (perf_read_buffer (group_leader, sampleInfo->callChainAddress, cc_size) == -1) {
+   const uint64_t *IPs = perf_record_get (record, cc_size);
+   if (IPs == NULL) {
       DBGMSG0 ("Cannot read callchain\n");
+      sampleInfo->nbAddresses = 0;
       return -1;
    }
-   *sz -= cc_size; nr -= sampleInfo->nbAddresses;
+   sampleInfo->callChainAddress = (uint64_t *) IPs;
+   nr -= sampleInfo->nbAddresses;
 
    // Skip unused records
-   if (nr > 0) {
-      const size_t size_to_skip = nr * sizeof (uint64_t);
-      perf_skip_buffer (group_leader, size_to_skip); *sz -= size_to_skip;
+   if (nr > 0)
+      perf_record_skip (record, nr * sizeof (uint64_t));
+
+   return 0;
+}
+
+// Skips the branch stack of a sample (not used yet)
+static int skip_sample_branch_stack (perf_record_cursor_t *record)
+{
+   uint64_t nr; // number of branches
+   if (perf_record_read_64 (record, &nr) == -1) {
+      DBGMSG0 ("Cannot read branch stack length\n");
+      return -1;
    }
+   perf_record_skip (record, nr * sizeof (struct perf_branch_entry));
 
    return 0;
 }
@@ -453,75 +448,69 @@ static array_t *load_maps (pid_t pid, pid_t tid)
    return maps;
 }
 
-static size_t read_sample_regs_user (perf_event_desc_t *group_leader, size_t *sz,
-                                     unwind_context_t *unwind_context)
+static size_t read_sample_regs_user (perf_record_cursor_t *record, unwind_context_t *unwind_context)
 {
    // Read ABI
    uint64_t abi;
-   if (perf_read_buffer_64 (group_leader, &abi) == -1) {
+   if (perf_record_read_64 (record, &abi) == -1) {
       DBGMSG0 ("Cannot read user regs ABI\n");
       return -1;
    }
-   *sz -= sizeof (abi); 
    if (abi == 0) return -2;
 
    // Read frame-pointer register
-   if (perf_read_buffer_64 (group_leader, &(unwind_context->bp)) == -1) {
+   if (perf_record_read_64 (record, &(unwind_context->bp)) == -1) {
       DBGMSG0 ("Cannot read frame-pointer register\n");
       return -1;
    }
    DBGMSG ("read_sample_regs_user: BP=%"PRIx64"\n", unwind_context->bp);
-   *sz -= sizeof (unwind_context->bp);
 
    // Read stack-pointer register
-   if (perf_read_buffer_64 (group_leader, &(unwind_context->sp)) == -1) {
+   if (perf_record_read_64 (record, &(unwind_context->sp)) == -1) {
       DBGMSG0 ("Cannot read stack-pointer register\n");
       return -1;
    }
    DBGMSG ("read_sample_regs_user: SP=%"PRIx64"\n", unwind_context->sp);
-   *sz -= sizeof (unwind_context->sp);
 
    return 0;
 }
 
-static int read_sample_stack_user (perf_event_desc_t *group_leader,
-                                   size_t *sz, sampleInfo_t *sampleInfo,
+static int read_sample_stack_user (const smpl_context_t *context, sampler_data_t *sampler_data,
+                                   perf_record_cursor_t *record, pid_t tid, sampleInfo_t *sampleInfo,
                                    unwind_data_t *unwind_data)
 {
    uint64_t size; // stack size
-   if (perf_read_buffer_64 (group_leader, &size) == -1) {
+   if (perf_record_read_64 (record, &size) == -1) {
       DBGMSG0 ("Cannot read user stack size\n");
       return -1;
    }
-   *sz -= sizeof (size);
 
-   if (perf_read_buffer (group_leader, unwind_data->context.stack, size) != 0) {
+   if (size > sizeof unwind_data->context.stack ||
+       perf_record_read (record, unwind_data->context.stack, size) != 0) {
       DBGMSG0 ("Cannot read user stack data\n");
       return -1;
    }
-   *sz -= size;
 
    uint64_t dyn_size; // size effectively written
-   if (perf_read_buffer_64 (group_leader, &dyn_size) == -1) {
+   if (perf_record_read_64 (record, &dyn_size) == -1) {
       DBGMSG0 ("Cannot read user stack effective size\n");
       return -1;
    }
-   *sz -= sizeof (dyn_size);
 
-   // Read callchain in stack (unwind)
-   uint64_t *ips = sampleInfo->callChainAddress;
-   size_t nr = 0;
-   unw_cursor_t cursor;
-   int ret = unw_init_remote (&cursor, unwind_data->addr_space, &(unwind_data->context));
-   if (ret < 0) {
-      DBGMSG ("Cannot unw_init_remote: returned %d\n", ret);
+   // Offline unwinding: only save the stack, referenced by a single fake IP
+   if (unwind_data->addr_space == NULL) {
+      const uint64_t stack_id = save_raw_stack (context, sampler_data, tid,
+                                                &(unwind_data->context), dyn_size);
+      if (stack_id != 0) {
+         sampleInfo->callChainAddress[0] = stack_id;
+         sampleInfo->nbAddresses = 1;
+      }
       return 0;
-   };
-   do {
-      unw_get_reg (&cursor, UNW_REG_IP, &ips[nr++]);
-      DBGMSG ("[%lu] rip=%"PRIx64"\n", nr, ips[nr-1]);
-   } while (unw_step (&cursor) > 0 && nr < CC_MAX_LEN);
-   DBGMSG ("nr=%lu\n", nr);
+   }
+
+   // Read callchain in stack (unwind)
+   const size_t nr = unwind_stack (unwind_data->addr_space, &(unwind_data->context),
+                                   sampleInfo->callChainAddress, CC_MAX_LEN);
 
    if (nr > 1) {
       sampleInfo->nbAddresses = (nr <= CC_MAX_LEN ? nr : CC_MAX_LEN);
@@ -553,21 +542,105 @@ IP_callchain_t *lookup_IP_callchain (const lprof_queue_t *callchains,
    return NULL;
 }
 
+// Returns a hash of the IPs of a callchain
+static uint64_t hash_callchain (uint32_t nb_IPs, const uint64_t *IPs)
+{
+   uint64_t h = nb_IPs;
+   uint32_t i;
+   for (i=0; i<nb_IPs; i++) {
+      h = (h ^ IPs[i]) * 0x9E3779B97F4A7C15ULL;
+      h ^= h >> 29;
+   }
+   return h;
+}
+
+// Returns non zero if an interned callchain has the IPs of a sampled callchain
+static int match_callchain (const void *data, const void *user)
+{
+   const interned_callchain_t *interned = data;
+   const sampleInfo_t *callchain = user;
+
+   if (interned->nb_IPs != callchain->nbAddresses) return FALSE;
+   return memcmp (interned->IPs, callchain->callChainAddress,
+                  interned->nb_IPs * sizeof interned->IPs[0]) == 0;
+}
+
+/* Returns the interned copy of a sampled callchain, saved in the current sampler thread buffer
+ * Creates it if this callchain was never sampled since the last buffer reset
+ * IDs are given only to inserted callchains: they are unique in the buffer */
+static interned_callchain_t *intern_callchain (sampler_data_buf_t *cur, const sampleInfo_t *callchain)
+{
+   const uint64_t hash = hash_callchain (callchain->nbAddresses, callchain->callChainAddress);
+   interned_callchain_t *interned = lprof_hashtable_lookup_match (cur->callchains, hash,
+                                                                  match_callchain, callchain);
+   if (interned != NULL) return interned;
+
+   // First time for this callchain => create
+   interned = buf_add (cur->buf, sizeof *interned);
+   if (!interned) return NULL;
+   const size_t cc_size = callchain->nbAddresses * sizeof interned->IPs[0];
+   interned->IPs = buf_add (cur->buf, cc_size);
+   if (!interned->IPs) return NULL;
+   memcpy (interned->IPs, callchain->callChainAddress, cc_size);
+   interned->nb_IPs = callchain->nbAddresses;
+   const lprof_hashtable_nnodes_t nnodes = cur->callchains->nnodes;
+   lprof_hashtable_insert (cur->callchains, hash, interned);
+   if (cur->callchains->nnodes == nnodes) return NULL; // not inserted (table full)
+   interned->id = ++(cur->last_callchain_id);
+
+   return interned;
+}
+
+/* Returns the size allocated in the current sampler thread buffer by save_sample_in_results for a sample
+ * Objects to create are found by the same lookups (except for the interned callchain, counted as new),
+ * tables to insert to give their actual growth */
+static size_t get_sample_needed_size (const smpl_context_t *context, const sampler_data_t *sampler_data,
+                                      uint64_t ip, uint32_t tid, int rank, const sampleInfo_t *callchain)
+{
+   const sampler_data_buf_t *cur = sampler_data->cur;
+   size_t size = 0;
+
+   // Thread and address
+   const lprof_hashtable_t *ip2smp = lprof_hashtable_lookup (cur->tid2ipt, tid);
+   const IP_events_t *IP_events = NULL;
+   if (ip2smp == NULL)
+      size += lprof_hashtable_grow_size (cur->tid2ipt) + lprof_hashtable_new_size (IP2SMP_SIZE);
+   else
+      IP_events = lprof_hashtable_lookup (ip2smp, ip);
+   if (IP_events == NULL)
+      size += lprof_hashtable_grow_size (ip2smp) + sizeof *IP_events + sizeof (lprof_queue_t)
+         + context->events_per_group * sizeof IP_events->eventsNb[0];
+
+   if (rank != 0) return size;
+
+   // Callchain: interned copy and first occurrence at this address
+   if (callchain != NULL && callchain->nbAddresses > 0) {
+      size += sizeof (interned_callchain_t) + callchain->nbAddresses * sizeof callchain->callChainAddress[0]
+         + lprof_hashtable_grow_size (cur->callchains) + sizeof (IP_callchain_t) + sizeof (lprof_list_t);
+      if (IP_events == NULL || IP_events->id2callchain == NULL)
+         size += lprof_hashtable_new_size (ID2CC_SIZE);
+      else
+         size += lprof_hashtable_grow_size (IP_events->id2callchain);
+   }
+
+   // CPUs histogram of the thread
+   if (lprof_hashtable_lookup (cur->tid2cpu, tid) == NULL)
+      size += lprof_hashtable_grow_size (cur->tid2cpu) + context->online_cpus * sizeof (hits_nb_t);
+
+   return size;
+}
+
 // PERFORMANCE AND RESULTS CRITICAL: HIGH EFFORT NEEDED FOR DESIGN/IMPLEMENTATION
 /* Saves sample data to lprof internal structures (per thread/IP hashtables)
  * Tightly coupled with what comes next in lprof...
- * Present implementation based on old lprof data structures (not optimal...) */
+ * Callchains are interned once per buffer and looked up by their ID in each IP */
 void save_sample_in_results (smpl_context_t *context,
                              uint64_t ip, uint32_t tid,
                              int rank, uint32_t cpu,
                              sampleInfo_t *callchain,
                              sampler_data_t *sampler_data)
 {
-#ifndef NDEBUG
-   static uint64_t cycles = 0;
-   static uint64_t visits = 1;
    uint64_t start; rdtscll (start);
-#endif
 
    sampler_data_buf_t *cur = sampler_data->cur;
    buf_t *buf = cur->buf;
@@ -594,6 +667,7 @@ void save_sample_in_results (smpl_context_t *context,
 
       IP_events = buf_add (buf, sizeof *IP_events);
       IP_events->callchains = lprof_queue_new (buf);
+      IP_events->id2callchain = NULL; // created with first callchain
       IP_events->eventsNb = buf_add (buf, context->events_per_group *
                                      sizeof IP_events->eventsNb[0]);
       for (i=0; i<context->events_per_group; i++) IP_events->eventsNb[i] = 0;
@@ -606,20 +680,22 @@ void save_sample_in_results (smpl_context_t *context,
 
    // INSERT CALLCHAIN INFO
    if (rank == 0 && callchain != NULL && callchain->nbAddresses > 0) {
-      IP_callchain_t *found_callchain = lookup_IP_callchain (IP_events->callchains,
-                                                             callchain->nbAddresses,
-                                                             callchain->callChainAddress);
-      if (found_callchain == NULL) {
-         // First time for this callchain => create
-         IP_callchain_t *cc = buf_add (buf, sizeof *cc);
-         cc->nb_hits = 1;
-         cc->nb_IPs = callchain->nbAddresses;
-         const size_t cc_size = callchain->nbAddresses * sizeof cc->IPs[0];
-         cc->IPs = buf_add (buf, cc_size);
-         memcpy (cc->IPs, callchain->callChainAddress, cc_size);
-         lprof_queue_add (IP_events->callchains, cc);   
-      } else {
-         found_callchain->nb_hits++;
+      interned_callchain_t *interned = intern_callchain (cur, callchain);
+      if (interned != NULL) {
+         if (IP_events->id2callchain == NULL)
+            IP_events->id2callchain = lprof_hashtable_new (buf, ID2CC_SIZE);
+         IP_callchain_t *found_callchain = lprof_hashtable_lookup (IP_events->id2callchain, interned->id);
+         if (found_callchain == NULL) {
+            // First time for this callchain at this address => create, sharing interned IPs
+            IP_callchain_t *cc = buf_add (buf, sizeof *cc);
+            cc->nb_hits = 1;
+            cc->nb_IPs = interned->nb_IPs;
+            cc->IPs = interned->IPs;
+            lprof_queue_add (IP_events->callchains, cc);
+            lprof_hashtable_insert (IP_events->id2callchain, interned->id, cc);
+         } else {
+            found_callchain->nb_hits++;
+         }
       }
    }
 
@@ -635,19 +711,14 @@ void save_sample_in_results (smpl_context_t *context,
       cpus[cpu]++;
    }
 
-#ifndef NDEBUG
    uint64_t stop; rdtscll (stop);
-   DBG (cycles += (stop - start);
-        if (visits % (100 * 1000) == 0)
-           fprintf (stderr, "Average %"PRIu64" RDTSC cycles per save_sample_in_results call\n",
-                    cycles / visits); // integer division sufficient here
-        visits++);
-#endif
+   sampler_data->save_cycles += stop - start;
+   sampler_data->saved_samples++;
 }
 
 // PERFORMANCE AND RESULTS CRITICAL: HIGH EFFORT NEEDED FOR DESIGN/IMPLEMENTATION
 // Reads + processes a sample of type PERF_RECORD_SAMPLE
-static int read_record_sample (smpl_context_t *context, perf_event_desc_t *group_fds, struct perf_event_header *header, sampler_data_t *sampler_data)
+static int read_record_sample (smpl_context_t *context, perf_event_desc_t *group_fds, const struct perf_event_header *header, sampler_data_t *sampler_data)
 {
    // Info read from the sample
    //   For all events in the group
@@ -661,44 +732,42 @@ static int read_record_sample (smpl_context_t *context, perf_event_desc_t *group
    uint64_t ip_buf [CC_MAX_LEN];
    sampleInfo_t sampleInfo = { .nbAddresses = 0, .callChainAddress = ip_buf }; // Callchain/stack/branch infos
 
-   // Get payload size (excluding metadata/header)
-   size_t sz = header->size - sizeof *header;
+   // Payload (excluding metadata/header), read in place
+   perf_record_cursor_t record;
+   perf_record_cursor_init (&record, header);
 
    perf_event_desc_t *group_leader = &group_fds[0];
    const uint64_t type = group_leader->hw.sample_type;
 
    // Read address of the instruction responsible of overflow (IP = Instruction Pointer)
    if (type & PERF_SAMPLE_IP) {
-      if (perf_read_buffer_64 (group_leader, &ip) == -1) {
+      if (perf_record_read_64 (&record, &ip) == -1) {
          DBGMSG0 ("Cannot read IP\n");
          return -1;
       }
       DBGMSGLVL(1, "IP=%p\n", (void *) ip);
-      sz -= sizeof ip;
    }
 
    // Read thread ID (TID = Thread ID)
    // TODO: remove this in ptrace-mode (since each perf-events group mapped to 1 thread)
    if (type & PERF_SAMPLE_TID) {
       struct { uint32_t pid, tid; } pid_tid;
-      if (perf_read_buffer_64 (group_leader, &pid_tid) == -1) {
+      if (perf_record_read_64 (&record, &pid_tid) == -1) {
          DBGMSG0 ("Cannot read TID\n");
          return -1;
       }
       DBGMSGLVL(1, "PID=%"PRIu32" TID=%"PRIu32"\n", pid_tid.pid, pid_tid.tid);
-      sz -= sizeof pid_tid;
       pid = pid_tid.pid;
       tid = pid_tid.tid;
    }
 
    // Read event ID, allow to disambiguate members in perf-events group
    if (type & PERF_SAMPLE_ID) {
-      if (perf_read_buffer_64 (group_leader, &id) == -1) {
+      if (perf_record_read_64 (&record, &id) == -1) {
          DBGMSG0 ("Cannot read ID\n");
          return -1;
       }
       DBGMSGLVL(1, "ID=%"PRIu64"\n", id);
-      sz -= sizeof id;
    }
 
    // Get rank of current event in perf-events group
@@ -713,25 +782,24 @@ static int read_record_sample (smpl_context_t *context, perf_event_desc_t *group
       // Read CPU rank
       if (type & PERF_SAMPLE_CPU) {
          struct { uint32_t cpu, res; } _cpu;
-         if (perf_read_buffer_64 (group_leader, &_cpu) == -1) {
+         if (perf_record_read_64 (&record, &_cpu) == -1) {
             DBGMSG0 ("Cannot read CPU\n");
             return -1;
          }
          DBGMSGLVL(1, "CPU=%"PRIu32"\n", _cpu.cpu);
-         sz -= sizeof _cpu;
          cpu = _cpu.cpu;
       }
 
       // Read callchain
       if (type & PERF_SAMPLE_CALLCHAIN) {
-         int ret = read_sample_callchain (group_leader, &sz, &sampleInfo);
+         int ret = read_sample_callchain (&record, &sampleInfo);
          if (ret != 0) return ret;
       }
 
       // Read branch stack (Intel LBR, HW support)
       if (type & PERF_SAMPLE_BRANCH_STACK) {
-         int ret = read_sample_branch_stack (group_leader, NULL /* TODO: &sampleInfo*/);
-         sz -= ret;
+         int ret = skip_sample_branch_stack (&record); // TODO: save to sampleInfo
+         if (ret != 0) return ret;
       }
 
 #ifdef __LIBUNWIND__
@@ -741,31 +809,32 @@ static int read_record_sample (smpl_context_t *context, perf_event_desc_t *group
          unwind_data_t *unwind_data = hashtable_lookup (sampler_data->unwind_data, (void *)(uint64_t) tid);
          if (unwind_data == NULL) {
             unwind_data = lc_malloc (sizeof *unwind_data);
-            unwind_data->addr_space = unw_create_addr_space (get_unw_accessors(), 0);
+            // Offline unwinding: maps are loaded now (still available) but stacks are unwound after collection
+            unwind_data->addr_space = context->offline_unwinding == TRUE ? NULL :
+               unw_create_addr_space (get_unw_accessors(), 0);
             memset (&unwind_data->context, 0, sizeof unwind_data->context);
             unwind_data->context.maps = load_maps (pid, tid);
             hashtable_insert (sampler_data->unwind_data, (void *)(uint64_t) tid, unwind_data);
          }
          unwind_data->context.ip = ip;
-         int ret_regs = read_sample_regs_user (group_leader, &sz, &(unwind_data->context));
+         sampleInfo.callChainAddress = ip_buf; // unwinding writes IPs
+         int ret_regs = read_sample_regs_user (&record, &(unwind_data->context));
          if (ret_regs == -1) return -1; // sampling corruption
          if (ret_regs == 0) {
-            int ret_stack = read_sample_stack_user (group_leader, &sz, &sampleInfo, unwind_data);
+            int ret_stack = read_sample_stack_user (context, sampler_data, &record, tid,
+                                                    &sampleInfo, unwind_data);
             if (ret_stack != 0) return ret_stack; // -1: sampling corruption, -2: emergency stop
          }
       }
 #endif // __LIBUNWIND__
    }
 
-   // Read/consume potentially leftover data in sample. Ring buffer corruption otherwise !
-   if (sz) {
-      DBGMSG ("%lu leftover bytes in sample\n", sz);
-      perf_skip_buffer (group_leader, sz);
-   }
+   // Leftover data in sample are skipped with the whole record
+   if (record.sz) DBGMSG ("%lu leftover bytes in sample\n", record.sz);
 
    // Save previously read data to internal structures
    if (tid > 0) {
-      size_t needed_size = 200 + IP2SMP_SIZE * sizeof (hashnode_t *);
+      size_t needed_size = get_sample_needed_size (context, sampler_data, ip, tid, rank, &sampleInfo);
       if (needs_swap_to_files (sampler_data, needed_size)) {
          swap_to_files (context, sampler_data);
       } else if (needs_dump_to_files (sampler_data, needed_size)) {
@@ -781,24 +850,20 @@ static int read_record_sample (smpl_context_t *context, perf_event_desc_t *group
 }
 
 // Reads PERF_RECORD_LOST records, containing number of lost events (due to buffer being full)
-static int read_record_lost (perf_event_desc_t *group_fds, struct perf_event_header *header, sampler_data_t *sampler_data)
+static int read_record_lost (const struct perf_event_header *header, sampler_data_t *sampler_data)
 {
    uint64_t nb;
-   size_t sz = header->size - sizeof *header;
-   perf_event_desc_t *group_leader = &group_fds[0];
+   perf_record_cursor_t record;
+   perf_record_cursor_init (&record, header);
 
-   perf_skip_buffer (group_leader, sizeof (uint64_t)); // id seems not reliable...
+   perf_record_skip (&record, sizeof (uint64_t)); // id seems not reliable...
 
-   if (perf_read_buffer_64 (group_leader, &nb) == -1) {
+   if (perf_record_read_64 (&record, &nb) == -1) {
       DBGMSG0 ("Cannot read nb lost events\n");
       return -1;
    }
-   sz -= 2*8;
 
-   if (sz) {
-      DBGMSG ("%lu leftover bytes in loss record\n", sz);
-      perf_skip_buffer (group_leader, sz);
-   }
+   if (record.sz) DBGMSG ("%lu leftover bytes in loss record\n", record.sz);
 
    sampler_data->lost_events += nb;
 
@@ -806,71 +871,72 @@ static int read_record_lost (perf_event_desc_t *group_fds, struct perf_event_hea
 }
 
 // PERFORMANCE AND RESULTS CRITICAL: HIGH EFFORT NEEDED FOR DESIGN/IMPLEMENTATION
-// At each overflow, process all data present in the perf_event_open ring buffer
+/* At each overflow, process all data present in the perf_event_open ring buffer
+ * Records are read in place by batches: ring buffer space is released to the kernel once per batch */
 // TODO: rename this (for example to process_samples_in_ring_buffer)
 void process_overflow (smpl_context_t *context, perf_event_desc_t *group_fds, sampler_data_t *sampler_data)
 {
    perf_event_desc_t *group_leader = &(group_fds[0]);
-   struct perf_event_header header;
+   perf_record_iter_t iter;
 
-   // Loop over all records in ring buffer
+   // Loop over batches until ring buffer is empty
    for(;;) {
-      // Read record header => allows to know its type and read its content accordingly
-      int ret = perf_read_buffer (group_leader, &header, sizeof header);
-      if (ret || header.size == 0) return; // nothing to read
-
-      /* Remark: All records needs to be entirely read: use perf_read_buffer (or perf_skip_buffer
-       * if not interested with record content) and check for leftover bytes */
-
-      // Get size available in buffer: should be at least equal to record size
-      struct perf_event_mmap_page *metadata = group_leader->buf;
-      size_t avail_sz = metadata->data_head - metadata->data_tail;
-      size_t record_sz = header.size - sizeof(header);
-      if (avail_sz < record_sz) {
-         WRNMSG ("Corrupted sampling: lprof tries to continue but events will probably be lost\n");
-         DBGMSG ("Available buffer space (%lu) lower than record size (%lu)\n", avail_sz, record_sz);
-         perf_skip_buffer (group_leader, record_sz);
-         continue;
-      }
-
-      switch (header.type) {
+      perf_record_iter_begin (&iter, group_leader);
+      unsigned nb_records = 0;
+
+      // Loop over all records in batch (records received since batch start)
+      const struct perf_event_header *header;
+      while ((header = perf_record_iter_next (&iter)) != NULL) {
+         nb_records++;
+
+         switch (header->type) {
+
+            // Sample record (most interesting)
+         case PERF_RECORD_SAMPLE:
+            {
+               sampler_data->coll_events++;
+               int ret = read_record_sample (context, group_fds, header, sampler_data);
+               if (ret != 0 && ret != -2) {
+                  ERRMSG ("Corrupted sampling");
+                  clean_abort (context->child_pid, context->output_path);
+               }
+               else if (ret == -2) { // emergency stop
+                  perf_record_iter_end (&iter);
+                  return;
+               }
+            }
+            break;
 
-         // Sample record (most interesting)
-      case PERF_RECORD_SAMPLE:
-         {
+            // Records containing data about perf-events throttling
+         case PERF_RECORD_THROTTLE:
+         case PERF_RECORD_UNTHROTTLE:
             sampler_data->coll_events++;
-            int ret = read_record_sample (context, group_fds, &header, sampler_data);
-            if (ret != 0 && ret != -2) {
+            DBGMSG0LVL(2, "PERF_RECORD_(UN)THROTTLE\n");
+            break;
+
+            // Records containing an estimation for the number of events lost due to buffer being full
+         case PERF_RECORD_LOST:
+            DBGMSG0LVL(2, "PERF_RECORD_LOST\n");
+            if (read_record_lost (header, sampler_data) != 0) {
                ERRMSG ("Corrupted sampling");
                clean_abort (context->child_pid, context->output_path);
             }
-            else if (ret == -2) return; // emergency stop
-         }
-         break;
-
-         // Records containing data about perf-events throttling
-      case PERF_RECORD_THROTTLE:
-      case PERF_RECORD_UNTHROTTLE:
-         sampler_data->coll_events++;
-         DBGMSG0LVL(2, "PERF_RECORD_(UN)THROTTLE\n");
-         perf_skip_buffer (group_leader, header.size - sizeof(header));
-         break;
-
-         // Records containing an estimation for the number of events lost due to buffer being full
-      case PERF_RECORD_LOST:
-         DBGMSG0LVL(2, "PERF_RECORD_LOST\n");
-         if (read_record_lost (group_fds, &header, sampler_data) != 0) {
-            ERRMSG ("Corrupted sampling");
-            clean_abort (context->child_pid, context->output_path);
+            break;
+
+            // Other records, not handled by lprof
+         default:
+            DBGMSG ("Unexpected PERF_RECORD type: %d\n", header->type);
+            break;
          }
-         break;
+      }
 
-         // Other records, not handled by lprof
-      default:
-         DBGMSG ("Unexpected PERF_RECORD type: %d\n", header.type);
-         perf_skip_buffer (group_leader, header.size - sizeof(header));
-         break;
+      if (iter.corrupted) {
+         WRNMSG ("Corrupted sampling: lprof tries to continue but events will probably be lost\n");
+         DBGMSG ("Invalid record header after %u records\n", nb_records);
       }
+      perf_record_iter_end (&iter);
+
+      if (nb_records == 0) return; // nothing to read
    }
 }
 
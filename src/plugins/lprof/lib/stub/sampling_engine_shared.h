@@ -40,6 +40,8 @@
 #define SAMPLING_ENGINE_PTRACE  2
 #define SAMPLING_ENGINE_TIMERS  3
 
+#define CC_MAX_LEN   100 // Maximum callchain length for lprof
+
 // Number of hits for given HW event or CPU
 typedef uint32_t hits_nb_t; // remark: MAX_UINT32 => 50 days in same TID/IP/(HW-event/CPU)... !
 typedef uint32_t cpu_id_t;
@@ -57,10 +59,18 @@ typedef struct {
    uint64_t *IPs;
 } IP_callchain_t;
 
+// Callchain saved once in a sampler thread buffer, shared by all IP_callchain_t objects with same IPs
+typedef struct {
+   uint32_t id; // identifier in the buffer, starting from 1
+   uint32_t nb_IPs;
+   uint64_t *IPs;
+} interned_callchain_t;
+
 // Structure to save samples data in sampler thread buffers (in lprof_hashtable_t objects)
 typedef struct {
    hits_nb_t *eventsNb; // eventsNb [events_per_group]
    lprof_queue_t *callchains;
+   lprof_hashtable_t *id2callchain; // interned callchain ID to IP_callchain_t (in callchains)
 } IP_events_t;
 
 // Gather data structures + related allocator
@@ -70,6 +80,8 @@ typedef struct {
    // allocated in buf + inserted data
    lprof_hashtable_t *tid2ipt; // thread ID to (IP table = IP to IP_events)
    lprof_hashtable_t *tid2cpu; // thread ID to CPUs histogram
+   lprof_hashtable_t *callchains; // callchain hash to interned_callchain_t
+   uint32_t last_callchain_id; // ID of the last callchain inserted to callchains, 0 if none
 } sampler_data_buf_t;
 
 // Sampler-local data (one structure per sampler thread)
@@ -79,9 +91,9 @@ typedef struct {
    sampler_data_buf_t *file;
    sampler_data_buf_t *cur; // cur value is 'mem' and then 'file'
 
-   // Files to save samples (IP_events_t structures)
+   // Files to save samples (IP_events_t structures), written as chunks by a background thread
    char *smp_file_name, *smp_idx_file_name;
-   FILE *fp_smp, *fp_smp_idx;
+   struct IP_events_stream_writer_s *smp_writer; // see IP_events_stream.h
 
    // Files to save CPUs used for each system thread
    char *cpu_file_name, *cpu_idx_file_name;
@@ -89,8 +101,17 @@ typedef struct {
 
    uint64_t lost_events; // nb of events lost
    uint64_t coll_events; // nb of events collected
+   uint64_t saved_samples; // nb of samples saved by save_sample_in_results
+   uint64_t save_cycles; // cycles (timestamp counter ticks) spent in save_sample_in_results
 #ifdef __LIBUNWIND__
    hashtable_t *unwind_data; // unwind_data_t [pid]
+
+   // Raw user stacks saved for offline unwinding (see unwind_offline.h)
+   char *stk_file_name;
+   FILE *fp_stk;
+   hashtable_t *stk_hash2rank; // stack hash to stack rank (starting from 1) in stk_file_name
+   uint64_t nb_stacks;
+   IP_callchain_t *stk_callchains; // unwound stacks [nb_stacks], set by unwind_raw_stacks
 #endif
 } sampler_data_t;
 
@@ -118,6 +139,7 @@ typedef struct {
    size_t max_files_size; // maximum size, in Megabytes, for temporary files
    size_t files_buf_size; // size of files buffer
    boolean_t emergency_stop;
+   boolean_t offline_unwinding; // TRUE if stacks are saved during collection and unwound after
 } smpl_context_t;
 
 // Methods to handle sampler thread data (buffer/allocator and related tables)
@@ -169,7 +191,7 @@ IP_callchain_t *lookup_IP_callchain (const lprof_queue_t *callchains,
 
 /* Saves sample data to lprof internal structures (per thread/IP hashtables)
  * Tightly coupled with what comes next in lprof...
- * Present implementation based on old lprof data structures (not optimal...) */
+ * Callchains are interned once per buffer and looked up by their ID in each IP */
 void save_sample_in_results (smpl_context_t *context,
                              uint64_t ip, uint32_t tid,
                              int rank, uint32_t cpu,
@@ -1,126 +1,54 @@
-#include <stdio.h>
-#include <errno.h>
-#include <time.h>        // nanosleep
-#include <dirent.h>      // DIR, opendir...
-#include <signal.h>
-#include <sys/types.h>   // waitpid
-#include <sys/wait.h>    // waitpid
-#include <sys/ptrace.h>  // ptrace
-#include <sys/user.h>    // user_regs_struct
-#include <pthread.h>     // pthread_create...
-#include "libmcommon.h"  // array_t
-#include "sampling_engine_shared.h" // smpl_context_t, enable/disable_events_group, process_overflow...
-
-static void get_tids (pid_t pid, array_t *tids)
-{
-   array_flush (tids, NULL);
-
-   char task_dir_name [strlen ("/proc/999999/task") + 1];
-   sprintf (task_dir_name, "/proc/%d/task", pid);
-
-   DIR *dir = opendir (task_dir_name);
-   if (!dir) {
-      perror ("opendir");
-      return;
-   }
-
-   struct dirent *dir_entry;
-   while ((dir_entry = readdir (dir)) != NULL) {
-      char *endptr;
-      long tid = strtol (dir_entry->d_name, &endptr, 10);
-      if (tid < 1 || *endptr != '\0') continue;
-      array_add (tids, (void *)(uint64_t) tid);
-   }
-
-   closedir (dir);
-}
-
-typedef struct {
-   pid_t child_pid;
-   size_t period;
-} OSC_params_t;
-
-static void *OS_clock_routine (void *pparams)
-{
-   OSC_params_t *params = pparams;
-
-   struct timespec req = { .tv_sec = params->period/1000, .tv_nsec = (params->period%1000) * (1000*1000) };
-   while (TRUE) {
-      nanosleep (&req, NULL);
-      kill (params->child_pid, SIGSTOP);
-   }
-
-   return NULL;
-}
-
-/* Collects samples using OS timers
- * \param context sampling context
+/*
+   Copyright (C) 2004 - 2018 Université de Versailles Saint-Quentin-en-Yvelines (UVSQ)
+
+   This file is part of MAQAO.
+
+  MAQAO is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public License
+   as published by the Free Software Foundation; either version 3
+   of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+/* Defines functions used only by the OS timers based sampling engine
+ * Application threads are no more stopped at each tick: the kernel CPU clock
+ * software event overflows in each thread and writes samples into the same
+ * ring buffers as hardware events, processed by the inherit engine */
+
+#include <stdio.h>       // FILE (perf_util.h)
+#include <stdlib.h>      // calloc
+#include <string.h>      // strdup
+#include "sampling_engine_timers.h"
+
+/* Returns a perf-event description for the OS clock event, to be freed with perf_free_fds
+ * Only user-space time is sampled: compatible with perf_event_paranoid=2
  * \param period sampling period in milliseconds
- * \param finalize_signal Signal used by some parallel launchers to notify ranks finalization */
-void timers_sampler (smpl_context_t *const context, size_t period, int finalize_signal)
+ * \return perf-event description or NULL if allocation failed */
+perf_event_desc_t *timers_setup_event (size_t period)
 {
-   const pid_t child_pid = context->child_pid;
-
-   pthread_t OS_clock;
-   OSC_params_t params = { .child_pid = context->child_pid, .period = period };
-   if (pthread_create (&OS_clock, NULL, OS_clock_routine, &params)) {
-      perror ("Cannot create a worker thread");
-      clean_abort (context->child_pid, context->output_path);
-   }
-  
-   array_t *tids = array_new();
-   int status; pid_t child;
-   // Wait for signals from any process forked from the original application process
-   while ((child = waitpid (-child_pid, &status, WUNTRACED | WCONTINUED | __WALL)) != -1) {
-      DBGMSG ("tracer %d: got %d from waitpid\n", getpid(), child);
-
-      // An application process exited or were signaled (killed...)
-      if (WIFEXITED(status)) {
-         DBGMSG ("tracer %d: %d exited with status %d\n", getpid(), child, WEXITSTATUS(status));
-         continue;
-      }
-
-      if (WIFSIGNALED(status)) {
-         DBGMSG ("tracer %d: %d terminated by signal %d\n", getpid(), child, WTERMSIG(status));
-         kill (child, SIGKILL);
-         continue;
-      }
-
-      if (!WIFSTOPPED(status)) continue;
-      DBGMSG ("tracer %d: %d stopped by signal %d\n", getpid(), child, WSTOPSIG(status));
-
-      if (WSTOPSIG(status) == SIGSTOP) {
-         get_tids (child, tids);
-         FOREACH_INARRAY (tids, tid_iter) {
-            pid_t tid = (pid_t)(uint64_t) ARRAY_GET_DATA (uint64_t, tid_iter);
-            ptrace (PTRACE_ATTACH, tid, (void *)0, (void *)0);
-            struct user_regs_struct regs;
-            ptrace (PTRACE_GETREGS, tid, &regs, &regs);
-            ptrace (PTRACE_DETACH, tid, (void *)0, (void *)0);
-         }
-      }
-      else {
-         if (WSTOPSIG(status) == finalize_signal) {
-            DBGMSG ("tracer %d: %d stopped by finalize signal\n", getpid(), child);
-            kill (-child_pid, SIGTERM);
-            break;
-         }
-
-#if defined (SIGRTMIN) && defined (SIGRTMAX)
-         if (WSTOPSIG(status) >= SIGRTMIN && WSTOPSIG(status) <= SIGRTMAX) {
-            DBGMSG ("tracer %d: %d stopped by real-time signal\n", getpid(), child);
-         }
-         else {
-            DBGMSG ("tracer %d: unhandled STOPSIG for %d\n", getpid(), child);
-         }
-#else
-         DBGMSG ("tracer %d: unhandled STOPSIG for %d\n", getpid(), child);
-#endif
-      }
-
-      kill (child, SIGCONT);
-   }
-
-   array_free (tids, NULL);
-   pthread_cancel (OS_clock);
+   perf_event_desc_t *fds = calloc (1, sizeof fds[0]);
+   if (fds == NULL) return NULL;
+
+   struct perf_event_attr *hw = &(fds[0].hw);
+   hw->size   = sizeof *hw;
+   hw->type   = PERF_TYPE_SOFTWARE;
+   hw->config = PERF_COUNT_SW_CPU_CLOCK;
+   hw->sample_period  = period * 1000 * 1000; // ms => ns
+   hw->exclude_kernel = 1;
+   hw->exclude_hv     = 1;
+
+   fds[0].name = strdup (TIMERS_EVENT_NAME);
+   fds[0].group_leader = 0;
+   fds[0].max_fds = 1;
+   fds[0].fd = -1;
+
+   return fds;
 }
@@ -18,9 +18,18 @@
    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
  */
 
-/* Collects samples using OS timers
- * \param context sampling context
- * \param period sampling period in milliseconds
- * \param finalize_signal Signal used by some parallel launchers to notify ranks finalization */
-void timers_sampler (smpl_context_t *const context, size_t period, int finalize_signal);
+/* Declares functions used only by the OS timers based sampling engine */
 
+#ifndef __SAMPLING_ENGINE_TIMERS_H__
+#define __SAMPLING_ENGINE_TIMERS_H__
+
+#include "perf_util.h" // perf_event_desc_t
+
+// Name of the OS clock event, as written in IP_events.lprof
+#define TIMERS_EVENT_NAME "OS_CLK"
+
+/* Returns a perf-event description for the OS clock event, to be freed with perf_free_fds
+ * \param period sampling period in milliseconds */
+perf_event_desc_t *timers_setup_event (size_t period);
+
+#endif // __SAMPLING_ENGINE_TIMERS_H__
@@ -33,6 +33,7 @@
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <fcntl.h>
+#include <pthread.h>
 
 #include "libmcommon.h" // array_t
 #include "unwind.h" // unwind_context_t
@@ -210,6 +211,52 @@ static int read_eh_frame_header (int fd, uint64_t *table_data,
    return offset ? 0 : -3;
 }
 
+// .eh_frame_hdr location in a module file, read once per module (file name)
+typedef struct {
+   int status; // read_eh_frame_header return value
+   uint64_t table_data;
+   uint64_t segbase;
+   uint64_t fde_count;
+} eh_frame_hdr_t;
+
+static hashtable_t *eh_frame_hdrs = NULL; // module file name to eh_frame_hdr_t
+static pthread_mutex_t eh_frame_hdrs_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+/* Same as read_eh_frame_header, from a module file name and cached per module:
+ * all threads/processes mapping a given module share the same table location */
+static int get_eh_frame_header (const char *name, uint64_t *table_data,
+                                uint64_t *segbase, uint64_t *fde_count)
+{
+   pthread_mutex_lock (&eh_frame_hdrs_mutex);
+   if (eh_frame_hdrs == NULL)
+      eh_frame_hdrs = hashtable_new (str_hash, str_equal);
+
+   eh_frame_hdr_t *hdr = hashtable_lookup (eh_frame_hdrs, name);
+   if (hdr == NULL) {
+      hdr = lc_malloc0 (sizeof *hdr);
+      int fd = open (name, O_RDONLY);
+      hdr->status = read_eh_frame_header (fd, &(hdr->table_data), &(hdr->segbase), &(hdr->fde_count));
+      if (fd >= 0) close (fd);
+      hashtable_insert (eh_frame_hdrs, lc_strdup (name), hdr);
+   }
+   pthread_mutex_unlock (&eh_frame_hdrs_mutex);
+
+   *table_data = hdr->table_data;
+   *segbase    = hdr->segbase;
+   *fde_count  = hdr->fde_count;
+   return hdr->status;
+}
+
+void free_eh_frame_headers (void)
+{
+   pthread_mutex_lock (&eh_frame_hdrs_mutex);
+   if (eh_frame_hdrs != NULL) {
+      hashtable_free (eh_frame_hdrs, lc_free, lc_free);
+      eh_frame_hdrs = NULL;
+   }
+   pthread_mutex_unlock (&eh_frame_hdrs_mutex);
+}
+
 int cmp_maps (const void *a, const void *b)
 {
    const map_t *ma = a;
@@ -246,8 +293,7 @@ static int find_proc_info(unw_addr_space_t as, unw_word_t ip,
    }
    if (map->di == NULL) {
       uint64_t table_data = 0, segbase = 0, fde_count = 0;
-      int map_fd = open (map->name, O_RDONLY);
-      if (!read_eh_frame_header (map_fd, &table_data, &segbase, &fde_count)) {
+      if (!get_eh_frame_header (map->name, &table_data, &segbase, &fde_count)) {
          map->di = lc_malloc0 (sizeof *(map->di));
          map->di->format   = UNW_INFO_FORMAT_REMOTE_TABLE;
          map->di->start_ip = map->start;
@@ -256,7 +302,6 @@ static int find_proc_info(unw_addr_space_t as, unw_word_t ip,
          map->di->u.rti.table_data = map->start + table_data - map->offset;
          map->di->u.rti.table_len  = fde_count * sizeof(uint64_t) / sizeof(unw_word_t);
       }
-      close (map_fd);
    }
 
    int ret = -UNW_EINVAL;
@@ -476,4 +521,24 @@ unw_accessors_t *get_unw_accessors (void)
    return &unw_accessors;
 }
 
+size_t unwind_stack (unw_addr_space_t addr_space, unwind_context_t *context, uint64_t *IPs, size_t max_IPs)
+{
+   size_t nr = 0;
+   unw_cursor_t cursor;
+   int ret = unw_init_remote (&cursor, addr_space, context);
+   if (ret < 0) {
+      DBGMSG ("Cannot unw_init_remote: returned %d\n", ret);
+      return 0;
+   };
+   do {
+      unw_word_t ip;
+      unw_get_reg (&cursor, UNW_REG_IP, &ip);
+      IPs[nr++] = ip;
+      DBGMSG ("[%lu] rip=%"PRIx64"\n", nr, IPs[nr-1]);
+   } while (unw_step (&cursor) > 0 && nr < max_IPs);
+   DBGMSG ("nr=%lu\n", nr);
+
+   return nr;
+}
+
 #endif
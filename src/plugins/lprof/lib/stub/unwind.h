@@ -26,4 +26,10 @@ typedef struct {
 
 unw_accessors_t *get_unw_accessors (void);
 
+// Unwinds the stack saved in context, writing at most max_IPs return addresses to IPs. Returns the number of IPs
+size_t unwind_stack (unw_addr_space_t addr_space, unwind_context_t *context, uint64_t *IPs, size_t max_IPs);
+
+// Frees .eh_frame_hdr locations cached per module by the find_proc_info accessor
+void free_eh_frame_headers (void);
+
 #endif // __UNWIND_H__
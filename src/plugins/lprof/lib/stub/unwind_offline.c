@@ -0,0 +1,299 @@
+/*
+   Copyright (C) 2004 - 2018 Université de Versailles Saint-Quentin-en-Yvelines (UVSQ)
+
+   This file is part of MAQAO.
+
+  MAQAO is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public License
+   as published by the Free Software Foundation; either version 3
+   of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+/* Defines functions to save user stacks during collection and unwind them after (offline unwinding) */
+
+#ifdef __LIBUNWIND__
+#include <stdio.h>
+#include <stdlib.h> // qsort
+#include <string.h>
+#include <unistd.h> // pread, close
+#include <fcntl.h>  // open
+#include <libunwind.h>
+
+#include "libmcommon.h" // hashtable_t, array_t, threadpool_run
+#include "unwind_offline.h"
+
+// Header of a raw stack record in stk*.tmp files, followed by 'size' stack bytes
+typedef struct {
+   uint32_t tid;
+   uint32_t size; // stack bytes effectively written by the kernel (dyn_size)
+   uint64_t ip;
+   uint64_t bp;
+   uint64_t sp;
+} raw_stack_header_t;
+
+// Saved stack, indexed after collection
+typedef struct {
+   raw_stack_header_t hdr;
+   uint64_t rank;   // rank in file, starting from 1
+   long offset;     // position of stack bytes in file
+} raw_stack_ref_t;
+
+// Stacks saved by a sampler thread for a given TID: unwound by the same task, owning related maps
+typedef struct {
+   sampler_data_t *sampler_data;
+   int fd; // raw stacks file, shared by all tasks of the sampler thread (pread)
+   uint32_t tid;
+   array_t *refs; // raw_stack_ref_t *
+} unwind_task_t;
+
+void init_raw_stacks (sampler_data_t *sampler_data, const char *process_path,
+                      unsigned rank, unsigned nb_sampler_threads)
+{
+   sampler_data->stk_file_name = lc_malloc (strlen (process_path) +
+                                            strlen ("/stk_999_999.tmp") + 1);
+   sprintf (sampler_data->stk_file_name, "%s/stk_%u_%u.tmp",
+            process_path, rank+1, nb_sampler_threads);
+   sampler_data->fp_stk = fopen (sampler_data->stk_file_name, "wb");
+   if (sampler_data->fp_stk == NULL)
+      ERRMSG ("Cannot open %s: callchains will not be available\n", sampler_data->stk_file_name);
+   sampler_data->stk_hash2rank = hashtable_new (direct_hash, direct_equal);
+   sampler_data->nb_stacks = 0;
+   sampler_data->stk_callchains = NULL;
+}
+
+// FNV-1a hash of a raw stack (header and content), 8 bytes at a time
+static uint64_t hash_raw_stack (const raw_stack_header_t *hdr, const char *stack)
+{
+   const uint64_t prime = 0x100000001b3ULL;
+   uint64_t hash = 0xcbf29ce484222325ULL;
+   uint64_t word;
+   size_t i;
+
+   for (i=0; i + sizeof word <= sizeof *hdr; i += sizeof word) {
+      memcpy (&word, (const char *) hdr + i, sizeof word);
+      hash = (hash ^ word) * prime;
+   }
+   for (i=0; i + sizeof word <= hdr->size; i += sizeof word) {
+      memcpy (&word, stack + i, sizeof word);
+      hash = (hash ^ word) * prime;
+   }
+   for (; i < hdr->size; i++)
+      hash = (hash ^ (uint8_t) stack[i]) * prime;
+
+   return hash;
+}
+
+// PERFORMANCE CRITICAL: called for each sample, replaces unwinding during collection
+uint64_t save_raw_stack (const smpl_context_t *context, sampler_data_t *sampler_data, uint32_t tid,
+                         const unwind_context_t *unwind_context, uint64_t dyn_size)
+{
+   if (sampler_data->fp_stk == NULL) return 0;
+
+   const raw_stack_header_t hdr = {
+      .tid  = tid,
+      .size = dyn_size < sizeof unwind_context->stack ? dyn_size : sizeof unwind_context->stack,
+      .ip   = unwind_context->ip,
+      .bp   = unwind_context->bp,
+      .sp   = unwind_context->sp,
+   };
+
+   // Identical stacks (same thread, registers and content) are saved only once
+   // remark: stacks are identified by a 64-bit hash, collisions are neglected
+   const uint64_t hash = hash_raw_stack (&hdr, unwind_context->stack);
+   uint64_t rank = (uint64_t) hashtable_lookup (sampler_data->stk_hash2rank, (void *) hash);
+   if (rank == 0) {
+      if (sampler_data->nb_stacks + 1 >= (1ULL << RAW_STACK_SAMPLER_SHIFT) ||
+          fwrite (&hdr, sizeof hdr, 1, sampler_data->fp_stk) != 1 ||
+          fwrite (unwind_context->stack, 1, hdr.size, sampler_data->fp_stk) != hdr.size) {
+         ERRMSG ("Cannot save stack to %s: next callchains will not be available\n",
+                 sampler_data->stk_file_name);
+         fclose (sampler_data->fp_stk);
+         sampler_data->fp_stk = NULL;
+         return 0;
+      }
+      rank = ++(sampler_data->nb_stacks);
+      hashtable_insert (sampler_data->stk_hash2rank, (void *) hash, (void *) rank);
+   }
+
+   const uint64_t sampler_rank = sampler_data - context->sampler_data;
+   return RAW_STACK_TAG | (sampler_rank << RAW_STACK_SAMPLER_SHIFT) | rank;
+}
+
+void close_raw_stacks_file (sampler_data_t *sampler_data)
+{
+   if (sampler_data->fp_stk != NULL) {
+      if (fclose (sampler_data->fp_stk) != 0) {
+         ERRMSG ("Write error in %s: callchains will not be available\n", sampler_data->stk_file_name);
+         sampler_data->nb_stacks = 0;
+      }
+      sampler_data->fp_stk = NULL;
+   }
+
+   // Deduplication table no more needed
+   hashtable_free (sampler_data->stk_hash2rank, NULL, NULL);
+   sampler_data->stk_hash2rank = NULL;
+}
+
+// Task of the threads pool: unwinds all stacks of a (sampler thread, TID) pair
+static void unwind_task (int task_id, void *user)
+{
+   const unwind_task_t *task = array_get_elt_at_pos (user, task_id);
+   sampler_data_t *const sd = task->sampler_data;
+
+   unwind_data_t *ud = hashtable_lookup (sd->unwind_data, (void *)(uint64_t) task->tid);
+   if (ud == NULL || ud->context.maps == NULL) return;
+
+   // Private stack buffer and address space. Maps (and cached mmaps/unwind tables) used only by this task
+   unwind_context_t *uc = lc_malloc (sizeof *uc);
+   uc->maps = ud->context.maps;
+   unw_addr_space_t addr_space = unw_create_addr_space (get_unw_accessors(), 0);
+   uint64_t IPs [CC_MAX_LEN];
+
+   FOREACH_INARRAY (task->refs, ref_iter) {
+      const raw_stack_ref_t *ref = ARRAY_GET_DATA (NULL, ref_iter);
+      if (pread (task->fd, uc->stack, ref->hdr.size, ref->offset) != (ssize_t) ref->hdr.size) {
+         DBGMSG ("Cannot read stack %"PRIu64" from %s\n", ref->rank, sd->stk_file_name);
+         continue;
+      }
+      memset (uc->stack + ref->hdr.size, 0, sizeof uc->stack - ref->hdr.size);
+      uc->ip = ref->hdr.ip;
+      uc->bp = ref->hdr.bp;
+      uc->sp = ref->hdr.sp;
+
+      const size_t nr = unwind_stack (addr_space, uc, IPs, CC_MAX_LEN);
+      if (nr <= 1) {
+         DBGMSGLVL (1, "Too small callchain (nr=%zu)\n", nr);
+         continue;
+      }
+      IP_callchain_t *cc = &(sd->stk_callchains [ref->rank - 1]);
+      cc->nb_IPs = nr;
+      cc->IPs = lc_malloc (nr * sizeof cc->IPs[0]);
+      memcpy (cc->IPs, IPs, nr * sizeof cc->IPs[0]);
+   }
+
+   unw_destroy_addr_space (addr_space);
+   lc_free (uc);
+}
+
+// Sorts tasks by decreasing number of stacks, to start the longest ones first
+static int cmp_tasks (const void *a, const void *b)
+{
+   const unwind_task_t *ta = *((unwind_task_t **) a);
+   const unwind_task_t *tb = *((unwind_task_t **) b);
+   const int na = array_length (ta->refs);
+   const int nb = array_length (tb->refs);
+
+   if (na == nb) return 0;
+   return na > nb ? -1 : 1;
+}
+
+void unwind_raw_stacks (smpl_context_t *context)
+{
+   const unsigned nb_smpl = context->nb_sampler_threads;
+   raw_stack_ref_t *refs [nb_smpl];
+   int fds [nb_smpl];
+   array_t *tasks = array_new ();
+   unsigned i;
+
+   // Index saved stacks and group them by (sampler thread, TID)
+   for (i=0; i<nb_smpl; i++) {
+      sampler_data_t *const sd = &(context->sampler_data[i]);
+      refs[i] = NULL;
+      fds[i] = -1;
+      if (sd->nb_stacks == 0) continue;
+
+      FILE *fp = fopen (sd->stk_file_name, "rb");
+      fds[i] = open (sd->stk_file_name, O_RDONLY);
+      if (fp == NULL || fds[i] < 0) {
+         ERRMSG ("Cannot read %s: callchains will not be available\n", sd->stk_file_name);
+         if (fp != NULL) fclose (fp);
+         continue;
+      }
+
+      sd->stk_callchains = lc_malloc0 (sd->nb_stacks * sizeof sd->stk_callchains[0]);
+      refs[i] = lc_malloc (sd->nb_stacks * sizeof refs[i][0]);
+      hashtable_t *tid2task = hashtable_new (direct_hash, direct_equal);
+      uint64_t rank;
+      for (rank = 1; rank <= sd->nb_stacks; rank++) {
+         raw_stack_ref_t *ref = &(refs[i][rank-1]);
+         if (fread (&(ref->hdr), sizeof ref->hdr, 1, fp) != 1 ||
+             ref->hdr.size > PERF_STACK_USER_SIZE) break;
+         ref->rank = rank;
+         ref->offset = ftell (fp);
+         if (fseek (fp, ref->hdr.size, SEEK_CUR) != 0) break;
+
+         unwind_task_t *task = hashtable_lookup (tid2task, (void *)(uint64_t) ref->hdr.tid);
+         if (task == NULL) {
+            task = lc_malloc (sizeof *task);
+            task->sampler_data = sd;
+            task->fd = fds[i];
+            task->tid = ref->hdr.tid;
+            task->refs = array_new ();
+            hashtable_insert (tid2task, (void *)(uint64_t) ref->hdr.tid, task);
+            array_add (tasks, task);
+         }
+         array_add (task->refs, ref);
+      }
+      if (rank <= sd->nb_stacks)
+         ERRMSG ("Read error in %s: some callchains will not be available\n", sd->stk_file_name);
+
+      fclose (fp);
+      hashtable_free (tid2task, NULL, NULL);
+   }
+
+   // Unwind in parallel
+   const int nb_tasks = array_length (tasks);
+   if (nb_tasks > 0) {
+      qsort (tasks->mem, nb_tasks, sizeof tasks->mem[0], cmp_tasks);
+      DBGMSG ("Unwinding stacks: %d tasks\n", nb_tasks);
+      threadpool_run (0, nb_tasks, &unwind_task, tasks);
+   }
+
+   FOREACH_INARRAY (tasks, task_iter) {
+      unwind_task_t *task = ARRAY_GET_DATA (NULL, task_iter);
+      array_free (task->refs, NULL);
+   }
+   array_free (tasks, lc_free);
+   for (i=0; i<nb_smpl; i++) {
+      lc_free (refs[i]);
+      if (fds[i] >= 0) close (fds[i]);
+   }
+}
+
+const IP_callchain_t *get_unwound_raw_stack (const smpl_context_t *context, uint64_t stack_id)
+{
+   const uint64_t sampler_rank = (stack_id & ~RAW_STACK_TAG_MASK) >> RAW_STACK_SAMPLER_SHIFT;
+   const uint64_t rank = stack_id & ((1ULL << RAW_STACK_SAMPLER_SHIFT) - 1);
+   if (sampler_rank >= context->nb_sampler_threads) return NULL;
+
+   const sampler_data_t *sd = &(context->sampler_data [sampler_rank]);
+   if (sd->stk_callchains == NULL || rank == 0 || rank > sd->nb_stacks) return NULL;
+
+   return &(sd->stk_callchains [rank - 1]);
+}
+
+void free_raw_stacks (sampler_data_t *sampler_data)
+{
+   close_raw_stacks_file (sampler_data);
+
+   if (sampler_data->stk_callchains != NULL) {
+      uint64_t i;
+      for (i=0; i<sampler_data->nb_stacks; i++)
+         lc_free (sampler_data->stk_callchains[i].IPs);
+      lc_free (sampler_data->stk_callchains);
+      sampler_data->stk_callchains = NULL;
+   }
+
+   remove (sampler_data->stk_file_name);
+   lc_free (sampler_data->stk_file_name);
+}
+#endif // __LIBUNWIND__
@@ -0,0 +1,66 @@
+/*
+   Copyright (C) 2004 - 2018 Université de Versailles Saint-Quentin-en-Yvelines (UVSQ)
+
+   This file is part of MAQAO.
+
+  MAQAO is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public License
+   as published by the Free Software Foundation; either version 3
+   of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+/* Declares functions to unwind user stacks after collection (offline unwinding)
+ * During collection, raw user registers and stacks are only saved to a temporary file
+ * per sampler thread (once per distinct stack) and samples reference them by a fake IP.
+ * After collection, saved stacks are unwound in parallel and fake IPs are replaced by
+ * unwound callchains when merging samples (see sampling_engine_dump_collect_data.c) */
+
+#ifndef __UNWIND_OFFLINE_H__
+#define __UNWIND_OFFLINE_H__
+
+#ifdef __LIBUNWIND__
+#include <stdint.h>
+#include "unwind.h" // unwind_context_t
+#include "sampling_engine_shared.h" // smpl_context_t, sampler_data_t, IP_callchain_t
+
+// Fake IP referencing a saved stack: tag + sampler thread rank + stack rank (in sampler thread file)
+// Non-canonical x86_64 address, cannot be a real IP
+#define RAW_STACK_TAG          0xFE00000000000000ULL
+#define RAW_STACK_TAG_MASK     0xFF00000000000000ULL
+#define RAW_STACK_SAMPLER_SHIFT 40
+#define IS_RAW_STACK_ID(IP) (((IP) & RAW_STACK_TAG_MASK) == RAW_STACK_TAG)
+
+// Sets raw stacks fields of a sampler thread and creates the related temporary file
+void init_raw_stacks (sampler_data_t *sampler_data, const char *process_path,
+                      unsigned rank, unsigned nb_sampler_threads);
+
+/* Saves a user stack, unless an identical one was already saved by the sampler thread
+ * Only the dyn_size first bytes (effectively written by the kernel) are saved
+ * Returns the fake IP referencing the stack or 0 on error */
+uint64_t save_raw_stack (const smpl_context_t *context, sampler_data_t *sampler_data, uint32_t tid,
+                         const unwind_context_t *unwind_context, uint64_t dyn_size);
+
+// Closes the raw stacks file of a sampler thread (end of collection)
+void close_raw_stacks_file (sampler_data_t *sampler_data);
+
+/* Unwinds all stacks saved by all sampler threads, with one task per (sampler thread, TID)
+ * executed on a threads pool. Requires maps loaded during collection (sampler_data->unwind_data) */
+void unwind_raw_stacks (smpl_context_t *context);
+
+// Returns the callchain unwound from a saved stack (NULL if unknown or not unwound)
+const IP_callchain_t *get_unwound_raw_stack (const smpl_context_t *context, uint64_t stack_id);
+
+// Removes the raw stacks file of a sampler thread and frees related data
+void free_raw_stacks (sampler_data_t *sampler_data);
+#endif // __LIBUNWIND__
+
+#endif // __UNWIND_OFFLINE_H__
@@ -26,7 +26,18 @@
 #include <stdio.h> // FILE
 #include <stdint.h> // int64_t...
 
+// Reads the timestamp counter: CPU cycles on x86, generic timer ticks on ARM64 (0 elsewhere)
+#if defined(__x86_64__) || defined(__i386__)
+#define rdtscll(val) do {                                               \
+      uint32_t __lo, __hi;                                              \
+      __asm__ __volatile__ ("rdtsc" : "=a" (__lo), "=d" (__hi));        \
+      (val) = ((uint64_t) __hi << 32) | __lo;                           \
+   } while (0)
+#elif defined(__aarch64__)
+#define rdtscll(val) __asm__ __volatile__ ("mrs %0, cntvct_el0" : "=r" (val))
+#else
 #define rdtscll(val) (val) = 0;
+#endif
 
 // Parse a string and split each element into an array from 0 to nbElements-1
 // str         The string to parse.
@@ -1196,9 +1196,21 @@ function init_project (args)
    if (args["disable-debug"] == true) then
       proj:set_option (Consts.PARAM_MODULE_DEBUG, Consts.PARAM_DEBUG_DISABLE_DEBUG, true);
    end
+   if (args["lazy-debug"] == true) then
+      proj:set_option (Consts.PARAM_MODULE_DEBUG, Consts.PARAM_DEBUG_LAZY_DWARF, true);
+   end
    if (args["lcore-flow-all"] == true) then
       proj:set_option (Consts.PARAM_MODULE_LCORE, Consts.PARAM_LCORE_FLOW_ANALYZE_ALL_SCNS, true);
    end
+   if (args["cache-dir"] ~= nil) then
+      proj:set_option (Consts.PARAM_MODULE_LCORE, Consts.PARAM_LCORE_CACHE_DIR, tostring (args["cache-dir"]));
+   end
+   if (args["threads"] ~= nil) then
+      local nb_threads = Utils:get_nb_threads (args)
+      proj:set_option (Consts.PARAM_MODULE_LCORE, Consts.PARAM_LCORE_NB_THREADS, nb_threads);
+      proj:set_option (Consts.PARAM_MODULE_DISASS, Consts.PARAM_DISASS_NB_THREADS, nb_threads);
+      proj:set_option (Consts.PARAM_MODULE_DEBUG, Consts.PARAM_DEBUG_NB_THREADS, nb_threads);
+   end
    
    proj:set_compiler_code (compiler_to_code (args.compiler))
    proj:set_language_code (language_to_code (args.language))